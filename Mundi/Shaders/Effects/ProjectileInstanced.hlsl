@@ -0,0 +1,78 @@
+//================================================================================================
+// Filename:      ProjectileInstanced.hlsl
+// Description:   FProjectileManager 인스턴스 렌더링 셰이더
+//                슬롯 0: 메시 정점 (UberLit과 같은 정점 포맷, Position/Normal만 사용)
+//                슬롯 1: 발사체별 인스턴스 데이터 (위치 + 반지름, 색상)
+//================================================================================================
+
+cbuffer ViewProjBuffer : register(b1)
+{
+    row_major float4x4 ViewMatrix;
+    row_major float4x4 ProjectionMatrix;
+    row_major float4x4 InverseViewMatrix;
+    row_major float4x4 InverseProjectionMatrix;
+}
+
+// b3: ColorBuffer - UUID만 사용 (발사체는 피킹 대상이 아니므로 0)
+cbuffer ColorBuffer : register(b3)
+{
+    float4 LerpColor;
+    uint UUID;
+}
+
+cbuffer CameraBuffer : register(b7)
+{
+    float3 CameraPosition;
+    float _pad_camera;
+}
+
+struct VS_INPUT
+{
+    float3 Position : POSITION;
+    float3 Normal : NORMAL0;
+
+    // 인스턴스 데이터
+    float4 PositionRadius : INSTANCE_POSRADIUS;
+    float4 Color : INSTANCE_COLOR;
+};
+
+struct PS_INPUT
+{
+    float4 Position : SV_POSITION;
+    float3 WorldPos : POSITION;
+    float3 Normal : NORMAL0;
+    float4 Color : COLOR0;
+};
+
+struct PS_OUTPUT
+{
+    float4 Color : SV_Target0;
+    uint UUID : SV_Target1;
+};
+
+PS_INPUT mainVS(VS_INPUT Input)
+{
+    PS_INPUT Out;
+
+    // 균등 스케일 + 이동만 있으므로 월드 행렬 없이 바로 변환
+    float3 WorldPos = Input.PositionRadius.xyz + Input.Position * Input.PositionRadius.w;
+    Out.WorldPos = WorldPos;
+    Out.Position = mul(mul(float4(WorldPos, 1.0f), ViewMatrix), ProjectionMatrix);
+    Out.Normal = Input.Normal;
+    Out.Color = Input.Color;
+    return Out;
+}
+
+PS_OUTPUT mainPS(PS_INPUT Input)
+{
+    PS_OUTPUT Output;
+
+    // 조명 계산 없이 자체 발광 + 림 (수만 개를 그려도 픽셀 비용이 일정)
+    float3 N = normalize(Input.Normal);
+    float3 V = normalize(CameraPosition - Input.WorldPos);
+    float Rim = pow(1.0f - saturate(dot(N, V)), 2.0f);
+
+    Output.Color = float4(Input.Color.rgb * (0.6f + 0.4f * saturate(dot(N, V))) + Rim * Input.Color.rgb, Input.Color.a);
+    Output.UUID = UUID;
+    return Output;
+}
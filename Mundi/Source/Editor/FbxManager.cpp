@@ -4,8 +4,10 @@
 #include "SkeletalMesh.h"
 #include "FbxImporter.h"
 #include "FbxImportOptions.h"
-#include "WindowsBinReader.h"
-#include "WindowsBinWriter.h"
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "VertexQuantization.h"
 #include "ObjectFactory.h"
 #include "GlobalConsole.h"
 #include "PathUtils.h"
@@ -26,36 +28,29 @@ FString FFbxManager::GetFbxCachePath(const FString& FbxPath)
 	return CachePath + ".bin";
 }
 
-bool FFbxManager::ShouldRegenerateCache(const FString& FbxPath, const FString& CachePath)
-{
-	namespace fs = std::filesystem;
+// FBX 임포트 결과가 달라지는 변경(FFbxImporter 변환/정점 병합, FMeshOptimizer, FMeshSimplifier 등)이 있으면 올린다
+// LOD 설정(editor.ini)은 해시로 섞는다
+static constexpr uint32 FbxImporterVersion = 3;
 
-	// 1. 캐시 파일 존재 여부 확인
-	if (!fs::exists(CachePath))
-	{
-		UE_LOG("FBX cache not found: %s", CachePath.c_str());
-		return true;
-	}
+bool FFbxManager::ComputeSourceHash(const FString& FbxPath, uint64& OutHash)
+{
+	// 수정 시각 대신 내용 해시로 판단 (복사/체크아웃으로 시각만 바뀐 경우 재임포트하지 않음)
+	return FMeshCache::ComputeSourceHash(FbxPath, {}, FbxImporterVersion ^ FMeshLODSettings::Get().GetHash() ^ FVertexQuantizer::GetCacheKey(), OutHash);
+}
 
-	// 2. 소스 FBX 존재 여부 확인
-	if (!fs::exists(FbxPath))
+void FFbxManager::RegisterOrBakeMeshBVH(FStaticMesh* Mesh, FMeshBVH& CachedBVH, uint64 SourceHash, bool bHasSource)
+{
+	if (!CachedBVH.IsEmpty())
 	{
-		UE_LOG("[error] Source FBX not found: %s", FbxPath.c_str());
-		return false;  // 소스가 없으면 재생성 불가
+		UResourceManager::GetInstance().RegisterMeshBVH(Mesh->GeometryHash, new FMeshBVH(std::move(CachedBVH)));
 	}
-
-	// 3. 타임스탬프 비교
-	auto FbxTime = fs::last_write_time(FbxPath);
-	auto CacheTime = fs::last_write_time(CachePath);
-
-	if (FbxTime > CacheTime)
+	else if (bHasSource)
 	{
-		UE_LOG("FBX source modified, cache is stale: %s", FbxPath.c_str());
-		return true;
+		UResourceManager::GetInstance().RequestMeshBVHBuild(Mesh, [Mesh, SourceHash](const FMeshBVH& BVH)
+			{
+				SaveStaticMeshToCache(Mesh->CacheFilePath, SourceHash, Mesh, &BVH);
+			});
 	}
-
-	// 캐시 유효
-	return false;
 }
 
 void FFbxManager::Clear()
@@ -182,10 +177,12 @@ FStaticMesh* FFbxManager::LoadFbxStaticMeshAsset(const FString& PathFileName)
 	}
 
 	FStaticMesh* Mesh = new FStaticMesh();
+	FMeshBVH CachedBVH;
 
-	// 캐시에서 로드 시도
-	bool bCacheValid = !ShouldRegenerateCache(PathFileName, CachePath);
-	if (bCacheValid && LoadStaticMeshFromCache(CachePath, Mesh))
+	// 캐시에서 로드 시도 (소스 FBX가 없으면 해시 검사 없이 캐시 사용)
+	uint64 SourceHash = 0;
+	const bool bHasSource = ComputeSourceHash(PathFileName, SourceHash);
+	if (LoadStaticMeshFromCache(CachePath, bHasSource ? &SourceHash : nullptr, Mesh, &CachedBVH))
 	{
 		UE_LOG("FFbxManager: Loaded Static Mesh FBX from cache: %s", PathFileName.c_str());
 
@@ -219,6 +216,8 @@ FStaticMesh* FFbxManager::LoadFbxStaticMeshAsset(const FString& PathFileName)
 		// 캐시 경로 설정 (UI 툴팁 표시용)
 		Mesh->CacheFilePath = CachePath;
 
+		RegisterOrBakeMeshBVH(Mesh, CachedBVH, SourceHash, bHasSource);
+
 		FbxStaticMeshCache[PathFileName] = Mesh;
 		return Mesh;
 	}
@@ -237,6 +236,14 @@ FStaticMesh* FFbxManager::LoadFbxStaticMeshAsset(const FString& PathFileName)
 		delete Mesh;
 		return nullptr;
 	}
+	FMeshOptimizer::OptimizeStaticMesh(*Mesh);
+	FMeshSimplifier::GenerateStaticMeshLODs(*Mesh);
+	// 압축 캐시면 정점을 양자화 격자로 맞춰 둔다 (캐시에서 복원한 메시, 피킹 BVH와 같은 값이 되도록 해시보다 먼저)
+	if (FVertexQuantizer::IsCacheQuantizationEnabled())
+	{
+		FVertexQuantizer::RoundTrip(Mesh->Vertices);
+	}
+	Mesh->GeometryHash = FMeshBVH::ComputeGeometryHash(Mesh->Vertices, Mesh->Indices);
 
 	// ═══════════════════════════════════════════════════════════
 	// Material 추출 (FBX Scene이 아직 열려있음)
@@ -271,7 +278,8 @@ FStaticMesh* FFbxManager::LoadFbxStaticMeshAsset(const FString& PathFileName)
 	Mesh->CacheFilePath = CachePath;
 
 	// 캐시에 저장
-	SaveStaticMeshToCache(CachePath, Mesh);
+	SaveStaticMeshToCache(CachePath, SourceHash, Mesh);
+	RegisterOrBakeMeshBVH(Mesh, CachedBVH, SourceHash, bHasSource);
 
 	// 메모리 캐시에 추가하고 반환
 	FbxStaticMeshCache[PathFileName] = Mesh;
@@ -300,9 +308,10 @@ FSkeletalMesh* FFbxManager::LoadFbxSkeletalMeshAsset(const FString& PathFileName
 
 	FSkeletalMesh* Mesh = new FSkeletalMesh();
 
-	// 캐시에서 로드 시도
-	bool bCacheValid = !ShouldRegenerateCache(PathFileName, CachePath);
-	if (bCacheValid && LoadSkeletalMeshFromCache(CachePath, Mesh))
+	// 캐시에서 로드 시도 (소스 FBX가 없으면 해시 검사 없이 캐시 사용)
+	uint64 SourceHash = 0;
+	const bool bHasSource = ComputeSourceHash(PathFileName, SourceHash);
+	if (LoadSkeletalMeshFromCache(CachePath, bHasSource ? &SourceHash : nullptr, Mesh))
 	{
 		UE_LOG("FFbxManager: Loaded Skeletal Mesh FBX from cache: %s", PathFileName.c_str());
 
@@ -374,111 +383,54 @@ FSkeletalMesh* FFbxManager::LoadFbxSkeletalMeshAsset(const FString& PathFileName
 	// 캐시 경로 설정 (UI 툴팁 표시용)
 	Mesh->CacheFilePath = CachePath;
 
-	// 캐시에 저장
-	SaveSkeletalMeshToCache(CachePath, Mesh);
+	// 캐시에 저장 (정점 캐시/오버드로/페치 순서 최적화, LOD 생성 후)
+	FMeshOptimizer::OptimizeSkeletalMesh(*Mesh);
+	FMeshSimplifier::GenerateSkeletalMeshLODs(*Mesh);
+	// Bone 인덱스가 255를 넘으면 false이고, 캐시도 전체 정밀도로 저장된다
+	if (FVertexQuantizer::IsCacheQuantizationEnabled())
+	{
+		FVertexQuantizer::RoundTrip(Mesh->Vertices);
+	}
+	SaveSkeletalMeshToCache(CachePath, SourceHash, Mesh);
 
 	// 메모리 캐시에 추가하고 반환
 	FbxSkeletalMeshCache[PathFileName] = Mesh;
 	return Mesh;
 }
 
-bool FFbxManager::LoadStaticMeshFromCache(const FString& CachePath, FStaticMesh* OutMesh)
+bool FFbxManager::LoadStaticMeshFromCache(const FString& CachePath, const uint64* ExpectedSourceHash, FStaticMesh* OutMesh, FMeshBVH* OutBVH)
 {
-	FWindowsBinReader Reader(CachePath);
-	if (!Reader.IsOpen())
-	{
-		UE_LOG("[error] FFbxManager: Failed to open cache file for reading: %s", CachePath.c_str());
-		return false;
-	}
-
-	// 매직 넘버 읽기 및 검증
-	uint32 MagicNumber, Version;
-	uint8 TypeFlag;
-	Reader << MagicNumber;
-	Reader << Version;
-	Reader << TypeFlag;
-
-	if (MagicNumber != 0x46425843)
-	{
-		UE_LOG("[error] FFbxManager: Invalid FBX cache file (bad magic number): %s", CachePath.c_str());
-		return false;
-	}
-
-	if (Version != 1)
-	{
-		UE_LOG("[error] FFbxManager: Unsupported FBX cache version %d: %s", Version, CachePath.c_str());
-		return false;
-	}
-
-	if (TypeFlag != 0)
-	{
-		UE_LOG("[error] FFbxManager: Invalid cache type flag (expected StaticMesh=0, got %d): %s", TypeFlag, CachePath.c_str());
-		return false;
-	}
-
-	// FStaticMesh의 operator<< 사용하여 나머지 데이터 읽기
-	Reader << *OutMesh;
-	Reader.Close();
-
-	return true;
+	// 헤더(매직/버전/타입/원본 해시)와 섹션 범위는 FMeshCache가 검사한다
+	return FMeshCache::LoadStaticMesh(CachePath, ExpectedSourceHash, *OutMesh, nullptr, OutBVH);
 }
 
-bool FFbxManager::SaveStaticMeshToCache(const FString& CachePath, const FStaticMesh* Mesh)
+bool FFbxManager::SaveStaticMeshToCache(const FString& CachePath, uint64 SourceHash, const FStaticMesh* Mesh, const FMeshBVH* BVH)
 {
-	FWindowsBinWriter Writer(CachePath);
-	if (!Writer.IsOpen())
+	if (!FMeshCache::SaveStaticMesh(CachePath, SourceHash, *Mesh, nullptr, BVH))
 	{
-		UE_LOG("[error] FFbxManager: Failed to open cache file for writing: %s", CachePath.c_str());
+		UE_LOG("[error] FFbxManager: Failed to write cache file: %s", CachePath.c_str());
 		return false;
 	}
 
-	// 매직 넘버와 버전 쓰기
-	uint32 MagicNumber = 0x46425843;  // "FBXC" (hex)
-	uint32 Version = 1;
-	uint8 TypeFlag = 0;  // 0 = StaticMesh, 1 = SkeletalMesh
-	Writer << MagicNumber;
-	Writer << Version;
-	Writer << TypeFlag;
-
-	// FStaticMesh의 operator<< 사용하여 나머지 데이터 쓰기
-	Writer << const_cast<FStaticMesh&>(*Mesh);
-	Writer.Close();
-
 	UE_LOG("FFbxManager: Saved Static Mesh to cache: %s (%d vertices, %d indices)",
 		CachePath.c_str(), static_cast<uint32>(Mesh->Vertices.size()), static_cast<uint32>(Mesh->Indices.size()));
 
 	return true;
 }
 
-bool FFbxManager::LoadSkeletalMeshFromCache(const FString& CachePath, FSkeletalMesh* OutMesh)
+bool FFbxManager::LoadSkeletalMeshFromCache(const FString& CachePath, const uint64* ExpectedSourceHash, FSkeletalMesh* OutMesh)
 {
-	FWindowsBinReader Reader(CachePath);
-	if (!Reader.IsOpen())
-	{
-		UE_LOG("[error] FFbxManager: Failed to open cache file for reading: %s", CachePath.c_str());
-		return false;
-	}
-
-	// FSkeletalMesh의 operator>> 사용하여 역직렬화
-	Reader >> *OutMesh;
-	Reader.Close();
-
-	return true;
+	return FMeshCache::LoadSkeletalMesh(CachePath, ExpectedSourceHash, *OutMesh);
 }
 
-bool FFbxManager::SaveSkeletalMeshToCache(const FString& CachePath, const FSkeletalMesh* Mesh)
+bool FFbxManager::SaveSkeletalMeshToCache(const FString& CachePath, uint64 SourceHash, const FSkeletalMesh* Mesh)
 {
-	FWindowsBinWriter Writer(CachePath);
-	if (!Writer.IsOpen())
+	if (!FMeshCache::SaveSkeletalMesh(CachePath, SourceHash, *Mesh))
 	{
-		UE_LOG("[error] FFbxManager: Failed to open cache file for writing: %s", CachePath.c_str());
+		UE_LOG("[error] FFbxManager: Failed to write cache file: %s", CachePath.c_str());
 		return false;
 	}
 
-	// FSkeletalMesh의 operator<< 사용하여 직렬화
-	Writer << *Mesh;
-	Writer.Close();
-
 	UE_LOG("FFbxManager: Saved Skeletal Mesh to cache: %s (%zu vertices, %zu indices)",
 		CachePath.c_str(), Mesh->Vertices.size(), Mesh->Indices.size());
 
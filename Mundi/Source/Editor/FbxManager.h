@@ -8,6 +8,7 @@ class USkeletalMesh;
 class UStaticMesh;
 struct FStaticMesh;
 struct FSkeletalMesh;
+class FMeshBVH;
 
 /**
  * FBX 메시 로딩 및 캐싱 관리 클래스 (Static Mesh와 Skeletal Mesh 모두 지원)
@@ -91,12 +92,12 @@ private:
 	static FString GetFbxCachePath(const FString& FbxPath);
 
 	/**
-	 * 캐시 재생성 필요 여부 확인
+	 * 캐시 유효성 검사용 원본 해시 (FBX 내용 + 임포터 버전)
 	 * @param FbxPath - 소스 FBX 경로
-	 * @param CachePath - 바이너리 캐시 경로
-	 * @return 캐시가 없거나 오래된 경우 true
+	 * @param OutHash - 출력 해시
+	 * @return 소스 FBX를 읽을 수 없으면 false
 	 */
-	static bool ShouldRegenerateCache(const FString& FbxPath, const FString& CachePath);
+	static bool ComputeSourceHash(const FString& FbxPath, uint64& OutHash);
 
 	// ═══════════════════════════════════════════════════════════
 	// Static Mesh 캐시 I/O
@@ -105,18 +106,32 @@ private:
 	/**
 	 * 바이너리 캐시에서 Static Mesh 로드
 	 * @param CachePath - .fbx.bin 파일 경로
+	 * @param ExpectedSourceHash - 캐시 헤더와 비교할 원본 해시 (nullptr이면 검사 생략)
 	 * @param OutMesh - 출력 Static Mesh 데이터
+	 * @param OutBVH - 캐시에 구워진 BVH (없거나 잘못됐으면 빈 채로 둠)
 	 * @return 성공적으로 로드된 경우 true
 	 */
-	static bool LoadStaticMeshFromCache(const FString& CachePath, FStaticMesh* OutMesh);
+	static bool LoadStaticMeshFromCache(const FString& CachePath, const uint64* ExpectedSourceHash, FStaticMesh* OutMesh, FMeshBVH* OutBVH = nullptr);
 
 	/**
 	 * Static Mesh를 바이너리 캐시로 저장
 	 * @param CachePath - .fbx.bin 파일 경로
+	 * @param SourceHash - 캐시 헤더에 기록할 원본 해시
 	 * @param Mesh - 저장할 Static Mesh 데이터
+	 * @param BVH - 함께 구울 BVH (nullptr이면 생략, 백그라운드 빌드가 끝나면 다시 저장됨)
 	 * @return 성공적으로 저장된 경우 true
 	 */
-	static bool SaveStaticMeshToCache(const FString& CachePath, const FStaticMesh* Mesh);
+	static bool SaveStaticMeshToCache(const FString& CachePath, uint64 SourceHash, const FStaticMesh* Mesh, const FMeshBVH* BVH = nullptr);
+
+	/**
+	 * 피킹용 BVH 등록: 캐시에 구워져 있으면 ResourceManager에 넘기고,
+	 * 없으면 백그라운드에서 빌드해 캐시 파일에 추가 (소스 FBX가 있을 때만)
+	 * @param Mesh - 로드/임포트된 Static Mesh (CacheFilePath, GeometryHash 설정 완료)
+	 * @param CachedBVH - LoadStaticMeshFromCache가 채운 BVH (비어 있으면 빌드 요청)
+	 * @param SourceHash - 다시 저장할 때 쓸 원본 해시
+	 * @param bHasSource - 소스 FBX 해시를 구했는지 여부
+	 */
+	static void RegisterOrBakeMeshBVH(FStaticMesh* Mesh, FMeshBVH& CachedBVH, uint64 SourceHash, bool bHasSource);
 
 	// ═══════════════════════════════════════════════════════════
 	// Skeletal Mesh 캐시 I/O
@@ -125,18 +140,20 @@ private:
 	/**
 	 * 바이너리 캐시에서 Skeletal Mesh 로드
 	 * @param CachePath - .fbx.bin 파일 경로
+	 * @param ExpectedSourceHash - 캐시 헤더와 비교할 원본 해시 (nullptr이면 검사 생략)
 	 * @param OutMesh - 출력 Skeletal Mesh 데이터
 	 * @return 성공적으로 로드된 경우 true
 	 */
-	static bool LoadSkeletalMeshFromCache(const FString& CachePath, FSkeletalMesh* OutMesh);
+	static bool LoadSkeletalMeshFromCache(const FString& CachePath, const uint64* ExpectedSourceHash, FSkeletalMesh* OutMesh);
 
 	/**
 	 * Skeletal Mesh를 바이너리 캐시로 저장
 	 * @param CachePath - .fbx.bin 파일 경로
+	 * @param SourceHash - 캐시 헤더에 기록할 원본 해시
 	 * @param Mesh - 저장할 Skeletal Mesh 데이터
 	 * @return 성공적으로 저장된 경우 true
 	 */
-	static bool SaveSkeletalMeshToCache(const FString& CachePath, const FSkeletalMesh* Mesh);
+	static bool SaveSkeletalMeshToCache(const FString& CachePath, uint64 SourceHash, const FSkeletalMesh* Mesh);
 
 	// ═══════════════════════════════════════════════════════════
 	// DDS 텍스처 변환 (FBX Import 직후)
@@ -6,7 +6,7 @@ public:
     DECLARE_CLASS(UGizmoArrowComponent, UStaticMeshComponent)
     UGizmoArrowComponent();
     
-    void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+    void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 protected:
     ~UGizmoArrowComponent() override;
@@ -1,12 +1,17 @@
 ﻿#include "pch.h"
 #include "ObjManager.h"
+#include "ObjParser.h"
 #include "PathUtils.h"
 
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
 #include "Enums.h"
-#include "WindowsBinReader.h"
-#include "WindowsBinWriter.h"
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "VertexQuantization.h"
+#include "MappedFile.h"
+#include "PlatformTime.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -123,6 +128,7 @@ static FString FindMtlFilePath(const FString& InObjPath)
 /**
  * @brief .obj 파일을 빠르게 스캔하여 참조된 모든 .mtl 파일의 전체 경로 목록을 반환합니다.
  * 이 함수는 전체 3D 데이터를 파싱하지 않고 'mtllib' 지시어만 효율적으로 찾습니다.
+ * (캐시 검사마다 호출되므로 파일을 매핑해서 줄 단위로 훑고, 'mtllib' 줄만 문자열로 만듭니다.)
  * @param ObjPath 원본 .obj 파일의 경로입니다.
  * @param OutMtlFilePaths[out] 발견된 .mtl 파일들의 전체 경로가 저장될 배열입니다.
  * @return 스캔에 성공하면 true, 파일 열기에 실패하면 false를 반환합니다.
@@ -130,27 +136,39 @@ static FString FindMtlFilePath(const FString& InObjPath)
 bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths)
 {
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(ObjPath);
-	std::ifstream InFile(WPath);
-	if (!InFile.is_open())
+	FMappedFile File;
+	if (!File.Open(UTF8ToWide(ObjPath)))
 	{
 		UE_LOG("Failed to open .obj file for dependency scan: %s", ObjPath.c_str());
 		return false;
 	}
 
 	fs::path BaseDir = fs::path(ObjPath).parent_path();
-	FString Line;
+	const char* Cursor = reinterpret_cast<const char*>(File.GetData());
+	const char* const End = Cursor + File.GetSize();
 
-	while (std::getline(InFile, Line))
+	while (Cursor < End)
 	{
+		const char* LineEnd = static_cast<const char*>(std::memchr(Cursor, '\n', End - Cursor));
+		LineEnd = LineEnd ? LineEnd : End;
+
 		// 라인 앞뒤의 공백을 제거하여 안정성을 높입니다.
-		Line.erase(0, Line.find_first_not_of(" \t\r\n"));
-		Line.erase(Line.find_last_not_of(" \t\r\n") + 1);
+		const char* LineBegin = Cursor;
+		while (LineBegin < LineEnd && (*LineBegin == ' ' || *LineBegin == '\t'))
+		{
+			++LineBegin;
+		}
+		const char* LineLast = LineEnd;
+		while (LineLast > LineBegin && (LineLast[-1] == ' ' || LineLast[-1] == '\t' || LineLast[-1] == '\r'))
+		{
+			--LineLast;
+		}
+		Cursor = LineEnd + 1;
 
-		if (Line.rfind("mtllib ", 0) == 0) // "mtllib "으로 시작하는지 확인
+		if (LineLast - LineBegin > 7 && std::memcmp(LineBegin, "mtllib ", 7) == 0) // "mtllib "으로 시작하는지 확인
 		{
 			// "mtllib " 다음의 모든 문자열을 경로로 추출합니다.
-			FString MtlFileName = Line.substr(7);
+			FString MtlFileName(LineBegin + 7, LineLast);
 			if (!MtlFileName.empty())
 			{
 				fs::path FullPath = fs::weakly_canonical(BaseDir / MtlFileName);
@@ -163,57 +181,34 @@ bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths
 	return true;
 }
 
+// .obj 임포트 결과가 달라지는 변경(FObjParser, ConvertToStaticMesh, .mtl 파싱, FMeshOptimizer, FMeshSimplifier)이 있으면 올립니다.
+// LOD 설정(editor.ini)은 해시로 섞으므로 값만 바뀐 경우에는 올리지 않아도 됩니다.
+constexpr uint32 ObjImporterVersion = 3;
+
 /**
- * @brief 캐시 파일이 원본(.obj) 및 모든 의존성(.mtl) 파일보다 최신인지 검사합니다.
+ * @brief 캐시 유효성 검사용 원본 해시를 구합니다. (.obj와 참조하는 모든 .mtl의 내용 + 임포터 버전)
+ * 수정 시각 대신 내용을 보므로 복사/체크아웃으로 시각만 바뀐 경우에는 캐시를 그대로 씁니다.
  * @param ObjPath 원본 .obj 파일의 경로입니다.
- * @param BinPath 메쉬 데이터 캐시(.obj.bin) 파일의 경로입니다.
- * @param MatBinPath 머티리얼 데이터 캐시(.mtl.bin) 파일의 경로입니다.
- * @return 캐시를 다시 생성해야 하면 true, 캐시가 유효하면 false를 반환합니다.
+ * @param OutHash[out] 원본 해시입니다.
+ * @return .obj 파일을 읽을 수 없으면 false를 반환합니다.
  */
-bool ShouldRegenerateCache(const FString& ObjPath, const FString& BinPath, const FString& MatBinPath)
+bool ComputeObjSourceHash(const FString& ObjPath, uint64& OutHash)
 {
-	// 캐시 파일 중 하나라도 존재하지 않으면 무조건 재생성해야 합니다.
-	if (!fs::exists(BinPath) || !fs::exists(MatBinPath))
-	{
-		return true;
-	}
-
+	TArray<FString> MtlDependencies;
 	try
 	{
-		auto BinTimestamp = fs::last_write_time(BinPath);
-
-		// 1. 원본 .obj 파일의 수정 시간을 캐시 파일과 비교합니다.
-		if (fs::last_write_time(ObjPath) > BinTimestamp)
-		{
-			return true;
-		}
-
-		// 2. .obj 파일을 빠르게 스캔하여 의존하는 .mtl 파일 목록을 가져옵니다.
-		TArray<FString> MtlDependencies;
 		if (!GetMtlDependencies(ObjPath, MtlDependencies))
 		{
-			return true; // .obj 파일을 읽을 수 없으면 안전을 위해 캐시를 재생성합니다.
-		}
-
-		// 3. 각 .mtl 파일의 수정 시간을 캐시 파일과 비교합니다.
-		for (const FString& MtlPath : MtlDependencies)
-		{
-			// .mtl 파일이 존재하지 않거나 캐시보다 최신 버전이면 재생성합니다.
-			if (!fs::exists(MtlPath) || fs::last_write_time(MtlPath) > BinTimestamp)
-			{
-				return true;
-			}
+			return false;
 		}
 	}
 	catch (const fs::filesystem_error& e)
 	{
 		// 파일 시스템 오류(예: 접근 권한 없음) 발생 시 안전하게 캐시를 재생성합니다.
 		UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-		return true;
+		return false;
 	}
-
-	// 모든 검사를 통과하면 캐시는 유효합니다.
-	return false;
+	return FMeshCache::ComputeSourceHash(ObjPath, MtlDependencies, ObjImporterVersion ^ FMeshLODSettings::Get().GetHash() ^ FVertexQuantizer::GetCacheKey(), OutHash);
 }
 
 void FObjManager::Preload()
@@ -272,6 +267,15 @@ void FObjManager::Clear()
 	ObjStaticMeshMap.Empty();
 }
 
+FStaticMesh* FObjManager::FindObjStaticMeshAsset(const FString& PathFileName)
+{
+	if (FStaticMesh** It = ObjStaticMeshMap.Find(NormalizePath(PathFileName)))
+	{
+		return *It;
+	}
+	return nullptr;
+}
+
 // PathFileName의 bin을 로드 (없으면 생성) 해서 메모리에 캐싱 후 반환
 FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 {
@@ -283,6 +287,16 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return *It;
 	}
 
+	FObjStaticMeshImport Import;
+	if (!ImportObjStaticMeshData(NormalizedPathStr, Import))
+	{
+		return nullptr;
+	}
+	return RegisterObjStaticMeshData(NormalizedPathStr, Import);
+}
+
+bool FObjManager::ImportObjStaticMeshData(const FString& NormalizedPathStr, FObjStaticMeshImport& OutImport)
+{
 	std::filesystem::path Path(NormalizedPathStr);
 
 	// 2. 파일 경로 설정
@@ -293,15 +307,16 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	if (Extension != ".obj")
 	{
 		UE_LOG("this file is not obj!: %s", NormalizedPathStr.c_str());
-		return nullptr;
+		return false;
 	}
 
+	TArray<FMaterialInfo>& MaterialInfos = OutImport.MaterialInfos;
+
 #ifdef USE_OBJ_CACHE
-	// 2-1. 캐시 파일 경로 설정
+	// 2-1. 캐시 파일 경로 설정 (머티리얼도 같은 캐시 파일의 섹션으로 저장)
 	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPathStr);
 
 	const FString BinPathFileName = CachePathStr + ".bin";
-	const FString MatBinPathFileName = CachePathStr + ".mat.bin";
 
 	// 캐시를 저장할 디렉토리가 없으면 생성
 	fs::path CacheFileDirPath(BinPathFileName);
@@ -312,61 +327,22 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 
-	// 캐시가 오래되었는지 먼저 확인
-	bool bShouldRegenerate = ShouldRegenerateCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName);
-
-	if (!bShouldRegenerate)
+	// 원본(.obj + .mtl) 내용 해시가 캐시 헤더의 해시와 같을 때만 캐시를 씁니다.
+	uint64& SourceHash = OutImport.SourceHash;
+	const uint64 CacheStartCycles = FPlatformTime::Cycles64();
+	if (ComputeObjSourceHash(NormalizedPathStr, SourceHash))
 	{
-		UE_LOG("Attempting to load '%s' from cache.", NormalizedPathStr.c_str());
-		try
+		bLoadedSuccessfully = FMeshCache::LoadStaticMesh(BinPathFileName, &SourceHash, *NewFStaticMesh, &MaterialInfos, &OutImport.CachedBVH);
+		if (bLoadedSuccessfully)
 		{
-			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
-			{
-				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
-			Reader << *NewFStaticMesh;
-			Reader.Close();
-
-			// 캐시에서 Material 데이터 로드
-			FWindowsBinReader MatReader(MatBinPathFileName);
-			if (!MatReader.IsOpen())
-			{
-				throw std::runtime_error("Failed to open material bin file for reading.");
-			}
-			Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
-			MatReader.Close();
-
-			NewFStaticMesh->CacheFilePath = BinPathFileName;
-
-			// 모든 로드가 성공적으로 완료됨
-			bLoadedSuccessfully = true;
-			UE_LOG("Successfully loaded '%s' from cache.", NormalizedPathStr.c_str());
-		}
-		catch (const std::exception& e)
-		{
-			UE_LOG("Error loading from cache: %s. Cache might be corrupt or incompatible.", e.what());
-			UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPathStr.c_str());
-
-			// 실패 시 생성 중이던 객체 메모리 정리
-			delete NewFStaticMesh;
-			NewFStaticMesh = nullptr; // 포인터를 nullptr로 설정하여 이중 삭제 방지
-
-			// 손상된 캐시 파일 삭제
-			fs::remove(BinPathFileName);
-			fs::remove(MatBinPathFileName);
-
-			bLoadedSuccessfully = false;
+			UE_LOG("Loaded '%s' from cache in %.2f ms.", NormalizedPathStr.c_str(),
+				FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CacheStartCycles));
 		}
 	}
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 #endif // USE_OBJ_CACHE
 
@@ -398,59 +374,52 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	// 캐시 로드에 실패했거나, 처음부터 재생성이 필요했던 경우
 	if (!bLoadedSuccessfully)
 	{
-		if (NewFStaticMesh == nullptr) { NewFStaticMesh = new FStaticMesh(); }
 		UE_LOG("Regenerating cache for '%s'...", NormalizedPathStr.c_str());
 
 		FObjInfo RawObjInfo;
 		if (!FObjImporter::LoadObjModel(NormalizedPathStr, &RawObjInfo, MaterialInfos, true))
 		{
 			delete NewFStaticMesh;
-			return nullptr;
+			return false;
 		}
 
 		FObjImporter::ConvertToStaticMesh(RawObjInfo, MaterialInfos, NewFStaticMesh);
+		// 인덱스/정점 순서가 바뀌므로 지오메트리 해시(BVH 캐시 키)보다 먼저
+		FMeshOptimizer::OptimizeStaticMesh(*NewFStaticMesh);
+		// LOD는 최적화된 LOD0 정점 버퍼를 그대로 참조하므로 정점 순서가 확정된 뒤에
+		FMeshSimplifier::GenerateStaticMeshLODs(*NewFStaticMesh);
+		// 압축 캐시면 정점을 양자화 격자로 맞춰 둔다 (캐시에서 복원한 메시, 피킹 BVH와 같은 값이 되도록 해시보다 먼저)
+		if (FVertexQuantizer::IsCacheQuantizationEnabled())
+		{
+			FVertexQuantizer::RoundTrip(NewFStaticMesh->Vertices);
+		}
+		NewFStaticMesh->GeometryHash = FMeshBVH::ComputeGeometryHash(NewFStaticMesh->Vertices, NewFStaticMesh->Indices);
 
 		// 캐시 저장 *직전에* 기본 머티리얼 로직을 호출합니다.
 		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
 
 #ifdef USE_OBJ_CACHE
 		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *NewFStaticMesh;
-		Writer.Close();
-
-		FWindowsBinWriter MatWriter(MatBinPathFileName);
-		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-		MatWriter.Close();
-
-		UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
+		if (FMeshCache::SaveStaticMesh(BinPathFileName, SourceHash, *NewFStaticMesh, &MaterialInfos))
+		{
+			NewFStaticMesh->CacheFilePath = BinPathFileName;
+			UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
+		}
 #endif // USE_OBJ_CACHE
 	}
 	else
 	{
-		// 캐시 로드에 성공한 경우(bLoadedSuccessfully == true)
-		// 구버전 캐시(기본 머티리얼이 없는)일 수 있으므로, 동일한 검사를 수행합니다.
-		if (EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos))
-		{
+		// 캐시는 항상 기본 머티리얼을 넣은 뒤에 저장되지만, 머티리얼 섹션이 비어 있어도 렌더링이 되도록 한 번 더 확인합니다.
+		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
+	}
+
 #ifdef USE_OBJ_CACHE
-			// 변경된 경우, 캐시를 갱신합니다.
-			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
-			try
-			{
-				FWindowsBinWriter Writer(BinPathFileName);
-				Writer << *NewFStaticMesh;
-				Writer.Close();
-				FWindowsBinWriter MatWriter(MatBinPathFileName);
-				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-				MatWriter.Close();
-			}
-			catch (const std::exception& e)
-			{
-				UE_LOG("Failed to update cache for default material: %s", e.what());
-			}
-#endif // USE_OBJ_CACHE
-		}
+	// BVH를 덧붙여 캐시를 다시 저장할 때는 텍스처 경로를 풀기 전의 머티리얼 정보를 넘겨야 처음 저장한 것과 같습니다.
+	if (OutImport.CachedBVH.IsEmpty())
+	{
+		OutImport.CachedMaterialInfos = MaterialInfos;
 	}
+#endif // USE_OBJ_CACHE
 
 	// 4. 머티리얼 및 텍스처 경로 처리 (공통 로직)
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 경로 처리
@@ -485,6 +454,47 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			ResolveAssetRelativePath(MaterialInfo.EmissiveTextureFileName, ObjBaseDir);
 	}
 
+	OutImport.Mesh = NewFStaticMesh;
+	return true;
+}
+
+FStaticMesh* FObjManager::RegisterObjStaticMeshData(const FString& NormalizedPathStr, FObjStaticMeshImport& InImport)
+{
+	FStaticMesh* NewFStaticMesh = InImport.Mesh;
+	InImport.Mesh = nullptr;
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+
+	// 워커에서 임포트하는 동안 같은 경로가 동기 로드됐으면 먼저 등록된 쪽을 쓴다
+	if (FStaticMesh** It = ObjStaticMeshMap.Find(NormalizedPathStr))
+	{
+		delete NewFStaticMesh;
+		return *It;
+	}
+
+#ifdef USE_OBJ_CACHE
+	// 피킹용 BVH: 캐시에 구워져 있으면 그대로 등록하고, 없으면 백그라운드에서 빌드해 캐시 파일에 추가합니다.
+	if (!InImport.CachedBVH.IsEmpty())
+	{
+		UResourceManager::GetInstance().RegisterMeshBVH(NewFStaticMesh->GeometryHash, new FMeshBVH(std::move(InImport.CachedBVH)));
+	}
+	else if (!NewFStaticMesh->CacheFilePath.empty())
+	{
+		UResourceManager::GetInstance().RequestMeshBVHBuild(NewFStaticMesh,
+			[NewFStaticMesh, SourceHash = InImport.SourceHash, CachedMaterialInfos = InImport.CachedMaterialInfos](const FMeshBVH& BVH)
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				if (FMeshCache::SaveStaticMesh(NewFStaticMesh->CacheFilePath, SourceHash, *NewFStaticMesh, &CachedMaterialInfos, &BVH))
+				{
+					UE_LOG("Wrote BVH (%d nodes) into '%s' in %.2f ms.", BVH.GetNodes().Num(),
+						NewFStaticMesh->CacheFilePath.c_str(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+				}
+			});
+	}
+#endif // USE_OBJ_CACHE
+
 	// 루프가 시작되기 전에 기본 UberLit 셰이더 포인터를 한 번만 가져옵니다.
 	UShader* DefaultUberlitShader = nullptr;
 	UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
@@ -498,7 +508,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		UE_LOG("CRITICAL: Default Uberlit Shader not found. OBJ materials may fail.");
 	}
 
-	for (const FMaterialInfo& InMaterialInfo : MaterialInfos)
+	for (const FMaterialInfo& InMaterialInfo : InImport.MaterialInfos)
 	{
 		if (!UResourceManager::GetInstance().Get<UMaterial>(InMaterialInfo.MaterialName))
 		{
@@ -548,26 +558,12 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 // obj File to FObjInfo, FMaterialParameters
 bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded)
 {
-	uint32 subsetCount = 0;
 	FString MtlFileName;
 
-	bool bHasTexcoord = false;
-	bool bHasNormal = false;
-	FString MaterialNameTemp;
-
-	FString Face;
-	uint32 VIndex = 0;
-	uint32 MeshTriangles = 0;
-
-	size_t pos = InFileName.find_last_of("/\\");
-	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
-
 	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
 	// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(InFileName);
-	std::ifstream FileIn(WPath);
-	if (!FileIn)
+	FObjParseStats ParseStats;
+	if (!FObjParser::Parse(InFileName, *OutObjInfo, MtlFileName, bIsRightHanded, &ParseStats))
 	{
 		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
 		return false;
@@ -575,136 +571,19 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
 
-	FString line;
-	while (std::getline(FileIn, line))
+	UE_LOG("[ObjImporter::LoadObjModel] Parsed '%s': %.2f MB in %.2f ms (%d chunk(s))",
+		InFileName.c_str(), ParseStats.FileBytes / (1024.0 * 1024.0), ParseStats.Milliseconds, ParseStats.NumChunks);
+	if (ParseStats.NumUnknownLines > 0)
 	{
-		if (line.empty()) continue;
-
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-
-		if (line[0] == '#')
-			continue;
-
-		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
-		{
-			std::stringstream wss(line.substr(2));
-			float vx, vy, vz;
-			wss >> vx >> vy >> vz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
-			}
-			else
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
-			}
-		}
-		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
-		{
-			std::stringstream wss(line.substr(3));
-			float u, v;
-			wss >> u >> v;
-			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
-			v = 1.0f - v;
-			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
-			bHasTexcoord = true;
-		}
-		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
-		{
-			std::stringstream wss(line.substr(3));
-			float nx, ny, nz;
-			wss >> nx >> ny >> nz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
-			}
-			else
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
-			}
-			bHasNormal = true;
-		}
-		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
-		{
-			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
-		}
-		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
-		{
-			Face = line.substr(2);
-			if (Face.length() <= 0)
-			{
-				continue;
-			}
-
-			// Parse face line and trim at '#' or newline
-			std::stringstream wss(Face);
-			FString VertexDef;
-
-			TArray<FFaceVertex> LineFaceVertices;
-			while (wss >> VertexDef)
-			{
-				// '#'을 만나면 주석 처리 (이후 데이터 무시)
-				if (VertexDef[0] == '#')
-				{
-					break;
-				}
-
-				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
-				LineFaceVertices.push_back(FaceVertex);
-			}
-
-			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
-			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
-			{
-				if (bIsRightHanded)
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-				}
-				else
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-				}
-				VIndex += 3;
-				++MeshTriangles;
-			}
-		}
-		else if (line.rfind("mtllib ", 0) == 0)
-		{
-			MtlFileName = objDir + line.substr(7);
-		}
-		else if (line.rfind("usemtl ", 0) == 0)
-		{
-			MaterialNameTemp = line.substr(7);
-			OutObjInfo->MaterialNames.push_back(MaterialNameTemp);
-			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-			subsetCount++;
-		}
-		else
-		{
-			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'", InFileName.c_str(), line.c_str());
-		}
+		UE_LOG("While parsing the filename %s, %d line(s) with unknown symbols were skipped (first: \'%s\')",
+			InFileName.c_str(), ParseStats.NumUnknownLines, ParseStats.FirstUnknownLine.c_str());
 	}
 
+	const uint32 VIndex = static_cast<uint32>(OutObjInfo->PositionIndices.size());
+	uint32 subsetCount = static_cast<uint32>(OutObjInfo->MaterialNames.size());
+	const bool bHasTexcoord = !OutObjInfo->TexCoords.empty();
+	const bool bHasNormal = !OutObjInfo->Normals.empty();
+
 	if (subsetCount == 0)
 	{
 		OutObjInfo->GroupIndexStartArray.push_back(0);
@@ -727,7 +606,8 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 		OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
 	}
 
-	FileIn.close();
+	std::ifstream FileIn;
+	FString line;
 
 	// Material 파싱 시작
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
@@ -770,7 +650,9 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 		if (line.rfind("newmtl ", 0) == 0)
 		{
 			FMaterialInfo TempMatInfo;
+			// usemtl 이름과 맞추기 위해 줄 끝 공백(CRLF의 \r 포함)은 뗀다
 			TempMatInfo.MaterialName = line.substr(7);
+			TempMatInfo.MaterialName.erase(TempMatInfo.MaterialName.find_last_not_of(" \t\r") + 1);
 			OutMaterialInfos.push_back(TempMatInfo);
 			++MatCount;
 			UE_LOG("[ObjImporter::LoadObjModel] Found material: %s", TempMatInfo.MaterialName.c_str());
@@ -894,15 +776,17 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		BiTangentForVertex[Index + 2] += BiTangent;
 	}
 
-	std::unordered_map<VertexKey, uint32, VertexKeyHash> VertexMap;
+	TFlatMap<VertexKey, uint32, VertexKeyHash> VertexMap;
+	VertexMap.Reserve(static_cast<int32>(InObjInfo.Positions.size()));
+	OutStaticMesh->Indices.reserve(NumDuplicatedVertex);
+	OutStaticMesh->Vertices.reserve(InObjInfo.Positions.size());
 
 	for (uint32 CurIndex = 0; CurIndex < NumDuplicatedVertex; ++CurIndex)
 	{
 		VertexKey Key{ InObjInfo.PositionIndices[CurIndex], InObjInfo.TexCoordIndices[CurIndex], InObjInfo.NormalIndices[CurIndex] };
-		auto It = VertexMap.find(Key);
-		if (It != VertexMap.end())
+		if (const uint32* ExistingIndex = VertexMap.Find(Key))
 		{
-			OutStaticMesh->Indices.push_back(It->second);
+			OutStaticMesh->Indices.push_back(*ExistingIndex);
 		}
 		else
 		{
@@ -925,7 +809,7 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 			OutStaticMesh->Vertices.push_back(NormalVertex);
 			uint32 NewIndex = static_cast<uint32>(OutStaticMesh->Vertices.size() - 1);
 			OutStaticMesh->Indices.push_back(NewIndex);
-			VertexMap[Key] = NewIndex;
+			VertexMap.Add(Key, NewIndex);
 		}
 	}
 
@@ -963,6 +847,223 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 	}
 }
 
+bool FObjImporter::LoadObjGeometryLegacy(const FString& InFileName, FObjInfo* const OutObjInfo, FString& OutMtlFileName, bool bIsRightHanded)
+{
+	FString Face;
+	uint32 VIndex = 0;
+
+	size_t pos = InFileName.find_last_of("/\\");
+	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
+
+	FWideString WPath = UTF8ToWide(InFileName);
+	std::ifstream FileIn(WPath);
+	if (!FileIn)
+	{
+		return false;
+	}
+
+	FString line;
+	while (std::getline(FileIn, line))
+	{
+		if (line.empty()) continue;
+
+		line.erase(0, line.find_first_not_of(" \t\n\r"));
+
+		if (line[0] == '#')
+			continue;
+
+		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
+		{
+			std::stringstream wss(line.substr(2));
+			float vx, vy, vz;
+			wss >> vx >> vy >> vz;
+			if (bIsRightHanded)
+			{
+				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
+			}
+			else
+			{
+				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
+			}
+		}
+		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
+		{
+			std::stringstream wss(line.substr(3));
+			float u, v;
+			wss >> u >> v;
+			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
+			v = 1.0f - v;
+			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
+		}
+		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
+		{
+			std::stringstream wss(line.substr(3));
+			float nx, ny, nz;
+			wss >> nx >> ny >> nz;
+			if (bIsRightHanded)
+			{
+				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
+			}
+			else
+			{
+				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
+			}
+		}
+		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
+		{
+			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+		}
+		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+		{
+			Face = line.substr(2);
+			if (Face.length() <= 0)
+			{
+				continue;
+			}
+
+			// Parse face line and trim at '#' or newline
+			std::stringstream wss(Face);
+			FString VertexDef;
+
+			TArray<FFaceVertex> LineFaceVertices;
+			while (wss >> VertexDef)
+			{
+				// '#'을 만나면 주석 처리 (이후 데이터 무시)
+				if (VertexDef[0] == '#')
+				{
+					break;
+				}
+
+				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
+				LineFaceVertices.push_back(FaceVertex);
+			}
+
+			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
+			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
+			{
+				if (bIsRightHanded)
+				{
+					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
+					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
+					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
+
+					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
+					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
+					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
+
+					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
+					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
+					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
+				}
+				else
+				{
+					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
+					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
+					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
+
+					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
+					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
+					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
+
+					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
+					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
+					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
+				}
+				VIndex += 3;
+			}
+		}
+		else if (line.rfind("mtllib ", 0) == 0)
+		{
+			OutMtlFileName = objDir + line.substr(7);
+		}
+		else if (line.rfind("usemtl ", 0) == 0)
+		{
+			OutObjInfo->MaterialNames.push_back(line.substr(7));
+			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
+		}
+	}
+
+	return true;
+}
+
+void FObjImporter::RunBenchmark(const FString& InFileName, int32 NumIterations)
+{
+	const FString FileName = NormalizePath(InFileName);
+	FMappedFile File;
+	if (!File.Open(UTF8ToWide(FileName)))
+	{
+		UE_LOG("[ObjImporter] Bench: cannot open '%s'", FileName.c_str());
+		return;
+	}
+	NumIterations = std::max(NumIterations, 1);
+
+	const double MegaBytes = File.GetSize() / (1024.0 * 1024.0);
+	const char* Data = reinterpret_cast<const char*>(File.GetData());
+	const SIZE_T Size = static_cast<SIZE_T>(File.GetSize());
+
+	// 각 방식의 가장 빠른 반복 (파일 캐시가 데워진 상태 기준)
+	auto Measure = [NumIterations](const std::function<void(FObjInfo&)>& Parse, FObjInfo& OutResult)
+	{
+		double BestMilliseconds = DBL_MAX;
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			FObjInfo Info;
+			const uint64 Start = FPlatformTime::Cycles64();
+			Parse(Info);
+			BestMilliseconds = std::min(BestMilliseconds, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+			OutResult = std::move(Info);
+		}
+		return BestMilliseconds;
+	};
+
+	FObjInfo LegacyResult, SerialResult, ParallelResult;
+	FString MtlFileName;
+	const double LegacyMs = Measure([&](FObjInfo& Info) { LoadObjGeometryLegacy(FileName, &Info, MtlFileName, true); }, LegacyResult);
+	const double SerialMs = Measure([&](FObjInfo& Info) { FObjParser::ParseBuffer(Data, Size, Info, MtlFileName, true, 1); }, SerialResult);
+	FObjParseStats Stats;
+	const double ParallelMs = Measure([&](FObjInfo& Info) { FObjParser::Parse(FileName, Info, MtlFileName, true, &Stats); }, ParallelResult);
+
+	// 같은 입력이면 순차/병렬 결과가 기존 파서와 비트 단위로 같아야 한다
+	auto IsSame = [&LegacyResult](const FObjInfo& Result)
+	{
+		auto SameBytes = [](const auto& A, const auto& B)
+		{
+			return A.size() == B.size() && (A.empty() || memcmp(A.data(), B.data(), A.size() * sizeof(A[0])) == 0);
+		};
+		return SameBytes(LegacyResult.Positions, Result.Positions)
+			&& SameBytes(LegacyResult.TexCoords, Result.TexCoords)
+			&& SameBytes(LegacyResult.Normals, Result.Normals)
+			&& SameBytes(LegacyResult.PositionIndices, Result.PositionIndices)
+			&& SameBytes(LegacyResult.TexCoordIndices, Result.TexCoordIndices)
+			&& SameBytes(LegacyResult.NormalIndices, Result.NormalIndices)
+			&& SameBytes(LegacyResult.GroupIndexStartArray, Result.GroupIndexStartArray);
+	};
+
+	// LoadObjModel과 같이 vt/vn이 없으면 기본값 하나를 넣는다
+	if (ParallelResult.Normals.empty())
+	{
+		ParallelResult.Normals.push_back(FVector(0.0f, 0.0f, 0.0f));
+	}
+	if (ParallelResult.TexCoords.empty())
+	{
+		ParallelResult.TexCoords.push_back(FVector2D(0.0f, 0.0f));
+	}
+
+	FStaticMesh Mesh;
+	const uint64 ConvertStart = FPlatformTime::Cycles64();
+	ConvertToStaticMesh(ParallelResult, TArray<FMaterialInfo>(), &Mesh);
+	const double ConvertMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ConvertStart);
+
+	UE_LOG("[ObjImporter] Bench '%s': %.2f MB, %zu positions, %zu triangles",
+		FileName.c_str(), MegaBytes, ParallelResult.Positions.size(), ParallelResult.PositionIndices.size() / 3);
+	UE_LOG("[ObjImporter]   legacy (getline + stringstream)  %9.2f ms  %8.1f MB/s", LegacyMs, MegaBytes * 1000.0 / LegacyMs);
+	UE_LOG("[ObjImporter]   mapped, 1 chunk                  %9.2f ms  %8.1f MB/s  %s",
+		SerialMs, MegaBytes * 1000.0 / SerialMs, IsSame(SerialResult) ? "match" : "MISMATCH");
+	UE_LOG("[ObjImporter]   mapped, %2d chunk(s)              %9.2f ms  %8.1f MB/s  %s  (x%.1f)",
+		Stats.NumChunks, ParallelMs, MegaBytes * 1000.0 / ParallelMs, IsSame(ParallelResult) ? "match" : "MISMATCH", LegacyMs / ParallelMs);
+	UE_LOG("[ObjImporter]   vertex dedup (TFlatMap)         %9.2f ms  %zu unique vertices", ConvertMs, Mesh.Vertices.size());
+}
+
 FObjImporter::FFaceVertex FObjImporter::ParseVertexDef(const FString& InVertexDef)
 {
 	FFaceVertex Result{ 0, 0, 0 };
@@ -40,23 +40,40 @@ public:
 		bool operator==(const VertexKey& Other) const { return PosIndex == Other.PosIndex && TexIndex == Other.TexIndex && NormalIndex == Other.NormalIndex; }
 	};
 
+	// 세 인덱스를 겹치지 않는 비트 구간에 놓는다 (섞기는 TFlatMap이 한다)
 	struct VertexKeyHash
 	{
-		size_t operator()(const VertexKey& Key) const { return std::hash<uint32>()(Key.PosIndex) ^ (std::hash<uint32>()(Key.TexIndex) << 1) ^ (std::hash<uint32>()(Key.NormalIndex) << 2); }
+		uint64 operator()(const VertexKey& Key) const { return (static_cast<uint64>(Key.PosIndex) << 40) ^ (static_cast<uint64>(Key.TexIndex) << 20) ^ Key.NormalIndex; }
 	};
 
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
 
+	// 기존 getline/stringstream 파서와 FObjParser(순차/병렬)의 MB/s 비교 및 결과 일치 검사 (콘솔 OBJ BENCH)
+	static void RunBenchmark(const FString& InFileName, int32 NumIterations);
+
 private:
 	struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
 
+	// FObjParser 이전의 지오메트리 파서 (OBJ BENCH 비교용으로만 남겨 둠)
+	static bool LoadObjGeometryLegacy(const FString& InFileName, FObjInfo* const OutObjInfo, FString& OutMtlFileName, bool bIsRightHanded);
+
 	static FFaceVertex ParseVertexDef(const FString& InVertexDef);
 };
 
 class UStaticMesh;
 
+// LoadObjStaticMeshAsset의 워커 단계 결과 (RegisterObjStaticMeshData로 넘긴다)
+struct FObjStaticMeshImport
+{
+	FStaticMesh* Mesh = nullptr;				// Register 전까지는 호출자 소유
+	TArray<FMaterialInfo> MaterialInfos;		// 텍스처 경로를 푼 머티리얼
+	TArray<FMaterialInfo> CachedMaterialInfos;	// 캐시에 저장된 그대로의 머티리얼 (BVH를 덧붙여 다시 저장할 때 사용)
+	FMeshBVH CachedBVH;
+	uint64 SourceHash = 0;
+};
+
 class FObjManager
 {
 private:
@@ -64,6 +81,13 @@ private:
 public:
 	static void Preload();
 	static void Clear();
+	static FStaticMesh* FindObjStaticMeshAsset(const FString& PathFileName);
 	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
+
+	// LoadObjStaticMeshAsset을 둘로 나눈 것 (UResourceManager::LoadAsync)
+	// Import: 캐시 로드 또는 임포트, 기본 머티리얼, 텍스처 경로 해석. UObject/메모리 캐시를 건드리지 않아 워커 스레드에서 호출 가능
+	// Register: BVH 등록, 머티리얼 생성, 메모리 캐시 등록 (메인 스레드). 같은 경로가 이미 등록돼 있으면 그것을 반환
+	static bool ImportObjStaticMeshData(const FString& NormalizedPathFileName, FObjStaticMeshImport& OutImport);
+	static FStaticMesh* RegisterObjStaticMeshData(const FString& NormalizedPathFileName, FObjStaticMeshImport& InImport);
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
 };
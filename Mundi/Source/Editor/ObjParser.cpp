@@ -0,0 +1,438 @@
+﻿#include "pch.h"
+#include "ObjParser.h"
+#include "ObjManager.h"
+#include "MappedFile.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
+#include <charconv>
+
+namespace
+{
+	// 이보다 작은 구간으로는 나누지 않는다 (스레드 분배 비용이 파싱보다 커짐)
+	constexpr SIZE_T MinChunkBytes = 1024 * 1024;
+	// 음수(상대) 인덱스 표시. 이어 붙일 때 앞 구간까지의 원소 수를 더해 절대 인덱스로 바꾼다
+	constexpr uint32 RelativeIndexFlag = 0x80000000u;
+
+	struct FObjMaterialEvent
+	{
+		uint32 IndexOffset;		// 구간 안에서 usemtl이 나온 시점의 인덱스 수
+		FString Name;
+	};
+
+	// 구간 하나의 파싱 결과
+	struct FObjChunk
+	{
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+
+		TArray<uint32> PositionIndices;
+		TArray<uint32> TexCoordIndices;
+		TArray<uint32> NormalIndices;
+		bool bHasRelativeIndex = false;
+
+		TArray<FObjMaterialEvent> MaterialEvents;
+		FString MtlLib;
+
+		int32 NumUnknownLines = 0;
+		FString FirstUnknownLine;
+	};
+
+	inline bool IsBlank(char C)
+	{
+		return C == ' ' || C == '\t' || C == '\r';
+	}
+
+	inline const char* SkipBlanks(const char* Cursor, const char* End)
+	{
+		while (Cursor < End && IsBlank(*Cursor))
+		{
+			++Cursor;
+		}
+		return Cursor;
+	}
+
+	// 키워드 뒤에 공백이 와야 일치 ("v " 와 "vt " 구분)
+	inline bool MatchKeyword(const char* Cursor, const char* End, const char* Keyword, SIZE_T Length)
+	{
+		return static_cast<SIZE_T>(End - Cursor) > Length && memcmp(Cursor, Keyword, Length) == 0 && IsBlank(Cursor[Length]);
+	}
+
+	// 실패하면 0 (기존 stringstream 파싱처럼 줄을 버리지 않는다)
+	inline float ParseFloat(const char*& Cursor, const char* End)
+	{
+		Cursor = SkipBlanks(Cursor, End);
+		if (Cursor < End && *Cursor == '+')
+		{
+			++Cursor;
+		}
+
+		float Value = 0.0f;
+		const std::from_chars_result Result = std::from_chars(Cursor, End, Value);
+		if (Result.ec == std::errc())
+		{
+			Cursor = Result.ptr;
+		}
+		else
+		{
+			// 해석할 수 없는 토큰은 건너뛴다
+			while (Cursor < End && !IsBlank(*Cursor))
+			{
+				++Cursor;
+			}
+		}
+		return Value;
+	}
+
+	// 면 정점의 인덱스 하나. 비어 있으면 0, 1부터 시작하는 값은 0부터로, 음수는 상대 인덱스로 기록
+	inline uint32 ParseIndex(const char*& Cursor, const char* End, uint32 LocalCount, bool& bOutRelative)
+	{
+		bool bNegative = false;
+		if (Cursor < End && (*Cursor == '-' || *Cursor == '+'))
+		{
+			bNegative = *Cursor == '-';
+			++Cursor;
+		}
+
+		uint32 Value = 0;
+		while (Cursor < End && *Cursor >= '0' && *Cursor <= '9')
+		{
+			Value = Value * 10 + static_cast<uint32>(*Cursor - '0');
+			++Cursor;
+		}
+
+		if (Value == 0)
+		{
+			return 0;
+		}
+		if (!bNegative)
+		{
+			return Value - 1;
+		}
+
+		// 구간 시작 기준 위치 (앞 구간을 가리키면 음수가 되므로 부호 있는 값으로 보관)
+		bOutRelative = true;
+		return (static_cast<uint32>(static_cast<int32>(LocalCount) - static_cast<int32>(Value))) | RelativeIndexFlag;
+	}
+
+	struct FFaceIndex
+	{
+		uint32 Position;
+		uint32 TexCoord;
+		uint32 Normal;
+	};
+
+	void ParseFace(const char* Cursor, const char* End, bool bIsRightHanded, FObjChunk& Chunk, TArray<FFaceIndex>& FaceScratch)
+	{
+		FaceScratch.clear();
+		const uint32 NumPositions = static_cast<uint32>(Chunk.Positions.size());
+		const uint32 NumTexCoords = static_cast<uint32>(Chunk.TexCoords.size());
+		const uint32 NumNormals = static_cast<uint32>(Chunk.Normals.size());
+
+		for (;;)
+		{
+			Cursor = SkipBlanks(Cursor, End);
+			if (Cursor >= End || *Cursor == '#')
+			{
+				break;
+			}
+
+			// p, p/t, p//n, p/t/n
+			FFaceIndex Index{ 0, 0, 0 };
+			Index.Position = ParseIndex(Cursor, End, NumPositions, Chunk.bHasRelativeIndex);
+			if (Cursor < End && *Cursor == '/')
+			{
+				++Cursor;
+				Index.TexCoord = ParseIndex(Cursor, End, NumTexCoords, Chunk.bHasRelativeIndex);
+				if (Cursor < End && *Cursor == '/')
+				{
+					++Cursor;
+					Index.Normal = ParseIndex(Cursor, End, NumNormals, Chunk.bHasRelativeIndex);
+				}
+			}
+			FaceScratch.push_back(Index);
+
+			// 잘못된 문자는 토큰 끝까지 버린다
+			while (Cursor < End && !IsBlank(*Cursor))
+			{
+				++Cursor;
+			}
+		}
+
+		if (FaceScratch.size() < 3)
+		{
+			return;
+		}
+
+		auto Emit = [&Chunk](const FFaceIndex& Index)
+		{
+			Chunk.PositionIndices.push_back(Index.Position);
+			Chunk.TexCoordIndices.push_back(Index.TexCoord);
+			Chunk.NormalIndices.push_back(Index.Normal);
+		};
+
+		// 다각형은 첫 정점 기준 팬으로 나눈다
+		for (SIZE_T i = 1; i + 1 < FaceScratch.size(); ++i)
+		{
+			Emit(FaceScratch[0]);
+			if (bIsRightHanded)
+			{
+				Emit(FaceScratch[i + 1]);
+				Emit(FaceScratch[i]);
+			}
+			else
+			{
+				Emit(FaceScratch[i]);
+				Emit(FaceScratch[i + 1]);
+			}
+		}
+	}
+
+	// 앞뒤 공백을 뺀 줄의 나머지 전체 (mtllib / usemtl 이름에 공백이 들어갈 수 있음)
+	FString ReadRestOfLine(const char* Cursor, const char* End)
+	{
+		Cursor = SkipBlanks(Cursor, End);
+		while (End > Cursor && IsBlank(End[-1]))
+		{
+			--End;
+		}
+		return FString(Cursor, End);
+	}
+
+	void ParseChunk(const char* Begin, const char* End, bool bIsRightHanded, FObjChunk& Chunk)
+	{
+		// 대략적인 예약 (한 줄 평균 30바이트 정도)
+		const SIZE_T EstimatedLines = static_cast<SIZE_T>(End - Begin) / 32;
+		Chunk.Positions.reserve(EstimatedLines / 3);
+		Chunk.PositionIndices.reserve(EstimatedLines);
+		Chunk.TexCoordIndices.reserve(EstimatedLines);
+		Chunk.NormalIndices.reserve(EstimatedLines);
+
+		TArray<FFaceIndex> FaceScratch;
+		const float YSign = bIsRightHanded ? -1.0f : 1.0f;
+
+		const char* LineBegin = Begin;
+		while (LineBegin < End)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', static_cast<SIZE_T>(End - LineBegin)));
+			const char* NextLine = LineEnd ? LineEnd + 1 : End;
+			if (!LineEnd)
+			{
+				LineEnd = End;
+			}
+
+			const char* Cursor = SkipBlanks(LineBegin, LineEnd);
+			LineBegin = NextLine;
+			if (Cursor >= LineEnd || *Cursor == '#')
+			{
+				continue;
+			}
+
+			if (MatchKeyword(Cursor, LineEnd, "v", 1))
+			{
+				Cursor += 2;
+				const float X = ParseFloat(Cursor, LineEnd);
+				const float Y = ParseFloat(Cursor, LineEnd);
+				const float Z = ParseFloat(Cursor, LineEnd);
+				Chunk.Positions.push_back(FVector(X, Y * YSign, Z));
+			}
+			else if (MatchKeyword(Cursor, LineEnd, "vt", 2))
+			{
+				Cursor += 3;
+				const float U = ParseFloat(Cursor, LineEnd);
+				const float V = ParseFloat(Cursor, LineEnd);
+				// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0)
+				Chunk.TexCoords.push_back(FVector2D(U, 1.0f - V));
+			}
+			else if (MatchKeyword(Cursor, LineEnd, "vn", 2))
+			{
+				Cursor += 3;
+				const float X = ParseFloat(Cursor, LineEnd);
+				const float Y = ParseFloat(Cursor, LineEnd);
+				const float Z = ParseFloat(Cursor, LineEnd);
+				Chunk.Normals.push_back(FVector(X, Y * YSign, Z));
+			}
+			else if (MatchKeyword(Cursor, LineEnd, "f", 1))
+			{
+				ParseFace(Cursor + 2, LineEnd, bIsRightHanded, Chunk, FaceScratch);
+			}
+			else if (MatchKeyword(Cursor, LineEnd, "g", 1))
+			{
+				// 'usemtl' 기준으로 그룹을 나누므로 'g'는 무시
+			}
+			else if (MatchKeyword(Cursor, LineEnd, "usemtl", 6))
+			{
+				Chunk.MaterialEvents.push_back({ static_cast<uint32>(Chunk.PositionIndices.size()), ReadRestOfLine(Cursor + 7, LineEnd) });
+			}
+			else if (MatchKeyword(Cursor, LineEnd, "mtllib", 6))
+			{
+				Chunk.MtlLib = ReadRestOfLine(Cursor + 7, LineEnd);
+			}
+			else
+			{
+				if (Chunk.NumUnknownLines == 0)
+				{
+					Chunk.FirstUnknownLine = ReadRestOfLine(Cursor, LineEnd);
+				}
+				++Chunk.NumUnknownLines;
+			}
+		}
+	}
+
+	// 상대 인덱스를 앞 구간까지의 원소 수(Base)를 더해 절대 인덱스로
+	inline uint32 ResolveIndex(uint32 Index, uint32 Base)
+	{
+		if (Index & RelativeIndexFlag)
+		{
+			// 플래그를 떼고 31비트 부호 확장
+			const int32 Local = static_cast<int32>(Index << 1) >> 1;
+			return static_cast<uint32>(static_cast<int32>(Base) + Local);
+		}
+		return Index;
+	}
+
+	template<typename T>
+	void CopyRange(TArray<T>& Dest, SIZE_T Offset, const TArray<T>& Source)
+	{
+		if (!Source.empty())
+		{
+			memcpy(Dest.data() + Offset, Source.data(), Source.size() * sizeof(T));
+		}
+	}
+}
+
+bool FObjParser::Parse(const FString& InFileName, FObjInfo& OutObjInfo, FString& OutMtlFileName, bool bIsRightHanded, FObjParseStats* OutStats)
+{
+	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
+	FMappedFile File;
+	if (!File.Open(UTF8ToWide(InFileName)))
+	{
+		return false;
+	}
+
+	FString MtlLib;
+	ParseBuffer(reinterpret_cast<const char*>(File.GetData()), static_cast<SIZE_T>(File.GetSize()), OutObjInfo, MtlLib, bIsRightHanded,
+		FWorkerPool::GetInstance().GetConcurrency() * 4, OutStats);
+
+	OutMtlFileName.clear();
+	if (!MtlLib.empty())
+	{
+		const size_t Pos = InFileName.find_last_of("/\\");
+		const FString ObjDir = (Pos == FString::npos) ? "" : InFileName.substr(0, Pos + 1);
+		OutMtlFileName = ObjDir + MtlLib;
+	}
+	return true;
+}
+
+void FObjParser::ParseBuffer(const char* Data, SIZE_T Size, FObjInfo& OutObjInfo, FString& OutMtlLib, bool bIsRightHanded, int32 MaxChunks, FObjParseStats* OutStats)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 1) 줄 경계에서 구간 나누기
+	const int32 NumChunks = static_cast<int32>(std::clamp<SIZE_T>(Size / MinChunkBytes, 1, static_cast<SIZE_T>(std::max(MaxChunks, 1))));
+	TArray<const char*> Boundaries;
+	Boundaries.Reserve(NumChunks + 1);
+	Boundaries.Add(Data);
+	for (int32 i = 1; i < NumChunks; ++i)
+	{
+		const char* Split = std::max(Data + Size * i / NumChunks, Boundaries.back());
+		const char* LineEnd = static_cast<const char*>(memchr(Split, '\n', static_cast<SIZE_T>(Data + Size - Split)));
+		Boundaries.Add(LineEnd ? LineEnd + 1 : Data + Size);
+	}
+	Boundaries.Add(Data + Size);
+
+	// 2) 구간별 파싱
+	TArray<FObjChunk> Chunks;
+	Chunks.SetNum(NumChunks);
+	ParallelFor(NumChunks, 1, [&](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			ParseChunk(Boundaries[i], Boundaries[i + 1], bIsRightHanded, Chunks[i]);
+		}
+	});
+
+	// 3) 구간 순서대로 위치 계산
+	TArray<uint32> PositionBase, TexCoordBase, NormalBase, IndexBase;
+	PositionBase.SetNum(NumChunks + 1);
+	TexCoordBase.SetNum(NumChunks + 1);
+	NormalBase.SetNum(NumChunks + 1);
+	IndexBase.SetNum(NumChunks + 1);
+	PositionBase[0] = TexCoordBase[0] = NormalBase[0] = IndexBase[0] = 0;
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		PositionBase[i + 1] = PositionBase[i] + static_cast<uint32>(Chunks[i].Positions.size());
+		TexCoordBase[i + 1] = TexCoordBase[i] + static_cast<uint32>(Chunks[i].TexCoords.size());
+		NormalBase[i + 1] = NormalBase[i] + static_cast<uint32>(Chunks[i].Normals.size());
+		IndexBase[i + 1] = IndexBase[i] + static_cast<uint32>(Chunks[i].PositionIndices.size());
+	}
+
+	// 기존 내용 뒤에 붙이지 않고 새로 채운다
+	OutObjInfo.Positions.SetNum(PositionBase[NumChunks]);
+	OutObjInfo.TexCoords.SetNum(TexCoordBase[NumChunks]);
+	OutObjInfo.Normals.SetNum(NormalBase[NumChunks]);
+	OutObjInfo.PositionIndices.SetNum(IndexBase[NumChunks]);
+	OutObjInfo.TexCoordIndices.SetNum(IndexBase[NumChunks]);
+	OutObjInfo.NormalIndices.SetNum(IndexBase[NumChunks]);
+
+	// 4) 복사와 상대 인덱스 보정은 구간마다 독립적
+	ParallelFor(NumChunks, 1, [&](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			FObjChunk& Chunk = Chunks[i];
+			CopyRange(OutObjInfo.Positions, PositionBase[i], Chunk.Positions);
+			CopyRange(OutObjInfo.TexCoords, TexCoordBase[i], Chunk.TexCoords);
+			CopyRange(OutObjInfo.Normals, NormalBase[i], Chunk.Normals);
+
+			const uint32 Offset = IndexBase[i];
+			const SIZE_T NumIndices = Chunk.PositionIndices.size();
+			if (Chunk.bHasRelativeIndex)
+			{
+				for (SIZE_T j = 0; j < NumIndices; ++j)
+				{
+					OutObjInfo.PositionIndices[Offset + j] = ResolveIndex(Chunk.PositionIndices[j], PositionBase[i]);
+					OutObjInfo.TexCoordIndices[Offset + j] = ResolveIndex(Chunk.TexCoordIndices[j], TexCoordBase[i]);
+					OutObjInfo.NormalIndices[Offset + j] = ResolveIndex(Chunk.NormalIndices[j], NormalBase[i]);
+				}
+			}
+			else
+			{
+				CopyRange(OutObjInfo.PositionIndices, Offset, Chunk.PositionIndices);
+				CopyRange(OutObjInfo.TexCoordIndices, Offset, Chunk.TexCoordIndices);
+				CopyRange(OutObjInfo.NormalIndices, Offset, Chunk.NormalIndices);
+			}
+		}
+	});
+
+	// 5) 머티리얼 그룹과 mtllib (마지막 mtllib가 유효, 기존 임포터와 같음)
+	OutMtlLib.clear();
+	int32 NumUnknownLines = 0;
+	FString FirstUnknownLine;
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		for (const FObjMaterialEvent& Event : Chunks[i].MaterialEvents)
+		{
+			OutObjInfo.MaterialNames.push_back(Event.Name);
+			OutObjInfo.GroupIndexStartArray.push_back(IndexBase[i] + Event.IndexOffset);
+		}
+		if (!Chunks[i].MtlLib.empty())
+		{
+			OutMtlLib = Chunks[i].MtlLib;
+		}
+		if (NumUnknownLines == 0 && Chunks[i].NumUnknownLines > 0)
+		{
+			FirstUnknownLine = Chunks[i].FirstUnknownLine;
+		}
+		NumUnknownLines += Chunks[i].NumUnknownLines;
+	}
+
+	if (OutStats)
+	{
+		OutStats->FileBytes = Size;
+		OutStats->NumChunks = NumChunks;
+		OutStats->NumUnknownLines = NumUnknownLines;
+		OutStats->FirstUnknownLine = FirstUnknownLine;
+		OutStats->Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+}
@@ -0,0 +1,35 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+struct FObjInfo;
+
+/** .obj 한 파일의 파싱 통계 (임포트 로그 / OBJ BENCH) */
+struct FObjParseStats
+{
+	uint64 FileBytes = 0;
+	int32 NumChunks = 0;
+	int32 NumUnknownLines = 0;		// v/vt/vn/f/g/mtllib/usemtl 외의 줄 (o, s 등)
+	FString FirstUnknownLine;
+	double Milliseconds = 0.0;
+};
+
+/**
+ * .obj 지오메트리 파서
+ * - 파일을 메모리 매핑하고 한 번만 훑는다 (줄/토큰 문자열을 만들지 않고 포인터로 읽음)
+ * - 실수는 std::from_chars로 읽어 로캘과 무관하고, 정수 인덱스는 직접 읽는다
+ * - 큰 파일은 줄 경계에서 구간을 나눠 ParallelFor로 파싱하고, 구간 순서대로 이어 붙인다
+ *   (결과는 구간 수와 관계없이 순차 파싱과 같다. 음수(상대) 인덱스는 이어 붙일 때 앞 구간 개수로 보정)
+ * - 좌표계 변환(오른손 좌표계 Y 반전, V 반전, 감기 순서)은 기존 FObjImporter와 같다
+ * - .mtl은 읽지 않는다. mtllib 경로만 넘기고 머티리얼 파싱은 FObjImporter가 한다
+ */
+class FObjParser
+{
+public:
+	// Positions/TexCoords/Normals, 삼각형 인덱스, usemtl 그룹 시작(MaterialNames, GroupIndexStartArray)을 채운다
+	// OutMtlFileName은 .obj 파일 기준 상대 경로를 붙인 mtllib 경로 (없으면 빈 문자열)
+	static bool Parse(const FString& InFileName, FObjInfo& OutObjInfo, FString& OutMtlFileName, bool bIsRightHanded, FObjParseStats* OutStats = nullptr);
+
+	// 메모리 버퍼 파싱 (MaxChunks = 1이면 호출 스레드에서 순차 파싱)
+	static void ParseBuffer(const char* Data, SIZE_T Size, FObjInfo& OutObjInfo, FString& OutMtlLib, bool bIsRightHanded, int32 MaxChunks, FObjParseStats* OutStats = nullptr);
+};
@@ -0,0 +1,168 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "BackgroundTasks.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+class UResourceBase;
+
+enum class EAsyncLoadState : uint8
+{
+	Queued,				// 워커 대기
+	Loading,			// 워커에서 읽기/파싱/디코드 중
+	ReadyToUpload,		// 메인 스레드 업로드 대기 (UResourceManager::TickAsyncLoads)
+	Completed,
+	Failed,
+	Canceled,
+};
+
+/**
+ * LoadAsync 요청 하나의 공유 상태 (핸들과 UResourceManager가 함께 잡고 있음)
+ * - State만 스레드 간에 오가고, 나머지는 생성 후 메인 스레드 또는 State로 넘겨받은 쪽에서만 만진다
+ */
+struct FAsyncLoadRequest
+{
+	FString Path;
+	UResourceBase* Resource = nullptr;		// 자리표시자. 완료되면 같은 객체가 채워진다
+	ETaskPriority Priority = ETaskPriority::Normal;
+	uint64 Sequence = 0;					// 같은 대역 안에서는 요청 순서대로 업로드
+
+	std::atomic<EAsyncLoadState> State{ EAsyncLoadState::Queued };
+	std::atomic<bool> bCancelRequested{ false };
+	int32 NumHandles = 0;					// Cancel은 모든 핸들이 취소해야 적용 (메인 스레드)
+
+	// 워커 단계 (파일 읽기, 파싱, 디코드). UObject를 만들거나 디바이스를 쓰면 안 된다. false면 실패
+	std::function<bool()> LoadOnWorker;
+	// 메인 스레드 단계 (디바이스 업로드, UObject 생성/등록). bCanceled면 업로드는 건너뛰고 정리만 한다
+	std::function<bool(bool bCanceled)> FinishOnMainThread;
+
+	bool bLoadedOnWorker = false;			// State가 ReadyToUpload가 된 뒤에 읽는다
+	bool bSkippedOnWorker = false;			// 워커가 꺼냈을 때 이미 취소돼 있었음 (그 뒤 다시 요청되면 재예약)
+	uint64 WorkerCycles = 0;
+
+	// 이 요청이 끌어온 의존 에셋 (메시 -> 머티리얼 텍스처)
+	TArray<std::shared_ptr<FAsyncLoadRequest>> Dependencies;
+	// 끝나면(성공/실패/취소) 메인 스레드에서 호출
+	TArray<std::function<void(UResourceBase*)>> OnCompleted;
+
+	bool IsDone() const
+	{
+		const EAsyncLoadState Current = State.load(std::memory_order_acquire);
+		return Current == EAsyncLoadState::Completed || Current == EAsyncLoadState::Failed || Current == EAsyncLoadState::Canceled;
+	}
+
+	bool IsDoneWithDependencies() const
+	{
+		if (!IsDone())
+		{
+			return false;
+		}
+		for (const std::shared_ptr<FAsyncLoadRequest>& Dependency : Dependencies)
+		{
+			if (!Dependency->IsDoneWithDependencies())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+/**
+ * UResourceManager::LoadAsync 결과
+ * - Get()은 로드가 끝나기 전에도 유효한 자리표시자 객체를 돌려준다 (완료되면 같은 객체가 채워짐)
+ * - 메인 스레드에서만 사용
+ * - 복사본도 요청의 핸들 수(NumHandles)에 포함된다. 복사본마다 Cancel해야 취소된다
+ */
+template<typename T>
+class TAsyncLoadHandle
+{
+public:
+	TAsyncLoadHandle() = default;
+	explicit TAsyncLoadHandle(std::shared_ptr<FAsyncLoadRequest> InRequest)
+		: Request(std::move(InRequest))
+	{
+	}
+
+	TAsyncLoadHandle(const TAsyncLoadHandle& Other)
+		: Request(Other.Request)
+	{
+		AddHandle();
+	}
+
+	TAsyncLoadHandle(TAsyncLoadHandle&& Other) noexcept
+		: Request(std::move(Other.Request))
+	{
+	}
+
+	TAsyncLoadHandle& operator=(const TAsyncLoadHandle& Other)
+	{
+		// 덮어쓴 핸들은 소멸과 마찬가지로 취소하지 않는다 (요청은 계속 진행)
+		if (this != &Other)
+		{
+			Request = Other.Request;
+			AddHandle();
+		}
+		return *this;
+	}
+
+	TAsyncLoadHandle& operator=(TAsyncLoadHandle&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Request = std::move(Other.Request);
+		}
+		return *this;
+	}
+
+	bool IsValid() const { return Request != nullptr; }
+	T* Get() const { return Request ? static_cast<T*>(Request->Resource) : nullptr; }
+
+	EAsyncLoadState GetState() const { return Request ? Request->State.load(std::memory_order_acquire) : EAsyncLoadState::Failed; }
+	// 이 에셋과 의존 에셋이 모두 끝났는지
+	bool IsDone() const { return !Request || Request->IsDoneWithDependencies(); }
+	bool IsSucceeded() const { return GetState() == EAsyncLoadState::Completed; }
+
+	// 업로드 전이면 건너뛴다. 같은 경로를 요청한 다른 핸들이 남아 있으면 그 핸들이 모두 취소할 때까지 유지
+	void Cancel()
+	{
+		if (Request && !Request->IsDone() && --Request->NumHandles <= 0)
+		{
+			Request->bCancelRequested.store(true, std::memory_order_release);
+		}
+		Request.reset();
+	}
+
+	// 끝나면 메인 스레드에서 호출 (이미 끝났으면 바로 호출)
+	void OnCompleted(std::function<void(T*)> Callback)
+	{
+		if (!Request || !Callback)
+		{
+			return;
+		}
+		if (Request->IsDone())
+		{
+			Callback(Get());
+			return;
+		}
+		Request->OnCompleted.Add([Callback = std::move(Callback)](UResourceBase* Resource)
+		{
+			Callback(static_cast<T*>(Resource));
+		});
+	}
+
+	const std::shared_ptr<FAsyncLoadRequest>& GetRequest() const { return Request; }
+
+private:
+	void AddHandle()
+	{
+		if (Request)
+		{
+			++Request->NumHandles;
+		}
+	}
+
+private:
+	std::shared_ptr<FAsyncLoadRequest> Request;
+};
@@ -0,0 +1,731 @@
+﻿#include "pch.h"
+#include "BlockCompression.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BC_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define BC_USE_SSE2 0
+#endif
+
+namespace
+{
+	/** 블록 16픽셀을 채널별로 모은 것 (SSE로 4픽셀씩 읽기 위해 정렬) */
+	struct FBlockSoA
+	{
+		alignas(16) float Channel[4][16];
+	};
+
+	void LoadBlock(const uint8* InPixels, int32 NumChannels, FBlockSoA& OutBlock)
+	{
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				OutBlock.Channel[Channel][Pixel] = InPixels[Pixel * 4 + Channel];
+			}
+		}
+	}
+
+	/**
+	 * 픽셀마다 가장 가까운 팔레트 색인을 고르고 제곱 오차 합을 반환
+	 * Palette[i]의 앞 NumChannels개 채널만 비교한다
+	 */
+	float FindNearest(const FBlockSoA& Pixels, int32 NumChannels, const float (*Palette)[4], int32 NumPalette, uint8* OutIndices)
+	{
+#if BC_USE_SSE2
+		__m128 Total = _mm_setzero_ps();
+		for (int32 Group = 0; Group < 16; Group += 4)
+		{
+			__m128 Values[4];
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Values[Channel] = _mm_load_ps(&Pixels.Channel[Channel][Group]);
+			}
+
+			__m128 Best = _mm_set1_ps(FLT_MAX);
+			__m128 BestIndex = _mm_setzero_ps();
+			for (int32 Entry = 0; Entry < NumPalette; ++Entry)
+			{
+				__m128 Distance = _mm_setzero_ps();
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					const __m128 Delta = _mm_sub_ps(Values[Channel], _mm_set1_ps(Palette[Entry][Channel]));
+					Distance = _mm_add_ps(Distance, _mm_mul_ps(Delta, Delta));
+				}
+				const __m128 Closer = _mm_cmplt_ps(Distance, Best);
+				Best = _mm_min_ps(Distance, Best);
+				BestIndex = _mm_or_ps(_mm_and_ps(Closer, _mm_set1_ps(static_cast<float>(Entry))), _mm_andnot_ps(Closer, BestIndex));
+			}
+			Total = _mm_add_ps(Total, Best);
+
+			alignas(16) int32 Indices[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(Indices), _mm_cvttps_epi32(BestIndex));
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				OutIndices[Group + Lane] = static_cast<uint8>(Indices[Lane]);
+			}
+		}
+		alignas(16) float Sums[4];
+		_mm_store_ps(Sums, Total);
+		return Sums[0] + Sums[1] + Sums[2] + Sums[3];
+#else
+		float Total = 0.0f;
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			float Best = FLT_MAX;
+			int32 BestIndex = 0;
+			for (int32 Entry = 0; Entry < NumPalette; ++Entry)
+			{
+				float Distance = 0.0f;
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					const float Delta = Pixels.Channel[Channel][Pixel] - Palette[Entry][Channel];
+					Distance += Delta * Delta;
+				}
+				if (Distance < Best)
+				{
+					Best = Distance;
+					BestIndex = Entry;
+				}
+			}
+			OutIndices[Pixel] = static_cast<uint8>(BestIndex);
+			Total += Best;
+		}
+		return Total;
+#endif
+	}
+
+	/** 주성분 축 위 양 끝점 (Start는 축의 음수 쪽). 모든 픽셀이 같으면 false */
+	bool ComputePrincipalEndpoints(const FBlockSoA& Pixels, int32 NumChannels, float* OutStart, float* OutEnd)
+	{
+		float Mean[4] = {};
+		float Min[4];
+		float Max[4];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Min[Channel] = FLT_MAX;
+			Max[Channel] = -FLT_MAX;
+			for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+			{
+				const float Value = Pixels.Channel[Channel][Pixel];
+				Mean[Channel] += Value;
+				Min[Channel] = std::min(Min[Channel], Value);
+				Max[Channel] = std::max(Max[Channel], Value);
+			}
+			Mean[Channel] /= 16.0f;
+		}
+
+		float Covariance[4][4] = {};
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			for (int32 Row = 0; Row < NumChannels; ++Row)
+			{
+				const float DeltaRow = Pixels.Channel[Row][Pixel] - Mean[Row];
+				for (int32 Column = Row; Column < NumChannels; ++Column)
+				{
+					Covariance[Row][Column] += DeltaRow * (Pixels.Channel[Column][Pixel] - Mean[Column]);
+				}
+			}
+		}
+		for (int32 Row = 0; Row < NumChannels; ++Row)
+		{
+			for (int32 Column = 0; Column < Row; ++Column)
+			{
+				Covariance[Row][Column] = Covariance[Column][Row];
+			}
+		}
+
+		// 거듭제곱법 (범위 대각선에서 시작)
+		float Axis[4] = {};
+		float AxisLength = 0.0f;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Axis[Channel] = Max[Channel] - Min[Channel];
+			AxisLength += Axis[Channel];
+		}
+		if (AxisLength <= 0.0f)
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				OutStart[Channel] = OutEnd[Channel] = Mean[Channel];
+			}
+			return false;
+		}
+
+		for (int32 Iteration = 0; Iteration < 8; ++Iteration)
+		{
+			float Next[4] = {};
+			float Largest = 0.0f;
+			for (int32 Row = 0; Row < NumChannels; ++Row)
+			{
+				for (int32 Column = 0; Column < NumChannels; ++Column)
+				{
+					Next[Row] += Covariance[Row][Column] * Axis[Column];
+				}
+				Largest = std::max(Largest, std::fabs(Next[Row]));
+			}
+			if (Largest <= 0.0f)
+			{
+				break;
+			}
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Axis[Channel] = Next[Channel] / Largest;
+			}
+		}
+
+		float LengthSquared = 0.0f;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			LengthSquared += Axis[Channel] * Axis[Channel];
+		}
+		const float InvLength = 1.0f / std::sqrt(LengthSquared);
+
+		float MinProjection = FLT_MAX;
+		float MaxProjection = -FLT_MAX;
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			float Projection = 0.0f;
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Projection += (Pixels.Channel[Channel][Pixel] - Mean[Channel]) * Axis[Channel] * InvLength;
+			}
+			MinProjection = std::min(MinProjection, Projection);
+			MaxProjection = std::max(MaxProjection, Projection);
+		}
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			const float Direction = Axis[Channel] * InvLength;
+			OutStart[Channel] = std::clamp(Mean[Channel] + Direction * MinProjection, 0.0f, 255.0f);
+			OutEnd[Channel] = std::clamp(Mean[Channel] + Direction * MaxProjection, 0.0f, 255.0f);
+		}
+		return true;
+	}
+
+	/**
+	 * 색인별 가중치(Weights[i] = 끝점 0의 비율)로 두 끝점을 최소제곱으로 다시 구한다
+	 * 한쪽 끝점만 쓰여 풀 수 없으면 false
+	 */
+	bool SolveEndpoints(const FBlockSoA& Pixels, int32 NumChannels, const uint8* Indices, const float* Weights, float* OutEndpoint0, float* OutEndpoint1)
+	{
+		float A2 = 0.0f;
+		float B2 = 0.0f;
+		float AB = 0.0f;
+		float AX[4] = {};
+		float BX[4] = {};
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			const float A = Weights[Indices[Pixel]];
+			const float B = 1.0f - A;
+			A2 += A * A;
+			B2 += B * B;
+			AB += A * B;
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				AX[Channel] += A * Pixels.Channel[Channel][Pixel];
+				BX[Channel] += B * Pixels.Channel[Channel][Pixel];
+			}
+		}
+
+		const float Determinant = A2 * B2 - AB * AB;
+		if (std::fabs(Determinant) < 1e-6f)
+		{
+			return false;
+		}
+		const float InvDeterminant = 1.0f / Determinant;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutEndpoint0[Channel] = std::clamp((AX[Channel] * B2 - BX[Channel] * AB) * InvDeterminant, 0.0f, 255.0f);
+			OutEndpoint1[Channel] = std::clamp((BX[Channel] * A2 - AX[Channel] * AB) * InvDeterminant, 0.0f, 255.0f);
+		}
+		return true;
+	}
+
+	// ─────────────────────────────────────────────
+	// BC1
+	// ─────────────────────────────────────────────
+
+	uint16 PackRGB565(const float* Color)
+	{
+		const uint32 R = static_cast<uint32>(std::lround(Color[0] * 31.0f / 255.0f));
+		const uint32 G = static_cast<uint32>(std::lround(Color[1] * 63.0f / 255.0f));
+		const uint32 B = static_cast<uint32>(std::lround(Color[2] * 31.0f / 255.0f));
+		return static_cast<uint16>((R << 11) | (G << 5) | B);
+	}
+
+	void UnpackRGB565(uint16 Packed, float* OutColor)
+	{
+		const uint32 R = (Packed >> 11) & 31;
+		const uint32 G = (Packed >> 5) & 63;
+		const uint32 B = Packed & 31;
+		OutColor[0] = static_cast<float>((R << 3) | (R >> 2));
+		OutColor[1] = static_cast<float>((G << 2) | (G >> 4));
+		OutColor[2] = static_cast<float>((B << 3) | (B >> 2));
+		OutColor[3] = 255.0f;
+	}
+
+	// 4색 팔레트 (색인 0, 1이 끝점, 2 = 2/3 + 1/3, 3 = 1/3 + 2/3)
+	void BuildBC1Palette(uint16 Color0, uint16 Color1, float (*OutPalette)[4])
+	{
+		UnpackRGB565(Color0, OutPalette[0]);
+		UnpackRGB565(Color1, OutPalette[1]);
+		for (int32 Channel = 0; Channel < 3; ++Channel)
+		{
+			OutPalette[2][Channel] = (2.0f * OutPalette[0][Channel] + OutPalette[1][Channel]) / 3.0f;
+			OutPalette[3][Channel] = (OutPalette[0][Channel] + 2.0f * OutPalette[1][Channel]) / 3.0f;
+		}
+	}
+
+	struct FBC1Candidate
+	{
+		uint16 Color0 = 0;
+		uint16 Color1 = 0;
+		uint8 Indices[16] = {};
+		float Error = FLT_MAX;
+	};
+
+	// 끝점을 565로 양자화해 평가 (4색 모드가 되도록 Color0 > Color1로 맞춤)
+	void EvaluateBC1(const FBlockSoA& Pixels, const float* Endpoint0, const float* Endpoint1, FBC1Candidate& InOutBest)
+	{
+		FBC1Candidate Candidate;
+		Candidate.Color0 = PackRGB565(Endpoint0);
+		Candidate.Color1 = PackRGB565(Endpoint1);
+		if (Candidate.Color0 < Candidate.Color1)
+		{
+			std::swap(Candidate.Color0, Candidate.Color1);
+		}
+
+		float Palette[4][4];
+		BuildBC1Palette(Candidate.Color0, Candidate.Color1, Palette);
+		if (Candidate.Color0 == Candidate.Color1)
+		{
+			// 3색 모드가 되므로 색인 0(끝점)만 쓴다
+			Candidate.Error = FindNearest(Pixels, 3, Palette, 1, Candidate.Indices);
+		}
+		else
+		{
+			Candidate.Error = FindNearest(Pixels, 3, Palette, 4, Candidate.Indices);
+		}
+
+		if (Candidate.Error < InOutBest.Error)
+		{
+			InOutBest = Candidate;
+		}
+	}
+
+	void WriteBC1(const FBC1Candidate& Candidate, uint8* OutBlock)
+	{
+		uint32 IndexBits = 0;
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			IndexBits |= static_cast<uint32>(Candidate.Indices[Pixel] & 3) << (Pixel * 2);
+		}
+		OutBlock[0] = static_cast<uint8>(Candidate.Color0 & 0xFF);
+		OutBlock[1] = static_cast<uint8>(Candidate.Color0 >> 8);
+		OutBlock[2] = static_cast<uint8>(Candidate.Color1 & 0xFF);
+		OutBlock[3] = static_cast<uint8>(Candidate.Color1 >> 8);
+		std::memcpy(OutBlock + 4, &IndexBits, 4);
+	}
+
+	// ─────────────────────────────────────────────
+	// BC4
+	// ─────────────────────────────────────────────
+
+	// a0 > a1이면 8단계, 아니면 6단계 + 0, 255
+	void BuildBC4Palette(uint8 Alpha0, uint8 Alpha1, float (*OutPalette)[4])
+	{
+		OutPalette[0][0] = Alpha0;
+		OutPalette[1][0] = Alpha1;
+		if (Alpha1 < Alpha0)
+		{
+			for (int32 Step = 1; Step < 7; ++Step)
+			{
+				OutPalette[Step + 1][0] = static_cast<float>(((7 - Step) * Alpha0 + Step * Alpha1) / 7);
+			}
+		}
+		else
+		{
+			for (int32 Step = 1; Step < 5; ++Step)
+			{
+				OutPalette[Step + 1][0] = static_cast<float>(((5 - Step) * Alpha0 + Step * Alpha1) / 5);
+			}
+			OutPalette[6][0] = 0.0f;
+			OutPalette[7][0] = 255.0f;
+		}
+	}
+
+	float EvaluateBC4(const FBlockSoA& Values, uint8 Alpha0, uint8 Alpha1, uint8* OutIndices)
+	{
+		float Palette[8][4] = {};
+		BuildBC4Palette(Alpha0, Alpha1, Palette);
+		return FindNearest(Values, 1, Palette, 8, OutIndices);
+	}
+
+	void WriteBC4(uint8 Alpha0, uint8 Alpha1, const uint8* Indices, uint8* OutBlock)
+	{
+		uint64 IndexBits = 0;
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			IndexBits |= static_cast<uint64>(Indices[Pixel] & 7) << (Pixel * 3);
+		}
+		OutBlock[0] = Alpha0;
+		OutBlock[1] = Alpha1;
+		for (int32 Byte = 0; Byte < 6; ++Byte)
+		{
+			OutBlock[2 + Byte] = static_cast<uint8>(IndexBits >> (Byte * 8));
+		}
+	}
+
+	// ─────────────────────────────────────────────
+	// BC7 (모드 6)
+	// ─────────────────────────────────────────────
+
+	constexpr int32 BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	struct FBC7Mode6
+	{
+		uint8 Endpoint[2][4] = {};		// 7비트
+		uint8 PBit[2] = {};
+		uint8 Indices[16] = {};
+		float Error = FLT_MAX;
+	};
+
+	void BuildBC7Palette(const FBC7Mode6& Block, float (*OutPalette)[4])
+	{
+		for (int32 Channel = 0; Channel < 4; ++Channel)
+		{
+			const int32 Value0 = (Block.Endpoint[0][Channel] << 1) | Block.PBit[0];
+			const int32 Value1 = (Block.Endpoint[1][Channel] << 1) | Block.PBit[1];
+			for (int32 Index = 0; Index < 16; ++Index)
+			{
+				OutPalette[Index][Channel] = static_cast<float>(((64 - BC7Weights4[Index]) * Value0 + BC7Weights4[Index] * Value1 + 32) >> 6);
+			}
+		}
+	}
+
+	// 끝점을 p비트 조합 4가지로 양자화해 가장 좋은 것을 InOutBest에
+	void EvaluateBC7(const FBlockSoA& Pixels, const float* Endpoint0, const float* Endpoint1, FBC7Mode6& InOutBest)
+	{
+		for (uint8 PBits = 0; PBits < 4; ++PBits)
+		{
+			FBC7Mode6 Candidate;
+			Candidate.PBit[0] = PBits & 1;
+			Candidate.PBit[1] = PBits >> 1;
+			for (int32 Channel = 0; Channel < 4; ++Channel)
+			{
+				Candidate.Endpoint[0][Channel] = static_cast<uint8>(std::clamp(std::lround((Endpoint0[Channel] - Candidate.PBit[0]) * 0.5f), 0L, 127L));
+				Candidate.Endpoint[1][Channel] = static_cast<uint8>(std::clamp(std::lround((Endpoint1[Channel] - Candidate.PBit[1]) * 0.5f), 0L, 127L));
+			}
+
+			float Palette[16][4];
+			BuildBC7Palette(Candidate, Palette);
+			Candidate.Error = FindNearest(Pixels, 4, Palette, 16, Candidate.Indices);
+			if (Candidate.Error < InOutBest.Error)
+			{
+				InOutBest = Candidate;
+			}
+		}
+	}
+
+	class FBitWriter
+	{
+	public:
+		explicit FBitWriter(uint8* InOut) : Out(InOut) { std::memset(Out, 0, 16); }
+
+		void Write(uint32 Value, int32 NumBits)
+		{
+			for (int32 Bit = 0; Bit < NumBits; ++Bit, ++Position)
+			{
+				if ((Value >> Bit) & 1u)
+				{
+					Out[Position >> 3] |= static_cast<uint8>(1u << (Position & 7));
+				}
+			}
+		}
+
+	private:
+		uint8* Out;
+		int32 Position = 0;
+	};
+
+	class FBitReader
+	{
+	public:
+		explicit FBitReader(const uint8* InData) : Data(InData) {}
+
+		uint32 Read(int32 NumBits)
+		{
+			uint32 Value = 0;
+			for (int32 Bit = 0; Bit < NumBits; ++Bit, ++Position)
+			{
+				Value |= static_cast<uint32>((Data[Position >> 3] >> (Position & 7)) & 1u) << Bit;
+			}
+			return Value;
+		}
+
+	private:
+		const uint8* Data;
+		int32 Position = 0;
+	};
+}
+
+void FBlockCompression::EncodeBC1(const uint8* InPixels, uint8* OutBlock)
+{
+	FBlockSoA Pixels;
+	LoadBlock(InPixels, 3, Pixels);
+
+	float Start[4];
+	float End[4];
+	FBC1Candidate Best;
+	ComputePrincipalEndpoints(Pixels, 3, Start, End);
+	EvaluateBC1(Pixels, End, Start, Best);
+
+	// 고른 색인으로 끝점을 다시 맞춰 본다 (오차가 줄 때만 채택)
+	static const float Weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+	for (int32 Iteration = 0; Iteration < 2 && 0.0f < Best.Error; ++Iteration)
+	{
+		float Endpoint0[4];
+		float Endpoint1[4];
+		if (!SolveEndpoints(Pixels, 3, Best.Indices, Weights, Endpoint0, Endpoint1))
+		{
+			break;
+		}
+		const float PreviousError = Best.Error;
+		EvaluateBC1(Pixels, Endpoint0, Endpoint1, Best);
+		if (PreviousError <= Best.Error)
+		{
+			break;
+		}
+	}
+
+	WriteBC1(Best, OutBlock);
+}
+
+void FBlockCompression::EncodeBC4(const uint8* InValues, int32 Stride, uint8* OutBlock)
+{
+	FBlockSoA Values;
+	uint8 Min = 255;
+	uint8 Max = 0;
+	uint8 InnerMin = 255;		// 0, 255를 뺀 범위 (6단계 모드용)
+	uint8 InnerMax = 0;
+	for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+	{
+		const uint8 Value = InValues[Pixel * Stride];
+		Values.Channel[0][Pixel] = Value;
+		Min = std::min(Min, Value);
+		Max = std::max(Max, Value);
+		if (Value != 0 && Value != 255)
+		{
+			InnerMin = std::min(InnerMin, Value);
+			InnerMax = std::max(InnerMax, Value);
+		}
+	}
+
+	uint8 Indices[16];
+	if (Min == Max)
+	{
+		std::memset(Indices, 0, sizeof(Indices));
+		WriteBC4(Max, Min, Indices, OutBlock);
+		return;
+	}
+
+	// 8단계 (a0 > a1)
+	uint8 BestAlpha0 = Max;
+	uint8 BestAlpha1 = Min;
+	float BestError = EvaluateBC4(Values, Max, Min, Indices);
+
+	// 0이나 255가 섞인 블록은 6단계 모드가 나을 수 있다 (a0 <= a1)
+	if ((Min == 0 || Max == 255) && InnerMin <= InnerMax)
+	{
+		uint8 InnerIndices[16];
+		const float InnerError = EvaluateBC4(Values, InnerMin, InnerMax, InnerIndices);
+		if (InnerError < BestError)
+		{
+			BestError = InnerError;
+			BestAlpha0 = InnerMin;
+			BestAlpha1 = InnerMax;
+			std::memcpy(Indices, InnerIndices, sizeof(Indices));
+		}
+	}
+
+	WriteBC4(BestAlpha0, BestAlpha1, Indices, OutBlock);
+}
+
+void FBlockCompression::EncodeBC3(const uint8* InPixels, uint8* OutBlock)
+{
+	EncodeBC4(InPixels + 3, 4, OutBlock);
+	EncodeBC1(InPixels, OutBlock + 8);
+}
+
+void FBlockCompression::EncodeBC5(const uint8* InPixels, uint8* OutBlock)
+{
+	EncodeBC4(InPixels, 4, OutBlock);
+	EncodeBC4(InPixels + 1, 4, OutBlock + 8);
+}
+
+void FBlockCompression::EncodeBC7(const uint8* InPixels, uint8* OutBlock)
+{
+	FBlockSoA Pixels;
+	LoadBlock(InPixels, 4, Pixels);
+
+	float Start[4];
+	float End[4];
+	FBC7Mode6 Best;
+	ComputePrincipalEndpoints(Pixels, 4, Start, End);
+	EvaluateBC7(Pixels, Start, End, Best);
+
+	float Weights[16];
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		Weights[Index] = 1.0f - BC7Weights4[Index] / 64.0f;
+	}
+	for (int32 Iteration = 0; Iteration < 2 && 0.0f < Best.Error; ++Iteration)
+	{
+		float Endpoint0[4];
+		float Endpoint1[4];
+		if (!SolveEndpoints(Pixels, 4, Best.Indices, Weights, Endpoint0, Endpoint1))
+		{
+			break;
+		}
+		const float PreviousError = Best.Error;
+		EvaluateBC7(Pixels, Endpoint0, Endpoint1, Best);
+		if (PreviousError <= Best.Error)
+		{
+			break;
+		}
+	}
+
+	// 0번 픽셀(앵커)의 색인 최상위 비트는 0이어야 한다 → 끝점을 바꾸고 색인을 뒤집는다
+	if (Best.Indices[0] & 8)
+	{
+		for (int32 Channel = 0; Channel < 4; ++Channel)
+		{
+			std::swap(Best.Endpoint[0][Channel], Best.Endpoint[1][Channel]);
+		}
+		std::swap(Best.PBit[0], Best.PBit[1]);
+		for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+		{
+			Best.Indices[Pixel] = static_cast<uint8>(15 - Best.Indices[Pixel]);
+		}
+	}
+
+	FBitWriter Writer(OutBlock);
+	Writer.Write(1u << 6, 7);
+	for (int32 Channel = 0; Channel < 4; ++Channel)
+	{
+		Writer.Write(Best.Endpoint[0][Channel], 7);
+		Writer.Write(Best.Endpoint[1][Channel], 7);
+	}
+	Writer.Write(Best.PBit[0], 1);
+	Writer.Write(Best.PBit[1], 1);
+	Writer.Write(Best.Indices[0], 3);
+	for (int32 Pixel = 1; Pixel < 16; ++Pixel)
+	{
+		Writer.Write(Best.Indices[Pixel], 4);
+	}
+}
+
+void FBlockCompression::DecodeBC1(const uint8* InBlock, uint8* OutPixels)
+{
+	const uint16 Color0 = static_cast<uint16>(InBlock[0] | (InBlock[1] << 8));
+	const uint16 Color1 = static_cast<uint16>(InBlock[2] | (InBlock[3] << 8));
+	uint32 IndexBits = 0;
+	std::memcpy(&IndexBits, InBlock + 4, 4);
+
+	float Palette[4][4];
+	UnpackRGB565(Color0, Palette[0]);
+	UnpackRGB565(Color1, Palette[1]);
+	for (int32 Channel = 0; Channel < 3; ++Channel)
+	{
+		if (Color1 < Color0)
+		{
+			Palette[2][Channel] = std::round((2.0f * Palette[0][Channel] + Palette[1][Channel]) / 3.0f);
+			Palette[3][Channel] = std::round((Palette[0][Channel] + 2.0f * Palette[1][Channel]) / 3.0f);
+		}
+		else
+		{
+			Palette[2][Channel] = std::round((Palette[0][Channel] + Palette[1][Channel]) * 0.5f);
+			Palette[3][Channel] = 0.0f;
+		}
+	}
+	Palette[2][3] = 255.0f;
+	Palette[3][3] = Color1 < Color0 ? 255.0f : 0.0f;
+
+	for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+	{
+		const float* Color = Palette[(IndexBits >> (Pixel * 2)) & 3];
+		for (int32 Channel = 0; Channel < 4; ++Channel)
+		{
+			OutPixels[Pixel * 4 + Channel] = static_cast<uint8>(Color[Channel]);
+		}
+	}
+}
+
+void FBlockCompression::DecodeBC4(const uint8* InBlock, uint8* OutValues, int32 Stride)
+{
+	float Palette[8][4] = {};
+	BuildBC4Palette(InBlock[0], InBlock[1], Palette);
+
+	uint64 IndexBits = 0;
+	for (int32 Byte = 0; Byte < 6; ++Byte)
+	{
+		IndexBits |= static_cast<uint64>(InBlock[2 + Byte]) << (Byte * 8);
+	}
+	for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+	{
+		OutValues[Pixel * Stride] = static_cast<uint8>(Palette[(IndexBits >> (Pixel * 3)) & 7][0]);
+	}
+}
+
+void FBlockCompression::DecodeBC3(const uint8* InBlock, uint8* OutPixels)
+{
+	DecodeBC1(InBlock + 8, OutPixels);
+	DecodeBC4(InBlock, OutPixels + 3, 4);
+}
+
+void FBlockCompression::DecodeBC5(const uint8* InBlock, uint8* OutPixels)
+{
+	DecodeBC4(InBlock, OutPixels, 4);
+	DecodeBC4(InBlock + 8, OutPixels + 1, 4);
+	for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+	{
+		OutPixels[Pixel * 4 + 2] = 0;
+		OutPixels[Pixel * 4 + 3] = 255;
+	}
+}
+
+bool FBlockCompression::DecodeBC7(const uint8* InBlock, uint8* OutPixels)
+{
+	FBitReader Reader(InBlock);
+	if (Reader.Read(7) != (1u << 6))
+	{
+		return false;
+	}
+
+	FBC7Mode6 Block;
+	for (int32 Channel = 0; Channel < 4; ++Channel)
+	{
+		Block.Endpoint[0][Channel] = static_cast<uint8>(Reader.Read(7));
+		Block.Endpoint[1][Channel] = static_cast<uint8>(Reader.Read(7));
+	}
+	Block.PBit[0] = static_cast<uint8>(Reader.Read(1));
+	Block.PBit[1] = static_cast<uint8>(Reader.Read(1));
+
+	float Palette[16][4];
+	BuildBC7Palette(Block, Palette);
+	for (int32 Pixel = 0; Pixel < 16; ++Pixel)
+	{
+		const uint32 Index = Reader.Read(Pixel == 0 ? 3 : 4);
+		for (int32 Channel = 0; Channel < 4; ++Channel)
+		{
+			OutPixels[Pixel * 4 + Channel] = static_cast<uint8>(Palette[Index][Channel]);
+		}
+	}
+	return true;
+}
@@ -0,0 +1,37 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 4x4 블록 압축 인코더/디코더 (BC1/BC3/BC4/BC5/BC7)
+ * - 입력은 RGBA8 16픽셀 (행 우선, 픽셀당 4바이트). 가장자리 블록은 호출하는 쪽에서 복제해 채운다
+ * - 끝점은 주성분 축(PCA)의 양 끝에서 시작해 최소제곱으로 다듬고, 색인 선택은 SSE2로 4픽셀씩 한다 (없으면 스칼라)
+ * - BC7은 모드 6(단일 서브셋, RGBA 7.7.7.7+p비트, 4비트 색인)만 쓴다. 디코더도 모드 6만 푼다 (품질 측정용)
+ * - 플랫폼 헤더에 의존하지 않는다
+ */
+class FBlockCompression
+{
+public:
+	static constexpr int32 BC1BlockBytes = 8;
+	static constexpr int32 BC4BlockBytes = 8;
+	static constexpr int32 BC3BlockBytes = 16;
+	static constexpr int32 BC5BlockBytes = 16;
+	static constexpr int32 BC7BlockBytes = 16;
+
+	// 불투명 4색 모드만 쓴다 (알파는 무시)
+	static void EncodeBC1(const uint8* InPixels, uint8* OutBlock);
+	// BC1 색 + BC4 알파
+	static void EncodeBC3(const uint8* InPixels, uint8* OutBlock);
+	// 단일 채널 16개 (Stride 간격으로 읽음)
+	static void EncodeBC4(const uint8* InValues, int32 Stride, uint8* OutBlock);
+	// R, G 두 채널을 각각 BC4로 (노멀 맵)
+	static void EncodeBC5(const uint8* InPixels, uint8* OutBlock);
+	static void EncodeBC7(const uint8* InPixels, uint8* OutBlock);
+
+	// 디코드 결과는 RGBA8 16픽셀 (BC4/BC5는 없는 채널을 0, 알파를 255로)
+	static void DecodeBC1(const uint8* InBlock, uint8* OutPixels);
+	static void DecodeBC3(const uint8* InBlock, uint8* OutPixels);
+	static void DecodeBC4(const uint8* InBlock, uint8* OutValues, int32 Stride);
+	static void DecodeBC5(const uint8* InBlock, uint8* OutPixels);
+	// 모드 6이 아니면 false
+	static bool DecodeBC7(const uint8* InBlock, uint8* OutPixels);
+};
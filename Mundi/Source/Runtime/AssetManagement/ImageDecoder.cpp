@@ -0,0 +1,1167 @@
+﻿#include "pch.h"
+#include "ImageDecoder.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+	void SetError(FString* OutError, const char* Message)
+	{
+		if (OutError)
+		{
+			*OutError = Message;
+		}
+	}
+
+	uint32 ReadBE32(const uint8* P)
+	{
+		return (uint32(P[0]) << 24) | (uint32(P[1]) << 16) | (uint32(P[2]) << 8) | uint32(P[3]);
+	}
+
+	uint16 ReadLE16(const uint8* P)
+	{
+		return static_cast<uint16>(P[0] | (P[1] << 8));
+	}
+
+	// ─────────────────────────────────────────────
+	// Inflate (RFC 1951)
+	// ─────────────────────────────────────────────
+
+	constexpr int32 HuffmanFastBits = 10;
+
+	/**
+	 * 정규(canonical) 허프만 테이블
+	 * - 짧은 코드는 Fast 테이블 한 번으로 찾고 (하위 비트부터 읽으므로 코드를 뒤집어 색인), 긴 코드는 길이별 개수로 찾는다
+	 */
+	struct FHuffmanTable
+	{
+		uint16 Count[16] = {};
+		uint16 Symbol[320] = {};
+		uint16 Fast[1 << HuffmanFastBits] = {};		// (심볼 << 4) | 길이, 0이면 느린 경로
+
+		bool Build(const uint8* Lengths, int32 NumSymbols)
+		{
+			std::memset(Count, 0, sizeof(Count));
+			std::memset(Fast, 0, sizeof(Fast));
+			for (int32 Index = 0; Index < NumSymbols; ++Index)
+			{
+				++Count[Lengths[Index]];
+			}
+			Count[0] = 0;
+
+			// 코드 공간을 넘치게 쓰면 잘못된 테이블 (덜 쓰는 것은 허용: 거리 코드가 하나뿐인 경우)
+			int32 Left = 1;
+			for (int32 Length = 1; Length < 16; ++Length)
+			{
+				Left <<= 1;
+				Left -= Count[Length];
+				if (Left < 0)
+				{
+					return false;
+				}
+			}
+
+			uint16 Offsets[16] = {};
+			for (int32 Length = 1; Length < 15; ++Length)
+			{
+				Offsets[Length + 1] = Offsets[Length] + Count[Length];
+			}
+			for (int32 Index = 0; Index < NumSymbols; ++Index)
+			{
+				if (Lengths[Index] != 0)
+				{
+					Symbol[Offsets[Lengths[Index]]++] = static_cast<uint16>(Index);
+				}
+			}
+
+			// 빠른 테이블: 길이 순서대로 정규 코드를 매기며 채운다
+			uint32 Code = 0;
+			int32 SymbolIndex = 0;
+			for (int32 Length = 1; Length < 16; ++Length)
+			{
+				for (int32 Nth = 0; Nth < Count[Length]; ++Nth, ++Code, ++SymbolIndex)
+				{
+					if (HuffmanFastBits < Length)
+					{
+						continue;
+					}
+					uint32 Reversed = 0;
+					for (int32 Bit = 0; Bit < Length; ++Bit)
+					{
+						Reversed |= ((Code >> Bit) & 1u) << (Length - 1 - Bit);
+					}
+					for (uint32 Fill = Reversed; Fill < (1u << HuffmanFastBits); Fill += (1u << Length))
+					{
+						Fast[Fill] = static_cast<uint16>((Symbol[SymbolIndex] << 4) | Length);
+					}
+				}
+				Code <<= 1;
+			}
+			return true;
+		}
+	};
+
+	class FInflater
+	{
+	public:
+		FInflater(const uint8* InData, size_t InSize, TArray<uint8>& InOut)
+			: Data(InData), Size(InSize), Out(InOut)
+		{
+		}
+
+		bool Run()
+		{
+			bool bFinal = false;
+			while (!bFinal)
+			{
+				uint32 Header = 0;
+				if (!GetBits(3, Header))
+				{
+					return false;
+				}
+				bFinal = (Header & 1u) != 0;
+
+				bool bOk = false;
+				switch (Header >> 1)
+				{
+				case 0: bOk = InflateStored(); break;
+				case 1: bOk = InflateFixed(); break;
+				case 2: bOk = InflateDynamic(); break;
+				default: bOk = false; break;
+				}
+				if (!bOk)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	private:
+		void Refill()
+		{
+			while (BitCount <= 56 && Pos < Size)
+			{
+				BitBuffer |= uint64(Data[Pos++]) << BitCount;
+				BitCount += 8;
+			}
+		}
+
+		bool GetBits(int32 NumBits, uint32& OutValue)
+		{
+			if (BitCount < NumBits)
+			{
+				Refill();
+				if (BitCount < NumBits)
+				{
+					return false;
+				}
+			}
+			OutValue = static_cast<uint32>(BitBuffer & ((uint64(1) << NumBits) - 1));
+			BitBuffer >>= NumBits;
+			BitCount -= NumBits;
+			return true;
+		}
+
+		bool Decode(const FHuffmanTable& Table, int32& OutSymbol)
+		{
+			if (BitCount < 16)
+			{
+				Refill();
+			}
+
+			// 끝부분에서는 남은 비트가 모자랄 수 있다 (없는 비트는 0으로 보고, 실제로 쓴 길이만 확인)
+			const uint16 Entry = Table.Fast[BitBuffer & ((1u << HuffmanFastBits) - 1)];
+			if (Entry != 0)
+			{
+				const int32 Length = Entry & 15;
+				if (BitCount < Length)
+				{
+					return false;
+				}
+				BitBuffer >>= Length;
+				BitCount -= Length;
+				OutSymbol = Entry >> 4;
+				return true;
+			}
+
+			// 느린 경로: 한 비트씩 늘리며 길이별 첫 코드와 비교
+			int32 Code = 0;
+			int32 First = 0;
+			int32 Index = 0;
+			for (int32 Length = 1; Length < 16; ++Length)
+			{
+				uint32 Bit = 0;
+				if (!GetBits(1, Bit))
+				{
+					return false;
+				}
+				Code |= static_cast<int32>(Bit);
+				const int32 Count = Table.Count[Length];
+				if (Code - Count < First)
+				{
+					OutSymbol = Table.Symbol[Index + (Code - First)];
+					return true;
+				}
+				Index += Count;
+				First += Count;
+				First <<= 1;
+				Code <<= 1;
+			}
+			return false;
+		}
+
+		bool InflateStored()
+		{
+			// 바이트 경계로 맞춘 뒤 LEN/NLEN
+			const int32 Skip = BitCount & 7;
+			BitBuffer >>= Skip;
+			BitCount -= Skip;
+
+			uint32 Length = 0;
+			uint32 InvLength = 0;
+			if (!GetBits(16, Length) || !GetBits(16, InvLength) || (Length ^ 0xFFFFu) != InvLength)
+			{
+				return false;
+			}
+
+			// 비트 버퍼에 남은 바이트부터 꺼내고 나머지는 그대로 복사
+			while (0 < Length && 8 <= BitCount)
+			{
+				Out.push_back(static_cast<uint8>(BitBuffer & 0xFF));
+				BitBuffer >>= 8;
+				BitCount -= 8;
+				--Length;
+			}
+			if (Size - Pos < Length)
+			{
+				return false;
+			}
+			Out.insert(Out.end(), Data + Pos, Data + Pos + Length);
+			Pos += Length;
+			return true;
+		}
+
+		bool InflateFixed()
+		{
+			static FHuffmanTable LiteralTable;
+			static FHuffmanTable DistanceTable;
+			static const bool bBuilt = []()
+			{
+				uint8 Lengths[288];
+				int32 Index = 0;
+				for (; Index < 144; ++Index) Lengths[Index] = 8;
+				for (; Index < 256; ++Index) Lengths[Index] = 9;
+				for (; Index < 280; ++Index) Lengths[Index] = 7;
+				for (; Index < 288; ++Index) Lengths[Index] = 8;
+				LiteralTable.Build(Lengths, 288);
+
+				uint8 DistanceLengths[30];
+				std::memset(DistanceLengths, 5, sizeof(DistanceLengths));
+				DistanceTable.Build(DistanceLengths, 30);
+				return true;
+			}();
+			(void)bBuilt;
+
+			return InflateCodes(LiteralTable, DistanceTable);
+		}
+
+		bool InflateDynamic()
+		{
+			uint32 NumLiterals = 0;
+			uint32 NumDistances = 0;
+			uint32 NumCodeLengths = 0;
+			if (!GetBits(5, NumLiterals) || !GetBits(5, NumDistances) || !GetBits(4, NumCodeLengths))
+			{
+				return false;
+			}
+			NumLiterals += 257;
+			NumDistances += 1;
+			NumCodeLengths += 4;
+			if (286 < NumLiterals || 30 < NumDistances)
+			{
+				return false;
+			}
+
+			static const uint8 CodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+			uint8 CodeLengthLengths[19] = {};
+			for (uint32 Index = 0; Index < NumCodeLengths; ++Index)
+			{
+				uint32 Value = 0;
+				if (!GetBits(3, Value))
+				{
+					return false;
+				}
+				CodeLengthLengths[CodeLengthOrder[Index]] = static_cast<uint8>(Value);
+			}
+
+			FHuffmanTable CodeLengthTable;
+			if (!CodeLengthTable.Build(CodeLengthLengths, 19))
+			{
+				return false;
+			}
+
+			uint8 Lengths[286 + 30] = {};
+			uint32 Index = 0;
+			while (Index < NumLiterals + NumDistances)
+			{
+				int32 Symbol = 0;
+				if (!Decode(CodeLengthTable, Symbol))
+				{
+					return false;
+				}
+				if (Symbol < 16)
+				{
+					Lengths[Index++] = static_cast<uint8>(Symbol);
+					continue;
+				}
+
+				uint8 Repeat = 0;
+				uint32 RepeatCount = 0;
+				uint32 Extra = 0;
+				if (Symbol == 16)
+				{
+					if (Index == 0 || !GetBits(2, Extra))
+					{
+						return false;
+					}
+					Repeat = Lengths[Index - 1];
+					RepeatCount = 3 + Extra;
+				}
+				else if (Symbol == 17)
+				{
+					if (!GetBits(3, Extra))
+					{
+						return false;
+					}
+					RepeatCount = 3 + Extra;
+				}
+				else
+				{
+					if (!GetBits(7, Extra))
+					{
+						return false;
+					}
+					RepeatCount = 11 + Extra;
+				}
+				if (NumLiterals + NumDistances < Index + RepeatCount)
+				{
+					return false;
+				}
+				std::memset(Lengths + Index, Repeat, RepeatCount);
+				Index += RepeatCount;
+			}
+
+			// 블록 끝(256) 코드가 없으면 잘못된 스트림
+			if (Lengths[256] == 0)
+			{
+				return false;
+			}
+
+			FHuffmanTable LiteralTable;
+			FHuffmanTable DistanceTable;
+			if (!LiteralTable.Build(Lengths, NumLiterals) || !DistanceTable.Build(Lengths + NumLiterals, NumDistances))
+			{
+				return false;
+			}
+			return InflateCodes(LiteralTable, DistanceTable);
+		}
+
+		bool InflateCodes(const FHuffmanTable& LiteralTable, const FHuffmanTable& DistanceTable)
+		{
+			static const uint16 LengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+			static const uint8 LengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+			static const uint16 DistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+			static const uint8 DistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+			for (;;)
+			{
+				int32 Symbol = 0;
+				if (!Decode(LiteralTable, Symbol))
+				{
+					return false;
+				}
+				if (Symbol < 256)
+				{
+					Out.push_back(static_cast<uint8>(Symbol));
+					continue;
+				}
+				if (Symbol == 256)
+				{
+					return true;
+				}
+
+				Symbol -= 257;
+				if (29 <= Symbol)
+				{
+					return false;
+				}
+				uint32 Extra = 0;
+				if (!GetBits(LengthExtra[Symbol], Extra))
+				{
+					return false;
+				}
+				const uint32 Length = LengthBase[Symbol] + Extra;
+
+				int32 DistanceSymbol = 0;
+				if (!Decode(DistanceTable, DistanceSymbol) || 30 <= DistanceSymbol || !GetBits(DistanceExtra[DistanceSymbol], Extra))
+				{
+					return false;
+				}
+				const size_t Distance = DistanceBase[DistanceSymbol] + Extra;
+				if (Out.size() < Distance)
+				{
+					return false;
+				}
+
+				// 겹칠 수 있으므로 한 바이트씩 (Distance < Length면 반복 패턴)
+				size_t From = Out.size() - Distance;
+				for (uint32 Copied = 0; Copied < Length; ++Copied)
+				{
+					Out.push_back(Out[From + Copied]);
+				}
+			}
+		}
+
+	private:
+		const uint8* Data = nullptr;
+		size_t Size = 0;
+		size_t Pos = 0;
+		uint64 BitBuffer = 0;
+		int32 BitCount = 0;
+		TArray<uint8>& Out;
+	};
+
+	// ─────────────────────────────────────────────
+	// PNG
+	// ─────────────────────────────────────────────
+
+	uint8 PaethPredictor(int32 A, int32 B, int32 C)
+	{
+		const int32 P = A + B - C;
+		const int32 PA = std::abs(P - A);
+		const int32 PB = std::abs(P - B);
+		const int32 PC = std::abs(P - C);
+		if (PA <= PB && PA <= PC)
+		{
+			return static_cast<uint8>(A);
+		}
+		return static_cast<uint8>(PB <= PC ? B : C);
+	}
+
+	// 필터가 붙은 줄들(각 줄 앞에 필터 바이트)을 제자리에서 풀어 OutRows에 줄 바이트만 이어 붙인다
+	bool UnfilterRows(const uint8* Filtered, uint32 RowBytes, uint32 NumRows, uint32 BytesPerPixel, TArray<uint8>& OutRows)
+	{
+		OutRows.resize(static_cast<size_t>(RowBytes) * NumRows);
+		const uint8* Previous = nullptr;
+		for (uint32 Row = 0; Row < NumRows; ++Row)
+		{
+			const uint8 FilterType = Filtered[0];
+			const uint8* Source = Filtered + 1;
+			uint8* Dest = OutRows.data() + static_cast<size_t>(Row) * RowBytes;
+			Filtered += RowBytes + 1;
+
+			for (uint32 Index = 0; Index < RowBytes; ++Index)
+			{
+				const int32 Left = BytesPerPixel <= Index ? Dest[Index - BytesPerPixel] : 0;
+				const int32 Up = Previous ? Previous[Index] : 0;
+				const int32 UpLeft = (Previous && BytesPerPixel <= Index) ? Previous[Index - BytesPerPixel] : 0;
+				int32 Predicted = 0;
+				switch (FilterType)
+				{
+				case 0: Predicted = 0; break;
+				case 1: Predicted = Left; break;
+				case 2: Predicted = Up; break;
+				case 3: Predicted = (Left + Up) >> 1; break;
+				case 4: Predicted = PaethPredictor(Left, Up, UpLeft); break;
+				default: return false;
+				}
+				Dest[Index] = static_cast<uint8>(Source[Index] + Predicted);
+			}
+			Previous = Dest;
+		}
+		return true;
+	}
+
+	struct FPngHeader
+	{
+		uint32 Width = 0;
+		uint32 Height = 0;
+		uint8 BitDepth = 0;
+		uint8 ColorType = 0;
+		uint8 Interlace = 0;
+		uint8 Palette[256][4] = {};
+		bool bHasColorKey = false;
+		uint16 ColorKey[3] = {};
+
+		uint32 GetChannels() const
+		{
+			switch (ColorType)
+			{
+			case 0: return 1;
+			case 2: return 3;
+			case 3: return 1;
+			case 4: return 2;
+			case 6: return 4;
+			default: return 0;
+			}
+		}
+		uint32 GetBitsPerPixel() const { return GetChannels() * BitDepth; }
+		uint32 GetRowBytes(uint32 InWidth) const { return (InWidth * GetBitsPerPixel() + 7) / 8; }
+	};
+
+	// 풀린 줄 바이트의 픽셀 하나를 RGBA8로
+	void ReadPngPixel(const FPngHeader& Header, const uint8* Row, uint32 X, uint8* OutRGBA)
+	{
+		auto ReadSample = [&](uint32 SampleIndex) -> uint32
+		{
+			switch (Header.BitDepth)
+			{
+			case 16:
+				return (uint32(Row[SampleIndex * 2]) << 8) | Row[SampleIndex * 2 + 1];
+			case 8:
+				return Row[SampleIndex];
+			default:
+			{
+				const uint32 BitOffset = SampleIndex * Header.BitDepth;
+				const uint32 Shift = 8 - Header.BitDepth - (BitOffset & 7);
+				return (Row[BitOffset >> 3] >> Shift) & ((1u << Header.BitDepth) - 1);
+			}
+			}
+		};
+		// 샘플을 8비트로 (16비트는 상위 바이트, 1/2/4비트는 0~255로 늘림)
+		auto To8 = [&](uint32 Sample) -> uint8
+		{
+			switch (Header.BitDepth)
+			{
+			case 16: return static_cast<uint8>(Sample >> 8);
+			case 8: return static_cast<uint8>(Sample);
+			default: return static_cast<uint8>(Sample * 255 / ((1u << Header.BitDepth) - 1));
+			}
+		};
+
+		const uint32 Channels = Header.GetChannels();
+		switch (Header.ColorType)
+		{
+		case 0:
+		{
+			const uint32 Gray = ReadSample(X);
+			const uint8 Value = To8(Gray);
+			OutRGBA[0] = OutRGBA[1] = OutRGBA[2] = Value;
+			OutRGBA[3] = (Header.bHasColorKey && Gray == Header.ColorKey[0]) ? 0 : 255;
+			break;
+		}
+		case 2:
+		{
+			const uint32 R = ReadSample(X * 3);
+			const uint32 G = ReadSample(X * 3 + 1);
+			const uint32 B = ReadSample(X * 3 + 2);
+			OutRGBA[0] = To8(R);
+			OutRGBA[1] = To8(G);
+			OutRGBA[2] = To8(B);
+			OutRGBA[3] = (Header.bHasColorKey && R == Header.ColorKey[0] && G == Header.ColorKey[1] && B == Header.ColorKey[2]) ? 0 : 255;
+			break;
+		}
+		case 3:
+		{
+			const uint8* Entry = Header.Palette[ReadSample(X) & 0xFF];
+			std::memcpy(OutRGBA, Entry, 4);
+			break;
+		}
+		case 4:
+			OutRGBA[0] = OutRGBA[1] = OutRGBA[2] = To8(ReadSample(X * 2));
+			OutRGBA[3] = To8(ReadSample(X * 2 + 1));
+			break;
+		default:
+			for (uint32 Channel = 0; Channel < Channels; ++Channel)
+			{
+				OutRGBA[Channel] = To8(ReadSample(X * 4 + Channel));
+			}
+			break;
+		}
+	}
+
+	// ─────────────────────────────────────────────
+	// HDR
+	// ─────────────────────────────────────────────
+
+	void RGBEToFloat(const uint8* RGBE, float* OutRGBA)
+	{
+		if (RGBE[3] == 0)
+		{
+			OutRGBA[0] = OutRGBA[1] = OutRGBA[2] = 0.0f;
+		}
+		else
+		{
+			const float Scale = std::ldexp(1.0f, static_cast<int32>(RGBE[3]) - (128 + 8));
+			OutRGBA[0] = RGBE[0] * Scale;
+			OutRGBA[1] = RGBE[1] * Scale;
+			OutRGBA[2] = RGBE[2] * Scale;
+		}
+		OutRGBA[3] = 1.0f;
+	}
+}
+
+bool FImageData::HasAlpha() const
+{
+	if (bFloat)
+	{
+		return false;
+	}
+	for (size_t Index = 3; Index < Pixels.size(); Index += 4)
+	{
+		if (Pixels[Index] != 255)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FImageDecoder::CanDecode(const FString& Extension)
+{
+	FString Lower = Extension;
+	std::transform(Lower.begin(), Lower.end(), Lower.begin(), ::tolower);
+	return Lower == ".png" || Lower == ".tga" || Lower == ".hdr";
+}
+
+bool FImageDecoder::DecodeFile(const FString& InFilePath, FImageData& OutImage, FString* OutError)
+{
+	// UTF-8 경로 (한글 경로 대응)
+	const std::filesystem::path FilePath(reinterpret_cast<const char8_t*>(InFilePath.c_str()));
+	std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+	if (!File)
+	{
+		SetError(OutError, "cannot open file");
+		return false;
+	}
+
+	const std::streamsize FileSize = File.tellg();
+	TArray<uint8> Bytes(static_cast<size_t>(FileSize));
+	File.seekg(0);
+	if (!File.read(reinterpret_cast<char*>(Bytes.data()), FileSize))
+	{
+		SetError(OutError, "cannot read file");
+		return false;
+	}
+
+	return DecodeMemory(Bytes.data(), Bytes.size(), FilePath.extension().string(), OutImage, OutError);
+}
+
+bool FImageDecoder::DecodeMemory(const uint8* Data, size_t Size, const FString& Extension, FImageData& OutImage, FString* OutError)
+{
+	FString Lower = Extension;
+	std::transform(Lower.begin(), Lower.end(), Lower.begin(), ::tolower);
+	if (Lower == ".png")
+	{
+		return DecodePNG(Data, Size, OutImage, OutError);
+	}
+	if (Lower == ".tga")
+	{
+		return DecodeTGA(Data, Size, OutImage, OutError);
+	}
+	if (Lower == ".hdr")
+	{
+		return DecodeHDR(Data, Size, OutImage, OutError);
+	}
+	SetError(OutError, "unsupported format");
+	return false;
+}
+
+bool FImageDecoder::InflateZlib(const uint8* Data, size_t Size, TArray<uint8>& OutData)
+{
+	// CMF/FLG: deflate(8)만, 프리셋 사전 없음. 끝의 Adler-32는 확인하지 않는다
+	if (Size < 2 || (Data[0] & 0x0F) != 8 || ((uint32(Data[0]) << 8) | Data[1]) % 31 != 0 || (Data[1] & 0x20) != 0)
+	{
+		return false;
+	}
+	FInflater Inflater(Data + 2, Size - 2, OutData);
+	return Inflater.Run();
+}
+
+bool FImageDecoder::DecodePNG(const uint8* Data, size_t Size, FImageData& OutImage, FString* OutError)
+{
+	static const uint8 Signature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+	if (Size < 8 || std::memcmp(Data, Signature, 8) != 0)
+	{
+		SetError(OutError, "not a PNG file");
+		return false;
+	}
+
+	FPngHeader Header;
+	TArray<uint8> Compressed;
+	bool bHasHeader = false;
+
+	// 팔레트 기본 알파는 불투명
+	for (uint32 Index = 0; Index < 256; ++Index)
+	{
+		Header.Palette[Index][3] = 255;
+	}
+
+	size_t Pos = 8;
+	while (Pos + 12 <= Size)
+	{
+		const uint32 Length = ReadBE32(Data + Pos);
+		const uint8* Type = Data + Pos + 4;
+		const uint8* Chunk = Data + Pos + 8;
+		if (Size - Pos - 12 < Length)
+		{
+			SetError(OutError, "truncated chunk");
+			return false;
+		}
+
+		if (std::memcmp(Type, "IHDR", 4) == 0 && 13 <= Length)
+		{
+			Header.Width = ReadBE32(Chunk);
+			Header.Height = ReadBE32(Chunk + 4);
+			Header.BitDepth = Chunk[8];
+			Header.ColorType = Chunk[9];
+			Header.Interlace = Chunk[12];
+			bHasHeader = true;
+		}
+		else if (std::memcmp(Type, "PLTE", 4) == 0)
+		{
+			for (uint32 Index = 0; Index < Length / 3 && Index < 256; ++Index)
+			{
+				Header.Palette[Index][0] = Chunk[Index * 3];
+				Header.Palette[Index][1] = Chunk[Index * 3 + 1];
+				Header.Palette[Index][2] = Chunk[Index * 3 + 2];
+			}
+		}
+		else if (std::memcmp(Type, "tRNS", 4) == 0)
+		{
+			if (Header.ColorType == 3)
+			{
+				for (uint32 Index = 0; Index < Length && Index < 256; ++Index)
+				{
+					Header.Palette[Index][3] = Chunk[Index];
+				}
+			}
+			else if (Header.ColorType == 0 && 2 <= Length)
+			{
+				Header.bHasColorKey = true;
+				Header.ColorKey[0] = static_cast<uint16>((Chunk[0] << 8) | Chunk[1]);
+			}
+			else if (Header.ColorType == 2 && 6 <= Length)
+			{
+				Header.bHasColorKey = true;
+				for (uint32 Channel = 0; Channel < 3; ++Channel)
+				{
+					Header.ColorKey[Channel] = static_cast<uint16>((Chunk[Channel * 2] << 8) | Chunk[Channel * 2 + 1]);
+				}
+			}
+		}
+		else if (std::memcmp(Type, "IDAT", 4) == 0)
+		{
+			Compressed.insert(Compressed.end(), Chunk, Chunk + Length);
+		}
+		else if (std::memcmp(Type, "IEND", 4) == 0)
+		{
+			break;
+		}
+		Pos += 12 + Length;
+	}
+
+	const bool bValidDepth = (Header.ColorType == 0 && (Header.BitDepth == 1 || Header.BitDepth == 2 || Header.BitDepth == 4 || Header.BitDepth == 8 || Header.BitDepth == 16))
+		|| (Header.ColorType == 3 && (Header.BitDepth == 1 || Header.BitDepth == 2 || Header.BitDepth == 4 || Header.BitDepth == 8))
+		|| ((Header.ColorType == 2 || Header.ColorType == 4 || Header.ColorType == 6) && (Header.BitDepth == 8 || Header.BitDepth == 16));
+	if (!bHasHeader || Header.Width == 0 || Header.Height == 0 || !bValidDepth || 1 < Header.Interlace)
+	{
+		SetError(OutError, "unsupported PNG header");
+		return false;
+	}
+	if ((1u << 15) < Header.Width || (1u << 15) < Header.Height)
+	{
+		SetError(OutError, "PNG too large");
+		return false;
+	}
+
+	TArray<uint8> Filtered;
+	Filtered.reserve(static_cast<size_t>(Header.GetRowBytes(Header.Width) + 1) * Header.Height);
+	if (!InflateZlib(Compressed.data(), Compressed.size(), Filtered))
+	{
+		SetError(OutError, "corrupt zlib stream");
+		return false;
+	}
+
+	OutImage = FImageData();
+	OutImage.Width = Header.Width;
+	OutImage.Height = Header.Height;
+	OutImage.Pixels.resize(static_cast<size_t>(Header.Width) * Header.Height * 4);
+
+	const uint32 BytesPerPixel = std::max(1u, Header.GetBitsPerPixel() / 8);
+
+	// Adam7: 7개 패스 (시작 X/Y, 간격 X/Y). 인터레이스가 아니면 전체를 한 패스로
+	static const uint32 Adam7[7][4] = { { 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 }, { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 } };
+	static const uint32 NoInterlace[1][4] = { { 0, 0, 1, 1 } };
+	const uint32 (*Passes)[4] = Header.Interlace ? Adam7 : NoInterlace;
+	const uint32 NumPasses = Header.Interlace ? 7 : 1;
+
+	size_t Offset = 0;
+	TArray<uint8> Rows;
+	for (uint32 PassIndex = 0; PassIndex < NumPasses; ++PassIndex)
+	{
+		const uint32* Pass = Passes[PassIndex];
+		const uint32 PassWidth = Header.Width <= Pass[0] ? 0 : (Header.Width - Pass[0] + Pass[2] - 1) / Pass[2];
+		const uint32 PassHeight = Header.Height <= Pass[1] ? 0 : (Header.Height - Pass[1] + Pass[3] - 1) / Pass[3];
+		if (PassWidth == 0 || PassHeight == 0)
+		{
+			continue;
+		}
+
+		const uint32 RowBytes = Header.GetRowBytes(PassWidth);
+		const size_t PassBytes = static_cast<size_t>(RowBytes + 1) * PassHeight;
+		if (Filtered.size() - Offset < PassBytes)
+		{
+			SetError(OutError, "truncated image data");
+			return false;
+		}
+		if (!UnfilterRows(Filtered.data() + Offset, RowBytes, PassHeight, BytesPerPixel, Rows))
+		{
+			SetError(OutError, "invalid filter type");
+			return false;
+		}
+		Offset += PassBytes;
+
+		for (uint32 Y = 0; Y < PassHeight; ++Y)
+		{
+			const uint8* Row = Rows.data() + static_cast<size_t>(Y) * RowBytes;
+			const uint32 DestY = Pass[1] + Y * Pass[3];
+			for (uint32 X = 0; X < PassWidth; ++X)
+			{
+				const uint32 DestX = Pass[0] + X * Pass[2];
+				ReadPngPixel(Header, Row, X, OutImage.Pixels.data() + (static_cast<size_t>(DestY) * Header.Width + DestX) * 4);
+			}
+		}
+	}
+	return true;
+}
+
+bool FImageDecoder::DecodeTGA(const uint8* Data, size_t Size, FImageData& OutImage, FString* OutError)
+{
+	if (Size < 18)
+	{
+		SetError(OutError, "not a TGA file");
+		return false;
+	}
+
+	const uint8 IdLength = Data[0];
+	const uint8 ColorMapType = Data[1];
+	const uint8 ImageType = Data[2];
+	const uint16 ColorMapFirst = ReadLE16(Data + 3);
+	const uint16 ColorMapLength = ReadLE16(Data + 5);
+	const uint8 ColorMapDepth = Data[7];
+	const uint32 Width = ReadLE16(Data + 12);
+	const uint32 Height = ReadLE16(Data + 14);
+	const uint8 PixelDepth = Data[16];
+	const uint8 Descriptor = Data[17];
+
+	const bool bRLE = 8 < ImageType;
+	const uint8 BaseType = bRLE ? ImageType - 8 : ImageType;
+	if ((BaseType != 1 && BaseType != 2 && BaseType != 3) || Width == 0 || Height == 0)
+	{
+		SetError(OutError, "unsupported TGA type");
+		return false;
+	}
+	if ((BaseType == 1 && (PixelDepth != 8 || ColorMapType != 1))
+		|| (BaseType == 2 && PixelDepth != 15 && PixelDepth != 16 && PixelDepth != 24 && PixelDepth != 32)
+		|| (BaseType == 3 && PixelDepth != 8))
+	{
+		SetError(OutError, "unsupported TGA pixel depth");
+		return false;
+	}
+
+	size_t Pos = 18 + IdLength;
+	const uint32 ColorMapEntryBytes = (ColorMapDepth + 7) / 8;
+	const uint8* ColorMap = Data + Pos;
+	if (ColorMapType == 1)
+	{
+		Pos += static_cast<size_t>(ColorMapLength) * ColorMapEntryBytes;
+	}
+	if (Size < Pos)
+	{
+		SetError(OutError, "truncated TGA");
+		return false;
+	}
+
+	// 한 픽셀(파일 바이트)을 RGBA8로
+	auto DecodeColor = [](const uint8* Source, uint32 Bytes, uint8* OutRGBA)
+	{
+		switch (Bytes)
+		{
+		case 1:
+			OutRGBA[0] = OutRGBA[1] = OutRGBA[2] = Source[0];
+			OutRGBA[3] = 255;
+			break;
+		case 2:
+		{
+			// ARRRRRGG GGGBBBBB (리틀 엔디언)
+			const uint16 Value = ReadLE16(Source);
+			OutRGBA[0] = static_cast<uint8>(((Value >> 10) & 31) * 255 / 31);
+			OutRGBA[1] = static_cast<uint8>(((Value >> 5) & 31) * 255 / 31);
+			OutRGBA[2] = static_cast<uint8>((Value & 31) * 255 / 31);
+			OutRGBA[3] = 255;
+			break;
+		}
+		case 3:
+			OutRGBA[0] = Source[2];
+			OutRGBA[1] = Source[1];
+			OutRGBA[2] = Source[0];
+			OutRGBA[3] = 255;
+			break;
+		default:
+			OutRGBA[0] = Source[2];
+			OutRGBA[1] = Source[1];
+			OutRGBA[2] = Source[0];
+			OutRGBA[3] = Source[3];
+			break;
+		}
+	};
+
+	const uint32 PixelBytes = (PixelDepth + 7) / 8;
+
+	// 헤더 크기만 믿고 할당하면 깨진 파일 하나가 수십 GB를 요구하므로, 크기 상한과 남은 데이터로 먼저 거른다
+	// (RLE 패킷 하나는 최소 1 + PixelBytes 바이트로 최대 128 픽셀)
+	if ((1u << 15) < Width || (1u << 15) < Height)
+	{
+		SetError(OutError, "TGA too large");
+		return false;
+	}
+	const uint64 NumHeaderPixels = static_cast<uint64>(Width) * Height;
+	const uint64 RemainingBytes = Size - Pos;
+	if ((!bRLE && RemainingBytes < NumHeaderPixels * PixelBytes) || (bRLE && RemainingBytes * 128 < NumHeaderPixels))
+	{
+		SetError(OutError, "truncated TGA");
+		return false;
+	}
+
+	auto ReadPixel = [&](const uint8* Source, uint8* OutRGBA) -> bool
+	{
+		if (BaseType == 1)
+		{
+			const uint32 Index = Source[0];
+			if (Index < ColorMapFirst || ColorMapFirst + ColorMapLength <= Index)
+			{
+				return false;
+			}
+			DecodeColor(ColorMap + static_cast<size_t>(Index - ColorMapFirst) * ColorMapEntryBytes, ColorMapEntryBytes, OutRGBA);
+			return true;
+		}
+		DecodeColor(Source, PixelBytes, OutRGBA);
+		return true;
+	};
+
+	OutImage = FImageData();
+	OutImage.Width = Width;
+	OutImage.Height = Height;
+	OutImage.Pixels.resize(static_cast<size_t>(Width) * Height * 4);
+
+	// 파일 순서대로 풀고, 원점(기본: 왼쪽 아래)에 맞춰 뒤집는다
+	const size_t NumPixels = static_cast<size_t>(Width) * Height;
+	TArray<uint8> Linear(NumPixels * 4);
+	size_t PixelIndex = 0;
+	while (PixelIndex < NumPixels)
+	{
+		uint32 RunLength = 1;
+		bool bRepeat = false;
+		if (bRLE)
+		{
+			if (Size <= Pos)
+			{
+				SetError(OutError, "truncated TGA");
+				return false;
+			}
+			const uint8 Packet = Data[Pos++];
+			RunLength = (Packet & 0x7F) + 1u;
+			bRepeat = (Packet & 0x80) != 0;
+		}
+
+		for (uint32 Run = 0; Run < RunLength && PixelIndex < NumPixels; ++Run, ++PixelIndex)
+		{
+			if (!bRepeat || Run == 0)
+			{
+				if (Size < Pos + PixelBytes)
+				{
+					SetError(OutError, "truncated TGA");
+					return false;
+				}
+				if (!ReadPixel(Data + Pos, Linear.data() + PixelIndex * 4))
+				{
+					SetError(OutError, "TGA color map index out of range");
+					return false;
+				}
+				Pos += PixelBytes;
+			}
+			else
+			{
+				std::memcpy(Linear.data() + PixelIndex * 4, Linear.data() + (PixelIndex - 1) * 4, 4);
+			}
+		}
+	}
+
+	const bool bTopToBottom = (Descriptor & 0x20) != 0;
+	const bool bRightToLeft = (Descriptor & 0x10) != 0;
+	for (uint32 Y = 0; Y < Height; ++Y)
+	{
+		const uint32 SourceY = bTopToBottom ? Y : Height - 1 - Y;
+		for (uint32 X = 0; X < Width; ++X)
+		{
+			const uint32 SourceX = bRightToLeft ? Width - 1 - X : X;
+			std::memcpy(OutImage.Pixels.data() + (static_cast<size_t>(Y) * Width + X) * 4,
+				Linear.data() + (static_cast<size_t>(SourceY) * Width + SourceX) * 4, 4);
+		}
+	}
+
+	// 15/16비트의 속성 비트와 24비트는 알파가 없다. 32비트 알파가 모두 0이면 알파 미사용으로 본다
+	if (PixelBytes == 4)
+	{
+		bool bAllZero = true;
+		for (size_t Index = 3; Index < OutImage.Pixels.size() && bAllZero; Index += 4)
+		{
+			bAllZero = OutImage.Pixels[Index] == 0;
+		}
+		if (bAllZero)
+		{
+			for (size_t Index = 3; Index < OutImage.Pixels.size(); Index += 4)
+			{
+				OutImage.Pixels[Index] = 255;
+			}
+		}
+	}
+	return true;
+}
+
+bool FImageDecoder::DecodeHDR(const uint8* Data, size_t Size, FImageData& OutImage, FString* OutError)
+{
+	// 헤더: "#?RADIANCE" 또는 "#?RGBE", 빈 줄까지 속성, 그 다음 줄이 해상도 ("-Y H +X W")
+	size_t Pos = 0;
+	auto ReadLine = [&](FString& OutLine) -> bool
+	{
+		OutLine.clear();
+		while (Pos < Size && Data[Pos] != '\n')
+		{
+			OutLine.push_back(static_cast<char>(Data[Pos++]));
+		}
+		if (Size <= Pos)
+		{
+			return false;
+		}
+		++Pos;
+		return true;
+	};
+
+	FString Line;
+	if (!ReadLine(Line) || (Line.rfind("#?RADIANCE", 0) != 0 && Line.rfind("#?RGBE", 0) != 0))
+	{
+		SetError(OutError, "not a Radiance HDR file");
+		return false;
+	}
+	while (ReadLine(Line) && !Line.empty())
+	{
+		if (Line.rfind("FORMAT=", 0) == 0 && Line != "FORMAT=32-bit_rle_rgbe")
+		{
+			SetError(OutError, "unsupported HDR format (only 32-bit_rle_rgbe)");
+			return false;
+		}
+	}
+
+	int32 Width = 0;
+	int32 Height = 0;
+	if (!ReadLine(Line) || std::sscanf(Line.c_str(), "-Y %d +X %d", &Height, &Width) != 2 || Width <= 0 || Height <= 0)
+	{
+		SetError(OutError, "unsupported HDR orientation (only -Y H +X W)");
+		return false;
+	}
+	if ((1 << 15) < Width || (1 << 15) < Height)
+	{
+		SetError(OutError, "HDR too large");
+		return false;
+	}
+
+	// 줄마다 최소 크기 (무압축 W*4, 새 RLE는 헤더 4바이트 + 채널별로 127픽셀당 2바이트) 미만이면 할당 전에 거른다
+	const size_t MinLineBytes = std::min(static_cast<size_t>(Width) * 4, 4 + static_cast<size_t>(4 * 2) * ((Width + 126) / 127));
+	if ((Size - Pos) / MinLineBytes < static_cast<size_t>(Height))
+	{
+		SetError(OutError, "truncated HDR");
+		return false;
+	}
+
+	OutImage = FImageData();
+	OutImage.Width = static_cast<uint32>(Width);
+	OutImage.Height = static_cast<uint32>(Height);
+	OutImage.bFloat = true;
+	OutImage.FloatPixels.resize(static_cast<size_t>(Width) * Height * 4);
+
+	TArray<uint8> Scanline(static_cast<size_t>(Width) * 4);
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		// 새 RLE: 2, 2, 폭 상위, 폭 하위로 시작하고 채널별로 따로 압축
+		const bool bNewRLE = 8 <= Width && Width < 32768 && Pos + 4 <= Size
+			&& Data[Pos] == 2 && Data[Pos + 1] == 2 && ((Data[Pos + 2] << 8) | Data[Pos + 3]) == Width;
+		if (bNewRLE)
+		{
+			Pos += 4;
+			for (int32 Channel = 0; Channel < 4; ++Channel)
+			{
+				int32 X = 0;
+				while (X < Width)
+				{
+					if (Size <= Pos)
+					{
+						SetError(OutError, "truncated HDR");
+						return false;
+					}
+					uint32 Count = Data[Pos++];
+					if (128 < Count)
+					{
+						Count -= 128;
+						if (Size <= Pos || static_cast<uint32>(Width - X) < Count)
+						{
+							SetError(OutError, "corrupt HDR run");
+							return false;
+						}
+						const uint8 Value = Data[Pos++];
+						for (uint32 Run = 0; Run < Count; ++Run)
+						{
+							Scanline[static_cast<size_t>(X++) * 4 + Channel] = Value;
+						}
+					}
+					else
+					{
+						if (Count == 0 || static_cast<uint32>(Width - X) < Count || Size - Pos < Count)
+						{
+							SetError(OutError, "corrupt HDR run");
+							return false;
+						}
+						for (uint32 Run = 0; Run < Count; ++Run)
+						{
+							Scanline[static_cast<size_t>(X++) * 4 + Channel] = Data[Pos++];
+						}
+					}
+				}
+			}
+		}
+		else
+		{
+			// 무압축 줄
+			const size_t LineBytes = static_cast<size_t>(Width) * 4;
+			if (Size - Pos < LineBytes)
+			{
+				SetError(OutError, "truncated HDR");
+				return false;
+			}
+			std::memcpy(Scanline.data(), Data + Pos, LineBytes);
+			Pos += LineBytes;
+		}
+
+		float* Row = OutImage.FloatPixels.data() + static_cast<size_t>(Y) * Width * 4;
+		for (int32 X = 0; X < Width; ++X)
+		{
+			RGBEToFloat(Scanline.data() + static_cast<size_t>(X) * 4, Row + static_cast<size_t>(X) * 4);
+		}
+	}
+	return true;
+}
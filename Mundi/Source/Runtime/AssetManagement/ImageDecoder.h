@@ -0,0 +1,39 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/** 디코드된 이미지 (LDR은 RGBA8, HDR은 RGBA32F. 위쪽 줄부터) */
+struct FImageData
+{
+	uint32 Width = 0;
+	uint32 Height = 0;
+	bool bFloat = false;
+	TArray<uint8> Pixels;			// bFloat == false: Width * Height * 4
+	TArray<float> FloatPixels;		// bFloat == true: Width * Height * 4 (선형)
+
+	bool IsValid() const { return 0 < Width && 0 < Height; }
+	// 알파가 모두 255가 아니면 true (HDR은 항상 false)
+	bool HasAlpha() const;
+};
+
+/**
+ * 플랫폼 API(WIC) 없이 쓰는 이미지 디코더 (텍스처 쿠커 입력용)
+ * - PNG: 모든 색 형식/비트 깊이, 팔레트, tRNS, Adam7 인터레이스. zlib 압축은 직접 푼다
+ * - TGA: 무압축/RLE, 트루컬러/그레이/컬러맵, 8/15/16/24/32비트
+ * - HDR: Radiance RGBE (새 RLE와 무압축 줄)
+ * - 실패하면 false와 함께 OutError에 이유를 남긴다
+ */
+class FImageDecoder
+{
+public:
+	static bool CanDecode(const FString& Extension);
+
+	static bool DecodeFile(const FString& InFilePath, FImageData& OutImage, FString* OutError = nullptr);
+	static bool DecodeMemory(const uint8* Data, size_t Size, const FString& Extension, FImageData& OutImage, FString* OutError = nullptr);
+
+	static bool DecodePNG(const uint8* Data, size_t Size, FImageData& OutImage, FString* OutError = nullptr);
+	static bool DecodeTGA(const uint8* Data, size_t Size, FImageData& OutImage, FString* OutError = nullptr);
+	static bool DecodeHDR(const uint8* Data, size_t Size, FImageData& OutImage, FString* OutError = nullptr);
+
+	// zlib 스트림(헤더 포함)을 풀어 OutData 뒤에 붙인다 (PNG IDAT용)
+	static bool InflateZlib(const uint8* Data, size_t Size, TArray<uint8>& OutData);
+};
@@ -0,0 +1,870 @@
+﻿#include "pch.h"
+#include "MeshCache.h"
+#include "MemoryArchive.h"
+#include "WindowsBinReader.h"
+#include "WindowsBinWriter.h"
+#include "Hash.h"
+#include "PlatformTime.h"
+#include "SkeletalMesh.h"
+#include "Skeleton.h"
+#include "ObjectFactory.h"
+#include "ObjManager.h"
+#include "MeshBVH.h"
+#include "VertexQuantization.h"
+#include <filesystem>
+#include <fstream>
+
+DEFINE_LOG_CATEGORY_STATIC(LogMeshCache, Log)
+
+using namespace MeshCacheFormat;
+
+// 원시 섹션은 메모리 레이아웃을 그대로 쓰므로 레이아웃이 바뀌면 Version을 올려야 한다
+static_assert(sizeof(FNormalVertex) == 64, "FNormalVertex layout changed: bump MeshCacheFormat::Version");
+static_assert(sizeof(FSkinnedVertex) == 80, "FSkinnedVertex layout changed: bump MeshCacheFormat::Version");
+static_assert(sizeof(FMeshBVHNode) == 40, "FMeshBVHNode layout changed: bump MeshCacheFormat::Version");
+static_assert(sizeof(FVertexQuantizationParams) == 40, "FVertexQuantizationParams layout changed: bump MeshCacheFormat::Version");
+static_assert(sizeof(FHeader) == 32 && sizeof(FSectionEntry) == 24, "Mesh cache header layout changed");
+
+namespace
+{
+	constexpr uint32 MaxSections = 64;
+
+	inline uint64 AlignUp(uint64 Value)
+	{
+		return (Value + SectionAlignment - 1) & ~static_cast<uint64>(SectionAlignment - 1);
+	}
+
+	// 한글 경로 지원: UTF-8 → UTF-16
+	inline std::filesystem::path ToFsPath(const FString& InPath)
+	{
+		return std::filesystem::path(UTF8ToWide(InPath));
+	}
+
+	// 메타 섹션의 개수 필드 검사 (손상된 캐시가 거대한 할당을 시도하지 않도록)
+	inline uint32 ReadCount(FArchive& Ar)
+	{
+		uint32 Count;
+		Ar << Count;
+		if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cache corrupt: Count is unreasonable.");
+		}
+		return Count;
+	}
+
+	void WriteGroups(FArchive& Ar, const TArray<FGroupInfo>& Groups)
+	{
+		uint32 Count = static_cast<uint32>(Groups.size());
+		Ar << Count;
+		for (const FGroupInfo& Group : Groups)
+		{
+			Ar << const_cast<FGroupInfo&>(Group);
+		}
+	}
+
+	void ReadGroups(FArchive& Ar, TArray<FGroupInfo>& OutGroups)
+	{
+		OutGroups.resize(ReadCount(Ar));
+		for (FGroupInfo& Group : OutGroups)
+		{
+			Ar << Group;
+		}
+	}
+
+	// LOD 테이블(화면 크기, 인덱스 수, 섹션)을 쓰고 인덱스는 OutLODIndices에 이어 붙인다
+	void WriteLODs(FArchive& Ar, const TArray<FMeshLOD>& LODs, TArray<uint32>& OutLODIndices)
+	{
+		uint32 NumLODs = static_cast<uint32>(LODs.size());
+		Ar << NumLODs;
+		for (const FMeshLOD& LOD : LODs)
+		{
+			float ScreenSize = LOD.ScreenSize;
+			uint32 IndexCount = static_cast<uint32>(LOD.Indices.size());
+			uint32 NumSections = static_cast<uint32>(LOD.Sections.size());
+			Ar << ScreenSize;
+			Ar << IndexCount;
+			Ar << NumSections;
+			for (const FMeshLODSection& Section : LOD.Sections)
+			{
+				uint32 StartIndex = Section.StartIndex;
+				uint32 SectionIndexCount = Section.IndexCount;
+				Ar << StartIndex;
+				Ar << SectionIndexCount;
+			}
+			OutLODIndices.insert(OutLODIndices.end(), LOD.Indices.begin(), LOD.Indices.end());
+		}
+	}
+
+	// LOD 테이블을 읽고 LODIndices 섹션에서 각 LOD 인덱스를 채운다 (섹션이 없거나 크기가 안 맞으면 손상)
+	void ReadLODs(FArchive& Ar, const FMeshCacheReader& Reader, TArray<FMeshLOD>& OutLODs)
+	{
+		OutLODs.resize(ReadCount(Ar));
+		uint64 TotalIndices = 0;
+		for (FMeshLOD& LOD : OutLODs)
+		{
+			uint32 IndexCount;
+			Ar << LOD.ScreenSize;
+			Ar << IndexCount;
+			LOD.Indices.resize(IndexCount);
+			LOD.Sections.resize(ReadCount(Ar));
+			for (FMeshLODSection& Section : LOD.Sections)
+			{
+				Ar << Section.StartIndex;
+				Ar << Section.IndexCount;
+			}
+			TotalIndices += IndexCount;
+		}
+		if (OutLODs.empty())
+		{
+			return;
+		}
+
+		uint32 Count = 0;
+		const uint32* Data = Reader.GetArray<uint32>(ESection::LODIndices, Count);
+		if (!Data || Count != TotalIndices)
+		{
+			throw std::runtime_error("Cache corrupt: LOD indices do not match the LOD table.");
+		}
+		for (FMeshLOD& LOD : OutLODs)
+		{
+			if (!LOD.Indices.empty())
+			{
+				std::memcpy(LOD.Indices.data(), Data, LOD.Indices.size() * sizeof(uint32));
+				Data += LOD.Indices.size();
+			}
+		}
+	}
+
+	// 정점 섹션: 압축 캐시를 켜면 양자화 정점 + 복원 파라미터, 아니면 메모리 레이아웃 그대로
+	// 임포터가 정점을 미리 한 번 왕복시켜 두므로 여기서 다시 양자화해도 값이 바뀌지 않는다
+	void AddVertexSections(FMeshCacheWriter& Writer, const TArray<FNormalVertex>& Vertices)
+	{
+		if (!FVertexQuantizer::IsCacheQuantizationEnabled())
+		{
+			Writer.AddArray(ESection::Vertices, Vertices);
+			return;
+		}
+
+		const FVertexQuantizationParams Params = FVertexQuantizer::ComputeParams(Vertices);
+		TArray<FQuantizedNormalVertex> Quantized;
+		FVertexQuantizer::Quantize(Vertices, Params, Quantized);
+		Writer.AddArray(ESection::QuantizedVertices, Quantized);
+		Writer.AddSection(ESection::QuantizationParams, &Params, sizeof(Params), sizeof(Params));
+	}
+
+	void AddVertexSections(FMeshCacheWriter& Writer, const TArray<FSkinnedVertex>& Vertices)
+	{
+		if (FVertexQuantizer::IsCacheQuantizationEnabled())
+		{
+			const FVertexQuantizationParams Params = FVertexQuantizer::ComputeParams(Vertices);
+			TArray<FQuantizedSkinnedVertex> Quantized;
+			if (FVertexQuantizer::Quantize(Vertices, Params, Quantized))
+			{
+				Writer.AddArray(ESection::QuantizedVertices, Quantized);
+				Writer.AddSection(ESection::QuantizationParams, &Params, sizeof(Params), sizeof(Params));
+				return;
+			}
+		}
+		// Bone 인덱스가 255를 넘으면 압축하지 않는다
+		Writer.AddArray(ESection::Vertices, Vertices);
+	}
+
+	// Vertices 섹션이 없으면 압축 섹션을 복원한다
+	template<typename TQuantized, typename TVertex>
+	bool ReadVertexSections(const FMeshCacheReader& Reader, TArray<TVertex>& OutVertices)
+	{
+		if (Reader.ReadArray(ESection::Vertices, OutVertices))
+		{
+			return true;
+		}
+
+		uint32 NumVertices = 0;
+		uint32 NumParams = 0;
+		const TQuantized* Quantized = Reader.GetArray<TQuantized>(ESection::QuantizedVertices, NumVertices);
+		const FVertexQuantizationParams* Params = Reader.GetArray<FVertexQuantizationParams>(ESection::QuantizationParams, NumParams);
+		if (!Quantized || !Params || NumParams != 1 || !FVertexQuantizer::IsValidParams(*Params))
+		{
+			return false;
+		}
+		FVertexQuantizer::Dequantize(Quantized, NumVertices, *Params, OutVertices);
+		return true;
+	}
+
+	// 인덱스/그룹 범위 검사. 손상된 캐시가 GPU 버퍼나 BVH 빌드까지 흘러가지 않도록 한다
+	bool ValidateTopology(const TArray<uint32>& Indices, uint32 NumVertices, const TArray<FGroupInfo>& Groups)
+	{
+		uint32 MaxIndex = 0;
+		for (uint32 Index : Indices)
+		{
+			MaxIndex = Index > MaxIndex ? Index : MaxIndex;
+		}
+		if (!Indices.empty() && MaxIndex >= NumVertices)
+		{
+			return false;
+		}
+
+		for (const FGroupInfo& Group : Groups)
+		{
+			if (static_cast<uint64>(Group.StartIndex) + Group.IndexCount > Indices.size())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// LOD 섹션은 그룹과 1:1 (그룹이 없으면 섹션 하나)
+	bool ValidateLODs(const TArray<FMeshLOD>& LODs, uint32 NumVertices, const TArray<FGroupInfo>& Groups)
+	{
+		const size_t NumSections = Groups.empty() ? 1 : Groups.size();
+		for (const FMeshLOD& LOD : LODs)
+		{
+			if (LOD.Sections.size() != NumSections)
+			{
+				return false;
+			}
+			for (const FMeshLODSection& Section : LOD.Sections)
+			{
+				if (static_cast<uint64>(Section.StartIndex) + Section.IndexCount > LOD.Indices.size())
+				{
+					return false;
+				}
+			}
+			for (uint32 Index : LOD.Indices)
+			{
+				if (Index >= NumVertices)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// 파일의 OS 캐시 페이지를 버린다 (벤치마크 콜드 로드용, 최선 노력)
+	// 캐시 관리자는 다른 핸들/매핑이 없을 때 FILE_FLAG_NO_BUFFERING 핸들이 열리면 해당 파일의 캐시를 비운다
+	void EvictFromFileCache(const FString& InPath)
+	{
+		HANDLE File = CreateFileW(UTF8ToWide(InPath).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+			nullptr, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+		if (File != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(File);
+		}
+	}
+}
+
+// ───────────────────────────────────────────────
+// FMeshCacheWriter
+// ───────────────────────────────────────────────
+
+void FMeshCacheWriter::AddSection(ESection Id, const void* Data, uint64 Size, uint32 ElementSize)
+{
+	FPendingSection Section;
+	Section.Id = Id;
+	Section.ElementSize = ElementSize;
+	Section.Data.resize(static_cast<size_t>(Size));
+	if (Size > 0)
+	{
+		std::memcpy(Section.Data.data(), Data, static_cast<size_t>(Size));
+	}
+	Sections.Add(std::move(Section));
+}
+
+bool FMeshCacheWriter::Save(const FString& InPath, EAssetType AssetType, uint64 SourceHash) const
+{
+	namespace fs = std::filesystem;
+
+	const uint32 NumSections = static_cast<uint32>(Sections.size());
+
+	// 섹션 배치: 헤더 + 테이블 뒤부터 정렬 단위로 이어 붙인다
+	TArray<FSectionEntry> Table;
+	Table.resize(NumSections);
+	uint64 Offset = AlignUp(sizeof(FHeader) + sizeof(FSectionEntry) * NumSections);
+	for (uint32 i = 0; i < NumSections; ++i)
+	{
+		Table[i].Id = static_cast<uint32>(Sections[i].Id);
+		Table[i].ElementSize = Sections[i].ElementSize;
+		Table[i].Offset = Offset;
+		Table[i].Size = Sections[i].Data.size();
+		Offset = AlignUp(Offset + Table[i].Size);
+	}
+
+	FHeader Header = {};
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.AssetType = static_cast<uint32>(AssetType);
+	Header.NumSections = NumSections;
+	Header.SourceHash = SourceHash;
+	Header.FileSize = Offset;
+
+	TArray<uint8> FileData;
+	FileData.resize(static_cast<size_t>(Header.FileSize), 0);
+	std::memcpy(FileData.data(), &Header, sizeof(Header));
+	if (NumSections > 0)
+	{
+		std::memcpy(FileData.data() + sizeof(Header), Table.data(), sizeof(FSectionEntry) * NumSections);
+	}
+	for (uint32 i = 0; i < NumSections; ++i)
+	{
+		if (Table[i].Size > 0)
+		{
+			std::memcpy(FileData.data() + Table[i].Offset, Sections[i].Data.data(), static_cast<size_t>(Table[i].Size));
+		}
+	}
+
+	// 임시 파일에 쓰고 교체 (쓰는 도중 종료되어도 반쯤 쓰인 캐시가 남지 않는다)
+	const fs::path FinalPath = ToFsPath(InPath);
+	fs::path TempPath = FinalPath;
+	TempPath += L".tmp";
+	{
+		std::ofstream Out(TempPath, std::ios::binary | std::ios::trunc);
+		if (!Out.is_open())
+		{
+			UE_LOG_CAT(LogMeshCache, Error, "Failed to open cache file for writing: %s", InPath.c_str());
+			return false;
+		}
+		Out.write(reinterpret_cast<const char*>(FileData.data()), static_cast<std::streamsize>(FileData.size()));
+		if (!Out.good())
+		{
+			UE_LOG_CAT(LogMeshCache, Error, "Failed to write cache file: %s", InPath.c_str());
+			Out.close();
+			std::error_code Ignored;
+			fs::remove(TempPath, Ignored);
+			return false;
+		}
+	}
+
+	std::error_code Error;
+	fs::rename(TempPath, FinalPath, Error);
+	if (Error)
+	{
+		std::error_code Ignored;
+		fs::remove(TempPath, Ignored);
+		UE_LOG_CAT(LogMeshCache, Error, "Failed to replace cache file %s: %s", InPath.c_str(), Error.message().c_str());
+		return false;
+	}
+	return true;
+}
+
+// ───────────────────────────────────────────────
+// FMeshCacheReader
+// ───────────────────────────────────────────────
+
+bool FMeshCacheReader::Open(const FString& InPath, EAssetType AssetType, const uint64* ExpectedSourceHash)
+{
+	Close();
+
+	if (!File.Open(UTF8ToWide(InPath)))
+	{
+		return false;
+	}
+
+	const uint8* Data = File.GetData();
+	const uint64 Size = File.GetSize();
+	// 오래된 캐시(포맷/원본 변경)는 정상 경로, 구조가 깨진 캐시는 경고
+	auto Reject = [&](const char* Reason, bool bCorrupt)
+		{
+			if (bCorrupt)
+			{
+				UE_LOG_CAT(LogMeshCache, Warning, "Rejecting corrupt mesh cache %s: %s", InPath.c_str(), Reason);
+			}
+			else
+			{
+				UE_LOG_CAT(LogMeshCache, Log, "Mesh cache %s is stale: %s", InPath.c_str(), Reason);
+			}
+			Close();
+			return false;
+		};
+
+	if (Size < sizeof(FHeader))
+	{
+		return Reject("file too small", true);
+	}
+
+	const FHeader* FileHeader = reinterpret_cast<const FHeader*>(Data);
+	if (FileHeader->Magic != Magic)
+	{
+		// 이전 FWindowsBinWriter 포맷 캐시도 여기서 걸러져 재생성된다
+		return Reject("unknown format", false);
+	}
+	if (FileHeader->Version != Version)
+	{
+		return Reject("format version changed", false);
+	}
+	if (FileHeader->AssetType != static_cast<uint32>(AssetType))
+	{
+		return Reject("asset type mismatch", true);
+	}
+	if (FileHeader->FileSize != Size)
+	{
+		return Reject("truncated", true);
+	}
+	if (ExpectedSourceHash && FileHeader->SourceHash != *ExpectedSourceHash)
+	{
+		return Reject("source changed", false);
+	}
+	if (FileHeader->NumSections > MaxSections || sizeof(FHeader) + sizeof(FSectionEntry) * FileHeader->NumSections > Size)
+	{
+		return Reject("bad section table", true);
+	}
+
+	const FSectionEntry* Table = reinterpret_cast<const FSectionEntry*>(Data + sizeof(FHeader));
+	for (uint32 i = 0; i < FileHeader->NumSections; ++i)
+	{
+		const FSectionEntry& Entry = Table[i];
+		if (Entry.Offset % SectionAlignment != 0 || Entry.Offset > Size || Entry.Size > Size - Entry.Offset)
+		{
+			return Reject("section out of range", true);
+		}
+		if (Entry.ElementSize != 0 && Entry.Size % Entry.ElementSize != 0)
+		{
+			return Reject("section size mismatch", true);
+		}
+	}
+
+	Header = FileHeader;
+	SectionTable = Table;
+	return true;
+}
+
+void FMeshCacheReader::Close()
+{
+	File.Close();
+	Header = nullptr;
+	SectionTable = nullptr;
+}
+
+bool FMeshCacheReader::FindSection(ESection Id, const uint8*& OutData, uint64& OutSize, uint32& OutElementSize) const
+{
+	if (!Header)
+	{
+		return false;
+	}
+
+	for (uint32 i = 0; i < Header->NumSections; ++i)
+	{
+		if (SectionTable[i].Id == static_cast<uint32>(Id))
+		{
+			OutData = File.GetData() + SectionTable[i].Offset;
+			OutSize = SectionTable[i].Size;
+			OutElementSize = SectionTable[i].ElementSize;
+			return true;
+		}
+	}
+	return false;
+}
+
+// ───────────────────────────────────────────────
+// FMeshCache
+// ───────────────────────────────────────────────
+
+bool FMeshCache::ComputeSourceHash(const FString& SourcePath, const TArray<FString>& Dependencies, uint32 ImporterVersion, uint64& OutHash)
+{
+	uint64 Hash = HashCombine(Version, ImporterVersion);
+
+	FMappedFile Source;
+	if (!Source.Open(UTF8ToWide(SourcePath)))
+	{
+		return false;
+	}
+	Hash = HashBytes(Source.GetData(), Source.GetSize(), Hash);
+	Source.Close();
+
+	for (const FString& Dependency : Dependencies)
+	{
+		// 없는 의존 파일도 해시에 반영 (나중에 생기면 캐시가 무효화되도록 경로를 섞는다)
+		FMappedFile File;
+		if (File.Open(UTF8ToWide(Dependency)))
+		{
+			Hash = HashBytes(File.GetData(), File.GetSize(), Hash);
+		}
+		else
+		{
+			Hash = HashBytes(Dependency.data(), Dependency.size(), ~Hash);
+		}
+	}
+
+	OutHash = Hash;
+	return true;
+}
+
+bool FMeshCache::SaveStaticMesh(const FString& CachePath, uint64 SourceHash, const FStaticMesh& Mesh, const TArray<FMaterialInfo>* MaterialInfos, const FMeshBVH* BVH)
+{
+	TArray<uint8> Meta;
+	FMemoryWriter Ar(Meta);
+	Serialization::WriteString(Ar, Mesh.PathFileName);
+	uint8 bHasMaterial = Mesh.bHasMaterial ? 1 : 0;
+	Ar << bHasMaterial;
+	WriteGroups(Ar, Mesh.GroupInfos);
+
+	uint32 NumMaterials = MaterialInfos ? static_cast<uint32>(MaterialInfos->size()) : 0;
+	Ar << NumMaterials;
+	for (uint32 i = 0; i < NumMaterials; ++i)
+	{
+		Ar << const_cast<FMaterialInfo&>((*MaterialInfos)[i]);
+	}
+
+	uint64 GeometryHash = Mesh.GeometryHash;
+	Ar << GeometryHash;
+
+	TArray<uint32> LODIndices;
+	WriteLODs(Ar, Mesh.LODs, LODIndices);
+
+	FMeshCacheWriter Writer;
+	AddVertexSections(Writer, Mesh.Vertices);
+	Writer.AddArray(ESection::Indices, Mesh.Indices);
+	Writer.AddSection(ESection::Meta, Meta.data(), Meta.size(), 0);
+	if (!LODIndices.empty())
+	{
+		Writer.AddArray(ESection::LODIndices, LODIndices);
+	}
+	if (BVH && !BVH->IsEmpty())
+	{
+		Writer.AddArray(ESection::BVHNodes, BVH->GetNodes());
+		Writer.AddArray(ESection::BVHTriIndices, BVH->GetTriIndices());
+	}
+	return Writer.Save(CachePath, EAssetType::StaticMesh, SourceHash);
+}
+
+static bool TryLoadStaticMesh(const FString& CachePath, const uint64* ExpectedSourceHash, FStaticMesh& OutMesh, TArray<FMaterialInfo>* OutMaterialInfos, FMeshBVH* OutBVH)
+{
+	FMeshCacheReader Reader;
+	if (!Reader.Open(CachePath, EAssetType::StaticMesh, ExpectedSourceHash))
+	{
+		return false;
+	}
+
+	const uint8* MetaData;
+	uint64 MetaSize;
+	uint32 MetaElementSize;
+	if (!ReadVertexSections<FQuantizedNormalVertex>(Reader, OutMesh.Vertices) ||
+		!Reader.ReadArray(ESection::Indices, OutMesh.Indices) ||
+		!Reader.FindSection(ESection::Meta, MetaData, MetaSize, MetaElementSize))
+	{
+		UE_LOG_CAT(LogMeshCache, Warning, "Mesh cache %s is missing sections", CachePath.c_str());
+		return false;
+	}
+
+	try
+	{
+		FMemoryReader Ar(MetaData, MetaSize);
+		Serialization::ReadString(Ar, OutMesh.PathFileName);
+		uint8 bHasMaterial;
+		Ar << bHasMaterial;
+		OutMesh.bHasMaterial = bHasMaterial != 0;
+		ReadGroups(Ar, OutMesh.GroupInfos);
+
+		const uint32 NumMaterials = ReadCount(Ar);
+		if (OutMaterialInfos)
+		{
+			OutMaterialInfos->resize(NumMaterials);
+			for (FMaterialInfo& Info : *OutMaterialInfos)
+			{
+				Ar << Info;
+			}
+		}
+		else
+		{
+			FMaterialInfo Skipped;
+			for (uint32 i = 0; i < NumMaterials; ++i)
+			{
+				Ar << Skipped;
+			}
+		}
+
+		Ar << OutMesh.GeometryHash;
+		ReadLODs(Ar, Reader, OutMesh.LODs);
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG_CAT(LogMeshCache, Warning, "Mesh cache %s is corrupt: %s", CachePath.c_str(), e.what());
+		return false;
+	}
+
+	if (!ValidateTopology(OutMesh.Indices, static_cast<uint32>(OutMesh.Vertices.size()), OutMesh.GroupInfos) ||
+		!ValidateLODs(OutMesh.LODs, static_cast<uint32>(OutMesh.Vertices.size()), OutMesh.GroupInfos))
+	{
+		UE_LOG_CAT(LogMeshCache, Warning, "Mesh cache %s has out of range indices", CachePath.c_str());
+		return false;
+	}
+
+	// BVH는 선택 섹션이다. 없으면 나중에 구우면 되고, 잘못됐으면 버리고 메시만 쓴다
+	if (OutBVH)
+	{
+		TArray<FMeshBVHNode> Nodes;
+		TArray<uint32> TriIndices;
+		if (Reader.ReadArray(ESection::BVHNodes, Nodes) && Reader.ReadArray(ESection::BVHTriIndices, TriIndices))
+		{
+			const uint32 NumTriangles = static_cast<uint32>(OutMesh.Indices.size() / 3);
+			if (!OutBVH->Load(std::move(Nodes), std::move(TriIndices), NumTriangles))
+			{
+				UE_LOG_CAT(LogMeshCache, Warning, "Mesh cache %s has an invalid BVH, it will be rebuilt", CachePath.c_str());
+			}
+		}
+	}
+
+	OutMesh.CacheFilePath = CachePath;
+	return true;
+}
+
+bool FMeshCache::LoadStaticMesh(const FString& CachePath, const uint64* ExpectedSourceHash, FStaticMesh& OutMesh, TArray<FMaterialInfo>* OutMaterialInfos, FMeshBVH* OutBVH)
+{
+	if (TryLoadStaticMesh(CachePath, ExpectedSourceHash, OutMesh, OutMaterialInfos, OutBVH))
+	{
+		return true;
+	}
+
+	// 중간에 실패했으면 채우던 내용을 비워서 임포트 경로가 빈 상태에서 시작하게 한다
+	OutMesh = FStaticMesh();
+	if (OutMaterialInfos)
+	{
+		OutMaterialInfos->clear();
+	}
+	return false;
+}
+
+bool FMeshCache::SaveSkeletalMesh(const FString& CachePath, uint64 SourceHash, const FSkeletalMesh& Mesh)
+{
+	TArray<uint8> Meta;
+	FMemoryWriter Ar(Meta);
+
+	uint32 NumMaterials = static_cast<uint32>(Mesh.MaterialNames.size());
+	Ar << NumMaterials;
+	for (const FString& MaterialName : Mesh.MaterialNames)
+	{
+		Serialization::WriteString(Ar, MaterialName);
+	}
+	WriteGroups(Ar, Mesh.GroupInfos);
+
+	uint32 NumBones = Mesh.Skeleton ? static_cast<uint32>(Mesh.Skeleton->GetBoneCount()) : 0;
+	Ar << NumBones;
+	for (uint32 i = 0; i < NumBones; ++i)
+	{
+		FBoneInfo Bone = Mesh.Skeleton->GetBone(static_cast<int32>(i));
+		Serialization::WriteString(Ar, Bone.Name);
+		Ar << Bone.ParentIndex;
+		Ar.Serialize(&Bone.BindPoseRelativeTransform, sizeof(FTransform));
+		Ar.Serialize(&Bone.GlobalBindPoseMatrix, sizeof(FMatrix));
+		Ar.Serialize(&Bone.InverseBindPoseMatrix, sizeof(FMatrix));
+	}
+
+	TArray<uint32> LODIndices;
+	WriteLODs(Ar, Mesh.LODs, LODIndices);
+
+	FMeshCacheWriter Writer;
+	AddVertexSections(Writer, Mesh.Vertices);
+	Writer.AddArray(ESection::Indices, Mesh.Indices);
+	Writer.AddSection(ESection::Meta, Meta.data(), Meta.size(), 0);
+	if (!LODIndices.empty())
+	{
+		Writer.AddArray(ESection::LODIndices, LODIndices);
+	}
+	return Writer.Save(CachePath, EAssetType::SkeletalMesh, SourceHash);
+}
+
+static bool TryLoadSkeletalMesh(const FString& CachePath, const uint64* ExpectedSourceHash, FSkeletalMesh& OutMesh)
+{
+	FMeshCacheReader Reader;
+	if (!Reader.Open(CachePath, EAssetType::SkeletalMesh, ExpectedSourceHash))
+	{
+		return false;
+	}
+
+	const uint8* MetaData;
+	uint64 MetaSize;
+	uint32 MetaElementSize;
+	if (!ReadVertexSections<FQuantizedSkinnedVertex>(Reader, OutMesh.Vertices) ||
+		!Reader.ReadArray(ESection::Indices, OutMesh.Indices) ||
+		!Reader.FindSection(ESection::Meta, MetaData, MetaSize, MetaElementSize))
+	{
+		UE_LOG_CAT(LogMeshCache, Warning, "Mesh cache %s is missing sections", CachePath.c_str());
+		return false;
+	}
+
+	// 본은 전부 읽고 검사한 뒤에 USkeleton을 만든다 (실패 시 만들다 만 객체가 남지 않도록)
+	TArray<FBoneInfo> Bones;
+	try
+	{
+		FMemoryReader Ar(MetaData, MetaSize);
+		OutMesh.MaterialNames.resize(ReadCount(Ar));
+		for (FString& MaterialName : OutMesh.MaterialNames)
+		{
+			Serialization::ReadString(Ar, MaterialName);
+		}
+		ReadGroups(Ar, OutMesh.GroupInfos);
+
+		Bones.resize(ReadCount(Ar));
+		for (int32 i = 0; i < static_cast<int32>(Bones.size()); ++i)
+		{
+			FBoneInfo& Bone = Bones[i];
+			Serialization::ReadString(Ar, Bone.Name);
+			Ar << Bone.ParentIndex;
+			Ar.Serialize(&Bone.BindPoseRelativeTransform, sizeof(FTransform));
+			Ar.Serialize(&Bone.GlobalBindPoseMatrix, sizeof(FMatrix));
+			Ar.Serialize(&Bone.InverseBindPoseMatrix, sizeof(FMatrix));
+			if (Bone.ParentIndex < -1 || Bone.ParentIndex >= i)
+			{
+				throw std::runtime_error("Cache corrupt: Bone parent index is out of range.");
+			}
+		}
+
+		ReadLODs(Ar, Reader, OutMesh.LODs);
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG_CAT(LogMeshCache, Warning, "Mesh cache %s is corrupt: %s", CachePath.c_str(), e.what());
+		return false;
+	}
+
+	if (!ValidateTopology(OutMesh.Indices, static_cast<uint32>(OutMesh.Vertices.size()), OutMesh.GroupInfos) ||
+		!ValidateLODs(OutMesh.LODs, static_cast<uint32>(OutMesh.Vertices.size()), OutMesh.GroupInfos))
+	{
+		UE_LOG_CAT(LogMeshCache, Warning, "Mesh cache %s has out of range indices", CachePath.c_str());
+		return false;
+	}
+
+	if (!Bones.empty())
+	{
+		OutMesh.Skeleton = ObjectFactory::NewObject<USkeleton>();
+		for (const FBoneInfo& Bone : Bones)
+		{
+			int32 BoneIndex = OutMesh.Skeleton->AddBone(Bone.Name, Bone.ParentIndex);
+			OutMesh.Skeleton->SetBindPoseTransform(BoneIndex, Bone.BindPoseRelativeTransform);
+			OutMesh.Skeleton->SetGlobalBindPoseMatrix(BoneIndex, Bone.GlobalBindPoseMatrix);
+			OutMesh.Skeleton->SetInverseBindPoseMatrix(BoneIndex, Bone.InverseBindPoseMatrix);
+		}
+	}
+
+	OutMesh.CacheFilePath = CachePath;
+	return true;
+}
+
+bool FMeshCache::LoadSkeletalMesh(const FString& CachePath, const uint64* ExpectedSourceHash, FSkeletalMesh& OutMesh)
+{
+	if (TryLoadSkeletalMesh(CachePath, ExpectedSourceHash, OutMesh))
+	{
+		return true;
+	}
+
+	OutMesh = FSkeletalMesh();
+	return false;
+}
+
+void FMeshCache::RunBenchmark(const FString& ObjPath, int32 NumIterations)
+{
+	namespace fs = std::filesystem;
+
+	NumIterations = NumIterations < 1 ? 1 : NumIterations;
+
+	// 1. 원본 임포트 (캐시 없음)
+	uint64 Start = FPlatformTime::Cycles64();
+	FObjInfo ObjInfo;
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh Mesh;
+	if (!FObjImporter::LoadObjModel(ObjPath, &ObjInfo, MaterialInfos, true))
+	{
+		UE_LOG("[MeshCache] Failed to load '%s'", ObjPath.c_str());
+		return;
+	}
+	FObjImporter::ConvertToStaticMesh(ObjInfo, MaterialInfos, &Mesh);
+	const double ImportMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	// 압축 캐시는 양자화된 정점을 저장하므로 비교 기준도 임포트 경로처럼 한 번 왕복시킨다
+	if (FVertexQuantizer::IsCacheQuantizationEnabled())
+	{
+		FVertexQuantizer::RoundTrip(Mesh.Vertices);
+	}
+
+	const fs::path BenchDir("Saved/Bench");
+	fs::create_directories(BenchDir);
+	const FString LegacyPath = (BenchDir / "MeshCache_Legacy.bin").string();
+	const FString LegacyMatPath = (BenchDir / "MeshCache_Legacy.mat.bin").string();
+	const FString CachePath = (BenchDir / "MeshCache.bin").string();
+
+	// 2. 원본 해시 (캐시 유효성 검사 비용)
+	uint64 SourceHash = 0;
+	double HashMs = 1e30;
+	for (int32 i = 0; i < NumIterations; ++i)
+	{
+		Start = FPlatformTime::Cycles64();
+		FMeshCache::ComputeSourceHash(ObjPath, {}, 0, SourceHash);
+		HashMs = std::min(HashMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+	}
+
+	// 3. 기존 포맷 (FWindowsBinWriter, 원소별 직렬화)
+	{
+		FWindowsBinWriter Writer(LegacyPath);
+		Writer << Mesh;
+		Writer.Close();
+		FWindowsBinWriter MatWriter(LegacyMatPath);
+		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
+		MatWriter.Close();
+	}
+	FMeshCache::SaveStaticMesh(CachePath, SourceHash, Mesh, &MaterialInfos);
+
+	auto LoadLegacy = [&]()
+		{
+			FStaticMesh Loaded;
+			TArray<FMaterialInfo> LoadedMaterials;
+			FWindowsBinReader Reader(LegacyPath);
+			Reader << Loaded;
+			FWindowsBinReader MatReader(LegacyMatPath);
+			Serialization::ReadArray<FMaterialInfo>(MatReader, LoadedMaterials);
+			return Loaded.Vertices.size() == Mesh.Vertices.size();
+		};
+
+	bool bMatch = true;
+	auto LoadMapped = [&]()
+		{
+			FStaticMesh Loaded;
+			TArray<FMaterialInfo> LoadedMaterials;
+			const bool bLoaded = FMeshCache::LoadStaticMesh(CachePath, &SourceHash, Loaded, &LoadedMaterials);
+			bMatch = bMatch && bLoaded &&
+				Loaded.Vertices.size() == Mesh.Vertices.size() &&
+				std::memcmp(Loaded.Vertices.data(), Mesh.Vertices.data(), Mesh.Vertices.size() * sizeof(FNormalVertex)) == 0 &&
+				Loaded.Indices == Mesh.Indices &&
+				Loaded.GroupInfos.size() == Mesh.GroupInfos.size() &&
+				LoadedMaterials.size() == MaterialInfos.size();
+			return bLoaded;
+		};
+
+	// 콜드: 매 반복 전에 OS 파일 캐시에서 내린다. 웜: 페이지 캐시에 있는 상태
+	auto Measure = [&](auto&& Load, const FString& Path, const FString* ExtraPath, bool bCold)
+		{
+			double Best = 1e30;
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				if (bCold)
+				{
+					EvictFromFileCache(Path);
+					if (ExtraPath)
+					{
+						EvictFromFileCache(*ExtraPath);
+					}
+				}
+				const uint64 IterStart = FPlatformTime::Cycles64();
+				Load();
+				Best = std::min(Best, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - IterStart));
+			}
+			return Best;
+		};
+
+	const double LegacyColdMs = Measure(LoadLegacy, LegacyPath, &LegacyMatPath, true);
+	const double LegacyWarmMs = Measure(LoadLegacy, LegacyPath, &LegacyMatPath, false);
+	const double MappedColdMs = Measure(LoadMapped, CachePath, nullptr, true);
+	const double MappedWarmMs = Measure(LoadMapped, CachePath, nullptr, false);
+
+	std::error_code Ignored;
+	const double LegacyMB = static_cast<double>(fs::file_size(LegacyPath, Ignored) + fs::file_size(LegacyMatPath, Ignored)) / (1024.0 * 1024.0);
+	const double MappedMB = static_cast<double>(fs::file_size(CachePath, Ignored)) / (1024.0 * 1024.0);
+
+	UE_LOG("[MeshCache] '%s': %zu vertices, %zu indices, %zu groups, best of %d",
+		ObjPath.c_str(), Mesh.Vertices.size(), Mesh.Indices.size(), Mesh.GroupInfos.size(), NumIterations);
+	UE_LOG("[MeshCache] Import (no cache)     : %8.2f ms", ImportMs);
+	UE_LOG("[MeshCache] Source hash           : %8.2f ms", HashMs);
+	UE_LOG("[MeshCache] Legacy bin  (%.2f MB) : cold %8.2f ms, warm %8.2f ms", LegacyMB, LegacyColdMs, LegacyWarmMs);
+	UE_LOG("[MeshCache] Mapped cache(%.2f MB) : cold %8.2f ms, warm %8.2f ms (%s, warm %.1fx faster)",
+		MappedMB, MappedColdMs, MappedWarmMs, bMatch ? "match" : "MISMATCH",
+		MappedWarmMs > 0.0 ? LegacyWarmMs / MappedWarmMs : 0.0);
+	UE_LOG("[MeshCache] Warm load incl. hash  : %8.2f ms vs import %.2f ms", MappedWarmMs + HashMs, ImportMs);
+}
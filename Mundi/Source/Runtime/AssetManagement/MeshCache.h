@@ -0,0 +1,159 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "MappedFile.h"
+
+struct FStaticMesh;
+struct FSkeletalMesh;
+struct FMaterialInfo;
+class FMeshBVH;
+
+// DerivedDataCache 메시 캐시(.obj.bin / .fbx.bin) 레이아웃 (리틀 엔디언)
+// 헤더 + 섹션 테이블 + 섹션 데이터. 섹션 시작은 SectionAlignment 정렬이라 매핑된 포인터를 그대로 배열로 쓸 수 있다
+namespace MeshCacheFormat
+{
+	constexpr uint32 Magic = 0x4344444D;			// 'MDDC'
+	constexpr uint32 Version = 4;					// 섹션 구성이나 정점 레이아웃이 바뀌면 올린다
+	constexpr uint32 SectionAlignment = 16;
+
+	enum class EAssetType : uint32
+	{
+		StaticMesh = 0,
+		SkeletalMesh = 1,
+	};
+
+	enum class ESection : uint32
+	{
+		Vertices = 0,		// FNormalVertex[] / FSkinnedVertex[] (메모리 레이아웃 그대로, 압축 캐시면 없음)
+		Indices = 1,		// uint32[]
+		Meta = 2,			// 경로, 그룹, 머티리얼, 본 등 문자열이 섞인 작은 데이터 (FArchive 직렬화)
+		BVHNodes = 3,		// FMeshBVHNode[] (스태틱 메시, 선택)
+		BVHTriIndices = 4,	// uint32[] BVH 삼각형 순서 (스태틱 메시, 선택)
+		LODIndices = 5,		// uint32[] LOD1부터 모든 LOD 인덱스를 이어 붙인 것 (LOD 테이블은 Meta 끝, 선택)
+		QuantizedVertices = 6,	// FQuantizedNormalVertex[] / FQuantizedSkinnedVertex[] (editor.ini MeshCacheQuantize, Vertices 대신)
+		QuantizationParams = 7,	// FVertexQuantizationParams 하나 (QuantizedVertices 복원용)
+	};
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 AssetType;							// EAssetType
+		uint32 NumSections;
+		uint64 SourceHash;							// 원본/의존 파일 내용 + 임포터 버전 해시
+		uint64 FileSize;							// 잘린 파일 검출용
+	};
+
+	struct FSectionEntry
+	{
+		uint32 Id;									// ESection
+		uint32 ElementSize;							// 원시 배열 섹션의 원소 크기 (직렬화 섹션은 0)
+		uint64 Offset;
+		uint64 Size;
+	};
+}
+
+/**
+ * 캐시 파일 쓰기
+ * - 섹션을 메모리에 모은 뒤 Save에서 임시 파일에 한 번에 쓰고 교체한다 (중간에 실패해도 기존 캐시가 깨지지 않음)
+ */
+class FMeshCacheWriter
+{
+public:
+	void AddSection(MeshCacheFormat::ESection Id, const void* Data, uint64 Size, uint32 ElementSize);
+
+	template<typename T>
+	void AddArray(MeshCacheFormat::ESection Id, const TArray<T>& Array)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Raw cache sections must be trivially copyable");
+		AddSection(Id, Array.data(), static_cast<uint64>(Array.size()) * sizeof(T), sizeof(T));
+	}
+
+	bool Save(const FString& InPath, MeshCacheFormat::EAssetType AssetType, uint64 SourceHash) const;
+
+private:
+	struct FPendingSection
+	{
+		MeshCacheFormat::ESection Id;
+		uint32 ElementSize;
+		TArray<uint8> Data;
+	};
+	TArray<FPendingSection> Sections;
+};
+
+/**
+ * 캐시 파일 읽기 (FMappedFile)
+ * - Open에서 헤더/섹션 테이블/범위/정렬을 모두 검사하므로 이후 섹션 포인터는 검사 없이 써도 된다
+ * - GetArray는 매핑된 메모리를 그대로 가리킨다 (Reader가 열려 있는 동안만 유효)
+ */
+class FMeshCacheReader
+{
+public:
+	// ExpectedSourceHash가 nullptr이면 해시 검사 생략 (원본이 없어서 해시를 못 구한 경우)
+	bool Open(const FString& InPath, MeshCacheFormat::EAssetType AssetType, const uint64* ExpectedSourceHash);
+	void Close();
+
+	uint64 GetFileSize() const { return File.GetSize(); }
+
+	bool FindSection(MeshCacheFormat::ESection Id, const uint8*& OutData, uint64& OutSize, uint32& OutElementSize) const;
+
+	template<typename T>
+	const T* GetArray(MeshCacheFormat::ESection Id, uint32& OutCount) const
+	{
+		const uint8* Data;
+		uint64 Size;
+		uint32 ElementSize;
+		if (!FindSection(Id, Data, Size, ElementSize) || ElementSize != sizeof(T))
+		{
+			return nullptr;
+		}
+		OutCount = static_cast<uint32>(Size / sizeof(T));
+		return reinterpret_cast<const T*>(Data);
+	}
+
+	// 원시 배열 섹션을 한 번의 복사로 TArray에 채운다
+	template<typename T>
+	bool ReadArray(MeshCacheFormat::ESection Id, TArray<T>& OutArray) const
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Raw cache sections must be trivially copyable");
+		uint32 Count = 0;
+		const T* Data = GetArray<T>(Id, Count);
+		if (!Data)
+		{
+			return false;
+		}
+		OutArray.resize(Count);
+		if (Count > 0)
+		{
+			std::memcpy(OutArray.data(), Data, static_cast<size_t>(Count) * sizeof(T));
+		}
+		return true;
+	}
+
+private:
+	FMappedFile File;
+	const MeshCacheFormat::FHeader* Header = nullptr;
+	const MeshCacheFormat::FSectionEntry* SectionTable = nullptr;
+};
+
+/**
+ * FStaticMesh / FSkeletalMesh 파생 데이터 캐시
+ * - 유효성은 타임스탬프가 아니라 원본 내용 해시로 판단한다 (복사/체크아웃으로 시각이 바뀌어도 재임포트하지 않음)
+ * - 정점/인덱스는 원시 섹션이라 로드 시 원소별 역직렬화 없이 섹션당 memcpy 한 번
+ */
+class FMeshCache
+{
+public:
+	// 원본 + 의존 파일(.mtl 등) 내용과 임포터 버전의 해시. 원본을 읽지 못하면 false
+	static bool ComputeSourceHash(const FString& SourcePath, const TArray<FString>& Dependencies, uint32 ImporterVersion, uint64& OutHash);
+
+	// 실패(없음/버전·해시 불일치/손상)하면 false. 이때 출력은 빈 상태로 되돌린다
+	// OutBVH: 캐시에 구워진 BVH가 있고 검증을 통과하면 채운다. 없거나 잘못됐으면 빈 채로 두고 메시 로드는 성공시킨다
+	static bool LoadStaticMesh(const FString& CachePath, const uint64* ExpectedSourceHash, FStaticMesh& OutMesh, TArray<FMaterialInfo>* OutMaterialInfos, FMeshBVH* OutBVH = nullptr);
+	static bool SaveStaticMesh(const FString& CachePath, uint64 SourceHash, const FStaticMesh& Mesh, const TArray<FMaterialInfo>* MaterialInfos, const FMeshBVH* BVH = nullptr);
+
+	static bool LoadSkeletalMesh(const FString& CachePath, const uint64* ExpectedSourceHash, FSkeletalMesh& OutMesh);
+	static bool SaveSkeletalMesh(const FString& CachePath, uint64 SourceHash, const FSkeletalMesh& Mesh);
+
+	// .obj 하나로 임포트 / 기존 FWindowsBin 캐시 / 매핑 캐시(콜드·웜) 로드 시간 비교 (콘솔 MESHCACHE BENCH)
+	static void RunBenchmark(const FString& ObjPath, int32 NumIterations);
+};
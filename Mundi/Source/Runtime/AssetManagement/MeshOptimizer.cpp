@@ -0,0 +1,547 @@
+﻿#include "pch.h"
+#include "MeshOptimizer.h"
+#include "ObjManager.h"
+#include "SkeletalMesh.h"
+#include "FbxImporter.h"
+#include "FbxImportOptions.h"
+#include "PlatformTime.h"
+#include <filesystem>
+
+namespace
+{
+	/** 삼각형 하나를 그릴 때 FIFO 캐시에서 새로 변환해야 하는 정점 수를 세는 시뮬레이터 */
+	class FFifoCacheSimulator
+	{
+	public:
+		explicit FFifoCacheSimulator(int32 InCacheSize)
+			: Entries(InCacheSize, ~0u)
+		{
+		}
+
+		void Reset()
+		{
+			std::fill(Entries.begin(), Entries.end(), ~0u);
+			Head = 0;
+		}
+
+		uint32 AddTriangle(const uint32* Triangle)
+		{
+			uint32 Misses = 0;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				if (std::find(Entries.begin(), Entries.end(), Triangle[Corner]) == Entries.end())
+				{
+					Entries[Head] = Triangle[Corner];
+					Head = (Head + 1) % Entries.size();
+					++Misses;
+				}
+			}
+			return Misses;
+		}
+
+	private:
+		TArray<uint32> Entries;
+		size_t Head = 0;
+	};
+
+	/** 정점 → 인접 삼각형 목록 (CSR) */
+	struct FVertexAdjacency
+	{
+		TArray<uint32> Offsets;		// NumVertices + 1
+		TArray<uint32> Triangles;
+
+		void Build(const uint32* Indices, size_t NumIndices, uint32 NumVertices)
+		{
+			Offsets.assign(NumVertices + 1, 0);
+			for (size_t Index = 0; Index < NumIndices; ++Index)
+			{
+				++Offsets[Indices[Index] + 1];
+			}
+			for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+			{
+				Offsets[Vertex + 1] += Offsets[Vertex];
+			}
+
+			Triangles.resize(NumIndices);
+			TArray<uint32> Cursor(Offsets.begin(), Offsets.end() - 1);
+			for (size_t Index = 0; Index < NumIndices; ++Index)
+			{
+				Triangles[Cursor[Indices[Index]]++] = static_cast<uint32>(Index / 3);
+			}
+		}
+	};
+
+	// 그룹 범위가 서로 겹치지 않고 인덱스 버퍼 안에 있는지 (아니면 그룹을 무시하고 전체를 한 구간으로)
+	TArray<std::pair<uint32, uint32>> GetOptimizeRanges(const TArray<FGroupInfo>& GroupInfos, size_t NumIndices)
+	{
+		TArray<std::pair<uint32, uint32>> Ranges;
+		for (const FGroupInfo& Group : GroupInfos)
+		{
+			if (NumIndices < static_cast<size_t>(Group.StartIndex) + Group.IndexCount || Group.StartIndex % 3 != 0 || Group.IndexCount % 3 != 0)
+			{
+				return {};
+			}
+			if (0 < Group.IndexCount)
+			{
+				Ranges.push_back({ Group.StartIndex, Group.IndexCount });
+			}
+		}
+
+		std::sort(Ranges.begin(), Ranges.end());
+		for (size_t Index = 1; Index < Ranges.size(); ++Index)
+		{
+			if (Ranges[Index].first < Ranges[Index - 1].first + Ranges[Index - 1].second)
+			{
+				return {};
+			}
+		}
+		return Ranges;
+	}
+
+	template<typename TVertex, typename TGetPosition>
+	void OptimizeMesh(TArray<TVertex>& Vertices, TArray<uint32>& Indices, const TArray<FGroupInfo>& GroupInfos,
+		TGetPosition GetPosition, TArray<uint32>& OutRemap, uint32& OutNumVertices, FMeshOptimizeStats* OutStats)
+	{
+		PROFILE_SCOPE("MeshOptimize");
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const uint32 NumVertices = static_cast<uint32>(Vertices.size());
+
+		FMeshOptimizeStats Stats;
+		Stats.NumTriangles = static_cast<uint32>(Indices.size() / 3);
+		Stats.ACMRBefore = FMeshOptimizer::ComputeACMR(Indices.data(), Indices.size());
+		Stats.ATVRBefore = FMeshOptimizer::ComputeATVR(Indices.data(), Indices.size(), NumVertices);
+
+		TArray<std::pair<uint32, uint32>> Ranges = GetOptimizeRanges(GroupInfos, Indices.size());
+		if (Ranges.empty() && GroupInfos.empty())
+		{
+			Ranges.push_back({ 0u, static_cast<uint32>(Indices.size() - Indices.size() % 3) });
+		}
+
+		// 그룹마다 등장 순서로 지역 번호를 매겨 최적화한다 (인접 정보가 그룹 크기에 비례)
+		TArray<uint32> GlobalToLocal(NumVertices, ~0u);
+		TArray<uint32> LocalToGlobal;
+		TArray<uint32> LocalIndices;
+		TArray<FVector> LocalPositions;
+		TArray<uint32> ClusterStarts;
+		for (const std::pair<uint32, uint32>& Range : Ranges)
+		{
+			uint32* GroupIndices = Indices.data() + Range.first;
+			const size_t NumGroupIndices = Range.second;
+
+			LocalToGlobal.clear();
+			LocalIndices.resize(NumGroupIndices);
+			for (size_t Index = 0; Index < NumGroupIndices; ++Index)
+			{
+				uint32& Local = GlobalToLocal[GroupIndices[Index]];
+				if (Local == ~0u)
+				{
+					Local = static_cast<uint32>(LocalToGlobal.size());
+					LocalToGlobal.push_back(GroupIndices[Index]);
+				}
+				LocalIndices[Index] = Local;
+			}
+
+			LocalPositions.resize(LocalToGlobal.size());
+			for (size_t Local = 0; Local < LocalToGlobal.size(); ++Local)
+			{
+				LocalPositions[Local] = GetPosition(Vertices[LocalToGlobal[Local]]);
+			}
+
+			FMeshOptimizer::OptimizeVertexCache(LocalIndices.data(), NumGroupIndices, static_cast<uint32>(LocalToGlobal.size()),
+				FMeshOptimizer::DefaultCacheSize, &ClusterStarts);
+			Stats.NumClusters += FMeshOptimizer::OptimizeOverdraw(LocalIndices.data(), NumGroupIndices, LocalPositions, ClusterStarts);
+
+			for (size_t Index = 0; Index < NumGroupIndices; ++Index)
+			{
+				GroupIndices[Index] = LocalToGlobal[LocalIndices[Index]];
+			}
+			for (uint32 Global : LocalToGlobal)
+			{
+				GlobalToLocal[Global] = ~0u;
+			}
+		}
+
+		OutNumVertices = FMeshOptimizer::OptimizeVertexFetch(Indices.data(), Indices.size(), NumVertices, OutRemap);
+		FMeshOptimizer::ApplyVertexRemap(Vertices, OutRemap, OutNumVertices);
+
+		Stats.NumVertices = OutNumVertices;
+		Stats.ACMRAfter = FMeshOptimizer::ComputeACMR(Indices.data(), Indices.size());
+		Stats.ATVRAfter = FMeshOptimizer::ComputeATVR(Indices.data(), Indices.size(), OutNumVertices);
+		Stats.Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+		if (OutStats)
+		{
+			*OutStats = Stats;
+		}
+	}
+
+	void LogStats(const char* Label, const FString& Name, const FMeshOptimizeStats& Stats)
+	{
+		UE_LOG("[MeshOptimizer] %s '%s': %u tris, %u verts, %u clusters, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (%.2f ms)",
+			Label, Name.c_str(), Stats.NumTriangles, Stats.NumVertices, Stats.NumClusters,
+			Stats.ACMRBefore, Stats.ACMRAfter, Stats.ATVRBefore, Stats.ATVRAfter, Stats.Milliseconds);
+	}
+}
+
+void FMeshOptimizer::OptimizeStaticMesh(FStaticMesh& Mesh, FMeshOptimizeStats* OutStats)
+{
+	if (Mesh.Vertices.empty() || Mesh.Indices.size() < 3)
+	{
+		return;
+	}
+
+	TArray<uint32> Remap;
+	uint32 NewNumVertices = 0;
+	FMeshOptimizeStats Stats;
+	OptimizeMesh(Mesh.Vertices, Mesh.Indices, Mesh.GroupInfos, [](const FNormalVertex& Vertex) { return Vertex.pos; }, Remap, NewNumVertices, &Stats);
+
+	LogStats("Static", Mesh.PathFileName, Stats);
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+}
+
+void FMeshOptimizer::OptimizeSkeletalMesh(FSkeletalMesh& Mesh, FMeshOptimizeStats* OutStats)
+{
+	if (Mesh.Vertices.empty() || Mesh.Indices.size() < 3)
+	{
+		return;
+	}
+
+	TArray<uint32> Remap;
+	uint32 NewNumVertices = 0;
+	FMeshOptimizeStats Stats;
+	OptimizeMesh(Mesh.Vertices, Mesh.Indices, Mesh.GroupInfos, [](const FSkinnedVertex& Vertex) { return Vertex.Position; }, Remap, NewNumVertices, &Stats);
+
+	// 스키닝/모프 데이터가 컨트롤 포인트로 정점을 찾으므로 같이 옮긴다
+	if (Mesh.VertexToControlPointMap.size() == Remap.size())
+	{
+		ApplyVertexRemap(Mesh.VertexToControlPointMap, Remap, NewNumVertices);
+	}
+
+	LogStats("Skeletal", Mesh.CacheFilePath, Stats);
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+}
+
+void FMeshOptimizer::OptimizeVertexCache(uint32* Indices, size_t NumIndices, uint32 NumVertices, int32 CacheSize, TArray<uint32>* OutClusterStarts)
+{
+	const size_t NumTriangles = NumIndices / 3;
+	if (OutClusterStarts)
+	{
+		OutClusterStarts->clear();
+	}
+	if (NumTriangles == 0)
+	{
+		return;
+	}
+
+	FVertexAdjacency Adjacency;
+	Adjacency.Build(Indices, NumTriangles * 3, NumVertices);
+
+	TArray<uint32> LiveTriangles(NumVertices);
+	for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		LiveTriangles[Vertex] = Adjacency.Offsets[Vertex + 1] - Adjacency.Offsets[Vertex];
+	}
+
+	TArray<uint32> CacheTimeStamps(NumVertices, 0);
+	TArray<uint8> bEmitted(NumTriangles, 0);
+	TArray<uint32> DeadEndStack;
+	TArray<uint32> Candidates;
+	TArray<uint32> Output;
+	Output.reserve(NumTriangles * 3);
+
+	uint32 Time = static_cast<uint32>(CacheSize) + 1;
+	uint32 Cursor = 0;
+	int64 Fanning = Indices[0];
+	bool bHardBoundary = true;
+
+	while (0 <= Fanning)
+	{
+		if (bHardBoundary && OutClusterStarts)
+		{
+			OutClusterStarts->push_back(static_cast<uint32>(Output.size() / 3));
+		}
+
+		// 1. 부채 정점에 붙은 남은 삼각형을 모두 내보낸다
+		Candidates.clear();
+		const uint32 FanVertex = static_cast<uint32>(Fanning);
+		for (uint32 Slot = Adjacency.Offsets[FanVertex]; Slot < Adjacency.Offsets[FanVertex + 1]; ++Slot)
+		{
+			const uint32 Triangle = Adjacency.Triangles[Slot];
+			if (bEmitted[Triangle])
+			{
+				continue;
+			}
+			bEmitted[Triangle] = 1;
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Vertex = Indices[Triangle * 3 + Corner];
+				Output.push_back(Vertex);
+				DeadEndStack.push_back(Vertex);
+				Candidates.push_back(Vertex);
+				--LiveTriangles[Vertex];
+				if (static_cast<uint32>(CacheSize) < Time - CacheTimeStamps[Vertex])
+				{
+					CacheTimeStamps[Vertex] = Time++;
+				}
+			}
+		}
+
+		// 2. 다음 부채 정점: 남은 삼각형을 다 내보내도 캐시에 남아 있을 정점 중 가장 오래된 것
+		Fanning = -1;
+		int64 BestPriority = -1;
+		for (uint32 Vertex : Candidates)
+		{
+			if (LiveTriangles[Vertex] == 0)
+			{
+				continue;
+			}
+			int64 Priority = 0;
+			if (Time - CacheTimeStamps[Vertex] + 2 * LiveTriangles[Vertex] <= static_cast<uint32>(CacheSize))
+			{
+				Priority = Time - CacheTimeStamps[Vertex];
+			}
+			if (BestPriority < Priority)
+			{
+				BestPriority = Priority;
+				Fanning = Vertex;
+			}
+		}
+
+		// 3. 막혔으면 최근 정점(데드엔드 스택)에서, 그것도 없으면 아직 남은 정점 순서대로 (캐시를 새로 채우는 하드 경계)
+		bHardBoundary = Fanning < 0;
+		while (Fanning < 0 && !DeadEndStack.empty())
+		{
+			const uint32 Vertex = DeadEndStack.back();
+			DeadEndStack.pop_back();
+			if (0 < LiveTriangles[Vertex])
+			{
+				Fanning = Vertex;
+			}
+		}
+		while (Fanning < 0 && Cursor < NumVertices)
+		{
+			if (0 < LiveTriangles[Cursor])
+			{
+				Fanning = Cursor;
+			}
+			++Cursor;
+		}
+	}
+
+	std::copy(Output.begin(), Output.end(), Indices);
+}
+
+uint32 FMeshOptimizer::OptimizeOverdraw(uint32* Indices, size_t NumIndices, const TArray<FVector>& Positions, const TArray<uint32>& HardClusterStarts,
+	int32 CacheSize, float Threshold)
+{
+	const uint32 NumTriangles = static_cast<uint32>(NumIndices / 3);
+	if (NumTriangles == 0)
+	{
+		return 0;
+	}
+
+	// 1. 하드 클러스터를 캐시 효율이 유지되는 지점에서 더 잘게 나눈다 (작을수록 정렬 자유도가 높다)
+	TArray<uint32> ClusterStarts;
+	FFifoCacheSimulator Cache(CacheSize);
+	for (size_t HardIndex = 0; HardIndex < HardClusterStarts.size(); ++HardIndex)
+	{
+		const uint32 Begin = HardClusterStarts[HardIndex];
+		const uint32 End = HardIndex + 1 < HardClusterStarts.size() ? HardClusterStarts[HardIndex + 1] : NumTriangles;
+		if (End <= Begin)
+		{
+			continue;
+		}
+
+		Cache.Reset();
+		uint32 HardMisses = 0;
+		for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+		{
+			HardMisses += Cache.AddTriangle(Indices + Triangle * 3);
+		}
+		const float SplitACMR = static_cast<float>(HardMisses) / (End - Begin) * Threshold;
+
+		Cache.Reset();
+		ClusterStarts.push_back(Begin);
+		uint32 ClusterBegin = Begin;
+		uint32 ClusterMisses = 0;
+		for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+		{
+			ClusterMisses += Cache.AddTriangle(Indices + Triangle * 3);
+			if (Triangle + 1 < End && static_cast<float>(ClusterMisses) / (Triangle + 1 - ClusterBegin) <= SplitACMR)
+			{
+				ClusterBegin = Triangle + 1;
+				ClusterStarts.push_back(ClusterBegin);
+				ClusterMisses = 0;
+				Cache.Reset();
+			}
+		}
+	}
+	if (ClusterStarts.empty() || ClusterStarts[0] != 0)
+	{
+		ClusterStarts.insert(ClusterStarts.begin(), 0u);
+	}
+
+	// 2. 메시 중심 기준으로 바깥을 향하는 정도 (면적 가중 법선과 클러스터 중심)
+	FVector MeshCentroid(0, 0, 0);
+	float MeshArea = 0.0f;
+	const uint32 NumClusters = static_cast<uint32>(ClusterStarts.size());
+	TArray<FVector> ClusterCentroids(NumClusters, FVector(0, 0, 0));
+	TArray<FVector> ClusterNormals(NumClusters, FVector(0, 0, 0));
+	TArray<float> ClusterAreas(NumClusters, 0.0f);
+	for (uint32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+	{
+		const uint32 End = Cluster + 1 < NumClusters ? ClusterStarts[Cluster + 1] : NumTriangles;
+		for (uint32 Triangle = ClusterStarts[Cluster]; Triangle < End; ++Triangle)
+		{
+			const FVector& P0 = Positions[Indices[Triangle * 3 + 0]];
+			const FVector& P1 = Positions[Indices[Triangle * 3 + 1]];
+			const FVector& P2 = Positions[Indices[Triangle * 3 + 2]];
+			const FVector Normal = FVector::Cross(P1 - P0, P2 - P0);
+			const float Area = Normal.Size();
+			const FVector Center = (P0 + P1 + P2) / 3.0f;
+
+			ClusterCentroids[Cluster] += Center * Area;
+			ClusterNormals[Cluster] += Normal;
+			ClusterAreas[Cluster] += Area;
+			MeshCentroid += Center * Area;
+			MeshArea += Area;
+		}
+	}
+	if (0.0f < MeshArea)
+	{
+		MeshCentroid = MeshCentroid / MeshArea;
+	}
+
+	TArray<float> SortKeys(NumClusters, 0.0f);
+	for (uint32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+	{
+		if (ClusterAreas[Cluster] <= 0.0f)
+		{
+			continue;
+		}
+		const FVector Centroid = ClusterCentroids[Cluster] / ClusterAreas[Cluster];
+		const float NormalLength = ClusterNormals[Cluster].Size();
+		if (0.0f < NormalLength)
+		{
+			SortKeys[Cluster] = FVector::Dot(Centroid - MeshCentroid, ClusterNormals[Cluster] / NormalLength);
+		}
+	}
+
+	// 3. 바깥을 향하는 클러스터부터 (가리는 쪽이 먼저 그려져 Early-Z에 걸린다)
+	TArray<uint32> Order(NumClusters);
+	for (uint32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+	{
+		Order[Cluster] = Cluster;
+	}
+	std::stable_sort(Order.begin(), Order.end(), [&SortKeys](uint32 A, uint32 B) { return SortKeys[A] > SortKeys[B]; });
+
+	TArray<uint32> Sorted;
+	Sorted.reserve(static_cast<size_t>(NumTriangles) * 3);
+	for (uint32 Cluster : Order)
+	{
+		const uint32 End = Cluster + 1 < NumClusters ? ClusterStarts[Cluster + 1] : NumTriangles;
+		Sorted.insert(Sorted.end(), Indices + ClusterStarts[Cluster] * 3, Indices + End * 3);
+	}
+	std::copy(Sorted.begin(), Sorted.end(), Indices);
+	return NumClusters;
+}
+
+uint32 FMeshOptimizer::OptimizeVertexFetch(uint32* Indices, size_t NumIndices, uint32 NumVertices, TArray<uint32>& OutRemap)
+{
+	OutRemap.assign(NumVertices, ~0u);
+	uint32 NextVertex = 0;
+	for (size_t Index = 0; Index < NumIndices; ++Index)
+	{
+		uint32& Remapped = OutRemap[Indices[Index]];
+		if (Remapped == ~0u)
+		{
+			Remapped = NextVertex++;
+		}
+		Indices[Index] = Remapped;
+	}
+	return NextVertex;
+}
+
+float FMeshOptimizer::ComputeACMR(const uint32* Indices, size_t NumIndices, int32 CacheSize)
+{
+	const size_t NumTriangles = NumIndices / 3;
+	if (NumTriangles == 0)
+	{
+		return 0.0f;
+	}
+
+	FFifoCacheSimulator Cache(CacheSize);
+	uint64 Misses = 0;
+	for (size_t Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		Misses += Cache.AddTriangle(Indices + Triangle * 3);
+	}
+	return static_cast<float>(static_cast<double>(Misses) / NumTriangles);
+}
+
+float FMeshOptimizer::ComputeATVR(const uint32* Indices, size_t NumIndices, uint32 NumVertices, int32 CacheSize)
+{
+	if (NumVertices == 0)
+	{
+		return 0.0f;
+	}
+
+	// 분모는 실제로 참조되는 정점 수
+	TArray<uint8> bReferenced(NumVertices, 0);
+	uint32 NumReferenced = 0;
+	for (size_t Index = 0; Index < NumIndices; ++Index)
+	{
+		if (!bReferenced[Indices[Index]])
+		{
+			bReferenced[Indices[Index]] = 1;
+			++NumReferenced;
+		}
+	}
+	if (NumReferenced == 0)
+	{
+		return 0.0f;
+	}
+	return ComputeACMR(Indices, NumIndices, CacheSize) * static_cast<float>(NumIndices / 3) / NumReferenced;
+}
+
+bool FMeshOptimizer::ReportFile(const FString& PathFileName)
+{
+	FString Extension = std::filesystem::path(PathFileName).extension().string();
+	std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+
+	FStaticMesh Mesh;
+	if (Extension == ".obj")
+	{
+		FObjInfo RawObjInfo;
+		TArray<FMaterialInfo> MaterialInfos;
+		if (!FObjImporter::LoadObjModel(PathFileName, &RawObjInfo, MaterialInfos, true))
+		{
+			return false;
+		}
+		FObjImporter::ConvertToStaticMesh(RawObjInfo, MaterialInfos, &Mesh);
+	}
+	else if (Extension == ".fbx")
+	{
+		FFbxImporter Importer;
+		FFbxImportOptions Options;
+		if (!Importer.ImportStaticMesh(PathFileName, Options, Mesh))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		UE_LOG("[MeshOptimizer] Unsupported mesh file: %s", PathFileName.c_str());
+		return false;
+	}
+
+	Mesh.PathFileName = PathFileName;
+	OptimizeStaticMesh(Mesh);
+	return true;
+}
@@ -0,0 +1,72 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+struct FStaticMesh;
+struct FSkeletalMesh;
+struct FGroupInfo;
+
+/** 메시 최적화 전후 지표 (임포트 로그 / MESH OPTIMIZE) */
+struct FMeshOptimizeStats
+{
+	uint32 NumVertices = 0;			// 최적화 후 (참조되지 않는 정점은 빠진다)
+	uint32 NumTriangles = 0;
+	uint32 NumClusters = 0;			// 오버드로 정렬 단위
+	float ACMRBefore = 0.0f;		// 삼각형당 정점 캐시 미스 (0.5 ~ 3, 낮을수록 좋음)
+	float ACMRAfter = 0.0f;
+	float ATVRBefore = 0.0f;		// 정점당 변환 횟수 (1이 최적)
+	float ATVRAfter = 0.0f;
+	double Milliseconds = 0.0;
+};
+
+/**
+ * 임포트 후 인덱스/정점 순서 최적화 (캐시 저장 전에 한 번)
+ * 1. 정점 캐시: Tipsify (Sander et al. 2007)로 그룹마다 삼각형 순서를 다시 만든다
+ * 2. 오버드로: Tipsify 결과를 캐시 효율이 크게 떨어지지 않는 선에서 클러스터로 나누고,
+ *    바깥을 향하는 클러스터가 먼저 그려지도록 정렬한다
+ * 3. 정점 페치: 인덱스 버퍼에서 처음 쓰이는 순서대로 정점을 재배치한다 (참조되지 않는 정점 제거)
+ * - 삼각형은 자기 그룹(FGroupInfo) 범위 밖으로 나가지 않으므로 머티리얼 구간은 그대로다
+ * - ACMR/ATVR은 FIFO 캐시(GPU의 post-transform 캐시 근사)로 측정한다
+ */
+class FMeshOptimizer
+{
+public:
+	static constexpr int32 DefaultCacheSize = 16;
+	// 클러스터 분할 허용치: 분할 후 ACMR이 원래 클러스터 ACMR의 이 배수 이하일 때만 자른다
+	static constexpr float DefaultOverdrawThreshold = 1.05f;
+
+	static void OptimizeStaticMesh(FStaticMesh& Mesh, FMeshOptimizeStats* OutStats = nullptr);
+	// VertexToControlPointMap도 같은 순서로 재배치한다
+	static void OptimizeSkeletalMesh(FSkeletalMesh& Mesh, FMeshOptimizeStats* OutStats = nullptr);
+
+	// Indices[0, NumIndices)를 캐시 친화 순서로 (결과는 OutClusterStarts에 하드 경계(캐시를 새로 채우는 지점) 삼각형 인덱스)
+	static void OptimizeVertexCache(uint32* Indices, size_t NumIndices, uint32 NumVertices, int32 CacheSize = DefaultCacheSize,
+		TArray<uint32>* OutClusterStarts = nullptr);
+
+	// OptimizeVertexCache 결과를 클러스터 단위로 바깥쪽 먼저 정렬. 반환값은 클러스터 수
+	static uint32 OptimizeOverdraw(uint32* Indices, size_t NumIndices, const TArray<FVector>& Positions, const TArray<uint32>& HardClusterStarts,
+		int32 CacheSize = DefaultCacheSize, float Threshold = DefaultOverdrawThreshold);
+
+	// 인덱스 버퍼를 새 정점 번호로 바꾸고 OutRemap[이전 번호] = 새 번호 (안 쓰이면 ~0u). 반환값은 새 정점 수
+	static uint32 OptimizeVertexFetch(uint32* Indices, size_t NumIndices, uint32 NumVertices, TArray<uint32>& OutRemap);
+
+	template<typename T>
+	static void ApplyVertexRemap(TArray<T>& Vertices, const TArray<uint32>& Remap, uint32 NewNumVertices)
+	{
+		TArray<T> Remapped(NewNumVertices);
+		for (size_t Index = 0; Index < Vertices.size(); ++Index)
+		{
+			if (Remap[Index] != ~0u)
+			{
+				Remapped[Remap[Index]] = Vertices[Index];
+			}
+		}
+		Vertices = std::move(Remapped);
+	}
+
+	static float ComputeACMR(const uint32* Indices, size_t NumIndices, int32 CacheSize = DefaultCacheSize);
+	static float ComputeATVR(const uint32* Indices, size_t NumIndices, uint32 NumVertices, int32 CacheSize = DefaultCacheSize);
+
+	// .obj 하나를 캐시 없이 임포트해 최적화 전후 지표를 로그로 출력 (캐시 파일은 건드리지 않음)
+	static bool ReportFile(const FString& PathFileName);
+};
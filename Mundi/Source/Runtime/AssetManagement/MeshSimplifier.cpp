@@ -0,0 +1,743 @@
+﻿#include "pch.h"
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include "SkeletalMesh.h"
+#include "PlatformTime.h"
+#include "Hash.h"
+#include <queue>
+
+namespace
+{
+	/** 평면까지 거리 제곱의 가중합 (대칭 4x4 행렬의 상삼각 10개) + 누적 가중치 */
+	struct FQuadric
+	{
+		double A00 = 0.0, A01 = 0.0, A02 = 0.0, A03 = 0.0;
+		double A11 = 0.0, A12 = 0.0, A13 = 0.0;
+		double A22 = 0.0, A23 = 0.0;
+		double A33 = 0.0;
+		double Weight = 0.0;
+
+		// 단위 법선 N, 평면 위의 점 P, 가중치 W
+		static FQuadric FromPlane(const FVector& N, const FVector& P, double W)
+		{
+			const double Nx = N.X, Ny = N.Y, Nz = N.Z;
+			const double D = -(Nx * P.X + Ny * P.Y + Nz * P.Z);
+
+			FQuadric Q;
+			Q.A00 = W * Nx * Nx; Q.A01 = W * Nx * Ny; Q.A02 = W * Nx * Nz; Q.A03 = W * Nx * D;
+			Q.A11 = W * Ny * Ny; Q.A12 = W * Ny * Nz; Q.A13 = W * Ny * D;
+			Q.A22 = W * Nz * Nz; Q.A23 = W * Nz * D;
+			Q.A33 = W * D * D;
+			Q.Weight = W;
+			return Q;
+		}
+
+		FQuadric& operator+=(const FQuadric& Other)
+		{
+			A00 += Other.A00; A01 += Other.A01; A02 += Other.A02; A03 += Other.A03;
+			A11 += Other.A11; A12 += Other.A12; A13 += Other.A13;
+			A22 += Other.A22; A23 += Other.A23;
+			A33 += Other.A33;
+			Weight += Other.Weight;
+			return *this;
+		}
+
+		// 평균 거리 제곱 (가중치로 나눔)
+		double Evaluate(const FVector& P) const
+		{
+			const double X = P.X, Y = P.Y, Z = P.Z;
+			const double Sum = X * X * A00 + 2.0 * X * Y * A01 + 2.0 * X * Z * A02 + 2.0 * X * A03
+				+ Y * Y * A11 + 2.0 * Y * Z * A12 + 2.0 * Y * A13
+				+ Z * Z * A22 + 2.0 * Z * A23
+				+ A33;
+			return 0.0 < Weight ? std::max(Sum, 0.0) / Weight : 0.0;
+		}
+	};
+
+	/** 축약 후보 (From 위치 정점을 To 위치로 합침). 버전이 바뀐 후보는 꺼낼 때 버린다 */
+	struct FCollapseCandidate
+	{
+		double Cost;
+		uint32 From;
+		uint32 To;
+		uint32 FromVersion;
+		uint32 ToVersion;
+
+		bool operator>(const FCollapseCandidate& Other) const { return Cost > Other.Cost; }
+	};
+
+	// 경계/이음매 에지에 세우는 수직 평면의 가중치 (면적 가중 평면 대비)
+	constexpr double ConstraintWeight = 10.0;
+
+	class FQuadricSimplifier
+	{
+	public:
+		FQuadricSimplifier(const TArray<FVector>& InPositions, const TArray<uint32>& InIndices)
+			: Positions(InPositions)
+			, Triangles(InIndices.begin(), InIndices.end() - InIndices.size() % 3)
+		{
+		}
+
+		float Run(uint32 TargetTriangles, float MaxError, const FMeshSimplifier::FCanMergeFunc& CanMerge)
+		{
+			const uint32 NumTriangles = static_cast<uint32>(Triangles.size() / 3);
+			LiveTriangles = NumTriangles;
+			bTriangleAlive.assign(NumTriangles, 1);
+
+			WeldPositions();
+			BuildPointTriangles();
+			BuildQuadrics();
+
+			const double MaxCost = static_cast<double>(MaxError) * MaxError;
+			for (uint32 Point = 0; Point < PointPositions.size(); ++Point)
+			{
+				PushCandidates(Point, MaxCost);
+			}
+
+			double AppliedCost = 0.0;
+			while (TargetTriangles < LiveTriangles && !Heap.empty())
+			{
+				const FCollapseCandidate Candidate = Heap.top();
+				Heap.pop();
+
+				if (!bPointAlive[Candidate.From] || !bPointAlive[Candidate.To]
+					|| PointVersions[Candidate.From] != Candidate.FromVersion || PointVersions[Candidate.To] != Candidate.ToVersion)
+				{
+					continue;
+				}
+				if (MaxCost < Candidate.Cost)
+				{
+					break;
+				}
+				if (!TryCollapse(Candidate.From, Candidate.To, CanMerge))
+				{
+					continue;
+				}
+
+				AppliedCost = std::max(AppliedCost, Candidate.Cost);
+				PushCandidates(Candidate.To, MaxCost);
+			}
+			return static_cast<float>(std::sqrt(AppliedCost));
+		}
+
+		void GetResult(TArray<uint32>& OutIndices, TArray<uint32>* OutSourceTriangles) const
+		{
+			OutIndices.clear();
+			OutIndices.reserve(static_cast<size_t>(LiveTriangles) * 3);
+			if (OutSourceTriangles)
+			{
+				OutSourceTriangles->clear();
+				OutSourceTriangles->reserve(LiveTriangles);
+			}
+
+			for (uint32 Triangle = 0; Triangle < bTriangleAlive.size(); ++Triangle)
+			{
+				if (bTriangleAlive[Triangle])
+				{
+					OutIndices.insert(OutIndices.end(), Triangles.begin() + Triangle * 3, Triangles.begin() + Triangle * 3 + 3);
+					if (OutSourceTriangles)
+					{
+						OutSourceTriangles->push_back(Triangle);
+					}
+				}
+			}
+		}
+
+	private:
+		// 위치가 완전히 같은 정점을 하나의 위상 정점(Point)으로 묶는다
+		void WeldPositions()
+		{
+			TArray<uint32> Order(Positions.size());
+			for (uint32 Vertex = 0; Vertex < Order.size(); ++Vertex)
+			{
+				Order[Vertex] = Vertex;
+			}
+			auto Less = [this](uint32 A, uint32 B)
+			{
+				const FVector& PA = Positions[A];
+				const FVector& PB = Positions[B];
+				if (PA.X != PB.X) return PA.X < PB.X;
+				if (PA.Y != PB.Y) return PA.Y < PB.Y;
+				return PA.Z < PB.Z;
+			};
+			std::sort(Order.begin(), Order.end(), Less);
+
+			VertexToPoint.assign(Positions.size(), 0);
+			PointPositions.clear();
+			for (size_t Index = 0; Index < Order.size(); ++Index)
+			{
+				if (Index == 0 || Less(Order[Index - 1], Order[Index]))
+				{
+					PointPositions.push_back(Positions[Order[Index]]);
+				}
+				VertexToPoint[Order[Index]] = static_cast<uint32>(PointPositions.size() - 1);
+			}
+
+			bPointAlive.assign(PointPositions.size(), 1);
+			PointVersions.assign(PointPositions.size(), 0);
+			PointStamps.assign(PointPositions.size(), 0);
+		}
+
+		void BuildPointTriangles()
+		{
+			PointTriangles.assign(PointPositions.size(), {});
+			for (uint32 Triangle = 0; Triangle < bTriangleAlive.size(); ++Triangle)
+			{
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					PointTriangles[GetPoint(Triangle, Corner)].push_back(Triangle);
+				}
+			}
+		}
+
+		void BuildQuadrics()
+		{
+			Quadrics.assign(PointPositions.size(), FQuadric());
+
+			// 면 평면 (면적 가중)
+			for (uint32 Triangle = 0; Triangle < bTriangleAlive.size(); ++Triangle)
+			{
+				const FVector Normal = GetTriangleNormal(Triangle);
+				const float DoubleArea = Normal.Size();
+				if (DoubleArea <= 0.0f)
+				{
+					continue;
+				}
+				const FQuadric Plane = FQuadric::FromPlane(Normal / DoubleArea, PointPositions[GetPoint(Triangle, 0)], DoubleArea * 0.5);
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Quadrics[GetPoint(Triangle, Corner)] += Plane;
+				}
+			}
+
+			// 경계 에지(삼각형 하나만 가진 에지)와 이음매 에지(양쪽 삼각형의 정점 번호가 다른 에지)에 수직 평면을 세운다
+			struct FEdgeCorner
+			{
+				uint64 Key;
+				uint32 Triangle;
+				int32 Corner;
+			};
+			TArray<FEdgeCorner> Edges;
+			Edges.reserve(Triangles.size());
+			for (uint32 Triangle = 0; Triangle < bTriangleAlive.size(); ++Triangle)
+			{
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const uint32 P0 = GetPoint(Triangle, Corner);
+					const uint32 P1 = GetPoint(Triangle, (Corner + 1) % 3);
+					Edges.push_back({ (static_cast<uint64>(std::min(P0, P1)) << 32) | std::max(P0, P1), Triangle, Corner });
+				}
+			}
+			std::sort(Edges.begin(), Edges.end(), [](const FEdgeCorner& A, const FEdgeCorner& B) { return A.Key < B.Key; });
+
+			for (size_t Begin = 0; Begin < Edges.size();)
+			{
+				size_t End = Begin + 1;
+				while (End < Edges.size() && Edges[End].Key == Edges[Begin].Key)
+				{
+					++End;
+				}
+
+				bool bConstrained = (End - Begin == 1);
+				if (End - Begin == 2)
+				{
+					// 마주 보는 두 삼각형은 에지를 반대 방향으로 지나므로 정점 번호가 엇갈려 같아야 이음매가 아니다
+					const FEdgeCorner& A = Edges[Begin];
+					const FEdgeCorner& B = Edges[Begin + 1];
+					const uint32 A0 = GetVertex(A.Triangle, A.Corner), A1 = GetVertex(A.Triangle, (A.Corner + 1) % 3);
+					const uint32 B0 = GetVertex(B.Triangle, B.Corner), B1 = GetVertex(B.Triangle, (B.Corner + 1) % 3);
+					bConstrained = !((A0 == B1 && A1 == B0) || (A0 == B0 && A1 == B1));
+				}
+
+				if (bConstrained)
+				{
+					for (size_t Index = Begin; Index < End; ++Index)
+					{
+						const FEdgeCorner& Edge = Edges[Index];
+						const uint32 P0 = GetPoint(Edge.Triangle, Edge.Corner);
+						const uint32 P1 = GetPoint(Edge.Triangle, (Edge.Corner + 1) % 3);
+						const FVector EdgeVector = PointPositions[P1] - PointPositions[P0];
+						const FVector Normal = GetTriangleNormal(Edge.Triangle);
+						FVector Side = FVector::Cross(EdgeVector, Normal);
+						const float SideLength = Side.Size();
+						if (SideLength <= 0.0f)
+						{
+							continue;
+						}
+						const double EdgeLengthSquared = FVector::Dot(EdgeVector, EdgeVector);
+						const FQuadric Plane = FQuadric::FromPlane(Side / SideLength, PointPositions[P0], EdgeLengthSquared * ConstraintWeight);
+						Quadrics[P0] += Plane;
+						Quadrics[P1] += Plane;
+					}
+				}
+				Begin = End;
+			}
+		}
+
+		// Point의 살아 있는 이웃 위상 정점마다 양방향 후보를 넣는다
+		void PushCandidates(uint32 Point, double MaxCost)
+		{
+			const uint32 Stamp = NextStamp();
+			PointStamps[Point] = Stamp;
+			for (uint32 Triangle : PointTriangles[Point])
+			{
+				if (!bTriangleAlive[Triangle])
+				{
+					continue;
+				}
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const uint32 Neighbor = GetPoint(Triangle, Corner);
+					if (PointStamps[Neighbor] == Stamp)
+					{
+						continue;
+					}
+					PointStamps[Neighbor] = Stamp;
+					PushCandidate(Point, Neighbor, MaxCost);
+					PushCandidate(Neighbor, Point, MaxCost);
+				}
+			}
+		}
+
+		void PushCandidate(uint32 From, uint32 To, double MaxCost)
+		{
+			FQuadric Quadric = Quadrics[From];
+			Quadric += Quadrics[To];
+			const double Cost = Quadric.Evaluate(PointPositions[To]);
+			if (Cost <= MaxCost)
+			{
+				Heap.push({ Cost, From, To, PointVersions[From], PointVersions[To] });
+			}
+		}
+
+		bool TryCollapse(uint32 From, uint32 To, const FMeshSimplifier::FCanMergeFunc& CanMerge)
+		{
+			// 1. From의 각 정점(이음매면 여럿)이 공유 삼각형에서 대응하는 To 정점을 찾는다
+			WedgePairs.clear();
+			uint32 NumShared = 0;
+			for (uint32 Triangle : PointTriangles[From])
+			{
+				if (!bTriangleAlive[Triangle])
+				{
+					continue;
+				}
+				const int32 ToCorner = FindCorner(Triangle, To);
+				if (ToCorner < 0)
+				{
+					continue;
+				}
+				++NumShared;
+				const uint32 FromVertex = GetVertex(Triangle, FindCorner(Triangle, From));
+				if (!FindWedge(FromVertex))
+				{
+					WedgePairs.push_back({ FromVertex, GetVertex(Triangle, ToCorner) });
+				}
+			}
+			if (NumShared == 0)
+			{
+				return false;
+			}
+
+			// 2. 링크 조건: 공통 이웃 수가 공유 삼각형 수와 같아야 비다양체가 생기지 않는다
+			const uint32 FromStamp = NextStamp();
+			for (uint32 Triangle : PointTriangles[From])
+			{
+				if (bTriangleAlive[Triangle])
+				{
+					for (int32 Corner = 0; Corner < 3; ++Corner)
+					{
+						PointStamps[GetPoint(Triangle, Corner)] = FromStamp;
+					}
+				}
+			}
+			const uint32 CommonStamp = NextStamp();
+			uint32 NumCommon = 0;
+			for (uint32 Triangle : PointTriangles[To])
+			{
+				if (!bTriangleAlive[Triangle])
+				{
+					continue;
+				}
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const uint32 Neighbor = GetPoint(Triangle, Corner);
+					if (Neighbor != From && Neighbor != To && PointStamps[Neighbor] == FromStamp)
+					{
+						PointStamps[Neighbor] = CommonStamp;
+						++NumCommon;
+					}
+				}
+			}
+			if (NumCommon != NumShared)
+			{
+				return false;
+			}
+
+			// 3. 남는 삼각형: 이음매 대응이 있고, 법선이 뒤집히지 않아야 한다
+			for (uint32 Triangle : PointTriangles[From])
+			{
+				if (!bTriangleAlive[Triangle] || 0 <= FindCorner(Triangle, To))
+				{
+					continue;
+				}
+				const int32 FromCorner = FindCorner(Triangle, From);
+				if (!FindWedge(GetVertex(Triangle, FromCorner)))
+				{
+					return false;
+				}
+
+				const FVector OldNormal = GetTriangleNormal(Triangle);
+				const FVector& P1 = PointPositions[GetPoint(Triangle, (FromCorner + 1) % 3)];
+				const FVector& P2 = PointPositions[GetPoint(Triangle, (FromCorner + 2) % 3)];
+				const FVector NewNormal = FVector::Cross(P1 - PointPositions[To], P2 - PointPositions[To]);
+				if (FVector::Dot(OldNormal, NewNormal) <= 0.0f)
+				{
+					return false;
+				}
+			}
+
+			// 4. 위치 외 속성 제약
+			if (CanMerge)
+			{
+				for (const std::pair<uint32, uint32>& Pair : WedgePairs)
+				{
+					if (!CanMerge(Pair.first, Pair.second))
+					{
+						return false;
+					}
+				}
+			}
+
+			// 적용: 공유 삼각형은 사라지고, 나머지는 From 정점을 대응하는 To 정점으로 바꾼다
+			for (uint32 Triangle : PointTriangles[From])
+			{
+				if (!bTriangleAlive[Triangle])
+				{
+					continue;
+				}
+				if (0 <= FindCorner(Triangle, To))
+				{
+					bTriangleAlive[Triangle] = 0;
+					--LiveTriangles;
+					continue;
+				}
+				uint32& Vertex = Triangles[Triangle * 3 + FindCorner(Triangle, From)];
+				Vertex = FindWedge(Vertex)->second;
+				PointTriangles[To].push_back(Triangle);
+			}
+
+			TArray<uint32>& ToTriangles = PointTriangles[To];
+			ToTriangles.erase(std::remove_if(ToTriangles.begin(), ToTriangles.end(),
+				[this](uint32 Triangle) { return !bTriangleAlive[Triangle]; }), ToTriangles.end());
+			PointTriangles[From].clear();
+			PointTriangles[From].shrink_to_fit();
+
+			Quadrics[To] += Quadrics[From];
+			bPointAlive[From] = 0;
+			++PointVersions[To];
+			return true;
+		}
+
+		uint32 GetVertex(uint32 Triangle, int32 Corner) const { return Triangles[Triangle * 3 + Corner]; }
+		uint32 GetPoint(uint32 Triangle, int32 Corner) const { return VertexToPoint[Triangles[Triangle * 3 + Corner]]; }
+
+		int32 FindCorner(uint32 Triangle, uint32 Point) const
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				if (GetPoint(Triangle, Corner) == Point)
+				{
+					return Corner;
+				}
+			}
+			return -1;
+		}
+
+		// 크기를 늘린 외적 (길이 = 면적 * 2)
+		FVector GetTriangleNormal(uint32 Triangle) const
+		{
+			const FVector& P0 = PointPositions[GetPoint(Triangle, 0)];
+			return FVector::Cross(PointPositions[GetPoint(Triangle, 1)] - P0, PointPositions[GetPoint(Triangle, 2)] - P0);
+		}
+
+		const std::pair<uint32, uint32>* FindWedge(uint32 FromVertex) const
+		{
+			for (const std::pair<uint32, uint32>& Pair : WedgePairs)
+			{
+				if (Pair.first == FromVertex)
+				{
+					return &Pair;
+				}
+			}
+			return nullptr;
+		}
+
+		uint32 NextStamp()
+		{
+			if (++CurrentStamp == 0)
+			{
+				std::fill(PointStamps.begin(), PointStamps.end(), 0);
+				CurrentStamp = 1;
+			}
+			return CurrentStamp;
+		}
+
+		const TArray<FVector>& Positions;
+		TArray<uint32> Triangles;			// 정점 번호 (축약되면 대응 정점으로 바뀜)
+		TArray<uint8> bTriangleAlive;
+		uint32 LiveTriangles = 0;
+
+		TArray<uint32> VertexToPoint;
+		TArray<FVector> PointPositions;
+		TArray<uint8> bPointAlive;
+		TArray<uint32> PointVersions;
+		TArray<uint32> PointStamps;
+		uint32 CurrentStamp = 0;
+		TArray<TArray<uint32>> PointTriangles;
+		TArray<FQuadric> Quadrics;
+
+		TArray<std::pair<uint32, uint32>> WedgePairs;
+		std::priority_queue<FCollapseCandidate, TArray<FCollapseCandidate>, std::greater<FCollapseCandidate>> Heap;
+	};
+
+	// 두 정점의 본 가중치 차이 (0 = 같음, 1 = 겹치는 본 없음). 같은 본이 여러 슬롯에 있으면 합친다
+	float GetBoneWeightDistance(const FSkinnedVertex& A, const FSkinnedVertex& B)
+	{
+		int32 Bones[8];
+		float Weights[8];
+		int32 NumBones = 0;
+		auto Accumulate = [&](const FSkinnedVertex& Vertex, float Sign)
+		{
+			for (int32 Slot = 0; Slot < 4; ++Slot)
+			{
+				if (Vertex.BoneWeights[Slot] <= 0.0f)
+				{
+					continue;
+				}
+				int32 Index = 0;
+				while (Index < NumBones && Bones[Index] != Vertex.BoneIndices[Slot])
+				{
+					++Index;
+				}
+				if (Index == NumBones)
+				{
+					Bones[NumBones] = Vertex.BoneIndices[Slot];
+					Weights[NumBones++] = 0.0f;
+				}
+				Weights[Index] += Sign * Vertex.BoneWeights[Slot];
+			}
+		};
+		Accumulate(A, 1.0f);
+		Accumulate(B, -1.0f);
+
+		float Distance = 0.0f;
+		for (int32 Index = 0; Index < NumBones; ++Index)
+		{
+			Distance += std::abs(Weights[Index]);
+		}
+		return Distance * 0.5f;
+	}
+
+	void LogLODs(const char* Label, const FString& Name, uint32 NumTriangles, const TArray<FMeshLOD>& LODs, double Milliseconds)
+	{
+		FString Summary = std::to_string(NumTriangles);
+		for (const FMeshLOD& LOD : LODs)
+		{
+			Summary += " / " + std::to_string(LOD.Indices.size() / 3);
+		}
+		UE_LOG("[MeshSimplifier] %s '%s': %d LODs, tris %s (%.2f ms)", Label, Name.c_str(), static_cast<int32>(LODs.size()) + 1, Summary.c_str(), Milliseconds);
+	}
+}
+
+const FMeshLODSettings& FMeshLODSettings::Get()
+{
+	static const FMeshLODSettings Settings = []()
+	{
+		FMeshLODSettings Result;
+		auto ReadFloat = [](const char* Key, float& InOutValue)
+		{
+			if (FString* Value = EditorINI.Find(Key))
+			{
+				try
+				{
+					InOutValue = std::stof(*Value);
+				}
+				catch (...)
+				{
+					UE_LOG("[MeshSimplifier] Invalid %s '%s'", Key, Value->c_str());
+				}
+			}
+		};
+
+		float NumLODs = static_cast<float>(Result.NumLODs);
+		ReadFloat("MeshLODCount", NumLODs);
+		ReadFloat("MeshLODTriangleRatio", Result.TriangleRatio);
+		ReadFloat("MeshLODMaxError", Result.MaxError);
+		ReadFloat("MeshLODScreenSize", Result.FirstScreenSize);
+
+		Result.NumLODs = std::clamp(static_cast<int32>(NumLODs), 1, 8);
+		Result.TriangleRatio = std::clamp(Result.TriangleRatio, 0.05f, 0.95f);
+		Result.MaxError = std::max(Result.MaxError, 0.0f);
+		return Result;
+	}();
+	return Settings;
+}
+
+uint32 FMeshLODSettings::GetHash() const
+{
+	uint64 Hash = HashBytes(&NumLODs, sizeof(NumLODs));
+	Hash = HashBytes(&TriangleRatio, sizeof(TriangleRatio), Hash);
+	Hash = HashBytes(&MaxError, sizeof(MaxError), Hash);
+	Hash = HashBytes(&FirstScreenSize, sizeof(FirstScreenSize), Hash);
+	Hash = HashBytes(&ScreenSizeRatio, sizeof(ScreenSizeRatio), Hash);
+	Hash = HashBytes(&MinTriangles, sizeof(MinTriangles), Hash);
+	Hash = HashBytes(&SkinWeightTolerance, sizeof(SkinWeightTolerance), Hash);
+	return static_cast<uint32>(Hash ^ (Hash >> 32));
+}
+
+float FMeshSimplifier::Simplify(const TArray<FVector>& Positions, const TArray<uint32>& Indices, uint32 TargetTriangles, float MaxError,
+	TArray<uint32>& OutIndices, TArray<uint32>* OutSourceTriangles, const FCanMergeFunc& CanMerge)
+{
+	FQuadricSimplifier Simplifier(Positions, Indices);
+	const float Error = Simplifier.Run(TargetTriangles, MaxError, CanMerge);
+	Simplifier.GetResult(OutIndices, OutSourceTriangles);
+	return Error;
+}
+
+void FMeshSimplifier::BuildLODs(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const TArray<FGroupInfo>& GroupInfos,
+	const FMeshLODSettings& Settings, TArray<FMeshLOD>& OutLODs, const FCanMergeFunc& CanMerge)
+{
+	PROFILE_SCOPE("MeshSimplify");
+	OutLODs.clear();
+
+	const uint32 NumTriangles = static_cast<uint32>(Indices.size() / 3);
+	if (Settings.NumLODs <= 1 || NumTriangles <= Settings.MinTriangles || Positions.empty())
+	{
+		return;
+	}
+
+	// 삼각형 → 섹션 번호 (GroupInfos 순서). 어느 그룹에도 속하지 않는 삼각형은 LOD0에서도 그려지지 않으므로 버린다
+	const uint32 NumSections = GroupInfos.empty() ? 1u : static_cast<uint32>(GroupInfos.size());
+	TArray<uint32> TriangleSections(NumTriangles, GroupInfos.empty() ? 0u : ~0u);
+	for (uint32 Section = 0; Section < GroupInfos.size(); ++Section)
+	{
+		const FGroupInfo& Group = GroupInfos[Section];
+		if (Indices.size() < static_cast<size_t>(Group.StartIndex) + Group.IndexCount || Group.StartIndex % 3 != 0 || Group.IndexCount % 3 != 0)
+		{
+			UE_LOG("[MeshSimplifier] Skipping LOD generation: group %u is out of range", Section);
+			return;
+		}
+		for (uint32 Triangle = Group.StartIndex / 3; Triangle < (Group.StartIndex + Group.IndexCount) / 3; ++Triangle)
+		{
+			if (TriangleSections[Triangle] != ~0u)
+			{
+				UE_LOG("[MeshSimplifier] Skipping LOD generation: groups overlap");
+				return;
+			}
+			TriangleSections[Triangle] = Section;
+		}
+	}
+
+	FVector Min = Positions[0];
+	FVector Max = Positions[0];
+	for (const FVector& Position : Positions)
+	{
+		Min = Min.ComponentMin(Position);
+		Max = Max.ComponentMax(Position);
+	}
+	const float MaxError = Settings.MaxError * (Max - Min).Size();
+
+	TArray<uint32> SourceIndices = Indices;
+	TArray<uint32> SimplifiedIndices;
+	TArray<uint32> SourceTriangles;
+	float ScreenSize = Settings.FirstScreenSize;
+	for (int32 LODIndex = 1; LODIndex < Settings.NumLODs; ++LODIndex)
+	{
+		const uint32 SourceTriangleCount = static_cast<uint32>(SourceIndices.size() / 3);
+		if (SourceTriangleCount <= Settings.MinTriangles)
+		{
+			break;
+		}
+
+		const uint32 TargetTriangles = std::max(static_cast<uint32>(SourceTriangleCount * Settings.TriangleRatio), Settings.MinTriangles);
+		Simplify(Positions, SourceIndices, TargetTriangles, MaxError, SimplifiedIndices, &SourceTriangles, CanMerge);
+
+		// 오차 한도 때문에 거의 줄지 않았으면 더 만들어 봐야 LOD0과 구분이 안 된다
+		if (SourceTriangleCount * 0.9f < SourceTriangles.size())
+		{
+			break;
+		}
+
+		// 섹션별로 모으고 각 섹션을 정점 캐시 순서로
+		FMeshLOD LOD;
+		LOD.ScreenSize = ScreenSize;
+		LOD.Indices.reserve(SimplifiedIndices.size());
+		LOD.Sections.resize(NumSections);
+		TArray<uint32> NextTriangleSections;
+		NextTriangleSections.reserve(SourceTriangles.size());
+		for (uint32 Section = 0; Section < NumSections; ++Section)
+		{
+			LOD.Sections[Section].StartIndex = static_cast<uint32>(LOD.Indices.size());
+			for (size_t Triangle = 0; Triangle < SourceTriangles.size(); ++Triangle)
+			{
+				if (TriangleSections[SourceTriangles[Triangle]] == Section)
+				{
+					LOD.Indices.insert(LOD.Indices.end(), SimplifiedIndices.begin() + Triangle * 3, SimplifiedIndices.begin() + Triangle * 3 + 3);
+					NextTriangleSections.push_back(Section);
+				}
+			}
+			LOD.Sections[Section].IndexCount = static_cast<uint32>(LOD.Indices.size()) - LOD.Sections[Section].StartIndex;
+			if (0 < LOD.Sections[Section].IndexCount)
+			{
+				FMeshOptimizer::OptimizeVertexCache(LOD.Indices.data() + LOD.Sections[Section].StartIndex, LOD.Sections[Section].IndexCount,
+					static_cast<uint32>(Positions.size()));
+			}
+		}
+
+		SourceIndices = LOD.Indices;
+		TriangleSections = std::move(NextTriangleSections);
+		OutLODs.push_back(std::move(LOD));
+		ScreenSize *= Settings.ScreenSizeRatio;
+	}
+}
+
+void FMeshSimplifier::GenerateStaticMeshLODs(FStaticMesh& Mesh, const FMeshLODSettings& Settings)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	TArray<FVector> Positions(Mesh.Vertices.size());
+	for (size_t Index = 0; Index < Mesh.Vertices.size(); ++Index)
+	{
+		Positions[Index] = Mesh.Vertices[Index].pos;
+	}
+	BuildLODs(Positions, Mesh.Indices, Mesh.GroupInfos, Settings, Mesh.LODs);
+
+	if (!Mesh.LODs.empty())
+	{
+		LogLODs("Static", Mesh.PathFileName, static_cast<uint32>(Mesh.Indices.size() / 3), Mesh.LODs,
+			FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	}
+}
+
+void FMeshSimplifier::GenerateSkeletalMeshLODs(FSkeletalMesh& Mesh, const FMeshLODSettings& Settings)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	TArray<FVector> Positions(Mesh.Vertices.size());
+	for (size_t Index = 0; Index < Mesh.Vertices.size(); ++Index)
+	{
+		Positions[Index] = Mesh.Vertices[Index].Position;
+	}
+
+	// 본 가중치가 크게 다른 정점끼리 합치면 관절 주변이 다른 본을 따라가 찢어지므로 막는다
+	const TArray<FSkinnedVertex>& Vertices = Mesh.Vertices;
+	const float Tolerance = Settings.SkinWeightTolerance;
+	BuildLODs(Positions, Mesh.Indices, Mesh.GroupInfos, Settings, Mesh.LODs,
+		[&Vertices, Tolerance](uint32 From, uint32 To) { return GetBoneWeightDistance(Vertices[From], Vertices[To]) <= Tolerance; });
+
+	if (!Mesh.LODs.empty())
+	{
+		LogLODs("Skeletal", Mesh.CacheFilePath, static_cast<uint32>(Mesh.Indices.size() / 3), Mesh.LODs,
+			FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	}
+}
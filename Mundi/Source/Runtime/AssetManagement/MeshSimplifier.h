@@ -0,0 +1,55 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+#include <functional>
+
+struct FStaticMesh;
+struct FSkeletalMesh;
+struct FGroupInfo;
+struct FMeshLOD;
+
+/** 임포트 시 자동 LOD 생성 설정 (editor.ini로 덮어쓸 수 있음) */
+struct FMeshLODSettings
+{
+	int32 NumLODs = 4;					// LOD0 포함 최대 개수 (1이면 생성 안 함)
+	float TriangleRatio = 0.5f;			// LOD마다 직전 LOD 대비 목표 삼각형 비율
+	float MaxError = 0.02f;				// 허용 오차 (메시 바운드 대각선 길이 대비)
+	float FirstScreenSize = 0.5f;		// LOD1로 넘어가는 화면 크기 (화면 높이 대비 바운드 구 지름)
+	float ScreenSizeRatio = 0.5f;		// 다음 LOD 전환 화면 크기 = 직전 * 이 값
+	uint32 MinTriangles = 64;			// 이보다 작은 메시/LOD는 더 줄이지 않는다
+	float SkinWeightTolerance = 0.5f;	// 스켈레탈: 합쳐지는 두 정점의 본 가중치 차이(L1 / 2) 상한
+
+	// 기본값 + editor.ini (MeshLODCount, MeshLODTriangleRatio, MeshLODMaxError, MeshLODScreenSize)
+	static const FMeshLODSettings& Get();
+
+	// 임포터 버전에 섞어 설정이 바뀌면 캐시를 다시 만들게 한다
+	uint32 GetHash() const;
+};
+
+/**
+ * QEM(Garland & Heckbert 1997) 에지 축약 메시 단순화
+ * - 정점 제한 축약: 한 정점을 이웃 정점 위치로 합치기만 하므로 LOD는 LOD0 정점 버퍼를 그대로 쓰고 인덱스만 따로 가진다
+ * - 위치가 같은 정점(UV/법선 이음매)은 하나의 위상 정점으로 묶어 축약하고, 이음매의 각 정점이 반대쪽
+ *   대응 정점을 가질 때만 축약해 UV/법선 이음매가 찢어지지 않게 한다
+ * - 경계 에지는 수직 평면을 추가해 외곽선을 유지하고, 삼각형 법선이 뒤집히는 축약은 하지 않는다
+ * - 머티리얼 그룹은 삼각형 단위로 유지된다 (그룹 사이에서도 위치가 같으면 함께 움직임)
+ */
+class FMeshSimplifier
+{
+public:
+	// 두 정점을 합쳐도 되는지 (스켈레탈의 본 가중치처럼 위치 외 속성 제약). nullptr이면 위치만 본다
+	using FCanMergeFunc = std::function<bool(uint32 From, uint32 To)>;
+
+	// Indices의 삼각형을 TargetTriangles개 이하(또는 오차 한도)까지 줄인다
+	// OutIndices는 살아남은 삼각형을 원래 순서대로, OutSourceTriangles[i]는 OutIndices 삼각형 i의 원래 삼각형 번호
+	// 반환값은 적용된 축약의 최대 오차 (거리, 메시 단위)
+	static float Simplify(const TArray<FVector>& Positions, const TArray<uint32>& Indices, uint32 TargetTriangles, float MaxError,
+		TArray<uint32>& OutIndices, TArray<uint32>* OutSourceTriangles = nullptr, const FCanMergeFunc& CanMerge = nullptr);
+
+	// LOD0(Indices + GroupInfos)에서 LOD1..N을 연쇄로 만든다. 각 LOD의 섹션은 GroupInfos와 같은 순서
+	static void BuildLODs(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const TArray<FGroupInfo>& GroupInfos,
+		const FMeshLODSettings& Settings, TArray<FMeshLOD>& OutLODs, const FCanMergeFunc& CanMerge = nullptr);
+
+	static void GenerateStaticMeshLODs(FStaticMesh& Mesh, const FMeshLODSettings& Settings = FMeshLODSettings::Get());
+	static void GenerateSkeletalMeshLODs(FSkeletalMesh& Mesh, const FMeshLODSettings& Settings = FMeshLODSettings::Get());
+};
@@ -1,4 +1,15 @@
 ﻿#include "pch.h"
 #include "ResourceBase.h"
+#include "ResourceManager.h"
 
 IMPLEMENT_CLASS(UResourceBase)
+
+void UResourceBase::MarkUsed() const
+{
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	LastUsedFrame = ResourceManager.GetResidencyFrame();
+	if (bEvicted)
+	{
+		ResourceManager.RestoreEvicted(const_cast<UResourceBase*>(this));
+	}
+}
@@ -18,7 +18,32 @@ public:
 	std::filesystem::file_time_type GetLastModifiedTime() const { return LastModifiedTime; }
 	void SetLastModifiedTime(std::filesystem::file_time_type InTime) { LastModifiedTime = InTime; }
 
+	// UResourceManager::LoadAsync가 등록한 자리표시자인 동안 true (메인 스레드 업로드가 끝나면 false)
+	// 축출된 리소스도 다시 올라올 때까지 true
+	bool IsPendingLoad() const { return bPendingLoad; }
+	void SetPendingLoad(bool bInPendingLoad) { bPendingLoad = bInPendingLoad; if (!bInPendingLoad) { bEvicted = false; } }
+
+	// --- 상주(Residency) 추적 (UResourceManager::TickResidency) ---
+	// 렌더링에 쓰일 때 호출 (LRU 기준 프레임 갱신). 축출된 리소스면 다시 로드를 요청한다
+	void MarkUsed() const;
+	uint64 GetLastUsedFrame() const { return LastUsedFrame; }
+
+	bool IsEvicted() const { return bEvicted; }
+	void SetEvicted() { bEvicted = true; bPendingLoad = true; }
+
+	// 메모리 추정치 (바이트). CPU: 리소스가 참조하는 원본/디코드 데이터, GPU: 버퍼/텍스처
+	virtual uint64 GetCPUBytes() const { return 0; }
+	virtual uint64 GetGPUBytes() const { return 0; }
+	// 파일에서 다시 만들 수 있는 리소스만 축출 대상
+	virtual bool CanEvict() const { return false; }
+	// 상주 데이터만 내려놓는다 (객체는 그대로 남으므로 포인터를 들고 있는 쪽은 계속 유효)
+	virtual void EvictResidentData() {}
+
 protected:
 	FString FilePath;	// 원본 파일의 경로이자, UResourceManager에 등록된 Key 
 	std::filesystem::file_time_type LastModifiedTime;
+	bool bPendingLoad = false;
+
+	mutable uint64 LastUsedFrame = 0;
+	bool bEvicted = false;
 };
\ No newline at end of file
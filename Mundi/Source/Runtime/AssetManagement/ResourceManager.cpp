@@ -7,16 +7,24 @@
 #include "FbxManager.h"
 #include "Quad.h"
 #include "MeshBVH.h"
+#include "BackgroundTasks.h"
 #include "Enums.h"
 #include "FbxImportOptions.h"
 #include "SkeletalMesh.h"
+#include "StaticMeshComponent.h"
+#include "ObjectIterator.h"
+#include "PlatformTime.h"
 
 #include <filesystem>
 #include <cwctype>
 #include <algorithm>
+#include <limits>
 
 IMPLEMENT_CLASS(UResourceManager)
 
+DEFINE_LOG_CATEGORY_STATIC(LogAsyncLoad, Log)
+DEFINE_LOG_CATEGORY_STATIC(LogResidency, Log)
+
 #define GRIDNUM 100
 #define AXISLENGTH 100
 
@@ -39,6 +47,7 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
 {
     Device = InDevice;
     Resources.SetNum(static_cast<uint8>(ResourceType::End));
+    ResolvedPaths.SetNum(static_cast<uint8>(ResourceType::End));
 
     Context = InContext;
     //CreateGridMesh(GRIDNUM,"Grid");
@@ -53,11 +62,32 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
     CreateTextBillboardTexture();
     CreateDefaultShader();
     CreateDefaultMaterial();
+
+    // 상주 메모리 예산 (editor.ini ResidencyBudgetMB, 0이거나 없으면 무제한)
+    if (FString* BudgetValue = EditorINI.Find("ResidencyBudgetMB"))
+    {
+        try
+        {
+            SetResidencyBudget(static_cast<uint64>(std::max(0.0, std::stod(*BudgetValue))) * 1024 * 1024);
+        }
+        catch (...)
+        {
+            UE_LOG_CAT(LogResidency, Warning, "Invalid ResidencyBudgetMB '%s'", BudgetValue->c_str());
+        }
+    }
 }
 
 // 전체 해제
 void UResourceManager::Clear()
 {
+    // 진행 중인 비동기 로드는 업로드 없이 정리하고, 백그라운드 BVH 빌드가 메시/BVH를 참조하므로 먼저 끝낸다
+    for (auto& Pair : AsyncLoadRequests)
+    {
+        Pair.second->bCancelRequested.store(true, std::memory_order_release);
+    }
+    FlushAsyncLoads();
+    FlushMeshBVHBuilds();
+
     {////////////// Deprecated //////////////
         for (auto& [Key, Data] : ResourceMap)
         {
@@ -105,7 +135,7 @@ void UResourceManager::Clear()
         // Mesh BVH cache clear
         for (auto& Pair : MeshBVHCache)
         {
-            delete Pair.second;
+            delete Pair.second.BVH;
         }
         MeshBVHCache.clear();
     }
@@ -124,30 +154,604 @@ void UResourceManager::Clear()
     }
     Resources.Empty();
 
+    // FResourcePath 캐시와 TResourceHandle이 들고 있는 포인터를 무효화
+    for (auto& Slots : ResolvedPaths)
+    {
+        Slots.Empty();
+    }
+    ++ResourceGeneration;
+
     // Instance lifetime is managed by ObjectFactory
 }
 
-FMeshBVH* UResourceManager::GetMeshBVH(const FString& ObjPath)
+FMeshBVH* UResourceManager::GetMeshBVH(uint64 GeometryHash)
 {
-    if (auto* Found = MeshBVHCache.Find(ObjPath))
-        return *Found;
+    std::lock_guard<std::mutex> Lock(MeshBVHMutex);
+    if (FMeshBVHEntry* Found = MeshBVHCache.Find(GeometryHash))
+        return Found->BVH;
     return nullptr;
 }
 
-FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FStaticMesh* StaticMeshAsset)
+FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FStaticMesh* StaticMeshAsset)
 {
-    if (auto* Found = MeshBVHCache.Find(ObjPath))
-        return *Found;
-
     if (!StaticMeshAsset)
         return nullptr;
 
+    // 임포트 경로를 거치지 않은 메시는 해시가 비어 있을 수 있다
+    const uint64 Key = StaticMeshAsset->GeometryHash != 0
+        ? StaticMeshAsset->GeometryHash
+        : FMeshBVH::ComputeGeometryHash(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+
+    {
+        std::unique_lock<std::mutex> Lock(MeshBVHMutex);
+        // unordered_map 노드는 rehash에도 주소가 유지되므로 참조를 들고 기다려도 된다
+        FMeshBVHEntry& Entry = MeshBVHCache[Key];
+        MeshBVHBuiltCondition.wait(Lock, [&Entry]() { return !Entry.bBuilding; });
+        if (Entry.BVH)
+            return Entry.BVH;
+        Entry.bBuilding = true;
+    }
+
+    // 빌드는 잠금 밖에서 (다른 메시의 조회/등록을 막지 않음)
     FMeshBVH* NewBVH = new FMeshBVH();
     NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
-    MeshBVHCache.Add(ObjPath, NewBVH);
+
+    {
+        std::lock_guard<std::mutex> Lock(MeshBVHMutex);
+        FMeshBVHEntry& Entry = MeshBVHCache[Key];
+        Entry.BVH = NewBVH;
+        Entry.bBuilding = false;
+    }
+    MeshBVHBuiltCondition.notify_all();
     return NewBVH;
 }
 
+FMeshBVH* UResourceManager::RegisterMeshBVH(uint64 GeometryHash, FMeshBVH* InBVH)
+{
+    if (!InBVH)
+        return GetMeshBVH(GeometryHash);
+
+    std::unique_lock<std::mutex> Lock(MeshBVHMutex);
+    FMeshBVHEntry& Entry = MeshBVHCache[GeometryHash];
+    MeshBVHBuiltCondition.wait(Lock, [&Entry]() { return !Entry.bBuilding; });
+    if (Entry.BVH)
+    {
+        delete InBVH;
+        return Entry.BVH;
+    }
+    Entry.BVH = InBVH;
+    return InBVH;
+}
+
+void UResourceManager::RequestMeshBVHBuild(const FStaticMesh* StaticMeshAsset, std::function<void(const FMeshBVH&)> OnBuilt)
+{
+    if (!StaticMeshAsset || StaticMeshAsset->Indices.size() < 3)
+        return;
+
+    // 같은 지오메트리의 BVH가 이미 있거나 피킹이 먼저 메인 스레드에서 빌드했다면
+    // GetOrBuildMeshBVH가 그것을 돌려주므로 이 작업은 OnBuilt(캐시 저장)만 한다
+    FBackgroundTasks::GetInstance().Enqueue([this, StaticMeshAsset, OnBuilt = std::move(OnBuilt)]()
+    {
+        const FMeshBVH* BVH = GetOrBuildMeshBVH(StaticMeshAsset);
+        if (BVH && OnBuilt)
+        {
+            OnBuilt(*BVH);
+        }
+    }, ETaskPriority::Low);
+}
+
+void UResourceManager::FlushMeshBVHBuilds()
+{
+    FBackgroundTasks::GetInstance().Flush();
+}
+
+// 메시가 채워지면 그 메시를 들고 있는 컴포넌트가 머티리얼 슬롯/바운드를 갱신하도록 알린다
+static void NotifyStaticMeshLoaded(UStaticMesh* StaticMesh)
+{
+    for (TObjectIterator<UStaticMeshComponent> It; It; ++It)
+    {
+        UStaticMeshComponent* Component = *It;
+        if (Component && Component->GetStaticMesh() == StaticMesh)
+        {
+            Component->OnStaticMeshLoaded();
+        }
+    }
+}
+
+void UResourceManager::SetupAsyncLoad(FAsyncLoadRequest& Request, UTexture* Resource, bool bSRGB)
+{
+    // 워커: DDS 캐시 확인/변환 + 파일 매핑, 메인: 매핑된 바이트로 텍스처 생성
+    std::shared_ptr<FTextureSourceData> SourceData = std::make_shared<FTextureSourceData>();
+    Request.LoadOnWorker = [Path = Request.Path, bSRGB, SourceData]()
+    {
+        return UTexture::ReadSourceData(Path, bSRGB, *SourceData);
+    };
+    Request.FinishOnMainThread = [this, Resource, SourceData](bool bCanceled)
+    {
+        const bool bCreated = !bCanceled && Resource->CreateFromSourceData(*SourceData, Device);
+        SourceData->File.reset();
+        return bCreated;
+    };
+}
+
+void UResourceManager::SetupAsyncLoad(FAsyncLoadRequest& Request, UStaticMesh* Resource)
+{
+    const FString Path = Request.Path;
+    FString Extension = std::filesystem::path(Path).extension().string();
+    std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+
+    // FBX SDK와 임포트 중 만드는 임시 UObject는 스레드 안전하지 않으므로 FBX는 업로드 시점에 메인 스레드에서 로드
+    if (Extension != ".obj")
+    {
+        Request.FinishOnMainThread = [this, Resource, Path](bool bCanceled)
+        {
+            if (bCanceled)
+            {
+                return false;
+            }
+            Resource->Load(Path, Device);
+            NotifyStaticMeshLoaded(Resource);
+            return Resource->GetStaticMeshAsset() != nullptr;
+        };
+        return;
+    }
+
+    // OBJ: 워커에서 캐시 로드(또는 임포트) + 텍스처 경로 해석, 메인에서 머티리얼 등록 + 버퍼 업로드
+    std::shared_ptr<FObjStaticMeshImport> Import = std::make_shared<FObjStaticMeshImport>();
+    if (!FObjManager::FindObjStaticMeshAsset(Path))
+    {
+        Request.LoadOnWorker = [Path, Import]()
+        {
+            return FObjManager::ImportObjStaticMeshData(Path, *Import);
+        };
+    }
+
+    FAsyncLoadRequest* RequestPtr = &Request;
+    Request.FinishOnMainThread = [this, Resource, Path, Import, RequestPtr](bool bCanceled)
+    {
+        if (bCanceled)
+        {
+            delete Import->Mesh;
+            Import->Mesh = nullptr;
+            return false;
+        }
+
+        FStaticMesh* StaticMeshAsset = nullptr;
+        if (Import->Mesh)
+        {
+            // 머티리얼이 ResolveTextures에서 동기 로드하지 않도록 텍스처를 먼저 같은 우선순위로 요청해 둔다
+            // (머티리얼은 자리표시자를 받고, 텍스처가 올라오면 같은 객체가 채워짐)
+            for (const FMaterialInfo& MaterialInfo : Import->MaterialInfos)
+            {
+                if (Get<UMaterial>(MaterialInfo.MaterialName))
+                {
+                    continue;
+                }
+                for (const FString* TexturePath : { &MaterialInfo.DiffuseTextureFileName, &MaterialInfo.NormalTextureFileName })
+                {
+                    TAsyncLoadHandle<UTexture> Texture = LoadAsync<UTexture>(*TexturePath, RequestPtr->Priority, true);
+                    if (Texture.IsValid() && !Texture.IsDone())
+                    {
+                        RequestPtr->Dependencies.Add(Texture.GetRequest());
+                    }
+                }
+            }
+            StaticMeshAsset = FObjManager::RegisterObjStaticMeshData(Path, *Import);
+        }
+        else
+        {
+            StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(Path);
+        }
+
+        if (!StaticMeshAsset)
+        {
+            return false;
+        }
+
+        {
+            PROFILE_SCOPE("AsyncLoad_MeshUpload");
+            Resource->LoadFromAsset(StaticMeshAsset, Device);
+        }
+        NotifyStaticMeshLoaded(Resource);
+        return true;
+    };
+}
+
+void UResourceManager::ScheduleAsyncLoad(const std::shared_ptr<FAsyncLoadRequest>& Request)
+{
+    // 워커 단계가 없는 타입은 바로 업로드 대기
+    if (!Request->LoadOnWorker)
+    {
+        Request->bLoadedOnWorker = true;
+        Request->State.store(EAsyncLoadState::ReadyToUpload, std::memory_order_release);
+        return;
+    }
+
+    FBackgroundTasks::GetInstance().Enqueue([Request]()
+    {
+        // 우선순위를 올리며 다시 넣은 작업이면 먼저 꺼낸 쪽만 실행한다
+        EAsyncLoadState Expected = EAsyncLoadState::Queued;
+        if (!Request->State.compare_exchange_strong(Expected, EAsyncLoadState::Loading, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        if (Request->bCancelRequested.load(std::memory_order_acquire))
+        {
+            Request->bSkippedOnWorker = true;
+        }
+        else
+        {
+            PROFILE_SCOPE("AsyncLoad_Worker");
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Request->bLoadedOnWorker = Request->LoadOnWorker();
+            Request->WorkerCycles = FPlatformTime::Cycles64() - StartCycles;
+        }
+        Request->State.store(EAsyncLoadState::ReadyToUpload, std::memory_order_release);
+    }, Request->Priority);
+}
+
+void UResourceManager::FinishAsyncLoad(const std::shared_ptr<FAsyncLoadRequest>& Request)
+{
+    const bool bCanceled = Request->bCancelRequested.load(std::memory_order_acquire);
+
+    // 워커가 취소로 건너뛴 뒤 다시 요청된 경우: 처음부터 다시 예약
+    if (Request->bSkippedOnWorker && !bCanceled)
+    {
+        Request->bSkippedOnWorker = false;
+        Request->State.store(EAsyncLoadState::Queued, std::memory_order_release);
+        ScheduleAsyncLoad(Request);
+        return;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    EAsyncLoadState FinalState = EAsyncLoadState::Failed;
+    if (bCanceled)
+    {
+        // 워커 결과만 정리하고 업로드는 하지 않는다
+        if (Request->bLoadedOnWorker)
+        {
+            Request->FinishOnMainThread(true);
+        }
+        FinalState = EAsyncLoadState::Canceled;
+    }
+    else if (Request->bLoadedOnWorker)
+    {
+        PROFILE_SCOPE("AsyncLoad_Upload");
+        FinalState = Request->FinishOnMainThread(false) ? EAsyncLoadState::Completed : EAsyncLoadState::Failed;
+    }
+
+    const double UploadMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    AsyncLoadStats.TotalWorkerMilliseconds += FPlatformTime::ToMilliseconds(Request->WorkerCycles);
+    AsyncLoadStats.TotalUploadMilliseconds += UploadMilliseconds;
+    AsyncLoadStats.MaxUploadMilliseconds = std::max(AsyncLoadStats.MaxUploadMilliseconds, UploadMilliseconds);
+
+    switch (FinalState)
+    {
+    case EAsyncLoadState::Completed:
+        ++AsyncLoadStats.NumCompleted;
+        break;
+    case EAsyncLoadState::Canceled:
+        ++AsyncLoadStats.NumCanceled;
+        break;
+    default:
+        ++AsyncLoadStats.NumFailed;
+        UE_LOG_CAT(LogAsyncLoad, Warning, "Failed to load '%s'", Request->Path.c_str());
+        break;
+    }
+
+    // 취소된 자리표시자는 등록된 채 남겨 두고, 다음 Load/LoadAsync가 같은 객체에 다시 로드한다
+    if (FinalState != EAsyncLoadState::Canceled)
+    {
+        Request->Resource->SetPendingLoad(false);
+        Request->Resource->MarkUsed();
+    }
+    AsyncLoadRequests.Remove(Request->Resource);
+    Request->State.store(FinalState, std::memory_order_release);
+
+    TArray<std::function<void(UResourceBase*)>> Callbacks = std::move(Request->OnCompleted);
+    Request->OnCompleted.Empty();
+    for (std::function<void(UResourceBase*)>& Callback : Callbacks)
+    {
+        Callback(Request->Resource);
+    }
+}
+
+void UResourceManager::TickAsyncLoads(double BudgetMilliseconds)
+{
+    PROFILE_SCOPE("AsyncLoad_Tick");
+
+    if (AsyncLoadRequests.IsEmpty())
+    {
+        return;
+    }
+
+    TArray<std::shared_ptr<FAsyncLoadRequest>> ReadyRequests;
+    for (auto& Pair : AsyncLoadRequests)
+    {
+        if (Pair.second->State.load(std::memory_order_acquire) == EAsyncLoadState::ReadyToUpload)
+        {
+            ReadyRequests.Add(Pair.second);
+        }
+    }
+    std::sort(ReadyRequests.begin(), ReadyRequests.end(),
+        [](const std::shared_ptr<FAsyncLoadRequest>& A, const std::shared_ptr<FAsyncLoadRequest>& B)
+        {
+            if (A->Priority != B->Priority)
+                return A->Priority < B->Priority;
+            return A->Sequence < B->Sequence;
+        });
+
+    // 업로드는 한 프레임에 예산만큼만 (큰 에셋 여러 개가 한 프레임에 몰려 히치가 생기지 않도록)
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    int32 NumFinished = 0;
+    for (const std::shared_ptr<FAsyncLoadRequest>& Request : ReadyRequests)
+    {
+        if (0 < NumFinished && BudgetMilliseconds <= FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles))
+        {
+            break;
+        }
+        FinishAsyncLoad(Request);
+        ++NumFinished;
+    }
+
+    const double TickMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    AsyncLoadStats.MaxTickMilliseconds = std::max(AsyncLoadStats.MaxTickMilliseconds, TickMilliseconds);
+    PROFILE_COUNTER("AsyncLoad_Uploaded", NumFinished);
+    PROFILE_COUNTER("AsyncLoad_Pending", AsyncLoadRequests.Num());
+}
+
+void UResourceManager::FlushAsyncLoads()
+{
+    // 업로드 중에 의존 에셋 요청이 새로 생길 수 있으므로 빌 때까지 반복
+    while (!AsyncLoadRequests.IsEmpty())
+    {
+        FBackgroundTasks::GetInstance().Flush();
+        TickAsyncLoads(std::numeric_limits<double>::max());
+    }
+}
+
+void UResourceManager::DumpAsyncLoadStats()
+{
+    int32 NumByState[static_cast<int32>(EAsyncLoadState::Canceled) + 1] = {};
+    for (auto& Pair : AsyncLoadRequests)
+    {
+        ++NumByState[static_cast<int32>(Pair.second->State.load(std::memory_order_acquire))];
+    }
+
+    const int32 NumFinished = AsyncLoadStats.NumCompleted + AsyncLoadStats.NumFailed + AsyncLoadStats.NumCanceled;
+    UE_LOG("[AsyncLoad] Pending %d (Queued %d, Loading %d, ReadyToUpload %d), background tasks %d on %d threads",
+        AsyncLoadRequests.Num(), NumByState[static_cast<int32>(EAsyncLoadState::Queued)],
+        NumByState[static_cast<int32>(EAsyncLoadState::Loading)], NumByState[static_cast<int32>(EAsyncLoadState::ReadyToUpload)],
+        FBackgroundTasks::GetInstance().GetNumPending(), FBackgroundTasks::GetInstance().GetNumThreads());
+    UE_LOG("[AsyncLoad] Completed %d, Failed %d, Canceled %d", AsyncLoadStats.NumCompleted, AsyncLoadStats.NumFailed, AsyncLoadStats.NumCanceled);
+    if (0 < NumFinished)
+    {
+        UE_LOG("[AsyncLoad] Worker avg %.2f ms, upload avg %.2f ms / max %.2f ms, max tick %.2f ms",
+            AsyncLoadStats.TotalWorkerMilliseconds / NumFinished, AsyncLoadStats.TotalUploadMilliseconds / NumFinished,
+            AsyncLoadStats.MaxUploadMilliseconds, AsyncLoadStats.MaxTickMilliseconds);
+    }
+}
+
+void UResourceManager::CollectResourceReferences(TMap<const UResourceBase*, int32>& OutReferences)
+{
+    // 컴포넌트가 들고 있는 메시와 그 머티리얼 슬롯의 텍스처 (화면 밖에 있어도 월드에 있으면 내리지 않는다)
+    for (TObjectIterator<UMeshComponent> It; It; ++It)
+    {
+        UMeshComponent* Component = *It;
+        if (!Component)
+        {
+            continue;
+        }
+
+        if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
+        {
+            if (UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh())
+            {
+                ++OutReferences[StaticMesh];
+            }
+        }
+
+        for (UMaterialInterface* Material : Component->GetMaterialSlots())
+        {
+            if (!Material)
+            {
+                continue;
+            }
+            for (uint8 Slot = 0; Slot < static_cast<uint8>(EMaterialTextureSlot::Max); ++Slot)
+            {
+                if (UTexture* Texture = Material->GetTexture(static_cast<EMaterialTextureSlot>(Slot)))
+                {
+                    ++OutReferences[Texture];
+                }
+            }
+        }
+    }
+}
+
+void UResourceManager::TickResidency()
+{
+    ++ResidencyFrame;
+    if (ResidencyBudgetBytes == 0 || ResidencyFrame % ResidencyCheckInterval != 0)
+    {
+        return;
+    }
+
+    PROFILE_SCOPE("Residency_Tick");
+
+    uint64 TotalGPUBytes = 0;
+    for (auto& TypeResources : Resources)
+    {
+        for (auto& Pair : TypeResources)
+        {
+            if (Pair.second)
+            {
+                TotalGPUBytes += Pair.second->GetGPUBytes();
+            }
+        }
+    }
+    PROFILE_COUNTER("Residency_GPUMB", static_cast<int32>(TotalGPUBytes / (1024 * 1024)));
+
+    if (ResidencyBudgetBytes < TotalGPUBytes)
+    {
+        EvictUnusedResources(TotalGPUBytes - ResidencyBudgetBytes);
+    }
+}
+
+uint64 UResourceManager::EvictUnusedResources(uint64 BytesToFree)
+{
+    TMap<const UResourceBase*, int32> References;
+    CollectResourceReferences(References);
+
+    TArray<UResourceBase*> Candidates;
+    for (auto& TypeResources : Resources)
+    {
+        for (auto& Pair : TypeResources)
+        {
+            UResourceBase* Resource = Pair.second;
+            if (!Resource || !Resource->CanEvict() || Resource->IsPendingLoad() || References.Contains(Resource))
+            {
+                continue;
+            }
+            if (ResidencyFrame - Resource->GetLastUsedFrame() < ResidencyMinUnusedFrames)
+            {
+                continue;
+            }
+            Candidates.Add(Resource);
+        }
+    }
+
+    // 가장 오래 쓰이지 않은 것부터
+    std::sort(Candidates.begin(), Candidates.end(),
+        [](const UResourceBase* A, const UResourceBase* B)
+        {
+            return A->GetLastUsedFrame() < B->GetLastUsedFrame();
+        });
+
+    uint64 FreedBytes = 0;
+    int32 NumEvicted = 0;
+    for (UResourceBase* Resource : Candidates)
+    {
+        if (0 < BytesToFree && BytesToFree <= FreedBytes)
+        {
+            break;
+        }
+        FreedBytes += Resource->GetGPUBytes();
+        Resource->EvictResidentData();
+        Resource->SetEvicted();
+        ++NumEvicted;
+    }
+
+    if (0 < NumEvicted)
+    {
+        ResidencyStats.NumEvicted += NumEvicted;
+        ResidencyStats.EvictedBytes += FreedBytes;
+        UE_LOG_CAT(LogResidency, Log, "Evicted %d resources (%.2f MB)", NumEvicted, FreedBytes / (1024.0 * 1024.0));
+    }
+    if (FreedBytes < BytesToFree)
+    {
+        UE_LOG_CAT(LogResidency, Warning, "Over budget by %.2f MB with no more unreferenced resources to evict",
+            (BytesToFree - FreedBytes) / (1024.0 * 1024.0));
+    }
+    return FreedBytes;
+}
+
+void UResourceManager::RestoreEvicted(UResourceBase* Resource)
+{
+    // 이미 다시 올리는 중이면 무시 (한 프레임에 여러 번 그려져도 요청은 하나)
+    if (!Resource || !Resource->IsEvicted() || AsyncLoadRequests.Contains(Resource))
+    {
+        return;
+    }
+
+    if (UTexture* Texture = Cast<UTexture>(Resource))
+    {
+        LoadAsync<UTexture>(Texture->GetFilePath(), ETaskPriority::High, Texture->IsSRGB());
+    }
+    else if (Cast<UStaticMesh>(Resource))
+    {
+        LoadAsync<UStaticMesh>(Resource->GetFilePath(), ETaskPriority::High);
+    }
+    else
+    {
+        return;
+    }
+    ++ResidencyStats.NumRestored;
+}
+
+void UResourceManager::DumpResidency(int32 MaxEntries)
+{
+    static const char* TypeNames[] = { "None", "StaticMesh", "SkeletalMesh", "Quad", "DynamicMesh", "Shader", "Texture", "Material", "Sound" };
+    static_assert(sizeof(TypeNames) / sizeof(TypeNames[0]) == static_cast<size_t>(ResourceType::End), "ResourceType names out of date");
+
+    TMap<const UResourceBase*, int32> References;
+    CollectResourceReferences(References);
+
+    uint64 TotalCPUBytes = 0;
+    uint64 TotalGPUBytes = 0;
+    TArray<UResourceBase*> Candidates;
+
+    UE_LOG("[Residency] %-12s %6s %8s %7s %10s %10s", "Type", "Count", "Resident", "Evicted", "CPU MB", "GPU MB");
+    for (int32 TypeIndex = 0; TypeIndex < Resources.Num(); ++TypeIndex)
+    {
+        int32 NumResident = 0;
+        int32 NumEvicted = 0;
+        uint64 CPUBytes = 0;
+        uint64 GPUBytes = 0;
+        for (auto& Pair : Resources[TypeIndex])
+        {
+            UResourceBase* Resource = Pair.second;
+            if (!Resource)
+            {
+                continue;
+            }
+            Resource->IsEvicted() ? ++NumEvicted : ++NumResident;
+            CPUBytes += Resource->GetCPUBytes();
+            GPUBytes += Resource->GetGPUBytes();
+            if (Resource->CanEvict() && !Resource->IsPendingLoad() && !References.Contains(Resource))
+            {
+                Candidates.Add(Resource);
+            }
+        }
+        if (NumResident + NumEvicted == 0)
+        {
+            continue;
+        }
+        TotalCPUBytes += CPUBytes;
+        TotalGPUBytes += GPUBytes;
+        UE_LOG("[Residency] %-12s %6d %8d %7d %10.2f %10.2f", TypeNames[TypeIndex], NumResident + NumEvicted, NumResident, NumEvicted,
+            CPUBytes / (1024.0 * 1024.0), GPUBytes / (1024.0 * 1024.0));
+    }
+
+    if (ResidencyBudgetBytes == 0)
+    {
+        UE_LOG("[Residency] Total CPU %.2f MB, GPU %.2f MB (budget: unlimited), frame %llu",
+            TotalCPUBytes / (1024.0 * 1024.0), TotalGPUBytes / (1024.0 * 1024.0), ResidencyFrame);
+    }
+    else
+    {
+        UE_LOG("[Residency] Total CPU %.2f MB, GPU %.2f MB / budget %.2f MB (%.1f%%), frame %llu",
+            TotalCPUBytes / (1024.0 * 1024.0), TotalGPUBytes / (1024.0 * 1024.0), ResidencyBudgetBytes / (1024.0 * 1024.0),
+            100.0 * TotalGPUBytes / ResidencyBudgetBytes, ResidencyFrame);
+    }
+    UE_LOG("[Residency] Evicted %d (%.2f MB) so far, restored %d, referenced resources %d",
+        ResidencyStats.NumEvicted, ResidencyStats.EvictedBytes / (1024.0 * 1024.0), ResidencyStats.NumRestored, References.Num());
+
+    // 다음에 축출될 후보 (오래 쓰이지 않은 순서)
+    std::sort(Candidates.begin(), Candidates.end(),
+        [](const UResourceBase* A, const UResourceBase* B)
+        {
+            return A->GetLastUsedFrame() < B->GetLastUsedFrame();
+        });
+    const int32 NumShown = std::min(MaxEntries, Candidates.Num());
+    for (int32 Index = 0; Index < NumShown; ++Index)
+    {
+        const UResourceBase* Resource = Candidates[Index];
+        UE_LOG("[Residency]   LRU %2d: %8.2f MB, unused %llu frames  %s", Index,
+            Resource->GetGPUBytes() / (1024.0 * 1024.0), ResidencyFrame - Resource->GetLastUsedFrame(), Resource->GetFilePath().c_str());
+    }
+}
+
 void UResourceManager::SetStaticMeshs()
 {
     StaticMeshs = GetAll<UStaticMesh>();
@@ -556,6 +1160,14 @@ void UResourceManager::InitShaderILMap()
 	ShaderToInputLayoutMap["Shaders/Shadows/DepthOnly_VS.hlsl"] = layout;
     layout.clear();
 
+    // 발사체 인스턴싱: 슬롯 0은 메시 정점(FVertexDynamic), 슬롯 1은 인스턴스별 데이터
+    layout.Add({ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    layout.Add({ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    layout.Add({ "INSTANCE_POSRADIUS", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+    layout.Add({ "INSTANCE_COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+    ShaderToInputLayoutMap["Shaders/Effects/ProjectileInstanced.hlsl"] = layout;
+    layout.clear();
+
     layout.Add({ "WORLDPOSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
     layout.Add({ "SIZE", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 });
     layout.Add({ "UVRECT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 });
@@ -11,6 +11,12 @@
 #include "../Engine/Audio/Sound.h"
 #include "Quad.h"
 #include "LineDynamicMesh.h"
+#include "AsyncLoading.h"
+#include "ResourcePath.h"
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 
 #pragma once
 #include "ObjectFactory.h"
@@ -51,12 +57,48 @@ public:
 	template<typename T>
 	T* Get(const FString& InFilePath);
 
+	// FResourcePath 오버로드: 경로 Id로 바로 찾는다 (처음 한 번만 문자열 경로로 찾고 결과를 기억함)
+	// 매 프레임 호출하는 곳은 경로를 FResourcePath로 들고 이쪽을 쓰거나, TResourceHandle을 캐시한다
+	template<typename T, typename... Args>
+	T* Load(const FResourcePath& InPath, Args&&... InArgs);
+
+	template<typename T>
+	T* Get(const FResourcePath& InPath);
+
+	// Clear()마다 바뀐다 (TResourceHandle이 캐시한 포인터가 아직 유효한지 확인용)
+	uint32 GetResourceGeneration() const { return ResourceGeneration; }
+
 	template<typename T>
 	TArray<T*> GetAll();
 
 	template<typename T>
 	TArray<FString> GetAllFilePaths();
 
+	// --- 비동기 로드 (메인 스레드에서만 호출) ---
+	// 파일 읽기/파싱/디코드는 백그라운드 스레드에서, 디바이스 업로드는 TickAsyncLoads에서 한다
+	// 핸들의 Get()은 바로 등록되는 자리표시자 (완료되면 같은 객체가 채워지므로 포인터를 그대로 들고 있어도 됨)
+	// 로드 중인 경로를 다시 요청하면 같은 요청을 공유하고, 더 높은 우선순위면 우선순위를 올린다
+	template<typename T, typename... Args>
+	TAsyncLoadHandle<T> LoadAsync(const FString& InFilePath, ETaskPriority Priority = ETaskPriority::Normal, Args&&... InArgs);
+	// 워커가 끝낸 요청을 우선순위 순서로 업로드 (예산을 넘으면 다음 프레임으로 미룸. 최소 1개는 처리)
+	void TickAsyncLoads(double BudgetMilliseconds = 2.0);
+	// 대기 중인 비동기 로드를 모두 끝낸다 (의존 에셋 포함)
+	void FlushAsyncLoads();
+	int32 GetNumPendingAsyncLoads() const { return AsyncLoadRequests.Num(); }
+	void DumpAsyncLoadStats();
+
+	// --- 상주 메모리 예산 (메인 스레드에서만 호출) ---
+	// GPU 추정 바이트 합이 예산을 넘으면, 참조되지 않고 오래 쓰이지 않은 리소스부터 GPU 데이터를 내린다 (LRU)
+	// 객체는 남으므로 포인터는 계속 유효하고, 다시 쓰이면(MarkUsed) 같은 객체로 LoadAsync가 다시 걸린다
+	void TickResidency();
+	void SetResidencyBudget(uint64 InBudgetBytes) { ResidencyBudgetBytes = InBudgetBytes; }	// 0이면 무제한
+	uint64 GetResidencyBudget() const { return ResidencyBudgetBytes; }
+	uint64 GetResidencyFrame() const { return ResidencyFrame; }
+	// 축출 후보를 오래된 순서로 BytesToFree 이상 내린다 (0이면 후보 전부). 실제로 내린 GPU 바이트 반환
+	uint64 EvictUnusedResources(uint64 BytesToFree);
+	void RestoreEvicted(UResourceBase* Resource);
+	void DumpResidency(int32 MaxEntries = 10);
+
 	template<typename T>
 	ResourceType GetResourceType();
 
@@ -86,8 +128,17 @@ public:
 	void CreateTextBillboardTexture();
 
 	// --- 캐시 관리 ---
-	FMeshBVH* GetMeshBVH(const FString& ObjPath);
-	FMeshBVH* GetOrBuildMeshBVH(const FString& ObjPath, const struct FStaticMesh* StaticMeshAsset);
+	// 메시 BVH 캐시는 FStaticMesh::GeometryHash로 찾는다 (경로가 달라도 지오메트리가 같으면 공유)
+	// 임포트/백그라운드 스레드에서도 호출되므로 내부에서 잠근다
+	FMeshBVH* GetMeshBVH(uint64 GeometryHash);
+	// 없으면 호출 스레드에서 바로 빌드한다. 백그라운드에서 빌드 중이면 끝날 때까지 기다린다
+	FMeshBVH* GetOrBuildMeshBVH(const struct FStaticMesh* StaticMeshAsset);
+	// 캐시 파일에서 읽은 BVH 등록 (소유권을 넘겨받음. 이미 있으면 InBVH를 지우고 기존 것을 반환)
+	FMeshBVH* RegisterMeshBVH(uint64 GeometryHash, FMeshBVH* InBVH);
+	// BVH가 없으면 백그라운드에서 빌드하고, 끝나면 OnBuilt를 백그라운드 스레드에서 호출 (캐시 파일 갱신용)
+	// StaticMeshAsset은 FlushMeshBVHBuilds() 전까지 살아 있어야 한다
+	void RequestMeshBVHBuild(const struct FStaticMesh* StaticMeshAsset, std::function<void(const FMeshBVH&)> OnBuilt);
+	void FlushMeshBVHBuilds();
 	void SetStaticMeshs();
 	const TArray<UStaticMesh*>& GetStaticMeshs() { return StaticMeshs; }
 
@@ -121,7 +172,7 @@ protected:
 	ID3D11DeviceContext* Context = nullptr;
 
 	//Resource Type의 개수만큼 Array 생성 및 저장
-	TArray<TMap<FString, UResourceBase*>> Resources;
+	TArray<TFlatMap<FString, UResourceBase*>> Resources;
 
 	TMap<FString, TArray<D3D11_INPUT_ELEMENT_DESC>> ShaderToInputLayoutMap;
 	TMap<FString, FString> TextureToShaderMap;
@@ -136,11 +187,64 @@ protected:
 	TMap<FWideString, FTextureData*> TextureMap;
 
 private:
+	// LoadAsync 타입별 워커/메인 단계 설정 (전용 오버로드가 없는 타입은 업로드 시점에 메인 스레드에서 Load를 호출)
+	template<typename T, typename... Args>
+	void SetupAsyncLoad(FAsyncLoadRequest& Request, T* Resource, Args&&... InArgs);
+	void SetupAsyncLoad(FAsyncLoadRequest& Request, UTexture* Resource, bool bSRGB = true);
+	void SetupAsyncLoad(FAsyncLoadRequest& Request, UStaticMesh* Resource);
+	void ScheduleAsyncLoad(const std::shared_ptr<FAsyncLoadRequest>& Request);
+	void FinishAsyncLoad(const std::shared_ptr<FAsyncLoadRequest>& Request);
+	// FResourcePath Id에 대응하는 캐시 칸 (없으면 늘림)
+	UResourceBase*& FindResolvedSlot(uint8 TypeIndex, uint32 PathId);
+
+	// 월드의 컴포넌트가 들고 있는 리소스별 참조 수 (참조가 있으면 축출하지 않음)
+	void CollectResourceReferences(TMap<const UResourceBase*, int32>& OutReferences);
+
 	// --- 비공개 멤버 변수 ---
 	TMap<FString, UMaterial*> MaterialMap;
 
-	// Cache for per-mesh BVHs to avoid rebuilding for identical OBJ assets
-	TMap<FString, FMeshBVH*> MeshBVHCache;
+	// 타입별 FResourcePath Id → 리소스 (Resources의 캐시. 리소스는 Clear 전까지 지워지지 않으므로 한 번 찾으면 그대로 유효)
+	TArray<TArray<UResourceBase*>> ResolvedPaths;
+	uint32 ResourceGeneration = 1;
+
+	// 진행 중인 LoadAsync 요청 (키: 자리표시자). 업로드가 끝나면 제거
+	TMap<UResourceBase*, std::shared_ptr<FAsyncLoadRequest>> AsyncLoadRequests;
+	uint64 NextAsyncLoadSequence = 0;
+
+	struct FAsyncLoadStats
+	{
+		int32 NumCompleted = 0;
+		int32 NumFailed = 0;
+		int32 NumCanceled = 0;
+		double TotalWorkerMilliseconds = 0.0;
+		double TotalUploadMilliseconds = 0.0;
+		double MaxUploadMilliseconds = 0.0;
+		double MaxTickMilliseconds = 0.0;		// 한 프레임의 TickAsyncLoads 최대 시간 (히치 확인용)
+	};
+	FAsyncLoadStats AsyncLoadStats;
+
+	uint64 ResidencyBudgetBytes = 0;
+	uint64 ResidencyFrame = 0;
+	static constexpr uint64 ResidencyCheckInterval = 30;		// 예산 확인 주기 (프레임)
+	static constexpr uint64 ResidencyMinUnusedFrames = 300;		// 이만큼 쓰이지 않은 리소스만 축출 (깜빡임 방지)
+
+	struct FResidencyStats
+	{
+		int32 NumEvicted = 0;
+		int32 NumRestored = 0;
+		uint64 EvictedBytes = 0;
+	};
+	FResidencyStats ResidencyStats;
+
+	// 메시 BVH 캐시 (키: 지오메트리 내용 해시)
+	struct FMeshBVHEntry
+	{
+		FMeshBVH* BVH = nullptr;
+		bool bBuilding = false;		// 어떤 스레드가 빌드 중 (다른 스레드는 MeshBVHBuiltCondition으로 대기)
+	};
+	TMap<uint64, FMeshBVHEntry> MeshBVHCache;
+	std::mutex MeshBVHMutex;
+	std::condition_variable MeshBVHBuiltCondition;
 
 	UMaterial* DefaultMaterialInstance;
 
@@ -207,13 +311,22 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 			return Shader;
 		}
 
-		return static_cast<T*>((*iter).second);
+		T* Resource = static_cast<T*>((*iter).second);
+
+		// LoadAsync 자리표시자: 요청이 진행 중이면 그대로 반환하고, 취소돼서 남은 것이면 같은 객체에 동기 로드
+		if (Resource->IsPendingLoad() && !AsyncLoadRequests.Contains(Resource))
+		{
+			Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
+			Resource->SetPendingLoad(false);
+		}
+		return Resource;
 	}
 	else//없으면 해당 리소스의 Load실행
 	{
 		T* Resource = NewObject<T>();
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
+		Resource->MarkUsed();
 		Resources[typeIndex][NormalizedPath] = Resource;
 		return Resource;
 	}
@@ -249,6 +362,139 @@ inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShader
 	}
 }
 
+inline UResourceBase*& UResourceManager::FindResolvedSlot(uint8 TypeIndex, uint32 PathId)
+{
+	TArray<UResourceBase*>& Slots = ResolvedPaths[TypeIndex];
+	if (Slots.Num() <= static_cast<int32>(PathId))
+	{
+		Slots.SetNum(static_cast<int32>(PathId) + 1, nullptr);
+	}
+	return Slots[PathId];
+}
+
+template<typename T, typename ...Args>
+inline T* UResourceManager::Load(const FResourcePath& InPath, Args && ...InArgs)
+{
+	if (!InPath.IsValid())
+	{
+		return nullptr;
+	}
+
+	const uint8 typeIndex = static_cast<uint8>(GetResourceType<T>());
+	UResourceBase* Cached = FindResolvedSlot(typeIndex, InPath.GetId());
+
+	// 자리표시자/축출된 리소스는 문자열 경로 쪽 처리(동기 로드 등)를 그대로 따른다
+	if (Cached && !Cached->IsPendingLoad())
+	{
+		if constexpr (std::is_same_v<T, UShader>)
+		{
+			static_cast<UShader*>(Cached)->GetOrCompileShaderVariant(std::forward<Args>(InArgs)...);
+		}
+		return static_cast<T*>(Cached);
+	}
+
+	// 이미 정규화된 경로. 로드 중에 다른 경로가 등록될 수 있으므로 칸은 로드 뒤에 다시 찾는다
+	T* Resource = Load<T>(InPath.ToString(), std::forward<Args>(InArgs)...);
+	FindResolvedSlot(typeIndex, InPath.GetId()) = Resource;
+	return Resource;
+}
+
+template<typename T>
+inline T* UResourceManager::Get(const FResourcePath& InPath)
+{
+	if (!InPath.IsValid())
+	{
+		return nullptr;
+	}
+
+	const uint8 typeIndex = static_cast<uint8>(GetResourceType<T>());
+	UResourceBase*& Slot = FindResolvedSlot(typeIndex, InPath.GetId());
+	if (!Slot)
+	{
+		Slot = Get<T>(InPath.ToString());
+	}
+	return static_cast<T*>(Slot);
+}
+
+template<typename T, typename ...Args>
+TAsyncLoadHandle<T> UResourceManager::LoadAsync(const FString& InFilePath, ETaskPriority Priority, Args && ...InArgs)
+{
+	if (InFilePath.empty())
+	{
+		return TAsyncLoadHandle<T>();
+	}
+
+	FString NormalizedPath = NormalizePath(InFilePath);
+
+	uint8 typeIndex = static_cast<uint8>(GetResourceType<T>());
+	T* Resource = nullptr;
+	auto iter = Resources[typeIndex].find(NormalizedPath);
+	if (iter != Resources[typeIndex].end())
+	{
+		Resource = static_cast<T*>((*iter).second);
+
+		// 이미 로드된 리소스: 완료된 핸들
+		if (!Resource->IsPendingLoad())
+		{
+			std::shared_ptr<FAsyncLoadRequest> Completed = std::make_shared<FAsyncLoadRequest>();
+			Completed->Path = NormalizedPath;
+			Completed->Resource = Resource;
+			Completed->State.store(EAsyncLoadState::Completed, std::memory_order_release);
+			return TAsyncLoadHandle<T>(Completed);
+		}
+
+		// 로드 중: 요청 공유 (취소돼 있었으면 되살리고, 더 높은 대역이면 그 대역에 한 번 더 넣는다. 먼저 꺼낸 워커가 가져감)
+		if (std::shared_ptr<FAsyncLoadRequest>* Found = AsyncLoadRequests.Find(Resource))
+		{
+			std::shared_ptr<FAsyncLoadRequest> Request = *Found;
+			++Request->NumHandles;
+			Request->bCancelRequested.store(false, std::memory_order_release);
+			if (Priority < Request->Priority)
+			{
+				Request->Priority = Priority;
+				if (Request->State.load(std::memory_order_acquire) == EAsyncLoadState::Queued)
+				{
+					ScheduleAsyncLoad(Request);
+				}
+			}
+			return TAsyncLoadHandle<T>(Request);
+		}
+		// 취소돼서 남은 자리표시자: 같은 객체로 다시 요청
+	}
+	else
+	{
+		Resource = NewObject<T>();
+		Resource->SetFilePath(NormalizedPath);
+		Resources[typeIndex][NormalizedPath] = Resource;
+	}
+	Resource->SetPendingLoad(true);
+
+	std::shared_ptr<FAsyncLoadRequest> Request = std::make_shared<FAsyncLoadRequest>();
+	Request->Path = NormalizedPath;
+	Request->Resource = Resource;
+	Request->Priority = Priority;
+	Request->Sequence = NextAsyncLoadSequence++;
+	Request->NumHandles = 1;
+	SetupAsyncLoad(*Request, Resource, std::forward<Args>(InArgs)...);
+
+	AsyncLoadRequests.Add(Resource, Request);
+	ScheduleAsyncLoad(Request);
+	return TAsyncLoadHandle<T>(Request);
+}
+
+template<typename T, typename ...Args>
+void UResourceManager::SetupAsyncLoad(FAsyncLoadRequest& Request, T* Resource, Args && ...InArgs)
+{
+	Request.FinishOnMainThread = [this, Resource, Path = Request.Path, ...CapturedArgs = std::forward<Args>(InArgs)](bool bCanceled) mutable
+	{
+		if (!bCanceled)
+		{
+			Resource->Load(Path, Device, CapturedArgs...);
+		}
+		return !bCanceled;
+	};
+}
+
 template<typename T>
 ResourceType UResourceManager::GetResourceType()
 {
@@ -319,3 +565,37 @@ TArray<FString> UResourceManager::GetAllFilePaths()
 	}
 	return Paths;
 }
+
+/**
+ * 리소스를 쓰는 쪽이 들고 있는 타입 핸들
+ * - 처음 Get()에서 FResourcePath로 로드하고 포인터를 기억한다. 이후에는 세대 비교만 한다
+ * - 리소스 객체는 UResourceManager::Clear() 전까지 지워지지 않으므로(축출돼도 객체는 남음) 포인터를 그대로 써도 된다
+ * - 셰이더 변형은 기존처럼 받은 UShader에서 GetOrCompileShaderVariant로 고른다
+ */
+template<typename T>
+class TResourceHandle
+{
+public:
+	TResourceHandle() = default;
+	explicit TResourceHandle(const FResourcePath& InPath) : Path(InPath) {}
+	explicit TResourceHandle(const char* InPath) : Path(InPath) {}
+
+	T* Get() const
+	{
+		UResourceManager& ResourceManager = UResourceManager::GetInstance();
+		if (CachedGeneration != ResourceManager.GetResourceGeneration())
+		{
+			Cached = ResourceManager.Load<T>(Path);
+			CachedGeneration = ResourceManager.GetResourceGeneration();
+		}
+		return Cached;
+	}
+
+	const FResourcePath& GetPath() const { return Path; }
+	bool IsValid() const { return Path.IsValid(); }
+
+private:
+	FResourcePath Path;
+	mutable T* Cached = nullptr;
+	mutable uint32 CachedGeneration = 0;
+};
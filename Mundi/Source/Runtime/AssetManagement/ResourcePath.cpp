@@ -0,0 +1,63 @@
+﻿#include "pch.h"
+#include "ResourcePath.h"
+#include "PathUtils.h"
+#include "Hash.h"
+#include <deque>
+#include <mutex>
+
+namespace
+{
+	// 경로 풀. 로드가 백그라운드 스레드에서도 일어나므로 등록은 잠그고, 항목은 deque에 둬서 주소를 고정한다
+	struct FResourcePathPool
+	{
+		std::mutex Mutex;
+		TMap<FString, FResourcePathEntry*> EntryMap;
+		std::deque<FResourcePathEntry> Entries;
+	};
+
+	FResourcePathPool& GetPool()
+	{
+		static FResourcePathPool Pool;
+		return Pool;
+	}
+
+	const FResourcePathEntry* Intern(const FString& InPath)
+	{
+		if (InPath.empty())
+		{
+			return nullptr;
+		}
+
+		FString NormalizedPath = NormalizePath(InPath);
+
+		FResourcePathPool& Pool = GetPool();
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		if (FResourcePathEntry** Found = Pool.EntryMap.Find(NormalizedPath))
+		{
+			return *Found;
+		}
+
+		FResourcePathEntry& Entry = Pool.Entries.emplace_back();
+		Entry.Path = NormalizedPath;
+		Entry.Hash = HashBytes(NormalizedPath.data(), NormalizedPath.size());
+		Entry.Id = static_cast<uint32>(Pool.Entries.size() - 1);
+		Pool.EntryMap.Add(std::move(NormalizedPath), &Entry);
+		return &Entry;
+	}
+}
+
+FResourcePath::FResourcePath(const char* InPath)
+	: Entry(InPath ? Intern(FString(InPath)) : nullptr)
+{
+}
+
+FResourcePath::FResourcePath(const FString& InPath)
+	: Entry(Intern(InPath))
+{
+}
+
+const FString& FResourcePath::ToString() const
+{
+	static const FString EmptyPath;
+	return Entry ? Entry->Path : EmptyPath;
+}
@@ -0,0 +1,55 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/** FResourcePath 풀에 한 번만 등록되는 경로 항목 (프로그램이 끝날 때까지 주소가 바뀌지 않음) */
+struct FResourcePathEntry
+{
+	FString Path;		// 정규화된 경로 ('/' 구분자)
+	uint64 Hash = 0;
+	uint32 Id = 0;		// 등록 순서 (0부터 연속)
+};
+
+/**
+ * 정규화·인턴된 리소스 경로
+ * - 만들 때 한 번만 정규화(NormalizePath)하고 해시를 계산해 전역 풀에 등록한다. 같은 경로는 같은 항목을 가리킨다
+ * - 복사/비교/해시는 포인터와 정수만 다루므로, 매 프레임 쓰는 경로는 static이나 멤버로 들고 있으면 된다
+ * - UResourceManager::Load/Get에 넘기면 Id로 바로 찾는다 (문자열 해시/할당 없음)
+ * - 문자열 오버로드와 섞이지 않도록 암시적 변환은 막아 둔다
+ */
+class FResourcePath
+{
+public:
+	static constexpr uint32 InvalidId = ~0u;
+
+	FResourcePath() = default;
+	explicit FResourcePath(const char* InPath);
+	explicit FResourcePath(const FString& InPath);
+
+	bool IsValid() const { return Entry != nullptr; }
+	uint32 GetId() const { return Entry ? Entry->Id : InvalidId; }
+	uint64 GetHash() const { return Entry ? Entry->Hash : 0; }
+	const FString& ToString() const;
+
+	bool operator==(const FResourcePath& Other) const { return Entry == Other.Entry; }
+	bool operator!=(const FResourcePath& Other) const { return Entry != Other.Entry; }
+
+private:
+	const FResourcePathEntry* Entry = nullptr;
+};
+
+inline uint64 GetTypeHash(const FResourcePath& Path)
+{
+	return Path.GetHash();
+}
+
+namespace std
+{
+	template<>
+	struct hash<FResourcePath>
+	{
+		size_t operator()(const FResourcePath& Path) const noexcept
+		{
+			return static_cast<size_t>(Path.GetHash());
+		}
+	};
+}
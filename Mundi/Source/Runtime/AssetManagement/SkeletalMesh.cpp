@@ -19,6 +19,8 @@ void USkeletalMesh::SetVertices(const TArray<FSkinnedVertex>& InVertices)
 {
 	Vertices = InVertices;
 	VertexCount = static_cast<uint32>(Vertices.size());
+	QuantizedVertices.clear();
+	bQuantizedVerticesBuilt = false;
 
 	UE_LOG("[SkeletalMesh] Set %u vertices", VertexCount);
 }
@@ -27,10 +29,25 @@ void USkeletalMesh::SetIndices(const TArray<uint32>& InIndices)
 {
 	Indices = InIndices;
 	IndexCount = static_cast<uint32>(Indices.size());
+	LODs.clear();	// 이전 토폴로지로 만든 LOD는 더 이상 맞지 않는다
 
 	UE_LOG("[SkeletalMesh] Set %u indices (%u triangles)", IndexCount, IndexCount / 3);
 }
 
+const TArray<FQuantizedSkinnedVertex>* USkeletalMesh::GetQuantizedVertices()
+{
+	if (!bQuantizedVerticesBuilt)
+	{
+		bQuantizedVerticesBuilt = true;
+		QuantizationParams = FVertexQuantizer::ComputeParams(Vertices);
+		if (!FVertexQuantizer::Quantize(Vertices, QuantizationParams, QuantizedVertices))
+		{
+			UE_LOG("[SkeletalMesh] %s: bone indices exceed 255, CPU skinning stays at full precision", CacheFilePath.c_str());
+		}
+	}
+	return QuantizedVertices.empty() ? nullptr : &QuantizedVertices;
+}
+
 bool USkeletalMesh::CreateGPUResources(ID3D11Device* Device)
 {
 	if (!Device)
@@ -86,15 +103,16 @@ bool USkeletalMesh::CreateGPUResources(ID3D11Device* Device)
 		return false;
 	}
 
-	// 3. Index Buffer 생성
+	// 3. Index Buffer 생성 (자동 생성 LOD는 LOD0 뒤에 이어 붙인다)
+	const TArray<uint32> IndexBufferData = MeshLOD::GatherIndices(Indices, LODs);
 	D3D11_BUFFER_DESC IbDesc = {};
 	IbDesc.Usage = D3D11_USAGE_DEFAULT;
-	IbDesc.ByteWidth = sizeof(uint32) * IndexCount;
+	IbDesc.ByteWidth = static_cast<UINT>(sizeof(uint32) * IndexBufferData.size());
 	IbDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 	IbDesc.CPUAccessFlags = 0;
 
 	D3D11_SUBRESOURCE_DATA IbData = {};
-	IbData.pSysMem = Indices.data();
+	IbData.pSysMem = IndexBufferData.data();
 
 	Hr = Device->CreateBuffer(&IbDesc, &IbData, &IndexBuffer);
 	if (FAILED(Hr))
@@ -161,15 +179,16 @@ bool USkeletalMesh::CreateDynamicGPUResources(ID3D11Device* Device)
 		return false;
 	}
 
-	// Index Buffer는 Static으로 유지 (변경 없음)
+	// Index Buffer는 Static으로 유지 (변경 없음, 자동 생성 LOD는 LOD0 뒤에 이어 붙인다)
+	const TArray<uint32> IndexBufferData = MeshLOD::GatherIndices(Indices, LODs);
 	D3D11_BUFFER_DESC IbDesc = {};
 	IbDesc.Usage = D3D11_USAGE_DEFAULT;  // Static
-	IbDesc.ByteWidth = sizeof(uint32) * IndexCount;
+	IbDesc.ByteWidth = static_cast<UINT>(sizeof(uint32) * IndexBufferData.size());
 	IbDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 	IbDesc.CPUAccessFlags = 0;
 
 	D3D11_SUBRESOURCE_DATA IbData = {};
-	IbData.pSysMem = Indices.data();
+	IbData.pSysMem = IndexBufferData.data();
 
 	Hr = Device->CreateBuffer(&IbDesc, &IbData, &IndexBuffer);
 	if (FAILED(Hr))
@@ -278,12 +297,15 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, cons
 	Indices = std::move(MeshData->Indices);
 	VertexToControlPointMap = std::move(MeshData->VertexToControlPointMap);
 	GroupInfos = std::move(MeshData->GroupInfos);
+	LODs = std::move(MeshData->LODs);
 	MaterialNames = std::move(MeshData->MaterialNames);
 	Skeleton = MeshData->Skeleton;
 	CacheFilePath = std::move(MeshData->CacheFilePath);
 
 	VertexCount = static_cast<uint32>(Vertices.size());
 	IndexCount = static_cast<uint32>(Indices.size());
+	QuantizedVertices.clear();
+	bQuantizedVerticesBuilt = false;
 
 	if (Skeleton)
 	{
@@ -4,6 +4,7 @@
 #include "Skeleton.h"
 #include "Enums.h"
 #include "FbxImportOptions.h"
+#include "VertexQuantization.h"
 #include <d3d11.h>
 
 /**
@@ -95,6 +96,9 @@ struct FSkeletalMesh
 
 	TArray<FGroupInfo> GroupInfos;
 
+	// 자동 생성 LOD (LOD1부터, FMeshSimplifier)
+	TArray<FMeshLOD> LODs;
+
 	// 캐시 파일 경로 (예: DerivedDataCache/Model/Fbx/Character.fbx.bin)
 	FString CacheFilePath;
 
@@ -112,6 +116,7 @@ struct FSkeletalMesh
 		, PolygonMaterialIndices(std::move(Other.PolygonMaterialIndices))
 		, MaterialNames(std::move(Other.MaterialNames))
 		, GroupInfos(std::move(Other.GroupInfos))
+		, LODs(std::move(Other.LODs))
 		, CacheFilePath(std::move(Other.CacheFilePath))
 		, Skeleton(Other.Skeleton)
 	{
@@ -129,6 +134,7 @@ struct FSkeletalMesh
 			PolygonMaterialIndices = std::move(Other.PolygonMaterialIndices);
 			MaterialNames = std::move(Other.MaterialNames);
 			GroupInfos = std::move(Other.GroupInfos);
+			LODs = std::move(Other.LODs);
 			CacheFilePath = std::move(Other.CacheFilePath);
 			Skeleton = Other.Skeleton;
 			Other.Skeleton = nullptr;
@@ -234,6 +240,17 @@ public:
 	 */
 	uint64 GetMeshGroupCount() const { return GroupInfos.size(); }
 
+	/**
+	 * 자동 생성 LOD (LOD1부터). LOD 인덱스는 인덱스 버퍼에서 LOD0 뒤에 이어진다
+	 * 스키닝은 정점 단위라 LOD와 관계없이 같은 정점 버퍼를 쓴다
+	 */
+	const TArray<FMeshLOD>& GetLODs() const { return LODs; }
+	int32 GetNumLODs() const { return 1 + static_cast<int32>(LODs.size()); }
+	void GetLODSection(int32 LODIndex, uint32 SectionIndex, uint32& OutStartIndex, uint32& OutIndexCount) const
+	{
+		MeshLOD::GetSection(Indices, GroupInfos, LODs, LODIndex, SectionIndex, OutStartIndex, OutIndexCount);
+	}
+
 	/**
 	 * 캐시 파일 경로 가져오기
 	 * @return 캐시 파일 경로 (예: DerivedDataCache/Model/Fbx/Character.fbx.bin)
@@ -283,6 +300,18 @@ public:
 		return Vertices;
 	}
 
+	/**
+	 * 압축 Skinning 스트림 (FQuantizedSkinnedVertex, 28 bytes) 가져오기
+	 * 처음 요청할 때 Vertices에서 만들고, SetVertices/Load에서 다시 만들도록 비운다
+	 * @return Bone 인덱스가 255를 넘어 압축할 수 없으면 nullptr
+	 */
+	const TArray<FQuantizedSkinnedVertex>* GetQuantizedVertices();
+
+	/**
+	 * 압축 스트림의 위치/UV 복원 파라미터
+	 */
+	const FVertexQuantizationParams& GetQuantizationParams() const { return QuantizationParams; }
+
 	/**
 	 * Indices 배열 참조 반환 (Direct Access)
 	 * ExtractSkinWeights에서 Winding Order를 수정할 때 사용
@@ -305,6 +334,13 @@ public:
 	 */
 	uint32 GetIndexCount() const { return IndexCount; }
 
+	// 상주 메모리 추정 (GPU 버퍼는 FNormalVertex 기준)
+	uint64 GetGPUBytes() const override
+	{
+		return (VertexBuffer ? static_cast<uint64>(VertexCount) * sizeof(FNormalVertex) : 0)
+			+ (IndexBuffer ? static_cast<uint64>(MeshLOD::GetTotalIndexCount(Indices, LODs)) * sizeof(uint32) : 0);
+	}
+
 	// === GPU 리소스 관리 ===
 
 	/**
@@ -405,6 +441,9 @@ private:
 	// Material별 그룹 정보 (다중 Material 지원)
 	TArray<FGroupInfo> GroupInfos;
 
+	// 자동 생성 LOD (LOD1부터)
+	TArray<FMeshLOD> LODs;
+
 	// CPU Mesh 데이터
 	TArray<FSkinnedVertex> Vertices;
 	TArray<uint32> Indices;
@@ -413,6 +452,11 @@ private:
 	// Skin Weights를 적용할 때 사용
 	TArray<int32> VertexToControlPointMap;
 
+	// 압축 Skinning 스트림 (GetQuantizedVertices에서 만든다)
+	TArray<FQuantizedSkinnedVertex> QuantizedVertices;
+	FVertexQuantizationParams QuantizationParams;
+	bool bQuantizedVerticesBuilt = false;	// 만들기를 시도했는지 (실패도 기억해서 매 프레임 다시 시도하지 않음)
+
 	// GPU 리소스
 	ID3D11Buffer* VertexBuffer = nullptr;
 	ID3D11Buffer* IndexBuffer = nullptr;
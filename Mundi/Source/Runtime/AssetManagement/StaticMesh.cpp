@@ -32,25 +32,35 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
         // ═══════════════════════════════════════════════════════════
         // FBX Static Mesh: Delegate to FFbxManager (like OBJ pattern)
         // ═══════════════════════════════════════════════════════════
-        StaticMeshAsset = FFbxManager::LoadFbxStaticMeshAsset(InFilePath);
+        FStaticMesh* FbxStaticMeshAsset = FFbxManager::LoadFbxStaticMeshAsset(InFilePath);
         bOwnsStaticMeshAsset = false;  // FFbxManager owns it (same as FObjManager pattern)
 
-        if (!StaticMeshAsset)
+        if (!FbxStaticMeshAsset)
         {
             UE_LOG("[StaticMesh ERROR] FFbxManager failed to load FBX: %s", InFilePath.c_str());
             return;
         }
+        LoadFromAsset(FbxStaticMeshAsset, InDevice, InVertexType);
     }
     else if (Extension == ".obj")
     {
         // OBJ 파일 Load (기존 방식)
-        StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(InFilePath);
+        LoadFromAsset(FObjManager::LoadObjStaticMeshAsset(InFilePath), InDevice, InVertexType);
     }
     else
     {
         UE_LOG("[StaticMesh ERROR] Unsupported file format: %s", Extension.c_str());
         return;
     }
+}
+
+void UStaticMesh::LoadFromAsset(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType)
+{
+    assert(InDevice);
+
+    SetVertexType(InVertexType);
+    EvictResidentData();
+    StaticMeshAsset = InStaticMesh;
 
     // 빈 버텍스, 인덱스로 버퍼 생성 방지
     if (StaticMeshAsset && 0 < StaticMeshAsset->Vertices.size() && 0 < StaticMeshAsset->Indices.size())
@@ -61,6 +71,7 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
         CreateLocalBound(StaticMeshAsset);
         VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.size());
         IndexCount = static_cast<uint32>(StaticMeshAsset->Indices.size());
+        IndexBufferCount = MeshLOD::GetTotalIndexCount(StaticMeshAsset->Indices, StaticMeshAsset->LODs);
     }
 }
 
@@ -85,6 +96,7 @@ void UStaticMesh::Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutT
 
     VertexCount = static_cast<uint32>(InData->Vertices.size());
     IndexCount = static_cast<uint32>(InData->Indices.size());
+    IndexBufferCount = IndexCount;
 }
 
 void UStaticMesh::SetVertexType(EVertexLayoutType InVertexType)
@@ -166,6 +178,45 @@ void UStaticMesh::CreateLocalBound(const FStaticMesh* InStaticMesh)
     LocalBound = FAABB(Min, Max);
 }
 
+uint64 UStaticMesh::GetCPUBytes() const
+{
+    if (!StaticMeshAsset)
+    {
+        return 0;
+    }
+    return static_cast<uint64>(StaticMeshAsset->Vertices.size()) * sizeof(FNormalVertex)
+        + static_cast<uint64>(MeshLOD::GetTotalIndexCount(StaticMeshAsset->Indices, StaticMeshAsset->LODs)) * sizeof(uint32);
+}
+
+uint64 UStaticMesh::GetGPUBytes() const
+{
+    uint64 Bytes = 0;
+    if (VertexBuffer)
+    {
+        Bytes += static_cast<uint64>(VertexCount) * VertexStride;
+    }
+    if (IndexBuffer)
+    {
+        Bytes += static_cast<uint64>(IndexBufferCount) * sizeof(uint32);
+    }
+    return Bytes;
+}
+
+void UStaticMesh::EvictResidentData()
+{
+    // CPU 에셋(FStaticMesh)은 FObjManager/FFbxManager가 소유하므로 GPU 버퍼만 내린다 (다시 쓰이면 LoadFromAsset으로 재업로드)
+    if (VertexBuffer)
+    {
+        VertexBuffer->Release();
+        VertexBuffer = nullptr;
+    }
+    if (IndexBuffer)
+    {
+        IndexBuffer->Release();
+        IndexBuffer = nullptr;
+    }
+}
+
 void UStaticMesh::ReleaseResources()
 {
     if (VertexBuffer)
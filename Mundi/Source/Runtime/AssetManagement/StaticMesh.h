@@ -16,8 +16,11 @@ public:
 
     void Load(const FString& InFilePath, ID3D11Device* InDevice, EVertexLayoutType InVertexType = EVertexLayoutType::PositionColorTexturNormal);
     void Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutType InVertexType = EVertexLayoutType::PositionColorTexturNormal);
+    // 이미 로드된 에셋(FObjManager/FFbxManager 소유)으로 GPU 버퍼와 바운드를 만든다
+    void LoadFromAsset(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType = EVertexLayoutType::PositionColorTexturNormal);
 
-    ID3D11Buffer* GetVertexBuffer() const { return VertexBuffer; }
+    // 렌더링에서 가져갈 때 사용 기록을 남긴다 (축출된 메시면 다시 업로드 요청, 올라올 때까지 nullptr)
+    ID3D11Buffer* GetVertexBuffer() const { MarkUsed(); return VertexBuffer; }
     ID3D11Buffer* GetIndexBuffer() const { return IndexBuffer; }
     uint32 GetVertexCount() const { return VertexCount; }
     uint32 GetIndexCount() const { return IndexCount; }
@@ -34,11 +37,25 @@ public:
     bool HasMaterial() const { return StaticMeshAsset->bHasMaterial; }
 
     uint64 GetMeshGroupCount() const { return StaticMeshAsset->GroupInfos.size(); }
+
+    // 자동 생성 LOD (0 = 원본). LOD 인덱스는 같은 인덱스 버퍼에서 LOD0 뒤에 이어진다
+    int32 GetNumLODs() const { return StaticMeshAsset ? 1 + static_cast<int32>(StaticMeshAsset->LODs.size()) : 1; }
+    const TArray<FMeshLOD>* GetLODs() const { return StaticMeshAsset ? &StaticMeshAsset->LODs : nullptr; }
+    void GetLODSection(int32 LODIndex, uint32 SectionIndex, uint32& OutStartIndex, uint32& OutIndexCount) const
+    {
+        MeshLOD::GetSection(StaticMeshAsset->Indices, StaticMeshAsset->GroupInfos, StaticMeshAsset->LODs, LODIndex, SectionIndex, OutStartIndex, OutIndexCount);
+    }
     
     FAABB GetLocalBound() const {return LocalBound; }
     
     const FString& GetCacheFilePath() const { return CacheFilePath; }
 
+    uint64 GetCPUBytes() const override;
+    uint64 GetGPUBytes() const override;
+    // 파일에서 로드한 메시만 (FMeshData로 만든 디버그/빌보드 메시는 다시 만들 수 없음)
+    bool CanEvict() const override { return VertexBuffer && StaticMeshAsset && !FilePath.empty(); }
+    void EvictResidentData() override;
+
 private:
     void CreateVertexBuffer(FMeshData* InMeshData, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
 	void CreateVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
@@ -54,7 +71,8 @@ private:
     ID3D11Buffer* VertexBuffer = nullptr;
     ID3D11Buffer* IndexBuffer = nullptr;
     uint32 VertexCount = 0;     // 정점 개수
-    uint32 IndexCount = 0;     // 버텍스 점의 개수 
+    uint32 IndexCount = 0;     // 버텍스 점의 개수 (LOD0)
+    uint32 IndexBufferCount = 0;    // 인덱스 버퍼 전체 (LOD0 + 자동 생성 LOD)
     uint32 VertexStride = 0;
     EVertexLayoutType VertexType = EVertexLayoutType::PositionColorTexturNormal;  // Stride를 계산하기 위한 버텍스 타입
 
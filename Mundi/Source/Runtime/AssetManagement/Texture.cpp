@@ -3,6 +3,8 @@
 #include "TextureConverter.h"
 #include "DDSTextureLoader.h"
 #include "WICTextureLoader.h"
+#include "MappedFile.h"
+#include <DirectXTex.h>
 #include <filesystem>
 
 IMPLEMENT_CLASS(UTexture)
@@ -19,12 +21,25 @@ UTexture::~UTexture()
 	ReleaseResources();
 }
 
+FTextureSourceData::FTextureSourceData() = default;
+FTextureSourceData::~FTextureSourceData() = default;
+FTextureSourceData::FTextureSourceData(FTextureSourceData&&) noexcept = default;
+FTextureSourceData& FTextureSourceData::operator=(FTextureSourceData&&) noexcept = default;
+
 void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB)
 {
 	assert(InDevice);
 
+	FTextureSourceData SourceData;
+	ReadSourceData(InFilePath, bSRGB, SourceData);
+	CreateFromSourceData(SourceData, InDevice);
+}
+
+bool UTexture::ReadSourceData(const FString& InFilePath, bool bSRGB, FTextureSourceData& OutSourceData)
+{
 	// 실제로 로드할 파일 경로 결정
 	FString ActualLoadPath = InFilePath;
+	OutSourceData.bSRGB = bSRGB;
 
 #ifdef USE_DDS_CACHE
 	// DDS 캐싱 활성화 시: DDS 변환 및 캐시 사용
@@ -67,7 +82,7 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 
 			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
 			FString NormalizedCachePath = NormalizePath(DDSCachePath);
-			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
+			OutSourceData.CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
 		}
 	}
 #else
@@ -98,19 +113,50 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
 	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
 
+	OutSourceData.LoadPath = ActualLoadPath;
+	OutSourceData.bIsDDS = (ext == L".dds");
+
+	// 파일 전체를 매핑해 두고, 디코드/업로드는 CreateFromSourceData에서 메모리로부터 한다
+	OutSourceData.File = std::make_unique<FMappedFile>();
+	if (!OutSourceData.File->Open(WFilePath))
+	{
+		UE_LOG("[UTexture] Failed to open texture file: %s", ActualLoadPath.c_str());
+		OutSourceData.File.reset();
+		return false;
+	}
+	return true;
+}
+
+bool UTexture::CreateFromSourceData(const FTextureSourceData& InSourceData, ID3D11Device* InDevice)
+{
+	assert(InDevice);
+
+	ReleaseResources();
+	CacheFilePath = InSourceData.CacheFilePath;
+	bSRGB = InSourceData.bSRGB;
+
+	if (!InSourceData.File || !InSourceData.File->IsOpen())
+	{
+		return false;
+	}
+
+	const uint8_t* Bytes = InSourceData.File->GetData();
+	const size_t NumBytes = static_cast<size_t>(InSourceData.File->GetSize());
+
 	HRESULT hr = E_FAIL;
-	if (ext == L".dds")
+	if (InSourceData.bIsDDS)
 	{
 		// DDS 로딩: Ex 버전 사용하여 sRGB 지정
-		hr = DirectX::CreateDDSTextureFromFileEx(
+		hr = DirectX::CreateDDSTextureFromMemoryEx(
 			InDevice,
-			WFilePath.c_str(),
+			Bytes,
+			NumBytes,
 			0, // maxsize (0 = no limit)
 			D3D11_USAGE_DEFAULT,
 			D3D11_BIND_SHADER_RESOURCE,
 			0, // cpuAccessFlags
 			0, // miscFlags
-			bSRGB ? DirectX::DDS_LOADER_FORCE_SRGB : DirectX::DDS_LOADER_DEFAULT,
+			InSourceData.bSRGB ? DirectX::DDS_LOADER_FORCE_SRGB : DirectX::DDS_LOADER_DEFAULT,
 			reinterpret_cast<ID3D11Resource**>(&Texture2D),
 			&ShaderResourceView
 		);
@@ -118,15 +164,16 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	else
 	{
 		// WIC 로딩: Ex 버전 사용하여 sRGB 지정
-		hr = DirectX::CreateWICTextureFromFileEx(
+		hr = DirectX::CreateWICTextureFromMemoryEx(
 			InDevice,
-			WFilePath.c_str(),
+			Bytes,
+			NumBytes,
 			0, // maxsize (0 = no limit)
 			D3D11_USAGE_DEFAULT,
 			D3D11_BIND_SHADER_RESOURCE,
 			0, // cpuAccessFlags
 			0, // miscFlags
-			bSRGB ? DirectX::WIC_LOADER_FORCE_SRGB : DirectX::WIC_LOADER_DEFAULT,
+			InSourceData.bSRGB ? DirectX::WIC_LOADER_FORCE_SRGB : DirectX::WIC_LOADER_DEFAULT,
 			reinterpret_cast<ID3D11Resource**>(&Texture2D),
 			&ShaderResourceView
 		);
@@ -141,12 +188,24 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 			Width = desc.Width;
 			Height = desc.Height;
 			Format = desc.Format;
+
+			// 상주 메모리 추정 (블록 압축 포맷은 4x4 블록 단위로 계산)
+			for (UINT Mip = 0; Mip < desc.MipLevels; ++Mip)
+			{
+				size_t RowPitch = 0;
+				size_t SlicePitch = 0;
+				if (SUCCEEDED(DirectX::ComputePitch(desc.Format, std::max(desc.Width >> Mip, 1u), std::max(desc.Height >> Mip, 1u), RowPitch, SlicePitch)))
+				{
+					GPUBytes += static_cast<uint64>(SlicePitch) * desc.ArraySize;
+				}
+			}
 		}
+		bLoadedFromFile = true;
+		return true;
 	}
-	else
-	{
-		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", ActualLoadPath.c_str(), hr);
-	}
+
+	UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", InSourceData.LoadPath.c_str(), hr);
+	return false;
 }
 
 void UTexture::ReleaseResources()
@@ -166,4 +225,5 @@ void UTexture::ReleaseResources()
 	Width = 0;
 	Height = 0;
 	Format = DXGI_FORMAT_UNKNOWN;
+	GPUBytes = 0;
 }
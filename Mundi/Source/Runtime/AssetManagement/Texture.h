@@ -1,6 +1,24 @@
 ﻿#pragma once
 #include "ResourceBase.h"
 #include <d3d11.h>
+#include <memory>
+
+class FMappedFile;
+
+// 디바이스 없이 준비할 수 있는 텍스처 원본 (DDS 캐시 변환 + 파일 매핑). 워커 스레드에서 만들 수 있다
+struct FTextureSourceData
+{
+	FString LoadPath;			// 실제로 읽은 파일 (DDS 캐시를 쓰면 캐시 경로)
+	FString CacheFilePath;		// DDS 캐시 경로 (정규화됨, 원본이 DDS면 빈 문자열)
+	std::unique_ptr<FMappedFile> File;
+	bool bSRGB = true;
+	bool bIsDDS = false;
+
+	FTextureSourceData();
+	~FTextureSourceData();
+	FTextureSourceData(FTextureSourceData&&) noexcept;
+	FTextureSourceData& operator=(FTextureSourceData&&) noexcept;
+};
 
 class UTexture : public UResourceBase
 {
@@ -14,7 +32,14 @@ public:
 	// bSRGB: true = sRGB 포맷 사용 (Diffuse/Albedo 텍스처), false = Linear 포맷 (Normal/Data 텍스처)
 	void Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB = true);
 
-	ID3D11ShaderResourceView* GetShaderResourceView() const { return ShaderResourceView; }
+	// Load를 둘로 나눈 것 (UResourceManager::LoadAsync)
+	// ReadSourceData: DDS 캐시 확인/변환과 파일 매핑. 디바이스를 쓰지 않으므로 워커 스레드에서 호출 가능
+	// CreateFromSourceData: 매핑된 바이트로 텍스처/SRV 생성 (메인 스레드)
+	static bool ReadSourceData(const FString& InFilePath, bool bSRGB, FTextureSourceData& OutSourceData);
+	bool CreateFromSourceData(const FTextureSourceData& InSourceData, ID3D11Device* InDevice);
+
+	// 렌더링에서 가져갈 때 사용 기록을 남긴다 (축출된 텍스처면 다시 로드 요청, 올라올 때까지 nullptr)
+	ID3D11ShaderResourceView* GetShaderResourceView() const { MarkUsed(); return ShaderResourceView; }
 	ID3D11Texture2D* GetTexture2D() const { return Texture2D; }
 
 	uint32 GetWidth() const { return Width; }
@@ -23,16 +48,25 @@ public:
 
 	// DDS 캐시 파일 경로
 	const FString& GetCacheFilePath() const { return CacheFilePath; }
+	bool IsSRGB() const { return bSRGB; }
 
 	void ReleaseResources();
 
+	uint64 GetGPUBytes() const override { return GPUBytes; }
+	bool CanEvict() const override { return ShaderResourceView && bLoadedFromFile; }
+	void EvictResidentData() override { ReleaseResources(); }
+
 private:
 	FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube_texture.png.dds)
 
-	ID3D11Texture2D* Texture2D;
-	ID3D11ShaderResourceView* ShaderResourceView;
+	ID3D11Texture2D* Texture2D = nullptr;
+	ID3D11ShaderResourceView* ShaderResourceView = nullptr;
 
 	uint32 Width = 0;
 	uint32 Height = 0;
 	DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+
+	uint64 GPUBytes = 0;			// 밉 체인 전체 추정 크기
+	bool bSRGB = true;				// 축출 후 다시 로드할 때 같은 포맷으로
+	bool bLoadedFromFile = false;	// CreateFromSourceData로 만든 텍스처만 다시 로드할 수 있음
 };
@@ -1,13 +1,43 @@
 ﻿/**
  * @file TextureConverter.cpp
- * @brief DirectXTex를 사용한 텍스처 변환 유틸리티 구현
+ * @brief 텍스처 변환 유틸리티 구현 (FTextureCooker + DirectXTex)
  */
 
 #include "pch.h"
 #include "TextureConverter.h"
+#include "TextureCooker.h"
+#include "PlatformTime.h"
 #include <DirectXTex.h>
 #include <algorithm>
 
+namespace
+{
+	// 자체 쿠커가 인코딩할 수 있는 DXGI 포맷인지 (그 외는 DirectXTex로)
+	bool TryGetCookFormat(DXGI_FORMAT Format, ETextureCookFormat& OutFormat)
+	{
+		switch (Format)
+		{
+		case DXGI_FORMAT_BC1_UNORM:
+		case DXGI_FORMAT_BC1_UNORM_SRGB:
+			OutFormat = ETextureCookFormat::BC1;
+			return true;
+		case DXGI_FORMAT_BC3_UNORM:
+		case DXGI_FORMAT_BC3_UNORM_SRGB:
+			OutFormat = ETextureCookFormat::BC3;
+			return true;
+		case DXGI_FORMAT_BC5_UNORM:
+			OutFormat = ETextureCookFormat::BC5;
+			return true;
+		case DXGI_FORMAT_BC7_UNORM:
+		case DXGI_FORMAT_BC7_UNORM_SRGB:
+			OutFormat = ETextureCookFormat::BC7;
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
 bool FTextureConverter::ConvertToDDS(
 	const FString& SourcePath,
 	const FString& OutputPath,
@@ -39,7 +69,30 @@ bool FTextureConverter::ConvertToDDS(
 		// 이미 DDS 포맷이면 변환 불필요
 		return true;
 	}
-	else if (ext == L".tga")
+
+	// PNG/TGA/HDR은 자체 쿠커로 변환 (실패하면 아래 DirectXTex 경로로)
+	ETextureCookFormat CookFormat;
+	if (FTextureCooker::CanCook(WideToUTF8(ext)) && TryGetCookFormat(Format, CookFormat))
+	{
+		FTextureCookSettings Settings;
+		Settings.Format = CookFormat;
+		Settings.bSRGB = IsSRGB(Format);
+		Settings.bGenerateMips = bShouldGenerateMipmaps;
+
+		FString FinalOutputPath = OutputPath.empty() ? GetDDSCachePath(SourcePath) : OutputPath;
+		FTextureCookStats Stats;
+		FString Error;
+		if (FTextureCooker::CookFile(SourcePath, FinalOutputPath, Settings, &Stats, &Error))
+		{
+			UE_LOG("[TextureConverter] Cooked %s -> %s (%ux%u, %u mips, %.1f ms)",
+			       SourcePath.c_str(), FinalOutputPath.c_str(), Stats.Width, Stats.Height, Stats.NumMips,
+			       Stats.DecodeMilliseconds + Stats.MipMilliseconds + Stats.EncodeMilliseconds + Stats.WriteMilliseconds);
+			return true;
+		}
+		UE_LOG("[TextureConverter] Cooker failed for %s (%s), falling back to DirectXTex", SourcePath.c_str(), Error.c_str());
+	}
+
+	if (ext == L".tga")
 	{
 		hr = LoadFromTGAFile(WSourcePath.c_str(), &metadata, image);
 	}
@@ -299,6 +352,98 @@ DXGI_FORMAT FTextureConverter::GetRecommendedFormat(bool bHasAlpha, bool bSRGB)
 	}
 }
 
+void FTextureConverter::CookDirectory(const FString& Directory, ETextureCookFormat Format, bool bSRGB, bool bForce)
+{
+	namespace fs = std::filesystem;
+
+	fs::path Root(UTF8ToWide(Directory));
+	std::error_code ec;
+	if (!fs::is_directory(Root, ec))
+	{
+		UE_LOG("[TextureConverter] Cook directory not found: %s", Directory.c_str());
+		return;
+	}
+
+	// 경로 순서대로 처리해 결과 로그를 비교하기 쉽게
+	TArray<FString> SourcePaths;
+	for (fs::recursive_directory_iterator It(Root, fs::directory_options::skip_permission_denied, ec), End; It != End; It.increment(ec))
+	{
+		if (ec || !It->is_regular_file(ec))
+		{
+			continue;
+		}
+		if (FTextureCooker::CanCook(WideToUTF8(It->path().extension().wstring())))
+		{
+			SourcePaths.Add(NormalizePath(WideToUTF8(It->path().wstring())));
+		}
+	}
+	std::sort(SourcePaths.begin(), SourcePaths.end());
+
+	UE_LOG("[TextureConverter] Cooking %d textures in %s (%s%s%s)", SourcePaths.Num(), Directory.c_str(),
+	       FTextureCooker::GetFormatName(Format), bSRGB && Format != ETextureCookFormat::BC5 ? " sRGB" : "", bForce ? ", force" : "");
+
+	FTextureCookSettings Settings;
+	Settings.Format = Format;
+	Settings.bSRGB = bSRGB;
+	Settings.bGenerateMips = bShouldGenerateMipmaps;
+	Settings.bMeasureQuality = true;
+
+	int32 NumCooked = 0;
+	int32 NumSkipped = 0;
+	int32 NumFailed = 0;
+	int32 NumMeasured = 0;
+	uint64 TotalPixels = 0;
+	uint64 TotalBytes = 0;
+	double TotalPSNR = 0.0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	for (const FString& SourcePath : SourcePaths)
+	{
+		const FString DDSPath = GetDDSCachePath(SourcePath);
+		if (!bForce && !ShouldRegenerateDDS(SourcePath, DDSPath))
+		{
+			++NumSkipped;
+			continue;
+		}
+
+		FTextureCookStats Stats;
+		FString Error;
+		if (!FTextureCooker::CookFile(SourcePath, DDSPath, Settings, &Stats, &Error))
+		{
+			UE_LOG("[TextureConverter]   FAILED %s: %s", SourcePath.c_str(), Error.c_str());
+			++NumFailed;
+			continue;
+		}
+
+		const double Milliseconds = Stats.DecodeMilliseconds + Stats.MipMilliseconds + Stats.EncodeMilliseconds + Stats.WriteMilliseconds;
+		const double MegapixelsPerSecond = 0.0 < Stats.EncodeMilliseconds ? Stats.NumPixels / (Stats.EncodeMilliseconds * 1000.0) : 0.0;
+		if (0.0 < Stats.PSNR)
+		{
+			UE_LOG("[TextureConverter]   %s  %ux%u  %u mips  %s  %.1f ms (decode %.1f, mip %.1f, encode %.1f)  %.1f MP/s  PSNR %.2f dB",
+			       SourcePath.c_str(), Stats.Width, Stats.Height, Stats.NumMips, FTextureCooker::GetFormatName(Format),
+			       Milliseconds, Stats.DecodeMilliseconds, Stats.MipMilliseconds, Stats.EncodeMilliseconds, MegapixelsPerSecond, Stats.PSNR);
+			TotalPSNR += Stats.PSNR;
+			++NumMeasured;
+		}
+		else
+		{
+			// HDR 입력 (RGBA16F, 블록 압축 없음)
+			UE_LOG("[TextureConverter]   %s  %ux%u  %u mips  RGBA16F  %.1f ms",
+			       SourcePath.c_str(), Stats.Width, Stats.Height, Stats.NumMips, Milliseconds);
+		}
+
+		++NumCooked;
+		TotalPixels += Stats.NumPixels;
+		TotalBytes += Stats.OutputBytes;
+	}
+
+	const double TotalMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	UE_LOG("[TextureConverter] Cooked %d, skipped %d, failed %d in %.1f ms  (%.2f MB written, %.1f MP/s, avg PSNR %.2f dB)",
+	       NumCooked, NumSkipped, NumFailed, TotalMilliseconds, TotalBytes / (1024.0 * 1024.0),
+	       0.0 < TotalMilliseconds ? TotalPixels / (TotalMilliseconds * 1000.0) : 0.0,
+	       0 < NumMeasured ? TotalPSNR / NumMeasured : 0.0);
+}
+
 void FTextureConverter::EnsureCacheDirectoryExists(const FString& CachePath)
 {
 	namespace fs = std::filesystem;
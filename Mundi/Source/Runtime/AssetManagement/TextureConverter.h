@@ -2,9 +2,9 @@
  * @file TextureConverter.h
  * @brief DDS 포맷 변환 및 캐싱을 지원하는 텍스처 변환 유틸리티
  *
- * DirectXTex 라이브러리를 사용하여 원본 텍스처 파일(PNG, JPG, TGA 등)을
- * DDS 포맷으로 변환하는 기능을 제공합니다. OBJ 바이너리 캐싱과 유사한
- * 캐시 시스템을 구현하여 텍스처 로딩 성능을 향상시킵니다.
+ * 원본 텍스처 파일(PNG, JPG, TGA 등)을 DDS 포맷으로 변환하는 기능을 제공합니다.
+ * PNG/TGA/HDR은 플랫폼 API 없이 FTextureCooker로 변환하고, 그 외 포맷은 DirectXTex를 사용합니다.
+ * OBJ 바이너리 캐싱과 유사한 캐시 시스템을 구현하여 텍스처 로딩 성능을 향상시킵니다.
  */
 
 #pragma once
@@ -12,6 +12,8 @@
 #include <d3d11.h>
 #include <filesystem>
 
+enum class ETextureCookFormat : uint8;
+
 /**
  * @class FTextureConverter
  * @brief 텍스처 포맷 변환 및 캐시 관리를 위한 정적 유틸리티 클래스
@@ -71,6 +73,17 @@ public:
 	 */
 	static DXGI_FORMAT GetRecommendedFormat(bool bHasAlpha, bool bSRGB = true);
 
+	/**
+	 * @brief 디렉토리 아래의 PNG/TGA/HDR을 모두 DDS 캐시로 일괄 변환 (오프라인 쿠킹)
+	 * @param Directory 검색할 디렉토리 (하위 디렉토리 포함)
+	 * @param Format 블록 압축 포맷 (HDR 입력은 항상 RGBA16F)
+	 * @param bSRGB sRGB 포맷 사용 여부 (BC5는 무시)
+	 * @param bForce 캐시가 최신이어도 다시 변환
+	 *
+	 * 파일별 크기/밉 수/시간/처리량/PSNR과 전체 합계를 로그로 출력합니다.
+	 */
+	static void CookDirectory(const FString& Directory, ETextureCookFormat Format, bool bSRGB, bool bForce);
+
 private:
 	// 인스턴스화 비활성화
 	FTextureConverter() = delete;
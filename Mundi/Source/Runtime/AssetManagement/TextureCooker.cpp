@@ -0,0 +1,726 @@
+﻿#include "pch.h"
+#include "TextureCooker.h"
+#include "ImageDecoder.h"
+#include "BlockCompression.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+	/** 선형 RGBA32F 밉 한 장 */
+	struct FMipLevel
+	{
+		uint32 Width = 0;
+		uint32 Height = 0;
+		TArray<float> Pixels;
+		TArray<uint8> Bytes;		// 인코딩 입력 (RGBA8)
+	};
+
+	float SRGBToLinear(float Value)
+	{
+		return Value <= 0.04045f ? Value / 12.92f : std::pow((Value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	float LinearToSRGB(float Value)
+	{
+		return Value <= 0.0031308f ? Value * 12.92f : 1.055f * std::pow(Value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	const float* GetSRGBToLinearTable()
+	{
+		static const TArray<float> Table = []()
+		{
+			TArray<float> Result(256);
+			for (int32 Index = 0; Index < 256; ++Index)
+			{
+				Result[Index] = SRGBToLinear(Index / 255.0f);
+			}
+			return Result;
+		}();
+		return Table.data();
+	}
+
+	// 선형 [0, 1] → sRGB 8비트 (pow를 픽셀마다 부르지 않도록 2^14 구간 표)
+	constexpr int32 LinearToSRGBTableSize = 1 << 14;
+
+	const uint8* GetLinearToSRGBTable()
+	{
+		static const TArray<uint8> Table = []()
+		{
+			TArray<uint8> Result(LinearToSRGBTableSize + 1);
+			for (int32 Index = 0; Index <= LinearToSRGBTableSize; ++Index)
+			{
+				Result[Index] = static_cast<uint8>(std::lround(LinearToSRGB(static_cast<float>(Index) / LinearToSRGBTableSize) * 255.0f));
+			}
+			return Result;
+		}();
+		return Table.data();
+	}
+
+	uint8 EncodeChannel(float Value, bool bSRGB)
+	{
+		Value = std::clamp(Value, 0.0f, 1.0f);
+		if (bSRGB)
+		{
+			return GetLinearToSRGBTable()[static_cast<int32>(Value * LinearToSRGBTableSize + 0.5f)];
+		}
+		return static_cast<uint8>(Value * 255.0f + 0.5f);
+	}
+
+	uint16 FloatToHalf(float Value)
+	{
+		uint32 Bits = 0;
+		std::memcpy(&Bits, &Value, 4);
+		const uint32 Sign = (Bits >> 16) & 0x8000u;
+		const int32 Exponent = static_cast<int32>((Bits >> 23) & 0xFF) - 127 + 15;
+		uint32 Mantissa = Bits & 0x7FFFFFu;
+
+		if (((Bits >> 23) & 0xFF) == 0xFF)
+		{
+			// Inf/NaN
+			return static_cast<uint16>(Sign | 0x7C00u | (Mantissa ? 0x200u : 0u));
+		}
+		if (31 <= Exponent)
+		{
+			return static_cast<uint16>(Sign | 0x7C00u);
+		}
+		if (Exponent <= 0)
+		{
+			// 비정규화 수 (너무 작으면 0)
+			if (Exponent < -10)
+			{
+				return static_cast<uint16>(Sign);
+			}
+			Mantissa |= 0x800000u;
+			const int32 Shift = 14 - Exponent;
+			uint32 Half = Mantissa >> Shift;
+			if ((Mantissa >> (Shift - 1)) & 1u)
+			{
+				++Half;
+			}
+			return static_cast<uint16>(Sign | Half);
+		}
+
+		uint32 Half = Sign | (static_cast<uint32>(Exponent) << 10) | (Mantissa >> 13);
+		if (Mantissa & 0x1000u)
+		{
+			++Half;		// 반올림 (지수로 올라가도 올바른 값)
+		}
+		return static_cast<uint16>(Half);
+	}
+
+	/**
+	 * 한 축의 축소 탭 (박스 필터)
+	 * - 짝수 크기: 2탭 반반
+	 * - 홀수 크기: 3탭 ((N-i), N, (i+1)) / (2N+1) — 원본 픽셀이 빠지거나 두 번 세어지지 않는다
+	 */
+	int32 GetDownsampleTaps(uint32 SourceSize, uint32 DestSize, uint32 DestIndex, uint32* OutIndices, float* OutWeights)
+	{
+		if (SourceSize == 1)
+		{
+			OutIndices[0] = 0;
+			OutWeights[0] = 1.0f;
+			return 1;
+		}
+		if ((SourceSize & 1u) == 0)
+		{
+			OutIndices[0] = DestIndex * 2;
+			OutIndices[1] = DestIndex * 2 + 1;
+			OutWeights[0] = OutWeights[1] = 0.5f;
+			return 2;
+		}
+		const float Denominator = static_cast<float>(2 * DestSize + 1);
+		OutIndices[0] = DestIndex * 2;
+		OutIndices[1] = DestIndex * 2 + 1;
+		OutIndices[2] = DestIndex * 2 + 2;
+		OutWeights[0] = static_cast<float>(DestSize - DestIndex) / Denominator;
+		OutWeights[1] = static_cast<float>(DestSize) / Denominator;
+		OutWeights[2] = static_cast<float>(DestIndex + 1) / Denominator;
+		return 3;
+	}
+
+	void RenormalizeNormals(float* Pixels, size_t NumPixels)
+	{
+		for (size_t Pixel = 0; Pixel < NumPixels; ++Pixel)
+		{
+			float* Normal = Pixels + Pixel * 4;
+			const float X = Normal[0] * 2.0f - 1.0f;
+			const float Y = Normal[1] * 2.0f - 1.0f;
+			const float Z = Normal[2] * 2.0f - 1.0f;
+			const float Length = std::sqrt(X * X + Y * Y + Z * Z);
+			if (1e-6f < Length)
+			{
+				Normal[0] = X / Length * 0.5f + 0.5f;
+				Normal[1] = Y / Length * 0.5f + 0.5f;
+				Normal[2] = Z / Length * 0.5f + 0.5f;
+			}
+		}
+	}
+
+	void Downsample(const FMipLevel& Source, FMipLevel& OutDest)
+	{
+		OutDest.Width = std::max(1u, Source.Width / 2);
+		OutDest.Height = std::max(1u, Source.Height / 2);
+		OutDest.Pixels.resize(static_cast<size_t>(OutDest.Width) * OutDest.Height * 4);
+
+		ParallelFor(static_cast<int32>(OutDest.Height), 16, [&](int32 Begin, int32 End)
+		{
+			for (int32 Y = Begin; Y < End; ++Y)
+			{
+				uint32 RowIndices[3];
+				float RowWeights[3];
+				const int32 NumRows = GetDownsampleTaps(Source.Height, OutDest.Height, Y, RowIndices, RowWeights);
+				for (uint32 X = 0; X < OutDest.Width; ++X)
+				{
+					uint32 ColumnIndices[3];
+					float ColumnWeights[3];
+					const int32 NumColumns = GetDownsampleTaps(Source.Width, OutDest.Width, X, ColumnIndices, ColumnWeights);
+
+					float Sum[4] = {};
+					for (int32 Row = 0; Row < NumRows; ++Row)
+					{
+						const float* SourceRow = Source.Pixels.data() + static_cast<size_t>(RowIndices[Row]) * Source.Width * 4;
+						for (int32 Column = 0; Column < NumColumns; ++Column)
+						{
+							const float Weight = RowWeights[Row] * ColumnWeights[Column];
+							const float* Pixel = SourceRow + static_cast<size_t>(ColumnIndices[Column]) * 4;
+							for (int32 Channel = 0; Channel < 4; ++Channel)
+							{
+								Sum[Channel] += Pixel[Channel] * Weight;
+							}
+						}
+					}
+					std::memcpy(OutDest.Pixels.data() + (static_cast<size_t>(Y) * OutDest.Width + X) * 4, Sum, sizeof(Sum));
+				}
+			}
+		});
+	}
+
+	// 블록 압축용으로 4의 배수 크기에 맞춘다 (쌍선형)
+	void ResizeBilinear(const FMipLevel& Source, uint32 Width, uint32 Height, FMipLevel& OutDest)
+	{
+		OutDest.Width = Width;
+		OutDest.Height = Height;
+		OutDest.Pixels.resize(static_cast<size_t>(Width) * Height * 4);
+
+		const float ScaleX = static_cast<float>(Source.Width) / Width;
+		const float ScaleY = static_cast<float>(Source.Height) / Height;
+		ParallelFor(static_cast<int32>(Height), 16, [&](int32 Begin, int32 End)
+		{
+			for (int32 Y = Begin; Y < End; ++Y)
+			{
+				const float SourceY = std::clamp((Y + 0.5f) * ScaleY - 0.5f, 0.0f, static_cast<float>(Source.Height - 1));
+				const uint32 Y0 = static_cast<uint32>(SourceY);
+				const uint32 Y1 = std::min(Y0 + 1, Source.Height - 1);
+				const float FracY = SourceY - Y0;
+				for (uint32 X = 0; X < Width; ++X)
+				{
+					const float SourceX = std::clamp((X + 0.5f) * ScaleX - 0.5f, 0.0f, static_cast<float>(Source.Width - 1));
+					const uint32 X0 = static_cast<uint32>(SourceX);
+					const uint32 X1 = std::min(X0 + 1, Source.Width - 1);
+					const float FracX = SourceX - X0;
+
+					const float* P00 = Source.Pixels.data() + (static_cast<size_t>(Y0) * Source.Width + X0) * 4;
+					const float* P10 = Source.Pixels.data() + (static_cast<size_t>(Y0) * Source.Width + X1) * 4;
+					const float* P01 = Source.Pixels.data() + (static_cast<size_t>(Y1) * Source.Width + X0) * 4;
+					const float* P11 = Source.Pixels.data() + (static_cast<size_t>(Y1) * Source.Width + X1) * 4;
+					float* Dest = OutDest.Pixels.data() + (static_cast<size_t>(Y) * Width + X) * 4;
+					for (int32 Channel = 0; Channel < 4; ++Channel)
+					{
+						const float Top = P00[Channel] + (P10[Channel] - P00[Channel]) * FracX;
+						const float Bottom = P01[Channel] + (P11[Channel] - P01[Channel]) * FracX;
+						Dest[Channel] = Top + (Bottom - Top) * FracY;
+					}
+				}
+			}
+		});
+	}
+
+	int32 GetBlockBytes(ETextureCookFormat Format)
+	{
+		switch (Format)
+		{
+		case ETextureCookFormat::BC1: return FBlockCompression::BC1BlockBytes;
+		case ETextureCookFormat::BC3: return FBlockCompression::BC3BlockBytes;
+		case ETextureCookFormat::BC5: return FBlockCompression::BC5BlockBytes;
+		case ETextureCookFormat::BC7: return FBlockCompression::BC7BlockBytes;
+		default: return 0;
+		}
+	}
+
+	void EncodeBlock(ETextureCookFormat Format, const uint8* Pixels, uint8* OutBlock)
+	{
+		switch (Format)
+		{
+		case ETextureCookFormat::BC1: FBlockCompression::EncodeBC1(Pixels, OutBlock); break;
+		case ETextureCookFormat::BC3: FBlockCompression::EncodeBC3(Pixels, OutBlock); break;
+		case ETextureCookFormat::BC5: FBlockCompression::EncodeBC5(Pixels, OutBlock); break;
+		case ETextureCookFormat::BC7: FBlockCompression::EncodeBC7(Pixels, OutBlock); break;
+		default: break;
+		}
+	}
+
+	void DecodeBlock(ETextureCookFormat Format, const uint8* Block, uint8* OutPixels)
+	{
+		switch (Format)
+		{
+		case ETextureCookFormat::BC1: FBlockCompression::DecodeBC1(Block, OutPixels); break;
+		case ETextureCookFormat::BC3: FBlockCompression::DecodeBC3(Block, OutPixels); break;
+		case ETextureCookFormat::BC5: FBlockCompression::DecodeBC5(Block, OutPixels); break;
+		case ETextureCookFormat::BC7: FBlockCompression::DecodeBC7(Block, OutPixels); break;
+		default: break;
+		}
+	}
+
+	// 블록 하나의 4x4 픽셀 (가장자리는 마지막 줄/열을 복제)
+	void GatherBlock(const FMipLevel& Level, uint32 BlockX, uint32 BlockY, uint8* OutPixels)
+	{
+		for (uint32 PixelY = 0; PixelY < 4; ++PixelY)
+		{
+			const uint32 Y = std::min(BlockY * 4 + PixelY, Level.Height - 1);
+			for (uint32 PixelX = 0; PixelX < 4; ++PixelX)
+			{
+				const uint32 X = std::min(BlockX * 4 + PixelX, Level.Width - 1);
+				std::memcpy(OutPixels + (PixelY * 4 + PixelX) * 4, Level.Bytes.data() + (static_cast<size_t>(Y) * Level.Width + X) * 4, 4);
+			}
+		}
+	}
+
+	uint32 GetNumBlocks(uint32 Size)
+	{
+		return std::max(1u, (Size + 3) / 4);
+	}
+
+	// 밉 0을 다시 풀어 원본(인코딩 입력)과 비교한 PSNR
+	double MeasurePSNR(ETextureCookFormat Format, const FMipLevel& Level, const uint8* EncodedLevel)
+	{
+		const int32 BlockBytes = GetBlockBytes(Format);
+		const uint32 BlocksX = GetNumBlocks(Level.Width);
+		const uint32 BlocksY = GetNumBlocks(Level.Height);
+
+		// 비교할 채널: BC1은 RGB, BC5는 RG, 나머지는 RGBA
+		const int32 NumChannels = Format == ETextureCookFormat::BC1 ? 3 : (Format == ETextureCookFormat::BC5 ? 2 : 4);
+
+		double SquaredError = 0.0;
+		uint64 NumSamples = 0;
+		for (uint32 BlockY = 0; BlockY < BlocksY; ++BlockY)
+		{
+			for (uint32 BlockX = 0; BlockX < BlocksX; ++BlockX)
+			{
+				uint8 Decoded[64];
+				DecodeBlock(Format, EncodedLevel + (static_cast<size_t>(BlockY) * BlocksX + BlockX) * BlockBytes, Decoded);
+				for (uint32 PixelY = 0; PixelY < 4; ++PixelY)
+				{
+					for (uint32 PixelX = 0; PixelX < 4; ++PixelX)
+					{
+						const uint32 X = BlockX * 4 + PixelX;
+						const uint32 Y = BlockY * 4 + PixelY;
+						if (Level.Width <= X || Level.Height <= Y)
+						{
+							continue;
+						}
+						const uint8* Original = Level.Bytes.data() + (static_cast<size_t>(Y) * Level.Width + X) * 4;
+						const uint8* Result = Decoded + (PixelY * 4 + PixelX) * 4;
+						for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+						{
+							const double Delta = static_cast<double>(Original[Channel]) - Result[Channel];
+							SquaredError += Delta * Delta;
+						}
+						NumSamples += NumChannels;
+					}
+				}
+			}
+		}
+
+		const double MeanSquaredError = NumSamples ? SquaredError / NumSamples : 0.0;
+		if (MeanSquaredError <= 0.0)
+		{
+			return 99.0;
+		}
+		return 10.0 * std::log10(255.0 * 255.0 / MeanSquaredError);
+	}
+
+	void AppendUInt32(TArray<uint8>& Out, uint32 Value)
+	{
+		const uint8 Bytes[4] = { static_cast<uint8>(Value), static_cast<uint8>(Value >> 8), static_cast<uint8>(Value >> 16), static_cast<uint8>(Value >> 24) };
+		Out.insert(Out.end(), Bytes, Bytes + 4);
+	}
+
+	// "DDS " + DDS_HEADER(124) + DDS_HEADER_DXT10(20)
+	void WriteDDSHeader(TArray<uint8>& Out, uint32 Width, uint32 Height, uint32 NumMips, uint32 DXGIFormat, uint32 TopLevelBytes, bool bCompressed)
+	{
+		constexpr uint32 DDSD_CAPS = 0x1, DDSD_HEIGHT = 0x2, DDSD_WIDTH = 0x4, DDSD_PITCH = 0x8, DDSD_PIXELFORMAT = 0x1000;
+		constexpr uint32 DDSD_MIPMAPCOUNT = 0x20000, DDSD_LINEARSIZE = 0x80000;
+		constexpr uint32 DDPF_FOURCC = 0x4;
+		constexpr uint32 DDSCAPS_COMPLEX = 0x8, DDSCAPS_TEXTURE = 0x1000, DDSCAPS_MIPMAP = 0x400000;
+		constexpr uint32 D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3;
+
+		AppendUInt32(Out, 0x20534444);		// "DDS "
+		AppendUInt32(Out, 124);
+		AppendUInt32(Out, DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | (bCompressed ? DDSD_LINEARSIZE : DDSD_PITCH));
+		AppendUInt32(Out, Height);
+		AppendUInt32(Out, Width);
+		AppendUInt32(Out, TopLevelBytes);	// 압축: 밉 0 크기, 무압축: 줄 피치
+		AppendUInt32(Out, 0);				// depth
+		AppendUInt32(Out, NumMips);
+		for (int32 Reserved = 0; Reserved < 11; ++Reserved)
+		{
+			AppendUInt32(Out, 0);
+		}
+
+		// DDS_PIXELFORMAT: FourCC "DX10"
+		AppendUInt32(Out, 32);
+		AppendUInt32(Out, DDPF_FOURCC);
+		AppendUInt32(Out, 0x30315844);		// "DX10"
+		for (int32 Field = 0; Field < 5; ++Field)
+		{
+			AppendUInt32(Out, 0);
+		}
+
+		AppendUInt32(Out, DDSCAPS_TEXTURE | (1 < NumMips ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0));
+		for (int32 Field = 0; Field < 4; ++Field)
+		{
+			AppendUInt32(Out, 0);			// caps2, caps3, caps4, reserved2
+		}
+
+		AppendUInt32(Out, DXGIFormat);
+		AppendUInt32(Out, D3D10_RESOURCE_DIMENSION_TEXTURE2D);
+		AppendUInt32(Out, 0);				// miscFlag
+		AppendUInt32(Out, 1);				// arraySize
+		AppendUInt32(Out, 0);				// miscFlags2 (alpha mode unknown)
+	}
+}
+
+bool FTextureCooker::CanCook(const FString& Extension)
+{
+	return FImageDecoder::CanDecode(Extension);
+}
+
+const char* FTextureCooker::GetFormatName(ETextureCookFormat Format)
+{
+	switch (Format)
+	{
+	case ETextureCookFormat::BC1: return "BC1";
+	case ETextureCookFormat::BC3: return "BC3";
+	case ETextureCookFormat::BC5: return "BC5";
+	case ETextureCookFormat::BC7: return "BC7";
+	case ETextureCookFormat::RGBA16F: return "RGBA16F";
+	default: return "Unknown";
+	}
+}
+
+bool FTextureCooker::ParseFormatName(const FString& Name, ETextureCookFormat& OutFormat)
+{
+	FString Upper = Name;
+	std::transform(Upper.begin(), Upper.end(), Upper.begin(), ::toupper);
+	for (ETextureCookFormat Format : { ETextureCookFormat::BC1, ETextureCookFormat::BC3, ETextureCookFormat::BC5, ETextureCookFormat::BC7, ETextureCookFormat::RGBA16F })
+	{
+		if (Upper == GetFormatName(Format))
+		{
+			OutFormat = Format;
+			return true;
+		}
+	}
+	return false;
+}
+
+uint32 FTextureCooker::GetDXGIFormat(ETextureCookFormat Format, bool bSRGB)
+{
+	switch (Format)
+	{
+	case ETextureCookFormat::BC1: return bSRGB ? 72 : 71;		// DXGI_FORMAT_BC1_UNORM(_SRGB)
+	case ETextureCookFormat::BC3: return bSRGB ? 78 : 77;		// DXGI_FORMAT_BC3_UNORM(_SRGB)
+	case ETextureCookFormat::BC5: return 83;					// DXGI_FORMAT_BC5_UNORM
+	case ETextureCookFormat::BC7: return bSRGB ? 99 : 98;		// DXGI_FORMAT_BC7_UNORM(_SRGB)
+	case ETextureCookFormat::RGBA16F: return 10;				// DXGI_FORMAT_R16G16B16A16_FLOAT
+	default: return 0;
+	}
+}
+
+bool FTextureCooker::CookImage(const FImageData& Image, const FTextureCookSettings& InSettings, TArray<uint8>& OutDDS, FTextureCookStats* OutStats)
+{
+	if (!Image.IsValid())
+	{
+		return false;
+	}
+
+	FTextureCookSettings Settings = InSettings;
+	if (Image.bFloat)
+	{
+		Settings.Format = ETextureCookFormat::RGBA16F;
+		Settings.bSRGB = false;
+	}
+	if (Settings.Format == ETextureCookFormat::BC5)
+	{
+		Settings.bSRGB = false;
+		Settings.bNormalMap = true;
+	}
+	const bool bCompressed = Settings.Format != ETextureCookFormat::RGBA16F;
+
+	FTextureCookStats Stats;
+	uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 1. 선형 float로 (밉과 리사이즈는 선형 공간에서)
+	TArray<FMipLevel> Levels(1);
+	FMipLevel& Source = Levels[0];
+	Source.Width = Image.Width;
+	Source.Height = Image.Height;
+	const size_t NumSourcePixels = static_cast<size_t>(Image.Width) * Image.Height;
+	if (Image.bFloat)
+	{
+		Source.Pixels = Image.FloatPixels;
+	}
+	else
+	{
+		Source.Pixels.resize(NumSourcePixels * 4);
+		const float* ToLinear = GetSRGBToLinearTable();
+		ParallelFor(static_cast<int32>(Image.Height), 64, [&](int32 Begin, int32 End)
+		{
+			for (size_t Index = static_cast<size_t>(Begin) * Image.Width * 4; Index < static_cast<size_t>(End) * Image.Width * 4; ++Index)
+			{
+				const uint8 Value = Image.Pixels[Index];
+				Source.Pixels[Index] = (Settings.bSRGB && (Index & 3) != 3) ? ToLinear[Value] : Value / 255.0f;
+			}
+		});
+	}
+
+	// 2. 블록 압축은 밉 0이 4의 배수여야 한다
+	bool bResized = false;
+	if (bCompressed && ((Image.Width & 3) != 0 || (Image.Height & 3) != 0))
+	{
+		FMipLevel Resized;
+		ResizeBilinear(Source, (Image.Width + 3) & ~3u, (Image.Height + 3) & ~3u, Resized);
+		Levels[0] = std::move(Resized);
+		bResized = true;
+	}
+	if (Settings.bNormalMap)
+	{
+		RenormalizeNormals(Levels[0].Pixels.data(), static_cast<size_t>(Levels[0].Width) * Levels[0].Height);
+	}
+
+	// 3. 밉 체인 (이전 밉에서 반씩)
+	if (Settings.bGenerateMips)
+	{
+		while (1 < Levels.back().Width || 1 < Levels.back().Height)
+		{
+			FMipLevel Next;
+			Downsample(Levels.back(), Next);
+			if (Settings.bNormalMap)
+			{
+				RenormalizeNormals(Next.Pixels.data(), static_cast<size_t>(Next.Width) * Next.Height);
+			}
+			Levels.push_back(std::move(Next));
+		}
+	}
+
+	// 4. 인코딩 입력 (RGBA8). 리사이즈/정규화하지 않은 밉 0은 원본 바이트를 그대로 써서 왕복 손실을 없앤다
+	if (bCompressed)
+	{
+		for (size_t LevelIndex = 0; LevelIndex < Levels.size(); ++LevelIndex)
+		{
+			FMipLevel& Level = Levels[LevelIndex];
+			if (LevelIndex == 0 && !bResized && !Settings.bNormalMap)
+			{
+				Level.Bytes = Image.Pixels;
+				continue;
+			}
+			Level.Bytes.resize(static_cast<size_t>(Level.Width) * Level.Height * 4);
+			ParallelFor(static_cast<int32>(Level.Height), 64, [&](int32 Begin, int32 End)
+			{
+				for (size_t Index = static_cast<size_t>(Begin) * Level.Width * 4; Index < static_cast<size_t>(End) * Level.Width * 4; ++Index)
+				{
+					Level.Bytes[Index] = EncodeChannel(Level.Pixels[Index], Settings.bSRGB && (Index & 3) != 3);
+				}
+			});
+		}
+	}
+
+	uint64 NowCycles = FPlatformTime::Cycles64();
+	Stats.MipMilliseconds = FPlatformTime::ToMilliseconds(NowCycles - StartCycles);
+	StartCycles = NowCycles;
+
+	// 5. 밉별 출력 위치를 먼저 정하고, 모든 밉의 블록 줄을 한 번에 나눠 인코딩
+	const int32 BlockBytes = GetBlockBytes(Settings.Format);
+	TArray<size_t> LevelOffsets;
+	size_t PayloadBytes = 0;
+	for (const FMipLevel& Level : Levels)
+	{
+		LevelOffsets.push_back(PayloadBytes);
+		PayloadBytes += bCompressed
+			? static_cast<size_t>(GetNumBlocks(Level.Width)) * GetNumBlocks(Level.Height) * BlockBytes
+			: static_cast<size_t>(Level.Width) * Level.Height * 8;
+		Stats.NumPixels += static_cast<uint64>(Level.Width) * Level.Height;
+	}
+
+	const uint32 TopLevelBytes = bCompressed
+		? GetNumBlocks(Levels[0].Width) * GetNumBlocks(Levels[0].Height) * BlockBytes
+		: Levels[0].Width * 8;
+
+	OutDDS.clear();
+	OutDDS.reserve(148 + PayloadBytes);
+	WriteDDSHeader(OutDDS, Levels[0].Width, Levels[0].Height, static_cast<uint32>(Levels.size()),
+		GetDXGIFormat(Settings.Format, Settings.bSRGB), TopLevelBytes, bCompressed);
+	const size_t HeaderBytes = OutDDS.size();
+	OutDDS.resize(HeaderBytes + PayloadBytes);
+	uint8* Payload = OutDDS.data() + HeaderBytes;
+
+	// 작업 = (밉, 블록 줄). 작은 밉이 많아도 큰 밉과 함께 고르게 나뉜다
+	struct FRowJob
+	{
+		uint32 Level;
+		uint32 Row;
+	};
+	TArray<FRowJob> Jobs;
+	for (uint32 LevelIndex = 0; LevelIndex < Levels.size(); ++LevelIndex)
+	{
+		const uint32 NumRows = bCompressed ? GetNumBlocks(Levels[LevelIndex].Height) : Levels[LevelIndex].Height;
+		for (uint32 Row = 0; Row < NumRows; ++Row)
+		{
+			Jobs.push_back({ LevelIndex, Row });
+		}
+	}
+
+	ParallelFor(static_cast<int32>(Jobs.size()), 4, [&](int32 Begin, int32 End)
+	{
+		for (int32 JobIndex = Begin; JobIndex < End; ++JobIndex)
+		{
+			const FRowJob& Job = Jobs[JobIndex];
+			const FMipLevel& Level = Levels[Job.Level];
+			uint8* LevelData = Payload + LevelOffsets[Job.Level];
+			if (bCompressed)
+			{
+				const uint32 BlocksX = GetNumBlocks(Level.Width);
+				uint8 BlockPixels[64];
+				for (uint32 BlockX = 0; BlockX < BlocksX; ++BlockX)
+				{
+					GatherBlock(Level, BlockX, Job.Row, BlockPixels);
+					EncodeBlock(Settings.Format, BlockPixels, LevelData + (static_cast<size_t>(Job.Row) * BlocksX + BlockX) * BlockBytes);
+				}
+			}
+			else
+			{
+				const float* Source = Level.Pixels.data() + static_cast<size_t>(Job.Row) * Level.Width * 4;
+				uint8* Dest = LevelData + static_cast<size_t>(Job.Row) * Level.Width * 8;
+				for (uint32 Channel = 0; Channel < Level.Width * 4; ++Channel)
+				{
+					const uint16 Half = FloatToHalf(Source[Channel]);
+					std::memcpy(Dest + Channel * 2, &Half, 2);
+				}
+			}
+		}
+	});
+
+	NowCycles = FPlatformTime::Cycles64();
+	Stats.EncodeMilliseconds = FPlatformTime::ToMilliseconds(NowCycles - StartCycles);
+
+	if (Settings.bMeasureQuality && bCompressed)
+	{
+		Stats.PSNR = MeasurePSNR(Settings.Format, Levels[0], Payload);
+	}
+
+	Stats.Width = Levels[0].Width;
+	Stats.Height = Levels[0].Height;
+	Stats.NumMips = static_cast<uint32>(Levels.size());
+	Stats.OutputBytes = OutDDS.size();
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+	return true;
+}
+
+namespace
+{
+	bool CookFileUnguarded(const FString& SourcePath, const FString& OutputPath, const FTextureCookSettings& Settings,
+		FTextureCookStats* OutStats, FString* OutError)
+	{
+		uint64 StartCycles = FPlatformTime::Cycles64();
+
+		FImageData Image;
+		if (!FImageDecoder::DecodeFile(SourcePath, Image, OutError))
+		{
+			return false;
+		}
+		const double DecodeMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+		TArray<uint8> DDS;
+		FTextureCookStats Stats;
+		if (!FTextureCooker::CookImage(Image, Settings, DDS, &Stats))
+		{
+			if (OutError)
+			{
+				*OutError = "cook failed";
+			}
+			return false;
+		}
+		Stats.DecodeMilliseconds = DecodeMilliseconds;
+
+		// 다른 스레드가 반쯤 쓴 파일을 읽지 않도록 임시 파일에 쓰고 바꾼다
+		StartCycles = FPlatformTime::Cycles64();
+		const std::filesystem::path FinalPath(reinterpret_cast<const char8_t*>(OutputPath.c_str()));
+		std::filesystem::path TempPath = FinalPath;
+		TempPath += ".tmp";
+
+		std::error_code ErrorCode;
+		if (FinalPath.has_parent_path())
+		{
+			std::filesystem::create_directories(FinalPath.parent_path(), ErrorCode);
+		}
+		{
+			std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+			if (!File || !File.write(reinterpret_cast<const char*>(DDS.data()), static_cast<std::streamsize>(DDS.size())))
+			{
+				if (OutError)
+				{
+					*OutError = "cannot write output";
+				}
+				return false;
+			}
+		}
+		std::filesystem::rename(TempPath, FinalPath, ErrorCode);
+		if (ErrorCode)
+		{
+			std::filesystem::remove(TempPath, ErrorCode);
+			if (OutError)
+			{
+				*OutError = "cannot replace output";
+			}
+			return false;
+		}
+		Stats.WriteMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+		if (OutStats)
+		{
+			*OutStats = Stats;
+		}
+		return true;
+	}
+}
+
+bool FTextureCooker::CookFile(const FString& SourcePath, const FString& OutputPath, const FTextureCookSettings& Settings,
+	FTextureCookStats* OutStats, FString* OutError)
+{
+	// 백그라운드 작업 스레드에서 도므로, 디코더가 못 거른 할당 실패가 에디터를 종료시키지 않게 쿡 실패로 바꾼다
+	try
+	{
+		return CookFileUnguarded(SourcePath, OutputPath, Settings, OutStats, OutError);
+	}
+	catch (const std::bad_alloc&)
+	{
+		if (OutError)
+		{
+			*OutError = "out of memory";
+		}
+	}
+	catch (const std::length_error&)
+	{
+		if (OutError)
+		{
+			*OutError = "image too large";
+		}
+	}
+	return false;
+}
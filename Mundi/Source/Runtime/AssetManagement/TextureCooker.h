@@ -0,0 +1,61 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+struct FImageData;
+
+enum class ETextureCookFormat : uint8
+{
+	BC1,		// RGB (알파 없음)
+	BC3,		// RGB + 알파
+	BC5,		// 두 채널 (노멀 맵 XY)
+	BC7,		// RGBA 고품질 (모드 6)
+	RGBA16F,	// HDR 입력 (블록 압축 없음)
+};
+
+struct FTextureCookSettings
+{
+	ETextureCookFormat Format = ETextureCookFormat::BC3;
+	bool bSRGB = true;				// 색 채널을 sRGB로 보고 선형 공간에서 밉을 만든다 (DDS 포맷도 _SRGB. BC5는 무시)
+	bool bGenerateMips = true;
+	bool bNormalMap = false;		// 밉마다 XYZ를 다시 정규화 (BC5는 항상)
+	bool bMeasureQuality = false;	// 인코딩 결과를 다시 풀어 밉 0의 PSNR 계산
+};
+
+struct FTextureCookStats
+{
+	uint32 Width = 0;				// 블록 정렬 후 밉 0 크기
+	uint32 Height = 0;
+	uint32 NumMips = 0;
+	uint64 NumPixels = 0;			// 모든 밉의 픽셀 수
+	uint64 OutputBytes = 0;			// DDS 파일 크기
+	double DecodeMilliseconds = 0.0;
+	double MipMilliseconds = 0.0;
+	double EncodeMilliseconds = 0.0;
+	double WriteMilliseconds = 0.0;
+	double PSNR = 0.0;				// dB (bMeasureQuality일 때만. 손실이 없으면 99)
+};
+
+/**
+ * 플랫폼 API 없이 도는 텍스처 쿠커 (PNG/TGA/HDR → DDS)
+ * - 디코드는 FImageDecoder, 블록 압축은 FBlockCompression
+ * - 밉은 선형 공간에서 박스 필터로 만든다 (sRGB 입력은 풀었다가 다시 감마 적용. 홀수 크기는 3탭 가중치)
+ * - 블록 압축은 D3D11 규칙대로 밉 0을 4의 배수로 맞춘 뒤, 모든 밉의 블록 줄을 한 번에 ParallelFor로 나눠 인코딩한다
+ * - HDR 입력은 RGBA16F로만 쓴다 (BC6H 인코더는 없음)
+ * - 출력은 DX10 확장 헤더를 쓰는 DDS (FTextureConverter::GetDDSCachePath 위치에 쓰면 UTexture가 그대로 읽는다)
+ */
+class FTextureCooker
+{
+public:
+	static bool CanCook(const FString& Extension);
+
+	static bool CookFile(const FString& SourcePath, const FString& OutputPath, const FTextureCookSettings& Settings,
+		FTextureCookStats* OutStats = nullptr, FString* OutError = nullptr);
+
+	// 디코드된 이미지를 DDS 파일 내용으로
+	static bool CookImage(const FImageData& Image, const FTextureCookSettings& Settings, TArray<uint8>& OutDDS, FTextureCookStats* OutStats = nullptr);
+
+	static const char* GetFormatName(ETextureCookFormat Format);
+	static bool ParseFormatName(const FString& Name, ETextureCookFormat& OutFormat);
+	// DDS DX10 헤더에 쓰는 DXGI_FORMAT 값 (플랫폼 헤더 없이 숫자로)
+	static uint32 GetDXGIFormat(ETextureCookFormat Format, bool bSRGB);
+};
@@ -0,0 +1,544 @@
+﻿#include "pch.h"
+#include "VertexQuantization.h"
+#include "SkeletalMesh.h"
+#include "SkeletalMeshComponent.h"
+#include "ObjManager.h"
+#include "FbxImporter.h"
+#include "FbxImportOptions.h"
+#include "ObjectFactory.h"
+#include "PlatformTime.h"
+#include <filesystem>
+
+namespace
+{
+	constexpr int32 MaxGridIndex = 1 << 24;		// float가 정수를 정확히 표현하는 범위 (격자점 k * Step이 정확하도록)
+	constexpr float MinStep = 9.094947e-13f;	// 2^-40 (바운드가 0인 축)
+
+	// X 이상인 가장 작은 2의 거듭제곱 (X <= 0이면 0)
+	float Pow2Ceil(float X)
+	{
+		if (!(X > 0.0f))
+		{
+			return 0.0f;
+		}
+		int32 Exponent;
+		const float Mantissa = std::frexp(X, &Exponent);
+		return std::ldexp(1.0f, Mantissa == 0.5f ? Exponent - 1 : Exponent);
+	}
+
+	// [Min, Max]를 덮는 16비트 격자의 Step (2의 거듭제곱)
+	// 조건은 "격자 인덱스 구간 floor(Min/Step) ~ ceil(Max/Step)이 65535칸 이하, |인덱스| <= 2^24"이고 Step이 커질수록 항상 만족한다.
+	// 복원값은 이 격자 위에 있으므로 복원값으로 다시 구해도 Step이 같거나 작아지고, 작아져도 격자점은 그대로 표현된다 (왕복이 멱등)
+	float ChooseStep(float Min, float Max)
+	{
+		const float Extent = Max - Min;
+		const float Magnitude = std::max(std::fabs(Min), std::fabs(Max));
+		float Step = std::max({ Pow2Ceil(Extent / 65535.0f), Pow2Ceil(Magnitude / static_cast<float>(MaxGridIndex)), MinStep });
+		for (;;)
+		{
+			const double Lo = std::floor(static_cast<double>(Min) / Step);
+			const double Hi = std::ceil(static_cast<double>(Max) / Step);
+			if (Hi - Lo <= 65535.0 && std::max(std::fabs(Lo), std::fabs(Hi)) <= MaxGridIndex)
+			{
+				return Step;
+			}
+			Step *= 2.0f;
+		}
+	}
+
+	inline float GridMin(float Min, float Step)
+	{
+		return std::floor(Min / Step) * Step;
+	}
+
+	inline uint16 QuantizeUnorm16(float Value, float Min, float Step)
+	{
+		const float Q = std::round((Value - Min) / Step);
+		return static_cast<uint16>(std::clamp(Q, 0.0f, 65535.0f));
+	}
+
+	inline uint8 QuantizeUnorm8(float Value)
+	{
+		return static_cast<uint8>(std::round(std::clamp(Value, 0.0f, 1.0f) * 255.0f));
+	}
+
+	inline int16 QuantizeSign(float Value)
+	{
+		return static_cast<int16>(Value > 0.0f ? 1 : (Value < 0.0f ? -1 : 0));
+	}
+
+	template<typename TVertex, typename FGetPosition, typename FGetUV>
+	FVertexQuantizationParams ComputeParamsImpl(const TArray<TVertex>& Vertices, FGetPosition GetPosition, FGetUV GetUV)
+	{
+		FVertexQuantizationParams Params;
+		if (Vertices.empty())
+		{
+			return Params;
+		}
+
+		FVector PosMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector PosMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		FVector2D UVMin(FLT_MAX, FLT_MAX);
+		FVector2D UVMax(-FLT_MAX, -FLT_MAX);
+		for (const TVertex& Vertex : Vertices)
+		{
+			const FVector& Position = GetPosition(Vertex);
+			const FVector2D& UV = GetUV(Vertex);
+			PosMin = FVector(std::min(PosMin.X, Position.X), std::min(PosMin.Y, Position.Y), std::min(PosMin.Z, Position.Z));
+			PosMax = FVector(std::max(PosMax.X, Position.X), std::max(PosMax.Y, Position.Y), std::max(PosMax.Z, Position.Z));
+			UVMin = FVector2D(std::min(UVMin.X, UV.X), std::min(UVMin.Y, UV.Y));
+			UVMax = FVector2D(std::max(UVMax.X, UV.X), std::max(UVMax.Y, UV.Y));
+		}
+
+		Params.PositionStep = FVector(ChooseStep(PosMin.X, PosMax.X), ChooseStep(PosMin.Y, PosMax.Y), ChooseStep(PosMin.Z, PosMax.Z));
+		Params.PositionMin = FVector(GridMin(PosMin.X, Params.PositionStep.X), GridMin(PosMin.Y, Params.PositionStep.Y), GridMin(PosMin.Z, Params.PositionStep.Z));
+		Params.UVStep = FVector2D(ChooseStep(UVMin.X, UVMax.X), ChooseStep(UVMin.Y, UVMax.Y));
+		Params.UVMin = FVector2D(GridMin(UVMin.X, Params.UVStep.X), GridMin(UVMin.Y, Params.UVStep.Y));
+		return Params;
+	}
+
+	// 위치/법선/탄젠트/UV는 두 형식이 같은 인코딩을 쓴다
+	template<typename TQuantized>
+	void EncodeCommon(const FVector& Position, const FVector& Normal, const FVector4& Tangent, const FVector2D& UV,
+		const FVertexQuantizationParams& Params, TQuantized& Out)
+	{
+		Out.Position[0] = QuantizeUnorm16(Position.X, Params.PositionMin.X, Params.PositionStep.X);
+		Out.Position[1] = QuantizeUnorm16(Position.Y, Params.PositionMin.Y, Params.PositionStep.Y);
+		Out.Position[2] = QuantizeUnorm16(Position.Z, Params.PositionMin.Z, Params.PositionStep.Z);
+		Out.TangentSign = QuantizeSign(Tangent.W);
+		FVertexQuantizer::EncodeOctahedral(Normal, Out.Normal);
+		FVertexQuantizer::EncodeOctahedral(FVector(Tangent.X, Tangent.Y, Tangent.Z), Out.Tangent);
+		Out.UV[0] = QuantizeUnorm16(UV.X, Params.UVMin.X, Params.UVStep.X);
+		Out.UV[1] = QuantizeUnorm16(UV.Y, Params.UVMin.Y, Params.UVStep.Y);
+	}
+
+	template<typename TQuantized>
+	void DecodeCommon(const TQuantized& In, const FVertexQuantizationParams& Params, FVector& OutPosition, FVector& OutNormal, FVector4& OutTangent, FVector2D& OutUV)
+	{
+		OutPosition = FVertexQuantizer::DecodePosition(In.Position, Params);
+		OutNormal = FVertexQuantizer::DecodeOctahedral(In.Normal);
+		const FVector Tangent = FVertexQuantizer::DecodeOctahedral(In.Tangent);
+		OutTangent = FVector4(Tangent.X, Tangent.Y, Tangent.Z, static_cast<float>(In.TangentSign));
+		OutUV = FVertexQuantizer::DecodeUV(In.UV, Params);
+	}
+
+	// 가중치를 합이 255인 정수로 (내림 후 남는 몫을 소수부가 큰 슬롯부터 하나씩, 같으면 앞 슬롯)
+	void QuantizeBoneWeights(const float Weights[4], uint8 OutWeights[4])
+	{
+		float Sum = 0.0f;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			Sum += std::max(Weights[i], 0.0f);
+		}
+		if (!(Sum > 0.0f))
+		{
+			std::fill(OutWeights, OutWeights + 4, static_cast<uint8>(0));
+			return;
+		}
+
+		int32 Floors[4];
+		float Remainders[4];
+		int32 Remaining = 255;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const float Scaled = std::max(Weights[i], 0.0f) / Sum * 255.0f;
+			Floors[i] = std::min(static_cast<int32>(Scaled), 255);
+			Remainders[i] = Scaled - static_cast<float>(Floors[i]);
+			Remaining -= Floors[i];
+		}
+		while (Remaining > 0)
+		{
+			int32 Best = 0;
+			for (int32 i = 1; i < 4; ++i)
+			{
+				if (Remainders[i] > Remainders[Best])
+				{
+					Best = i;
+				}
+			}
+			++Floors[Best];
+			Remainders[Best] = -1.0f;
+			--Remaining;
+		}
+		for (int32 i = 0; i < 4; ++i)
+		{
+			OutWeights[i] = static_cast<uint8>(std::clamp(Floors[i], 0, 255));
+		}
+	}
+
+	// atan2 형태라 아주 작은 각도도 정확하다 (acos는 1 근처에서 float 정밀도에 묻힌다)
+	inline float AngleDegrees(const FVector& A, const FVector& B)
+	{
+		return RadiansToDegrees(std::atan2(FVector::Cross(A, B).Size(), FVector::Dot(A, B)));
+	}
+
+	/** 원본 대비 최대 오차 (MESH QUANTIZE) */
+	struct FQuantizationError
+	{
+		float Position = 0.0f;
+		float NormalDegrees = 0.0f;
+		float TangentDegrees = 0.0f;
+		float UV = 0.0f;
+		float Extra = 0.0f;			// 스태틱: 색, 스켈레탈: 본 가중치
+
+		void AddCommon(const FVector& Position0, const FVector& Position1, const FVector& Normal0, const FVector& Normal1,
+			const FVector4& Tangent0, const FVector4& Tangent1, const FVector2D& UV0, const FVector2D& UV1)
+		{
+			Position = std::max({ Position, std::fabs(Position0.X - Position1.X), std::fabs(Position0.Y - Position1.Y), std::fabs(Position0.Z - Position1.Z) });
+			// 길이가 0인 방향(탄젠트가 없는 메시)은 비교하지 않는다
+			if (Normal0.SizeSquared() > 1e-12f)
+			{
+				NormalDegrees = std::max(NormalDegrees, AngleDegrees(Normal0, Normal1));
+			}
+			const FVector T0(Tangent0.X, Tangent0.Y, Tangent0.Z);
+			if (T0.SizeSquared() > 1e-12f)
+			{
+				TangentDegrees = std::max(TangentDegrees, AngleDegrees(T0, FVector(Tangent1.X, Tangent1.Y, Tangent1.Z)));
+			}
+			UV = std::max({ UV, std::fabs(UV0.X - UV1.X), std::fabs(UV0.Y - UV1.Y) });
+		}
+	};
+
+	template<typename FFunc>
+	double BestMilliseconds(int32 NumIterations, FFunc&& Func)
+	{
+		double Best = 1e30;
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			Func();
+			Best = std::min(Best, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+		}
+		return Best;
+	}
+
+	void LogSizes(const char* Name, size_t NumVertices, size_t FullStride, size_t CompactStride)
+	{
+		const double FullMB = static_cast<double>(NumVertices * FullStride) / (1024.0 * 1024.0);
+		const double CompactMB = static_cast<double>(NumVertices * CompactStride) / (1024.0 * 1024.0);
+		UE_LOG("[VertexQuantize] %s: %zu vertices, %zu -> %zu bytes/vertex, %.2f MB -> %.2f MB (%.1f%%)",
+			Name, NumVertices, FullStride, CompactStride, FullMB, CompactMB, FullMB > 0.0 ? 100.0 * CompactMB / FullMB : 100.0);
+	}
+
+	void ReportStaticMesh(const FString& PathFileName, const FStaticMesh& Mesh)
+	{
+		constexpr int32 NumIterations = 5;
+		const TArray<FNormalVertex>& Vertices = Mesh.Vertices;
+		const FVertexQuantizationParams Params = FVertexQuantizer::ComputeParams(Vertices);
+
+		TArray<FQuantizedNormalVertex> Quantized;
+		const double EncodeMs = BestMilliseconds(1, [&]() { FVertexQuantizer::Quantize(Vertices, Params, Quantized); });
+
+		TArray<FNormalVertex> Decoded;
+		const double DecodeMs = BestMilliseconds(NumIterations, [&]() { FVertexQuantizer::Dequantize(Quantized.data(), Quantized.size(), Params, Decoded); });
+		// 압축하지 않은 캐시의 로드 비용 (섹션 memcpy 한 번)
+		TArray<FNormalVertex> Copied(Vertices.size());
+		const double CopyMs = BestMilliseconds(NumIterations, [&]() { std::memcpy(Copied.data(), Vertices.data(), Vertices.size() * sizeof(FNormalVertex)); });
+
+		FQuantizationError Error;
+		for (size_t i = 0; i < Vertices.size(); ++i)
+		{
+			const FNormalVertex& A = Vertices[i];
+			const FNormalVertex& B = Decoded[i];
+			Error.AddCommon(A.pos, B.pos, A.normal, B.normal, A.Tangent, B.Tangent, A.tex, B.tex);
+			Error.Extra = std::max({ Error.Extra, std::fabs(A.color.X - B.color.X), std::fabs(A.color.Y - B.color.Y),
+				std::fabs(A.color.Z - B.color.Z), std::fabs(A.color.W - B.color.W) });
+		}
+
+		UE_LOG("[VertexQuantize] '%s' (static)", PathFileName.c_str());
+		LogSizes("FNormalVertex", Vertices.size(), sizeof(FNormalVertex), sizeof(FQuantizedNormalVertex));
+		UE_LOG("[VertexQuantize] Position step (%g, %g, %g), UV step (%g, %g)", Params.PositionStep.X, Params.PositionStep.Y, Params.PositionStep.Z,
+			Params.UVStep.X, Params.UVStep.Y);
+		UE_LOG("[VertexQuantize] Max error: position %g, normal %.4f deg, tangent %.4f deg, UV %g, color %g",
+			Error.Position, Error.NormalDegrees, Error.TangentDegrees, Error.UV, Error.Extra);
+		UE_LOG("[VertexQuantize] Encode %.2f ms, decode %.2f ms vs full-precision copy %.2f ms", EncodeMs, DecodeMs, CopyMs);
+	}
+
+	void ReportSkeletalMesh(const FString& PathFileName, const FSkeletalMesh& Mesh)
+	{
+		constexpr int32 NumIterations = 5;
+		const TArray<FSkinnedVertex>& Vertices = Mesh.Vertices;
+		const FVertexQuantizationParams Params = FVertexQuantizer::ComputeParams(Vertices);
+
+		UE_LOG("[VertexQuantize] '%s' (skeletal, %d bones)", PathFileName.c_str(), Mesh.Skeleton ? Mesh.Skeleton->GetBoneCount() : 0);
+		LogSizes("FSkinnedVertex", Vertices.size(), sizeof(FSkinnedVertex), sizeof(FQuantizedSkinnedVertex));
+
+		TArray<FQuantizedSkinnedVertex> Quantized;
+		if (!FVertexQuantizer::Quantize(Vertices, Params, Quantized))
+		{
+			UE_LOG("[VertexQuantize] Bone indices exceed 255, the mesh stays at full precision");
+			return;
+		}
+
+		TArray<FSkinnedVertex> Decoded;
+		const double DecodeMs = BestMilliseconds(NumIterations, [&]() { FVertexQuantizer::Dequantize(Quantized.data(), Quantized.size(), Params, Decoded); });
+
+		FQuantizationError Error;
+		for (size_t i = 0; i < Vertices.size(); ++i)
+		{
+			const FSkinnedVertex& A = Vertices[i];
+			const FSkinnedVertex& B = Decoded[i];
+			Error.AddCommon(A.Position, B.Position, A.Normal, B.Normal, A.Tangent, B.Tangent, A.UV, B.UV);
+			for (int32 j = 0; j < 4; ++j)
+			{
+				Error.Extra = std::max(Error.Extra, std::fabs(A.BoneWeights[j] - B.BoneWeights[j]));
+			}
+		}
+
+		// CPU 스키닝 한 번: 본 행렬은 모두 단위 행렬 (연산량은 실제와 같고 결과만 바인드 포즈)
+		const int32 NumBones = Mesh.Skeleton ? Mesh.Skeleton->GetBoneCount() : 1;
+		const TArray<FMatrix> BoneMatrices(std::max(NumBones, 1), FMatrix::Identity());
+		TArray<FNormalVertex> Skinned;
+		const double FullSkinMs = BestMilliseconds(NumIterations, [&]() { USkeletalMeshComponent::SkinVertices(Vertices, BoneMatrices, Skinned); });
+		const double QuantizedSkinMs = BestMilliseconds(NumIterations, [&]() { USkeletalMeshComponent::SkinVertices(Quantized, Params, BoneMatrices, Skinned); });
+
+		UE_LOG("[VertexQuantize] Position step (%g, %g, %g), UV step (%g, %g)", Params.PositionStep.X, Params.PositionStep.Y, Params.PositionStep.Z,
+			Params.UVStep.X, Params.UVStep.Y);
+		UE_LOG("[VertexQuantize] Max error: position %g, normal %.4f deg, tangent %.4f deg, UV %g, bone weight %g",
+			Error.Position, Error.NormalDegrees, Error.TangentDegrees, Error.UV, Error.Extra);
+		UE_LOG("[VertexQuantize] Decode %.2f ms", DecodeMs);
+		UE_LOG("[VertexQuantize] CPU skinning: full %.2f ms (reads %.2f MB), quantized %.2f ms (reads %.2f MB)",
+			FullSkinMs, static_cast<double>(Vertices.size() * sizeof(FSkinnedVertex)) / (1024.0 * 1024.0),
+			QuantizedSkinMs, static_cast<double>(Quantized.size() * sizeof(FQuantizedSkinnedVertex)) / (1024.0 * 1024.0));
+	}
+}
+
+bool FVertexQuantizer::IsCacheQuantizationEnabled()
+{
+	static const bool bEnabled = []()
+	{
+		const FString* Value = EditorINI.Find("MeshCacheQuantize");
+		return Value && (*Value == "1" || *Value == "true" || *Value == "True");
+	}();
+	return bEnabled;
+}
+
+uint32 FVertexQuantizer::GetCacheKey()
+{
+	// 압축 캐시를 켜면 임포트한 정점이 양자화 격자로 바뀌므로 캐시 키도 달라야 한다
+	return IsCacheQuantizationEnabled() ? 0x51A7E000u : 0u;
+}
+
+FVertexQuantizationParams FVertexQuantizer::ComputeParams(const TArray<FNormalVertex>& Vertices)
+{
+	return ComputeParamsImpl(Vertices,
+		[](const FNormalVertex& Vertex) -> const FVector& { return Vertex.pos; },
+		[](const FNormalVertex& Vertex) -> const FVector2D& { return Vertex.tex; });
+}
+
+FVertexQuantizationParams FVertexQuantizer::ComputeParams(const TArray<FSkinnedVertex>& Vertices)
+{
+	return ComputeParamsImpl(Vertices,
+		[](const FSkinnedVertex& Vertex) -> const FVector& { return Vertex.Position; },
+		[](const FSkinnedVertex& Vertex) -> const FVector2D& { return Vertex.UV; });
+}
+
+bool FVertexQuantizer::IsValidParams(const FVertexQuantizationParams& Params)
+{
+	auto IsValidStep = [](float Step)
+	{
+		return std::isfinite(Step) && Step > 0.0f && Pow2Ceil(Step) == Step;
+	};
+	return IsValidStep(Params.PositionStep.X) && IsValidStep(Params.PositionStep.Y) && IsValidStep(Params.PositionStep.Z) &&
+		IsValidStep(Params.UVStep.X) && IsValidStep(Params.UVStep.Y) &&
+		std::isfinite(Params.PositionMin.X) && std::isfinite(Params.PositionMin.Y) && std::isfinite(Params.PositionMin.Z) &&
+		std::isfinite(Params.UVMin.X) && std::isfinite(Params.UVMin.Y);
+}
+
+void FVertexQuantizer::EncodeOctahedral(const FVector& Direction, int16 OutQ[2])
+{
+	const float L1 = std::fabs(Direction.X) + std::fabs(Direction.Y) + std::fabs(Direction.Z);
+	if (!(L1 > 1e-20f))
+	{
+		OutQ[0] = 0;
+		OutQ[1] = 0;
+		return;
+	}
+
+	float X = Direction.X / L1;
+	float Y = Direction.Y / L1;
+	if (Direction.Z < 0.0f)
+	{
+		const float FoldedX = (1.0f - std::fabs(Y)) * (X >= 0.0f ? 1.0f : -1.0f);
+		const float FoldedY = (1.0f - std::fabs(X)) * (Y >= 0.0f ? 1.0f : -1.0f);
+		X = FoldedX;
+		Y = FoldedY;
+	}
+
+	// 반올림한 점과 주변 격자점 중 복원 방향이 원래 방향에 가장 가까운 것 (Cigolle et al. 2014의 정밀 인코딩)
+	// 이웃 격자점끼리는 내적 차이가 float 정밀도보다 작으므로 거리 제곱으로 비교한다
+	const FVector Target = Direction * (1.0f / std::sqrt(Direction.SizeSquared()));
+	auto DistanceSquared = [&Target](const int16 Q[2])
+	{
+		const FVector Decoded = DecodeOctahedral(Q);
+		const FVector Delta(Decoded.X - Target.X, Decoded.Y - Target.Y, Decoded.Z - Target.Z);
+		return Delta.SizeSquared();
+	};
+
+	const float ScaledX = std::clamp(X, -1.0f, 1.0f) * 32767.0f;
+	const float ScaledY = std::clamp(Y, -1.0f, 1.0f) * 32767.0f;
+	int16 Best[2] = { static_cast<int16>(std::round(ScaledX)), static_cast<int16>(std::round(ScaledY)) };
+	float BestDistance = DistanceSquared(Best);
+	for (int32 Candidate = 0; Candidate < 4; ++Candidate)
+	{
+		const int16 Q[2] = {
+			static_cast<int16>((Candidate & 1) ? std::ceil(ScaledX) : std::floor(ScaledX)),
+			static_cast<int16>((Candidate & 2) ? std::ceil(ScaledY) : std::floor(ScaledY)) };
+		const float Distance = DistanceSquared(Q);
+		if (Distance < BestDistance)
+		{
+			BestDistance = Distance;
+			Best[0] = Q[0];
+			Best[1] = Q[1];
+		}
+	}
+	OutQ[0] = Best[0];
+	OutQ[1] = Best[1];
+}
+
+void FVertexQuantizer::Quantize(const TArray<FNormalVertex>& Vertices, const FVertexQuantizationParams& Params, TArray<FQuantizedNormalVertex>& OutVertices)
+{
+	OutVertices.resize(Vertices.size());
+	for (size_t i = 0; i < Vertices.size(); ++i)
+	{
+		const FNormalVertex& In = Vertices[i];
+		FQuantizedNormalVertex& Out = OutVertices[i];
+		EncodeCommon(In.pos, In.normal, In.Tangent, In.tex, Params, Out);
+		Out.Color[0] = QuantizeUnorm8(In.color.X);
+		Out.Color[1] = QuantizeUnorm8(In.color.Y);
+		Out.Color[2] = QuantizeUnorm8(In.color.Z);
+		Out.Color[3] = QuantizeUnorm8(In.color.W);
+	}
+}
+
+bool FVertexQuantizer::Quantize(const TArray<FSkinnedVertex>& Vertices, const FVertexQuantizationParams& Params, TArray<FQuantizedSkinnedVertex>& OutVertices)
+{
+	OutVertices.resize(Vertices.size());
+	for (size_t i = 0; i < Vertices.size(); ++i)
+	{
+		const FSkinnedVertex& In = Vertices[i];
+		FQuantizedSkinnedVertex& Out = OutVertices[i];
+		EncodeCommon(In.Position, In.Normal, In.Tangent, In.UV, Params, Out);
+
+		QuantizeBoneWeights(In.BoneWeights, Out.BoneWeights);
+		for (int32 j = 0; j < 4; ++j)
+		{
+			const int32 BoneIndex = In.BoneIndices[j];
+			if (BoneIndex < 0 || BoneIndex > 255)
+			{
+				// 가중치가 없는 슬롯의 인덱스는 의미가 없다
+				if (Out.BoneWeights[j] != 0)
+				{
+					OutVertices.clear();
+					return false;
+				}
+				Out.BoneIndices[j] = 0;
+				continue;
+			}
+			Out.BoneIndices[j] = static_cast<uint8>(BoneIndex);
+		}
+	}
+	return true;
+}
+
+void FVertexQuantizer::Dequantize(const FQuantizedNormalVertex* Vertices, size_t NumVertices, const FVertexQuantizationParams& Params, TArray<FNormalVertex>& OutVertices)
+{
+	OutVertices.resize(NumVertices);
+	for (size_t i = 0; i < NumVertices; ++i)
+	{
+		const FQuantizedNormalVertex& In = Vertices[i];
+		FNormalVertex& Out = OutVertices[i];
+		DecodeCommon(In, Params, Out.pos, Out.normal, Out.Tangent, Out.tex);
+		Out.color = FVector4(In.Color[0] / 255.0f, In.Color[1] / 255.0f, In.Color[2] / 255.0f, In.Color[3] / 255.0f);
+	}
+}
+
+void FVertexQuantizer::Dequantize(const FQuantizedSkinnedVertex* Vertices, size_t NumVertices, const FVertexQuantizationParams& Params, TArray<FSkinnedVertex>& OutVertices)
+{
+	OutVertices.resize(NumVertices);
+	for (size_t i = 0; i < NumVertices; ++i)
+	{
+		const FQuantizedSkinnedVertex& In = Vertices[i];
+		FSkinnedVertex& Out = OutVertices[i];
+		DecodeCommon(In, Params, Out.Position, Out.Normal, Out.Tangent, Out.UV);
+		for (int32 j = 0; j < 4; ++j)
+		{
+			Out.BoneIndices[j] = In.BoneIndices[j];
+			Out.BoneWeights[j] = In.BoneWeights[j] / 255.0f;
+		}
+	}
+}
+
+void FVertexQuantizer::RoundTrip(TArray<FNormalVertex>& Vertices)
+{
+	const FVertexQuantizationParams Params = ComputeParams(Vertices);
+	TArray<FQuantizedNormalVertex> Quantized;
+	Quantize(Vertices, Params, Quantized);
+	Dequantize(Quantized.data(), Quantized.size(), Params, Vertices);
+}
+
+bool FVertexQuantizer::RoundTrip(TArray<FSkinnedVertex>& Vertices)
+{
+	const FVertexQuantizationParams Params = ComputeParams(Vertices);
+	TArray<FQuantizedSkinnedVertex> Quantized;
+	if (!Quantize(Vertices, Params, Quantized))
+	{
+		return false;
+	}
+	Dequantize(Quantized.data(), Quantized.size(), Params, Vertices);
+	return true;
+}
+
+bool FVertexQuantizer::ReportFile(const FString& PathFileName)
+{
+	FString Extension = std::filesystem::path(PathFileName).extension().string();
+	std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+
+	if (Extension == ".obj")
+	{
+		FObjInfo RawObjInfo;
+		TArray<FMaterialInfo> MaterialInfos;
+		FStaticMesh Mesh;
+		if (!FObjImporter::LoadObjModel(PathFileName, &RawObjInfo, MaterialInfos, true))
+		{
+			return false;
+		}
+		FObjImporter::ConvertToStaticMesh(RawObjInfo, MaterialInfos, &Mesh);
+		ReportStaticMesh(PathFileName, Mesh);
+		return true;
+	}
+
+	if (Extension == ".fbx")
+	{
+		FFbxImportOptions Options;
+		FFbxImporter TypeDetector;
+		if (TypeDetector.DetectFbxType(PathFileName) == EFbxImportType::SkeletalMesh)
+		{
+			FFbxImporter Importer;
+			FSkeletalMesh Mesh;
+			if (!Importer.ImportSkeletalMesh(PathFileName, Options, Mesh))
+			{
+				return false;
+			}
+			ReportSkeletalMesh(PathFileName, Mesh);
+			if (Mesh.Skeleton)
+			{
+				ObjectFactory::DeleteObject(Mesh.Skeleton);
+				Mesh.Skeleton = nullptr;
+			}
+			return true;
+		}
+
+		FFbxImporter Importer;
+		FStaticMesh Mesh;
+		if (!Importer.ImportStaticMesh(PathFileName, Options, Mesh))
+		{
+			return false;
+		}
+		ReportStaticMesh(PathFileName, Mesh);
+		return true;
+	}
+
+	UE_LOG("[VertexQuantize] Unsupported mesh file: %s", PathFileName.c_str());
+	return false;
+}
@@ -0,0 +1,111 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+struct FNormalVertex;
+struct FSkinnedVertex;
+
+/**
+ * 메시 하나의 정점 양자화 파라미터
+ * - 위치/UV는 바운드 기준 16비트 정수: Value = Min + Q * Step
+ * - Step은 축마다 2의 거듭제곱이고 Min은 Step의 배수라 복원값이 float로 정확히 표현된다
+ *   (복원한 정점을 다시 양자화해도 같은 값이 나오므로 임포트 때 한 번 왕복시킨 메시와 캐시에서 복원한 메시가 비트 단위로 같다)
+ */
+struct FVertexQuantizationParams
+{
+	FVector PositionMin = FVector(0, 0, 0);
+	FVector PositionStep = FVector(1, 1, 1);
+	FVector2D UVMin = FVector2D(0, 0);
+	FVector2D UVStep = FVector2D(1, 1);
+};
+
+/** FNormalVertex 압축 형식 (64 → 24 bytes) */
+struct FQuantizedNormalVertex
+{
+	uint16 Position[3];		// PositionMin + Q * PositionStep
+	int16 TangentSign;		// Tangent.W (-1, 0, 1)
+	int16 Normal[2];		// 8면체 인코딩 snorm16
+	int16 Tangent[2];		// 8면체 인코딩 snorm16 (xyz)
+	uint16 UV[2];			// UVMin + Q * UVStep
+	uint8 Color[4];			// RGBA8 unorm
+};
+
+/** FSkinnedVertex 압축 형식 (80 → 28 bytes). 본 인덱스가 0 ~ 255일 때만 쓸 수 있다 */
+struct FQuantizedSkinnedVertex
+{
+	uint16 Position[3];
+	int16 TangentSign;
+	int16 Normal[2];
+	int16 Tangent[2];
+	uint16 UV[2];
+	uint8 BoneIndices[4];
+	uint8 BoneWeights[4];	// 합이 정확히 255 (영향이 없는 정점은 모두 0)
+};
+
+static_assert(sizeof(FQuantizedNormalVertex) == 24, "FQuantizedNormalVertex layout changed");
+static_assert(sizeof(FQuantizedSkinnedVertex) == 28, "FQuantizedSkinnedVertex layout changed");
+
+/**
+ * 정점 양자화 (디스크 캐시 / CPU 스키닝 스트림)
+ * - 법선/탄젠트: 8면체 인코딩 (Meyer et al. 2010) snorm16 x2, 탄젠트 W는 부호만
+ * - UV: half 대신 UV 바운드 기준 unorm16 (타일링 UV에서도 정밀도가 범위 전체에 고르다)
+ * - 본 가중치: 합이 255가 되도록 최대 잔여 방식으로 반올림한다 (스키닝 결과가 원점 쪽으로 줄어들지 않음)
+ * - GPU 정점 형식과 셰이더는 그대로다. 복원은 CPU에서 (캐시 로드, 피킹 BVH, CPU 스키닝)
+ */
+class FVertexQuantizer
+{
+public:
+	// editor.ini MeshCacheQuantize=1이면 임포트한 메시를 압축 형식으로 캐시한다 (기본 꺼짐)
+	static bool IsCacheQuantizationEnabled();
+	// 임포터 버전에 섞는 값 (설정이 바뀌면 캐시를 다시 만들도록)
+	static uint32 GetCacheKey();
+
+	static FVertexQuantizationParams ComputeParams(const TArray<FNormalVertex>& Vertices);
+	static FVertexQuantizationParams ComputeParams(const TArray<FSkinnedVertex>& Vertices);
+	// 캐시에서 읽은 파라미터 검사 (Step이 양의 2의 거듭제곱이고 Min이 유한한지)
+	static bool IsValidParams(const FVertexQuantizationParams& Params);
+
+	static void Quantize(const TArray<FNormalVertex>& Vertices, const FVertexQuantizationParams& Params, TArray<FQuantizedNormalVertex>& OutVertices);
+	// 본 인덱스가 0 ~ 255 밖이면 false
+	static bool Quantize(const TArray<FSkinnedVertex>& Vertices, const FVertexQuantizationParams& Params, TArray<FQuantizedSkinnedVertex>& OutVertices);
+
+	static void Dequantize(const FQuantizedNormalVertex* Vertices, size_t NumVertices, const FVertexQuantizationParams& Params, TArray<FNormalVertex>& OutVertices);
+	static void Dequantize(const FQuantizedSkinnedVertex* Vertices, size_t NumVertices, const FVertexQuantizationParams& Params, TArray<FSkinnedVertex>& OutVertices);
+
+	// 양자화 후 복원한 값으로 바꾼다 (캐시를 압축 형식으로 저장할 때 지오메트리 해시/BVH보다 먼저)
+	static void RoundTrip(TArray<FNormalVertex>& Vertices);
+	static bool RoundTrip(TArray<FSkinnedVertex>& Vertices);
+
+	static FVector DecodePosition(const uint16 Q[3], const FVertexQuantizationParams& Params)
+	{
+		return FVector(
+			Params.PositionMin.X + static_cast<float>(Q[0]) * Params.PositionStep.X,
+			Params.PositionMin.Y + static_cast<float>(Q[1]) * Params.PositionStep.Y,
+			Params.PositionMin.Z + static_cast<float>(Q[2]) * Params.PositionStep.Z);
+	}
+
+	static FVector2D DecodeUV(const uint16 Q[2], const FVertexQuantizationParams& Params)
+	{
+		return FVector2D(
+			Params.UVMin.X + static_cast<float>(Q[0]) * Params.UVStep.X,
+			Params.UVMin.Y + static_cast<float>(Q[1]) * Params.UVStep.Y);
+	}
+
+	// 8면체 → 단위 벡터 (Q가 0, 0이면 +Z)
+	static FVector DecodeOctahedral(const int16 Q[2])
+	{
+		float X = std::max(static_cast<float>(Q[0]) / 32767.0f, -1.0f);
+		float Y = std::max(static_cast<float>(Q[1]) / 32767.0f, -1.0f);
+		const float Z = 1.0f - std::fabs(X) - std::fabs(Y);
+		// 아래 반구는 접혀 있다: 접힌 양만큼 원래 사분면 쪽으로 되돌린다
+		const float Fold = std::max(-Z, 0.0f);
+		X += X >= 0.0f ? -Fold : Fold;
+		Y += Y >= 0.0f ? -Fold : Fold;
+		return FVector(X, Y, Z).GetNormalized();
+	}
+
+	static void EncodeOctahedral(const FVector& Direction, int16 OutQ[2]);
+
+	// .obj/.fbx 하나를 캐시 없이 임포트해 전체/압축 형식의 크기, 최대 오차, 복원/스키닝 시간을 로그로 출력 (MESH QUANTIZE)
+	static bool ReportFile(const FString& PathFileName);
+};
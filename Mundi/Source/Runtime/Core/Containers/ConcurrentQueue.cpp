@@ -0,0 +1,218 @@
+﻿#include "pch.h"
+#include "ConcurrentQueue.h"
+#include <thread>
+#include <mutex>
+
+namespace
+{
+    // 값 = (생산자 번호 + 1) << 32 | 순번. 0은 소비자 종료 신호
+    constexpr uint64 StopValue = 0;
+
+    struct FQueueBenchResult
+    {
+        double MS = 0.0;
+        bool bValid = true;
+    };
+
+    /**
+     * 생산자 NumProducers개가 ItemsPerProducer개씩 넣고 소비자 NumConsumers개가 꺼낸다
+     * - 생산자가 모두 끝나면 소비자 수만큼 종료 신호를 넣는다 (공유 카운터 없이 종료)
+     * - 소비자별로 생산자마다 순번이 증가하는지, 전체 개수/합계가 맞는지 검사
+     */
+    template<typename PushFunc, typename PopFunc>
+    FQueueBenchResult RunQueueCase(int32 NumProducers, int32 NumConsumers, int32 ItemsPerProducer, PushFunc&& Push, PopFunc&& Pop)
+    {
+        struct alignas(64) FConsumerResult
+        {
+            uint64 Count = 0;
+            uint64 Sum = 0;
+            bool bOrdered = true;
+        };
+
+        TArray<FConsumerResult> ConsumerResults;
+        ConsumerResults.SetNum(NumConsumers);
+        std::atomic<bool> bStart{ false };
+
+        TArray<std::thread> Consumers;
+        for (int32 c = 0; c < NumConsumers; ++c)
+        {
+            Consumers.Emplace([&, c]()
+            {
+                TArray<int64> LastSequence;
+                LastSequence.SetNum(NumProducers, -1);
+                FConsumerResult Result;
+                while (!bStart.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                uint64 Value = 0;
+                for (;;)
+                {
+                    if (!Pop(Value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    if (Value == StopValue)
+                    {
+                        break;
+                    }
+
+                    const int32 Producer = static_cast<int32>(Value >> 32) - 1;
+                    const int64 Sequence = static_cast<int64>(Value & 0xFFFFFFFFull);
+                    if (Producer < 0 || Producer >= NumProducers || Sequence <= LastSequence[Producer])
+                    {
+                        Result.bOrdered = false;
+                    }
+                    else
+                    {
+                        LastSequence[Producer] = Sequence;
+                    }
+                    ++Result.Count;
+                    Result.Sum += Value;
+                }
+                ConsumerResults[c] = Result;
+            });
+        }
+
+        TArray<std::thread> Producers;
+        for (int32 p = 0; p < NumProducers; ++p)
+        {
+            Producers.Emplace([&, p]()
+            {
+                while (!bStart.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                const uint64 Base = static_cast<uint64>(p + 1) << 32;
+                for (int32 i = 0; i < ItemsPerProducer; ++i)
+                {
+                    while (!Push(Base | static_cast<uint64>(i)))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        const uint64 Start = FPlatformTime::Cycles64();
+        bStart.store(true, std::memory_order_release);
+        for (std::thread& Thread : Producers)
+        {
+            Thread.join();
+        }
+        for (int32 c = 0; c < NumConsumers; ++c)
+        {
+            while (!Push(StopValue))
+            {
+                std::this_thread::yield();
+            }
+        }
+        for (std::thread& Thread : Consumers)
+        {
+            Thread.join();
+        }
+
+        FQueueBenchResult Result;
+        Result.MS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+        uint64 ExpectedSum = 0;
+        for (int32 p = 0; p < NumProducers; ++p)
+        {
+            const uint64 Base = static_cast<uint64>(p + 1) << 32;
+            ExpectedSum += Base * ItemsPerProducer + static_cast<uint64>(ItemsPerProducer) * (ItemsPerProducer - 1) / 2;
+        }
+
+        uint64 Count = 0;
+        uint64 Sum = 0;
+        for (const FConsumerResult& Consumer : ConsumerResults)
+        {
+            Count += Consumer.Count;
+            Sum += Consumer.Sum;
+            Result.bValid &= Consumer.bOrdered;
+        }
+        Result.bValid &= Count == static_cast<uint64>(NumProducers) * ItemsPerProducer && Sum == ExpectedSum;
+        return Result;
+    }
+
+    // 비교 기준: 뮤텍스로 감싼 기존 FIFO
+    struct FLockedQueue
+    {
+        std::mutex Mutex;
+        TQueue<uint64> Queue;
+
+        bool Push(uint64 Value)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Queue.Enqueue(Value);
+            return true;
+        }
+
+        bool Pop(uint64& OutValue)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            return Queue.Dequeue(OutValue);
+        }
+    };
+
+    void LogQueueCase(const char* Name, int32 NumProducers, int32 NumConsumers, int32 ItemsPerProducer,
+        const FQueueBenchResult& LockFree, const FQueueBenchResult& Locked)
+    {
+        const double Items = static_cast<double>(NumProducers) * ItemsPerProducer;
+        auto MItemsPerSecond = [Items](double MS) { return MS > 0.0 ? Items / (MS * 1000.0) : 0.0; };
+        UE_LOG("[Queue] %s %dP/%dC: %.2f M items/s, mutex %.2f M items/s (%.1fx)%s", Name, NumProducers, NumConsumers,
+            MItemsPerSecond(LockFree.MS), MItemsPerSecond(Locked.MS), LockFree.MS > 0.0 ? Locked.MS / LockFree.MS : 0.0,
+            (LockFree.bValid && Locked.bValid) ? "" : " - VALIDATION FAILED");
+    }
+}
+
+namespace ConcurrentQueue
+{
+    void RunBenchmark(int32 ItemsPerProducer, int32 MaxThreads)
+    {
+        if (ItemsPerProducer <= 0 || MaxThreads < 2)
+        {
+            UE_LOG("[Queue] Benchmark: invalid arguments");
+            return;
+        }
+
+        constexpr uint32 RingCapacity = 4096;
+        UE_LOG("[Queue] Benchmark: %d items per producer, ring capacity %u", ItemsPerProducer, RingCapacity);
+
+        {
+            TQueue<uint64, EQueueMode::Spsc> Queue(RingCapacity);
+            FLockedQueue Locked;
+            const FQueueBenchResult LockFree = RunQueueCase(1, 1, ItemsPerProducer,
+                [&](uint64 Value) { return Queue.Enqueue(Value); }, [&](uint64& Value) { return Queue.Dequeue(Value); });
+            const FQueueBenchResult Baseline = RunQueueCase(1, 1, ItemsPerProducer,
+                [&](uint64 Value) { return Locked.Push(Value); }, [&](uint64& Value) { return Locked.Pop(Value); });
+            LogQueueCase("SPSC", 1, 1, ItemsPerProducer, LockFree, Baseline);
+        }
+
+        for (int32 NumThreads = 2; NumThreads <= MaxThreads; NumThreads *= 2)
+        {
+            TQueue<uint64, EQueueMode::Mpsc> Queue;
+            FLockedQueue Locked;
+            const int32 NumProducers = NumThreads - 1;
+            const FQueueBenchResult LockFree = RunQueueCase(NumProducers, 1, ItemsPerProducer,
+                [&](uint64 Value) { return Queue.Enqueue(Value); }, [&](uint64& Value) { return Queue.Dequeue(Value); });
+            const FQueueBenchResult Baseline = RunQueueCase(NumProducers, 1, ItemsPerProducer,
+                [&](uint64 Value) { return Locked.Push(Value); }, [&](uint64& Value) { return Locked.Pop(Value); });
+            LogQueueCase("MPSC", NumProducers, 1, ItemsPerProducer, LockFree, Baseline);
+        }
+
+        for (int32 NumThreads = 2; NumThreads <= MaxThreads; NumThreads *= 2)
+        {
+            TQueue<uint64, EQueueMode::Mpmc> Queue(RingCapacity);
+            FLockedQueue Locked;
+            const int32 NumSide = NumThreads / 2;
+            const FQueueBenchResult LockFree = RunQueueCase(NumSide, NumSide, ItemsPerProducer,
+                [&](uint64 Value) { return Queue.Enqueue(Value); }, [&](uint64& Value) { return Queue.Dequeue(Value); });
+            const FQueueBenchResult Baseline = RunQueueCase(NumSide, NumSide, ItemsPerProducer,
+                [&](uint64 Value) { return Locked.Push(Value); }, [&](uint64& Value) { return Locked.Pop(Value); });
+            LogQueueCase("MPMC", NumSide, NumSide, ItemsPerProducer, LockFree, Baseline);
+        }
+    }
+}
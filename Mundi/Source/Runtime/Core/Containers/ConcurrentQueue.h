@@ -0,0 +1,492 @@
+﻿#pragma once
+#include <atomic>
+#include <new>
+#include <utility>
+
+// UEContainer.h의 TQueue 기본 템플릿 바로 뒤에서 포함된다 (EQueueMode별 동시성 큐 특수화)
+// - Mpmc / Spmc: 고정 크기 Vyukov 링 (가득 차면 Enqueue가 false)
+// - Mpsc: 크기 제한 없는 Vyukov 침입형 연결 큐 (생산자는 exchange 한 번)
+// - Spsc: 고정 크기 링 (각자 상대 인덱스를 캐시해 두고 비거나 찼을 때만 다시 읽음)
+// Num/IsEmpty는 다른 스레드가 동시에 쓰는 중이면 근삿값. Peek/Empty는 소비자 스레드에서만 호출
+
+namespace ConcurrentQueueDetail
+{
+    // 생산자/소비자 인덱스가 같은 캐시 라인을 공유하지 않도록
+    constexpr SIZE_T CacheLineSize = 64;
+    constexpr uint32 DefaultCapacity = 1024;
+
+    inline SIZE_T RoundUpToPowerOfTwo(SIZE_T Value)
+    {
+        SIZE_T Result = 2;
+        while (Result < Value)
+        {
+            Result <<= 1;
+        }
+        return Result;
+    }
+
+    // 생성자 없이 T 하나를 담는 슬롯
+    template<typename T>
+    struct TSlotStorage
+    {
+        alignas(T) unsigned char Bytes[sizeof(T)];
+
+        T* Get() { return std::launder(reinterpret_cast<T*>(Bytes)); }
+        const T* Get() const { return std::launder(reinterpret_cast<const T*>(Bytes)); }
+    };
+}
+
+/** 침입형 MPSC 큐의 링크. 큐에 넣을 구조체가 상속한다 */
+struct FMpscQueueNode
+{
+    std::atomic<FMpscQueueNode*> QueueNext{ nullptr };
+};
+
+/**
+ * 침입형 MPSC 큐 (Vyukov). 노드 메모리는 호출자가 관리하고 큐는 할당하지 않는다
+ * - Push: 아무 스레드에서나, Pop/Peek: 소비자 스레드 하나에서만
+ * - 생산자가 Head를 바꾼 직후 링크를 잇기 전이면 소비자는 잠깐 비어 있는 것으로 본다
+ */
+template<typename NodeType>
+class TIntrusiveMpscQueue
+{
+public:
+    TIntrusiveMpscQueue() : Head(&Stub), Tail(&Stub) {}
+
+    TIntrusiveMpscQueue(const TIntrusiveMpscQueue&) = delete;
+    TIntrusiveMpscQueue& operator=(const TIntrusiveMpscQueue&) = delete;
+
+    void Push(NodeType* Node)
+    {
+        PushLink(static_cast<FMpscQueueNode*>(Node));
+    }
+
+    NodeType* Pop()
+    {
+        FMpscQueueNode* First = SkipStub();
+        if (!First)
+        {
+            return nullptr;
+        }
+
+        FMpscQueueNode* Next = First->QueueNext.load(std::memory_order_acquire);
+        if (Next)
+        {
+            Tail = Next;
+            return static_cast<NodeType*>(First);
+        }
+
+        // First가 마지막 노드. 생산자가 뒤에 붙이는 중이면 연결이 끝날 때까지 꺼내지 않는다
+        if (First != Head.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        // 스텁을 뒤에 붙여 First를 떼어낼 수 있게 만든다
+        PushLink(&Stub);
+        Next = First->QueueNext.load(std::memory_order_acquire);
+        if (Next)
+        {
+            Tail = Next;
+            return static_cast<NodeType*>(First);
+        }
+        return nullptr;
+    }
+
+    NodeType* Peek()
+    {
+        return static_cast<NodeType*>(SkipStub());
+    }
+
+private:
+    void PushLink(FMpscQueueNode* Node)
+    {
+        Node->QueueNext.store(nullptr, std::memory_order_relaxed);
+        FMpscQueueNode* Prev = Head.exchange(Node, std::memory_order_acq_rel);
+        Prev->QueueNext.store(Node, std::memory_order_release);
+    }
+
+    // 맨 앞이 스텁이면 건너뛴 첫 실제 노드 (없으면 nullptr)
+    FMpscQueueNode* SkipStub()
+    {
+        FMpscQueueNode* First = Tail;
+        if (First == &Stub)
+        {
+            FMpscQueueNode* Next = First->QueueNext.load(std::memory_order_acquire);
+            if (!Next)
+            {
+                return nullptr;
+            }
+            Tail = Next;
+            First = Next;
+        }
+        return First;
+    }
+
+private:
+    alignas(ConcurrentQueueDetail::CacheLineSize) std::atomic<FMpscQueueNode*> Head;
+    alignas(ConcurrentQueueDetail::CacheLineSize) FMpscQueueNode* Tail;
+    FMpscQueueNode Stub;
+};
+
+/** MPMC - 고정 크기 Vyukov 링. 슬롯마다 시퀀스 번호로 생산/소비 차례를 판단한다 */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Mpmc, Compare>
+{
+public:
+    explicit TQueue(uint32 InCapacity = ConcurrentQueueDetail::DefaultCapacity)
+    {
+        const SIZE_T Capacity = ConcurrentQueueDetail::RoundUpToPowerOfTwo(InCapacity);
+        Mask = Capacity - 1;
+        Cells = new FCell[Capacity];
+        for (SIZE_T i = 0; i < Capacity; ++i)
+        {
+            Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~TQueue()
+    {
+        Empty();
+        delete[] Cells;
+    }
+
+    TQueue(const TQueue&) = delete;
+    TQueue& operator=(const TQueue&) = delete;
+
+    /** 가득 차 있으면 false */
+    bool Enqueue(const T& Item) { return Emplace(Item); }
+    bool Enqueue(T&& Item) { return Emplace(std::move(Item)); }
+
+    template<typename... Args>
+    bool Emplace(Args&&... args)
+    {
+        FCell* Cell = nullptr;
+        SIZE_T Pos = EnqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell = &Cells[Pos & Mask];
+            const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const intptr_t Diff = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Pos);
+            if (Diff == 0)
+            {
+                if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                Pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (Cell->Storage.Bytes) T(std::forward<Args>(args)...);
+        Cell->Sequence.store(Pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Dequeue(T& OutItem)
+    {
+        return DequeueInternal(&OutItem);
+    }
+
+    int32 Num() const
+    {
+        // 소비 위치를 먼저 읽어야 차이가 음수가 되지 않는다
+        const SIZE_T Dequeued = DequeuePos.load(std::memory_order_acquire);
+        const SIZE_T Enqueued = EnqueuePos.load(std::memory_order_acquire);
+        const SIZE_T Count = Enqueued - Dequeued;
+        return static_cast<int32>(Count < GetCapacity() ? Count : GetCapacity());
+    }
+
+    bool IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    SIZE_T GetCapacity() const
+    {
+        return Mask + 1;
+    }
+
+    void Empty()
+    {
+        while (DequeueInternal(nullptr))
+        {
+        }
+    }
+
+private:
+    struct FCell
+    {
+        std::atomic<SIZE_T> Sequence;
+        ConcurrentQueueDetail::TSlotStorage<T> Storage;
+    };
+
+    // OutItem이 nullptr이면 꺼낸 값을 버린다
+    bool DequeueInternal(T* OutItem)
+    {
+        FCell* Cell = nullptr;
+        SIZE_T Pos = DequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell = &Cells[Pos & Mask];
+            const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const intptr_t Diff = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Pos + 1);
+            if (Diff == 0)
+            {
+                if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                Pos = DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* Item = Cell->Storage.Get();
+        if (OutItem)
+        {
+            *OutItem = std::move(*Item);
+        }
+        Item->~T();
+        Cell->Sequence.store(Pos + Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    FCell* Cells = nullptr;
+    SIZE_T Mask = 0;
+    alignas(ConcurrentQueueDetail::CacheLineSize) std::atomic<SIZE_T> EnqueuePos{ 0 };
+    alignas(ConcurrentQueueDetail::CacheLineSize) std::atomic<SIZE_T> DequeuePos{ 0 };
+};
+
+/** SPMC - 생산자가 하나여도 소비자끼리 경쟁하므로 MPMC 링을 그대로 사용 */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Spmc, Compare> : public TQueue<T, EQueueMode::Mpmc, Compare>
+{
+public:
+    using TQueue<T, EQueueMode::Mpmc, Compare>::TQueue;
+};
+
+/** MPSC - 크기 제한 없는 침입형 큐 위에 값 노드를 얹은 것 (노드는 Enqueue마다 할당) */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Mpsc, Compare>
+{
+public:
+    TQueue() = default;
+
+    ~TQueue()
+    {
+        Empty();
+    }
+
+    TQueue(const TQueue&) = delete;
+    TQueue& operator=(const TQueue&) = delete;
+
+    /** 크기 제한이 없으므로 항상 true */
+    bool Enqueue(const T& Item) { return Emplace(Item); }
+    bool Enqueue(T&& Item) { return Emplace(std::move(Item)); }
+
+    template<typename... Args>
+    bool Emplace(Args&&... args)
+    {
+        Count.fetch_add(1, std::memory_order_relaxed);
+        Queue.Push(new FNode(std::forward<Args>(args)...));
+        return true;
+    }
+
+    bool Dequeue(T& OutItem)
+    {
+        FNode* Node = Queue.Pop();
+        if (!Node)
+        {
+            return false;
+        }
+        OutItem = std::move(Node->Value);
+        delete Node;
+        Count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool Peek(T& OutItem) const
+    {
+        FNode* Node = Queue.Peek();
+        if (!Node)
+        {
+            return false;
+        }
+        OutItem = Node->Value;
+        return true;
+    }
+
+    int32 Num() const
+    {
+        const int32 Result = Count.load(std::memory_order_relaxed);
+        return Result > 0 ? Result : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    void Empty()
+    {
+        while (FNode* Node = Queue.Pop())
+        {
+            delete Node;
+            Count.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct FNode : FMpscQueueNode
+    {
+        template<typename... Args>
+        explicit FNode(Args&&... args) : Value(std::forward<Args>(args)...) {}
+
+        T Value;
+    };
+
+    // Peek는 논리적으로 읽기지만 앞쪽 스텁을 건너뛰며 Tail을 옮길 수 있다
+    mutable TIntrusiveMpscQueue<FNode> Queue;
+    std::atomic<int32> Count{ 0 };
+};
+
+/** SPSC - 고정 크기 링. 생산자는 Tail만, 소비자는 Head만 쓴다 */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Spsc, Compare>
+{
+public:
+    explicit TQueue(uint32 InCapacity = ConcurrentQueueDetail::DefaultCapacity)
+    {
+        const SIZE_T Capacity = ConcurrentQueueDetail::RoundUpToPowerOfTwo(InCapacity);
+        Mask = Capacity - 1;
+        Slots = new ConcurrentQueueDetail::TSlotStorage<T>[Capacity];
+    }
+
+    ~TQueue()
+    {
+        Empty();
+        delete[] Slots;
+    }
+
+    TQueue(const TQueue&) = delete;
+    TQueue& operator=(const TQueue&) = delete;
+
+    /** 가득 차 있으면 false */
+    bool Enqueue(const T& Item) { return Emplace(Item); }
+    bool Enqueue(T&& Item) { return Emplace(std::move(Item)); }
+
+    template<typename... Args>
+    bool Emplace(Args&&... args)
+    {
+        const SIZE_T CurrentTail = Tail.load(std::memory_order_relaxed);
+        if (CurrentTail - CachedHead > Mask)
+        {
+            CachedHead = Head.load(std::memory_order_acquire);
+            if (CurrentTail - CachedHead > Mask)
+            {
+                return false;
+            }
+        }
+
+        new (Slots[CurrentTail & Mask].Bytes) T(std::forward<Args>(args)...);
+        Tail.store(CurrentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Dequeue(T& OutItem)
+    {
+        const SIZE_T CurrentHead = Head.load(std::memory_order_relaxed);
+        if (!HasItem(CurrentHead))
+        {
+            return false;
+        }
+
+        T* Item = Slots[CurrentHead & Mask].Get();
+        OutItem = std::move(*Item);
+        Item->~T();
+        Head.store(CurrentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Peek(T& OutItem) const
+    {
+        const SIZE_T CurrentHead = Head.load(std::memory_order_relaxed);
+        if (!HasItem(CurrentHead))
+        {
+            return false;
+        }
+        OutItem = *Slots[CurrentHead & Mask].Get();
+        return true;
+    }
+
+    int32 Num() const
+    {
+        const SIZE_T CurrentHead = Head.load(std::memory_order_acquire);
+        const SIZE_T CurrentTail = Tail.load(std::memory_order_acquire);
+        return static_cast<int32>(CurrentTail - CurrentHead);
+    }
+
+    bool IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    SIZE_T GetCapacity() const
+    {
+        return Mask + 1;
+    }
+
+    void Empty()
+    {
+        SIZE_T CurrentHead = Head.load(std::memory_order_relaxed);
+        while (HasItem(CurrentHead))
+        {
+            Slots[CurrentHead & Mask].Get()->~T();
+            ++CurrentHead;
+            Head.store(CurrentHead, std::memory_order_release);
+        }
+    }
+
+private:
+    // 소비자 전용
+    bool HasItem(SIZE_T CurrentHead) const
+    {
+        if (CurrentHead == CachedTail)
+        {
+            CachedTail = Tail.load(std::memory_order_acquire);
+        }
+        return CurrentHead != CachedTail;
+    }
+
+private:
+    ConcurrentQueueDetail::TSlotStorage<T>* Slots = nullptr;
+    SIZE_T Mask = 0;
+
+    // 소비자 쪽
+    alignas(ConcurrentQueueDetail::CacheLineSize) std::atomic<SIZE_T> Head{ 0 };
+    mutable SIZE_T CachedTail = 0;
+
+    // 생산자 쪽
+    alignas(ConcurrentQueueDetail::CacheLineSize) std::atomic<SIZE_T> Tail{ 0 };
+    SIZE_T CachedHead = 0;
+};
+
+namespace ConcurrentQueue
+{
+    // Mpmc/Mpsc/Spsc 큐와 뮤텍스 + std::queue의 처리량 비교 및 순서/합계 검증 (콘솔 QUEUE BENCH)
+    void RunBenchmark(int32 ItemsPerProducer, int32 MaxThreads);
+}
@@ -0,0 +1,207 @@
+﻿#include "pch.h"
+#include "FlatMap.h"
+#include "Hash.h"
+#include <random>
+
+namespace
+{
+    struct FHashBenchResult
+    {
+        double InsertMS = 0.0;
+        double HitMS = 0.0;
+        double MissMS = 0.0;
+        double IterateMS = 0.0;
+        double RemoveMS = 0.0;
+        uint64 Checksum = 0;                // 최적화로 루프가 사라지지 않도록 + 두 구현 결과 비교
+    };
+
+    double ElapsedMS(uint64 StartCycles)
+    {
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    /**
+     * Keys를 모두 넣고 -> 전부 찾고 -> 없는 키(Misses)를 찾고 -> 순회하고 -> 절반 제거
+     * 값은 키 순번이므로 두 구현의 Checksum이 같아야 한다
+     */
+    template<typename MapType, typename KeyType>
+    FHashBenchResult RunMapCase(const TArray<KeyType>& Keys, const TArray<KeyType>& Misses)
+    {
+        FHashBenchResult Result;
+        MapType Map;
+
+        uint64 Start = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Keys.Num(); ++i)
+        {
+            Map.Add(Keys[i], i);
+        }
+        Result.InsertMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (const KeyType& Key : Keys)
+        {
+            if (const int32* Value = Map.Find(Key))
+            {
+                Result.Checksum += static_cast<uint64>(*Value);
+            }
+        }
+        Result.HitMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (const KeyType& Key : Misses)
+        {
+            Result.Checksum += Map.Contains(Key) ? 1 : 0;
+        }
+        Result.MissMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (const auto& Pair : Map)
+        {
+            Result.Checksum += static_cast<uint64>(Pair.second) * 3;
+        }
+        Result.IterateMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Keys.Num(); i += 2)
+        {
+            Map.Remove(Keys[i]);
+        }
+        Result.RemoveMS = ElapsedMS(Start);
+
+        Result.Checksum += static_cast<uint64>(Map.Num());
+        return Result;
+    }
+
+    template<typename SetType, typename KeyType>
+    FHashBenchResult RunSetCase(const TArray<KeyType>& Keys, const TArray<KeyType>& Misses)
+    {
+        FHashBenchResult Result;
+        SetType Set;
+
+        uint64 Start = FPlatformTime::Cycles64();
+        for (const KeyType& Key : Keys)
+        {
+            Set.Add(Key);
+        }
+        Result.InsertMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (const KeyType& Key : Keys)
+        {
+            Result.Checksum += Set.Contains(Key) ? 1 : 0;
+        }
+        Result.HitMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (const KeyType& Key : Misses)
+        {
+            Result.Checksum += Set.Contains(Key) ? 1 : 0;
+        }
+        Result.MissMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (const KeyType& Key : Set)
+        {
+            Result.Checksum += reinterpret_cast<uintptr_t>(Key) & 0xFF;
+        }
+        Result.IterateMS = ElapsedMS(Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Keys.Num(); i += 2)
+        {
+            Set.Remove(Keys[i]);
+        }
+        Result.RemoveMS = ElapsedMS(Start);
+
+        Result.Checksum += static_cast<uint64>(Set.Num());
+        return Result;
+    }
+
+    void LogHashCase(const char* Label, const FHashBenchResult& Node, const FHashBenchResult& Flat)
+    {
+        const double NodeTotal = Node.InsertMS + Node.HitMS + Node.MissMS + Node.IterateMS + Node.RemoveMS;
+        const double FlatTotal = Flat.InsertMS + Flat.HitMS + Flat.MissMS + Flat.IterateMS + Flat.RemoveMS;
+        UE_LOG("[Hash] %-10s insert %.2f/%.2f  hit %.2f/%.2f  miss %.2f/%.2f  iterate %.2f/%.2f  remove %.2f/%.2f ms (x%.2f)%s",
+            Label,
+            Node.InsertMS, Flat.InsertMS, Node.HitMS, Flat.HitMS, Node.MissMS, Flat.MissMS,
+            Node.IterateMS, Flat.IterateMS, Node.RemoveMS, Flat.RemoveMS,
+            FlatTotal > 0.0 ? NodeTotal / FlatTotal : 0.0,
+            Node.Checksum == Flat.Checksum ? "" : "  MISMATCH");
+    }
+}
+
+namespace FlatHash
+{
+    void RunBenchmark(int32 NumKeys)
+    {
+        if (NumKeys <= 0)
+        {
+            UE_LOG("[Hash] Benchmark: invalid arguments");
+            return;
+        }
+
+        UE_LOG("[Hash] Benchmark: %d keys (TMap/TSet ms / TFlatMap/TFlatSet ms)", NumKeys);
+
+        // 객체 포인터 키 (실제 객체처럼 일정 간격으로 떨어진 주소)
+        {
+            TArray<uint8> Storage;
+            Storage.SetNum(static_cast<SIZE_T>(NumKeys) * 2 * 64);
+            TArray<void*> Keys, Misses;
+            Keys.Reserve(NumKeys);
+            Misses.Reserve(NumKeys);
+            for (int32 i = 0; i < NumKeys; ++i)
+            {
+                Keys.Add(&Storage[static_cast<SIZE_T>(i) * 2 * 64]);
+                Misses.Add(&Storage[static_cast<SIZE_T>(i) * 2 * 64 + 64]);
+            }
+            // 삽입 순서와 조회 순서가 같으면 노드 기반 맵이 캐시 덕을 보므로 섞는다
+            std::shuffle(Keys.begin(), Keys.end(), std::mt19937(1234));
+
+            LogHashCase("Pointer", RunMapCase<TMap<void*, int32>>(Keys, Misses), RunMapCase<TFlatMap<void*, int32>>(Keys, Misses));
+            LogHashCase("PtrSet", RunSetCase<TSet<void*>>(Keys, Misses), RunSetCase<TFlatSet<void*>>(Keys, Misses));
+        }
+
+        // FName 키
+        {
+            TArray<FName> Keys, Misses;
+            Keys.Reserve(NumKeys);
+            Misses.Reserve(NumKeys);
+            for (int32 i = 0; i < NumKeys; ++i)
+            {
+                Keys.Add(FName("HashBench_" + std::to_string(i)));
+                Misses.Add(FName("HashBenchMiss_" + std::to_string(i)));
+            }
+
+            LogHashCase("FName", RunMapCase<TMap<FName, int32>>(Keys, Misses), RunMapCase<TFlatMap<FName, int32>>(Keys, Misses));
+        }
+
+        // 리소스 경로 키 (ResourceManager)
+        {
+            TArray<FString> Keys, Misses;
+            Keys.Reserve(NumKeys);
+            Misses.Reserve(NumKeys);
+            for (int32 i = 0; i < NumKeys; ++i)
+            {
+                Keys.Add("Data/Model/Bench/Mesh_" + std::to_string(i) + ".obj");
+                Misses.Add("Data/Textures/Bench/Texture_" + std::to_string(i) + ".dds");
+            }
+
+            LogHashCase("FString", RunMapCase<TMap<FString, int32>>(Keys, Misses), RunMapCase<TFlatMap<FString, int32>>(Keys, Misses));
+        }
+
+        // 정수 키
+        {
+            TArray<int32> Keys, Misses;
+            Keys.Reserve(NumKeys);
+            Misses.Reserve(NumKeys);
+            for (int32 i = 0; i < NumKeys; ++i)
+            {
+                Keys.Add(i * 2);
+                Misses.Add(i * 2 + 1);
+            }
+            std::shuffle(Keys.begin(), Keys.end(), std::mt19937(1234));
+
+            LogHashCase("int32", RunMapCase<TMap<int32, int32>>(Keys, Misses), RunMapCase<TFlatMap<int32, int32>>(Keys, Misses));
+        }
+    }
+}
@@ -0,0 +1,623 @@
+﻿#pragma once
+#include <emmintrin.h>
+#include <bit>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * 오픈 어드레싱 해시 테이블 (SwissTable 방식)
+ * - 슬롯마다 제어 바이트 1개(빈 칸 / 삭제 / 해시 하위 7비트)를 두고 16칸 그룹을 SSE2로 한 번에 비교
+ * - 원소는 노드 없이 배열에 직접 저장 -> 삽입 시 할당 없음, 조회 시 포인터 추적 없음
+ * - 삭제는 원소를 옮기지 않으므로 순회 중 Remove는 안전하다. 삽입은 재해시가 일어나면
+ *   모든 참조/포인터/반복자를 무효화하므로 원소 주소를 오래 들고 있어야 하면 TMap/TSet을 쓴다
+ * - 해시: 키에 GetTypeHash 오버로드가 있으면 사용 (FName 등), 없으면 포인터 값 / std::hash
+ */
+namespace FlatHashDetail
+{
+    constexpr int32 GroupWidth = 16;
+    constexpr uint8 CtrlEmpty = 0x80;
+    constexpr uint8 CtrlDeleted = 0xFE;       // 채워진 칸은 0x00 ~ 0x7F
+
+    // 아직 할당 전인 테이블이 가리키는 빈 그룹 (탐색 코드에서 빈 테이블 분기를 없앤다)
+    alignas(16) inline constexpr uint8 EmptyGroup[GroupWidth] =
+    {
+        CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty,
+        CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty
+    };
+
+    // 하위 비트가 고르지 않은 해시(포인터, FName 인덱스)도 그룹/제어 바이트에 고루 퍼지도록
+    inline uint64 MixHash(uint64 Raw)
+    {
+        const uint64 Hash = Raw * 0x9E3779B97F4A7C15ull;
+        return Hash ^ (Hash >> 32);
+    }
+
+    struct FGroup
+    {
+        __m128i Ctrl;
+
+        explicit FGroup(const uint8* Pos) : Ctrl(_mm_load_si128(reinterpret_cast<const __m128i*>(Pos))) {}
+
+        uint32 Match(uint8 H2) const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Ctrl, _mm_set1_epi8(static_cast<char>(H2)))));
+        }
+
+        uint32 MatchEmpty() const
+        {
+            return Match(CtrlEmpty);
+        }
+
+        // 빈 칸 + 삭제된 칸 (최상위 비트가 1)
+        uint32 MatchEmptyOrDeleted() const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(Ctrl));
+        }
+    };
+}
+
+/** TFlatMap/TFlatSet 기본 해시 */
+template<typename KeyType>
+struct TFlatHash
+{
+    uint64 operator()(const KeyType& Key) const
+    {
+        if constexpr (requires { GetTypeHash(Key); })
+        {
+            return static_cast<uint64>(GetTypeHash(Key));
+        }
+        else if constexpr (std::is_pointer_v<KeyType>)
+        {
+            return static_cast<uint64>(reinterpret_cast<uintptr_t>(Key));
+        }
+        else
+        {
+            return static_cast<uint64>(std::hash<KeyType>()(Key));
+        }
+    }
+};
+
+template<typename ElementType, typename KeyType, typename KeyFuncs, typename HasherType>
+class TFlatHashTable
+{
+public:
+    template<bool bConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = std::ptrdiff_t;
+        using TableType = std::conditional_t<bConst, const TFlatHashTable, TFlatHashTable>;
+        using reference = std::conditional_t<bConst || KeyFuncs::bConstElements, const ElementType&, ElementType&>;
+        using pointer = std::conditional_t<bConst || KeyFuncs::bConstElements, const ElementType*, ElementType*>;
+
+        TIterator() = default;
+        TIterator(TableType* InTable, int32 InIndex) : Table(InTable), Index(InIndex) {}
+        // 비-const -> const 변환
+        template<bool bOtherConst, typename = std::enable_if_t<bConst && !bOtherConst>>
+        TIterator(const TIterator<bOtherConst>& Other) : Table(Other.Table), Index(Other.Index) {}
+
+        reference operator*() const { return Table->Slots[Index]; }
+        pointer operator->() const { return &Table->Slots[Index]; }
+
+        TIterator& operator++()
+        {
+            Index = Table->NextFull(Index + 1);
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator Result = *this;
+            ++(*this);
+            return Result;
+        }
+
+        bool operator==(const TIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+        int32 GetIndex() const { return Index; }
+
+    private:
+        template<bool> friend class TIterator;
+        friend class TFlatHashTable;
+
+        TableType* Table = nullptr;
+        int32 Index = 0;
+    };
+
+    using iterator = TIterator<false>;
+    using const_iterator = TIterator<true>;
+
+    TFlatHashTable() = default;
+
+    TFlatHashTable(const TFlatHashTable& Other)
+    {
+        Reserve(Other.Size);
+        for (const ElementType& Element : Other)
+        {
+            const int32 Index = PrepareInsert(HashKey(KeyFuncs::GetKey(Element)));
+            new (&Slots[Index]) ElementType(Element);
+        }
+    }
+
+    TFlatHashTable(TFlatHashTable&& Other) noexcept
+    {
+        Swap(Other);
+    }
+
+    TFlatHashTable& operator=(const TFlatHashTable& Other)
+    {
+        if (this != &Other)
+        {
+            TFlatHashTable Copy(Other);
+            Swap(Copy);
+        }
+        return *this;
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            TFlatHashTable Moved(std::move(Other));
+            Swap(Moved);
+        }
+        return *this;
+    }
+
+    ~TFlatHashTable()
+    {
+        DestroyAll();
+        Deallocate();
+    }
+
+    iterator begin() { return iterator(this, NextFull(0)); }
+    iterator end() { return iterator(this, Capacity); }
+    const_iterator begin() const { return const_iterator(this, NextFull(0)); }
+    const_iterator end() const { return const_iterator(this, Capacity); }
+
+    iterator find(const KeyType& Key)
+    {
+        const int32 Index = FindIndex(Key);
+        return iterator(this, Index >= 0 ? Index : Capacity);
+    }
+
+    const_iterator find(const KeyType& Key) const
+    {
+        const int32 Index = FindIndex(Key);
+        return const_iterator(this, Index >= 0 ? Index : Capacity);
+    }
+
+    SIZE_T count(const KeyType& Key) const { return FindIndex(Key) >= 0 ? 1 : 0; }
+    SIZE_T size() const { return static_cast<SIZE_T>(Size); }
+    bool empty() const { return Size == 0; }
+    void clear() { Empty(); }
+    void reserve(SIZE_T Count) { Reserve(static_cast<int32>(Count)); }
+    SIZE_T erase(const KeyType& Key) { return Remove(Key) ? 1 : 0; }
+
+    iterator erase(const_iterator It)
+    {
+        EraseAt(It.Index);
+        return iterator(this, NextFull(It.Index + 1));
+    }
+
+    /** 크기 관련 */
+    int32 Num() const { return Size; }
+    bool IsEmpty() const { return Size == 0; }
+    int32 GetCapacity() const { return Capacity; }
+
+    /** 원소를 모두 지우고 용량은 유지 */
+    void Empty()
+    {
+        DestroyAll();
+        if (Capacity > 0)
+        {
+            memset(Ctrl, FlatHashDetail::CtrlEmpty, static_cast<SIZE_T>(Capacity));
+            GrowthLeft = MaxLoad(Capacity);
+        }
+        Size = 0;
+    }
+
+    /** Count개를 재해시 없이 넣을 수 있도록 */
+    void Reserve(int32 Count)
+    {
+        if (Count <= Size + GrowthLeft)
+        {
+            return;
+        }
+
+        int32 NewCapacity = FlatHashDetail::GroupWidth;
+        while (MaxLoad(NewCapacity) < Count)
+        {
+            NewCapacity *= 2;
+        }
+        Resize(NewCapacity);
+    }
+
+    /** 검색 */
+    bool Contains(const KeyType& Key) const
+    {
+        return FindIndex(Key) >= 0;
+    }
+
+    /** 제거 */
+    bool Remove(const KeyType& Key)
+    {
+        const int32 Index = FindIndex(Key);
+        if (Index < 0)
+        {
+            return false;
+        }
+        EraseAt(Index);
+        return true;
+    }
+
+protected:
+    int32 FindIndex(const KeyType& Key) const
+    {
+        return FindIndex(Key, HashKey(Key));
+    }
+
+    int32 FindIndex(const KeyType& Key, uint64 Hash) const
+    {
+        const uint8 H2 = static_cast<uint8>(Hash & 0x7F);
+        const uint32 GroupMask = GetGroupMask();
+        uint32 Group = static_cast<uint32>(Hash >> 7) & GroupMask;
+        for (uint32 Step = 1; ; ++Step)
+        {
+            const FlatHashDetail::FGroup Ctrls(Ctrl + Group * FlatHashDetail::GroupWidth);
+            for (uint32 Match = Ctrls.Match(H2); Match; Match &= Match - 1)
+            {
+                const int32 Index = static_cast<int32>(Group * FlatHashDetail::GroupWidth + std::countr_zero(Match));
+                if (KeyFuncs::GetKey(Slots[Index]) == Key)
+                {
+                    return Index;
+                }
+            }
+            if (Ctrls.MatchEmpty())
+            {
+                return -1;
+            }
+            // 그룹 단위 삼각수 탐색 (그룹 수가 2의 거듭제곱이면 모든 그룹을 한 번씩 방문)
+            Group = (Group + Step) & GroupMask;
+        }
+    }
+
+    // 키가 없다는 것을 확인한 뒤 호출. 제어 바이트를 채우고 원소를 생성할 인덱스를 반환
+    int32 PrepareInsert(uint64 Hash)
+    {
+        int32 Index = FindFirstNonFull(Hash);
+        if (GrowthLeft == 0 && Ctrl[Index] != FlatHashDetail::CtrlDeleted)
+        {
+            // 살아있는 원소가 용량의 절반 가까이면 두 배로, 아니면 삭제 표시만 정리
+            Resize(Size * 2 >= MaxLoad(Capacity) ? std::max(Capacity * 2, FlatHashDetail::GroupWidth) : Capacity);
+            Index = FindFirstNonFull(Hash);
+        }
+
+        if (Ctrl[Index] == FlatHashDetail::CtrlEmpty)
+        {
+            --GrowthLeft;
+        }
+        Ctrl[Index] = static_cast<uint8>(Hash & 0x7F);
+        ++Size;
+        return Index;
+    }
+
+    void EraseAt(int32 Index)
+    {
+        Slots[Index].~ElementType();
+        --Size;
+
+        // 그룹에 빈 칸이 남아 있으면 이 그룹은 한 번도 가득 찬 적이 없으므로 지나쳐 간 탐색도 없다
+        const FlatHashDetail::FGroup Ctrls(Ctrl + (Index & ~(FlatHashDetail::GroupWidth - 1)));
+        if (Ctrls.MatchEmpty())
+        {
+            Ctrl[Index] = FlatHashDetail::CtrlEmpty;
+            ++GrowthLeft;
+        }
+        else
+        {
+            Ctrl[Index] = FlatHashDetail::CtrlDeleted;
+        }
+    }
+
+    static uint64 HashKey(const KeyType& Key)
+    {
+        return FlatHashDetail::MixHash(HasherType()(Key));
+    }
+
+    ElementType* GetSlots() const { return Slots; }
+
+private:
+    static int32 MaxLoad(int32 InCapacity)
+    {
+        return InCapacity - InCapacity / 8;
+    }
+
+    uint32 GetGroupMask() const
+    {
+        return Capacity > 0 ? static_cast<uint32>(Capacity / FlatHashDetail::GroupWidth - 1) : 0;
+    }
+
+    int32 FindFirstNonFull(uint64 Hash) const
+    {
+        const uint32 GroupMask = GetGroupMask();
+        uint32 Group = static_cast<uint32>(Hash >> 7) & GroupMask;
+        for (uint32 Step = 1; ; ++Step)
+        {
+            const FlatHashDetail::FGroup Ctrls(Ctrl + Group * FlatHashDetail::GroupWidth);
+            if (const uint32 Match = Ctrls.MatchEmptyOrDeleted())
+            {
+                return static_cast<int32>(Group * FlatHashDetail::GroupWidth + std::countr_zero(Match));
+            }
+            Group = (Group + Step) & GroupMask;
+        }
+    }
+
+    int32 NextFull(int32 Index) const
+    {
+        while (Index < Capacity && (Ctrl[Index] & 0x80))
+        {
+            ++Index;
+        }
+        return Index;
+    }
+
+    void Resize(int32 NewCapacity)
+    {
+        uint8* OldCtrl = Ctrl;
+        ElementType* OldSlots = Slots;
+        const int32 OldCapacity = Capacity;
+
+        Allocate(NewCapacity);
+        for (int32 i = 0; i < OldCapacity; ++i)
+        {
+            if (!(OldCtrl[i] & 0x80))
+            {
+                const uint64 Hash = HashKey(KeyFuncs::GetKey(OldSlots[i]));
+                const int32 Index = FindFirstNonFull(Hash);
+                Ctrl[Index] = static_cast<uint8>(Hash & 0x7F);
+                new (&Slots[Index]) ElementType(std::move(OldSlots[i]));
+                OldSlots[i].~ElementType();
+            }
+        }
+        GrowthLeft = MaxLoad(Capacity) - Size;
+
+        if (OldCapacity > 0)
+        {
+            ::operator delete(OldCtrl, std::align_val_t(AllocationAlignment));
+        }
+    }
+
+    // [제어 바이트 Capacity개 | 원소 Capacity개] 한 번에 할당
+    static constexpr SIZE_T AllocationAlignment = alignof(ElementType) > 16 ? alignof(ElementType) : 16;
+    static constexpr SIZE_T SlotsOffset(int32 InCapacity)
+    {
+        return (static_cast<SIZE_T>(InCapacity) + alignof(ElementType) - 1) & ~(alignof(ElementType) - 1);
+    }
+
+    void Allocate(int32 NewCapacity)
+    {
+        const SIZE_T Bytes = SlotsOffset(NewCapacity) + sizeof(ElementType) * NewCapacity;
+        uint8* Memory = static_cast<uint8*>(::operator new(Bytes, std::align_val_t(AllocationAlignment)));
+        memset(Memory, FlatHashDetail::CtrlEmpty, static_cast<SIZE_T>(NewCapacity));
+        Ctrl = Memory;
+        Slots = reinterpret_cast<ElementType*>(Memory + SlotsOffset(NewCapacity));
+        Capacity = NewCapacity;
+    }
+
+    void Deallocate()
+    {
+        if (Capacity > 0)
+        {
+            ::operator delete(Ctrl, std::align_val_t(AllocationAlignment));
+        }
+        Ctrl = const_cast<uint8*>(FlatHashDetail::EmptyGroup);
+        Slots = nullptr;
+        Capacity = 0;
+        GrowthLeft = 0;
+    }
+
+    void DestroyAll()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (int32 i = 0; i < Capacity; ++i)
+            {
+                if (!(Ctrl[i] & 0x80))
+                {
+                    Slots[i].~ElementType();
+                }
+            }
+        }
+    }
+
+    void Swap(TFlatHashTable& Other) noexcept
+    {
+        std::swap(Ctrl, Other.Ctrl);
+        std::swap(Slots, Other.Slots);
+        std::swap(Capacity, Other.Capacity);
+        std::swap(Size, Other.Size);
+        std::swap(GrowthLeft, Other.GrowthLeft);
+    }
+
+private:
+    uint8* Ctrl = const_cast<uint8*>(FlatHashDetail::EmptyGroup);
+    ElementType* Slots = nullptr;
+    int32 Capacity = 0;
+    int32 Size = 0;
+    int32 GrowthLeft = 0;                  // 빈 칸을 새로 채울 수 있는 남은 수 (최대 적재율 7/8)
+};
+
+namespace FlatHashDetail
+{
+    template<typename KeyType, typename ValueType>
+    struct TMapKeyFuncs
+    {
+        static constexpr bool bConstElements = false;
+        static const KeyType& GetKey(const std::pair<KeyType, ValueType>& Element) { return Element.first; }
+    };
+
+    template<typename KeyType>
+    struct TSetKeyFuncs
+    {
+        static constexpr bool bConstElements = true;
+        static const KeyType& GetKey(const KeyType& Element) { return Element; }
+    };
+}
+
+/** TFlatMap - 오픈 어드레싱 해시 맵 (TMap과 같은 인터페이스, 원소는 std::pair<Key, Value>) */
+template<typename KeyType, typename ValueType, typename HasherType = TFlatHash<KeyType>>
+class TFlatMap : public TFlatHashTable<std::pair<KeyType, ValueType>, KeyType, FlatHashDetail::TMapKeyFuncs<KeyType, ValueType>, HasherType>
+{
+    using Super = TFlatHashTable<std::pair<KeyType, ValueType>, KeyType, FlatHashDetail::TMapKeyFuncs<KeyType, ValueType>, HasherType>;
+
+public:
+    TFlatMap() = default;
+
+    TFlatMap(std::initializer_list<std::pair<KeyType, ValueType>> Items)
+    {
+        this->Reserve(static_cast<int32>(Items.size()));
+        for (const auto& Item : Items)
+        {
+            Add(Item.first, Item.second);
+        }
+    }
+
+    /** 요소 추가/수정 */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        FindOrAdd(Key) = Value;
+    }
+
+    template<typename... Args>
+    void Emplace(const KeyType& Key, Args&&... args)
+    {
+        const uint64 Hash = Super::HashKey(Key);
+        if (Super::FindIndex(Key, Hash) < 0)
+        {
+            const int32 Index = Super::PrepareInsert(Hash);
+            new (&this->GetSlots()[Index]) std::pair<KeyType, ValueType>(Key, ValueType(std::forward<Args>(args)...));
+        }
+    }
+
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        const uint64 Hash = Super::HashKey(Key);
+        int32 Index = Super::FindIndex(Key, Hash);
+        if (Index < 0)
+        {
+            Index = Super::PrepareInsert(Hash);
+            new (&this->GetSlots()[Index]) std::pair<KeyType, ValueType>(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple());
+        }
+        return this->GetSlots()[Index].second;
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return FindOrAdd(Key);
+    }
+
+    ValueType* Find(const KeyType& Key)
+    {
+        const int32 Index = Super::FindIndex(Key);
+        return Index >= 0 ? &this->GetSlots()[Index].second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const int32 Index = Super::FindIndex(Key);
+        return Index >= 0 ? &this->GetSlots()[Index].second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : ValueType{};
+    }
+
+    /** 키/값 배열 반환 */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->Num());
+        for (const auto& Pair : *this)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->Num());
+        for (const auto& Pair : *this)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
+};
+
+/** TFlatSet - 오픈 어드레싱 해시 집합 (TSet과 같은 인터페이스) */
+template<typename KeyType, typename HasherType = TFlatHash<KeyType>>
+class TFlatSet : public TFlatHashTable<KeyType, KeyType, FlatHashDetail::TSetKeyFuncs<KeyType>, HasherType>
+{
+    using Super = TFlatHashTable<KeyType, KeyType, FlatHashDetail::TSetKeyFuncs<KeyType>, HasherType>;
+
+public:
+    TFlatSet() = default;
+
+    TFlatSet(std::initializer_list<KeyType> Items)
+    {
+        this->Reserve(static_cast<int32>(Items.size()));
+        for (const KeyType& Item : Items)
+        {
+            Add(Item);
+        }
+    }
+
+    /** 요소 추가 (새로 들어갔으면 true) */
+    bool Add(const KeyType& Item)
+    {
+        const uint64 Hash = Super::HashKey(Item);
+        if (Super::FindIndex(Item, Hash) >= 0)
+        {
+            return false;
+        }
+        const int32 Index = Super::PrepareInsert(Hash);
+        new (&this->GetSlots()[Index]) KeyType(Item);
+        return true;
+    }
+
+    // std::unordered_set 호환
+    std::pair<typename Super::iterator, bool> insert(const KeyType& Item)
+    {
+        const bool bAdded = Add(Item);
+        return { this->find(Item), bAdded };
+    }
+
+    /** 배열로 변환 */
+    TArray<KeyType> Array() const
+    {
+        TArray<KeyType> Result;
+        Result.Reserve(this->Num());
+        for (const KeyType& Item : *this)
+        {
+            Result.Add(Item);
+        }
+        return Result;
+    }
+};
+
+namespace FlatHash
+{
+    // 엔진에서 쓰는 키 타입(포인터, FName, FString, 정수)으로 TMap/TSet과 TFlatMap/TFlatSet 비교 (콘솔 HASH BENCH)
+    void RunBenchmark(int32 NumKeys);
+}
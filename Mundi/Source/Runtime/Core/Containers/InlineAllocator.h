@@ -0,0 +1,200 @@
+﻿#pragma once
+#include <memory>
+#include <type_traits>
+
+/**
+ * 인라인 할당기 정책: TArray<T, TInlineAllocator<N>>
+ * - 처음 N개는 배열 객체 안의 버퍼에 저장하고, 넘치면 힙으로 옮겨간다 (이후 동작은 일반 TArray와 같음)
+ * - 지역 변수로 쓰면 N개까지는 스택 메모리만 사용 (탐색 스택, 디버그 라인처럼 크기가 작고 거의 일정한 배열용)
+ * - 이동은 원소 단위로 옮긴다 (인라인 버퍼는 훔쳐올 수 없음). Swap/std::swap은 사용하지 않는다
+ * - TArray<T>를 받는 함수에는 넘길 수 없다 (할당기가 다른 TArray와 같은 제약)
+ */
+template<uint32 NumInlineElements>
+struct TInlineAllocator
+{
+};
+
+/**
+ * TArray<T, TInlineAllocator<N>>가 std::vector에 넘기는 실제 할당기
+ * - 배열이 가진 인라인 버퍼 주소와 사용 여부 플래그만 들고 있다
+ * - 다른 타입으로 rebind된 사본(디버그 반복자 프록시 등)은 인라인 버퍼를 쓰지 않고 항상 힙을 사용
+ */
+template<typename T, uint32 NumInlineElements>
+class TInlineElementAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = TInlineElementAllocator<U, NumInlineElements>;
+    };
+
+    TInlineElementAllocator() noexcept = default;
+    TInlineElementAllocator(T* InInlineData, bool* InInlineInUse) noexcept
+        : InlineData(InInlineData), bInlineInUse(InInlineInUse)
+    {
+    }
+
+    template<typename U>
+    TInlineElementAllocator(const TInlineElementAllocator<U, NumInlineElements>&) noexcept
+    {
+    }
+
+    T* allocate(SIZE_T Count)
+    {
+        if (InlineData && !*bInlineInUse && Count <= NumInlineElements)
+        {
+            *bInlineInUse = true;
+            return InlineData;
+        }
+        return std::allocator<T>().allocate(Count);
+    }
+
+    void deallocate(T* Ptr, SIZE_T Count) noexcept
+    {
+        if (Ptr == InlineData && InlineData)
+        {
+            *bInlineInUse = false;
+            return;
+        }
+        std::allocator<T>().deallocate(Ptr, Count);
+    }
+
+    // 복사 생성된 배열은 자기 인라인 버퍼를 따로 연결하므로 여기서는 힙 전용 할당기를 돌려준다
+    TInlineElementAllocator select_on_container_copy_construction() const noexcept
+    {
+        return TInlineElementAllocator();
+    }
+
+    bool IsInline(const T* Ptr) const { return InlineData && Ptr == InlineData; }
+
+    template<typename U>
+    bool operator==(const TInlineElementAllocator<U, NumInlineElements>& Other) const noexcept
+    {
+        return static_cast<const void*>(InlineData) == static_cast<const void*>(Other.InlineData);
+    }
+
+    template<typename U>
+    bool operator!=(const TInlineElementAllocator<U, NumInlineElements>& Other) const noexcept
+    {
+        return !(*this == Other);
+    }
+
+private:
+    template<typename, uint32> friend class TInlineElementAllocator;
+
+    T* InlineData = nullptr;
+    bool* bInlineInUse = nullptr;
+};
+
+// 인라인 버퍼는 std::vector 기반 클래스보다 먼저 생성되고 나중에 소멸해야 하므로 별도 기반 클래스로 둔다
+template<typename T, uint32 NumInlineElements>
+struct TInlineArrayStorage
+{
+    alignas(T) uint8 InlineBytes[sizeof(T) * NumInlineElements];
+    bool bInlineInUse = false;
+
+    T* GetInlineData() { return reinterpret_cast<T*>(InlineBytes); }
+};
+
+template<typename T, uint32 NumInlineElements>
+class TArray<T, TInlineAllocator<NumInlineElements>>
+    : private TInlineArrayStorage<T, NumInlineElements>
+    , public TArray<T, TInlineElementAllocator<T, NumInlineElements>>
+{
+    static_assert(NumInlineElements > 0, "TInlineAllocator requires at least one inline element");
+
+    using Storage = TInlineArrayStorage<T, NumInlineElements>;
+    using Super = TArray<T, TInlineElementAllocator<T, NumInlineElements>>;
+    using AllocatorType = TInlineElementAllocator<T, NumInlineElements>;
+
+public:
+    TArray()
+        : Super(AllocatorType(Storage::GetInlineData(), &this->bInlineInUse))
+    {
+        // 용량을 처음부터 N으로 잡아야 N개까지 재할당(=힙)이 일어나지 않는다
+        this->reserve(NumInlineElements);
+    }
+
+    TArray(std::initializer_list<T> Items)
+        : TArray()
+    {
+        this->insert(this->end(), Items.begin(), Items.end());
+    }
+
+    explicit TArray(SIZE_T Count)
+        : TArray()
+    {
+        this->resize(Count);
+    }
+
+    TArray(const TArray& Other)
+        : TArray()
+    {
+        this->insert(this->end(), Other.begin(), Other.end());
+    }
+
+    TArray(TArray&& Other)
+        : TArray()
+    {
+        this->insert(this->end(), std::make_move_iterator(Other.begin()), std::make_move_iterator(Other.end()));
+        Other.clear();
+    }
+
+    template<typename OtherAllocator>
+    TArray(const TArray<T, OtherAllocator>& Other)
+        : TArray()
+    {
+        this->insert(this->end(), Other.begin(), Other.end());
+    }
+
+    // 할당기가 서로 다르다고 판정되므로 std::vector가 원소 단위로 복사/이동한다
+    TArray& operator=(const TArray& Other)
+    {
+        Super::operator=(Other);
+        return *this;
+    }
+
+    TArray& operator=(TArray&& Other)
+    {
+        Super::operator=(std::move(Other));
+        Other.clear();
+        return *this;
+    }
+
+    TArray& operator=(std::initializer_list<T> Items)
+    {
+        this->assign(Items.begin(), Items.end());
+        return *this;
+    }
+
+    /** 원소가 인라인 버퍼에 있는지 */
+    bool IsInline() const
+    {
+        return this->get_allocator().IsInline(this->data());
+    }
+
+    /** 힙으로 넘어간 뒤 다시 N개 이하가 되면 인라인 버퍼로 돌아온다 */
+    void Shrink()
+    {
+        if (IsInline())
+        {
+            return;
+        }
+        if (this->size() > NumInlineElements)
+        {
+            this->shrink_to_fit();
+            return;
+        }
+
+        Super Heap(std::move(static_cast<Super&>(*this)));
+        this->reserve(NumInlineElements);
+        this->insert(this->end(), std::make_move_iterator(Heap.begin()), std::make_move_iterator(Heap.end()));
+    }
+};
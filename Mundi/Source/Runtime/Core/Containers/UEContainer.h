@@ -68,12 +68,12 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
-/** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+/** TArray 구현 (Allocator: std 할당기 정책, 예: TFrameAllocator) */
+template<typename T, typename Allocator = std::allocator<T>>
+class TArray : public std::vector<T, Allocator>
 {
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using std::vector<T, Allocator>::vector; /** 생성자 상속 */
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -100,8 +100,9 @@ public:
         return static_cast<int32>(std::distance(this->begin(), it));
     }
 
-    /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    /** 배열 병합 (할당기가 달라도 됨) */
+    template<typename OtherAllocator>
+    void Append(const TArray<T, OtherAllocator>& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -547,10 +548,11 @@ using TDoubleLinkedList = std::list<T>;
 /** 큐 모드 열거형 */
 enum class EQueueMode
 {
-    Spsc,           /** Single Producer Single Consumer (기본 FIFO) */
-    Mpmc,           /** Multiple Producer Multiple Consumer */
-    Mpsc,           /** Multiple Producer Single Consumer */
-    Spmc,           /** Single Producer Multiple Consumer */
+    SingleThread,   /** 동기화 없는 FIFO (한 스레드 전용, 기본값) */
+    Spsc,           /** Single Producer Single Consumer (고정 크기 링) */
+    Mpmc,           /** Multiple Producer Multiple Consumer (고정 크기 링) */
+    Mpsc,           /** Multiple Producer Single Consumer (크기 제한 없음) */
+    Spmc,           /** Single Producer Multiple Consumer (Mpmc와 동일) */
     Priority        /** Priority Queue */
 };
 
@@ -564,8 +566,8 @@ struct TDefaultCompare
     }
 };
 
-/** 기본 TQueue - FIFO 큐 */
-template<typename T, EQueueMode Mode = EQueueMode::Spsc, typename Compare = TDefaultCompare<T>>
+/** 기본 TQueue - FIFO 큐 (동시성 모드는 ConcurrentQueue.h의 특수화) */
+template<typename T, EQueueMode Mode = EQueueMode::SingleThread, typename Compare = TDefaultCompare<T>>
 class TQueue : public std::queue<T>
 {
 public:
@@ -721,6 +723,10 @@ public:
     }
 };
 
+#include "ConcurrentQueue.h"
+#include "FlatMap.h"
+#include "InlineAllocator.h"
+
 /** 편의성을 위한 매크로들 */
 #define TPriorityQueue(T) TQueue<T, EQueueMode::Priority>
 #define TPriorityQueueWithCompare(T, Compare) TQueue<T, EQueueMode::Priority, Compare>
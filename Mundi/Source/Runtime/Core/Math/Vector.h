@@ -1431,9 +1431,9 @@ inline FTransform FTransform::Inverse() const
 	//(SRT)^(-1) = T^(-1)R^(-1)S^(-1). Translation Factor : (0,0,0,1)*T^(-1)R^(-1)S^(-1)
 	//InvTrans = -InvScale(InvRotation(Translation))
 	FVector Rotated = InvRot.RotateVector(Translation);
-	FVector Scaled(Translation.X * InvScale.X,
-		Translation.Y * InvScale.Y,
-		Translation.Z * InvScale.Z);
+	FVector Scaled(Rotated.X * InvScale.X,
+		Rotated.Y * InvScale.Y,
+		Rotated.Z * InvScale.Z);
 	FVector InvTrans(-Scaled);
 
 	FTransform Out;
@@ -1443,14 +1443,8 @@ inline FTransform FTransform::Inverse() const
 	return Out;
 }
 
-inline void operator*= (TArray<FVector>& Vectors, const FMatrix& Mat)
-{
-	size_t VectorCount = Vectors.size();
-	for (size_t i = 0; i < VectorCount; i++)
-	{
-		Vectors[i] = Vectors[i] * Mat;
-	}
-}
+// 아핀 행렬이면 FSoAMath 일괄 커널로 처리 (VectorSoA.cpp)
+void operator*= (TArray<FVector>& Vectors, const FMatrix& Mat);
 inline void operator*= (TArray<FVector4>& Vectors, const FMatrix& Mat)
 {
 	size_t VectorCount = Vectors.size();
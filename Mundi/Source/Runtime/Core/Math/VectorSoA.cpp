@@ -0,0 +1,919 @@
+﻿#include "pch.h"
+#include "VectorSoA.h"
+#include "AABB.h"
+#include "PlatformTime.h"
+#include <immintrin.h>
+#include <random>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+void FVectorSoA::FromAoS(const FVector* Vectors, int32 Count)
+{
+	SetNum(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Set(i, Vectors[i]);
+	}
+}
+
+void FVectorSoA::ToAoS(FVector* OutVectors) const
+{
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		OutVectors[i] = Get(i);
+	}
+}
+
+void FTransformSoA::SetNum(int32 NewNum)
+{
+	Translation.SetNum(NewNum);
+	QX.SetNum(NewNum);
+	QY.SetNum(NewNum);
+	QZ.SetNum(NewNum);
+	QW.SetNum(NewNum);
+	Scale3D.SetNum(NewNum);
+}
+
+void FTransformSoA::Empty()
+{
+	Translation.Empty();
+	QX.Empty();
+	QY.Empty();
+	QZ.Empty();
+	QW.Empty();
+	Scale3D.Empty();
+}
+
+void FTransformSoA::Set(int32 Index, const FTransform& Transform)
+{
+	Translation.Set(Index, Transform.Translation);
+	QX[Index] = Transform.Rotation.X;
+	QY[Index] = Transform.Rotation.Y;
+	QZ[Index] = Transform.Rotation.Z;
+	QW[Index] = Transform.Rotation.W;
+	Scale3D.Set(Index, Transform.Scale3D);
+}
+
+FTransform FTransformSoA::Get(int32 Index) const
+{
+	return FTransform(Translation.Get(Index), FQuat(QX[Index], QY[Index], QZ[Index], QW[Index]), Scale3D.Get(Index));
+}
+
+void FTransformSoA::FromAoS(const FTransform* Transforms, int32 Count)
+{
+	SetNum(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Set(i, Transforms[i]);
+	}
+}
+
+void FTransformSoA::ToAoS(FTransform* OutTransforms) const
+{
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		OutTransforms[i] = Get(i);
+	}
+}
+
+namespace
+{
+	// ─────────────────────────────
+	// 레인 타입: 같은 커널 템플릿을 float / __m128 / __m256 으로 인스턴스화한다
+	// 스칼라와 SSE는 FVector4 * FMatrix, FTransform 과 같은 연산 순서를 지켜 비트 단위로 같은 결과를 낸다
+	// ─────────────────────────────
+	struct FScalarLane
+	{
+		using Type = float;
+		using Mask = bool;
+		static constexpr int32 Width = 1;
+
+		static Type Load(const float* P) { return *P; }
+		static void Store(float* P, Type V) { *P = V; }
+		static Type Set1(float V) { return V; }
+		static Type Zero() { return 0.0f; }
+		static Type Add(Type A, Type B) { return A + B; }
+		static Type Sub(Type A, Type B) { return A - B; }
+		static Type Mul(Type A, Type B) { return A * B; }
+		static Type Div(Type A, Type B) { return A / B; }
+		static Type MulAdd(Type A, Type B, Type C) { return A * B + C; }
+		static Type Neg(Type A) { return -A; }
+		static Type Abs(Type A) { return std::fabs(A); }
+		static Type Sqrt(Type A) { return std::sqrt(A); }
+		static Mask Greater(Type A, Type B) { return A > B; }
+		static Type Select(Mask M, Type IfTrue, Type IfFalse) { return M ? IfTrue : IfFalse; }
+
+		static void LoadAoS3(const float* P, Type& X, Type& Y, Type& Z) { X = P[0]; Y = P[1]; Z = P[2]; }
+		static void StoreAoS3(float* P, Type X, Type Y, Type Z) { P[0] = X; P[1] = Y; P[2] = Z; }
+		static Type Gather(const float* P, int32 Stride) { (void)Stride; return *P; }
+		static void Scatter(float* P, int32 Stride, Type V) { (void)Stride; *P = V; }
+
+		// C[Row * 4 + Col]
+		static void StoreMatrices(FMatrix* Out, const Type (&C)[16])
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					Out->M[Row][Col] = C[Row * 4 + Col];
+				}
+			}
+		}
+	};
+
+	struct FSseLane
+	{
+		using Type = __m128;
+		using Mask = __m128;
+		static constexpr int32 Width = 4;
+
+		static Type Load(const float* P) { return _mm_loadu_ps(P); }
+		static void Store(float* P, Type V) { _mm_storeu_ps(P, V); }
+		static Type Set1(float V) { return _mm_set1_ps(V); }
+		static Type Zero() { return _mm_setzero_ps(); }
+		static Type Add(Type A, Type B) { return _mm_add_ps(A, B); }
+		static Type Sub(Type A, Type B) { return _mm_sub_ps(A, B); }
+		static Type Mul(Type A, Type B) { return _mm_mul_ps(A, B); }
+		static Type Div(Type A, Type B) { return _mm_div_ps(A, B); }
+		static Type MulAdd(Type A, Type B, Type C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+		static Type Neg(Type A) { return _mm_xor_ps(A, _mm_set1_ps(-0.0f)); }
+		static Type Abs(Type A) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), A); }
+		static Type Sqrt(Type A) { return _mm_sqrt_ps(A); }
+		static Mask Greater(Type A, Type B) { return _mm_cmpgt_ps(A, B); }
+		static Type Select(Mask M, Type IfTrue, Type IfFalse) { return _mm_or_ps(_mm_and_ps(M, IfTrue), _mm_andnot_ps(M, IfFalse)); }
+
+		// [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3] <-> X/Y/Z
+		static void LoadAoS3(const float* P, Type& X, Type& Y, Type& Z)
+		{
+			const __m128 A = _mm_loadu_ps(P);
+			const __m128 B = _mm_loadu_ps(P + 4);
+			const __m128 C = _mm_loadu_ps(P + 8);
+
+			const __m128 X01 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(2, 1, 3, 0));		// x0 x1 z1 x2
+			const __m128 X23 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 0, 2, 1));		// z1 x2 z2 x3
+			X = _mm_shuffle_ps(X01, X23, _MM_SHUFFLE(3, 1, 1, 0));
+
+			const __m128 Y01 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(3, 0, 2, 1));		// y0 z0 y1 y2
+			const __m128 Y23 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3));		// y2 y2 y3 y3
+			Y = _mm_shuffle_ps(Y01, Y23, _MM_SHUFFLE(2, 0, 2, 0));
+
+			const __m128 Z01 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2));		// z0 z0 z1 z1
+			const __m128 Z23 = _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0));		// z2 z2 z3 z3
+			Z = _mm_shuffle_ps(Z01, Z23, _MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		static void StoreAoS3(float* P, Type X, Type Y, Type Z)
+		{
+			const __m128 XY01 = _mm_unpacklo_ps(X, Y);								// x0 y0 x1 y1
+			const __m128 XY23 = _mm_unpackhi_ps(X, Y);								// x2 y2 x3 y3
+
+			const __m128 Z0X1 = _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0));		// z0 z0 x1 x1
+			const __m128 Y1Z1 = _mm_shuffle_ps(XY01, Z, _MM_SHUFFLE(1, 1, 3, 3));	// y1 y1 z1 z1
+			const __m128 Z2X3 = _mm_shuffle_ps(Z, XY23, _MM_SHUFFLE(2, 2, 2, 2));	// z2 z2 x3 x3
+			const __m128 Y3Z3 = _mm_shuffle_ps(XY23, Z, _MM_SHUFFLE(3, 3, 3, 3));	// y3 y3 z3 z3
+
+			_mm_storeu_ps(P, _mm_shuffle_ps(XY01, Z0X1, _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(P + 4, _mm_shuffle_ps(Y1Z1, XY23, _MM_SHUFFLE(1, 0, 2, 0)));
+			_mm_storeu_ps(P + 8, _mm_shuffle_ps(Z2X3, Y3Z3, _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+
+		static Type Gather(const float* P, int32 Stride)
+		{
+			return _mm_set_ps(P[Stride * 3], P[Stride * 2], P[Stride], P[0]);
+		}
+
+		static void Scatter(float* P, int32 Stride, Type V)
+		{
+			alignas(16) float Values[4];
+			_mm_store_ps(Values, V);
+			for (int32 i = 0; i < 4; ++i)
+			{
+				P[Stride * i] = Values[i];
+			}
+		}
+
+		// 레인 i의 행렬 i를 4x4 전치로 만들어 행 단위로 저장
+		static void StoreMatrices(FMatrix* Out, const Type (&C)[16])
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				__m128 R0 = C[Row * 4 + 0];
+				__m128 R1 = C[Row * 4 + 1];
+				__m128 R2 = C[Row * 4 + 2];
+				__m128 R3 = C[Row * 4 + 3];
+				_MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+				Out[0].Rows[Row] = R0;
+				Out[1].Rows[Row] = R1;
+				Out[2].Rows[Row] = R2;
+				Out[3].Rows[Row] = R3;
+			}
+		}
+	};
+
+	struct FAvx2Lane
+	{
+		using Type = __m256;
+		using Mask = __m256;
+		static constexpr int32 Width = 8;
+
+		static Type Load(const float* P) { return _mm256_loadu_ps(P); }
+		static void Store(float* P, Type V) { _mm256_storeu_ps(P, V); }
+		static Type Set1(float V) { return _mm256_set1_ps(V); }
+		static Type Zero() { return _mm256_setzero_ps(); }
+		static Type Add(Type A, Type B) { return _mm256_add_ps(A, B); }
+		static Type Sub(Type A, Type B) { return _mm256_sub_ps(A, B); }
+		static Type Mul(Type A, Type B) { return _mm256_mul_ps(A, B); }
+		static Type Div(Type A, Type B) { return _mm256_div_ps(A, B); }
+		static Type MulAdd(Type A, Type B, Type C) { return _mm256_fmadd_ps(A, B, C); }
+		static Type Neg(Type A) { return _mm256_xor_ps(A, _mm256_set1_ps(-0.0f)); }
+		static Type Abs(Type A) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), A); }
+		static Type Sqrt(Type A) { return _mm256_sqrt_ps(A); }
+		static Mask Greater(Type A, Type B) { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+		static Type Select(Mask M, Type IfTrue, Type IfFalse) { return _mm256_blendv_ps(IfFalse, IfTrue, M); }
+
+		// 4개씩 SSE 셔플로 풀고 128비트 두 개를 합친다
+		static void LoadAoS3(const float* P, Type& X, Type& Y, Type& Z)
+		{
+			__m128 X0, Y0, Z0, X1, Y1, Z1;
+			FSseLane::LoadAoS3(P, X0, Y0, Z0);
+			FSseLane::LoadAoS3(P + 12, X1, Y1, Z1);
+			X = _mm256_insertf128_ps(_mm256_castps128_ps256(X0), X1, 1);
+			Y = _mm256_insertf128_ps(_mm256_castps128_ps256(Y0), Y1, 1);
+			Z = _mm256_insertf128_ps(_mm256_castps128_ps256(Z0), Z1, 1);
+		}
+
+		static void StoreAoS3(float* P, Type X, Type Y, Type Z)
+		{
+			FSseLane::StoreAoS3(P, _mm256_castps256_ps128(X), _mm256_castps256_ps128(Y), _mm256_castps256_ps128(Z));
+			FSseLane::StoreAoS3(P + 12, _mm256_extractf128_ps(X, 1), _mm256_extractf128_ps(Y, 1), _mm256_extractf128_ps(Z, 1));
+		}
+
+		static Type Gather(const float* P, int32 Stride)
+		{
+			return _mm256_set_ps(P[Stride * 7], P[Stride * 6], P[Stride * 5], P[Stride * 4],
+				P[Stride * 3], P[Stride * 2], P[Stride], P[0]);
+		}
+
+		static void Scatter(float* P, int32 Stride, Type V)
+		{
+			alignas(32) float Values[8];
+			_mm256_store_ps(Values, V);
+			for (int32 i = 0; i < 8; ++i)
+			{
+				P[Stride * i] = Values[i];
+			}
+		}
+
+		static void StoreMatrices(FMatrix* Out, const Type (&C)[16])
+		{
+			FSseLane::Type Low[16];
+			FSseLane::Type High[16];
+			for (int32 i = 0; i < 16; ++i)
+			{
+				Low[i] = _mm256_castps256_ps128(C[i]);
+				High[i] = _mm256_extractf128_ps(C[i], 1);
+			}
+			FSseLane::StoreMatrices(Out, Low);
+			FSseLane::StoreMatrices(Out + 4, High);
+		}
+	};
+
+	// [0, Num)을 L::Width개씩 처리하고, 남은 꼬리는 스칼라 레인으로 같은 본문을 실행
+	// Body(LaneTag, Index)에서 LaneTag의 타입으로 레인을 고른다
+	template<typename L, typename BodyType>
+	void ForEachLane(int32 Num, BodyType&& Body)
+	{
+		int32 Index = 0;
+		if constexpr (L::Width > 1)
+		{
+			for (; Index + L::Width <= Num; Index += L::Width)
+			{
+				Body(L{}, Index);
+			}
+		}
+		for (; Index < Num; ++Index)
+		{
+			Body(FScalarLane{}, Index);
+		}
+	}
+
+	// v * M (w = 1이면 이동 포함). bNormalize면 결과 길이를 1로 (길이가 0에 가까우면 그대로)
+	template<typename LaneType, bool bNormalize>
+	void TransformLane(const FMatrix& M, float W, typename LaneType::Type X, typename LaneType::Type Y, typename LaneType::Type Z,
+		typename LaneType::Type& OutX, typename LaneType::Type& OutY, typename LaneType::Type& OutZ)
+	{
+		using L = LaneType;
+		// FVector4 * FMatrix와 같은 순서: ((x * r0 + y * r1) + z * r2) + w * r3
+		OutX = L::MulAdd(Z, L::Set1(M.M[2][0]), L::MulAdd(Y, L::Set1(M.M[1][0]), L::Mul(X, L::Set1(M.M[0][0]))));
+		OutY = L::MulAdd(Z, L::Set1(M.M[2][1]), L::MulAdd(Y, L::Set1(M.M[1][1]), L::Mul(X, L::Set1(M.M[0][1]))));
+		OutZ = L::MulAdd(Z, L::Set1(M.M[2][2]), L::MulAdd(Y, L::Set1(M.M[1][2]), L::Mul(X, L::Set1(M.M[0][2]))));
+		if (W != 0.0f)
+		{
+			OutX = L::Add(OutX, L::Set1(M.M[3][0] * W));
+			OutY = L::Add(OutY, L::Set1(M.M[3][1] * W));
+			OutZ = L::Add(OutZ, L::Set1(M.M[3][2] * W));
+		}
+
+		if constexpr (bNormalize)
+		{
+			const typename L::Type Length = L::Sqrt(L::Add(L::Add(L::Mul(OutX, OutX), L::Mul(OutY, OutY)), L::Mul(OutZ, OutZ)));
+			const typename L::Mask bValid = L::Greater(Length, L::Set1(KINDA_SMALL_NUMBER));
+			const typename L::Type Divisor = L::Select(bValid, Length, L::Set1(1.0f));
+			OutX = L::Div(OutX, Divisor);
+			OutY = L::Div(OutY, Divisor);
+			OutZ = L::Div(OutZ, Divisor);
+		}
+	}
+
+	template<typename L, bool bNormalize>
+	void TransformSoAKernel(const FMatrix& M, float W, const float* InX, const float* InY, const float* InZ,
+		float* OutX, float* OutY, float* OutZ, int32 Num)
+	{
+		ForEachLane<L>(Num, [&](auto Tag, int32 i)
+		{
+			using LT = decltype(Tag);
+			typename LT::Type X, Y, Z;
+			TransformLane<LT, bNormalize>(M, W, LT::Load(InX + i), LT::Load(InY + i), LT::Load(InZ + i), X, Y, Z);
+			LT::Store(OutX + i, X);
+			LT::Store(OutY + i, Y);
+			LT::Store(OutZ + i, Z);
+		});
+	}
+
+	template<typename L>
+	void TransformAoSKernel(const FMatrix& M, const FVector* In, FVector* Out, int32 Num)
+	{
+		static_assert(sizeof(FVector) == sizeof(float) * 3, "FVector는 float 3개로 가정");
+		const float* InFloats = &In[0].X;
+		float* OutFloats = &Out[0].X;
+		ForEachLane<L>(Num, [&](auto Tag, int32 i)
+		{
+			using LT = decltype(Tag);
+			typename LT::Type X, Y, Z;
+			LT::LoadAoS3(InFloats + i * 3, X, Y, Z);
+			TransformLane<LT, false>(M, 1.0f, X, Y, Z, X, Y, Z);
+			LT::StoreAoS3(OutFloats + i * 3, X, Y, Z);
+		});
+	}
+
+	// 중심/반경 방식: c' = c * M, e' = e * |M| (8개 꼭짓점을 변환해 감싼 박스와 같음)
+	template<typename L>
+	void TransformAABBKernel(const FMatrix& M, const FAABB* In, FAABB* Out, int32 Num)
+	{
+		static_assert(sizeof(FAABB) == sizeof(float) * 6, "FAABB는 Min/Max float 6개로 가정");
+		const float* InFloats = &In[0].Min.X;
+		float* OutFloats = &Out[0].Min.X;
+		ForEachLane<L>(Num, [&](auto Tag, int32 i)
+		{
+			using LT = decltype(Tag);
+			using T = typename LT::Type;
+			const float* Box = InFloats + i * 6;
+			const T Half = LT::Set1(0.5f);
+			const T MinX = LT::Gather(Box + 0, 6), MinY = LT::Gather(Box + 1, 6), MinZ = LT::Gather(Box + 2, 6);
+			const T MaxX = LT::Gather(Box + 3, 6), MaxY = LT::Gather(Box + 4, 6), MaxZ = LT::Gather(Box + 5, 6);
+
+			const T CX = LT::Mul(LT::Add(MinX, MaxX), Half);
+			const T CY = LT::Mul(LT::Add(MinY, MaxY), Half);
+			const T CZ = LT::Mul(LT::Add(MinZ, MaxZ), Half);
+			const T EX = LT::Mul(LT::Sub(MaxX, MinX), Half);
+			const T EY = LT::Mul(LT::Sub(MaxY, MinY), Half);
+			const T EZ = LT::Mul(LT::Sub(MaxZ, MinZ), Half);
+
+			T WorldCX, WorldCY, WorldCZ;
+			TransformLane<LT, false>(M, 1.0f, CX, CY, CZ, WorldCX, WorldCY, WorldCZ);
+
+			T WorldE[3];
+			for (int32 Col = 0; Col < 3; ++Col)
+			{
+				WorldE[Col] = LT::MulAdd(EZ, LT::Set1(std::fabs(M.M[2][Col])),
+					LT::MulAdd(EY, LT::Set1(std::fabs(M.M[1][Col])), LT::Mul(EX, LT::Set1(std::fabs(M.M[0][Col])))));
+			}
+
+			float* OutBox = OutFloats + i * 6;
+			LT::Scatter(OutBox + 0, 6, LT::Sub(WorldCX, WorldE[0]));
+			LT::Scatter(OutBox + 1, 6, LT::Sub(WorldCY, WorldE[1]));
+			LT::Scatter(OutBox + 2, 6, LT::Sub(WorldCZ, WorldE[2]));
+			LT::Scatter(OutBox + 3, 6, LT::Add(WorldCX, WorldE[0]));
+			LT::Scatter(OutBox + 4, 6, LT::Add(WorldCY, WorldE[1]));
+			LT::Scatter(OutBox + 5, 6, LT::Add(WorldCZ, WorldE[2]));
+		});
+	}
+
+	// FQuat::RotateVector: v' = v + w * t + cross(q.xyz, t), t = 2 * cross(q.xyz, v)
+	template<typename L>
+	void RotateLane(typename L::Type QX, typename L::Type QY, typename L::Type QZ, typename L::Type QW,
+		typename L::Type& X, typename L::Type& Y, typename L::Type& Z)
+	{
+		using T = typename L::Type;
+		const T Two = L::Set1(2.0f);
+		const T TX = L::Mul(Two, L::Sub(L::Mul(QY, Z), L::Mul(QZ, Y)));
+		const T TY = L::Mul(Two, L::Sub(L::Mul(QZ, X), L::Mul(QX, Z)));
+		const T TZ = L::Mul(Two, L::Sub(L::Mul(QX, Y), L::Mul(QY, X)));
+
+		const T RX = L::Add(L::Add(X, L::Mul(QW, TX)), L::Sub(L::Mul(QY, TZ), L::Mul(QZ, TY)));
+		const T RY = L::Add(L::Add(Y, L::Mul(QW, TY)), L::Sub(L::Mul(QZ, TX), L::Mul(QX, TZ)));
+		const T RZ = L::Add(L::Add(Z, L::Mul(QW, TZ)), L::Sub(L::Mul(QX, TY), L::Mul(QY, TX)));
+
+		// 길이가 0인 쿼터니언은 회전하지 않는다
+		const T SizeSquared = L::Add(L::Add(L::Add(L::Mul(QX, QX), L::Mul(QY, QY)), L::Mul(QZ, QZ)), L::Mul(QW, QW));
+		const typename L::Mask bValid = L::Greater(SizeSquared, L::Set1(KINDA_SMALL_NUMBER));
+		X = L::Select(bValid, RX, X);
+		Y = L::Select(bValid, RY, Y);
+		Z = L::Select(bValid, RZ, Z);
+	}
+
+	template<typename L>
+	void ToMatricesKernel(const FTransformSoA& In, FMatrix* Out, int32 Num)
+	{
+		ForEachLane<L>(Num, [&](auto Tag, int32 i)
+		{
+			using LT = decltype(Tag);
+			using T = typename LT::Type;
+			const T X = LT::Load(&In.QX[i]), Y = LT::Load(&In.QY[i]), Z = LT::Load(&In.QZ[i]), W = LT::Load(&In.QW[i]);
+			const T SX = LT::Load(&In.Scale3D.X[i]), SY = LT::Load(&In.Scale3D.Y[i]), SZ = LT::Load(&In.Scale3D.Z[i]);
+
+			const T XX = LT::Mul(X, X), YY = LT::Mul(Y, Y), ZZ = LT::Mul(Z, Z);
+			const T XY = LT::Mul(X, Y), XZ = LT::Mul(X, Z), YZ = LT::Mul(Y, Z);
+			const T WX = LT::Mul(W, X), WY = LT::Mul(W, Y), WZ = LT::Mul(W, Z);
+			const T One = LT::Set1(1.0f);
+			const T Two = LT::Set1(2.0f);
+
+			// FQuat::ToMatrix의 전치 결과에 행별 스케일, 마지막 행에 이동 (FTransform::ToMatrix)
+			const T C[16] = {
+				LT::Mul(LT::Sub(One, LT::Mul(Two, LT::Add(YY, ZZ))), SX), LT::Mul(LT::Mul(Two, LT::Add(XY, WZ)), SX), LT::Mul(LT::Mul(Two, LT::Sub(XZ, WY)), SX), LT::Zero(),
+				LT::Mul(LT::Mul(Two, LT::Sub(XY, WZ)), SY), LT::Mul(LT::Sub(One, LT::Mul(Two, LT::Add(XX, ZZ))), SY), LT::Mul(LT::Mul(Two, LT::Add(YZ, WX)), SY), LT::Zero(),
+				LT::Mul(LT::Mul(Two, LT::Add(XZ, WY)), SZ), LT::Mul(LT::Mul(Two, LT::Sub(YZ, WX)), SZ), LT::Mul(LT::Sub(One, LT::Mul(Two, LT::Add(XX, YY))), SZ), LT::Zero(),
+				LT::Load(&In.Translation.X[i]), LT::Load(&In.Translation.Y[i]), LT::Load(&In.Translation.Z[i]), One,
+			};
+			LT::StoreMatrices(Out + i, C);
+		});
+	}
+
+	template<typename L>
+	void ComposeKernel(const FTransformSoA& Parents, const FTransformSoA& Children, FTransformSoA& Out, int32 Num)
+	{
+		ForEachLane<L>(Num, [&](auto Tag, int32 i)
+		{
+			using LT = decltype(Tag);
+			using T = typename LT::Type;
+			const T PX = LT::Load(&Parents.QX[i]), PY = LT::Load(&Parents.QY[i]), PZ = LT::Load(&Parents.QZ[i]), PW = LT::Load(&Parents.QW[i]);
+			const T CX = LT::Load(&Children.QX[i]), CY = LT::Load(&Children.QY[i]), CZ = LT::Load(&Children.QZ[i]), CW = LT::Load(&Children.QW[i]);
+			const T PSX = LT::Load(&Parents.Scale3D.X[i]), PSY = LT::Load(&Parents.Scale3D.Y[i]), PSZ = LT::Load(&Parents.Scale3D.Z[i]);
+
+			// 회전: Parent * Child 후 정규화 (FQuat::operator*, FQuat::Normalize)
+			T RX = LT::Sub(LT::Add(LT::Add(LT::Mul(PW, CX), LT::Mul(PX, CW)), LT::Mul(PY, CZ)), LT::Mul(PZ, CY));
+			T RY = LT::Add(LT::Add(LT::Sub(LT::Mul(PW, CY), LT::Mul(PX, CZ)), LT::Mul(PY, CW)), LT::Mul(PZ, CX));
+			T RZ = LT::Add(LT::Sub(LT::Add(LT::Mul(PW, CZ), LT::Mul(PX, CY)), LT::Mul(PY, CX)), LT::Mul(PZ, CW));
+			T RW = LT::Sub(LT::Sub(LT::Sub(LT::Mul(PW, CW), LT::Mul(PX, CX)), LT::Mul(PY, CY)), LT::Mul(PZ, CZ));
+			const T Size = LT::Sqrt(LT::Add(LT::Add(LT::Add(LT::Mul(RX, RX), LT::Mul(RY, RY)), LT::Mul(RZ, RZ)), LT::Mul(RW, RW)));
+			const typename LT::Mask bValid = LT::Greater(Size, LT::Set1(KINDA_SMALL_NUMBER));
+			RX = LT::Select(bValid, LT::Div(RX, Size), LT::Zero());
+			RY = LT::Select(bValid, LT::Div(RY, Size), LT::Zero());
+			RZ = LT::Select(bValid, LT::Div(RZ, Size), LT::Zero());
+			RW = LT::Select(bValid, LT::Div(RW, Size), LT::Set1(1.0f));
+
+			// 이동: Parent.T + Parent.R * (Parent.S * Child.T)
+			T TX = LT::Mul(LT::Load(&Children.Translation.X[i]), PSX);
+			T TY = LT::Mul(LT::Load(&Children.Translation.Y[i]), PSY);
+			T TZ = LT::Mul(LT::Load(&Children.Translation.Z[i]), PSZ);
+			RotateLane<LT>(PX, PY, PZ, PW, TX, TY, TZ);
+
+			// Out이 Parents/Children과 같은 배열일 수 있으므로 모든 입력을 읽은 뒤에 쓴다
+			const T OutSX = LT::Mul(PSX, LT::Load(&Children.Scale3D.X[i]));
+			const T OutSY = LT::Mul(PSY, LT::Load(&Children.Scale3D.Y[i]));
+			const T OutSZ = LT::Mul(PSZ, LT::Load(&Children.Scale3D.Z[i]));
+			const T OutTX = LT::Add(LT::Load(&Parents.Translation.X[i]), TX);
+			const T OutTY = LT::Add(LT::Load(&Parents.Translation.Y[i]), TY);
+			const T OutTZ = LT::Add(LT::Load(&Parents.Translation.Z[i]), TZ);
+
+			LT::Store(&Out.QX[i], RX);
+			LT::Store(&Out.QY[i], RY);
+			LT::Store(&Out.QZ[i], RZ);
+			LT::Store(&Out.QW[i], RW);
+			LT::Store(&Out.Scale3D.X[i], OutSX);
+			LT::Store(&Out.Scale3D.Y[i], OutSY);
+			LT::Store(&Out.Scale3D.Z[i], OutSZ);
+			LT::Store(&Out.Translation.X[i], OutTX);
+			LT::Store(&Out.Translation.Y[i], OutTY);
+			LT::Store(&Out.Translation.Z[i], OutTZ);
+		});
+	}
+
+	template<typename L>
+	void InverseKernel(const FTransformSoA& In, FTransformSoA& Out, int32 Num)
+	{
+		ForEachLane<L>(Num, [&](auto Tag, int32 i)
+		{
+			using LT = decltype(Tag);
+			using T = typename LT::Type;
+			const T Small = LT::Set1(KINDA_SMALL_NUMBER);
+			const T One = LT::Set1(1.0f);
+			const auto InvertScale = [&](T S)
+			{
+				return LT::Select(LT::Greater(LT::Abs(S), Small), LT::Div(One, S), LT::Zero());
+			};
+			const T ISX = InvertScale(LT::Load(&In.Scale3D.X[i]));
+			const T ISY = InvertScale(LT::Load(&In.Scale3D.Y[i]));
+			const T ISZ = InvertScale(LT::Load(&In.Scale3D.Z[i]));
+
+			const T QX = LT::Neg(LT::Load(&In.QX[i]));
+			const T QY = LT::Neg(LT::Load(&In.QY[i]));
+			const T QZ = LT::Neg(LT::Load(&In.QZ[i]));
+			const T QW = LT::Load(&In.QW[i]);
+
+			// -InvScale(InvRotation(Translation))
+			T TX = LT::Load(&In.Translation.X[i]);
+			T TY = LT::Load(&In.Translation.Y[i]);
+			T TZ = LT::Load(&In.Translation.Z[i]);
+			RotateLane<LT>(QX, QY, QZ, QW, TX, TY, TZ);
+
+			LT::Store(&Out.QX[i], QX);
+			LT::Store(&Out.QY[i], QY);
+			LT::Store(&Out.QZ[i], QZ);
+			LT::Store(&Out.QW[i], QW);
+			LT::Store(&Out.Scale3D.X[i], ISX);
+			LT::Store(&Out.Scale3D.Y[i], ISY);
+			LT::Store(&Out.Scale3D.Z[i], ISZ);
+			LT::Store(&Out.Translation.X[i], LT::Neg(LT::Mul(TX, ISX)));
+			LT::Store(&Out.Translation.Y[i], LT::Neg(LT::Mul(TY, ISY)));
+			LT::Store(&Out.Translation.Z[i], LT::Neg(LT::Mul(TZ, ISZ)));
+		});
+	}
+
+	struct FSoAKernels
+	{
+		void (*Transform)(const FMatrix&, float, const float*, const float*, const float*, float*, float*, float*, int32);
+		void (*TransformNormalized)(const FMatrix&, float, const float*, const float*, const float*, float*, float*, float*, int32);
+		void (*TransformAoS)(const FMatrix&, const FVector*, FVector*, int32);
+		void (*TransformAABBs)(const FMatrix&, const FAABB*, FAABB*, int32);
+		void (*ToMatrices)(const FTransformSoA&, FMatrix*, int32);
+		void (*Compose)(const FTransformSoA&, const FTransformSoA&, FTransformSoA&, int32);
+		void (*Inverse)(const FTransformSoA&, FTransformSoA&, int32);
+	};
+
+	template<typename L>
+	constexpr FSoAKernels MakeKernels()
+	{
+		return FSoAKernels{
+			&TransformSoAKernel<L, false>,
+			&TransformSoAKernel<L, true>,
+			&TransformAoSKernel<L>,
+			&TransformAABBKernel<L>,
+			&ToMatricesKernel<L>,
+			&ComposeKernel<L>,
+			&InverseKernel<L>,
+		};
+	}
+
+	constexpr FSoAKernels ScalarKernels = MakeKernels<FScalarLane>();
+	constexpr FSoAKernels SseKernels = MakeKernels<FSseLane>();
+	constexpr FSoAKernels Avx2Kernels = MakeKernels<FAvx2Lane>();
+
+	ESimdLevel DetectSimdLevel()
+	{
+#if defined(_MSC_VER)
+		int Info[4] = {};
+		__cpuid(Info, 0);
+		const int MaxLeaf = Info[0];
+
+		__cpuid(Info, 1);
+		const bool bFMA = (Info[2] & (1 << 12)) != 0;
+		const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+		const bool bAVX = (Info[2] & (1 << 28)) != 0;
+
+		bool bAVX2 = false;
+		if (MaxLeaf >= 7)
+		{
+			__cpuidex(Info, 7, 0);
+			bAVX2 = (Info[1] & (1 << 5)) != 0;
+		}
+
+		// OS가 컨텍스트 전환 때 YMM 상위 비트를 저장하는지 (XCR0의 SSE/AVX 상태 비트)
+		const bool bYmmEnabled = bOSXSave && (_xgetbv(0) & 0x6) == 0x6;
+		return (bAVX && bAVX2 && bFMA && bYmmEnabled) ? ESimdLevel::AVX2 : ESimdLevel::SSE;
+#else
+		__builtin_cpu_init();
+		return (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) ? ESimdLevel::AVX2 : ESimdLevel::SSE;
+#endif
+	}
+
+	ESimdLevel GSimdLevel = ESimdLevel::Scalar;
+	const FSoAKernels* GKernels = nullptr;
+
+	const FSoAKernels& GetKernels()
+	{
+		if (!GKernels)
+		{
+			FSoAMath::SetSimdLevel(FSoAMath::GetSupportedSimdLevel());
+		}
+		return *GKernels;
+	}
+
+	// 행벡터 규약에서 법선은 3x3의 역전치로 변환: 행 = (r1 x r2, r2 x r0, r0 x r1) / det
+	FMatrix MakeNormalMatrix(const FMatrix& M)
+	{
+		const FVector R0(M.M[0][0], M.M[0][1], M.M[0][2]);
+		const FVector R1(M.M[1][0], M.M[1][1], M.M[1][2]);
+		const FVector R2(M.M[2][0], M.M[2][1], M.M[2][2]);
+		FVector C0 = FVector::Cross(R1, R2);
+		FVector C1 = FVector::Cross(R2, R0);
+		FVector C2 = FVector::Cross(R0, R1);
+
+		// 결과를 정규화하므로 크기는 상관없고, 행렬식의 부호(반전)만 반영한다
+		if (FVector::Dot(R0, C0) < 0.0f)
+		{
+			C0 = -C0;
+			C1 = -C1;
+			C2 = -C2;
+		}
+		return FMatrix(
+			C0.X, C0.Y, C0.Z, 0.0f,
+			C1.X, C1.Y, C1.Z, 0.0f,
+			C2.X, C2.Y, C2.Z, 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f);
+	}
+}
+
+ESimdLevel FSoAMath::GetSimdLevel()
+{
+	GetKernels();
+	return GSimdLevel;
+}
+
+ESimdLevel FSoAMath::GetSupportedSimdLevel()
+{
+	static const ESimdLevel Supported = DetectSimdLevel();
+	return Supported;
+}
+
+void FSoAMath::SetSimdLevel(ESimdLevel Level)
+{
+	GSimdLevel = std::min(Level, GetSupportedSimdLevel());
+	switch (GSimdLevel)
+	{
+	case ESimdLevel::AVX2:	GKernels = &Avx2Kernels; break;
+	case ESimdLevel::SSE:	GKernels = &SseKernels; break;
+	default:				GKernels = &ScalarKernels; break;
+	}
+}
+
+const char* FSoAMath::GetSimdLevelName(ESimdLevel Level)
+{
+	switch (Level)
+	{
+	case ESimdLevel::AVX2:	return "AVX2";
+	case ESimdLevel::SSE:	return "SSE";
+	default:				return "Scalar";
+	}
+}
+
+void FSoAMath::TransformPositions(const FMatrix& M, const FVectorSoA& In, FVectorSoA& Out)
+{
+	Out.SetNum(In.Num());
+	GetKernels().Transform(M, 1.0f, In.X.data(), In.Y.data(), In.Z.data(), Out.X.data(), Out.Y.data(), Out.Z.data(), In.Num());
+}
+
+void FSoAMath::TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Num)
+{
+	if (Num > 0)
+	{
+		GetKernels().TransformAoS(M, In, Out, Num);
+	}
+}
+
+void FSoAMath::TransformVectors(const FMatrix& M, const FVectorSoA& In, FVectorSoA& Out)
+{
+	Out.SetNum(In.Num());
+	GetKernels().Transform(M, 0.0f, In.X.data(), In.Y.data(), In.Z.data(), Out.X.data(), Out.Y.data(), Out.Z.data(), In.Num());
+}
+
+void FSoAMath::TransformNormals(const FMatrix& M, const FVectorSoA& In, FVectorSoA& Out)
+{
+	Out.SetNum(In.Num());
+	const FMatrix NormalMatrix = MakeNormalMatrix(M);
+	GetKernels().TransformNormalized(NormalMatrix, 0.0f, In.X.data(), In.Y.data(), In.Z.data(), Out.X.data(), Out.Y.data(), Out.Z.data(), In.Num());
+}
+
+FAABB FSoAMath::TransformAABB(const FAABB& LocalBound, const FMatrix& M)
+{
+	// 원소 하나는 행 단위 SSE로 (c' = cx*r0 + cy*r1 + cz*r2 + r3, e' = ex*|r0| + ey*|r1| + ez*|r2|)
+	const __m128 Half = _mm_set1_ps(0.5f);
+	const __m128 SignMask = _mm_set1_ps(-0.0f);
+	const __m128 Min = _mm_set_ps(0.0f, LocalBound.Min.Z, LocalBound.Min.Y, LocalBound.Min.X);
+	const __m128 Max = _mm_set_ps(0.0f, LocalBound.Max.Z, LocalBound.Max.Y, LocalBound.Max.X);
+	const __m128 Center = _mm_mul_ps(_mm_add_ps(Min, Max), Half);
+	const __m128 Extent = _mm_mul_ps(_mm_sub_ps(Max, Min), Half);
+
+	const __m128 CX = _mm_shuffle_ps(Center, Center, _MM_SHUFFLE(0, 0, 0, 0));
+	const __m128 CY = _mm_shuffle_ps(Center, Center, _MM_SHUFFLE(1, 1, 1, 1));
+	const __m128 CZ = _mm_shuffle_ps(Center, Center, _MM_SHUFFLE(2, 2, 2, 2));
+	const __m128 EX = _mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(0, 0, 0, 0));
+	const __m128 EY = _mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(1, 1, 1, 1));
+	const __m128 EZ = _mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(2, 2, 2, 2));
+
+	__m128 WorldCenter = _mm_mul_ps(CX, M.Rows[0]);
+	WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(CY, M.Rows[1]));
+	WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(CZ, M.Rows[2]));
+	WorldCenter = _mm_add_ps(WorldCenter, M.Rows[3]);
+
+	__m128 WorldExtent = _mm_mul_ps(EX, _mm_andnot_ps(SignMask, M.Rows[0]));
+	WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(EY, _mm_andnot_ps(SignMask, M.Rows[1])));
+	WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(EZ, _mm_andnot_ps(SignMask, M.Rows[2])));
+
+	alignas(16) float WorldMin[4];
+	alignas(16) float WorldMax[4];
+	_mm_store_ps(WorldMin, _mm_sub_ps(WorldCenter, WorldExtent));
+	_mm_store_ps(WorldMax, _mm_add_ps(WorldCenter, WorldExtent));
+	return FAABB(FVector(WorldMin[0], WorldMin[1], WorldMin[2]), FVector(WorldMax[0], WorldMax[1], WorldMax[2]));
+}
+
+void FSoAMath::TransformAABBs(const FMatrix& M, const FAABB* In, FAABB* Out, int32 Num)
+{
+	if (Num > 0)
+	{
+		GetKernels().TransformAABBs(M, In, Out, Num);
+	}
+}
+
+void FSoAMath::TransformAABBs(const FMatrix* Matrices, const FAABB* LocalBounds, FAABB* Out, int32 Num)
+{
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Out[i] = TransformAABB(LocalBounds[i], Matrices[i]);
+	}
+}
+
+void FSoAMath::ToMatrices(const FTransformSoA& In, FMatrix* OutMatrices)
+{
+	if (In.Num() > 0)
+	{
+		GetKernels().ToMatrices(In, OutMatrices, In.Num());
+	}
+}
+
+void FSoAMath::Compose(const FTransformSoA& Parents, const FTransformSoA& Children, FTransformSoA& Out)
+{
+	const int32 Num = std::min(Parents.Num(), Children.Num());
+	if (Out.Num() != Num)
+	{
+		Out.SetNum(Num);
+	}
+	if (Num > 0)
+	{
+		GetKernels().Compose(Parents, Children, Out, Num);
+	}
+}
+
+void FSoAMath::Inverse(const FTransformSoA& In, FTransformSoA& Out)
+{
+	if (Out.Num() != In.Num())
+	{
+		Out.SetNum(In.Num());
+	}
+	if (In.Num() > 0)
+	{
+		GetKernels().Inverse(In, Out, In.Num());
+	}
+}
+
+void FSoAMath::RunBenchmark(int32 Num, int32 Iterations)
+{
+	if (Num <= 0 || Iterations <= 0)
+	{
+		UE_LOG("[SoAMath] Benchmark: invalid arguments");
+		return;
+	}
+
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	const auto RandomVector = [&](float Scale)
+	{
+		return FVector(Unit(Rng) * Scale, Unit(Rng) * Scale, Unit(Rng) * Scale);
+	};
+
+	TArray<FVector> Points;
+	TArray<FAABB> Bounds;
+	TArray<FTransform> Transforms;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Points.Add(RandomVector(100.0f));
+		const FVector Center = RandomVector(100.0f);
+		const FVector Extent = RandomVector(0.5f) + FVector(1.5f, 1.5f, 1.5f);
+		Bounds.Add(FAABB(Center - Extent, Center + Extent));
+		FQuat Rotation(Unit(Rng), Unit(Rng), Unit(Rng), Unit(Rng));
+		Rotation.Normalize();
+		Transforms.Add(FTransform(RandomVector(100.0f), Rotation, RandomVector(0.5f) + FVector(1.0f, 1.0f, 1.0f)));
+	}
+
+	const FMatrix M = FTransform(FVector(1.0f, 2.0f, 3.0f), FQuat::MakeFromEulerZYX(FVector(10.0f, 20.0f, 30.0f)), FVector(1.0f, 2.0f, 0.5f)).ToMatrix();
+	FVectorSoA PointsSoA;
+	PointsSoA.FromAoS(Points.data(), Num);
+	FTransformSoA TransformsSoA;
+	TransformsSoA.FromAoS(Transforms.data(), Num);
+
+	// 스칼라 결과 (기존 FVector/FTransform 연산) - 오차 비교 기준
+	TArray<FVector> ReferencePoints;
+	TArray<FMatrix> ReferenceMatrices;
+	TArray<FTransform> ReferenceComposed;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		ReferencePoints.Add(Points[i] * M);
+		ReferenceMatrices.Add(Transforms[i].ToMatrix());
+		ReferenceComposed.Add(Transforms[(i + 1) % Num].GetWorldTransform(Transforms[i]));
+	}
+	FTransformSoA ParentsSoA;
+	ParentsSoA.SetNum(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		ParentsSoA.Set(i, Transforms[(i + 1) % Num]);
+	}
+
+	const auto MaxAbs = [](const FVector& V)
+	{
+		return std::max(std::fabs(V.X), std::max(std::fabs(V.Y), std::fabs(V.Z)));
+	};
+
+	const auto Measure = [Iterations](const auto& Func)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Func();
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / Iterations;
+	};
+
+	const ESimdLevel PreviousLevel = GetSimdLevel();
+	UE_LOG("[SoAMath] Benchmark: %d elements x %d iterations, supported %s", Num, Iterations, GetSimdLevelName(GetSupportedSimdLevel()));
+
+	// 기존 AoS 스칼라 루프
+	TArray<FVector> OutPoints = Points;
+	TArray<FAABB> OutBounds = Bounds;
+	TArray<FMatrix> OutMatrices;
+	OutMatrices.SetNum(Num);
+	const double LegacyPointsMS = Measure([&]()
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			OutPoints[i] = Points[i] * M;
+		}
+	});
+	const double LegacyMatricesMS = Measure([&]()
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			OutMatrices[i] = Transforms[i].ToMatrix();
+		}
+	});
+	UE_LOG("[SoAMath]   legacy  points %.3f ms, matrices %.3f ms", LegacyPointsMS, LegacyMatricesMS);
+
+	FVectorSoA OutPointsSoA;
+	FTransformSoA OutComposed;
+	for (int32 Level = 0; Level <= static_cast<int32>(GetSupportedSimdLevel()); ++Level)
+	{
+		SetSimdLevel(static_cast<ESimdLevel>(Level));
+
+		const double PointsMS = Measure([&]() { TransformPositions(M, PointsSoA, OutPointsSoA); });
+		const double PointsAoSMS = Measure([&]() { TransformPositions(M, Points.data(), OutPoints.data(), Num); });
+		const double BoundsMS = Measure([&]() { TransformAABBs(M, Bounds.data(), OutBounds.data(), Num); });
+		const double MatricesMS = Measure([&]() { ToMatrices(TransformsSoA, OutMatrices.data()); });
+		const double ComposeMS = Measure([&]() { Compose(ParentsSoA, TransformsSoA, OutComposed); });
+
+		float MaxError = 0.0f;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			MaxError = std::max(MaxError, MaxAbs(OutPointsSoA.Get(i) - ReferencePoints[i]));
+			MaxError = std::max(MaxError, MaxAbs(OutPoints[i] - ReferencePoints[i]));
+			MaxError = std::max(MaxError, MaxAbs(OutComposed.Get(i).Translation - ReferenceComposed[i].Translation));
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					MaxError = std::max(MaxError, std::fabs(OutMatrices[i].M[Row][Col] - ReferenceMatrices[i].M[Row][Col]));
+				}
+			}
+		}
+
+		UE_LOG("[SoAMath]   %-6s  points %.3f ms (aos %.3f), aabbs %.3f ms, matrices %.3f ms, compose %.3f ms, max error %g",
+			GetSimdLevelName(static_cast<ESimdLevel>(Level)), PointsMS, PointsAoSMS, BoundsMS, MatricesMS, ComposeMS, MaxError);
+	}
+
+	SetSimdLevel(PreviousLevel);
+}
+
+void operator*=(TArray<FVector>& Vectors, const FMatrix& Mat)
+{
+	// 아핀 행렬이면 w가 항상 1이라 원근 나눗셈이 필요 없으므로 일괄 커널로 처리
+	const bool bAffine = Mat.M[0][3] == 0.0f && Mat.M[1][3] == 0.0f && Mat.M[2][3] == 0.0f && Mat.M[3][3] == 1.0f;
+	if (bAffine)
+	{
+		FSoAMath::TransformPositions(Mat, Vectors.data(), Vectors.data(), Vectors.Num());
+		return;
+	}
+
+	for (FVector& Vector : Vectors)
+	{
+		Vector = Vector * Mat;
+	}
+}
@@ -0,0 +1,95 @@
+﻿#pragma once
+#include "Vector.h"
+
+struct FAABB;
+
+// FSoAMath 커널이 사용하는 SIMD 경로 (뒤로 갈수록 넓음)
+enum class ESimdLevel : uint8
+{
+	Scalar,
+	SSE,		// 4개씩 (x64 기본)
+	AVX2,		// 8개씩, AVX2 + FMA 지원 CPU에서만
+};
+
+// ─────────────────────────────
+// FVectorSoA (X/Y/Z를 각각 연속 배열로 보관)
+// ─────────────────────────────
+struct FVectorSoA
+{
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+
+	int32 Num() const { return X.Num(); }
+	void SetNum(int32 NewNum) { X.SetNum(NewNum); Y.SetNum(NewNum); Z.SetNum(NewNum); }
+	void Empty() { X.Empty(); Y.Empty(); Z.Empty(); }
+
+	void Set(int32 Index, const FVector& V) { X[Index] = V.X; Y[Index] = V.Y; Z[Index] = V.Z; }
+	FVector Get(int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+
+	void FromAoS(const FVector* Vectors, int32 Count);
+	void ToAoS(FVector* OutVectors) const;
+};
+
+// ─────────────────────────────
+// FTransformSoA (FTransform 배열의 SoA 표현)
+// ─────────────────────────────
+struct FTransformSoA
+{
+	FVectorSoA Translation;
+	TArray<float> QX;
+	TArray<float> QY;
+	TArray<float> QZ;
+	TArray<float> QW;
+	FVectorSoA Scale3D;
+
+	int32 Num() const { return QX.Num(); }
+	void SetNum(int32 NewNum);
+	void Empty();
+
+	void Set(int32 Index, const FTransform& Transform);
+	FTransform Get(int32 Index) const;
+
+	void FromAoS(const FTransform* Transforms, int32 Count);
+	void ToAoS(FTransform* OutTransforms) const;
+};
+
+/**
+ * 배열 단위 변환/바운드 커널
+ * - 행벡터 규약 (p' = p * M). 결과는 FVector4 * FMatrix, FTransform 스칼라 연산과 같은 식을 따른다
+ *   (AVX2 경로는 FMA를 쓰므로 마지막 비트가 다를 수 있음)
+ * - 처음 호출될 때 CPUID로 가장 넓은 경로를 골라 커널 표에 고정한다
+ * - 입력과 출력이 같은 배열이어도 된다 (원소마다 읽은 뒤 쓴다)
+ */
+struct FSoAMath
+{
+	static ESimdLevel GetSimdLevel();
+	static ESimdLevel GetSupportedSimdLevel();
+	// 지원 범위 안에서 경로를 강제 (벤치마크/결과 비교용, 게임 스레드에서만)
+	static void SetSimdLevel(ESimdLevel Level);
+	static const char* GetSimdLevelName(ESimdLevel Level);
+
+	// 점 (w = 1)
+	static void TransformPositions(const FMatrix& M, const FVectorSoA& In, FVectorSoA& Out);
+	static void TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Num);
+	// 방향 (w = 0)
+	static void TransformVectors(const FMatrix& M, const FVectorSoA& In, FVectorSoA& Out);
+	// M의 3x3 역전치로 변환한 뒤 정규화 (비균등 스케일에서도 수직 유지)
+	static void TransformNormals(const FMatrix& M, const FVectorSoA& In, FVectorSoA& Out);
+
+	// 로컬 바운드의 8개 꼭짓점을 변환해 감싸는 AABB (중심/반경 방식, 꼭짓점 변환과 반올림 오차 안에서 같음)
+	static FAABB TransformAABB(const FAABB& LocalBound, const FMatrix& M);
+	static void TransformAABBs(const FMatrix& M, const FAABB* In, FAABB* Out, int32 Num);
+	// 원소마다 다른 행렬 (컴포넌트 월드 바운드 일괄 갱신)
+	static void TransformAABBs(const FMatrix* Matrices, const FAABB* LocalBounds, FAABB* Out, int32 Num);
+
+	// FTransform::ToMatrix 배열 판 (쿼터니언 -> 회전 행렬, 스케일, 이동)
+	static void ToMatrices(const FTransformSoA& In, FMatrix* OutMatrices);
+	// Out[i] = Parents[i].GetWorldTransform(Children[i])
+	static void Compose(const FTransformSoA& Parents, const FTransformSoA& Children, FTransformSoA& Out);
+	// Out[i] = In[i].Inverse()
+	static void Inverse(const FTransformSoA& In, FTransformSoA& Out);
+
+	// 지원하는 경로별 처리량과 스칼라 결과 대비 최대 오차 (콘솔 MATH BENCH)
+	static void RunBenchmark(int32 Num, int32 Iterations);
+};
@@ -0,0 +1,145 @@
+﻿#include "pch.h"
+#include "FrameArena.h"
+#include <malloc.h>
+#include <cstring>
+#include <algorithm>
+
+FFrameArena& FFrameArena::Get()
+{
+	static FFrameArena Arena;
+	return Arena;
+}
+
+FFrameArena::~FFrameArena()
+{
+	for (FBuffer& Buffer : Buffers)
+	{
+		for (FChunk& Chunk : Buffer.Chunks)
+		{
+			FreeChunk(Chunk);
+		}
+		Buffer.Chunks.Empty();
+	}
+}
+
+void* FFrameArena::AllocateSlow(SIZE_T Size, SIZE_T Alignment)
+{
+	FBuffer& Buffer = Buffers[CurrentBuffer];
+
+	// 남은 공간이 부족한 청크는 그대로 두고 새 청크로 넘어간다 (이전 청크 크기의 두 배씩)
+	SIZE_T ChunkSize = MinChunkSize;
+	if (!Buffer.Chunks.IsEmpty())
+	{
+		FChunk& Last = Buffer.Chunks.Last();
+		Last.Used = static_cast<SIZE_T>(Buffer.Cursor - Last.Data);
+		ChunkSize = Last.Size * 2;
+	}
+	ChunkSize = std::max(ChunkSize, Size + Alignment);
+
+	FChunk Chunk = AllocateChunk(ChunkSize);
+	if (!Chunk.Data)
+	{
+		return nullptr;
+	}
+	Buffer.Chunks.Add(Chunk);
+	Buffer.Cursor = Chunk.Data;
+	Buffer.End = Chunk.Data + Chunk.Size;
+
+	const uintptr_t Aligned = (reinterpret_cast<uintptr_t>(Buffer.Cursor) + (Alignment - 1)) & ~(static_cast<uintptr_t>(Alignment) - 1);
+	uint8* Result = reinterpret_cast<uint8*>(Aligned);
+	Buffer.UsedBytes += (Result + Size) - Buffer.Cursor;
+	Buffer.Cursor = Result + Size;
+	return Result;
+}
+
+void FFrameArena::EndFrame()
+{
+	LastFrameBytes = Buffers[CurrentBuffer].UsedBytes;
+	HighWaterBytes = std::max(HighWaterBytes, LastFrameBytes);
+
+	// 직전 프레임이 쓰던 버퍼를 다음 프레임에 넘겨준다 (이번 프레임 데이터는 한 프레임 더 유효)
+	CurrentBuffer ^= 1;
+	ResetBuffer(Buffers[CurrentBuffer]);
+}
+
+void FFrameArena::ResetBuffer(FBuffer& Buffer)
+{
+	if (Buffer.Chunks.IsEmpty())
+	{
+		return;
+	}
+
+	FChunk& Last = Buffer.Chunks.Last();
+	Last.Used = static_cast<SIZE_T>(Buffer.Cursor - Last.Data);
+
+	// 청크가 여러 개였으면 합친 크기의 청크 하나로 바꿔 다음부터는 빠른 경로만 타게 한다
+	if (Buffer.Chunks.Num() > 1)
+	{
+		SIZE_T TotalSize = 0;
+		for (FChunk& Chunk : Buffer.Chunks)
+		{
+			TotalSize += Chunk.Size;
+			FreeChunk(Chunk);
+		}
+		Buffer.Chunks.Empty();
+
+		FChunk Merged = AllocateChunk(TotalSize);
+		if (Merged.Data)
+		{
+#if MUNDI_FRAME_ARENA_POISON
+			Merged.Used = Merged.Size;
+#endif
+			Buffer.Chunks.Add(Merged);
+		}
+	}
+
+	if (Buffer.Chunks.IsEmpty())
+	{
+		Buffer.Cursor = Buffer.End = nullptr;
+		Buffer.UsedBytes = 0;
+		return;
+	}
+
+	FChunk& Chunk = Buffer.Chunks[0];
+#if MUNDI_FRAME_ARENA_POISON
+	memset(Chunk.Data, 0xDD, Chunk.Used);
+#endif
+	Chunk.Used = 0;
+	Buffer.Cursor = Chunk.Data;
+	Buffer.End = Chunk.Data + Chunk.Size;
+	Buffer.UsedBytes = 0;
+}
+
+SIZE_T FFrameArena::GetHighWaterBytes() const
+{
+	return std::max(HighWaterBytes, Buffers[CurrentBuffer].UsedBytes);
+}
+
+SIZE_T FFrameArena::GetReservedBytes() const
+{
+	SIZE_T Total = 0;
+	for (const FBuffer& Buffer : Buffers)
+	{
+		for (const FChunk& Chunk : Buffer.Chunks)
+		{
+			Total += Chunk.Size;
+		}
+	}
+	return Total;
+}
+
+FFrameArena::FChunk FFrameArena::AllocateChunk(SIZE_T Size)
+{
+	FChunk Chunk;
+	Chunk.Data = static_cast<uint8*>(_aligned_malloc(Size, ChunkAlignment));
+	Chunk.Size = Chunk.Data ? Size : 0;
+	return Chunk;
+}
+
+void FFrameArena::FreeChunk(FChunk& Chunk)
+{
+	_aligned_free(Chunk.Data);
+	Chunk.Data = nullptr;
+	Chunk.Size = 0;
+	Chunk.Used = 0;
+}
@@ -0,0 +1,115 @@
+﻿#pragma once
+#include <cstddef>
+#include "UEContainer.h"
+
+// 되돌린 프레임 버퍼를 0xDD로 채워 해제 후 사용을 드러낸다 (디버그 빌드 기본)
+#ifndef MUNDI_FRAME_ARENA_POISON
+	#ifdef _DEBUG
+		#define MUNDI_FRAME_ARENA_POISON 1
+	#else
+		#define MUNDI_FRAME_ARENA_POISON 0
+	#endif
+#endif
+
+/**
+ * 프레임 단위 선형 할당기 (렌더링 임시 데이터용, 메인 스레드 전용)
+ * - 버퍼 두 개를 번갈아 쓰며 EndFrame에서 다음 프레임 버퍼의 커서만 되돌린다 (개별 해제 없음)
+ *   한 프레임에서 받은 메모리는 다음 프레임이 끝날 때까지 유효
+ * - 청크가 모자라면 새 청크를 붙이고, 그 버퍼를 다시 쓸 때 전체 크기의 청크 하나로 합친다
+ */
+class FFrameArena
+{
+public:
+	static FFrameArena& Get();
+
+	FFrameArena() = default;
+	~FFrameArena();
+
+	FFrameArena(const FFrameArena&) = delete;
+	FFrameArena& operator=(const FFrameArena&) = delete;
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment)
+	{
+		FBuffer& Buffer = Buffers[CurrentBuffer];
+		const uintptr_t Aligned = (reinterpret_cast<uintptr_t>(Buffer.Cursor) + (Alignment - 1)) & ~(static_cast<uintptr_t>(Alignment) - 1);
+		if (Buffer.Cursor && Aligned + Size <= reinterpret_cast<uintptr_t>(Buffer.End))
+		{
+			uint8* Result = reinterpret_cast<uint8*>(Aligned);
+			Buffer.UsedBytes += (Result + Size) - Buffer.Cursor;
+			Buffer.Cursor = Result + Size;
+			return Result;
+		}
+		return AllocateSlow(Size, Alignment);
+	}
+
+	// 엔진 루프의 프레임 끝에서 호출 (URenderer::EndFrame). 다음 프레임 버퍼를 비운다
+	void EndFrame();
+
+	// 이번 프레임 / 직전 프레임 사용량, 지금까지 한 프레임의 최대 사용량
+	SIZE_T GetFrameBytes() const { return Buffers[CurrentBuffer].UsedBytes; }
+	SIZE_T GetLastFrameBytes() const { return LastFrameBytes; }
+	SIZE_T GetHighWaterBytes() const;
+	// 두 버퍼가 잡고 있는 청크 크기 합
+	SIZE_T GetReservedBytes() const;
+
+private:
+	static constexpr SIZE_T MinChunkSize = SIZE_T(256) << 10;
+	static constexpr SIZE_T ChunkAlignment = 64;
+
+	struct FChunk
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+		SIZE_T Used = 0;					// 청크를 떠날 때의 커서 위치 (독 채우기용)
+	};
+
+	struct FBuffer
+	{
+		TArray<FChunk> Chunks;
+		uint8* Cursor = nullptr;
+		uint8* End = nullptr;
+		SIZE_T UsedBytes = 0;				// 정렬 여백 포함
+	};
+
+	void* AllocateSlow(SIZE_T Size, SIZE_T Alignment);
+	void ResetBuffer(FBuffer& Buffer);
+	static FChunk AllocateChunk(SIZE_T Size);
+	static void FreeChunk(FChunk& Chunk);
+
+private:
+	FBuffer Buffers[2];
+	int32 CurrentBuffer = 0;
+	SIZE_T LastFrameBytes = 0;
+	SIZE_T HighWaterBytes = 0;
+};
+
+/**
+ * FFrameArena에서 할당하는 TArray 할당기 정책: TArray<T, TFrameAllocator<T>>
+ * - deallocate는 아무것도 하지 않으므로 크기를 알면 Reserve로 재할당 낭비를 줄인다
+ * - 프레임 경계를 넘겨 보관하면 안 된다 (FSceneRenderer처럼 한 프레임 안에서 생성/소멸하는 객체용)
+ */
+template<typename T>
+class TFrameAllocator
+{
+public:
+	using value_type = T;
+
+	TFrameAllocator() noexcept = default;
+	template<typename U>
+	TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+	T* allocate(SIZE_T Count)
+	{
+		return static_cast<T*>(FFrameArena::Get().Allocate(Count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, SIZE_T) noexcept {}
+
+	template<typename U>
+	bool operator==(const TFrameAllocator<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const TFrameAllocator<U>&) const noexcept { return false; }
+};
+
+template<typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
@@ -0,0 +1,98 @@
+﻿#include "pch.h"
+#include "MemStack.h"
+#include <malloc.h>
+#include <cassert>
+#include <algorithm>
+
+FMemStack& FMemStack::Get()
+{
+	thread_local FMemStack Stack;
+	return Stack;
+}
+
+FMemStack::~FMemStack()
+{
+	for (FChunk& Chunk : Chunks)
+	{
+		_aligned_free(Chunk.Data);
+	}
+	Chunks.Empty();
+}
+
+void* FMemStack::AllocateSlow(SIZE_T Size, SIZE_T Alignment)
+{
+	assert(NumMarks > 0 && "FMemStack: allocation outside of FMemMark");
+
+	const SIZE_T Needed = Size + Alignment;
+	const int32 NextChunk = CurrentChunk + 1;
+
+	// 다음 청크가 작으면 두 배 크기의 새 청크로 바꾼다 (비어 있으므로 버려도 된다)
+	if (NextChunk >= Chunks.Num() || Chunks[NextChunk].Size < Needed)
+	{
+		SIZE_T ChunkSize = CurrentChunk >= 0 ? Chunks[CurrentChunk].Size * 2 : MinChunkSize;
+		if (NextChunk < Chunks.Num())
+		{
+			ChunkSize = std::max(ChunkSize, Chunks[NextChunk].Size * 2);
+		}
+		ChunkSize = std::max(ChunkSize, Needed);
+
+		FChunk Chunk;
+		Chunk.Data = static_cast<uint8*>(_aligned_malloc(ChunkSize, ChunkAlignment));
+		if (!Chunk.Data)
+		{
+			return nullptr;
+		}
+		Chunk.Size = ChunkSize;
+
+		if (NextChunk < Chunks.Num())
+		{
+			_aligned_free(Chunks[NextChunk].Data);
+			Chunks[NextChunk] = Chunk;
+		}
+		else
+		{
+			Chunks.Add(Chunk);
+		}
+	}
+
+	CurrentChunk = NextChunk;
+	Cursor = Chunks[CurrentChunk].Data;
+	End = Cursor + Chunks[CurrentChunk].Size;
+	return Allocate(Size, Alignment);
+}
+
+void FMemStack::PopTo(int32 InChunk, uint8* InCursor)
+{
+	CurrentChunk = InChunk;
+	if (CurrentChunk < 0)
+	{
+		Cursor = End = nullptr;
+		return;
+	}
+	Cursor = InCursor;
+	End = Chunks[CurrentChunk].Data + Chunks[CurrentChunk].Size;
+}
+
+SIZE_T FMemStack::GetUsedBytes() const
+{
+	SIZE_T Total = 0;
+	for (int32 i = 0; i < CurrentChunk; ++i)
+	{
+		Total += Chunks[i].Size;
+	}
+	if (CurrentChunk >= 0)
+	{
+		Total += static_cast<SIZE_T>(Cursor - Chunks[CurrentChunk].Data);
+	}
+	return Total;
+}
+
+SIZE_T FMemStack::GetReservedBytes() const
+{
+	SIZE_T Total = 0;
+	for (const FChunk& Chunk : Chunks)
+	{
+		Total += Chunk.Size;
+	}
+	return Total;
+}
@@ -0,0 +1,117 @@
+﻿#pragma once
+#include <cstddef>
+#include "UEContainer.h"
+
+/**
+ * 스레드별 스택형 임시 할당기 (트리 탐색, 쿼리 중간 결과처럼 함수 안에서만 쓰는 데이터용)
+ * - FMemMark가 생성될 때 커서를 기억해 두고 소멸할 때 되돌린다 (개별 해제 없음)
+ * - 청크는 스레드가 끝날 때까지 재사용하므로 처음 크기가 잡힌 뒤에는 힙 할당이 없다
+ * - FMemMark 범위 밖으로 들고 나가거나 다른 스레드에 넘기면 안 된다
+ */
+class FMemStack
+{
+public:
+	// 호출한 스레드의 스택
+	static FMemStack& Get();
+
+	FMemStack() = default;
+	~FMemStack();
+
+	FMemStack(const FMemStack&) = delete;
+	FMemStack& operator=(const FMemStack&) = delete;
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment)
+	{
+		const uintptr_t Aligned = (reinterpret_cast<uintptr_t>(Cursor) + (Alignment - 1)) & ~(static_cast<uintptr_t>(Alignment) - 1);
+		if (Cursor && Aligned + Size <= reinterpret_cast<uintptr_t>(End))
+		{
+			Cursor = reinterpret_cast<uint8*>(Aligned) + Size;
+			return reinterpret_cast<void*>(Aligned);
+		}
+		return AllocateSlow(Size, Alignment);
+	}
+
+	// 현재 마크들이 잡고 있는 크기 / 청크 크기 합
+	SIZE_T GetUsedBytes() const;
+	SIZE_T GetReservedBytes() const;
+	int32 GetNumMarks() const { return NumMarks; }
+
+private:
+	friend class FMemMark;
+
+	static constexpr SIZE_T MinChunkSize = SIZE_T(64) << 10;
+	static constexpr SIZE_T ChunkAlignment = 64;
+
+	struct FChunk
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+	};
+
+	void* AllocateSlow(SIZE_T Size, SIZE_T Alignment);
+	void PopTo(int32 InChunk, uint8* InCursor);
+
+private:
+	// 현재 청크 뒤의 청크들은 비어 있고, 다음 AllocateSlow에서 다시 쓴다
+	TArray<FChunk> Chunks;
+	int32 CurrentChunk = -1;
+	uint8* Cursor = nullptr;
+	uint8* End = nullptr;
+	int32 NumMarks = 0;
+};
+
+/** 범위가 끝나면 FMemStack을 생성 시점으로 되돌린다 */
+class FMemMark
+{
+public:
+	explicit FMemMark(FMemStack& InStack)
+		: Stack(InStack), SavedChunk(InStack.CurrentChunk), SavedCursor(InStack.Cursor)
+	{
+		++Stack.NumMarks;
+	}
+
+	~FMemMark()
+	{
+		Stack.PopTo(SavedChunk, SavedCursor);
+		--Stack.NumMarks;
+	}
+
+	FMemMark(const FMemMark&) = delete;
+	FMemMark& operator=(const FMemMark&) = delete;
+
+private:
+	FMemStack& Stack;
+	int32 SavedChunk;
+	uint8* SavedCursor;
+};
+
+/**
+ * FMemStack에서 할당하는 TArray 할당기 정책: TArray<T, TMemStackAllocator<T>>
+ * - 배열은 자신을 감싸는 FMemMark보다 먼저 소멸해야 한다 (마크를 배열보다 먼저 선언)
+ * - deallocate는 아무것도 하지 않으므로 크기를 알면 Reserve로 재할당 낭비를 줄인다
+ */
+template<typename T>
+class TMemStackAllocator
+{
+public:
+	using value_type = T;
+
+	TMemStackAllocator() noexcept = default;
+	template<typename U>
+	TMemStackAllocator(const TMemStackAllocator<U>&) noexcept {}
+
+	T* allocate(SIZE_T Count)
+	{
+		return static_cast<T*>(FMemStack::Get().Allocate(Count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, SIZE_T) noexcept {}
+
+	template<typename U>
+	bool operator==(const TMemStackAllocator<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const TMemStackAllocator<U>&) const noexcept { return false; }
+};
+
+template<typename T>
+using TMemStackArray = TArray<T, TMemStackAllocator<T>>;
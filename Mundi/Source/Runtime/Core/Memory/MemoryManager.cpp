@@ -1,30 +1,337 @@
 ﻿#include "pch.h"
 #include "MemoryManager.h"
+#include "ParallelFor.h"
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <mutex>
+#include <new>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+std::atomic<uint64> FMemoryManager::TotalAllocationBytes{ 0 };
+std::atomic<uint64> FMemoryManager::TotalAllocationCount{ 0 };
 
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+namespace
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	constexpr SIZE_T SlabShift = 16;
+	constexpr SIZE_T SlabSize = SIZE_T(1) << SlabShift;				// 64KB
+	constexpr SIZE_T PoolReserveSize = SIZE_T(4) << 30;				// 주소 공간만 예약, 커밋은 슬랩 단위
+	constexpr uint32 NumSlabs = static_cast<uint32>(PoolReserveSize / SlabSize);
+	constexpr SIZE_T SmallAlignment = 16;
+	constexpr SIZE_T MaxSmallSize = 4096;
+	constexpr SIZE_T LargeHeaderSize = 2 * sizeof(SIZE_T);			// 요청 크기 + 헤더 오프셋
+
+	// 128까지는 16바이트 간격, 이후에는 2의 거듭제곱 구간마다 4등급 (내부 단편화 최대 25%)
+	constexpr uint32 ClassSizes[] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256, 320, 384, 448, 512,
+		640, 768, 896, 1024, 1280, 1536, 1792, 2048,
+		2560, 3072, 3584, 4096
+	};
+	constexpr int32 NumClasses = static_cast<int32>(sizeof(ClassSizes) / sizeof(ClassSizes[0]));
+	static_assert(NumClasses < 255, "SlabClass는 uint8");
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	// 중앙 풀의 등급 하나. 스레드 캐시와는 블록을 묶음 단위로만 주고받는다
+	struct FCentralBin
+	{
+		std::mutex Mutex;
+		FFreeBlock* FreeList = nullptr;
+		uint8* BumpCursor = nullptr;			// 현재 슬랩에서 아직 잘라내지 않은 영역
+		uint8* BumpEnd = nullptr;
+	};
+
+	struct FSlabPool
+	{
+		uint8* Base = nullptr;
+		std::atomic<uint32> NextSlab{ 0 };
+
+		// 슬랩 인덱스 -> 등급. 블록을 나눠주기 전에 기록되고 이후에는 읽기만 한다
+		uint8 SlabClass[NumSlabs] = {};
+		uint8 SizeToClass[MaxSmallSize / SmallAlignment + 1] = {};
+		int32 BatchSize[NumClasses] = {};
+		FCentralBin Bins[NumClasses];
+
+		FSlabPool()
+		{
+			Base = static_cast<uint8*>(VirtualAlloc(nullptr, PoolReserveSize, MEM_RESERVE, PAGE_READWRITE));
+
+			int32 ClassIndex = 0;
+			for (SIZE_T Slot = 0; Slot <= MaxSmallSize / SmallAlignment; ++Slot)
+			{
+				while (ClassSizes[ClassIndex] < Slot * SmallAlignment)
+				{
+					++ClassIndex;
+				}
+				SizeToClass[Slot] = static_cast<uint8>(ClassIndex);
+			}
+
+			// 한 번에 약 16KB씩 옮긴다 (작은 등급은 최대 64개, 큰 등급은 최소 4개)
+			for (int32 i = 0; i < NumClasses; ++i)
+			{
+				BatchSize[i] = std::clamp(static_cast<int32>(16384 / ClassSizes[i]), 4, 64);
+			}
+		}
+
+		bool Contains(const void* Ptr) const
+		{
+			const uintptr_t Address = reinterpret_cast<uintptr_t>(Ptr);
+			const uintptr_t Begin = reinterpret_cast<uintptr_t>(Base);
+			return Base && Address >= Begin && Address - Begin < PoolReserveSize;
+		}
+
+		uint8* CommitSlab(int32 ClassIndex)
+		{
+			if (!Base)
+			{
+				return nullptr;
+			}
+
+			uint32 Index = NextSlab.load(std::memory_order_relaxed);
+			do
+			{
+				if (Index >= NumSlabs)
+				{
+					return nullptr;
+				}
+			} while (!NextSlab.compare_exchange_weak(Index, Index + 1, std::memory_order_relaxed));
+
+			uint8* Slab = Base + static_cast<SIZE_T>(Index) * SlabSize;
+			if (!VirtualAlloc(Slab, SlabSize, MEM_COMMIT, PAGE_READWRITE))
+			{
+				return nullptr;
+			}
+			SlabClass[Index] = static_cast<uint8>(ClassIndex);
+			return Slab;
+		}
+
+		// 최대 Count개를 꺼내 연결 리스트로 반환
+		FFreeBlock* Fetch(int32 ClassIndex, int32 Count, int32& OutNum)
+		{
+			FCentralBin& Bin = Bins[ClassIndex];
+			const SIZE_T BlockSize = ClassSizes[ClassIndex];
+			std::lock_guard<std::mutex> Lock(Bin.Mutex);
+
+			FFreeBlock* Head = nullptr;
+			int32 Num = 0;
+			while (Num < Count && Bin.FreeList)
+			{
+				FFreeBlock* Block = Bin.FreeList;
+				Bin.FreeList = Block->Next;
+				Block->Next = Head;
+				Head = Block;
+				++Num;
+			}
+
+			while (Num < Count)
+			{
+				if (static_cast<SIZE_T>(Bin.BumpEnd - Bin.BumpCursor) < BlockSize)
+				{
+					uint8* Slab = CommitSlab(ClassIndex);
+					if (!Slab)
+					{
+						break;
+					}
+					Bin.BumpCursor = Slab;
+					Bin.BumpEnd = Slab + (SlabSize / BlockSize) * BlockSize;
+				}
+
+				FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Bin.BumpCursor);
+				Bin.BumpCursor += BlockSize;
+				Block->Next = Head;
+				Head = Block;
+				++Num;
+			}
+
+			OutNum = Num;
+			return Head;
+		}
+
+		void Release(int32 ClassIndex, FFreeBlock* Head, FFreeBlock* Tail)
+		{
+			FCentralBin& Bin = Bins[ClassIndex];
+			std::lock_guard<std::mutex> Lock(Bin.Mutex);
+			Tail->Next = Bin.FreeList;
+			Bin.FreeList = Head;
+		}
+	};
+
+	// 프로세스 종료 중(정적 소멸자, 스레드 종료)에도 해제가 들어오므로 소멸시키지 않는다
+	FSlabPool& GetPool()
+	{
+		static FSlabPool* Pool = new FSlabPool();
+		return *Pool;
+	}
+
+	// 스레드 종료 후의 해제는 캐시 없이 중앙 풀로 (trivial 타입이라 캐시 소멸 이후에도 읽을 수 있음)
+	thread_local bool bThreadCacheDestroyed = false;
+
+	// 스레드별 블록 캐시. 다른 스레드가 할당한 블록도 해제한 스레드의 캐시로 들어가고, 넘치면 중앙 풀로 돌아간다
+	struct FMemoryThreadCache
+	{
+		FFreeBlock* Lists[NumClasses] = {};
+		int32 Counts[NumClasses] = {};
+
+		~FMemoryThreadCache()
+		{
+			FSlabPool& Pool = GetPool();
+			for (int32 ClassIndex = 0; ClassIndex < NumClasses; ++ClassIndex)
+			{
+				if (FFreeBlock* Head = Lists[ClassIndex])
+				{
+					FFreeBlock* Tail = Head;
+					while (Tail->Next)
+					{
+						Tail = Tail->Next;
+					}
+					Pool.Release(ClassIndex, Head, Tail);
+				}
+			}
+			bThreadCacheDestroyed = true;
+		}
+	};
+
+	thread_local FMemoryThreadCache GThreadCache;
+
+	// 스레드 종료 후에는 nullptr
+	FMemoryThreadCache* GetThreadCache()
+	{
+		return bThreadCacheDestroyed ? nullptr : &GThreadCache;
+	}
+
+	void* AllocateSmall(int32 ClassIndex)
+	{
+		FSlabPool& Pool = GetPool();
+		FMemoryThreadCache* Cache = GetThreadCache();
+		int32 Num = 0;
+		if (!Cache)
+		{
+			return Pool.Fetch(ClassIndex, 1, Num);
+		}
+
+		if (!Cache->Lists[ClassIndex])
+		{
+			Cache->Lists[ClassIndex] = Pool.Fetch(ClassIndex, Pool.BatchSize[ClassIndex], Num);
+			Cache->Counts[ClassIndex] = Num;
+			if (Num == 0)
+			{
+				return nullptr;
+			}
+		}
+
+		FFreeBlock* Block = Cache->Lists[ClassIndex];
+		Cache->Lists[ClassIndex] = Block->Next;
+		--Cache->Counts[ClassIndex];
+		return Block;
+	}
+
+	void DeallocateSmall(void* Ptr, int32 ClassIndex)
+	{
+		FSlabPool& Pool = GetPool();
+		FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+		FMemoryThreadCache* Cache = GetThreadCache();
+		if (!Cache)
+		{
+			Pool.Release(ClassIndex, Block, Block);
+			return;
+		}
+
+		Block->Next = Cache->Lists[ClassIndex];
+		Cache->Lists[ClassIndex] = Block;
+
+		// 캐시가 묶음 두 개 분량을 넘으면 하나를 중앙 풀로 돌려준다 (다른 스레드가 재사용할 수 있도록)
+		const int32 Batch = Pool.BatchSize[ClassIndex];
+		if (++Cache->Counts[ClassIndex] > Batch * 2)
+		{
+			FFreeBlock* Head = Cache->Lists[ClassIndex];
+			FFreeBlock* Tail = Head;
+			for (int32 i = 1; i < Batch; ++i)
+			{
+				Tail = Tail->Next;
+			}
+			Cache->Lists[ClassIndex] = Tail->Next;
+			Cache->Counts[ClassIndex] -= Batch;
+			Pool.Release(ClassIndex, Head, Tail);
+		}
+	}
+
+	// [정렬 여백 | Size | HeaderOffset | User]
+	void* AllocateLarge(SIZE_T Size, SIZE_T Alignment)
+	{
+		const SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+		// 헤더 오프셋을 정렬의 배수로 맞춰야 User 포인터도 정렬된다
+		const SIZE_T HeaderOffset = std::max(FinalAlignment, LargeHeaderSize);
 
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+		void* Raw = _aligned_malloc_dbg(Size + HeaderOffset, FinalAlignment, nullptr, 0);
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+		void* Raw = _aligned_malloc(Size + HeaderOffset, FinalAlignment);
 #endif
-	if (!Raw)
-		return nullptr;
+		if (!Raw)
+			return nullptr;
+
+		unsigned char* UserPtr = static_cast<unsigned char*>(Raw) + HeaderOffset;
+		SIZE_T* Header = reinterpret_cast<SIZE_T*>(UserPtr) - 2;
+		Header[0] = Size;
+		Header[1] = HeaderOffset;
+		return UserPtr;
+	}
+
+	SIZE_T DeallocateLarge(void* Ptr)
+	{
+		const SIZE_T* Header = static_cast<const SIZE_T*>(Ptr) - 2;
+		const SIZE_T Size = Header[0];
+		void* Raw = static_cast<unsigned char*>(Ptr) - Header[1];
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+		_aligned_free_dbg(Raw);
+#else
+		_aligned_free(Raw);
+#endif
+		return Size;
+	}
+
+	struct FClassTracker
+	{
+		std::mutex Mutex;
+		TMap<const UClass*, FClassAllocationStats> Stats;
+	};
+
+	FClassTracker& GetClassTracker()
+	{
+		static FClassTracker* Tracker = new FClassTracker();
+		return *Tracker;
+	}
+}
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	if (Size == 0)
+		Size = 1;
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	if (Size <= MaxSmallSize && Alignment <= SmallAlignment)
+	{
+		const int32 ClassIndex = GetPool().SizeToClass[(Size + SmallAlignment - 1) / SmallAlignment];
+		if (void* Block = AllocateSmall(ClassIndex))
+		{
+			TotalAllocationBytes.fetch_add(ClassSizes[ClassIndex], std::memory_order_relaxed);
+			TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+			return Block;
+		}
+		// 예약 공간을 다 썼거나 커밋 실패 -> 대형 블록으로
+	}
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	void* Ptr = AllocateLarge(Size, Alignment);
+	if (Ptr)
+	{
+		TotalAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+		TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	return Ptr;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +339,314 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	FSlabPool& Pool = GetPool();
+	SIZE_T Size = 0;
+	if (Pool.Contains(Ptr))
+	{
+		const SIZE_T SlabIndex = static_cast<SIZE_T>(static_cast<uint8*>(Ptr) - Pool.Base) >> SlabShift;
+		const int32 ClassIndex = Pool.SlabClass[SlabIndex];
+		Size = ClassSizes[ClassIndex];
+		DeallocateSmall(Ptr, ClassIndex);
+	}
+	else
+	{
+		Size = DeallocateLarge(Ptr);
+	}
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	TotalAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
+	TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
+void FMemoryManager::TrackObjectAllocation(const UClass* Class)
+{
+	if (!Class)
+		return;
+
+	FClassTracker& Tracker = GetClassTracker();
+	std::lock_guard<std::mutex> Lock(Tracker.Mutex);
+	FClassAllocationStats& Stats = Tracker.Stats[Class];
+	Stats.Class = Class;
+	Stats.LiveCount++;
+	Stats.LiveBytes += Class->Size;
+	Stats.TotalCount++;
+}
+
+void FMemoryManager::TrackObjectDeallocation(const UClass* Class)
+{
+	if (!Class)
+		return;
+
+	FClassTracker& Tracker = GetClassTracker();
+	std::lock_guard<std::mutex> Lock(Tracker.Mutex);
+	FClassAllocationStats* Stats = Tracker.Stats.Find(Class);
+	if (Stats && Stats->LiveCount > 0)
+	{
+		Stats->LiveCount--;
+		Stats->LiveBytes -= Class->Size;
+	}
+}
+
+void FMemoryManager::GetClassAllocationStats(TArray<FClassAllocationStats>& OutStats)
+{
+	OutStats.Empty();
+	{
+		FClassTracker& Tracker = GetClassTracker();
+		std::lock_guard<std::mutex> Lock(Tracker.Mutex);
+		OutStats.Reserve(Tracker.Stats.Num());
+		for (const auto& Pair : Tracker.Stats)
+		{
+			OutStats.Add(Pair.second);
+		}
+	}
+
+	std::sort(OutStats.begin(), OutStats.end(), [](const FClassAllocationStats& A, const FClassAllocationStats& B)
+	{
+		return A.LiveBytes > B.LiveBytes;
+	});
+}
+
+uint64 FMemoryManager::GetTotalAllocationBytes()
+{
+	return TotalAllocationBytes.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetTotalAllocationCount()
+{
+	return TotalAllocationCount.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetPoolCommittedBytes()
+{
+	const uint32 UsedSlabs = std::min(GetPool().NextSlab.load(std::memory_order_relaxed), NumSlabs);
+	return static_cast<uint64>(UsedSlabs) * SlabSize;
+}
+
+void FMemoryManager::RunBenchmark(int32 NumAllocations, int32 NumRounds)
+{
+	if (NumAllocations <= 0 || NumRounds <= 0)
+	{
+		UE_LOG("[Memory] Benchmark: invalid arguments");
+		return;
+	}
+
+	// 등록된 UClass 크기를 섞어서 실제 객체 분포를 흉내내고, 생성 순서와 다른 순서로 해제
+	TArray<SIZE_T> ClassSizeSamples;
+	for (UClass* Class : UClass::GetAllClasses())
+	{
+		if (Class && Class->Size > 0)
+		{
+			ClassSizeSamples.Add(Class->Size);
+		}
+	}
+	if (ClassSizeSamples.IsEmpty())
+	{
+		ClassSizeSamples.Add(256);
+	}
+
+	TArray<SIZE_T> Sizes;
+	TArray<int32> FreeOrder;
+	Sizes.SetNum(NumAllocations);
+	FreeOrder.SetNum(NumAllocations);
+	uint32 Seed = 12345u;
+	auto NextRandom = [&Seed]()
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed >> 8;
+	};
+	for (int32 i = 0; i < NumAllocations; ++i)
+	{
+		Sizes[i] = ClassSizeSamples[NextRandom() % ClassSizeSamples.Num()];
+		FreeOrder[i] = i;
+	}
+	for (int32 i = NumAllocations - 1; i > 0; --i)
+	{
+		std::swap(FreeOrder[i], FreeOrder[NextRandom() % (i + 1)]);
+	}
+
+	// 기존 경로: 매 할당마다 _aligned_malloc + 8바이트 크기 헤더
+	auto LegacyAllocate = [](SIZE_T Size) -> void*
+	{
+		void* Raw = _aligned_malloc(Size + sizeof(SIZE_T), alignof(std::max_align_t));
+		*static_cast<SIZE_T*>(Raw) = Size;
+		return static_cast<unsigned char*>(Raw) + sizeof(SIZE_T);
+	};
+	auto LegacyDeallocate = [](void* Ptr)
+	{
+		_aligned_free(static_cast<unsigned char*>(Ptr) - sizeof(SIZE_T));
+	};
+
+	auto RunRounds = [&](bool bPool, TArray<void*>& Ptrs)
+	{
+		Ptrs.SetNum(NumAllocations);
+		for (int32 Round = 0; Round < NumRounds; ++Round)
+		{
+			for (int32 i = 0; i < NumAllocations; ++i)
+			{
+				Ptrs[i] = bPool ? Allocate(Sizes[i], alignof(std::max_align_t)) : LegacyAllocate(Sizes[i]);
+				*static_cast<uint8*>(Ptrs[i]) = static_cast<uint8>(i);
+			}
+			for (int32 i = 0; i < NumAllocations; ++i)
+			{
+				void* Ptr = Ptrs[FreeOrder[i]];
+				if (bPool)
+					Deallocate(Ptr);
+				else
+					LegacyDeallocate(Ptr);
+			}
+		}
+	};
+
+	const int32 NumThreads = FWorkerPool::GetInstance().GetConcurrency();
+	auto Measure = [&](bool bPool, int32 Threads) -> double
+	{
+		TArray<TArray<void*>> PtrsPerThread;
+		PtrsPerThread.SetNum(Threads);
+		const uint64 Start = FPlatformTime::Cycles64();
+		if (Threads == 1)
+		{
+			RunRounds(bPool, PtrsPerThread[0]);
+		}
+		else
+		{
+			ParallelFor(Threads, 1, [&](int32 Begin, int32 End)
+			{
+				for (int32 t = Begin; t < End; ++t)
+				{
+					RunRounds(bPool, PtrsPerThread[t]);
+				}
+			});
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	};
+
+	// 첫 실행의 슬랩 커밋/페이지 폴트가 섞이지 않도록 한 번 돌려둔다
+	Measure(true, 1);
+
+	const double OpsPerThread = static_cast<double>(NumAllocations) * NumRounds;
+	const double LegacySingleMS = Measure(false, 1);
+	const double PoolSingleMS = Measure(true, 1);
+	const double LegacyMultiMS = Measure(false, NumThreads);
+	const double PoolMultiMS = Measure(true, NumThreads);
+	auto MOpsPerSecond = [](double Ops, double MS) { return MS > 0.0 ? Ops / (MS * 1000.0) : 0.0; };
+
+	UE_LOG("[Memory] Benchmark: %d allocations x %d rounds, %d class sizes", NumAllocations, NumRounds, ClassSizeSamples.Num());
+	UE_LOG("[Memory]   1 thread : legacy %.2f ms (%.2f M alloc+free/s), pool %.2f ms (%.2f M/s, %.1fx)",
+		LegacySingleMS, MOpsPerSecond(OpsPerThread, LegacySingleMS),
+		PoolSingleMS, MOpsPerSecond(OpsPerThread, PoolSingleMS), PoolSingleMS > 0.0 ? LegacySingleMS / PoolSingleMS : 0.0);
+	UE_LOG("[Memory]   %d threads: legacy %.2f ms (%.2f M alloc+free/s), pool %.2f ms (%.2f M/s, %.1fx)", NumThreads,
+		LegacyMultiMS, MOpsPerSecond(OpsPerThread * NumThreads, LegacyMultiMS),
+		PoolMultiMS, MOpsPerSecond(OpsPerThread * NumThreads, PoolMultiMS), PoolMultiMS > 0.0 ? LegacyMultiMS / PoolMultiMS : 0.0);
+	UE_LOG("[Memory]   pool committed %.1f MB", static_cast<double>(GetPoolCommittedBytes()) / (1024.0 * 1024.0));
+}
+
+#if MUNDI_TRACK_HEAP_ALLOCATIONS
+namespace
+{
+	// 상수 초기화되는 POD라 스레드 시작/종료 중의 operator new에서도 안전하게 접근할 수 있다
+	thread_local uint64 GThreadHeapAllocationCount = 0;
+
+	void* TrackedHeapAllocate(SIZE_T Size)
+	{
+		++GThreadHeapAllocationCount;
+		for (;;)
+		{
+			if (void* Ptr = malloc(Size ? Size : 1))
+			{
+				return Ptr;
+			}
+			std::new_handler Handler = std::get_new_handler();
+			if (!Handler)
+			{
+				return nullptr;
+			}
+			Handler();
+		}
+	}
+
+	void* TrackedHeapAllocateAligned(SIZE_T Size, std::align_val_t Alignment)
+	{
+		++GThreadHeapAllocationCount;
+		for (;;)
+		{
+			if (void* Ptr = _aligned_malloc(Size ? Size : 1, static_cast<SIZE_T>(Alignment)))
+			{
+				return Ptr;
+			}
+			std::new_handler Handler = std::get_new_handler();
+			if (!Handler)
+			{
+				return nullptr;
+			}
+			Handler();
+		}
+	}
+}
+
+uint64 FMemoryManager::GetThreadHeapAllocationCount()
+{
+	return GThreadHeapAllocationCount;
+}
+
+// 기본 구현과 같은 malloc/_aligned_malloc을 쓰므로 교체 전에 할당된 블록과 섞여도 문제없다
+void* operator new(SIZE_T Size)
+{
+	if (void* Ptr = TrackedHeapAllocate(Size)) return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new[](SIZE_T Size)
+{
+	if (void* Ptr = TrackedHeapAllocate(Size)) return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new(SIZE_T Size, const std::nothrow_t&) noexcept
+{
+	return TrackedHeapAllocate(Size);
+}
+
+void* operator new[](SIZE_T Size, const std::nothrow_t&) noexcept
+{
+	return TrackedHeapAllocate(Size);
+}
+
+void* operator new(SIZE_T Size, std::align_val_t Alignment)
+{
+	if (void* Ptr = TrackedHeapAllocateAligned(Size, Alignment)) return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new[](SIZE_T Size, std::align_val_t Alignment)
+{
+	if (void* Ptr = TrackedHeapAllocateAligned(Size, Alignment)) return Ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new(SIZE_T Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept
+{
+	return TrackedHeapAllocateAligned(Size, Alignment);
+}
+
+void* operator new[](SIZE_T Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept
+{
+	return TrackedHeapAllocateAligned(Size, Alignment);
+}
+
+void operator delete(void* Ptr) noexcept { free(Ptr); }
+void operator delete[](void* Ptr) noexcept { free(Ptr); }
+void operator delete(void* Ptr, SIZE_T) noexcept { free(Ptr); }
+void operator delete[](void* Ptr, SIZE_T) noexcept { free(Ptr); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { free(Ptr); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { free(Ptr); }
+void operator delete(void* Ptr, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete(void* Ptr, SIZE_T, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete[](void* Ptr, SIZE_T, std::align_val_t) noexcept { _aligned_free(Ptr); }
+void operator delete(void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { _aligned_free(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { _aligned_free(Ptr); }
 #else
-	_aligned_free(Raw);
+uint64 FMemoryManager::GetThreadHeapAllocationCount()
+{
+	return 0;
+}
 #endif
-}
\ No newline at end of file
@@ -1,7 +1,34 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+// 전역 operator new/delete를 교체해 스레드별 힙 할당 횟수를 센다 (무할당 경로 회귀 검사용, 콘솔 BVH ALLOCTEST)
+// 할당 검사용 빌드에서만 PreprocessorDefinitions에 MUNDI_TRACK_HEAP_ALLOCATIONS=1을 넣어 켠다
+// 기본 빌드(Debug의 _CRTDBG_LEAK_CHECK_DF 포함)는 CRT 할당기를 그대로 쓴다
+#ifndef MUNDI_TRACK_HEAP_ALLOCATIONS
+	#define MUNDI_TRACK_HEAP_ALLOCATIONS 0
+#endif
+
+struct UClass;
+
+// UClass별 객체 할당 통계 (ObjectFactory의 생성/삭제 기준, 크기는 UClass::Size)
+struct FClassAllocationStats
+{
+	const UClass* Class = nullptr;
+	uint64 LiveCount = 0;
+	uint64 LiveBytes = 0;
+	uint64 TotalCount = 0;		// 누적 생성 수
+};
+
+/**
+ * UObject 메모리 할당기
+ * - 4KB 이하, 16바이트 이하 정렬 요청은 크기 등급별 슬랩 풀에서 할당 (블록 헤더 없음)
+ *   예약해 둔 주소 공간을 64KB 슬랩 단위로 커밋하고, 슬랩 인덱스로 크기 등급을 찾는다
+ * - 스레드별 캐시에서 먼저 꺼내고, 비거나 넘치면 등급 단위로 묶어서 중앙 풀과 주고받는다
+ * - 그 외 요청은 _aligned_malloc 대형 블록 (크기/오프셋 헤더 포함)
+ * - 슬랩은 OS에 반환하지 않고 같은 등급에서 재사용한다
+ */
 class FMemoryManager
 {
 public:
@@ -9,7 +36,28 @@ public:
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
-public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	// ObjectFactory에서 객체 생성/삭제 시 호출
+	static void TrackObjectAllocation(const UClass* Class);
+	static void TrackObjectDeallocation(const UClass* Class);
+	// LiveBytes 내림차순
+	static void GetClassAllocationStats(TArray<FClassAllocationStats>& OutStats);
+
+	// 현재 할당된 블록 크기 합 / 개수 (슬랩 풀은 등급 크기, 대형 블록은 요청 크기 기준)
+	static uint64 GetTotalAllocationBytes();
+	static uint64 GetTotalAllocationCount();
+
+	// 슬랩 풀이 커밋한 메모리 (사용 중 + 캐시된 블록 포함)
+	static uint64 GetPoolCommittedBytes();
+
+	// 호출한 스레드에서 지금까지 전역 operator new가 불린 횟수 (추적을 끄면 항상 0)
+	// 디버그 반복자(_ITERATOR_DEBUG_LEVEL)가 켜져 있으면 컨테이너마다 프록시 할당이 더해진다
+	static uint64 GetThreadHeapAllocationCount();
+
+	// 슬랩 풀과 기존 _aligned_malloc 경로의 할당/해제 처리량 비교 (콘솔 MEMORY BENCH)
+	static void RunBenchmark(int32 NumAllocations, int32 NumRounds);
+
+private:
+	// 모든 스레드가 함께 갱신 (통계용이라 relaxed)
+	static std::atomic<uint64> TotalAllocationBytes;
+	static std::atomic<uint64> TotalAllocationCount;
+};
@@ -2,45 +2,48 @@
 #include "pch.h"
 #include "PlatformTime.h"
 
-TMap<FString, FTimeProfile> TimeProfileMap;
-//Map에 이미 있으면 시간, 콜스택 추가
-void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMilliseconds)
-{
-	if (TimeProfileMap.Contains(Key.Key) == false)
-	{
-		TimeProfileMap[Key.Key] = FTimeProfile{ InMilliseconds, 1 };
-	}
-	else
-	{
-		TimeProfileMap[Key.Key].Milliseconds += InMilliseconds;
-		TimeProfileMap[Key.Key].CallCount++;
-	}
-}
-//시간, 콜스택 초기화
+//스탯 누적 초기화
 void FScopeCycleCounter::TimeProfileInit()
 {
-	const TArray<FString> Keys = TimeProfileMap.GetKeys();
-	for (const FString& Key : Keys)
-	{
-		TimeProfileMap[Key].Milliseconds = 0;
-		TimeProfileMap[Key].CallCount = 0;
-	}
+	FProfiler::ResetStats();
 }
-//const TMap<FString, FTimeProfile>& FScopeCycleCounter::GetTimeProfiles()
-//{
-//    return TimeProfileMap;
-//}
 const TArray<FString> FScopeCycleCounter::GetTimeProfileKeys()
 {
-	return TimeProfileMap.GetKeys();
+	TArray<FString> Keys;
+	const uint32 NumStats = FProfiler::GetNumStats();
+	for (uint32 Index = 0; Index < NumStats; ++Index)
+	{
+		FTimeProfile Profile;
+		FProfiler::GetStatTime(Index, Profile.Milliseconds, Profile.CallCount);
+		if (Profile.CallCount > 0)
+		{
+			Keys.Add(FProfiler::GetStatName(Index));
+		}
+	}
+	return Keys;
 }
 const TArray<FTimeProfile> FScopeCycleCounter::GetTimeProfileValues()
 {
-	return TimeProfileMap.GetValues();
+	TArray<FTimeProfile> Values;
+	const uint32 NumStats = FProfiler::GetNumStats();
+	for (uint32 Index = 0; Index < NumStats; ++Index)
+	{
+		FTimeProfile Profile;
+		FProfiler::GetStatTime(Index, Profile.Milliseconds, Profile.CallCount);
+		if (Profile.CallCount > 0)
+		{
+			Values.Add(Profile);
+		}
+	}
+	return Values;
 }
-const FTimeProfile& FScopeCycleCounter::GetTimeProfile(const FString& Key)
+FTimeProfile FScopeCycleCounter::GetTimeProfile(const FString& Key)
 {
-	return TimeProfileMap[Key];
+	FTimeProfile Profile;
+	FProfiler::GetStatTime(FProfiler::FindStat(Key), Profile.Milliseconds, Profile.CallCount);
+	return Profile;
 }
+#ifdef _WIN32
 double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
 bool FWindowsPlatformTime::bInitialized = false;
+#endif
@@ -1,8 +1,10 @@
 ﻿#pragma once
+#include "Profiler.h"
 
-
+// 현재 스코프 단위로 측정 (스탯 ID는 처음 한 번만 등록)
 #define TIME_PROFILE(Key)\
-FScopeCycleCounter Key##Counter(#Key); //현재 스코프 단위로 측정
+static const TStatId Key##StatId(#Key);\
+FScopeCycleCounter Key##Counter(Key##StatId);
 
 
 #define TIME_PROFILE_END(Key)\
@@ -10,7 +12,7 @@ Key##Counter.Finish();
 
 
 
-
+#ifdef _WIN32
 class FWindowsPlatformTime
 {
 public:
@@ -63,68 +65,100 @@ public:
 	}
 };
 
-struct TStatId
+typedef FWindowsPlatformTime FPlatformTime;
+#else
+#include <chrono>
+
+// Windows 외 플랫폼 (steady_clock, 나노초 단위)
+class FGenericPlatformTime
 {
-	FString Key;
-	TStatId() = default;
-	TStatId(const FString& InKey) : Key(InKey) {}
+public:
+	static double GetSecondsPerCycle()
+	{
+		return static_cast<double>(std::chrono::steady_clock::period::num) / static_cast<double>(std::chrono::steady_clock::period::den);
+	}
+	static uint64 GetFrequency()
+	{
+		return static_cast<uint64>(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+	}
+	static double ToMilliseconds(uint64 CycleDiff)
+	{
+		return static_cast<double>(CycleDiff) * GetSecondsPerCycle() * 1000.0;
+	}
+
+	static uint64 Cycles64()
+	{
+		return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+	}
 };
+
+typedef FGenericPlatformTime FPlatformTime;
+#endif
+
 struct FTimeProfile
 {
-	double Milliseconds;
-	uint32 CallCount;
+	double Milliseconds = 0.0;
+	uint32 CallCount = 0;
 
+	// 반환 버퍼는 스레드마다 따로 (다음 호출 전까지 유효)
 	const char* GetConstChar() const
 	{
-		static char buffer[64]; // static으로 해야 반환 가능
-		sprintf_s(buffer, sizeof(buffer), " : %.3fms, Call : %d", Milliseconds, CallCount);
+		thread_local char buffer[64];
+		snprintf(buffer, sizeof(buffer), " : %.3fms, Call : %u", Milliseconds, CallCount);
 		return buffer;
 	}
 
 	const wchar_t* GetConstWChar_t() const
 	{
-		static wchar_t buffer[64];
-		swprintf_s(buffer, _countof(buffer), L" : %.3fms, Call : %d", Milliseconds, CallCount);
+		thread_local wchar_t buffer[64];
+		swprintf(buffer, sizeof(buffer) / sizeof(buffer[0]), L" : %.3fms, Call : %u", Milliseconds, CallCount);
 		return buffer;
 	}
 
 	const char* GetConstCharWithKey(const FString& Key) const
 	{
-		static char buffer[64]; // static으로 해야 반환 가능
-		sprintf_s(buffer, sizeof(buffer), "%s : %.3fms, Call : %d", Key.c_str(), Milliseconds, CallCount);
+		thread_local char buffer[128];
+		snprintf(buffer, sizeof(buffer), "%s : %.3fms, Call : %u", Key.c_str(), Milliseconds, CallCount);
 		return buffer;
 	}
 
 	const wchar_t* GetConstWChar_tWithKey(const FString& Key) const
 	{
-		static wchar_t buffer[64];
-
-		swprintf_s(buffer, _countof(buffer), L"%s : %.3fms, Call : %d", std::wstring(Key.begin(), Key.end()).c_str(), Milliseconds, CallCount);
+		thread_local wchar_t buffer[128];
+		swprintf(buffer, sizeof(buffer) / sizeof(buffer[0]), L"%ls : %.3fms, Call : %u", std::wstring(Key.begin(), Key.end()).c_str(), Milliseconds, CallCount);
 		return buffer;
 	}
 };
 
-typedef FWindowsPlatformTime FPlatformTime;
-
+/**
+ * 기존 스코프 측정 인터페이스 (FProfiler 위의 얇은 래퍼)
+ * - 스탯이 있으면 FProfiler 스코프로 기록되어 계층/트레이스/스레드별 합산에 포함된다
+ * - 스탯 없이 만들면 경과 시간만 재는 스톱워치
+ */
 class FScopeCycleCounter
 {
 public:
 	FScopeCycleCounter(TStatId StatId)
-		: StartCycles(FPlatformTime::Cycles64()) //생성 시 사이클 저장
-		, UsedStatId(StatId) //키값 저장
+		: UsedStatId(StatId) //키값 저장
 	{
+		if (UsedStatId.IsValid())
+		{
+			FProfiler::BeginScope();
+		}
+		StartTicks = FProfiler::Now(); //생성 시 타임스탬프 저장
 	}
-	FScopeCycleCounter() : StartCycles(FPlatformTime::Cycles64()), UsedStatId()
+	FScopeCycleCounter() : FScopeCycleCounter(TStatId())
 	{
 	}
 
-	FScopeCycleCounter(const FString& Key) : StartCycles(FPlatformTime::Cycles64()), UsedStatId(TStatId(Key))
+	// 문자열 키는 생성할 때마다 스탯을 조회한다 (반복 측정은 TIME_PROFILE 사용)
+	FScopeCycleCounter(const FString& Key) : FScopeCycleCounter(TStatId(Key))
 	{
 	}
 
 	~FScopeCycleCounter()
 	{
-		Finish(); //소멸 시 현재 사이클 구해서 현재 - 생성 사이클로 시간 측정
+		Finish(); //소멸 시 현재 - 생성 타임스탬프로 시간 측정
 	}
 
 	double Finish()
@@ -134,29 +168,24 @@ public:
 			return 0;
 		}
 		bIsFinish = true;
-		const uint64 EndCycles = FPlatformTime::Cycles64();
-		const uint64 CycleDiff = EndCycles - StartCycles;
-
-		double Milliseconds = FWindowsPlatformTime::ToMilliseconds(CycleDiff);
-		if (UsedStatId.Key.empty() == false)
+		const uint64 EndTicks = FProfiler::Now();
+		if (UsedStatId.IsValid())
 		{
-			AddTimeProfile(UsedStatId, Milliseconds); //키 값이 있을경우 Map에 저장
+			FProfiler::EndScope(UsedStatId.Index, StartTicks, EndTicks);
 		}
-		return Milliseconds;
+		return FProfiler::TicksToMilliseconds(EndTicks - StartTicks);
 	}
 
-	static void AddTimeProfile(const TStatId& Key, double InMilliseconds);
+	// 스탯 누적을 비운다 (프레임 경계에서는 FProfiler::EndFrame이 자동으로 처리)
 	static void TimeProfileInit();
 
-	//이거 왜 안됨?
-	//static const TMap<FString, FTimeProfile>& GetTimeProfiles();
-
+	// 현재 프레임에 한 번 이상 기록된 스탯 (모든 스레드 합산)
 	static const TArray<FString> GetTimeProfileKeys();
 	static const TArray<FTimeProfile> GetTimeProfileValues();
-	static const FTimeProfile& GetTimeProfile(const FString& Key);
+	static FTimeProfile GetTimeProfile(const FString& Key);
 private:
 	bool bIsFinish = false;
-	uint64 StartCycles;
+	uint64 StartTicks;
 	TStatId UsedStatId;
 
 };
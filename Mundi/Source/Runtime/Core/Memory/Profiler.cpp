@@ -0,0 +1,566 @@
+﻿#include "pch.h"
+#include "Profiler.h"
+#include "PlatformTime.h"
+#include <mutex>
+#include <cstdarg>
+
+std::atomic<uint32> FProfiler::StatEpoch{ 1 };
+std::atomic<bool> FProfiler::bCapturing{ false };
+std::atomic<uint32> FProfiler::CaptureId{ 0 };
+std::atomic<uint64> FProfiler::FrameNumber{ 0 };
+
+namespace
+{
+	// 스탯 이름은 등록 후 바뀌지 않으므로 고정 배열에 두고 c_str를 그대로 넘긴다
+	struct FStatRegistry
+	{
+		std::mutex Mutex;
+		FString Names[FProfilerThreadState::MaxStats];
+		TMap<FString, uint32> NameToIndex;
+		std::atomic<uint32> NumStats{ 0 };
+		bool bOverflowLogged = false;
+	};
+
+	// 종료된 스레드의 상태도 트레이스에 남아야 하므로 해제하지 않는다
+	struct FThreadRegistry
+	{
+		std::mutex Mutex;
+		TArray<FProfilerThreadState*> States;
+	};
+
+	FStatRegistry& GetStatRegistry()
+	{
+		static FStatRegistry Registry;
+		return Registry;
+	}
+
+	FThreadRegistry& GetThreadRegistry()
+	{
+		static FThreadRegistry Registry;
+		return Registry;
+	}
+
+	// 캡처 상태 (BeginCapture/EndCapture/EndFrame은 게임 스레드에서만 호출)
+	FString GCapturePath;
+	int32 GCaptureFramesRemaining = 0;
+	uint64 GCaptureStartTicks = 0;
+	uint64 GCaptureStartFrame = 0;
+	uint64 GFrameStartTicks = 0;
+
+	// 스탯 인덱스별 누적 (BeginStatHistory ~ EndStatHistory, 게임 스레드 전용)
+	bool bGStatHistory = false;
+	TArray<FProfilerStatSummary> GStatHistory;
+
+	// rdtsc 보정 기준점 (프로그램 시작 시각)
+	const uint64 GCalibrationTicks = FProfiler::Now();
+	const uint64 GCalibrationCycles = FPlatformTime::Cycles64();
+
+	void AppendJsonString(std::string& Out, const char* Str)
+	{
+		Out += '"';
+		for (const char* C = Str; *C; ++C)
+		{
+			const unsigned char Ch = static_cast<unsigned char>(*C);
+			if (Ch == '"' || Ch == '\\')
+			{
+				Out += '\\';
+				Out += *C;
+			}
+			else if (Ch < 0x20)
+			{
+				char Escaped[8];
+				snprintf(Escaped, sizeof(Escaped), "\\u%04x", Ch);
+				Out += Escaped;
+			}
+			else
+			{
+				Out += *C;
+			}
+		}
+		Out += '"';
+	}
+
+	void AppendFormat(std::string& Out, const char* Format, ...)
+	{
+		char Buffer[256];
+		va_list Args;
+		va_start(Args, Format);
+		const int Length = vsnprintf(Buffer, sizeof(Buffer), Format, Args);
+		va_end(Args);
+		if (Length > 0)
+		{
+			Out.append(Buffer, Length < static_cast<int>(sizeof(Buffer)) ? Length : sizeof(Buffer) - 1);
+		}
+	}
+}
+
+// 빈 이름은 등록하지 않는다 (기록하지 않는 FScopeCycleCounter)
+TStatId::TStatId(const char* InName)
+{
+	if (InName && InName[0] != '\0')
+	{
+		Index = FProfiler::RegisterStat(InName);
+	}
+}
+
+TStatId::TStatId(const FString& InName)
+{
+	if (!InName.empty())
+	{
+		Index = FProfiler::RegisterStat(InName);
+	}
+}
+
+double FProfiler::GetSecondsPerTick()
+{
+#if MUNDI_PROFILER_RDTSC
+	// 시작 시점과 처음 호출한 시점의 rdtsc/FPlatformTime 차이로 한 번만 보정
+	// 너무 이르면 오차가 크므로 기준점에서 최소 50ms가 지날 때까지 기다린다
+	static const double SecondsPerTick = []()
+	{
+		const double SecondsPerCycle = FPlatformTime::ToMilliseconds(1) / 1000.0;
+		uint64 Ticks = Now();
+		uint64 Cycles = FPlatformTime::Cycles64();
+		while (static_cast<double>(Cycles - GCalibrationCycles) * SecondsPerCycle < 0.05)
+		{
+			Ticks = Now();
+			Cycles = FPlatformTime::Cycles64();
+		}
+		const double ElapsedSeconds = static_cast<double>(Cycles - GCalibrationCycles) * SecondsPerCycle;
+		const uint64 ElapsedTicks = Ticks - GCalibrationTicks;
+		return ElapsedTicks > 0 ? ElapsedSeconds / static_cast<double>(ElapsedTicks) : SecondsPerCycle;
+	}();
+	return SecondsPerTick;
+#else
+	return static_cast<double>(std::chrono::steady_clock::period::num) / static_cast<double>(std::chrono::steady_clock::period::den);
+#endif
+}
+
+uint32 FProfiler::RegisterStat(const char* Name)
+{
+	return RegisterStat(FString(Name ? Name : ""));
+}
+
+uint32 FProfiler::RegisterStat(const FString& Name)
+{
+	FStatRegistry& Registry = GetStatRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+
+	if (const uint32* Found = Registry.NameToIndex.Find(Name))
+	{
+		return *Found;
+	}
+
+	const uint32 Index = Registry.NumStats.load(std::memory_order_relaxed);
+	if (Index >= FProfilerThreadState::MaxStats)
+	{
+		if (!Registry.bOverflowLogged)
+		{
+			Registry.bOverflowLogged = true;
+			UE_LOG("[Profiler] Stat limit (%u) reached, '%s' is not tracked", FProfilerThreadState::MaxStats, Name.c_str());
+		}
+		return TStatId::InvalidIndex;
+	}
+
+	Registry.Names[Index] = Name;
+	Registry.NameToIndex.Add(Name, Index);
+	Registry.NumStats.store(Index + 1, std::memory_order_release);
+	return Index;
+}
+
+uint32 FProfiler::FindStat(const FString& Name)
+{
+	FStatRegistry& Registry = GetStatRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+
+	const uint32* Found = Registry.NameToIndex.Find(Name);
+	return Found ? *Found : TStatId::InvalidIndex;
+}
+
+const char* FProfiler::GetStatName(uint32 Index)
+{
+	FStatRegistry& Registry = GetStatRegistry();
+	if (Index >= Registry.NumStats.load(std::memory_order_acquire))
+	{
+		return "";
+	}
+	return Registry.Names[Index].c_str();
+}
+
+uint32 FProfiler::GetNumStats()
+{
+	return GetStatRegistry().NumStats.load(std::memory_order_acquire);
+}
+
+void FProfiler::SetThreadName(const char* Name)
+{
+	FProfilerThreadState& State = GetThreadState();
+
+	// 트레이스 기록 중 읽힐 수 있으므로 레지스트리 잠금 안에서 바꾼다
+	FThreadRegistry& Registry = GetThreadRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+	snprintf(State.Name, sizeof(State.Name), "%s", Name);
+}
+
+FProfilerThreadState* FProfiler::RegisterThread()
+{
+	FProfilerThreadState* State = new FProfilerThreadState();
+
+	FThreadRegistry& Registry = GetThreadRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+	State->ThreadIndex = static_cast<uint32>(Registry.States.Num());
+	snprintf(State->Name, sizeof(State->Name), "Thread %u", State->ThreadIndex);
+	Registry.States.Add(State);
+	return State;
+}
+
+void FProfiler::RecordEvent(FProfilerThreadState& State, EProfileEventType Type, uint32 StatIndex, uint64 Start, uint64 End)
+{
+	// 새 캡처가 시작됐으면 소유 스레드가 스스로 버퍼를 비운다 (다른 스레드는 NumEvents를 쓰지 않음)
+	const uint32 CurrentCapture = CaptureId.load(std::memory_order_acquire);
+	if (State.CaptureId.load(std::memory_order_relaxed) != CurrentCapture)
+	{
+		State.NumEvents.store(0, std::memory_order_relaxed);
+		State.NumDropped.store(0, std::memory_order_relaxed);
+		State.CaptureId.store(CurrentCapture, std::memory_order_release);
+	}
+
+	if (!State.Events)
+	{
+		State.Events = new FProfileEvent[FProfilerThreadState::MaxEvents];
+	}
+
+	const uint32 Index = State.NumEvents.load(std::memory_order_relaxed);
+	if (Index >= FProfilerThreadState::MaxEvents)
+	{
+		State.NumDropped.store(State.NumDropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		return;
+	}
+
+	FProfileEvent& Event = State.Events[Index];
+	Event.Start = Start;
+	Event.End = End;
+	Event.StatIndex = StatIndex;
+	Event.Depth = static_cast<uint16>(State.Depth);
+	Event.Type = Type;
+	State.NumEvents.store(Index + 1, std::memory_order_release);
+}
+
+void FProfiler::RecordCounter(const TStatId& Stat, double Value)
+{
+	if (!bCapturing.load(std::memory_order_relaxed) || !Stat.IsValid())
+	{
+		return;
+	}
+
+	uint64 ValueBits;
+	static_assert(sizeof(ValueBits) == sizeof(Value));
+	memcpy(&ValueBits, &Value, sizeof(Value));
+
+	const uint64 Ticks = Now();
+	RecordEvent(GetThreadState(), EProfileEventType::Counter, Stat.Index, Ticks, ValueBits);
+}
+
+void FProfiler::EndFrame()
+{
+	static const TStatId FrameStat("Frame");
+
+	const uint64 EndTicks = Now();
+	if (GFrameStartTicks == 0)
+	{
+		GFrameStartTicks = EndTicks;
+	}
+
+	if (bCapturing.load(std::memory_order_relaxed))
+	{
+		RecordEvent(GetThreadState(), EProfileEventType::Frame, FrameStat.Index, GFrameStartTicks, EndTicks);
+	}
+	GFrameStartTicks = EndTicks;
+
+	FrameNumber.fetch_add(1, std::memory_order_relaxed);
+	if (bGStatHistory)
+	{
+		AccumulateStatHistory();
+	}
+	ResetStats();
+
+	if (bCapturing.load(std::memory_order_relaxed) && GCaptureFramesRemaining > 0)
+	{
+		if (--GCaptureFramesRemaining == 0)
+		{
+			EndCapture();
+		}
+	}
+}
+
+void FProfiler::GetStatTime(uint32 StatIndex, double& OutMilliseconds, uint32& OutCallCount)
+{
+	OutMilliseconds = 0.0;
+	OutCallCount = 0;
+	if (StatIndex >= FProfilerThreadState::MaxStats)
+	{
+		return;
+	}
+
+	const uint32 Epoch = StatEpoch.load(std::memory_order_relaxed);
+	uint64 Ticks = 0;
+
+	FThreadRegistry& Registry = GetThreadRegistry();
+	std::lock_guard<std::mutex> Lock(Registry.Mutex);
+	for (const FProfilerThreadState* State : Registry.States)
+	{
+		const FProfilerThreadState::FStatSlot& Slot = State->Stats[StatIndex];
+		if (Slot.Epoch.load(std::memory_order_acquire) != Epoch)
+		{
+			continue;
+		}
+		Ticks += Slot.Ticks.load(std::memory_order_relaxed);
+		OutCallCount += Slot.Count.load(std::memory_order_relaxed);
+	}
+
+	OutMilliseconds = TicksToMilliseconds(Ticks);
+}
+
+void FProfiler::ResetStats()
+{
+	StatEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FProfiler::BeginStatHistory()
+{
+	GStatHistory.Empty();
+	bGStatHistory = true;
+}
+
+void FProfiler::EndStatHistory(TArray<FProfilerStatSummary>& OutSummaries)
+{
+	bGStatHistory = false;
+
+	OutSummaries.Empty();
+	for (int32 Index = 0; Index < GStatHistory.Num(); ++Index)
+	{
+		if (GStatHistory[Index].CallCount > 0)
+		{
+			OutSummaries.Add(GStatHistory[Index]);
+			OutSummaries.Last().Name = GetStatName(static_cast<uint32>(Index));
+		}
+	}
+	std::sort(OutSummaries.begin(), OutSummaries.end(), [](const FProfilerStatSummary& A, const FProfilerStatSummary& B)
+	{
+		return A.TotalMilliseconds > B.TotalMilliseconds;
+	});
+	GStatHistory.Empty();
+}
+
+void FProfiler::AccumulateStatHistory()
+{
+	const uint32 NumStats = GetNumStats();
+	if (GStatHistory.Num() < static_cast<int32>(NumStats))
+	{
+		GStatHistory.SetNum(NumStats);
+	}
+
+	for (uint32 Index = 0; Index < NumStats; ++Index)
+	{
+		double Milliseconds = 0.0;
+		uint32 CallCount = 0;
+		GetStatTime(Index, Milliseconds, CallCount);
+		if (CallCount == 0)
+		{
+			continue;
+		}
+
+		FProfilerStatSummary& Summary = GStatHistory[Index];
+		Summary.TotalMilliseconds += Milliseconds;
+		Summary.MaxFrameMilliseconds = Milliseconds > Summary.MaxFrameMilliseconds ? Milliseconds : Summary.MaxFrameMilliseconds;
+		Summary.CallCount += CallCount;
+		++Summary.NumFrames;
+	}
+}
+
+bool FProfiler::BeginCapture(int32 NumFrames, const FString& OutPath)
+{
+	if (bCapturing.load(std::memory_order_relaxed))
+	{
+		UE_LOG("[Profiler] Capture already in progress");
+		return false;
+	}
+
+	GCapturePath = OutPath;
+	GCaptureFramesRemaining = NumFrames > 0 ? NumFrames : 0;
+	GCaptureStartFrame = FrameNumber.load(std::memory_order_relaxed);
+
+	CaptureId.fetch_add(1, std::memory_order_release);
+	GCaptureStartTicks = Now();
+	if (GFrameStartTicks == 0)
+	{
+		GFrameStartTicks = GCaptureStartTicks;
+	}
+	bCapturing.store(true, std::memory_order_release);
+
+	if (!GCapturePath.empty())
+	{
+		UE_LOG("[Profiler] Capture started (%d frames) -> %s", NumFrames, GCapturePath.c_str());
+	}
+	return true;
+}
+
+bool FProfiler::EndCapture()
+{
+	if (!bCapturing.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+	bCapturing.store(false, std::memory_order_release);
+
+	// 경로가 없으면 버퍼만 버린다 (RunBenchmark)
+	if (GCapturePath.empty())
+	{
+		return true;
+	}
+	return WriteChromeTrace(GCapturePath);
+}
+
+bool FProfiler::WriteChromeTrace(const FString& Path)
+{
+	namespace fs = std::filesystem;
+
+	const uint32 CurrentCapture = CaptureId.load(std::memory_order_acquire);
+	const double MicrosecondsPerTick = GetSecondsPerTick() * 1000000.0;
+	const auto ToMicroseconds = [&](uint64 Ticks)
+	{
+		return Ticks > GCaptureStartTicks ? static_cast<double>(Ticks - GCaptureStartTicks) * MicrosecondsPerTick : 0.0;
+	};
+
+	std::string Out;
+	Out.reserve(1 << 20);
+	Out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	AppendFormat(Out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Mundi\"}}");
+
+	uint64 NumEvents = 0;
+	uint64 NumDropped = 0;
+	uint64 FrameIndex = GCaptureStartFrame;
+	{
+		FThreadRegistry& Registry = GetThreadRegistry();
+		std::lock_guard<std::mutex> Lock(Registry.Mutex);
+
+		for (const FProfilerThreadState* State : Registry.States)
+		{
+			if (State->CaptureId.load(std::memory_order_acquire) != CurrentCapture)
+			{
+				continue;
+			}
+			const uint32 Count = State->NumEvents.load(std::memory_order_acquire);
+			NumEvents += Count;
+			NumDropped += State->NumDropped.load(std::memory_order_relaxed);
+
+			const uint32 Tid = State->ThreadIndex;
+			Out += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,";
+			AppendFormat(Out, "\"tid\":%u,\"args\":{\"name\":", Tid);
+			AppendJsonString(Out, State->Name);
+			Out += "}}";
+			AppendFormat(Out, ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"sort_index\":%u}}", Tid, Tid);
+
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				const FProfileEvent& Event = State->Events[i];
+				Out += ",\n{\"name\":";
+				switch (Event.Type)
+				{
+				case EProfileEventType::Scope:
+					AppendJsonString(Out, GetStatName(Event.StatIndex));
+					AppendFormat(Out, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+						Tid, ToMicroseconds(Event.Start), ToMicroseconds(Event.End) - ToMicroseconds(Event.Start));
+					break;
+				case EProfileEventType::Frame:
+					AppendFormat(Out, "\"Frame %llu\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+						static_cast<unsigned long long>(FrameIndex++), Tid, ToMicroseconds(Event.Start), ToMicroseconds(Event.End) - ToMicroseconds(Event.Start));
+					break;
+				case EProfileEventType::Counter:
+				{
+					double Value;
+					memcpy(&Value, &Event.End, sizeof(Value));
+					AppendJsonString(Out, GetStatName(Event.StatIndex));
+					AppendFormat(Out, ",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%.17g}}", Tid, ToMicroseconds(Event.Start), Value);
+					break;
+				}
+				}
+			}
+		}
+	}
+	Out += "\n]}\n";
+
+	const fs::path FilePath(UTF8ToWide(Path));
+	if (FilePath.has_parent_path())
+	{
+		std::error_code ec;
+		fs::create_directories(FilePath.parent_path(), ec);
+	}
+
+	std::ofstream File(FilePath, std::ios::binary | std::ios::trunc);
+	if (!File)
+	{
+		UE_LOG("[Profiler] Failed to open %s", Path.c_str());
+		return false;
+	}
+	File.write(Out.data(), static_cast<std::streamsize>(Out.size()));
+	if (!File)
+	{
+		UE_LOG("[Profiler] Failed to write %s", Path.c_str());
+		return false;
+	}
+
+	UE_LOG("[Profiler] Trace written: %s (%llu events, %llu dropped, %.1f KB)",
+		Path.c_str(), static_cast<unsigned long long>(NumEvents), static_cast<unsigned long long>(NumDropped), Out.size() / 1024.0);
+	return true;
+}
+
+void FProfiler::RunBenchmark(int32 NumScopes)
+{
+	if (NumScopes < 1000)
+	{
+		NumScopes = 1000;
+	}
+	if (IsCapturing())
+	{
+		UE_LOG("[Profiler] Bench skipped: capture in progress");
+		return;
+	}
+
+	static const TStatId OuterStat("ProfilerBench.Outer");
+	static const TStatId InnerStat("ProfilerBench.Inner");
+
+	// 스코프 2개씩 중첩 (바깥/안쪽 모두 측정 대상)
+	const auto Measure = [](int32 Count)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < Count / 2; ++i)
+		{
+			FProfileScope Outer(OuterStat);
+			FProfileScope Inner(InnerStat);
+		}
+		const double Ms = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+		return Ms * 1000000.0 / static_cast<double>((Count / 2) * 2);
+	};
+
+	Measure(NumScopes);
+	const double StatsOnlyNs = Measure(NumScopes);
+
+	// 캡처 버퍼가 넘치면 버리는 경로만 측정되므로 버퍼 크기 안에서 잰다
+	const int32 CaptureScopes = NumScopes < static_cast<int32>(FProfilerThreadState::MaxEvents) ? NumScopes : static_cast<int32>(FProfilerThreadState::MaxEvents);
+	BeginCapture(0, FString());
+	Measure(CaptureScopes);
+	EndCapture();
+	BeginCapture(0, FString());
+	const double CaptureNs = Measure(CaptureScopes);
+	EndCapture();
+
+	double OuterMs = 0.0;
+	uint32 OuterCalls = 0;
+	GetStatTime(OuterStat.Index, OuterMs, OuterCalls);
+
+	UE_LOG("[Profiler] Scope cost: %.1f ns (stats only, %d scopes), %.1f ns (capturing, %d scopes), target < 50 ns",
+		StatsOnlyNs, NumScopes, CaptureNs, CaptureScopes);
+	UE_LOG("[Profiler] ProfilerBench.Outer this frame: %u calls, %.3f ms (timestamp: %s)",
+		OuterCalls, OuterMs, MUNDI_PROFILER_RDTSC ? "rdtsc" : "steady_clock");
+}
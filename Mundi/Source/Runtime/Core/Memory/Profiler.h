@@ -0,0 +1,231 @@
+﻿#pragma once
+#include <atomic>
+#include "UEContainer.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define MUNDI_PROFILER_RDTSC 1
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#else
+	#define MUNDI_PROFILER_RDTSC 0
+	#include <chrono>
+#endif
+
+#ifndef PREPROCESSOR_JOIN
+	#define PREPROCESSOR_JOIN_INNER(A, B) A##B
+	#define PREPROCESSOR_JOIN(A, B) PREPROCESSOR_JOIN_INNER(A, B)
+#endif
+
+// 계층 스코프 측정 (스탯 ID는 호출 지점마다 한 번만 등록, 측정마다 문자열 조회/할당 없음)
+#define PROFILE_SCOPE(Name) \
+	static const TStatId PREPROCESSOR_JOIN(ProfileStat_, __LINE__)(Name); \
+	FProfileScope PREPROCESSOR_JOIN(ProfileScope_, __LINE__)(PREPROCESSOR_JOIN(ProfileStat_, __LINE__));
+
+// 캡처 중에만 트레이스에 카운터 값을 남긴다
+#define PROFILE_COUNTER(Name, Value) \
+	do { static const TStatId ProfileCounterStat(Name); FProfiler::RecordCounter(ProfileCounterStat, static_cast<double>(Value)); } while (0)
+
+// 등록된 스탯 인덱스 (이름 -> 인덱스는 FProfiler가 관리)
+struct TStatId
+{
+	static constexpr uint32 InvalidIndex = 0xFFFFFFFFu;
+
+	uint32 Index = InvalidIndex;
+
+	TStatId() = default;
+	explicit TStatId(const char* InName);
+	// 호출할 때마다 레지스트리를 조회하므로 반복 측정에는 static으로 들고 있을 것
+	explicit TStatId(const FString& InName);
+
+	bool IsValid() const { return Index != InvalidIndex; }
+};
+
+enum class EProfileEventType : uint8
+{
+	Scope,
+	Frame,
+	Counter
+};
+
+// BeginStatHistory ~ EndStatHistory 사이 프레임들의 스탯 합계
+struct FProfilerStatSummary
+{
+	FString Name;
+	double TotalMilliseconds = 0.0;
+	double MaxFrameMilliseconds = 0.0;		// 한 프레임 안의 합 중 최댓값
+	uint64 CallCount = 0;
+	uint32 NumFrames = 0;					// 한 번 이상 기록된 프레임 수
+};
+
+// 캡처 버퍼 원소 (카운터는 End에 double 비트를 담는다)
+struct FProfileEvent
+{
+	uint64 Start;
+	uint64 End;
+	uint32 StatIndex;
+	uint16 Depth;
+	EProfileEventType Type;
+};
+
+/**
+ * 스레드별 프로파일러 상태. 소유 스레드만 기록하고, 다른 스레드는 원자 변수로 읽기만 한다
+ * - 스탯 누적은 에포크(프레임)가 바뀌면 소유 스레드가 다음 기록 때 스스로 0으로 되돌린다
+ * - 캡처 이벤트는 고정 크기 버퍼에 추가만 하고 NumEvents를 release로 공개 (가득 차면 버린다)
+ */
+struct FProfilerThreadState
+{
+	static constexpr uint32 MaxStats = 1024;
+	static constexpr uint32 MaxEvents = 1u << 16;
+
+	struct FStatSlot
+	{
+		std::atomic<uint64> Ticks{ 0 };
+		std::atomic<uint32> Count{ 0 };
+		std::atomic<uint32> Epoch{ 0 };
+	};
+
+	FStatSlot Stats[MaxStats];
+
+	FProfileEvent* Events = nullptr;
+	std::atomic<uint32> NumEvents{ 0 };
+	std::atomic<uint32> NumDropped{ 0 };
+	std::atomic<uint32> CaptureId{ 0 };
+
+	uint32 Depth = 0;
+	uint32 ThreadIndex = 0;
+	char Name[32] = {};
+};
+
+/**
+ * 스레드 인지 계층 프로파일러
+ * - 타임스탬프는 x64에서 rdtsc (불변 TSC 가정, FPlatformTime으로 보정), 그 외에는 steady_clock
+ * - 스코프 종료 시 스레드 로컬 스탯 슬롯에 누적 -> GetStatTime이 모든 스레드 합을 돌려준다
+ * - BeginCapture ~ EndCapture 사이의 스코프/프레임/카운터를 Chrome 트레이스 JSON으로 기록
+ *   (chrome://tracing, ui.perfetto.dev에서 열기, 콘솔 PROFILE TRACE)
+ */
+class FProfiler
+{
+public:
+	static uint64 Now()
+	{
+#if MUNDI_PROFILER_RDTSC
+		return __rdtsc();
+#else
+		return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+	}
+	static double GetSecondsPerTick();
+	static double TicksToMilliseconds(uint64 Ticks) { return static_cast<double>(Ticks) * GetSecondsPerTick() * 1000.0; }
+
+	static uint32 RegisterStat(const char* Name);
+	static uint32 RegisterStat(const FString& Name);
+	static uint32 FindStat(const FString& Name);
+	static const char* GetStatName(uint32 Index);
+	static uint32 GetNumStats();
+
+	// 호출한 스레드 이름 (트레이스 표시용)
+	static void SetThreadName(const char* Name);
+
+	static FProfilerThreadState& GetThreadState()
+	{
+		if (!ThreadState)
+		{
+			ThreadState = RegisterThread();
+		}
+		return *ThreadState;
+	}
+
+	static void BeginScope()
+	{
+		++GetThreadState().Depth;
+	}
+
+	static void EndScope(uint32 StatIndex, uint64 StartTicks, uint64 EndTicks)
+	{
+		FProfilerThreadState& State = GetThreadState();
+		--State.Depth;
+		if (StatIndex >= FProfilerThreadState::MaxStats)
+		{
+			return;
+		}
+
+		FProfilerThreadState::FStatSlot& Slot = State.Stats[StatIndex];
+		const uint32 Epoch = StatEpoch.load(std::memory_order_relaxed);
+		if (Slot.Epoch.load(std::memory_order_relaxed) != Epoch)
+		{
+			Slot.Ticks.store(0, std::memory_order_relaxed);
+			Slot.Count.store(0, std::memory_order_relaxed);
+			Slot.Epoch.store(Epoch, std::memory_order_release);
+		}
+		Slot.Ticks.store(Slot.Ticks.load(std::memory_order_relaxed) + (EndTicks - StartTicks), std::memory_order_relaxed);
+		Slot.Count.store(Slot.Count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		if (bCapturing.load(std::memory_order_relaxed))
+		{
+			RecordEvent(State, EProfileEventType::Scope, StatIndex, StartTicks, EndTicks);
+		}
+	}
+
+	static void RecordCounter(const TStatId& Stat, double Value);
+
+	// 프레임 경계 (URenderer::EndFrame). 스탯 에포크를 넘기고 캡처 프레임 수를 센다
+	static void EndFrame();
+	static uint64 GetFrameNumber() { return FrameNumber.load(std::memory_order_relaxed); }
+
+	// 현재 에포크의 스탯을 모든 스레드에서 합산
+	static void GetStatTime(uint32 StatIndex, double& OutMilliseconds, uint32& OutCallCount);
+	// 스탯 누적을 새 에포크로 넘긴다 (EndFrame에서도 호출)
+	static void ResetStats();
+
+	// 이후 EndFrame마다 프레임 스탯을 합산 (헤드리스 러너/벤치마크). 결과는 TotalMilliseconds 내림차순
+	static void BeginStatHistory();
+	static void EndStatHistory(TArray<FProfilerStatSummary>& OutSummaries);
+
+	// NumFrames 프레임 뒤 자동으로 OutPath에 기록 (0 이하면 EndCapture까지)
+	static bool BeginCapture(int32 NumFrames, const FString& OutPath);
+	static bool EndCapture();
+	static bool IsCapturing() { return bCapturing.load(std::memory_order_relaxed); }
+
+	// 스코프 하나의 비용 측정 (콘솔 PROFILE BENCH)
+	static void RunBenchmark(int32 NumScopes);
+
+private:
+	static FProfilerThreadState* RegisterThread();
+	static void RecordEvent(FProfilerThreadState& State, EProfileEventType Type, uint32 StatIndex, uint64 Start, uint64 End);
+	static bool WriteChromeTrace(const FString& Path);
+	static void AccumulateStatHistory();
+
+private:
+	static inline thread_local FProfilerThreadState* ThreadState = nullptr;
+
+	static std::atomic<uint32> StatEpoch;
+	static std::atomic<bool> bCapturing;
+	static std::atomic<uint32> CaptureId;
+	static std::atomic<uint64> FrameNumber;
+};
+
+// PROFILE_SCOPE가 만드는 RAII 스코프
+class FProfileScope
+{
+public:
+	explicit FProfileScope(const TStatId& Stat)
+		: StatIndex(Stat.Index)
+	{
+		FProfiler::BeginScope();
+		StartTicks = FProfiler::Now();
+	}
+	~FProfileScope()
+	{
+		FProfiler::EndScope(StatIndex, StartTicks, FProfiler::Now());
+	}
+
+	FProfileScope(const FProfileScope&) = delete;
+	FProfileScope& operator=(const FProfileScope&) = delete;
+
+private:
+	uint32 StatIndex;
+	uint64 StartTicks;
+};
@@ -0,0 +1,146 @@
+﻿#include "pch.h"
+#include "BackgroundTasks.h"
+#include "Profiler.h"
+#include "ParallelFor.h"
+#include <algorithm>
+
+FBackgroundTasks& FBackgroundTasks::GetInstance()
+{
+    static FBackgroundTasks Instance;
+    return Instance;
+}
+
+FBackgroundTasks::FBackgroundTasks()
+{
+    // 파일 IO/디코드 위주라 코어 수만큼 둘 필요는 없다. ParallelFor 워커와 코어를 나눠 쓰므로 적게 유지
+    const uint32 HardwareThreads = std::thread::hardware_concurrency();
+    const int32 NumThreads = std::clamp(static_cast<int32>(HardwareThreads / 4), 1, 4);
+
+    Threads.Reserve(NumThreads);
+    for (int32 i = 0; i < NumThreads; ++i)
+    {
+        Threads.Emplace(&FBackgroundTasks::ThreadMain, this, i);
+    }
+}
+
+FBackgroundTasks::~FBackgroundTasks()
+{
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        bShuttingDown = true;
+    }
+    WakeCondition.notify_all();
+
+    for (std::thread& Thread : Threads)
+    {
+        if (Thread.joinable())
+        {
+            Thread.join();
+        }
+    }
+}
+
+void FBackgroundTasks::Enqueue(std::function<void()> Task, ETaskPriority Priority)
+{
+    if (!Task)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Queues[static_cast<int32>(Priority)].push(std::move(Task));
+    }
+    WakeCondition.notify_one();
+}
+
+void FBackgroundTasks::Flush()
+{
+    std::unique_lock<std::mutex> Lock(Mutex);
+    IdleCondition.wait(Lock, [this]() { return !HasQueuedTask() && NumBusy == 0; });
+}
+
+int32 FBackgroundTasks::GetNumPending()
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+    int32 NumPending = NumBusy;
+    for (const auto& Queue : Queues)
+    {
+        NumPending += Queue.Num();
+    }
+    return NumPending;
+}
+
+bool FBackgroundTasks::HasQueuedTask() const
+{
+    for (const auto& Queue : Queues)
+    {
+        if (!Queue.IsEmpty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FBackgroundTasks::ThreadMain(int32 ThreadIndex)
+{
+    char ThreadName[32];
+    snprintf(ThreadName, sizeof(ThreadName), "Background %d", ThreadIndex);
+    FProfiler::SetThreadName(ThreadName);
+
+    // 여기서 도는 쿡/파싱의 ParallelFor가 풀 분배 락을 작업 내내 잡지 않도록 이 스레드에서 순차 실행
+    FWorkerPool::RunInlineOnCurrentThread();
+
+#ifdef _WIN32
+    // WIC 디코더(텍스처 변환)가 COM을 쓴다
+    const HRESULT ComResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+#endif
+
+    std::unique_lock<std::mutex> Lock(Mutex);
+    for (;;)
+    {
+        WakeCondition.wait(Lock, [this]() { return bShuttingDown || HasQueuedTask(); });
+
+        // 종료 시에는 남은 작업을 버린다 (엔진 종료 경로에서 미리 Flush함)
+        if (bShuttingDown)
+        {
+            break;
+        }
+
+        TQueue<std::function<void()>>* Queue = nullptr;
+        for (auto& Candidate : Queues)
+        {
+            if (!Candidate.IsEmpty())
+            {
+                Queue = &Candidate;
+                break;
+            }
+        }
+
+        std::function<void()> Task = std::move(Queue->front());
+        Queue->pop();
+
+        ++NumBusy;
+        Lock.unlock();
+        Task();
+        Task = nullptr;
+        Lock.lock();
+        --NumBusy;
+
+        if (NumBusy == 0 && !HasQueuedTask())
+        {
+            IdleCondition.notify_all();
+        }
+    }
+
+    IdleCondition.notify_all();
+    Lock.unlock();
+
+#ifdef _WIN32
+    if (SUCCEEDED(ComResult))
+    {
+        CoUninitialize();
+    }
+#endif
+}
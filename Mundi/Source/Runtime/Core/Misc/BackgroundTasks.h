@@ -0,0 +1,59 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// 백그라운드 작업 우선순위 대역 (높은 대역이 빌 때까지 낮은 대역은 꺼내지 않는다)
+enum class ETaskPriority : uint8
+{
+    High,       // 화면에 바로 필요한 에셋
+    Normal,
+    Low,        // 프리로드, 캐시 갱신(BVH 굽기 등)
+
+    Num
+};
+
+/**
+ * 백그라운드 작업 스레드 (프로세스 전역)
+ * - 프레임을 막지 않아야 하는 긴 작업(에셋 읽기/디코드, BVH 굽기 등)을 우선순위 대역별 FIFO로 실행
+ * - ParallelFor 풀과는 별개의 스레드라 워커를 점유하지 않는다 (이 스레드 안의 ParallelFor는 순차 실행)
+ * - 작업이 참조하는 자원을 해제하기 전에 반드시 Flush()로 비워야 한다
+ * - 작업 취소는 작업 쪽에서 플래그로 처리한다 (큐에서 꺼낸 뒤 바로 반환)
+ */
+class FBackgroundTasks
+{
+public:
+    static FBackgroundTasks& GetInstance();
+
+    void Enqueue(std::function<void()> Task, ETaskPriority Priority = ETaskPriority::Normal);
+
+    // 대기 중인 작업까지 모두 끝날 때까지 대기 (작업 스레드 안에서 부르면 안 됨)
+    void Flush();
+
+    // 대기 중 + 실행 중인 작업 수
+    int32 GetNumPending();
+    int32 GetNumThreads() const { return static_cast<int32>(Threads.Num()); }
+
+    FBackgroundTasks(const FBackgroundTasks&) = delete;
+    FBackgroundTasks& operator=(const FBackgroundTasks&) = delete;
+
+private:
+    FBackgroundTasks();
+    ~FBackgroundTasks();
+
+    void ThreadMain(int32 ThreadIndex);
+    bool HasQueuedTask() const;
+
+private:
+    TArray<std::thread> Threads;
+
+    std::mutex Mutex;
+    std::condition_variable WakeCondition;
+    std::condition_variable IdleCondition;
+
+    TQueue<std::function<void()>> Queues[static_cast<int32>(ETaskPriority::Num)];
+    int32 NumBusy = 0;
+    bool bShuttingDown = false;
+};
@@ -114,6 +114,94 @@ struct FGroupInfo
     }
 };
 
+// 자동 생성 LOD의 한 섹션 (FMeshLOD::Indices 기준, GroupInfos와 같은 순서)
+struct FMeshLODSection
+{
+    uint32 StartIndex = 0;
+    uint32 IndexCount = 0;
+};
+
+// 자동 생성 LOD (FMeshSimplifier). LOD0 정점 버퍼를 그대로 쓰고 인덱스만 따로 가진다
+struct FMeshLOD
+{
+    TArray<uint32> Indices;
+    TArray<FMeshLODSection> Sections;
+    float ScreenSize = 0.0f;    // 화면 크기(화면 높이 대비 바운드 구 지름)가 이보다 작으면 이 LOD를 쓴다
+};
+
+namespace MeshLOD
+{
+    // GPU 인덱스 버퍼 내용: LOD0 인덱스 뒤에 LOD1부터 순서대로 이어 붙인다
+    inline TArray<uint32> GatherIndices(const TArray<uint32>& Indices, const TArray<FMeshLOD>& LODs)
+    {
+        TArray<uint32> Result = Indices;
+        for (const FMeshLOD& LOD : LODs)
+        {
+            Result.insert(Result.end(), LOD.Indices.begin(), LOD.Indices.end());
+        }
+        return Result;
+    }
+
+    inline uint32 GetTotalIndexCount(const TArray<uint32>& Indices, const TArray<FMeshLOD>& LODs)
+    {
+        size_t Count = Indices.size();
+        for (const FMeshLOD& LOD : LODs)
+        {
+            Count += LOD.Indices.size();
+        }
+        return static_cast<uint32>(Count);
+    }
+
+    // LODIndex의 섹션(그룹) 범위를 GatherIndices 버퍼 기준으로. 그룹이 없는 메시는 섹션 0이 전체
+    inline void GetSection(const TArray<uint32>& Indices, const TArray<FGroupInfo>& Groups, const TArray<FMeshLOD>& LODs,
+        int32 LODIndex, uint32 SectionIndex, uint32& OutStartIndex, uint32& OutIndexCount)
+    {
+        OutStartIndex = 0;
+        OutIndexCount = 0;
+        if (LODIndex <= 0 || LODs.size() < static_cast<size_t>(LODIndex))
+        {
+            if (Groups.empty())
+            {
+                OutIndexCount = static_cast<uint32>(Indices.size());
+            }
+            else if (SectionIndex < Groups.size())
+            {
+                OutStartIndex = Groups[SectionIndex].StartIndex;
+                OutIndexCount = Groups[SectionIndex].IndexCount;
+            }
+            return;
+        }
+
+        size_t Offset = Indices.size();
+        for (int32 Index = 0; Index < LODIndex - 1; ++Index)
+        {
+            Offset += LODs[Index].Indices.size();
+        }
+        const FMeshLOD& LOD = LODs[LODIndex - 1];
+        if (SectionIndex < LOD.Sections.size())
+        {
+            OutStartIndex = static_cast<uint32>(Offset) + LOD.Sections[SectionIndex].StartIndex;
+            OutIndexCount = LOD.Sections[SectionIndex].IndexCount;
+        }
+    }
+
+    // 화면 크기에 맞는 LOD (0 = 원본). 현재 LOD 쪽으로 전환 경계를 Hysteresis 비율만큼 넓혀 경계에서 깜빡이지 않게 한다
+    inline int32 Select(const TArray<FMeshLOD>& LODs, float ScreenSize, int32 CurrentLOD, float Hysteresis)
+    {
+        int32 Result = 0;
+        for (int32 LODIndex = 1; LODIndex <= static_cast<int32>(LODs.size()); ++LODIndex)
+        {
+            const float Threshold = LODs[LODIndex - 1].ScreenSize * (LODIndex <= CurrentLOD ? 1.0f + Hysteresis : 1.0f - Hysteresis);
+            if (Threshold <= ScreenSize)
+            {
+                break;
+            }
+            Result = LODIndex;
+        }
+        return Result;
+    }
+}
+
 // Helper serialization operators for math types to ensure safe, member-wise serialization
 inline FArchive& operator<<(FArchive& Ar, FVector& V) { Ar.Serialize(&V.X, sizeof(float) * 3); return Ar; }
 inline FArchive& operator<<(FArchive& Ar, FVector2D& V) { Ar.Serialize(&V.X, sizeof(float) * 2); return Ar; }
@@ -171,6 +259,12 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    // Vertices + Indices 내용 해시 (FMeshBVH::ComputeGeometryHash). 메시 BVH 캐시 키
+    uint64 GeometryHash = 0;
+
+    // LOD1부터 (LOD0은 Indices/GroupInfos). 화면 크기 기준 내림차순
+    TArray<FMeshLOD> LODs;
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
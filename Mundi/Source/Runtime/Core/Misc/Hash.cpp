@@ -0,0 +1,108 @@
+﻿#include "pch.h"
+#include "Hash.h"
+
+namespace
+{
+    constexpr uint64 Prime1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64 Prime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr uint64 Prime3 = 0x165667B19E3779F9ull;
+    constexpr uint64 Prime4 = 0x85EBCA77C2B2AE63ull;
+    constexpr uint64 Prime5 = 0x27D4EB2F165667C5ull;
+
+    inline uint64 RotateLeft(uint64 Value, int32 Bits)
+    {
+        return (Value << Bits) | (Value >> (64 - Bits));
+    }
+
+    inline uint64 Read64(const uint8* Ptr)
+    {
+        uint64 Value;
+        std::memcpy(&Value, Ptr, sizeof(Value));
+        return Value;
+    }
+
+    inline uint32 Read32(const uint8* Ptr)
+    {
+        uint32 Value;
+        std::memcpy(&Value, Ptr, sizeof(Value));
+        return Value;
+    }
+
+    inline uint64 Round(uint64 Acc, uint64 Input)
+    {
+        Acc += Input * Prime2;
+        Acc = RotateLeft(Acc, 31);
+        return Acc * Prime1;
+    }
+
+    inline uint64 MergeRound(uint64 Acc, uint64 Value)
+    {
+        Acc ^= Round(0, Value);
+        return Acc * Prime1 + Prime4;
+    }
+}
+
+uint64 HashBytes(const void* Data, uint64 Size, uint64 Seed)
+{
+    const uint8* Ptr = static_cast<const uint8*>(Data);
+    const uint8* const End = Ptr + Size;
+    uint64 Hash;
+
+    if (Size >= 32)
+    {
+        // 32바이트 블록을 4개 누산기로 독립 처리 (의존 체인이 짧아 메모리 대역폭에 가깝게 돈다)
+        uint64 V1 = Seed + Prime1 + Prime2;
+        uint64 V2 = Seed + Prime2;
+        uint64 V3 = Seed;
+        uint64 V4 = Seed - Prime1;
+
+        const uint8* const Limit = End - 32;
+        do
+        {
+            V1 = Round(V1, Read64(Ptr));
+            V2 = Round(V2, Read64(Ptr + 8));
+            V3 = Round(V3, Read64(Ptr + 16));
+            V4 = Round(V4, Read64(Ptr + 24));
+            Ptr += 32;
+        } while (Ptr <= Limit);
+
+        Hash = RotateLeft(V1, 1) + RotateLeft(V2, 7) + RotateLeft(V3, 12) + RotateLeft(V4, 18);
+        Hash = MergeRound(Hash, V1);
+        Hash = MergeRound(Hash, V2);
+        Hash = MergeRound(Hash, V3);
+        Hash = MergeRound(Hash, V4);
+    }
+    else
+    {
+        Hash = Seed + Prime5;
+    }
+
+    Hash += Size;
+
+    while (Ptr + 8 <= End)
+    {
+        Hash ^= Round(0, Read64(Ptr));
+        Hash = RotateLeft(Hash, 27) * Prime1 + Prime4;
+        Ptr += 8;
+    }
+    if (Ptr + 4 <= End)
+    {
+        Hash ^= static_cast<uint64>(Read32(Ptr)) * Prime1;
+        Hash = RotateLeft(Hash, 23) * Prime2 + Prime3;
+        Ptr += 4;
+    }
+    while (Ptr < End)
+    {
+        Hash ^= static_cast<uint64>(*Ptr) * Prime5;
+        Hash = RotateLeft(Hash, 11) * Prime1;
+        ++Ptr;
+    }
+
+    // 마지막 섞기 (avalanche)
+    Hash ^= Hash >> 33;
+    Hash *= Prime2;
+    Hash ^= Hash >> 29;
+    Hash *= Prime3;
+    Hash ^= Hash >> 32;
+    return Hash;
+}
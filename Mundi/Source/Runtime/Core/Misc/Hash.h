@@ -14,4 +14,7 @@ inline uint64 HashCombine(uint64 Seed, uint64 ValueToCombine)
     const uint64 GoldenRatio = 0x9e3779b97f4a7c15;
     Seed ^= ValueToCombine + GoldenRatio + (Seed << 6) + (Seed >> 2);
     return Seed;
-}
\ No newline at end of file
+}
+
+// 바이트 버퍼의 64비트 해시 (xxHash64 알고리즘). 파일 내용 비교용이며 암호학적 해시가 아니다
+uint64 HashBytes(const void* Data, uint64 Size, uint64 Seed = 0);
\ No newline at end of file
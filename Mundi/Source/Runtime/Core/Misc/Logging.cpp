@@ -0,0 +1,859 @@
+﻿#include "pch.h"
+#include "Logging.h"
+#include "PlatformTime.h"
+#include "Hash.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+DEFINE_LOG_CATEGORY(LogTemp, Log)
+
+#ifdef _EDITOR
+std::atomic<bool> FLog::bEnabled{ true };
+#else
+std::atomic<bool> FLog::bEnabled{ false };
+#endif
+std::atomic<uint32> FLog::RateLimit{ 64 };
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    constexpr uint32 QueueCapacity = 4096;
+    constexpr int32 MaxConsoleLines = 2048;
+    constexpr int32 FormatBufferSize = 2048;
+    // 큐가 비어 있을 때 로그 스레드가 잠드는 최대 시간 (이때 파일/stdout 버퍼를 비운다)
+    constexpr int32 IdleWaitMilliseconds = 10;
+
+    // 벤치마크 기록은 싱크로 보내지 않고 개수만 센다
+    DEFINE_LOG_CATEGORY_STATIC(LogBench, Log)
+
+    FLogCategory*& GetCategoryListHead()
+    {
+        static FLogCategory* Head = nullptr;
+        return Head;
+    }
+
+    std::atomic<uint64> GNumDropped{ 0 };
+    std::atomic<uint64> GNumSuppressed{ 0 };
+    std::atomic<uint64> GNumHeapText{ 0 };
+
+    // 반복 제한 요약을 들고 있는 호출 지점 (로그 스레드가 창 만료를 확인). 잠금 순서: 호출 지점 -> GPendingMutex
+    std::mutex GPendingMutex;
+    TArray<FLogCallSite*> GPendingCallSites;
+
+    // 호출 지점 잠금 (같은 지점을 여러 스레드가 동시에 기록할 때만 경합하므로 스핀으로 충분)
+    class FCallSiteLock
+    {
+    public:
+        explicit FCallSiteLock(FLogCallSite& InCallSite) : CallSite(InCallSite)
+        {
+            while (CallSite.Lock.test_and_set(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+        }
+        ~FCallSiteLock()
+        {
+            CallSite.Lock.clear(std::memory_order_release);
+        }
+
+    private:
+        FLogCallSite& CallSite;
+    };
+
+    // 서식과 인자가 같으면 같은 값 (지연 서식 기록은 서식 문자열과 인코딩된 인자, 나머지는 완성된 문자열 기준)
+    // 서식은 포인터가 아닌 내용으로 비교한다. 같은 const char 버퍼에 다른 서식을 다시 채워 쓰는 호출도 있으므로
+    uint64 HashRecord(const FLogRecord& Record)
+    {
+        uint64 Seed = reinterpret_cast<uint64>(Record.FormatFunc);
+        if (Record.Format)
+        {
+            Seed = HashBytes(Record.Format, strlen(Record.Format), Seed);
+        }
+        if (Record.FormatFunc)
+        {
+            return HashBytes(Record.Payload, Record.PayloadSize, Seed);
+        }
+        if (Record.HeapText)
+        {
+            return HashBytes(Record.HeapText, strlen(Record.HeapText), Seed);
+        }
+        const char* Text = reinterpret_cast<const char*>(Record.Payload);
+        return HashBytes(Text, strnlen(Text, FLogRecord::PayloadCapacity), Seed);
+    }
+
+    // 호출 지점에 모아 둔 요약 줄을 꺼낸다 (호출 지점 잠금 아래에서). 버린 첫 기록이 요약 줄이 되고 나머지 개수를 붙인다
+    bool TakeSuppressed(FLogCallSite& CallSite, FLogRecord& OutSummary)
+    {
+        if (!CallSite.SuppressedRecord)
+        {
+            return false;
+        }
+        OutSummary = *CallSite.SuppressedRecord;
+        OutSummary.Suppressed = CallSite.Suppressed - 1;
+        delete CallSite.SuppressedRecord;
+        CallSite.SuppressedRecord = nullptr;
+        CallSite.Suppressed = 0;
+        return true;
+    }
+
+    uint32 GetCurrentLogThreadId()
+    {
+#ifdef _WIN32
+        return static_cast<uint32>(GetCurrentThreadId());
+#else
+        return static_cast<uint32>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+    }
+
+    /**
+     * 로그 스레드와 싱크. 링의 유일한 소비자이며, 모든 출력은 ProcessMutex 아래에서 순서대로 처리된다
+     * (Shutdown 이후의 동기 처리와 로그 스레드가 겹치지 않도록)
+     */
+    class FLogDevice
+    {
+    public:
+        static FLogDevice& Get()
+        {
+            static FLogDevice Instance;
+            return Instance;
+        }
+
+        // 한 번도 기록하지 않았으면 종료 때 스레드를 새로 만들지 않도록
+        static bool IsCreated()
+        {
+            return bCreated.load(std::memory_order_acquire);
+        }
+
+        // 정적 소멸 순서상 장치보다 늦게 소멸되는 객체의 로그는 버린다
+        static bool IsDestroyed()
+        {
+            return bDestroyed.load(std::memory_order_acquire);
+        }
+
+        void Submit(FLogRecord& Record)
+        {
+            if (bRunning.load(std::memory_order_acquire))
+            {
+                NumSubmitted.fetch_add(1, std::memory_order_relaxed);
+                if (!Queue.Enqueue(std::move(Record)))
+                {
+                    NumSubmitted.fetch_sub(1, std::memory_order_relaxed);
+                    GNumDropped.fetch_add(1, std::memory_order_relaxed);
+                    delete[] Record.HeapText;
+                    WakeCondition.notify_one();
+                    return;
+                }
+                // 절반 이상 차면 대기 시간을 기다리지 않고 깨운다
+                if (static_cast<uint32>(Queue.Num()) > QueueCapacity / 2)
+                {
+                    WakeCondition.notify_one();
+                }
+                return;
+            }
+
+            std::lock_guard<std::mutex> Lock(ProcessMutex);
+            Process(Record);
+            FlushSinks();
+        }
+
+        void Flush()
+        {
+            if (!bRunning.load(std::memory_order_acquire))
+            {
+                std::lock_guard<std::mutex> Lock(ProcessMutex);
+                FlushSinks();
+                return;
+            }
+
+            const uint64 Target = NumSubmitted.load(std::memory_order_relaxed);
+            std::unique_lock<std::mutex> Lock(WakeMutex);
+            WakeCondition.notify_one();
+            FlushCondition.wait(Lock, [this, Target]()
+            {
+                return NumProcessed.load(std::memory_order_relaxed) >= Target || !bRunning.load(std::memory_order_relaxed);
+            });
+            Lock.unlock();
+
+            std::lock_guard<std::mutex> ProcessLock(ProcessMutex);
+            FlushSinks();
+        }
+
+        void Shutdown()
+        {
+            {
+                std::lock_guard<std::mutex> Lock(WakeMutex);
+                if (!Thread.joinable())
+                {
+                    return;
+                }
+                bStopRequested = true;
+            }
+            WakeCondition.notify_one();
+            Thread.join();
+
+            // 이후 기록은 호출 스레드에서 처리. 멈추는 사이에 들어온 기록과 창이 남은 요약 줄을 마저 비운다
+            bRunning.store(false, std::memory_order_release);
+            Drain();
+            std::lock_guard<std::mutex> Lock(ProcessMutex);
+            FlushSuppressed(true);
+            FlushSinks();
+        }
+
+        void SetEchoToStdOut(bool bInEcho)
+        {
+            bEchoToStdOut.store(bInEcho, std::memory_order_relaxed);
+        }
+
+        bool OpenFile(const FString& Path)
+        {
+            const fs::path FilePath(UTF8ToWide(Path));
+            if (FilePath.has_parent_path())
+            {
+                std::error_code ec;
+                fs::create_directories(FilePath.parent_path(), ec);
+            }
+
+            std::lock_guard<std::mutex> Lock(ProcessMutex);
+            if (File.is_open())
+            {
+                File.close();
+            }
+            File.clear();
+            File.open(FilePath, std::ios::binary | std::ios::trunc);
+            FilePath8 = File.is_open() ? Path : FString();
+            bFileOpen.store(File.is_open(), std::memory_order_relaxed);
+            return File.is_open();
+        }
+
+        void CloseFile()
+        {
+            std::lock_guard<std::mutex> Lock(ProcessMutex);
+            if (File.is_open())
+            {
+                File.close();
+            }
+            FilePath8.clear();
+            bFileOpen.store(false, std::memory_order_relaxed);
+        }
+
+        FString GetFilePath()
+        {
+            std::lock_guard<std::mutex> Lock(ProcessMutex);
+            return FilePath8;
+        }
+
+        bool HasOutput() const
+        {
+            return bEchoToStdOut.load(std::memory_order_relaxed) || bFileOpen.load(std::memory_order_relaxed);
+        }
+
+        void ReadConsoleLines(uint64& InOutSequence, TArray<FString>& OutLines)
+        {
+            std::lock_guard<std::mutex> Lock(ConsoleMutex);
+            const uint64 Oldest = ConsoleSequence > static_cast<uint64>(MaxConsoleLines) ? ConsoleSequence - MaxConsoleLines : 0;
+            for (uint64 Sequence = std::max(InOutSequence, Oldest); Sequence < ConsoleSequence; ++Sequence)
+            {
+                OutLines.Add(ConsoleLines[static_cast<int32>(Sequence % MaxConsoleLines)]);
+            }
+            InOutSequence = ConsoleSequence;
+        }
+
+        uint64 GetNumProcessed() const
+        {
+            return NumProcessed.load(std::memory_order_relaxed);
+        }
+
+    private:
+        FLogDevice()
+            : Queue(QueueCapacity)
+            , StartCycles(FPlatformTime::Cycles64())
+        {
+            ConsoleLines.SetNum(MaxConsoleLines);
+            bRunning.store(true, std::memory_order_release);
+            Thread = std::thread(&FLogDevice::ThreadMain, this);
+            bCreated.store(true, std::memory_order_release);
+        }
+
+        ~FLogDevice()
+        {
+            Shutdown();
+            {
+                std::lock_guard<std::mutex> Lock(ProcessMutex);
+                if (File.is_open())
+                {
+                    File.close();
+                }
+            }
+            bCreated.store(false, std::memory_order_release);
+            bDestroyed.store(true, std::memory_order_release);
+        }
+
+        void ThreadMain()
+        {
+            for (;;)
+            {
+                const int32 NumDrained = Drain();
+
+                std::unique_lock<std::mutex> Lock(WakeMutex);
+                // 계속 기록이 들어와도 Flush 대기자가 자기 목표에 도달했는지 확인할 수 있게 매번 알린다
+                FlushCondition.notify_all();
+                if (NumDrained == 0)
+                {
+                    {
+                        std::lock_guard<std::mutex> ProcessLock(ProcessMutex);
+                        FlushSinks();
+                    }
+                    if (bStopRequested)
+                    {
+                        break;
+                    }
+                    WakeCondition.wait_for(Lock, std::chrono::milliseconds(IdleWaitMilliseconds));
+                }
+            }
+        }
+
+        int32 Drain()
+        {
+            std::lock_guard<std::mutex> Lock(ProcessMutex);
+
+            // 버린 개수 알림도 넘치지 않도록 1초에 한 번만
+            const uint64 Dropped = GNumDropped.load(std::memory_order_relaxed);
+            const uint64 Now = FPlatformTime::Cycles64();
+            if (Dropped != NumDroppedReported && Now - LastDropReportCycles >= FPlatformTime::GetFrequency())
+            {
+                LastDropReportCycles = Now;
+                char Buffer[128];
+                snprintf(Buffer, sizeof(Buffer), "[warning] Log queue full: %llu message(s) dropped",
+                    static_cast<unsigned long long>(Dropped - NumDroppedReported));
+                NumDroppedReported = Dropped;
+                FLogRecord Notice;
+                Notice.Category = &LogTemp;
+                Notice.Cycles = Now;
+                Notice.ThreadId = GetCurrentLogThreadId();
+                Emit(Notice, Buffer, strlen(Buffer));
+            }
+
+            int32 NumDrained = 0;
+            FLogRecord Record;
+            while (Queue.Dequeue(Record))
+            {
+                Process(Record);
+                ++NumDrained;
+                NumProcessed.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            FlushSuppressed(false);
+            return NumDrained;
+        }
+
+        // 창이 끝났는데 같은 호출 지점이 다시 기록하지 않아 남아 있는 요약 줄을 내보낸다 (ProcessMutex 아래에서)
+        void FlushSuppressed(bool bAll)
+        {
+            TArray<FLogCallSite*> CallSites;
+            {
+                std::lock_guard<std::mutex> Lock(GPendingMutex);
+                if (GPendingCallSites.empty())
+                {
+                    return;
+                }
+                CallSites.swap(GPendingCallSites);
+            }
+
+            static const uint64 CyclesPerSecond = FPlatformTime::GetFrequency();
+            const uint64 Now = FPlatformTime::Cycles64();
+            for (FLogCallSite* CallSite : CallSites)
+            {
+                FLogRecord Summary;
+                {
+                    FCallSiteLock Lock(*CallSite);
+                    if (CallSite->SuppressedRecord && !bAll && Now - CallSite->WindowStart < CyclesPerSecond)
+                    {
+                        // 창이 아직 열려 있으면 다음 검사로
+                        std::lock_guard<std::mutex> PendingLock(GPendingMutex);
+                        GPendingCallSites.Add(CallSite);
+                        continue;
+                    }
+                    CallSite->bPendingFlush = false;
+                    if (!TakeSuppressed(*CallSite, Summary))
+                    {
+                        // 호출 스레드가 이미 다음 기록 앞에 내보냈다
+                        continue;
+                    }
+                }
+                Summary.Cycles = Now;
+                Process(Summary);
+            }
+        }
+
+        void Process(FLogRecord& Record)
+        {
+            char Buffer[FormatBufferSize];
+            const char* Text = Buffer;
+            int32 Length = 0;
+
+            if (Record.FormatFunc)
+            {
+                const char* Format = Record.Format;
+                const uint8* Args = Record.Payload;
+                if (!Format)
+                {
+                    Format = reinterpret_cast<const char*>(Record.Payload);
+                    Args += strlen(Format) + 1;
+                }
+                Length = Record.FormatFunc(Format, Args, Buffer, FormatBufferSize);
+                Length = std::clamp(Length, 0, FormatBufferSize - 1);
+            }
+            else if (Record.HeapText)
+            {
+                Text = Record.HeapText;
+                Length = static_cast<int32>(strlen(Text));
+            }
+            else
+            {
+                Text = reinterpret_cast<const char*>(Record.Payload);
+                Length = static_cast<int32>(strnlen(Text, FLogRecord::PayloadCapacity));
+            }
+
+            if (Record.Category != &LogBench)
+            {
+                Emit(Record, Text, Length);
+            }
+
+            delete[] Record.HeapText;
+            Record.HeapText = nullptr;
+        }
+
+        void Emit(const FLogRecord& Record, const char* Text, SIZE_T Length)
+        {
+            // 기존 로그 끝의 개행은 줄 단위 출력과 겹치므로 뗀다
+            while (Length > 0 && (Text[Length - 1] == '\n' || Text[Length - 1] == '\r'))
+            {
+                --Length;
+            }
+
+            FString Line;
+            Line.reserve(Length + 48);
+            if (Record.Category && Record.Category != &LogTemp)
+            {
+                Line += Record.Category->GetName();
+                Line += ": ";
+            }
+            // 콘솔 창은 [error]가 들어간 줄에서 열린다
+            if (Record.Verbosity == ELogVerbosity::Error)
+            {
+                Line += "[error] ";
+            }
+            else if (Record.Verbosity == ELogVerbosity::Warning)
+            {
+                Line += "[warning] ";
+            }
+            Line.append(Text, Length);
+            if (Record.Suppressed > 0)
+            {
+                char Note[64];
+                snprintf(Note, sizeof(Note), " (+%u suppressed)", Record.Suppressed);
+                Line += Note;
+            }
+
+            if (bEchoToStdOut.load(std::memory_order_relaxed))
+            {
+                fwrite(Line.data(), 1, Line.size(), stdout);
+                fputc('\n', stdout);
+                bStdOutDirty = true;
+            }
+
+#ifdef _EDITOR
+            OutputDebugStringA(Line.c_str());
+            OutputDebugStringA("\n");
+#endif
+
+            if (File.is_open())
+            {
+                const double Seconds = FPlatformTime::ToMilliseconds(Record.Cycles - StartCycles) / 1000.0;
+                char Prefix[48];
+                const int32 PrefixLength = snprintf(Prefix, sizeof(Prefix), "[%10.3f][%5u] ", Seconds, Record.ThreadId);
+                File.write(Prefix, PrefixLength);
+                File.write(Line.data(), static_cast<std::streamsize>(Line.size()));
+                File.put('\n');
+                bFileDirty = true;
+            }
+
+            std::lock_guard<std::mutex> Lock(ConsoleMutex);
+            ConsoleLines[static_cast<int32>(ConsoleSequence % MaxConsoleLines)] = std::move(Line);
+            ++ConsoleSequence;
+        }
+
+        void FlushSinks()
+        {
+            if (bStdOutDirty)
+            {
+                fflush(stdout);
+                bStdOutDirty = false;
+            }
+            if (bFileDirty && File.is_open())
+            {
+                File.flush();
+            }
+            bFileDirty = false;
+        }
+
+    private:
+        static inline std::atomic<bool> bCreated{ false };
+        static inline std::atomic<bool> bDestroyed{ false };
+
+        TQueue<FLogRecord, EQueueMode::Mpmc> Queue;
+        std::thread Thread;
+        std::atomic<bool> bRunning{ false };
+        std::atomic<uint64> NumSubmitted{ 0 };
+        std::atomic<uint64> NumProcessed{ 0 };
+
+        std::mutex WakeMutex;
+        std::condition_variable WakeCondition;
+        std::condition_variable FlushCondition;
+        bool bStopRequested = false;
+
+        // 아래는 ProcessMutex 아래에서만 접근
+        std::mutex ProcessMutex;
+        uint64 StartCycles = 0;
+        uint64 NumDroppedReported = 0;
+        uint64 LastDropReportCycles = 0;
+        std::ofstream File;
+        FString FilePath8;
+        bool bFileDirty = false;
+        bool bStdOutDirty = false;
+
+        std::atomic<bool> bEchoToStdOut{ false };
+        std::atomic<bool> bFileOpen{ false };
+
+        std::mutex ConsoleMutex;
+        TArray<FString> ConsoleLines;
+        uint64 ConsoleSequence = 0;
+    };
+
+}
+
+FLogCategory::FLogCategory(const char* InName, ELogVerbosity InDefaultVerbosity)
+    : Name(InName)
+    , Verbosity(static_cast<uint8>(InDefaultVerbosity))
+{
+    // 정적 초기화 중에만 불리므로 잠금 없이 앞에 붙인다
+    FLogCategory*& Head = GetCategoryListHead();
+    Next = Head;
+    Head = this;
+}
+
+FLogCategory* FLogCategory::GetFirst()
+{
+    return GetCategoryListHead();
+}
+
+bool FLog::AcquireCallSite(FLogCallSite& CallSite, FLogRecord& Record)
+{
+    static const uint64 CyclesPerSecond = FPlatformTime::GetFrequency();
+    const uint64 Hash = HashRecord(Record);
+    const uint64 Now = FPlatformTime::Cycles64();
+
+    FLogRecord Summary;
+    bool bHasSummary = false;
+    {
+        FCallSiteLock Lock(CallSite);
+        if (Hash != CallSite.LastHash || Now - CallSite.WindowStart >= CyclesPerSecond)
+        {
+            // 다른 메시지가 오거나 창이 끝나면 모아 둔 요약 줄을 이 기록보다 먼저 내보내고 새로 센다
+            bHasSummary = TakeSuppressed(CallSite, Summary);
+            CallSite.LastHash = Hash;
+            CallSite.WindowStart = Now;
+            CallSite.RepeatCount = 1;
+        }
+        else if (++CallSite.RepeatCount > RateLimit.load(std::memory_order_relaxed))
+        {
+            ++CallSite.Suppressed;
+            GNumSuppressed.fetch_add(1, std::memory_order_relaxed);
+            if (CallSite.SuppressedRecord)
+            {
+                delete[] Record.HeapText;
+                return false;
+            }
+
+            // 버린 첫 기록은 요약 줄로 쓰려고 보관 (HeapText 소유권도 넘어간다)
+            Record.Cycles = Now;
+            Record.ThreadId = GetCurrentLogThreadId();
+            CallSite.SuppressedRecord = new FLogRecord(Record);
+            if (!CallSite.bPendingFlush)
+            {
+                CallSite.bPendingFlush = true;
+                std::lock_guard<std::mutex> PendingLock(GPendingMutex);
+                GPendingCallSites.Add(&CallSite);
+            }
+            return false;
+        }
+    }
+
+    if (bHasSummary)
+    {
+        Submit(Summary);
+    }
+    return true;
+}
+
+void FLog::Submit(FLogRecord& Record)
+{
+    Record.Cycles = FPlatformTime::Cycles64();
+    Record.ThreadId = GetCurrentLogThreadId();
+    if (FLogDevice::IsDestroyed())
+    {
+        delete[] Record.HeapText;
+        return;
+    }
+    FLogDevice::Get().Submit(Record);
+}
+
+void FLog::FormatNow(FLogRecord& Record, const char* Format, ...)
+{
+    va_list Args;
+    va_start(Args, Format);
+    FormatNowV(Record, Format, Args);
+    va_end(Args);
+}
+
+void FLog::FormatNowV(FLogRecord& Record, const char* Format, va_list Args)
+{
+    char* Payload = reinterpret_cast<char*>(Record.Payload);
+    va_list RetryArgs;
+    va_copy(RetryArgs, Args);
+    const int32 Length = vsnprintf(Payload, FLogRecord::PayloadCapacity, Format, Args);
+    if (Length < 0)
+    {
+        Payload[0] = '\0';
+    }
+    else if (Length >= FLogRecord::PayloadCapacity)
+    {
+        Record.HeapText = new char[Length + 1];
+        vsnprintf(Record.HeapText, Length + 1, Format, RetryArgs);
+        GNumHeapText.fetch_add(1, std::memory_order_relaxed);
+    }
+    va_end(RetryArgs);
+}
+
+void FLog::WriteV(const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, va_list Args)
+{
+    if (!IsActive(Category, Verbosity))
+    {
+        return;
+    }
+
+    FLogRecord Record;
+    Record.Category = &Category;
+    Record.Verbosity = Verbosity;
+    FormatNowV(Record, Format, Args);
+    Submit(Record);
+}
+
+void FLog::Flush()
+{
+    if (FLogDevice::IsCreated())
+    {
+        FLogDevice::Get().Flush();
+    }
+}
+
+void FLog::Shutdown()
+{
+    if (FLogDevice::IsCreated())
+    {
+        FLogDevice::Get().Shutdown();
+    }
+}
+
+void FLog::RefreshEnabled()
+{
+#ifndef _EDITOR
+    bEnabled.store(FLogDevice::Get().HasOutput(), std::memory_order_relaxed);
+#endif
+}
+
+void FLog::SetEchoToStdOut(bool bInEcho)
+{
+    FLogDevice::Get().SetEchoToStdOut(bInEcho);
+    RefreshEnabled();
+}
+
+bool FLog::OpenFileSink(const FString& Path)
+{
+    const bool bOpened = FLogDevice::Get().OpenFile(Path);
+    RefreshEnabled();
+    return bOpened;
+}
+
+void FLog::CloseFileSink()
+{
+    if (FLogDevice::IsCreated())
+    {
+        FLogDevice::Get().CloseFile();
+        RefreshEnabled();
+    }
+}
+
+FString FLog::GetFileSinkPath()
+{
+    return FLogDevice::IsCreated() ? FLogDevice::Get().GetFilePath() : FString();
+}
+
+bool FLog::SetCategoryVerbosity(const char* CategoryName, ELogVerbosity Verbosity)
+{
+    bool bFound = false;
+    for (FLogCategory* Category = FLogCategory::GetFirst(); Category; Category = Category->GetNext())
+    {
+        if (_stricmp(Category->GetName(), CategoryName) == 0)
+        {
+            Category->SetVerbosity(Verbosity);
+            bFound = true;
+        }
+    }
+    return bFound;
+}
+
+const char* FLog::GetVerbosityName(ELogVerbosity Verbosity)
+{
+    switch (Verbosity)
+    {
+    case ELogVerbosity::NoLogging:  return "Off";
+    case ELogVerbosity::Error:      return "Error";
+    case ELogVerbosity::Warning:    return "Warning";
+    case ELogVerbosity::Log:        return "Log";
+    case ELogVerbosity::Verbose:    return "Verbose";
+    default:                        return "Unknown";
+    }
+}
+
+bool FLog::ParseVerbosity(const char* Text, ELogVerbosity& OutVerbosity)
+{
+    for (uint8 Value = static_cast<uint8>(ELogVerbosity::NoLogging); Value <= static_cast<uint8>(ELogVerbosity::Verbose); ++Value)
+    {
+        const ELogVerbosity Verbosity = static_cast<ELogVerbosity>(Value);
+        if (_stricmp(Text, GetVerbosityName(Verbosity)) == 0)
+        {
+            OutVerbosity = Verbosity;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FLog::ReadConsoleLines(uint64& InOutSequence, TArray<FString>& OutLines)
+{
+    if (FLogDevice::IsCreated())
+    {
+        FLogDevice::Get().ReadConsoleLines(InOutSequence, OutLines);
+    }
+}
+
+FLogStats FLog::GetStats()
+{
+    FLogStats Stats;
+    Stats.NumWritten = FLogDevice::IsCreated() ? FLogDevice::Get().GetNumProcessed() : 0;
+    Stats.NumDropped = GNumDropped.load(std::memory_order_relaxed);
+    Stats.NumSuppressed = GNumSuppressed.load(std::memory_order_relaxed);
+    Stats.NumHeapText = GNumHeapText.load(std::memory_order_relaxed);
+    Stats.QueueCapacity = static_cast<int32>(QueueCapacity);
+    return Stats;
+}
+
+void FLog::RunBenchmark(int32 NumThreads, int32 NumMessagesPerThread)
+{
+    if (NumThreads <= 0 || NumMessagesPerThread <= 0)
+    {
+        UE_LOG("[Log] Benchmark: invalid arguments");
+        return;
+    }
+
+    Flush();
+    const uint32 PreviousRateLimit = GetRateLimit();
+    const ELogVerbosity PreviousVerbosity = LogBench.GetVerbosity();
+    SetRateLimit(0);
+    LogBench.SetVerbosity(ELogVerbosity::Log);
+
+    // 모든 스레드를 같이 출발시키고 메시지 하나당 평균 ns
+    const double TotalMessages = static_cast<double>(NumThreads) * NumMessagesPerThread;
+    const auto Measure = [&](const std::function<void()>& Body)
+    {
+        std::atomic<int32> NumReady{ 0 };
+        std::atomic<bool> bStart{ false };
+        TArray<std::thread> Threads;
+        Threads.Reserve(NumThreads);
+        for (int32 i = 0; i < NumThreads; ++i)
+        {
+            Threads.Emplace([&]()
+            {
+                NumReady.fetch_add(1);
+                while (!bStart.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                Body();
+            });
+        }
+        while (NumReady.load() < NumThreads)
+        {
+            std::this_thread::yield();
+        }
+
+        const uint64 Start = FPlatformTime::Cycles64();
+        bStart.store(true, std::memory_order_release);
+        for (std::thread& Thread : Threads)
+        {
+            Thread.join();
+        }
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) * 1.0e6 / TotalMessages;
+    };
+
+    const double FilteredNs = Measure([&]()
+    {
+        for (int32 i = 0; i < NumMessagesPerThread; ++i)
+        {
+            UE_LOG_CAT(LogBench, Verbose, "frame %d value %.3f name %s", i, 1.5f * i, "Actor");
+        }
+    });
+
+    // 기존 방식: 호출 스레드에서 서식화하고 공유 배열에 잠금을 잡고 추가
+    std::mutex LegacyMutex;
+    TArray<FString> LegacyItems;
+    const double SyncNs = Measure([&]()
+    {
+        for (int32 i = 0; i < NumMessagesPerThread; ++i)
+        {
+            char Buffer[1024];
+            snprintf(Buffer, sizeof(Buffer), "frame %d value %.3f name %s", i, 1.5f * i, "Actor");
+            std::lock_guard<std::mutex> Lock(LegacyMutex);
+            LegacyItems.Add(FString(Buffer));
+            if (LegacyItems.Num() >= MaxConsoleLines)
+            {
+                LegacyItems.Empty();
+            }
+        }
+    });
+
+    const uint64 DroppedBefore = GNumDropped.load();
+    const double DeferredNs = Measure([&]()
+    {
+        for (int32 i = 0; i < NumMessagesPerThread; ++i)
+        {
+            UE_LOG_CAT(LogBench, Log, "frame %d value %.3f name %s", i, 1.5f * i, "Actor");
+        }
+    });
+    const uint64 DrainStart = FPlatformTime::Cycles64();
+    Flush();
+    const double DrainMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DrainStart);
+    const uint64 Dropped = GNumDropped.load() - DroppedBefore;
+
+    SetRateLimit(PreviousRateLimit);
+    LogBench.SetVerbosity(PreviousVerbosity);
+
+    UE_LOG("[Log] Benchmark: %d thread(s) x %d messages", NumThreads, NumMessagesPerThread);
+    UE_LOG("[Log]   filtered   %8.1f ns/call", FilteredNs);
+    UE_LOG("[Log]   sync       %8.1f ns/call (format on caller + locked append)", SyncNs);
+    UE_LOG("[Log]   deferred   %8.1f ns/call, %llu dropped (queue %u), drain %.2f ms",
+        DeferredNs, static_cast<unsigned long long>(Dropped), QueueCapacity, DrainMs);
+}
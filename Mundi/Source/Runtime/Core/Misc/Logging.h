@@ -0,0 +1,358 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+// 숫자가 클수록 자세한 로그. 카테고리 수준보다 큰 로그는 호출 지점에서 인자 평가 없이 걸러진다
+enum class ELogVerbosity : uint8
+{
+    NoLogging = 0,
+    Error,
+    Warning,
+    Log,
+    Verbose,
+};
+
+/**
+ * 로그 카테고리 (DEFINE_LOG_CATEGORY로 전역 정의, 정적 초기화 때 목록에 등록)
+ * - 수준은 런타임에 바꿀 수 있다 (콘솔 LOG LEVEL)
+ */
+class FLogCategory
+{
+public:
+    FLogCategory(const char* InName, ELogVerbosity InDefaultVerbosity);
+
+    FLogCategory(const FLogCategory&) = delete;
+    FLogCategory& operator=(const FLogCategory&) = delete;
+
+    const char* GetName() const { return Name; }
+    ELogVerbosity GetVerbosity() const { return static_cast<ELogVerbosity>(Verbosity.load(std::memory_order_relaxed)); }
+    void SetVerbosity(ELogVerbosity InVerbosity) { Verbosity.store(static_cast<uint8>(InVerbosity), std::memory_order_relaxed); }
+
+    // 등록된 카테고리 순회 (정의 순서의 역순)
+    static FLogCategory* GetFirst();
+    FLogCategory* GetNext() const { return Next; }
+
+private:
+    const char* Name;
+    std::atomic<uint8> Verbosity;
+    FLogCategory* Next = nullptr;
+};
+
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName) extern FLogCategory CategoryName;
+#define DEFINE_LOG_CATEGORY(CategoryName, DefaultVerbosity) FLogCategory CategoryName(#CategoryName, ELogVerbosity::DefaultVerbosity);
+#define DEFINE_LOG_CATEGORY_STATIC(CategoryName, DefaultVerbosity) static FLogCategory CategoryName(#CategoryName, ELogVerbosity::DefaultVerbosity);
+
+// 기존 UE_LOG가 쓰는 기본 카테고리
+DECLARE_LOG_CATEGORY_EXTERN(LogTemp)
+
+struct FLogRecord;
+
+/**
+ * 호출 지점마다 하나씩 생기는 반복 제한 상태 (UE_LOG_CAT 안의 정적 변수)
+ * 같은 서식과 인자의 메시지가 1초 창 안에서 FLog::GetRateLimit()번을 넘게 이어지면 버린다 (내용이 다른 줄은 버리지 않음)
+ * 버린 첫 기록을 사본으로 들고 있다가, 다른 메시지가 오거나 창이 끝나면 버린 개수와 함께 한 줄로 내보낸다
+ * (아무도 다시 기록하지 않으면 로그 스레드가 창 만료를 보고 내보낸다)
+ * 필드는 Lock 아래에서만 접근
+ */
+struct FLogCallSite
+{
+    std::atomic_flag Lock;
+    uint64 LastHash = 0;
+    uint64 WindowStart = 0;
+    uint32 RepeatCount = 0;
+    uint32 Suppressed = 0;
+    FLogRecord* SuppressedRecord = nullptr;
+    bool bPendingFlush = false;             // 로그 스레드의 만료 검사 목록에 올라 있는지
+};
+
+/**
+ * 서식 문자열. 문자열 리터럴(상수 char 배열)은 정적 수명으로 보고 포인터만 기록하고,
+ * 그 외(char 버퍼, c_str() 등)는 기록에 복사한다
+ */
+struct FLogFormat
+{
+    const char* Text = nullptr;
+    bool bStatic = false;
+
+    template<SIZE_T N>
+    FLogFormat(const char (&Literal)[N]) : Text(Literal), bStatic(true) {}
+
+    template<SIZE_T N>
+    FLogFormat(char (&Buffer)[N]) : Text(Buffer), bStatic(false) {}
+
+    template<typename T, typename = std::enable_if_t<std::is_convertible_v<T, const char*> && !std::is_array_v<std::remove_reference_t<T>>>>
+    FLogFormat(T InText) : Text(InText), bStatic(false) {}
+};
+
+/** 링에 들어가는 고정 크기 로그 기록 (서식화는 로그 스레드에서) */
+struct FLogRecord
+{
+    static constexpr int32 PayloadCapacity = 200;
+
+    // 서식 문자열과 인코딩된 인자로 Out에 문자열을 만든다 (snprintf와 같은 반환값)
+    using FFormatFunc = int32 (*)(const char* Format, const uint8* Args, char* Out, int32 OutSize);
+
+    uint64 Cycles = 0;
+    const FLogCategory* Category = nullptr;
+    const char* Format = nullptr;           // nullptr이면 Payload 앞부분에 복사된 서식
+    FFormatFunc FormatFunc = nullptr;       // nullptr이면 이미 완성된 문자열 (HeapText 또는 Payload)
+    char* HeapText = nullptr;               // Payload에 들어가지 않는 긴 문자열 (로그 스레드가 해제)
+    uint32 ThreadId = 0;
+    uint32 Suppressed = 0;                  // 이 기록 뒤로 같은 메시지가 버려진 개수 (반복 제한 요약 줄)
+    ELogVerbosity Verbosity = ELogVerbosity::Log;
+    uint16 PayloadSize = 0;                 // 지연 서식 기록이 Payload에서 쓴 바이트 (반복 판정 해시용)
+    alignas(8) uint8 Payload[PayloadCapacity];
+};
+static_assert(sizeof(FLogRecord) == 256, "FLogRecord 크기가 바뀌면 PayloadCapacity를 다시 맞춘다");
+
+namespace LogDetail
+{
+    template<typename T>
+    struct TArgTraits
+    {
+        // Write가 const 참조로 받으므로 char 배열은 const char*로 붕괴시킨다
+        using Type = std::decay_t<const T>;
+        static constexpr bool bString = std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>;
+        static constexpr bool bWideString = std::is_same_v<Type, const wchar_t*> || std::is_same_v<Type, wchar_t*>;
+        // 값 그대로 복사해도 되는 인자 (printf 가변 인자로 넘길 수 있는 기본 타입)
+        static constexpr bool bDeferred = bString || bWideString || std::is_arithmetic_v<Type>
+            || std::is_enum_v<Type> || std::is_pointer_v<Type> || std::is_null_pointer_v<Type>;
+        using DecodedType = std::conditional_t<bString, const char*, std::conditional_t<bWideString, const wchar_t*, Type>>;
+    };
+
+    // 문자열은 [유효 여부 1바이트][널 종료 문자열], 나머지는 바이트 복사
+    class FPayloadWriter
+    {
+    public:
+        FPayloadWriter(uint8* InData, int32 InCapacity) : Data(InData), Capacity(InCapacity) {}
+
+        bool HasOverflowed() const { return bOverflow; }
+        SIZE_T GetSize() const { return Offset; }
+
+        void WriteBytes(const void* Bytes, SIZE_T Size)
+        {
+            if (bOverflow || Offset + Size > static_cast<SIZE_T>(Capacity))
+            {
+                bOverflow = true;
+                return;
+            }
+            memcpy(Data + Offset, Bytes, Size);
+            Offset += Size;
+        }
+
+        void WriteFormat(const char* Format)
+        {
+            WriteBytes(Format, strlen(Format) + 1);
+        }
+
+        template<typename T>
+        void Write(const T& Value)
+        {
+            using FTraits = TArgTraits<T>;
+            typename FTraits::Type Decayed = Value;
+            if constexpr (FTraits::bString || FTraits::bWideString)
+            {
+                const uint8 bValid = Decayed != nullptr ? 1 : 0;
+                WriteBytes(&bValid, 1);
+                if (bValid)
+                {
+                    if constexpr (FTraits::bString)
+                    {
+                        WriteBytes(Decayed, strlen(Decayed) + 1);
+                    }
+                    else
+                    {
+                        Offset = (Offset + alignof(wchar_t) - 1) & ~(alignof(wchar_t) - 1);
+                        WriteBytes(Decayed, (wcslen(Decayed) + 1) * sizeof(wchar_t));
+                    }
+                }
+            }
+            else
+            {
+                WriteBytes(&Decayed, sizeof(Decayed));
+            }
+        }
+
+    private:
+        uint8* Data;
+        int32 Capacity;
+        SIZE_T Offset = 0;
+        bool bOverflow = false;
+    };
+
+    class FPayloadReader
+    {
+    public:
+        explicit FPayloadReader(const uint8* InData) : Data(InData) {}
+
+        template<typename T>
+        typename TArgTraits<T>::DecodedType Read()
+        {
+            using FTraits = TArgTraits<T>;
+            if constexpr (FTraits::bString || FTraits::bWideString)
+            {
+                const uint8 bValid = Data[Offset++];
+                if (!bValid)
+                {
+                    return nullptr;
+                }
+                if constexpr (FTraits::bString)
+                {
+                    const char* String = reinterpret_cast<const char*>(Data + Offset);
+                    Offset += strlen(String) + 1;
+                    return String;
+                }
+                else
+                {
+                    Offset = (Offset + alignof(wchar_t) - 1) & ~(alignof(wchar_t) - 1);
+                    const wchar_t* String = reinterpret_cast<const wchar_t*>(Data + Offset);
+                    Offset += (wcslen(String) + 1) * sizeof(wchar_t);
+                    return String;
+                }
+            }
+            else
+            {
+                typename FTraits::Type Value;
+                memcpy(&Value, Data + Offset, sizeof(Value));
+                Offset += sizeof(Value);
+                return Value;
+            }
+        }
+
+    private:
+        const uint8* Data;
+        SIZE_T Offset = 0;
+    };
+
+    template<typename... ArgTypes>
+    int32 FormatPayload(const char* Format, const uint8* Args, char* Out, int32 OutSize)
+    {
+        FPayloadReader Reader(Args);
+        // 중괄호 초기화는 왼쪽부터 평가되므로 인코딩 순서대로 읽힌다
+        const std::tuple<typename TArgTraits<ArgTypes>::DecodedType...> Values{ Reader.template Read<ArgTypes>()... };
+        return std::apply([&](const auto&... Decoded)
+        {
+            return snprintf(Out, OutSize, Format, Decoded...);
+        }, Values);
+    }
+}
+
+struct FLogStats
+{
+    uint64 NumWritten = 0;          // 싱크까지 처리된 기록
+    uint64 NumDropped = 0;          // 링이 가득 차 버린 기록
+    uint64 NumSuppressed = 0;       // 호출 지점 반복 제한으로 버린 기록
+    uint64 NumHeapText = 0;         // Payload를 넘어 호출 스레드에서 바로 서식화한 기록
+    int32 QueueCapacity = 0;
+};
+
+/**
+ * UE_LOG 백엔드
+ * - 호출 스레드는 인자를 고정 크기 기록에 복사해 잠금 없는 링(TQueue Mpmc를 MPSC로 사용)에 넣기만 한다
+ *   서식화, stdout/디버거 출력, 파일 싱크, 콘솔 줄 버퍼 기록은 로그 스레드 하나가 순서대로 처리
+ * - 링이 가득 차면 기다리지 않고 버린 뒤 개수만 세어 다음 출력에 알린다
+ * - 워커 스레드에서 호출해도 된다. Shutdown 이후에는 호출 스레드에서 바로 처리한다
+ */
+class FLog
+{
+public:
+    static bool IsActive(const FLogCategory& Category, ELogVerbosity Verbosity)
+    {
+        return bEnabled.load(std::memory_order_relaxed) && Verbosity <= Category.GetVerbosity();
+    }
+
+    template<typename... ArgTypes>
+    static void Write(FLogCallSite& CallSite, const FLogCategory& Category, ELogVerbosity Verbosity, FLogFormat Format, const ArgTypes&... Args)
+    {
+        FLogRecord Record;
+        Record.Category = &Category;
+        Record.Verbosity = Verbosity;
+        Encode(Record, Format, Args...);
+        // 반복 판정은 인코딩된 내용으로 (제한이 꺼져 있으면 해시도 계산하지 않음)
+        if (GetRateLimit() != 0 && !AcquireCallSite(CallSite, Record))
+        {
+            return;
+        }
+        Submit(Record);
+    }
+
+    // va_list는 타입을 알 수 없으므로 호출 스레드에서 바로 서식화 (반복 제한 없음)
+    static void WriteV(const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, va_list Args);
+
+    // 지금까지 넣은 기록이 모든 싱크에 쓰일 때까지 대기
+    static void Flush();
+    // 로그 스레드를 멈추고 남은 기록과 파일을 정리 (엔진 종료 시)
+    static void Shutdown();
+
+    // _GAME 빌드는 stdout이나 파일 싱크가 켜져 있을 때만 기록한다 (그 외엔 호출 지점에서 바로 반환)
+    static void SetEchoToStdOut(bool bInEcho);
+    static bool OpenFileSink(const FString& Path);
+    static void CloseFileSink();
+    static FString GetFileSinkPath();
+
+    // 호출 지점당 같은 메시지를 초당 최대 몇 번까지 기록할지 (0이면 제한 없음)
+    static void SetRateLimit(uint32 MaxPerSecond) { RateLimit.store(MaxPerSecond, std::memory_order_relaxed); }
+    static uint32 GetRateLimit() { return RateLimit.load(std::memory_order_relaxed); }
+
+    // 이름이 같은 카테고리 모두 (못 찾으면 false)
+    static bool SetCategoryVerbosity(const char* CategoryName, ELogVerbosity Verbosity);
+    static const char* GetVerbosityName(ELogVerbosity Verbosity);
+    static bool ParseVerbosity(const char* Text, ELogVerbosity& OutVerbosity);
+
+    // 콘솔 창용 줄 버퍼 (최근 MaxConsoleLines줄). InOutSequence 이후의 줄을 꺼내고 번호를 갱신
+    static void ReadConsoleLines(uint64& InOutSequence, TArray<FString>& OutLines);
+
+    static FLogStats GetStats();
+
+    // 걸러진 호출, 지연 서식 기록, 기존 동기 서식화 비용 비교 (콘솔 LOG BENCH)
+    static void RunBenchmark(int32 NumThreads, int32 NumMessagesPerThread);
+
+private:
+    // false면 Record는 버려졌다 (HeapText도 여기서 정리)
+    static bool AcquireCallSite(FLogCallSite& CallSite, FLogRecord& Record);
+    static void RefreshEnabled();
+    static void Submit(FLogRecord& Record);
+    static void FormatNow(FLogRecord& Record, const char* Format, ...);
+    static void FormatNowV(FLogRecord& Record, const char* Format, va_list Args);
+
+    template<typename... ArgTypes>
+    static void Encode(FLogRecord& Record, const FLogFormat& Format, const ArgTypes&... Args)
+    {
+        if constexpr ((LogDetail::TArgTraits<ArgTypes>::bDeferred && ...))
+        {
+            LogDetail::FPayloadWriter Writer(Record.Payload, FLogRecord::PayloadCapacity);
+            if (!Format.bStatic)
+            {
+                Writer.WriteFormat(Format.Text);
+            }
+            (Writer.Write(Args), ...);
+            if (!Writer.HasOverflowed())
+            {
+                Record.PayloadSize = static_cast<uint16>(Writer.GetSize());
+                Record.Format = Format.bStatic ? Format.Text : nullptr;
+                Record.FormatFunc = &LogDetail::FormatPayload<typename LogDetail::TArgTraits<ArgTypes>::Type...>;
+                return;
+            }
+        }
+        FormatNow(Record, Format.Text, Args...);
+    }
+
+    static std::atomic<bool> bEnabled;
+    static std::atomic<uint32> RateLimit;
+};
+
+// 카테고리/수준 필터는 인자 평가 전에 확인한다
+#define UE_LOG_CAT(CategoryName, VerbosityName, Format, ...) \
+    do \
+    { \
+        if (FLog::IsActive(CategoryName, ELogVerbosity::VerbosityName)) \
+        { \
+            static FLogCallSite LogCallSite; \
+            FLog::Write(LogCallSite, CategoryName, ELogVerbosity::VerbosityName, Format, ##__VA_ARGS__); \
+        } \
+    } while (0)
@@ -0,0 +1,31 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 읽기 전용 메모리 매핑 파일
+ * - 파일 전체를 한 번에 매핑하고, 소멸/Close 시 매핑과 핸들을 해제
+ * - 0바이트 파일은 매핑할 수 없으므로 Open 실패로 처리
+ */
+class FMappedFile
+{
+public:
+    FMappedFile() = default;
+    ~FMappedFile() { Close(); }
+
+    FMappedFile(const FMappedFile&) = delete;
+    FMappedFile& operator=(const FMappedFile&) = delete;
+
+    bool Open(const FWideString& InPath);
+    void Close();
+
+    bool IsOpen() const { return Data != nullptr; }
+    const uint8* GetData() const { return Data; }
+    uint64 GetSize() const { return Size; }
+
+private:
+    // HANDLE (헤더에서 windows.h 의존을 피하기 위해 void*로 보관)
+    void* FileHandle = nullptr;
+    void* MappingHandle = nullptr;
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+};
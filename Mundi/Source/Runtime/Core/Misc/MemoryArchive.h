@@ -0,0 +1,61 @@
+﻿#pragma once
+#include "Archive.h"
+#include "UEContainer.h"
+#include <stdexcept>
+
+// 메모리 버퍼에 이어 쓰는 Saving 아카이브 (캐시 섹션 조립용)
+class FMemoryWriter : public FArchive
+{
+public:
+    explicit FMemoryWriter(TArray<uint8>& InBuffer)
+        : FArchive(false, true)
+        , Buffer(InBuffer)
+    {
+    }
+
+    void Serialize(void* Data, int64 Length) override
+    {
+        if (Length <= 0)
+        {
+            return;
+        }
+        const size_t Offset = Buffer.size();
+        Buffer.resize(Offset + static_cast<size_t>(Length));
+        std::memcpy(Buffer.data() + Offset, Data, static_cast<size_t>(Length));
+    }
+    bool Close() override { return true; }
+
+private:
+    TArray<uint8>& Buffer;
+};
+
+// 고정 메모리 영역(매핑된 파일 등)에서 읽는 Loading 아카이브. 범위를 넘으면 예외
+class FMemoryReader : public FArchive
+{
+public:
+    FMemoryReader(const uint8* InData, uint64 InSize)
+        : FArchive(true, false)
+        , Data(InData)
+        , Size(InSize)
+    {
+    }
+
+    void Serialize(void* OutData, int64 Length) override
+    {
+        if (Length < 0 || static_cast<uint64>(Length) > Size - Offset)
+        {
+            throw std::runtime_error("Cache corrupt: Read past end of section.");
+        }
+        std::memcpy(OutData, Data + Offset, static_cast<size_t>(Length));
+        Offset += static_cast<uint64>(Length);
+    }
+    bool Close() override { return true; }
+
+    uint64 Tell() const { return Offset; }
+    bool AtEnd() const { return Offset == Size; }
+
+private:
+    const uint8* Data;
+    uint64 Size;
+    uint64 Offset = 0;
+};
@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "ParallelFor.h"
+
+namespace
+{
+    // 워커 스레드에서 다시 ParallelFor를 부르면 교착되므로 순차 실행으로 우회
+    thread_local bool GIsPoolWorker = false;
+    // 백그라운드 작업 스레드: 분배 락을 오래 잡아 게임 스레드를 막지 않도록 순차 실행
+    thread_local bool GRunInline = false;
+}
+
+FWorkerPool& FWorkerPool::GetInstance()
+{
+    static FWorkerPool Instance;
+    return Instance;
+}
+
+void FWorkerPool::RunInlineOnCurrentThread()
+{
+    GRunInline = true;
+}
+
+FWorkerPool::FWorkerPool()
+{
+    const uint32 HardwareThreads = std::thread::hardware_concurrency();
+    const int32 NumWorkers = HardwareThreads > 1 ? static_cast<int32>(HardwareThreads) - 1 : 0;
+
+    Workers.Reserve(NumWorkers);
+    for (int32 i = 0; i < NumWorkers; ++i)
+    {
+        Workers.Emplace(&FWorkerPool::WorkerMain, this);
+    }
+}
+
+FWorkerPool::~FWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+        bShuttingDown = true;
+    }
+    WakeCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+}
+
+void FWorkerPool::ParallelFor(int32 Num, int32 BatchSize, const std::function<void(int32 Begin, int32 End)>& Body)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    BatchSize = BatchSize > 0 ? BatchSize : 1;
+    const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+
+    // 구간이 하나뿐이거나 워커가 없으면 분배 비용 없이 바로 실행
+    if (NumBatches == 1 || Workers.IsEmpty() || GIsPoolWorker || GRunInline)
+    {
+        Body(0, Num);
+        return;
+    }
+
+    std::lock_guard<std::mutex> DispatchLock(DispatchMutex);
+    FJob Job;
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+        Job.Body = &Body;
+        Job.Num = Num;
+        Job.BatchSize = BatchSize;
+        Job.NumBatches = NumBatches;
+        Job.Generation = CurrentJob.Generation + 1;
+        CurrentJob = Job;
+        RemainingBatches.store(NumBatches, std::memory_order_relaxed);
+        NextBatch.store(static_cast<uint64>(Job.Generation) << 32, std::memory_order_release);
+    }
+    WakeCondition.notify_all();
+
+    // 호출 스레드도 참여
+    RunBatches(Job);
+
+    std::unique_lock<std::mutex> Lock(WakeMutex);
+    DoneCondition.wait(Lock, [this]() { return RemainingBatches.load(std::memory_order_acquire) == 0; });
+    CurrentJob.Body = nullptr;
+}
+
+void FWorkerPool::WorkerMain()
+{
+    GIsPoolWorker = true;
+
+    static std::atomic<int32> NextWorkerIndex{ 0 };
+    char ThreadName[32];
+    snprintf(ThreadName, sizeof(ThreadName), "Worker %d", NextWorkerIndex.fetch_add(1));
+    FProfiler::SetThreadName(ThreadName);
+
+    uint32 SeenGeneration = 0;
+
+    while (true)
+    {
+        FJob Job;
+        {
+            std::unique_lock<std::mutex> Lock(WakeMutex);
+            WakeCondition.wait(Lock, [this, &SeenGeneration]() { return bShuttingDown || CurrentJob.Generation != SeenGeneration; });
+            if (bShuttingDown)
+            {
+                return;
+            }
+            Job = CurrentJob;
+            SeenGeneration = Job.Generation;
+        }
+
+        if (Job.Body)
+        {
+            RunBatches(Job);
+        }
+    }
+}
+
+void FWorkerPool::RunBatches(const FJob& Job)
+{
+    const uint64 GenerationBits = static_cast<uint64>(Job.Generation) << 32;
+
+    while (true)
+    {
+        // 같은 세대일 때만 인덱스를 하나 가져감
+        uint64 Current = NextBatch.load(std::memory_order_acquire);
+        int32 Batch = 0;
+        while (true)
+        {
+            if ((Current & 0xFFFFFFFF00000000ull) != GenerationBits)
+            {
+                return;
+            }
+            Batch = static_cast<int32>(Current & 0xFFFFFFFFull);
+            if (Batch >= Job.NumBatches)
+            {
+                return;
+            }
+            if (NextBatch.compare_exchange_weak(Current, Current + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+
+        const int32 Begin = Batch * Job.BatchSize;
+        const int32 End = Begin + Job.BatchSize < Job.Num ? Begin + Job.BatchSize : Job.Num;
+        {
+            PROFILE_SCOPE("ParallelFor");
+            (*Job.Body)(Begin, End);
+        }
+
+        if (RemainingBatches.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // 마지막 구간: 대기 중인 호출 스레드 깨우기
+            std::lock_guard<std::mutex> Lock(WakeMutex);
+            DoneCondition.notify_all();
+        }
+    }
+}
@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * 고정 크기 워커 스레드 풀 (프로세스 전역)
+ * - 호출한 스레드도 작업에 참여하므로 동시 실행 수 = 워커 수 + 1
+ * - 한 번에 하나의 ParallelFor만 분배, 워커 안에서의 중첩 호출은 호출 스레드에서 순차 실행
+ * - 백그라운드 작업 스레드도 순차 실행 (긴 쿡/파싱이 분배를 붙잡으면 게임 스레드의 ParallelFor가 그동안 대기하므로)
+ */
+class FWorkerPool
+{
+public:
+    static FWorkerPool& GetInstance();
+
+    // 호출 스레드를 포함한 동시 실행 수
+    int32 GetConcurrency() const { return static_cast<int32>(Workers.Num()) + 1; }
+
+    // [0, Num)을 BatchSize 단위 구간으로 나눠 병렬 실행하고 모두 끝날 때까지 대기
+    void ParallelFor(int32 Num, int32 BatchSize, const std::function<void(int32 Begin, int32 End)>& Body);
+
+    // 이후 이 스레드에서의 ParallelFor는 풀에 분배하지 않고 호출 스레드에서 순차 실행 (FBackgroundTasks 스레드가 시작 시 호출)
+    static void RunInlineOnCurrentThread();
+
+    FWorkerPool(const FWorkerPool&) = delete;
+    FWorkerPool& operator=(const FWorkerPool&) = delete;
+
+private:
+    FWorkerPool();
+    ~FWorkerPool();
+
+    // 작업 하나의 스냅샷 (워커는 WakeMutex 아래에서 복사해 사용)
+    struct FJob
+    {
+        const std::function<void(int32, int32)>* Body = nullptr;
+        int32 Num = 0;
+        int32 BatchSize = 1;
+        int32 NumBatches = 0;
+        uint32 Generation = 0;
+    };
+
+    void WorkerMain();
+    // Job에서 남은 구간을 가져가 실행 (다른 세대의 작업이면 즉시 반환)
+    void RunBatches(const FJob& Job);
+
+private:
+    TArray<std::thread> Workers;
+
+    std::mutex DispatchMutex;               // ParallelFor 호출 직렬화
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+    std::condition_variable DoneCondition;
+
+    // 현재 작업. NextBatch = (세대 << 32) | 다음 구간 인덱스
+    // 늦게 깨어난 워커가 이전 세대 기준으로 다음 작업의 구간을 가져가지 않도록 세대를 함께 비교
+    FJob CurrentJob;
+    std::atomic<uint64> NextBatch{ 0 };
+    std::atomic<int32> RemainingBatches{ 0 };
+
+    bool bShuttingDown = false;
+};
+
+inline void ParallelFor(int32 Num, int32 BatchSize, const std::function<void(int32 Begin, int32 End)>& Body)
+{
+    FWorkerPool::GetInstance().ParallelFor(Num, BatchSize, Body);
+}
@@ -11,6 +11,7 @@
 #include "World.h"
 #include "PrimitiveComponent.h"
 #include "GameObject.h"
+#include "CookedLevel.h"
 
 IMPLEMENT_CLASS(AActor)
 	BEGIN_PROPERTIES(AActor)
@@ -586,7 +587,7 @@ void AActor::DuplicateSubObjects()
 	// 1단계: 모든 컴포넌트 복제 및 '원본 -> 사본' 매핑 테이블 생성
 	// ========================================================================
 	TMap<UActorComponent*, UActorComponent*> OldToNewComponentMap;
-	TSet<UActorComponent*> NewOwnedComponents;
+	TFlatSet<UActorComponent*> NewOwnedComponents;
 
 	for (UActorComponent* OriginalComp : OwnedComponents)
 	{
@@ -681,39 +682,63 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		DestroyAllComponents();
 
 		uint32 RootUUID;
-		FJsonSerializer::ReadUint32(InOutHandle, "RootComponentId", RootUUID);
-	
-		JSON ComponentsJson;
-		if (FJsonSerializer::ReadArray(InOutHandle, "OwnedComponents", ComponentsJson))
+
+		auto AddSerializedComponent = [&](UClass* NewClass, JSON& ComponentJson)
 		{
-			// 1) OwnedComponents와 SceneComponents에 Component들 추가
-			for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson.size()); ++i)
+			UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(NewClass));
+
+			NewComponent->Serialize(bInIsLoading, ComponentJson);
+
+			// RootComponent 설정
+			if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
 			{
-				JSON ComponentJson = ComponentsJson.at(i);
-				
-				FString TypeString;
-				FJsonSerializer::ReadString(ComponentJson, "Type", TypeString);
-	
-				UClass* NewClass = UClass::FindClass(TypeString);
-	
-				UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(NewClass));
-	
-				NewComponent->Serialize(bInIsLoading, ComponentJson);
-	
-				// RootComponent 설정
-				if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
+				if (RootUUID == NewSceneComponent->GetSceneId())
 				{
-					if (RootUUID == NewSceneComponent->GetSceneId())
-					{
-						assert(NewSceneComponent);
-						SetRootComponent(NewSceneComponent);
-					}
+					assert(NewSceneComponent);
+					SetRootComponent(NewSceneComponent);
 				}
-	
-				// OwnedComponents와 SceneComponents에 Component 추가
-				AddOwnedComponent(NewComponent);
 			}
-	
+
+			// OwnedComponents와 SceneComponents에 Component 추가
+			AddOwnedComponent(NewComponent);
+		};
+
+		bool bHasComponents = false;
+		if (FCookedLevelReader* CookedReader = FCookedLevelReader::GetActive())
+		{
+			// 쿠킹된 레벨: 컴포넌트 목록은 그래프 섹션, 각 컴포넌트의 잔여 JSON은 Reader가 만들어 준다
+			RootUUID = CookedReader->GetRootComponentId();
+			for (int32 i = 0; i < CookedReader->GetNumComponents(); ++i)
+			{
+				JSON ComponentJson;
+				UClass* NewClass = CookedReader->BeginComponent(i, ComponentJson);
+				AddSerializedComponent(NewClass, ComponentJson);
+			}
+			bHasComponents = true;
+		}
+		else
+		{
+			FJsonSerializer::ReadUint32(InOutHandle, "RootComponentId", RootUUID);
+
+			JSON ComponentsJson;
+			if (FJsonSerializer::ReadArray(InOutHandle, "OwnedComponents", ComponentsJson))
+			{
+				// 1) OwnedComponents와 SceneComponents에 Component들 추가
+				for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson.size()); ++i)
+				{
+					JSON ComponentJson = ComponentsJson.at(i);
+
+					FString TypeString;
+					FJsonSerializer::ReadString(ComponentJson, "Type", TypeString);
+
+					AddSerializedComponent(UClass::FindClass(TypeString), ComponentJson);
+				}
+				bHasComponents = true;
+			}
+		}
+
+		if (bHasComponents)
+		{
 			// 2) 컴포넌트 간 부모 자식 관계 설정
 			for (auto& Component : OwnedComponents)
 			{
@@ -54,7 +54,7 @@ public:
 
     // 씬 컴포넌트(트리/렌더용)
     const TArray<USceneComponent*>& GetSceneComponents() const { return SceneComponents; }
-    const TSet<UActorComponent*>& GetOwnedComponents() const { return OwnedComponents; }
+    const TFlatSet<UActorComponent*>& GetOwnedComponents() const { return OwnedComponents; }
     UActorComponent* GetComponent(UClass* ComponentClass);
     
     // 컴포넌트 생성 (템플릿)
@@ -183,7 +183,7 @@ public:
 protected:
     // NOTE: RootComponent, CollisionComponent 등 기본 보호 컴포넌트들도
     // OwnedComponents와 SceneComponents에 포함되어 관리됨.
-    TSet<UActorComponent*> OwnedComponents;   // 모든 컴포넌트 (씬/비씬)
+    TFlatSet<UActorComponent*> OwnedComponents;   // 모든 컴포넌트 (씬/비씬)
     TArray<USceneComponent*> SceneComponents; // 씬 컴포넌트들만 별도 캐시(트리/렌더/ImGui용)
     
     bool bTickInEditor = false; // 에디터에서도 틱 허용
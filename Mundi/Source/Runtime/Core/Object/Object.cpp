@@ -1,4 +1,5 @@
 ﻿#include "pch.h"
+#include "CookedLevel.h"
 
 FString UObject::GetName()
 {
@@ -13,6 +14,18 @@ FString UObject::GetComparisonName()
 // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
+	// 쿠킹된 레벨 로드 중이면 이 객체의 프로퍼티 블롭을 바로 적용 (InOutHandle에는 리플렉션 밖의 키만 있음)
+	if (bInIsLoading)
+	{
+		if (FCookedLevelReader* CookedReader = FCookedLevelReader::GetActive())
+		{
+			if (CookedReader->ApplyPendingProperties(this))
+			{
+				return;
+			}
+		}
+	}
+
 	const TArray<FProperty>& Properties = this->GetClass()->GetAllProperties();
 
 	for (const FProperty& Prop : Properties)
@@ -34,6 +34,7 @@ namespace ObjectFactory
         idx = GUObjectArray.Add(Obj);
 
         Obj->InternalIndex = static_cast<uint32>(idx);
+        FMemoryManager::TrackObjectAllocation(Obj->GetClass());
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -60,6 +61,7 @@ namespace ObjectFactory
         idx = GUObjectArray.Add(Obj);
         //}
         Obj->InternalIndex = static_cast<uint32>(idx);
+        FMemoryManager::TrackObjectAllocation(Obj->GetClass());
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -82,12 +84,28 @@ namespace ObjectFactory
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
+        // 직전에 찾은 위치에서 양방향으로 넓혀가며 탐색 (액터와 그 컴포넌트처럼 연달아 생성된 객체를
+        // 연달아 지우는 경우가 대부분이라 거의 바로 찾음. 최악의 경우에도 각 슬롯을 한 번씩만 확인)
+        static int32 LastFoundIndex = 0;
+        const int32 NumObjects = GUObjectArray.Num();
+        const int32 Hint = LastFoundIndex < NumObjects ? LastFoundIndex : NumObjects - 1;
         int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
+        for (int32 Distance = 0; Hint >= 0; ++Distance)
         {
-            if (GUObjectArray[i] == Obj)
+            const int32 Lo = Hint - Distance;
+            const int32 Hi = Hint + Distance;
+            if (Lo < 0 && Hi >= NumObjects)
             {
-                foundIndex = i;
+                break;
+            }
+            if (Hi < NumObjects && GUObjectArray[Hi] == Obj)
+            {
+                foundIndex = Hi;
+                break;
+            }
+            if (Lo >= 0 && Lo != Hi && GUObjectArray[Lo] == Obj)
+            {
+                foundIndex = Lo;
                 break;
             }
         }
@@ -96,9 +114,11 @@ namespace ObjectFactory
             // Not managed or already deleted.
             return;
         }
+        LastFoundIndex = foundIndex;
 
         GUObjectArray[foundIndex] = nullptr;
         // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        FMemoryManager::TrackObjectDeallocation(Obj->GetClass());
         Obj->DestroyInternal();
     }
 
@@ -26,6 +26,8 @@ public:
     float               GetDurationSec() const { return DurationSec; }
     const FWideString&  GetSourcePath() const { return SourcePath; }
 
+    uint64 GetCPUBytes() const override { return PCMData.size(); }
+
 private:
     WAVEFORMATEX  WaveFormat{};      // format description (PCM only in MVP)
     std::vector<uint8> PCMData;      // interleaved PCM16 samples
@@ -398,6 +398,402 @@ namespace Collision
         return OverlapLUT[(int)ShapeA.Kind][(int)ShapeB.Kind](ShapeA, A->GetWorldTransform(), ShapeB, B->GetWorldTransform());
     }
 
+    // ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡSweep Helper 함수ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ
+    namespace
+    {
+        // 선분 Start + t * Delta 가 반지름 Radius의 구(Center)에 처음 닿는 t
+        bool SegmentSphereTOI(const FVector& Start, const FVector& Delta, const FVector& Center, float Radius, float& OutTime)
+        {
+            const FVector M = Start - Center;
+            const float A = FVector::Dot(Delta, Delta);
+            const float B = FVector::Dot(M, Delta);
+            const float C = FVector::Dot(M, M) - Radius * Radius;
+            if (C <= 0.0f || B >= 0.0f || A <= KINDA_SMALL_NUMBER)
+            {
+                return false;
+            }
+            const float Disc = B * B - A * C;
+            if (Disc < 0.0f)
+            {
+                return false;
+            }
+            const float T = (-B - std::sqrt(Disc)) / A;
+            if (T < 0.0f || T > 1.0f)
+            {
+                return false;
+            }
+            OutTime = T;
+            return true;
+        }
+
+        // 선분 vs 축 정렬 캡슐 (EdgeStart에서 Axis 방향으로 EdgeLength만큼 뻗은 박스 모서리 + 반지름)
+        // Real-Time Collision Detection 5.5.7 (Intersecting Moving Sphere Against AABB)
+        bool SegmentEdgeCapsuleTOI(const FVector& Start, const FVector& Delta, const FVector& EdgeStart, int32 Axis, float EdgeLength, float Radius, float& OutTime)
+        {
+            const int32 I = (Axis + 1) % 3;
+            const int32 J = (Axis + 2) % 3;
+
+            // 모서리 축에 수직인 평면으로 투영한 원기둥 교차
+            const float Mi = Start[I] - EdgeStart[I];
+            const float Mj = Start[J] - EdgeStart[J];
+            const float A = Delta[I] * Delta[I] + Delta[J] * Delta[J];
+            const float B = Mi * Delta[I] + Mj * Delta[J];
+            const float C = Mi * Mi + Mj * Mj - Radius * Radius;
+            if (A > KINDA_SMALL_NUMBER && C > 0.0f && B < 0.0f)
+            {
+                const float Disc = B * B - A * C;
+                if (Disc >= 0.0f)
+                {
+                    const float T = (-B - std::sqrt(Disc)) / A;
+                    const float H = Start[Axis] + Delta[Axis] * T - EdgeStart[Axis];
+                    if (T >= 0.0f && T <= 1.0f && H >= 0.0f && H <= EdgeLength)
+                    {
+                        OutTime = T;
+                        return true;
+                    }
+                }
+            }
+
+            // 원기둥 옆면을 벗어나면 양 끝 꼭짓점의 구
+            FVector EdgeEnd = EdgeStart;
+            EdgeEnd[Axis] += EdgeLength;
+
+            float T0 = 0.0f, T1 = 0.0f;
+            const bool bHit0 = SegmentSphereTOI(Start, Delta, EdgeStart, Radius, T0);
+            const bool bHit1 = SegmentSphereTOI(Start, Delta, EdgeEnd, Radius, T1);
+            if (!bHit0 && !bHit1)
+            {
+                return false;
+            }
+            OutTime = (bHit0 && bHit1) ? FMath::Min(T0, T1) : (bHit0 ? T0 : T1);
+            return true;
+        }
+
+        // Minkowski 합(Box를 Extent만큼 확장)에 대한 slab test. 닿지 않으면 false, EnterAxis < 0 이면 시작부터 확장 박스 안
+        bool SweepExpandedSlab(const FVector& Start, const FVector& Delta, const FVector& Extent, const FAABB& Box,
+            float& OutEnterTime, int32& OutEnterAxis, float& OutEnterSign)
+        {
+            float TEnter = 0.0f;
+            float TExit = 1.0f;
+            OutEnterAxis = -1;
+            OutEnterSign = 0.0f;
+
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                const float Min = Box.Min[Axis] - Extent[Axis];
+                const float Max = Box.Max[Axis] + Extent[Axis];
+                const float S = Start[Axis];
+                const float D = Delta[Axis];
+
+                if (std::fabs(D) < 1e-8f)
+                {
+                    if (S < Min || S > Max)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                const float Inv = 1.0f / D;
+                float T0 = (Min - S) * Inv;
+                float T1 = (Max - S) * Inv;
+                float Sign = -1.0f;     // Min 면으로 진입 -> 법선은 -Axis
+                if (T0 > T1)
+                {
+                    std::swap(T0, T1);
+                    Sign = 1.0f;
+                }
+                if (T0 > TEnter)
+                {
+                    TEnter = T0;
+                    OutEnterAxis = Axis;
+                    OutEnterSign = Sign;
+                }
+                TExit = FMath::Min(TExit, T1);
+                if (TEnter > TExit)
+                {
+                    return false;
+                }
+            }
+
+            OutEnterTime = TEnter;
+            return true;
+        }
+
+        // 삼각형 위에서 P에 가장 가까운 점 (Real-Time Collision Detection 5.1.5)
+        FVector ClosestPointOnTriangle(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+        {
+            const FVector AB = B - A;
+            const FVector AC = C - A;
+            const FVector AP = P - A;
+            const float D1 = FVector::Dot(AB, AP);
+            const float D2 = FVector::Dot(AC, AP);
+            if (D1 <= 0.0f && D2 <= 0.0f) return A;
+
+            const FVector BP = P - B;
+            const float D3 = FVector::Dot(AB, BP);
+            const float D4 = FVector::Dot(AC, BP);
+            if (D3 >= 0.0f && D4 <= D3) return B;
+
+            const float VC = D1 * D4 - D3 * D2;
+            if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+            {
+                return A + AB * (D1 / (D1 - D3));
+            }
+
+            const FVector CP = P - C;
+            const float D5 = FVector::Dot(AB, CP);
+            const float D6 = FVector::Dot(AC, CP);
+            if (D6 >= 0.0f && D5 <= D6) return C;
+
+            const float VB = D5 * D2 - D1 * D6;
+            if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+            {
+                return A + AC * (D2 / (D2 - D6));
+            }
+
+            const float VA = D3 * D6 - D5 * D4;
+            if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+            {
+                return B + (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6)));
+            }
+
+            const float Denom = 1.0f / (VA + VB + VC);
+            return A + AB * (VB * Denom) + AC * (VC * Denom);
+        }
+
+        // 선분 Start + t * Delta 가 임의 방향 모서리 E0-E1 둘레 원기둥(반지름 Radius)의 옆면에 처음 닿는 t와 모서리 위 접점
+        // 양 끝의 구는 SegmentSphereTOI로 따로 검사
+        bool SegmentEdgeCylinderTOI(const FVector& Start, const FVector& Delta, const FVector& E0, const FVector& E1, float Radius, float& OutTime, FVector& OutContact)
+        {
+            const FVector E = E1 - E0;
+            const FVector M = Start - E0;
+            const float EE = FVector::Dot(E, E);
+            const float ED = FVector::Dot(E, Delta);
+            const float EM = FVector::Dot(E, M);
+            const float DD = FVector::Dot(Delta, Delta);
+
+            // A = |E x Delta|^2. 모서리와 평행하면 옆면에 새로 닿을 수 없다
+            const float A = EE * DD - ED * ED;
+            const float B = EE * FVector::Dot(M, Delta) - EM * ED;
+            const float C = EE * (FVector::Dot(M, M) - Radius * Radius) - EM * EM;
+            if (A <= KINDA_SMALL_NUMBER * EE * DD || C <= 0.0f || B >= 0.0f)
+            {
+                return false;
+            }
+            const float Disc = B * B - A * C;
+            if (Disc < 0.0f)
+            {
+                return false;
+            }
+            const float T = (-B - std::sqrt(Disc)) / A;
+            const float S = (EM + T * ED) / EE;
+            if (T < 0.0f || T > 1.0f || S < 0.0f || S > 1.0f)
+            {
+                return false;
+            }
+            OutTime = T;
+            OutContact = E0 + E * S;
+            return true;
+        }
+    }
+
+    bool SweepExtentAABB(const FVector& Start, const FVector& Delta, const FVector& Extent, const FAABB& Box, float& OutTime, FVector& OutNormal)
+    {
+        int32 EnterAxis = -1;
+        float EnterSign = 0.0f;
+        if (!SweepExpandedSlab(Start, Delta, Extent, Box, OutTime, EnterAxis, EnterSign) || EnterAxis < 0)
+        {
+            return false;
+        }
+
+        OutNormal = FVector(0.0f, 0.0f, 0.0f);
+        OutNormal[EnterAxis] = EnterSign;
+        return true;
+    }
+
+    bool SweepSphereAABB(const FVector& Start, const FVector& Delta, float Radius, const FAABB& Box, float& OutTime, FVector& OutNormal)
+    {
+        // 1) 반지름만큼 확장한 박스로 후보 판정 (둥근 모서리 영역은 보수적으로 포함됨)
+        float TEnter = 0.0f;
+        int32 EnterAxis = -1;
+        float EnterSign = 0.0f;
+        if (!SweepExpandedSlab(Start, Delta, FVector(Radius, Radius, Radius), Box, TEnter, EnterAxis, EnterSign))
+        {
+            return false;
+        }
+
+        // 2) 진입점(시작부터 확장 박스 안이면 시작점)이 원래 박스 밖에 있는 축을 세어 면/모서리/꼭짓점 영역 판정
+        const FVector P = Start + Delta * TEnter;
+        int32 OutsideMask = 0;
+        int32 NumOutside = 0;
+        FVector Corner = P;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            if (P[Axis] < Box.Min[Axis])
+            {
+                Corner[Axis] = Box.Min[Axis];
+            }
+            else if (P[Axis] > Box.Max[Axis])
+            {
+                Corner[Axis] = Box.Max[Axis];
+            }
+            else
+            {
+                continue;
+            }
+            OutsideMask |= (1 << Axis);
+            ++NumOutside;
+        }
+
+        float Time = TEnter;
+        if (NumOutside >= 2)
+        {
+            // 모서리(2축) 또는 꼭짓점(3축) 영역: 해당 모서리 캡슐과 다시 교차
+            bool bHit = false;
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                // 모서리 영역이면 박스 안쪽 축이 모서리 방향, 꼭짓점 영역이면 세 모서리 모두 검사
+                if (NumOutside == 2 && (OutsideMask & (1 << Axis)))
+                {
+                    continue;
+                }
+
+                FVector EdgeStart = Corner;
+                EdgeStart[Axis] = Box.Min[Axis];
+                float EdgeTime = 0.0f;
+                if (SegmentEdgeCapsuleTOI(Start, Delta, EdgeStart, Axis, Box.Max[Axis] - Box.Min[Axis], Radius, EdgeTime))
+                {
+                    Time = bHit ? FMath::Min(Time, EdgeTime) : EdgeTime;
+                    bHit = true;
+                }
+            }
+            if (!bHit)
+            {
+                return false;
+            }
+        }
+        else if (EnterAxis < 0)
+        {
+            // 면 영역에서 확장 박스 안 = 이미 겹침
+            return false;
+        }
+
+        // 3) 법선 = 충돌 시점의 구 중심 - 박스 위 최근접점
+        const FVector Center = Start + Delta * Time;
+        FVector Closest = Center;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Closest[Axis] = FMath::Clamp(Closest[Axis], Box.Min[Axis], Box.Max[Axis]);
+        }
+
+        const FVector Normal = Center - Closest;
+        if (Normal.SizeSquared() > KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER)
+        {
+            OutNormal = Normal.GetSafeNormal();
+        }
+        else
+        {
+            OutNormal = FVector(0.0f, 0.0f, 0.0f);
+            OutNormal[EnterAxis >= 0 ? EnterAxis : 2] = EnterAxis >= 0 ? EnterSign : 1.0f;
+        }
+        OutTime = Time;
+        return true;
+    }
+
+    bool SweepAgainstAABB(const FSweepQuery& Query, const FAABB& Box, float& OutTime, FVector& OutNormal)
+    {
+        const FVector Delta = Query.End - Query.Start;
+        if (Query.Extent.IsZero())
+        {
+            return SweepSphereAABB(Query.Start, Delta, Query.Radius, Box, OutTime, OutNormal);
+        }
+        return SweepExtentAABB(Query.Start, Delta, Query.Extent, Box, OutTime, OutNormal);
+    }
+
+    bool SweepSphereTriangle(const FVector& Start, const FVector& Delta, float Radius, const FVector& A, const FVector& B, const FVector& C, float& OutTime, FVector& OutNormal)
+    {
+        FVector N = FVector::Cross(B - A, C - A);
+        const float NormalLengthSq = N.SizeSquared();
+        if (NormalLengthSq <= KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER)
+        {
+            // 퇴화 삼각형
+            return false;
+        }
+        N = N * (1.0f / std::sqrt(NormalLengthSq));
+        const FVector Winding = N;
+
+        // 시작부터 겹쳐 있으면 무시 (SweepSphereAABB와 같이 빠져나가는 움직임을 막지 않음)
+        if ((Start - ClosestPointOnTriangle(Start, A, B, C)).SizeSquared() <= Radius * Radius)
+        {
+            return false;
+        }
+
+        // 법선을 구가 있는 쪽으로 (양면)
+        float Distance = FVector::Dot(Start - A, N);
+        if (Distance < 0.0f)
+        {
+            N = -N;
+            Distance = -Distance;
+        }
+
+        // 1) 면: 평면까지 Radius만큼 남았을 때의 접점이 삼각형 안이면 그 시점이 가장 이르다
+        const float Approach = -FVector::Dot(Delta, N);
+        if (Distance >= Radius)
+        {
+            // 평면에 닿지 못하면 평면 위의 모서리/꼭짓점에도 닿지 못한다
+            if (Approach <= 0.0f || Distance - Radius > Approach)
+            {
+                return false;
+            }
+
+            const float T = (Distance - Radius) / Approach;
+            const FVector Contact = Start + Delta * T - N * Radius;
+            // 안쪽 판정은 뒤집기 전 법선(감김 방향) 기준
+            if (FVector::Dot(FVector::Cross(B - A, Contact - A), Winding) >= 0.0f
+                && FVector::Dot(FVector::Cross(C - B, Contact - B), Winding) >= 0.0f
+                && FVector::Dot(FVector::Cross(A - C, Contact - C), Winding) >= 0.0f)
+            {
+                OutTime = T;
+                OutNormal = N;
+                return true;
+            }
+        }
+
+        // 2) 모서리 원기둥과 꼭짓점 구 중 가장 먼저 닿는 것
+        const FVector Vertices[3] = { A, B, C };
+        bool bHit = false;
+        float BestTime = 1.0f;
+        FVector BestContact;
+        for (int32 i = 0; i < 3; ++i)
+        {
+            float T = 0.0f;
+            FVector Contact;
+            if (SegmentEdgeCylinderTOI(Start, Delta, Vertices[i], Vertices[(i + 1) % 3], Radius, T, Contact) && (!bHit || T < BestTime))
+            {
+                bHit = true;
+                BestTime = T;
+                BestContact = Contact;
+            }
+            if (SegmentSphereTOI(Start, Delta, Vertices[i], Radius, T) && (!bHit || T < BestTime))
+            {
+                bHit = true;
+                BestTime = T;
+                BestContact = Vertices[i];
+            }
+        }
+        if (!bHit)
+        {
+            return false;
+        }
+
+        // 법선 = 충돌 시점의 구 중심 - 접점
+        const FVector Normal = Start + Delta * BestTime - BestContact;
+        OutNormal = Normal.SizeSquared() > KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER ? Normal.GetSafeNormal() : N;
+        OutTime = BestTime;
+        return true;
+    }
+
 
 }
 
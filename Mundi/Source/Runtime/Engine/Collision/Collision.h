@@ -5,6 +5,30 @@ struct FBoundingSphere;
 struct FShape;
 
 class UShapeComponent;
+class UPrimitiveComponent;
+class AActor;
+
+// 스윕 질의 하나 (구 또는 AABB 형태의 도형을 Start -> End로 이동)
+// Extent가 0이면 반지름 Radius의 구, 아니면 반크기 Extent의 AABB(캡슐/박스의 보수적 근사)
+struct FSweepQuery
+{
+    FVector Start;
+    FVector End;
+    float Radius = 0.0f;
+    FVector Extent = FVector(0.0f, 0.0f, 0.0f);
+    const AActor* IgnoreActor = nullptr;    // 이 액터가 소유한 컴포넌트는 무시 (자기 자신)
+};
+
+// 스윕 결과
+struct FSweepHit
+{
+    bool bBlockingHit = false;
+    float Time = 1.0f;                      // TOI, Start(0) ~ End(1)
+    FVector Location;                       // 충돌 시점의 도형 중심
+    FVector ImpactNormal;                   // 충돌한 면의 법선 (월드)
+    UPrimitiveComponent* Component = nullptr;
+    AActor* Actor = nullptr;
+};
 
 namespace Collision
 {
@@ -42,4 +66,19 @@ namespace Collision
     
     bool CheckOverlap(const UShapeComponent* A, const UShapeComponent* B);
 
+    // ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡSweep Helper 함수ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ
+    // 구(Start + t * Delta, t ∈ [0,1])가 Box와 처음 닿는 시점과 법선 (모서리/꼭짓점의 둥근 영역까지 정확히 처리)
+    // 시작 시점에 이미 겹쳐 있으면 false (빠져나가는 움직임을 막지 않도록)
+    bool SweepSphereAABB(const FVector& Start, const FVector& Delta, float Radius, const FAABB& Box, float& OutTime, FVector& OutNormal);
+
+    // 반크기 Extent의 AABB를 이동시킬 때 Box와 처음 닿는 시점과 법선 (Minkowski 합 + slab test)
+    bool SweepExtentAABB(const FVector& Start, const FVector& Delta, const FVector& Extent, const FAABB& Box, float& OutTime, FVector& OutNormal);
+
+    // Query 형태에 맞는 스윕 함수로 분기
+    bool SweepAgainstAABB(const FSweepQuery& Query, const FAABB& Box, float& OutTime, FVector& OutNormal);
+
+    // 구(Start + t * Delta, t ∈ [0,1])가 삼각형 ABC와 처음 닿는 시점과 법선 (면 -> 모서리 캡슐 -> 꼭짓점 순, 양면)
+    // 시작 시점에 이미 겹쳐 있으면 false
+    bool SweepSphereTriangle(const FVector& Start, const FVector& Delta, float Radius, const FVector& A, const FVector& B, const FVector& C, float& OutTime, FVector& OutNormal);
+
 }
\ No newline at end of file
@@ -26,6 +26,9 @@
 #include "SkeletalMesh.h"
 #include "Skeleton.h"
 
+// 클릭마다 남는 결과 로그는 Verbose (LOG LEVEL LogPicking Verbose로 켠다)
+DEFINE_LOG_CATEGORY_STATIC(LogPicking, Log)
+
 FRay MakeRayFromMouse(const FMatrix& InView,
 	const FMatrix& InProj)
 {
@@ -267,14 +270,12 @@ AActor* CPickingSystem::PerformPicking(const TArray<AActor*>& Actors, ACameraAct
 
 	if (pickedIndex >= 0)
 	{
-		char buf[160];
-		sprintf_s(buf, "[Pick] Hit primitive %d at t=%.3f (Speed=NORMAL)\n", pickedIndex, pickedT);
-		UE_LOG(buf);
+		UE_LOG_CAT(LogPicking, Verbose, "[Pick] Hit primitive %d at t=%.3f (Speed=NORMAL)", pickedIndex, pickedT);
 		return Actors[pickedIndex];
 	}
 	else
 	{
-		UE_LOG("[Pick] No hit (Speed=FAST)\n");
+		UE_LOG_CAT(LogPicking, Verbose, "[Pick] No hit (Speed=FAST)");
 		return nullptr;
 	}
 }
@@ -324,14 +325,12 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 
 	if (pickedIndex >= 0)
 	{
-		char buf[160];
-		sprintf_s(buf, "[Viewport Pick] Hit primitive %d at t=%.3f\n", pickedIndex, pickedT);
-		UE_LOG(buf);
+		UE_LOG_CAT(LogPicking, Verbose, "[Viewport Pick] Hit primitive %d at t=%.3f", pickedIndex, pickedT);
 		return Actors[pickedIndex];
 	}
 	else
 	{
-		UE_LOG("[Viewport Pick] No hit\n");
+		UE_LOG_CAT(LogPicking, Verbose, "[Viewport Pick] No hit");
 		return nullptr;
 	}
 }
@@ -384,17 +383,13 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 	if (PickedActor)
 	{
 		PickedIndex = 0;
-		char buf[160];
-		sprintf_s(buf, "[Pick] Hit primitive %d at t=%.3f | time=%.6lf ms\n",
+		UE_LOG_CAT(LogPicking, Verbose, "[Pick] Hit primitive %d at t=%.3f | time=%.6lf ms",
 			PickedIndex, PickedT, Milliseconds);
-		UE_LOG(buf);
 		return PickedActor;
 	}
 	else
 	{
-		char buf[160];
-		sprintf_s(buf, "[Pick] No hit | time=%.6f ms\n", Milliseconds);
-		UE_LOG(buf);
+		UE_LOG_CAT(LogPicking, Verbose, "[Pick] No hit | time=%.6f ms", Milliseconds);
 		return nullptr;
 	}
 }
@@ -676,8 +671,8 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 			const FVector4 LocalDir4 = RayDir4 * InvWorld;
 			const FRay LocalRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z) };
 
-			// 캐시된 BVH 사용 (동일 OBJ 경로는 동일 BVH 공유)
-			FMeshBVH* BVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
+			// 캐시된 BVH 사용 (지오메트리 내용이 같은 메시는 동일 BVH 공유)
+			FMeshBVH* BVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(StaticMesh);
 			if (BVH)
 			{
 				float THitLocal;
@@ -815,7 +810,7 @@ FBonePicking CPickingSystem::PerformBonePicking(USkeletalMeshComponent* Skeletal
 	FMatrix ComponentWorldMatrix = SkeletalMeshComponent->GetWorldMatrix();
 	int32 BoneCount = Skeleton->GetBoneCount();
 
-	UE_LOG("[BonePicking] Testing %d bones (JointRadius=%.3f, BoneScale=%.3f)",
+	UE_LOG_CAT(LogPicking, Verbose, "[BonePicking] Testing %d bones (JointRadius=%.3f, BoneScale=%.3f)",
 		BoneCount, JointRadius, BoneScale);
 
 	float MinDistance = FLT_MAX;
@@ -906,14 +901,14 @@ FBonePicking CPickingSystem::PerformBonePicking(USkeletalMeshComponent* Skeletal
 
 	if (Result.IsValid())
 	{
-		UE_LOG("[BonePicking] Bone picked: Index=%d, Type=%d, Distance=%.3f",
+		UE_LOG_CAT(LogPicking, Verbose, "[BonePicking] Bone picked: Index=%d, Type=%d, Distance=%.3f",
 			Result.BoneIndex,
 			static_cast<int32>(Result.PickingType),
 			Result.Distance);
 	}
 	else
 	{
-		UE_LOG("[BonePicking] No bone picked");
+		UE_LOG_CAT(LogPicking, Verbose, "[BonePicking] No bone picked");
 	}
 
 	return Result;
@@ -72,9 +72,10 @@ void UBoxComponent::RenderDebugVolume(URenderer* Renderer) const
 	const FVector Extent = BoxExtent;
 	const FTransform WorldTransform = GetWorldTransform();
 
-	TArray<FVector> StartPoints;
-	TArray<FVector> EndPoints;
-	TArray<FVector4> Colors;
+	// 모서리 12개 (매 프레임 힙 할당 없음)
+	TArray<FVector, TInlineAllocator<12>> StartPoints;
+	TArray<FVector, TInlineAllocator<12>> EndPoints;
+	TArray<FVector4, TInlineAllocator<12>> Colors;
 
 	FVector local[8] = {
 		{-Extent.X, -Extent.Y, -Extent.Z}, {+Extent.X, -Extent.Y, -Extent.Z},
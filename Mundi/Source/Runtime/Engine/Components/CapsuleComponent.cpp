@@ -89,14 +89,14 @@ void UCapsuleComponent::RenderDebugVolume(URenderer* Renderer) const
     const int NumOfSphereSlice = 4;
     const int NumHemisphereSegments = 8; 
 
-    TArray<FVector> StartPoints;
-    TArray<FVector> EndPoints;
-    TArray<FVector4> Colors;
-
-    TArray<FVector> TopRingLocal;
-    TArray<FVector> BottomRingLocal;
-    TopRingLocal.Reserve(NumOfSphereSlice);
-    BottomRingLocal.Reserve(NumOfSphereSlice);
+    // 선 개수가 고정이므로 인라인 버퍼로 (매 프레임 힙 할당 없음)
+    constexpr int NumLines = NumOfSphereSlice * 3 + NumHemisphereSegments * 4;
+    TArray<FVector, TInlineAllocator<NumLines>> StartPoints;
+    TArray<FVector, TInlineAllocator<NumLines>> EndPoints;
+    TArray<FVector4, TInlineAllocator<NumLines>> Colors;
+
+    TArray<FVector, TInlineAllocator<NumOfSphereSlice>> TopRingLocal;
+    TArray<FVector, TInlineAllocator<NumOfSphereSlice>> BottomRingLocal;
 
      
     //윗면 아랫면 
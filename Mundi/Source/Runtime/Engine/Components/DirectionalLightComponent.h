@@ -13,7 +13,7 @@ public:
 	virtual ~UDirectionalLightComponent() override;
 
 public:
-	void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) override;
+	void GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests) override;
 
 	// 월드 회전을 반영한 라이트 방향 반환 (Transform의 Forward 벡터)
 	FVector GetLightDirection() const;
@@ -25,7 +25,7 @@ public:
 	virtual FLinearColor GetLightColorWithIntensity() const;
 	void OnRegister(UWorld* InWorld) override;
 
-	virtual void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) {};
+	virtual void GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests) {};
 
 	// Serialization & Duplication
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
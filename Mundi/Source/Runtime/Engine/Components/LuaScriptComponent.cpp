@@ -42,6 +42,12 @@ void ULuaScriptComponent::BeginPlay()
 
 	auto LuaVM = GetWorld()->GetLuaManager();
 	Lua  = &(LuaVM->GetState());
+	LuaManager = LuaVM;
+
+	// 이 컴포넌트의 Lua 호출 중 발생한 할당은 스크립트 경로 단위로 집계
+	LuaAllocator = &LuaVM->GetAllocator();
+	MemoryCounter = LuaVM->GetScriptMemoryCounter(ScriptFilePath.empty() ? FString("(no script)") : ScriptFilePath);
+	FLuaMemoryScope MemoryScope(*LuaAllocator, MemoryCounter);
 
 	// 독립된 환경 생성, Engine Object&Util 주입
 	Env = LuaVM->CreateEnvironment();
@@ -110,6 +116,7 @@ void ULuaScriptComponent::OnBeginOverlap(UPrimitiveComponent* MyComp, UPrimitive
 
 		if (OtherGameObject)
 		{
+			FLuaMemoryScope MemoryScope(*LuaAllocator, MemoryCounter);
 			auto Result = FuncOnBeginOverlap(OtherGameObject);
 			if (!Result.valid())
 			{
@@ -138,6 +145,7 @@ void ULuaScriptComponent::OnEndOverlap(UPrimitiveComponent* MyComp, UPrimitiveCo
 
 		if (OtherGameObject)
 		{
+			FLuaMemoryScope MemoryScope(*LuaAllocator, MemoryCounter);
 			auto Result = FuncOnEndOverlap(OtherGameObject);
 			if (!Result.valid())
 			{
@@ -165,6 +173,7 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent
 
 		if (OtherGameObject)
 		{
+			FLuaMemoryScope MemoryScope(*LuaAllocator, MemoryCounter);
 			auto Result = FuncOnHit(OtherGameObject);
 			if (!Result.valid())
 			{
@@ -179,7 +188,31 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
+	// Batched 모드: 이번 프레임 dt만 기록하고 실제 호출은 FLuaManager::DispatchBatchedTick에서 일괄 처리
+	if (LuaManager && FuncTick.valid())
+	{
+		if (LuaManager->IsBatchedTickEnabled())
+		{
+			if (BatchedTickIndex < 0)
+			{
+				BatchedTickIndex = LuaManager->RegisterBatchedTick(this, FuncTick);
+			}
+			if (BatchedTickIndex >= 0)
+			{
+				LuaManager->QueueBatchedTick(BatchedTickIndex, DeltaTime);
+				return;
+			}
+		}
+		else if (BatchedTickIndex >= 0)
+		{
+			// 실행 중 모드가 꺼진 경우 슬롯 반납 후 개별 호출로 복귀
+			LuaManager->UnregisterBatchedTick(BatchedTickIndex);
+			BatchedTickIndex = -1;
+		}
+	}
+
 	if (FuncTick.valid()) {
+		FLuaMemoryScope MemoryScope(*LuaAllocator, MemoryCounter);
 		auto Result = FuncTick(DeltaTime);
 		if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s\n", Err.what()); }
 	}
@@ -189,6 +222,7 @@ void ULuaScriptComponent::EndPlay()
 {
 	if (FuncEndPlay.valid())
 	{
+		FLuaMemoryScope MemoryScope(*LuaAllocator, MemoryCounter);
 		auto Result = FuncEndPlay();
 		if (!Result.valid())
 		{
@@ -226,8 +260,14 @@ void ULuaScriptComponent::CleanupLuaResources()
 		{
 			// 1. 코루틴 정리 (가장 중요. Use-After-Free 방지)
 			LuaVM->GetScheduler().CancelByOwner(this);
+
+			if (BatchedTickIndex >= 0)
+			{
+				LuaVM->UnregisterBatchedTick(BatchedTickIndex);
+			}
 		}
 	}
+	BatchedTickIndex = -1;
 
 	// 2. Lua 참조 해제
 	FuncBeginPlay = sol::nil;
@@ -238,6 +278,9 @@ void ULuaScriptComponent::CleanupLuaResources()
 	FuncEndPlay = sol::nil;
 	Env = sol::nil;
 	Lua = nullptr;
+	LuaManager = nullptr;
+	LuaAllocator = nullptr;
+	MemoryCounter = nullptr;
 
 	bIsLuaCleanedUp = true;
 }
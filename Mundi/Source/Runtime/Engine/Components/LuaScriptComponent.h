@@ -7,6 +7,9 @@ namespace sol { class state; }
 using state = sol::state;
 
 class USceneComponent;
+class FLuaAllocator;
+class FLuaManager;
+struct FLuaMemoryCounter;
 
 class ULuaScriptComponent : public UActorComponent
 {
@@ -30,6 +33,11 @@ public:
 	bool Call(const char* FuncName, sol::variadic_args VarArgs); // 다른 클래스가 날 호출할 때 씀
 
 	void CleanupLuaResources();
+
+	const FString& GetScriptFilePath() const { return ScriptFilePath; }
+	// FLuaManager가 Batched Tick 슬롯을 재배치할 때 호출
+	void SetBatchedTickIndex(int32 InIndex) { BatchedTickIndex = InIndex; }
+
 protected:
 	// 이 컴포넌트가 실행할 .lua 스크립트 파일의 경로 (에디터에서 설정)
 	FString ScriptFilePath{};
@@ -37,6 +45,13 @@ protected:
 	sol::state* Lua = nullptr;
 	sol::environment Env{};
 
+	FLuaManager* LuaManager = nullptr;
+	int32 BatchedTickIndex = -1;		// FLuaManager Batched Tick 슬롯 (-1: 미등록)
+
+	/* 스크립트별 메모리 귀속 (FLuaManager 소유) */
+	FLuaAllocator* LuaAllocator = nullptr;
+	FLuaMemoryCounter* MemoryCounter = nullptr;
+
 	/* 함수 캐시 */
 	sol::protected_function FuncBeginPlay{};
 	sol::protected_function FuncTick{};
@@ -3,6 +3,8 @@
 #include "StaticMesh.h"
 #include "ObjManager.h"
 #include "Shader.h"
+#include "SceneView.h"
+#include "RenderSettings.h"
 
 
 //extern "C" void LuaBind_Anchor_UMeshComponent() {}
@@ -21,6 +23,7 @@ IMPLEMENT_CLASS(UMeshComponent)
 
 BEGIN_PROPERTIES(UMeshComponent)
     ADD_PROPERTY_ARRAY(EPropertyType::Material, MaterialSlots, "Materials", true)
+    ADD_PROPERTY_RANGE(int32, ForcedLOD, "LOD", -1.0f, 7.0f, true, "고정할 LOD 번호입니다. -1이면 화면 크기로 자동 선택합니다.")
 END_PROPERTIES()
 
 UMeshComponent::UMeshComponent()
@@ -143,6 +146,70 @@ UMaterialInstanceDynamic* UMeshComponent::CreateAndSetMaterialInstanceDynamic(ui
     return nullptr;
 }
 
+int32 UMeshComponent::SelectLOD(const FSceneView* View)
+{
+    const TArray<FMeshLOD>* LODs = GetMeshLODs();
+    if (!LODs || LODs->empty() || !View)
+    {
+        return 0;
+    }
+
+    const int32 MaxLOD = static_cast<int32>(LODs->size());
+    const int32 ViewForcedLOD = View->RenderSettings ? View->RenderSettings->GetForcedLOD() : -1;
+    if (0 <= ForcedLOD || 0 <= ViewForcedLOD)
+    {
+        LastSelectedLOD = std::min(0 <= ForcedLOD ? ForcedLOD : ViewForcedLOD, MaxLOD);
+        return LastSelectedLOD;
+    }
+
+    // 이 뷰의 히스테리시스 상태 찾기 (없으면 빈 자리 또는 가장 오래된 상태를 재사용)
+    const uint64 Frame = FProfiler::GetFrameNumber();
+    FViewLODState* State = nullptr;
+    for (FViewLODState& Candidate : ViewLODStates)
+    {
+        if (Candidate.ViewStateKey == View->ViewStateKey)
+        {
+            State = &Candidate;
+            break;
+        }
+    }
+    if (!State)
+    {
+        if (ViewLODStates.Num() < MaxViewLODStates)
+        {
+            ViewLODStates.Add(FViewLODState{});
+            State = &ViewLODStates[ViewLODStates.Num() - 1];
+        }
+        else
+        {
+            State = &ViewLODStates[0];
+            for (FViewLODState& Candidate : ViewLODStates)
+            {
+                if (Candidate.LastFrame < State->LastFrame)
+                {
+                    State = &Candidate;
+                }
+            }
+        }
+        *State = FViewLODState{ View->ViewStateKey, 0, Frame };
+    }
+    else if (State->LastFrame == Frame)
+    {
+        // 같은 프레임의 그림자 패스 등은 메인 패스와 같은 LOD를 쓴다
+        LastSelectedLOD = std::min(State->LOD, MaxLOD);
+        return LastSelectedLOD;
+    }
+
+    const FAABB Bounds = GetWorldAABB();
+    const float ScreenSize = View->ComputeScreenSize(Bounds.GetCenter(), Bounds.GetHalfExtent().Size());
+    const float Hysteresis = View->RenderSettings ? View->RenderSettings->GetLODHysteresis() : 0.0f;
+
+    State->LOD = MeshLOD::Select(*LODs, ScreenSize, std::min(State->LOD, MaxLOD), Hysteresis);
+    State->LastFrame = Frame;
+    LastSelectedLOD = State->LOD;
+    return LastSelectedLOD;
+}
+
 void UMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
@@ -241,7 +308,10 @@ void UMeshComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
 
-    
+    // 뷰별 LOD 상태는 원본 쪽 뷰포트 기준이므로 복사본은 새로 고른다
+    ViewLODStates.Empty();
+    LastSelectedLOD = 0;
+
     // 원본 MID -> 복사본 MID 매핑 테이블
     TMap<UMaterialInstanceDynamic*, UMaterialInstanceDynamic*> OldToNewMIDMap;
 
@@ -2,6 +2,7 @@
 #include "PrimitiveComponent.h"
 
 class UShader;
+class FSceneView;
 
 class UMeshComponent : public UPrimitiveComponent
 {
@@ -34,10 +35,32 @@ public:
     void SetMaterialScalarByUser(const uint32 InMaterialSlotIndex, const FString& ParameterName, float Value);
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+
+    // 자동 생성 LOD 선택 (CollectMeshBatches가 뷰마다 호출). 히스테리시스 상태는 뷰(FSceneView::ViewStateKey)별로 유지하고,
+    // 같은 프레임에 같은 뷰로 다시 부르면(그림자 패스 등) 처음 고른 LOD를 그대로 돌려준다
+    int32 SelectLOD(const FSceneView* View);
+    // 마지막으로 어느 뷰에서든 고른 LOD (통계용)
+    int32 GetCurrentLOD() const { return LastSelectedLOD; }
+    // LOD1부터. 자동 생성 LOD가 없는 메시면 nullptr
+    virtual const TArray<FMeshLOD>* GetMeshLODs() const { return nullptr; }
+
 protected:
     TArray<UMaterialInterface*> MaterialSlots;
     TArray<UMaterialInstanceDynamic*> DynamicMaterialInstances;
+
+    int32 ForcedLOD = -1;       // 이 컴포넌트만 고정할 LOD (-1이면 자동)
     
 private:
+    struct FViewLODState
+    {
+        const void* ViewStateKey = nullptr;
+        int32 LOD = 0;
+        uint64 LastFrame = 0;
+    };
+    static constexpr int32 MaxViewLODStates = 8;    // 넘치면 가장 오래 안 그려진 뷰의 상태를 재사용
+
+    TArray<FViewLODState> ViewLODStates;
+    int32 LastSelectedLOD = 0;
+
     bool bCastShadows = true;   // TODO: 프로퍼티로 추가 필요
 };
\ No newline at end of file
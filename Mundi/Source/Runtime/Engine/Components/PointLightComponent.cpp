@@ -21,7 +21,7 @@ UPointLightComponent::~UPointLightComponent()
 {
 }
 
-void UPointLightComponent::GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests)
+void UPointLightComponent::GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests)
 {
 	// 라이트의 월드 위치와 영향 반경 가져오기
 	FVector LightPosition = this->GetWorldLocation();
@@ -13,7 +13,7 @@ public:
 	virtual ~UPointLightComponent() override;
 
 public:
-	void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) override;
+	void GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests) override;
 
 	// Source Radius
 	void SetSourceRadius(float InRadius) { SourceRadius = InRadius; }
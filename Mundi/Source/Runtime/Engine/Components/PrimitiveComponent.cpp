@@ -12,7 +12,7 @@ IMPLEMENT_CLASS(UPrimitiveComponent)
 END_PROPERTIES()
 
 
-UPrimitiveComponent::UPrimitiveComponent() : bGenerateOverlapEvents(true)
+UPrimitiveComponent::UPrimitiveComponent() : bGenerateOverlapEvents(true), bBlockComponent(true)
 {
 }
 
@@ -30,7 +30,7 @@ public:
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
-    virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
+    virtual void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
 
     virtual UMaterialInterface* GetMaterial(uint32 InElementIndex) const
     {
@@ -70,6 +70,10 @@ public:
     void SetGenerateOverlapEvents(bool bEnable) { bGenerateOverlapEvents = bEnable; }
     bool GetGenerateOverlapEvents() const { return bGenerateOverlapEvents; }
 
+    // Block toggle API (false면 스윕/이동을 막지 않는 오버랩 전용)
+    void SetBlockComponent(bool bEnable) { bBlockComponent = bEnable; }
+    bool GetBlockComponent() const { return bBlockComponent; }
+
     // ───── 직렬화 ────────────────────────────
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
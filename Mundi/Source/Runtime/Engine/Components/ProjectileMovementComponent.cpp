@@ -3,6 +3,20 @@
 #include "SceneComponent.h"
 #include "Actor.h"
 #include "ObjectFactory.h"
+#include "ShapeComponent.h"
+#include "Collision.h"
+#include "BVHierarchy.h"
+#include "WorldPartitionManager.h"
+#include "World.h"
+
+namespace
+{
+    // 한 틱 안에서 허용하는 최대 충돌 응답 횟수 (모서리에 끼었을 때 무한 반복 방지)
+    constexpr int32 MaxSweepIterations = 4;
+
+    // 충돌 지점에서 표면과 띄워 두는 거리 (다음 스윕이 시작부터 겹치지 않도록)
+    constexpr float SweepSkinDistance = 0.001f;
+}
 
 IMPLEMENT_CLASS(UProjectileMovementComponent)
 
@@ -16,6 +30,14 @@ BEGIN_PROPERTIES(UProjectileMovementComponent)
     ADD_PROPERTY(float, ProjectileLifespan, "발사체", true, "발사체 생명 시간입니다")
     ADD_PROPERTY(bool, bIsHomingProjectile, "호밍", true, "호밍 기능을 활성화합니다")
     ADD_PROPERTY(float, HomingAccelerationMagnitude, "호밍", true, "호밍 가속도 크기입니다")
+    ADD_PROPERTY(bool, bSweepCollision, "충돌", true, "항상 월드와 스윕 충돌을 검사합니다 (기본값 꺼짐: 빠른 발사체 스윕 설정에 따름)")
+    ADD_PROPERTY(bool, bSweepWhenFast, "충돌", true, "한 틱 이동량이 충돌 크기보다 클 때 스윕합니다 (터널링 방지, 기본값 켜짐)")
+    ADD_PROPERTY(bool, bShouldBounce, "충돌", true, "충돌 시 반사합니다 (기본값 꺼짐)")
+    ADD_PROPERTY(bool, bSlideOnImpact, "충돌", true, "반사하지 않을 때 표면을 따라 미끄러집니다 (기본값 꺼짐: 정지)")
+    ADD_PROPERTY_RANGE(float, Bounciness, "충돌", 0.0f, 1.0f, true, "반발 계수입니다")
+    ADD_PROPERTY_RANGE(float, Friction, "충돌", 0.0f, 1.0f, true, "충돌 시 접선 속도 감소 비율입니다")
+    ADD_PROPERTY(float, BounceVelocityStopThreshold, "충돌", true, "반사 후 속도가 이보다 작으면 정지합니다")
+    ADD_PROPERTY(float, CollisionRadius, "충돌", true, "충돌 구 반지름입니다 (0이면 컴포넌트 도형 사용)")
     
 END_PROPERTIES()
 
@@ -31,6 +53,14 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     , ProjectileLifespan(0.0f)  // 0 = 무제한
     , CurrentLifetime(0.0f)
     , bAutoDestroyWhenLifespanExceeded(false)
+    , bSweepCollision(false)  // 켜면 느린 틱도 항상 스윕
+    , bSweepWhenFast(true)    // 충돌 크기보다 멀리 가는 틱만 스윕 (느린 발사체는 기존처럼 통과 이동)
+    , bShouldBounce(false)
+    , bSlideOnImpact(false)
+    , Bounciness(0.6f)
+    , Friction(0.0f)
+    , BounceVelocityStopThreshold(0.05f)
+    , CollisionRadius(0.0f)
     , bIsActive(true)
 {
     bCanEverTick = true;
@@ -42,7 +72,7 @@ UProjectileMovementComponent::~UProjectileMovementComponent()
 
 void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
 {
-    if (!UpdatedComponent)
+    if (!UpdatedComponent || !bIsActive)
     {
         return;
     }
@@ -85,8 +115,12 @@ void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
     LimitVelocity();
 
     // 6. 위치 업데이트
-    FVector Delta = Velocity * DeltaSeconds;
-    if (!Delta.IsZero())
+    const FVector Delta = Velocity * DeltaSeconds;
+    if (ShouldSweep(Delta))
+    {
+        MoveWithSweep(DeltaSeconds);
+    }
+    else if (!Delta.IsZero())
     {
         UpdatedComponent->AddWorldOffset(Delta);
     }
@@ -146,6 +180,153 @@ void UProjectileMovementComponent::LimitVelocity()
     }
 }
 
+void UProjectileMovementComponent::BuildSweepQuery(const FVector& Delta, FSweepQuery& OutQuery) const
+{
+    OutQuery = FSweepQuery();
+    OutQuery.IgnoreActor = UpdatedComponent ? UpdatedComponent->GetOwner() : nullptr;
+    if (!UpdatedComponent)
+    {
+        return;
+    }
+
+    const FVector Location = UpdatedComponent->GetWorldLocation();
+    OutQuery.Start = Location;
+    OutQuery.End = Location + Delta;
+
+    if (CollisionRadius > 0.0f)
+    {
+        OutQuery.Radius = CollisionRadius;
+        return;
+    }
+
+    // 구는 정확한 구 스윕, 박스/캡슐은 월드 AABB로 보수적 근사
+    if (UShapeComponent* Shape = Cast<UShapeComponent>(UpdatedComponent))
+    {
+        FShape ShapeData;
+        Shape->GetShape(ShapeData);
+        if (ShapeData.Kind == EShapeKind::Sphere)
+        {
+            OutQuery.Radius = ShapeData.Sphere.SphereRadius * Collision::UniformScaleMax(Collision::AbsVec(UpdatedComponent->GetWorldScale()));
+            return;
+        }
+    }
+
+    if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(UpdatedComponent))
+    {
+        const FAABB Box = Primitive->GetWorldAABB();
+        const FVector Extent = Box.GetHalfExtent();
+        if (Extent.X > 0.0f || Extent.Y > 0.0f || Extent.Z > 0.0f)
+        {
+            OutQuery.Start = Box.GetCenter();
+            OutQuery.End = OutQuery.Start + Delta;
+            OutQuery.Extent = Extent;
+        }
+    }
+}
+
+bool UProjectileMovementComponent::ShouldSweep(const FVector& Delta) const
+{
+    if (bSweepCollision)
+    {
+        return true;
+    }
+    if (!bSweepWhenFast || Delta.IsZero())
+    {
+        return false;
+    }
+
+    // 한 틱에 자기 크기보다 멀리 가면 이산 이동으로는 얇은 벽을 건너뛸 수 있다
+    FSweepQuery Query;
+    BuildSweepQuery(Delta, Query);
+    const float CollisionSize = Query.Radius > 0.0f
+        ? Query.Radius
+        : FMath::Min(Query.Extent.X, FMath::Min(Query.Extent.Y, Query.Extent.Z));
+    return CollisionSize < Delta.Size();
+}
+
+void UProjectileMovementComponent::MoveWithSweep(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+    FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+
+    float RemainingTime = DeltaTime;
+    for (int32 Iteration = 0; Iteration < MaxSweepIterations && RemainingTime > 0.0f && bIsActive; ++Iteration)
+    {
+        const FVector Delta = Velocity * RemainingTime;
+        if (Delta.IsZero())
+        {
+            break;
+        }
+
+        FSweepQuery Query;
+        BuildSweepQuery(Delta, Query);
+
+        FSweepHit Hit;
+        if (!BVH || !BVH->SweepClosest(Query, Hit))
+        {
+            UpdatedComponent->AddWorldOffset(Delta);
+            break;
+        }
+
+        // 충돌 지점 직전까지 이동
+        const float SafeTime = FMath::Max(0.0f, Hit.Time - SweepSkinDistance / Delta.Size());
+        UpdatedComponent->AddWorldOffset(Delta * SafeTime);
+        RemainingTime *= (1.0f - Hit.Time);
+
+        HandleImpact(Hit);
+    }
+}
+
+void UProjectileMovementComponent::HandleImpact(const FSweepHit& Hit)
+{
+    const FVector& Normal = Hit.ImpactNormal;
+    const float NormalSpeed = FVector::Dot(Velocity, Normal);
+
+    if (bShouldBounce)
+    {
+        // 법선 성분은 반발 계수만큼 반사, 접선 성분은 마찰만큼 감소
+        const FVector NormalVelocity = Normal * NormalSpeed;
+        const FVector TangentVelocity = Velocity - NormalVelocity;
+        Velocity = TangentVelocity * (1.0f - FMath::Clamp(Friction, 0.0f, 1.0f)) - NormalVelocity * Bounciness;
+
+        if (Velocity.Size() < BounceVelocityStopThreshold)
+        {
+            StopMovement();
+            bIsActive = false;
+        }
+    }
+    else if (bSlideOnImpact)
+    {
+        // 표면을 파고드는 성분만 제거
+        if (NormalSpeed < 0.0f)
+        {
+            Velocity -= Normal * NormalSpeed;
+        }
+        if (Velocity.IsZero())
+        {
+            StopMovement();
+            bIsActive = false;
+        }
+    }
+    else
+    {
+        StopMovement();
+        bIsActive = false;
+    }
+
+    // Hit 이벤트 (양방향)
+    UPrimitiveComponent* MyComponent = Cast<UPrimitiveComponent>(UpdatedComponent);
+    if (AActor* Owner = UpdatedComponent->GetOwner())
+    {
+        Owner->OnComponentHit.Broadcast(MyComponent, Hit.Component);
+    }
+    if (Hit.Actor)
+    {
+        Hit.Actor->OnComponentHit.Broadcast(Hit.Component, MyComponent);
+    }
+}
+
 void UProjectileMovementComponent::ComputeHomingAcceleration(float DeltaTime)
 {
     if (HomingAccelerationMagnitude <= 0.0f)
@@ -4,11 +4,16 @@
 
 class AActor;
 class USceneComponent;
+struct FSweepQuery;
+struct FSweepHit;
 
 /**
  * UProjectileMovementComponent
  * 발사체(Projectile)의 움직임을 시뮬레이션하는 컴포넌트
  * 중력, 바운스, 호밍 등의 기능을 지원
+ * 스윕하면 월드 BVH에 대해 터널링 없이 충돌 지점(TOI)에서 정지/반사/미끄러짐 처리
+ * - bSweepCollision: 항상 스윕 (기본값 꺼짐)
+ * - bSweepWhenFast: 한 틱 이동량이 충돌 크기보다 큰 틱만 스윕 (기본값 켜짐, 끄면 느린 발사체처럼 통과)
  */
 class UProjectileMovementComponent : public UMovementComponent
 {
@@ -69,12 +74,44 @@ public:
     void ResetLifetime() { CurrentLifetime = 0.0f; }
     float GetCurrentLifetime() const { return CurrentLifetime; }
 
+    // 충돌 속성 Getter/Setter
+    void SetSweepCollision(bool bNewSweep) { bSweepCollision = bNewSweep; }
+    bool GetSweepCollision() const { return bSweepCollision; }
+
+    void SetSweepWhenFast(bool bNewSweepWhenFast) { bSweepWhenFast = bNewSweepWhenFast; }
+    bool GetSweepWhenFast() const { return bSweepWhenFast; }
+
+    void SetShouldBounce(bool bNewShouldBounce) { bShouldBounce = bNewShouldBounce; }
+    bool ShouldBounce() const { return bShouldBounce; }
+
+    void SetSlideOnImpact(bool bNewSlide) { bSlideOnImpact = bNewSlide; }
+    bool GetSlideOnImpact() const { return bSlideOnImpact; }
+
+    void SetBounciness(float NewBounciness) { Bounciness = NewBounciness; }
+    float GetBounciness() const { return Bounciness; }
+
+    void SetFriction(float NewFriction) { Friction = NewFriction; }
+    float GetFriction() const { return Friction; }
+
+    void SetCollisionRadius(float NewRadius) { CollisionRadius = NewRadius; }
+    float GetCollisionRadius() const { return CollisionRadius; }
+
+    // 이번 틱 이동(Delta)에 대한 스윕 질의 구성 (헤드리스 배치 스윕에서도 사용)
+    void BuildSweepQuery(const FVector& Delta, FSweepQuery& OutQuery) const;
+
 protected:
     // 내부 헬퍼 함수
     void LimitVelocity();
     void ComputeHomingAcceleration(float DeltaTime);
     void UpdateRotationFromVelocity();
 
+    // 이번 틱 이동(Delta)을 스윕할지 (bSweepCollision, 또는 bSweepWhenFast이고 이동량이 충돌 크기보다 클 때)
+    bool ShouldSweep(const FVector& Delta) const;
+    // 스윕 이동: 충돌하면 충돌 지점까지 이동 후 응답하고, 남은 시간만큼 같은 틱 안에서 다시 이동
+    void MoveWithSweep(float DeltaTime);
+    // 충돌 응답 (반사/미끄러짐/정지) + Hit 이벤트
+    void HandleImpact(const FSweepHit& Hit);
+
 protected:
     // [PIE] 값 복사
 
@@ -115,6 +152,31 @@ protected:
     // 생명 시간 초과 시 자동 파괴 여부
     bool bAutoDestroyWhenLifespanExceeded;
 
+    // === 충돌 속성 ===
+    // 월드 BVH 스윕 충돌 사용 여부 (기본값 false: 아래 bSweepWhenFast에 따름)
+    bool bSweepCollision;
+
+    // 한 틱에 충돌 반지름(박스는 가장 짧은 반폭)보다 멀리 가는 틱은 스윕 (기본값 true, 빠른 발사체의 얇은 벽 터널링 방지)
+    bool bSweepWhenFast;
+
+    // 충돌 시 반사 여부 (기본값 false, false면 bSlideOnImpact에 따라 미끄러지거나 정지)
+    bool bShouldBounce;
+
+    // 반사하지 않을 때 표면을 따라 미끄러질지 여부 (기본값 false: 정지)
+    bool bSlideOnImpact;
+
+    // 반발 계수 (법선 방향 속도 보존 비율)
+    float Bounciness;
+
+    // 마찰 (충돌 시 접선 방향 속도 감소 비율, 0~1)
+    float Friction;
+
+    // 반사 후 속도가 이보다 작으면 정지 (m/s)
+    float BounceVelocityStopThreshold;
+
+    // 충돌 구 반지름, 0이면 UpdatedComponent의 도형/AABB를 사용
+    float CollisionRadius;
+
     // === 상태 ===
     // 활성화 상태
     bool bIsActive;
@@ -54,8 +54,8 @@ public:
  
 protected: 
 	mutable FAABB WorldAABB; //브로드 페이즈 용 
-	TSet<UShapeComponent*> OverlapNow; // 이번 프레임에서 overlap 된 Shap Comps
-	TSet<UShapeComponent*> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache
+	TFlatSet<UShapeComponent*> OverlapNow; // 이번 프레임에서 overlap 된 Shap Comps
+	TFlatSet<UShapeComponent*> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache
 	 
 
 	FVector4 ShapeColor ; 
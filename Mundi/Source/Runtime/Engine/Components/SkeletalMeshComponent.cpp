@@ -12,7 +12,9 @@
 #include "MeshBatchElement.h"
 #include "Material.h"
 #include "SceneView.h"
+#include "VectorSoA.h"
 #include "BoneDebugComponent.h"
+#include "VertexQuantization.h"
 
 IMPLEMENT_CLASS(USkeletalMeshComponent)
 
@@ -141,7 +143,7 @@ void USkeletalMeshComponent::ResetBoneTransforms()
 	bNeedsBoneTransformUpdate = false;
 }
 
-void USkeletalMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkeletalMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!SkeletalMesh)
 	{
@@ -188,22 +190,15 @@ void USkeletalMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMe
 	const bool bHasSections = !MeshGroupInfos.IsEmpty();
 	const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
 
+	// 자동 생성 LOD는 이 뷰의 화면 크기로 고른다 (뷰포트마다 따로)
+	const int32 LODIndex = SelectLOD(View);
+
 	for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
 	{
+		// 섹션 범위는 이 뷰에서 고른 LOD 기준 (LOD0이면 그룹 범위 그대로)
 		uint32 IndexCount = 0;
 		uint32 StartIndex = 0;
-
-		if (bHasSections)
-		{
-			const FGroupInfo& Group = MeshGroupInfos[SectionIndex];
-			IndexCount = Group.IndexCount;
-			StartIndex = Group.StartIndex;
-		}
-		else
-		{
-			IndexCount = SkeletalMesh->GetIndexCount();
-			StartIndex = 0;
-		}
+		SkeletalMesh->GetLODSection(LODIndex, SectionIndex, StartIndex, IndexCount);
 
 		if (IndexCount == 0)
 		{
@@ -248,6 +243,11 @@ void USkeletalMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMe
 	}
 }
 
+const TArray<FMeshLOD>* USkeletalMeshComponent::GetMeshLODs() const
+{
+	return SkeletalMesh ? &SkeletalMesh->GetLODs() : nullptr;
+}
+
 FAABB USkeletalMeshComponent::GetWorldAABB() const
 {
 	const FTransform WorldTransform = GetWorldTransform();
@@ -264,34 +264,7 @@ FAABB USkeletalMeshComponent::GetWorldAABB() const
 	const FVector LocalMin = FVector(-1.0f, -1.0f, -1.0f);
 	const FVector LocalMax = FVector(1.0f, 1.0f, 1.0f);
 
-	// 8개의 코너를 World Space로 변환
-	const FVector LocalCorners[8] = {
-		FVector(LocalMin.X, LocalMin.Y, LocalMin.Z),
-		FVector(LocalMax.X, LocalMin.Y, LocalMin.Z),
-		FVector(LocalMin.X, LocalMax.Y, LocalMin.Z),
-		FVector(LocalMax.X, LocalMax.Y, LocalMin.Z),
-		FVector(LocalMin.X, LocalMin.Y, LocalMax.Z),
-		FVector(LocalMax.X, LocalMin.Y, LocalMax.Z),
-		FVector(LocalMin.X, LocalMax.Y, LocalMax.Z),
-		FVector(LocalMax.X, LocalMax.Y, LocalMax.Z)
-	};
-
-	FVector4 WorldMin4 = FVector4(LocalCorners[0].X, LocalCorners[0].Y, LocalCorners[0].Z, 1.0f) * WorldMatrix;
-	FVector4 WorldMax4 = WorldMin4;
-
-	for (int32 CornerIndex = 1; CornerIndex < 8; ++CornerIndex)
-	{
-		const FVector4 WorldPos = FVector4(LocalCorners[CornerIndex].X,
-			LocalCorners[CornerIndex].Y,
-			LocalCorners[CornerIndex].Z,
-			1.0f) * WorldMatrix;
-		WorldMin4 = WorldMin4.ComponentMin(WorldPos);
-		WorldMax4 = WorldMax4.ComponentMax(WorldPos);
-	}
-
-	FVector WorldMin = FVector(WorldMin4.X, WorldMin4.Y, WorldMin4.Z);
-	FVector WorldMax = FVector(WorldMax4.X, WorldMax4.Y, WorldMax4.Z);
-	return FAABB(WorldMin, WorldMax);
+	return FSoAMath::TransformAABB(FAABB(LocalMin, LocalMax), WorldMatrix);
 }
 
 USkeleton* USkeletalMeshComponent::GetSkeleton() const
@@ -344,37 +317,13 @@ void USkeletalMeshComponent::StartUpdateBoneRecursive()
 	UpdateBoneRecursive(0, FMatrix::Identity());
 }
 
-void USkeletalMeshComponent::PerformCPUSkinning()
+namespace
 {
-	if (!SkeletalMesh || !bEnableCPUSkinning)
-	{
-		return;
-	}
-
-	// Show Flag 체크: Skeletal Mesh가 렌더링되지 않으면 CPU Skinning도 건너뛰기
-	UWorld* World = GetWorld();
-	if (World && !World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes))
+	// 정점 하나를 최대 4개 Bone Influence로 Skinning (FSkinnedVertex / FQuantizedSkinnedVertex 공용)
+	template<typename TBoneIndex>
+	inline void SkinVertex(const FVector& Position, const FVector& Normal, const FVector2D& UV, const FVector4& Tangent,
+		const TBoneIndex BoneIndices[4], const float BoneWeights[4], const TArray<FMatrix>& BoneMatrices, FNormalVertex& DstVert)
 	{
-		return;
-	}
-
-	const TArray<FSkinnedVertex>& SourceVertices = SkeletalMesh->GetVerticesRef();
-	const TArray<FMatrix>& BoneMatricesRef = GetBoneMatrices();
-
-	if (SourceVertices.empty() || BoneMatricesRef.empty())
-	{
-		return;
-	}
-
-	// Skinned Vertices 준비 (GPU 전송용)
-	SkinnedVertices.resize(SourceVertices.size());
-
-	// 각 Vertex Skinning
-	for (size_t VertIndex = 0; VertIndex < SourceVertices.size(); VertIndex++)
-	{
-		const FSkinnedVertex& SrcVert = SourceVertices[VertIndex];
-		FNormalVertex& DstVert = SkinnedVertices[VertIndex];
-
 		// Skinning 계산
 		FVector SkinnedPos(0, 0, 0);
 		FVector SkinnedNormal(0, 0, 0);
@@ -383,17 +332,17 @@ void USkeletalMeshComponent::PerformCPUSkinning()
 		// 최대 4개의 Bone Influence 적용
 		for (int32 i = 0; i < 4; i++)
 		{
-			int32 BoneIndex = SrcVert.BoneIndices[i];
-			float Weight = SrcVert.BoneWeights[i];
+			int32 BoneIndex = static_cast<int32>(BoneIndices[i]);
+			float Weight = BoneWeights[i];
 
-			if (Weight > 0.0f && BoneIndex >= 0 && BoneIndex < static_cast<int32>(BoneMatricesRef.size()))
+			if (Weight > 0.0f && BoneIndex >= 0 && BoneIndex < static_cast<int32>(BoneMatrices.size()))
 			{
-				const FMatrix& BoneMatrix = BoneMatricesRef[BoneIndex];
+				const FMatrix& BoneMatrix = BoneMatrices[BoneIndex];
 
 				// Position Skinning (Affine Transform)
-				FVector4 Pos4 = FVector4(SrcVert.Position.X,
-					SrcVert.Position.Y,
-					SrcVert.Position.Z,
+				FVector4 Pos4 = FVector4(Position.X,
+					Position.Y,
+					Position.Z,
 					1.0f);  // w=1 (위치)
 				FVector4 TransformedPos = Pos4 * BoneMatrix;
 				SkinnedPos += FVector(TransformedPos.X,
@@ -401,9 +350,9 @@ void USkeletalMeshComponent::PerformCPUSkinning()
 					TransformedPos.Z) * Weight;
 
 				// Normal Skinning (3x3 회전만 적용)
-				FVector4 Normal4 = FVector4(SrcVert.Normal.X,
-					SrcVert.Normal.Y,
-					SrcVert.Normal.Z,
+				FVector4 Normal4 = FVector4(Normal.X,
+					Normal.Y,
+					Normal.Z,
 					0.0f);  // w=0 (방향)
 				FVector4 TransformedNormal = Normal4 * BoneMatrix;
 				SkinnedNormal += FVector(TransformedNormal.X,
@@ -411,9 +360,9 @@ void USkeletalMeshComponent::PerformCPUSkinning()
 					TransformedNormal.Z) * Weight;
 
 				// Tangent Skinning
-				FVector4 Tangent4 = FVector4(SrcVert.Tangent.X,
-					SrcVert.Tangent.Y,
-					SrcVert.Tangent.Z,
+				FVector4 Tangent4 = FVector4(Tangent.X,
+					Tangent.Y,
+					Tangent.Z,
 					0.0f);  // w=0 (방향)
 				FVector4 TransformedTangent = Tangent4 * BoneMatrix;
 				SkinnedTangent += FVector(TransformedTangent.X,
@@ -425,17 +374,88 @@ void USkeletalMeshComponent::PerformCPUSkinning()
 		// 결과 저장 (FNormalVertex 형식)
 		DstVert.pos = SkinnedPos;
 		DstVert.normal = SkinnedNormal.GetNormalized();
-		DstVert.tex = SrcVert.UV;
+		DstVert.tex = UV;
 
 		// Tangent 저장 (w 성분 유지)
 		FVector NormalizedTangent = SkinnedTangent.GetNormalized();
 		DstVert.Tangent = FVector4(NormalizedTangent.X,
 			NormalizedTangent.Y,
 			NormalizedTangent.Z,
-			SrcVert.Tangent.W);
+			Tangent.W);
 
 		DstVert.color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
 	}
+}
+
+void USkeletalMeshComponent::SkinVertices(const TArray<FSkinnedVertex>& SourceVertices, const TArray<FMatrix>& BoneMatrices, TArray<FNormalVertex>& OutVertices)
+{
+	OutVertices.resize(SourceVertices.size());
+	for (size_t VertIndex = 0; VertIndex < SourceVertices.size(); VertIndex++)
+	{
+		const FSkinnedVertex& SrcVert = SourceVertices[VertIndex];
+		SkinVertex(SrcVert.Position, SrcVert.Normal, SrcVert.UV, SrcVert.Tangent, SrcVert.BoneIndices, SrcVert.BoneWeights,
+			BoneMatrices, OutVertices[VertIndex]);
+	}
+}
+
+void USkeletalMeshComponent::SkinVertices(const TArray<FQuantizedSkinnedVertex>& SourceVertices, const FVertexQuantizationParams& Params,
+	const TArray<FMatrix>& BoneMatrices, TArray<FNormalVertex>& OutVertices)
+{
+	OutVertices.resize(SourceVertices.size());
+	for (size_t VertIndex = 0; VertIndex < SourceVertices.size(); VertIndex++)
+	{
+		// 정점마다 레지스터에서 복원하고 바로 Skinning (복원한 FSkinnedVertex 배열을 따로 두지 않는다)
+		const FQuantizedSkinnedVertex& SrcVert = SourceVertices[VertIndex];
+		const FVector Tangent = FVertexQuantizer::DecodeOctahedral(SrcVert.Tangent);
+		const float BoneWeights[4] = {
+			SrcVert.BoneWeights[0] / 255.0f,
+			SrcVert.BoneWeights[1] / 255.0f,
+			SrcVert.BoneWeights[2] / 255.0f,
+			SrcVert.BoneWeights[3] / 255.0f };
+		SkinVertex(FVertexQuantizer::DecodePosition(SrcVert.Position, Params), FVertexQuantizer::DecodeOctahedral(SrcVert.Normal),
+			FVertexQuantizer::DecodeUV(SrcVert.UV, Params), FVector4(Tangent.X, Tangent.Y, Tangent.Z, static_cast<float>(SrcVert.TangentSign)),
+			SrcVert.BoneIndices, BoneWeights, BoneMatrices, OutVertices[VertIndex]);
+	}
+}
+
+void USkeletalMeshComponent::PerformCPUSkinning()
+{
+	if (!SkeletalMesh || !bEnableCPUSkinning)
+	{
+		return;
+	}
+
+	// Show Flag 체크: Skeletal Mesh가 렌더링되지 않으면 CPU Skinning도 건너뛰기
+	UWorld* World = GetWorld();
+	if (World && !World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes))
+	{
+		return;
+	}
+
+	const TArray<FSkinnedVertex>& SourceVertices = SkeletalMesh->GetVerticesRef();
+	const TArray<FMatrix>& BoneMatricesRef = GetBoneMatrices();
+
+	if (SourceVertices.empty() || BoneMatricesRef.empty())
+	{
+		return;
+	}
+
+	// Skinned Vertices 준비 (GPU 전송용)
+	// 압축 스트림을 켜면 정점당 80 대신 28 bytes를 읽는다 (Bone 인덱스가 255를 넘어 만들 수 없으면 전체 정밀도로)
+	const TArray<FQuantizedSkinnedVertex>* QuantizedVertices = nullptr;
+	if (World && World->GetRenderSettings().IsQuantizedSkinningEnabled())
+	{
+		QuantizedVertices = SkeletalMesh->GetQuantizedVertices();
+	}
+
+	if (QuantizedVertices)
+	{
+		SkinVertices(*QuantizedVertices, SkeletalMesh->GetQuantizationParams(), BoneMatricesRef, SkinnedVertices);
+	}
+	else
+	{
+		SkinVertices(SourceVertices, BoneMatricesRef, SkinnedVertices);
+	}
 
 	// GPU Buffer 업데이트
 	if (SkeletalMesh->UsesDynamicBuffer() && !SkinnedVertices.empty())
@@ -2,6 +2,9 @@
 #include "SkinnedMeshComponent.h"
 
 class UBoneDebugComponent;
+struct FSkinnedVertex;
+struct FQuantizedSkinnedVertex;
+struct FVertexQuantizationParams;
 
 /**
  * USkeletalMeshComponent
@@ -86,6 +89,16 @@ public:
 	 */
 	void PerformCPUSkinning();
 
+	/**
+	 * CPU Skinning 커널 (PerformCPUSkinning, MESH QUANTIZE 벤치마크 공용)
+	 * @param SourceVertices - Bind Pose 정점 (전체 정밀도 또는 압축 스트림)
+	 * @param BoneMatrices - InverseBindPose * BoneTransform
+	 * @param OutVertices - Skinning 결과 (GPU 전송용)
+	 */
+	static void SkinVertices(const TArray<FSkinnedVertex>& SourceVertices, const TArray<FMatrix>& BoneMatrices, TArray<FNormalVertex>& OutVertices);
+	static void SkinVertices(const TArray<FQuantizedSkinnedVertex>& SourceVertices, const FVertexQuantizationParams& Params,
+		const TArray<FMatrix>& BoneMatrices, TArray<FNormalVertex>& OutVertices);
+
 	void StartUpdateBoneRecursive();
 
 	/**
@@ -120,7 +133,8 @@ public:
 	 */
 	UBoneDebugComponent* GetBoneDebugComponent() const { return BoneDebugComponent; }
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	const TArray<FMeshLOD>* GetMeshLODs() const override;
 
 	FAABB GetWorldAABB() const override;
 
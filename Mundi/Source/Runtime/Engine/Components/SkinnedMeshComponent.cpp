@@ -20,7 +20,7 @@ USkinnedMeshComponent::~USkinnedMeshComponent()
 {
 }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	// Base 클래스는 렌더링하지 않음
 	// USkeletalMeshComponent에서 오버라이드하여 구현
@@ -74,9 +74,10 @@ void USphereComponent::RenderDebugVolume(URenderer* Renderer) const
     const float Radius = SphereRadius;
     const int NumSegments = 16;
 
-    TArray<FVector> StartPoints;
-    TArray<FVector> EndPoints;
-    TArray<FVector4> Colors;
+    // 원 3개 분량을 인라인 버퍼로 (매 프레임 힙 할당 없음)
+    TArray<FVector, TInlineAllocator<NumSegments * 3>> StartPoints;
+    TArray<FVector, TInlineAllocator<NumSegments * 3>> EndPoints;
+    TArray<FVector4, TInlineAllocator<NumSegments * 3>> Colors;
 
     // XY circle (Z fixed)
     for (int i = 0; i < NumSegments; ++i)
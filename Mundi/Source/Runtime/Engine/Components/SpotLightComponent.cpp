@@ -57,7 +57,7 @@ USpotLightComponent::~USpotLightComponent()
 {
 }
 
-void USpotLightComponent::GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests)
+void USpotLightComponent::GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests)
 {
 	FShadowRenderRequest ShadowRenderRequest;
 	ShadowRenderRequest.LightOwner = this;
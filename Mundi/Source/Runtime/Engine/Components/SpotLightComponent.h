@@ -15,7 +15,7 @@ public:
 	virtual ~USpotLightComponent() override;
 
 public:
-	void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) override;
+	void GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests) override;
 
 	// Cone Angles
 	void SetInnerConeAngle(float InAngle)
@@ -12,6 +12,7 @@
 #include "MeshBatchElement.h"
 #include "Material.h"
 #include "SceneView.h"
+#include "VectorSoA.h"
 #include "LuaBindHelpers.h"
 
 
@@ -46,13 +47,19 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 }
 
 
-void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UStaticMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!StaticMesh || !StaticMesh->GetStaticMeshAsset())
 	{
 		return;
 	}
 
+	// 축출된 메시는 여기서 다시 올리기를 요청하고, 올라올 때까지 그리지 않는다
+	if (!StaticMesh->GetVertexBuffer())
+	{
+		return;
+	}
+
 	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -84,22 +91,15 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 	const bool bHasSections = !MeshGroupInfos.IsEmpty();
 	const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
 
+	// 자동 생성 LOD는 이 뷰의 화면 크기로 고른다 (뷰포트마다 따로)
+	const int32 LODIndex = SelectLOD(View);
+
 	for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
 	{
+		// 섹션 범위는 이 뷰에서 고른 LOD 기준 (LOD0이면 그룹 범위 그대로)
 		uint32 IndexCount = 0;
 		uint32 StartIndex = 0;
-
-		if (bHasSections)
-		{
-			const FGroupInfo& Group = MeshGroupInfos[SectionIndex];
-			IndexCount = Group.IndexCount;
-			StartIndex = Group.StartIndex;
-		}
-		else
-		{
-			IndexCount = StaticMesh->GetIndexCount();
-			StartIndex = 0;
-		}
+		StaticMesh->GetLODSection(LODIndex, SectionIndex, StartIndex, IndexCount);
 
 		if (IndexCount == 0)
 		{
@@ -154,16 +154,12 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 	StaticMesh = UResourceManager::GetInstance().Load<UStaticMesh>(PathFileName);
 	if (StaticMesh && StaticMesh->GetStaticMeshAsset())
 	{
-		const TArray<FGroupInfo>& GroupInfos = StaticMesh->GetMeshGroupInfo();
-
-		// 4. 새 메시 정보에 맞게 슬롯을 재설정합니다.
-		MaterialSlots.resize(GroupInfos.size()); // ClearDynamicMaterials()에서 비워졌으므로, 새 크기로 재할당
-
-		for (int i = 0; i < GroupInfos.size(); ++i)
-		{
-			SetMaterialByName(i, GroupInfos[i].InitialMaterialName);
-		}
-		MarkWorldPartitionDirty();
+		// ClearDynamicMaterials()에서 슬롯이 비워졌으므로, 새 메시 정보에 맞게 전부 재설정됩니다.
+		OnStaticMeshLoaded();
+	}
+	else if (StaticMesh && StaticMesh->IsPendingLoad())
+	{
+		// 다른 곳에서 LoadAsync 중인 메시: 로드가 끝나면 OnStaticMeshLoaded에서 슬롯을 채웁니다.
 	}
 	else
 	{
@@ -173,6 +169,45 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 	}
 }
 
+void UStaticMeshComponent::SetStaticMeshAsync(const FString& PathFileName, ETaskPriority Priority)
+{
+	ClearDynamicMaterials();
+
+	StaticMesh = UResourceManager::GetInstance().LoadAsync<UStaticMesh>(PathFileName, Priority).Get();
+	if (StaticMesh && StaticMesh->GetStaticMeshAsset())
+	{
+		// 이미 로드돼 있던 메시
+		OnStaticMeshLoaded();
+	}
+	MarkWorldPartitionDirty();
+}
+
+void UStaticMeshComponent::OnStaticMeshLoaded()
+{
+	if (!StaticMesh || !StaticMesh->GetStaticMeshAsset())
+	{
+		return;
+	}
+
+	// 로드를 기다리는 동안 지정된 슬롯은 그대로 두고, 빈 슬롯만 메시의 기본 머티리얼로 채웁니다.
+	const TArray<FGroupInfo>& GroupInfos = StaticMesh->GetMeshGroupInfo();
+	const size_t NumExistingSlots = MaterialSlots.size();
+	if (NumExistingSlots < GroupInfos.size())
+	{
+		MaterialSlots.resize(GroupInfos.size());
+		for (size_t i = NumExistingSlots; i < GroupInfos.size(); ++i)
+		{
+			SetMaterialByName(static_cast<uint32>(i), GroupInfos[i].InitialMaterialName);
+		}
+	}
+	MarkWorldPartitionDirty();
+}
+
+const TArray<FMeshLOD>* UStaticMeshComponent::GetMeshLODs() const
+{
+	return StaticMesh ? StaticMesh->GetLODs() : nullptr;
+}
+
 FAABB UStaticMeshComponent::GetWorldAABB() const
 {
 	const FTransform WorldTransform = GetWorldTransform();
@@ -184,38 +219,7 @@ FAABB UStaticMeshComponent::GetWorldAABB() const
 		return FAABB(Origin, Origin);
 	}
 
-	const FAABB LocalBound = StaticMesh->GetLocalBound();
-	const FVector LocalMin = LocalBound.Min;
-	const FVector LocalMax = LocalBound.Max;
-
-	const FVector LocalCorners[8] = {
-		FVector(LocalMin.X, LocalMin.Y, LocalMin.Z),
-		FVector(LocalMax.X, LocalMin.Y, LocalMin.Z),
-		FVector(LocalMin.X, LocalMax.Y, LocalMin.Z),
-		FVector(LocalMax.X, LocalMax.Y, LocalMin.Z),
-		FVector(LocalMin.X, LocalMin.Y, LocalMax.Z),
-		FVector(LocalMax.X, LocalMin.Y, LocalMax.Z),
-		FVector(LocalMin.X, LocalMax.Y, LocalMax.Z),
-		FVector(LocalMax.X, LocalMax.Y, LocalMax.Z)
-	};
-
-	FVector4 WorldMin4 = FVector4(LocalCorners[0].X, LocalCorners[0].Y, LocalCorners[0].Z, 1.0f) * WorldMatrix;
-	FVector4 WorldMax4 = WorldMin4;
-
-	for (int32 CornerIndex = 1; CornerIndex < 8; ++CornerIndex)
-	{
-		const FVector4 WorldPos = FVector4(LocalCorners[CornerIndex].X
-			, LocalCorners[CornerIndex].Y
-			, LocalCorners[CornerIndex].Z
-			, 1.0f)
-			* WorldMatrix;
-		WorldMin4 = WorldMin4.ComponentMin(WorldPos);
-		WorldMax4 = WorldMax4.ComponentMax(WorldPos);
-	}
-
-	FVector WorldMin = FVector(WorldMin4.X, WorldMin4.Y, WorldMin4.Z);
-	FVector WorldMax = FVector(WorldMax4.X, WorldMax4.Y, WorldMax4.Z);
-	return FAABB(WorldMin, WorldMax);
+	return FSoAMath::TransformAABB(StaticMesh->GetLocalBound(), WorldMatrix);
 }
 
 void UStaticMeshComponent::OnTransformUpdated()
@@ -2,6 +2,7 @@
 #include "MeshComponent.h"
 #include "Enums.h"
 #include "AABB.h"
+#include "BackgroundTasks.h"
 
 class UStaticMesh;
 class UShader;
@@ -24,11 +25,16 @@ protected:
 public:
 	void OnStaticMeshReleased(UStaticMesh* ReleasedMesh);
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	const TArray<FMeshLOD>* GetMeshLODs() const override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
 	void SetStaticMesh(const FString& PathFileName);
+	// 백그라운드에서 로드하고, 끝날 때까지는 빈 자리표시자 메시를 들고 있는다 (렌더링/피킹에서 빠짐)
+	void SetStaticMeshAsync(const FString& PathFileName, ETaskPriority Priority = ETaskPriority::High);
+	// 들고 있는 메시의 로드가 끝났을 때 (UResourceManager가 호출)
+	void OnStaticMeshLoaded();
 
 	UStaticMesh* GetStaticMesh() const { return StaticMesh; }
 	
@@ -0,0 +1,1701 @@
+﻿#include "pch.h"
+#include "CookedLevel.h"
+#include "Level.h"
+#include "Actor.h"
+#include "SceneComponent.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "JsonSerializer.h"
+#include "WindowsBinWriter.h"
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace CookedLevelFormat;
+
+FCookedLevelReader* FCookedLevelReader::ActiveReader = nullptr;
+
+namespace
+{
+    static_assert(sizeof(FVector) == sizeof(float) * 3, "FVector는 float 3개로 쿠킹됨");
+    static_assert(sizeof(FLinearColor) == sizeof(float) * 4, "FLinearColor는 float 4개로 쿠킹됨");
+
+    // 리소스 캐시 인덱스 (FCookedLevelReader::ResourceCache)
+    enum EResourceKind : int32
+    {
+        Resource_Texture,
+        Resource_StaticMesh,
+        Resource_SkeletalMesh,
+        Resource_Material,
+        Resource_Sound,
+    };
+
+    // 잔여 데이터 태그 (json::JSON::Class와 1:1)
+    enum EResidualTag : uint8
+    {
+        Tag_Null,
+        Tag_Object,
+        Tag_Array,
+        Tag_String,
+        Tag_Floating,
+        Tag_Integral,
+        Tag_Boolean,
+    };
+
+    // 잔여 데이터 중첩 한도 (손상된 파일의 재귀 폭주 방지)
+    constexpr int32 MaxResidualDepth = 64;
+
+    // Serialize 오버라이드가 Super::Serialize 이후 리플렉션 프로퍼티 키를 다시 읽는 경우
+    // (기본값/Setter 부작용이 있으므로 잔여 JSON에도 남겨야 JSON 로드와 같은 결과가 나온다)
+    const char* const ReflectedKeysReadByOverrides[] =
+    {
+        "FogInscatteringColor", "FogDensity", "FogHeightFalloff", "StartDistance", "FogCutoffDistance", "FogMaxOpacity",   // UHeightFogComponent
+        "FovY",                                                                                                             // UPerspectiveDecalComponent
+    };
+
+    bool IsReadByOverride(const FString& Key)
+    {
+        for (const char* Name : ReflectedKeysReadByOverrides)
+        {
+            if (Key == Name)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 프로퍼티 이름/타입/Offset에 대한 FNV-1a
+    uint32 ComputeLayoutHash(const TArray<FProperty>& Properties)
+    {
+        uint32 Hash = 2166136261u;
+        auto Mix = [&Hash](const void* Data, SIZE_T Size)
+        {
+            const uint8* Bytes = static_cast<const uint8*>(Data);
+            for (SIZE_T i = 0; i < Size; ++i)
+            {
+                Hash = (Hash ^ Bytes[i]) * 16777619u;
+            }
+        };
+
+        for (const FProperty& Prop : Properties)
+        {
+            Mix(Prop.Name, strlen(Prop.Name) + 1);
+            const uint8 Types[2] = { static_cast<uint8>(Prop.Type), static_cast<uint8>(Prop.InnerType) };
+            Mix(Types, sizeof(Types));
+            const uint32 Offset = static_cast<uint32>(Prop.Offset);
+            Mix(&Offset, sizeof(Offset));
+        }
+        return Hash;
+    }
+
+    // UObject::Serialize가 로드하는 타입만 쿠킹한다 (나머지는 잔여 JSON으로 남김)
+    bool IsCookableArrayInner(EPropertyType InnerType)
+    {
+        switch (InnerType)
+        {
+        case EPropertyType::Int32:
+        case EPropertyType::Float:
+        case EPropertyType::Bool:
+        case EPropertyType::FString:
+        case EPropertyType::Sound:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // 고정 크기 값의 바이트 수 (문자열/리소스는 문자열 인덱스 4바이트, 가변 길이/미지원 타입은 0)
+    uint32 GetFixedValueSize(EPropertyType Type)
+    {
+        switch (Type)
+        {
+        case EPropertyType::Bool:           return 1;
+        case EPropertyType::Int32:          return 4;
+        case EPropertyType::Float:          return 4;
+        case EPropertyType::FVector:        return sizeof(float) * 3;
+        case EPropertyType::FLinearColor:   return sizeof(float) * 4;
+        case EPropertyType::Curve:          return sizeof(float) * 4;
+        case EPropertyType::FString:
+        case EPropertyType::ScriptFile:
+        case EPropertyType::FName:
+        case EPropertyType::Texture:
+        case EPropertyType::StaticMesh:
+        case EPropertyType::SkeletalMesh:
+        case EPropertyType::Material:
+        case EPropertyType::Sound:          return sizeof(uint32);
+        default:                            return 0;
+        }
+    }
+
+    bool IsStringValue(EPropertyType Type)
+    {
+        return GetFixedValueSize(Type) == sizeof(uint32) && Type != EPropertyType::Int32 && Type != EPropertyType::Float;
+    }
+
+    // json_escape()의 역변환. JSON::ToString()은 이스케이프된 문자열을 돌려주므로
+    // 잔여 JSON을 다시 만들 때는 원래 문자열로 되돌려 저장해야 한다
+    FString UnescapeJsonString(const FString& Escaped)
+    {
+        FString Result;
+        Result.reserve(Escaped.size());
+        for (SIZE_T i = 0; i < Escaped.size(); ++i)
+        {
+            const char C = Escaped[i];
+            if (C != '\\' || i + 1 >= Escaped.size())
+            {
+                Result.push_back(C);
+                continue;
+            }
+
+            switch (Escaped[++i])
+            {
+            case 'b':  Result.push_back('\b'); break;
+            case 'f':  Result.push_back('\f'); break;
+            case 'n':  Result.push_back('\n'); break;
+            case 'r':  Result.push_back('\r'); break;
+            case 't':  Result.push_back('\t'); break;
+            default:   Result.push_back(Escaped[i]); break;  // 따옴표, 역슬래시, 슬래시
+            }
+        }
+        return Result;
+    }
+
+    bool GetSourceStamp(const FWideString& Path, uint64& OutSize, int64& OutWriteTime)
+    {
+        std::error_code Error;
+        const uint64 Size = fs::file_size(Path, Error);
+        if (Error)
+        {
+            return false;
+        }
+        const fs::file_time_type WriteTime = fs::last_write_time(Path, Error);
+        if (Error)
+        {
+            return false;
+        }
+        OutSize = Size;
+        OutWriteTime = static_cast<int64>(WriteTime.time_since_epoch().count());
+        return true;
+    }
+
+    template<typename T>
+    T ReadUnaligned(const uint8* Data)
+    {
+        T Value;
+        memcpy(&Value, Data, sizeof(T));
+        return Value;
+    }
+
+    class FByteWriter
+    {
+    public:
+        uint32 Tell() const { return static_cast<uint32>(Bytes.Num()); }
+
+        void WriteBytes(const void* Data, SIZE_T Size)
+        {
+            const uint8* Begin = static_cast<const uint8*>(Data);
+            Bytes.insert(Bytes.end(), Begin, Begin + Size);
+        }
+
+        template<typename T>
+        void Write(const T& Value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "POD만 기록 가능");
+            WriteBytes(&Value, sizeof(T));
+        }
+
+        template<typename T>
+        void Patch(uint32 Offset, const T& Value)
+        {
+            memcpy(Bytes.data() + Offset, &Value, sizeof(T));
+        }
+
+        void Align4()
+        {
+            while (Bytes.Num() % 4 != 0)
+            {
+                Bytes.Add(0);
+            }
+        }
+
+        void Truncate(uint32 Size) { Bytes.resize(Size); }
+
+        TArray<uint8> Bytes;
+    };
+
+    // JSON 씬 -> 쿠킹 데이터 테이블
+    class FLevelCooker
+    {
+    public:
+        bool CookLevel(const JSON& LevelJson);
+        bool WriteToFile(const FWideString& OutPath, uint64 SourceSize, int64 SourceWriteTime);
+
+        uint32 GetNumActors() const { return static_cast<uint32>(Actors.Num()); }
+
+    private:
+        uint32 AddString(const FString& Str);
+        uint32 AddClass(const UClass* Class);
+
+        // 리플렉션 프로퍼티를 블롭으로 기록하고, 블롭에 들어간 키를 OutCookedKeys에 추가
+        uint32 WriteBlob(uint32 ClassIndex, const JSON& Json, TArray<const char*>& OutCookedKeys);
+        bool WriteProperty(const FProperty& Prop, const JSON& Json);
+
+        // Json에서 ExcludedKeys/CookedKeys를 뺀 나머지를 잔여 데이터로 기록 (남는 키가 없으면 InvalidOffset)
+        uint32 WriteResidualObject(const JSON& Json, const TArray<const char*>& CookedKeys, std::initializer_list<const char*> ExcludedKeys);
+        void WriteResidualValue(const JSON& Value);
+
+    private:
+        TMap<FString, uint32> StringIndices;
+        TArray<FString> Strings;
+
+        TMap<const UClass*, uint32> ClassIndices;
+        TArray<const UClass*> ClassPointers;
+        TArray<FClassEntry> Classes;
+        TArray<FPropertyEntry> Properties;
+
+        TArray<FActorEntry> Actors;
+        TArray<FComponentEntry> Components;
+
+        FByteWriter Blobs;
+        FByteWriter Residuals;
+        uint32 LevelResidual = InvalidOffset;
+    };
+
+    uint32 FLevelCooker::AddString(const FString& Str)
+    {
+        if (const uint32* Found = StringIndices.Find(Str))
+        {
+            return *Found;
+        }
+        const uint32 Index = static_cast<uint32>(Strings.Num());
+        Strings.Add(Str);
+        StringIndices.Add(Str, Index);
+        return Index;
+    }
+
+    uint32 FLevelCooker::AddClass(const UClass* Class)
+    {
+        if (const uint32* Found = ClassIndices.Find(Class))
+        {
+            return *Found;
+        }
+
+        const TArray<FProperty>& ClassProperties = Class->GetAllProperties();
+
+        FClassEntry Entry{};
+        Entry.Name = AddString(Class->Name);
+        Entry.FirstProperty = static_cast<uint32>(Properties.Num());
+        Entry.NumProperties = static_cast<uint32>(ClassProperties.Num());
+        Entry.LayoutHash = ComputeLayoutHash(ClassProperties);
+
+        for (const FProperty& Prop : ClassProperties)
+        {
+            FPropertyEntry PropEntry{};
+            PropEntry.Name = AddString(Prop.Name);
+            PropEntry.Type = static_cast<uint8>(Prop.Type);
+            PropEntry.InnerType = static_cast<uint8>(Prop.InnerType);
+            PropEntry.Offset = static_cast<uint32>(Prop.Offset);
+            Properties.Add(PropEntry);
+        }
+
+        const uint32 Index = static_cast<uint32>(Classes.Num());
+        Classes.Add(Entry);
+        ClassPointers.Add(Class);
+        ClassIndices.Add(Class, Index);
+        return Index;
+    }
+
+    // UObject::Serialize(로드)와 같은 판정으로 값을 읽는다 (같은 키가 없으면 기존 값 유지, 리소스는 nullptr)
+    bool FLevelCooker::WriteProperty(const FProperty& Prop, const JSON& Json)
+    {
+        switch (Prop.Type)
+        {
+        case EPropertyType::Bool:
+        {
+            bool Value;
+            if (!FJsonSerializer::ReadBool(Json, Prop.Name, Value, false, false)) return false;
+            Blobs.Write<uint8>(Value ? 1 : 0);
+            return true;
+        }
+        case EPropertyType::Int32:
+        {
+            int32 Value;
+            if (!FJsonSerializer::ReadInt32(Json, Prop.Name, Value, 0, false)) return false;
+            Blobs.Write(Value);
+            return true;
+        }
+        case EPropertyType::Float:
+        {
+            float Value;
+            if (!FJsonSerializer::ReadFloat(Json, Prop.Name, Value, 0.0f, false)) return false;
+            Blobs.Write(Value);
+            return true;
+        }
+        case EPropertyType::FVector:
+        {
+            FVector Value;
+            if (!FJsonSerializer::ReadVector(Json, Prop.Name, Value, FVector::Zero(), false)) return false;
+            Blobs.Write(Value);
+            return true;
+        }
+        case EPropertyType::FLinearColor:
+        {
+            FVector4 Value;
+            if (!FJsonSerializer::ReadVector4(Json, Prop.Name, Value, FVector4(0, 0, 0, 0), false)) return false;
+            Blobs.Write(FLinearColor(Value));
+            return true;
+        }
+        case EPropertyType::Curve:
+        {
+            FVector4 Value;
+            if (!FJsonSerializer::ReadVector4(Json, Prop.Name, Value, FVector4(0, 0, 0, 0), false)) return false;
+            const float Curve[4] = { Value.X, Value.Y, Value.Z, Value.W };
+            Blobs.Write(Curve);
+            return true;
+        }
+        case EPropertyType::FString:
+        case EPropertyType::ScriptFile:
+        case EPropertyType::FName:
+        {
+            FString Value;
+            if (!FJsonSerializer::ReadString(Json, Prop.Name, Value, "", false)) return false;
+            Blobs.Write(AddString(Value));
+            return true;
+        }
+        case EPropertyType::Texture:
+        case EPropertyType::StaticMesh:
+        case EPropertyType::SkeletalMesh:
+        case EPropertyType::Material:
+        {
+            // 키가 없거나 빈 경로면 nullptr이 되므로 항상 기록
+            FString Path;
+            FJsonSerializer::ReadString(Json, Prop.Name, Path, "", false);
+            Blobs.Write(AddString(Path));
+            return true;
+        }
+        case EPropertyType::Array:
+        {
+            if (!IsCookableArrayInner(Prop.InnerType)) return false;
+
+            JSON ArrayJson;
+            if (!FJsonSerializer::ReadArray(Json, Prop.Name, ArrayJson, nullptr, false)) return false;
+
+            const uint32 CountOffset = Blobs.Tell();
+            Blobs.Write<uint32>(0);
+
+            uint32 Count = 0;
+            for (const JSON& Elem : ArrayJson.ArrayRange())
+            {
+                switch (Prop.InnerType)
+                {
+                case EPropertyType::Int32:      Blobs.Write(static_cast<int32>(Elem.ToInt())); break;
+                case EPropertyType::Float:      Blobs.Write(static_cast<float>(Elem.ToFloat())); break;
+                case EPropertyType::Bool:       Blobs.Write<uint8>(Elem.ToBool() ? 1 : 0); break;
+                case EPropertyType::FString:    Blobs.Write(AddString(Elem.ToString())); break;
+                case EPropertyType::Sound:
+                    // 문자열이 아닌 원소는 JSON 로드에서도 건너뜀
+                    if (Elem.JSONType() != JSON::Class::String) continue;
+                    Blobs.Write(AddString(Elem.ToString()));
+                    break;
+                default:
+                    break;
+                }
+                ++Count;
+            }
+            Blobs.Patch(CountOffset, Count);
+            return true;
+        }
+        default:
+            // ObjectPtr, Struct 등은 UObject::Serialize도 처리하지 않음
+            return false;
+        }
+    }
+
+    uint32 FLevelCooker::WriteBlob(uint32 ClassIndex, const JSON& Json, TArray<const char*>& OutCookedKeys)
+    {
+        const FClassEntry& Class = Classes[ClassIndex];
+        const TArray<FProperty>& ClassProperties = ClassPointers[ClassIndex]->GetAllProperties();
+
+        // [존재 비트 (32개 단위)] [존재하는 값들을 프로퍼티 순서대로]
+        Blobs.Align4();
+        const uint32 BlobOffset = Blobs.Tell();
+        const uint32 NumWords = (Class.NumProperties + 31) / 32;
+        for (uint32 i = 0; i < NumWords; ++i)
+        {
+            Blobs.Write<uint32>(0);
+        }
+
+        for (uint32 i = 0; i < Class.NumProperties; ++i)
+        {
+            const FProperty& Prop = ClassProperties[i];
+            if (!WriteProperty(Prop, Json))
+            {
+                continue;
+            }
+
+            const uint32 WordOffset = BlobOffset + (i / 32) * sizeof(uint32);
+            uint32 Word = ReadUnaligned<uint32>(Blobs.Bytes.data() + WordOffset);
+            Word |= 1u << (i % 32);
+            Blobs.Patch(WordOffset, Word);
+
+            OutCookedKeys.Add(Prop.Name);
+        }
+        return BlobOffset;
+    }
+
+    void FLevelCooker::WriteResidualValue(const JSON& Value)
+    {
+        switch (Value.JSONType())
+        {
+        case JSON::Class::Object:
+        {
+            Residuals.Write<uint8>(Tag_Object);
+            Residuals.Write(static_cast<uint32>(Value.size()));
+            for (const auto& Pair : Value.ObjectRange())
+            {
+                Residuals.Write(AddString(Pair.first));
+                WriteResidualValue(Pair.second);
+            }
+            break;
+        }
+        case JSON::Class::Array:
+        {
+            Residuals.Write<uint8>(Tag_Array);
+            Residuals.Write(static_cast<uint32>(Value.size()));
+            for (const JSON& Elem : Value.ArrayRange())
+            {
+                WriteResidualValue(Elem);
+            }
+            break;
+        }
+        case JSON::Class::String:
+            Residuals.Write<uint8>(Tag_String);
+            Residuals.Write(AddString(UnescapeJsonString(Value.ToString())));
+            break;
+        case JSON::Class::Floating:
+            Residuals.Write<uint8>(Tag_Floating);
+            Residuals.Write(Value.ToFloat());
+            break;
+        case JSON::Class::Integral:
+            Residuals.Write<uint8>(Tag_Integral);
+            Residuals.Write(static_cast<int64>(Value.ToInt()));
+            break;
+        case JSON::Class::Boolean:
+            Residuals.Write<uint8>(Tag_Boolean);
+            Residuals.Write<uint8>(Value.ToBool() ? 1 : 0);
+            break;
+        default:
+            Residuals.Write<uint8>(Tag_Null);
+            break;
+        }
+    }
+
+    uint32 FLevelCooker::WriteResidualObject(const JSON& Json, const TArray<const char*>& CookedKeys, std::initializer_list<const char*> ExcludedKeys)
+    {
+        const uint32 Start = Residuals.Tell();
+        Residuals.Write<uint8>(Tag_Object);
+        const uint32 CountOffset = Residuals.Tell();
+        Residuals.Write<uint32>(0);
+
+        uint32 Count = 0;
+        for (const auto& Pair : Json.ObjectRange())
+        {
+            const FString& Key = Pair.first;
+
+            bool bSkip = false;
+            for (const char* Excluded : ExcludedKeys)
+            {
+                if (Key == Excluded) { bSkip = true; break; }
+            }
+            if (!bSkip && !IsReadByOverride(Key))
+            {
+                for (const char* Cooked : CookedKeys)
+                {
+                    if (Key == Cooked) { bSkip = true; break; }
+                }
+            }
+            if (bSkip)
+            {
+                continue;
+            }
+
+            Residuals.Write(AddString(Key));
+            WriteResidualValue(Pair.second);
+            ++Count;
+        }
+
+        if (Count == 0)
+        {
+            Residuals.Truncate(Start);
+            return InvalidOffset;
+        }
+        Residuals.Patch(CountOffset, Count);
+        return Start;
+    }
+
+    bool FLevelCooker::CookLevel(const JSON& LevelJson)
+    {
+        JSON CameraJson;
+        if (FJsonSerializer::ReadObject(LevelJson, "PerspectiveCamera", CameraJson, nullptr, false))
+        {
+            LevelResidual = Residuals.Tell();
+            WriteResidualValue(CameraJson);
+        }
+
+        JSON ActorListJson;
+        if (!FJsonSerializer::ReadObject(LevelJson, "Actors", ActorListJson, nullptr, false))
+        {
+            return true;
+        }
+
+        // ULevel::Serialize와 같은 순서 (ObjectRange = UUID 문자열 순)
+        for (const auto& Pair : ActorListJson.ObjectRange())
+        {
+            const JSON& ActorJson = Pair.second;
+
+            FString TypeString;
+            FJsonSerializer::ReadString(ActorJson, "Type", TypeString, "", false);
+            UClass* ActorClass = UClass::FindClass(TypeString);
+            if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass()))
+            {
+                UE_LOG("[CookedLevel] Cook failed: invalid actor class '%s' (%s)", TypeString.c_str(), Pair.first.c_str());
+                return false;
+            }
+
+            FActorEntry Actor{};
+            Actor.Class = AddClass(ActorClass);
+            FJsonSerializer::ReadUint32(ActorJson, "RootComponentId", Actor.RootComponentId, 0, false);
+            Actor.FirstComponent = static_cast<uint32>(Components.Num());
+
+            TArray<const char*> CookedKeys;
+            Actor.Blob = WriteBlob(Actor.Class, ActorJson, CookedKeys);
+            Actor.Residual = WriteResidualObject(ActorJson, CookedKeys, { "Type", "RootComponentId", "OwnedComponents" });
+
+            JSON ComponentsJson;
+            if (FJsonSerializer::ReadArray(ActorJson, "OwnedComponents", ComponentsJson, nullptr, false))
+            {
+                for (const JSON& ComponentJson : ComponentsJson.ArrayRange())
+                {
+                    FString ComponentType;
+                    FJsonSerializer::ReadString(ComponentJson, "Type", ComponentType, "", false);
+                    UClass* ComponentClass = UClass::FindClass(ComponentType);
+                    if (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
+                    {
+                        UE_LOG("[CookedLevel] Cook failed: invalid component class '%s' (%s)", ComponentType.c_str(), Pair.first.c_str());
+                        return false;
+                    }
+
+                    FComponentEntry Component{};
+                    Component.Class = AddClass(ComponentClass);
+
+                    TArray<const char*> ComponentCookedKeys;
+                    Component.Blob = WriteBlob(Component.Class, ComponentJson, ComponentCookedKeys);
+
+                    if (ComponentClass->IsChildOf(USceneComponent::StaticClass()))
+                    {
+                        Component.Flags |= Component_SceneIds;
+                        FJsonSerializer::ReadUint32(ComponentJson, "Id", Component.SceneId, 0, false);
+                        FJsonSerializer::ReadUint32(ComponentJson, "ParentId", Component.ParentId, 0, false);
+                        Component.Residual = WriteResidualObject(ComponentJson, ComponentCookedKeys, { "Type", "Id", "ParentId" });
+                    }
+                    else
+                    {
+                        Component.Residual = WriteResidualObject(ComponentJson, ComponentCookedKeys, { "Type" });
+                    }
+
+                    Components.Add(Component);
+                    ++Actor.NumComponents;
+                }
+            }
+
+            Actors.Add(Actor);
+        }
+        return true;
+    }
+
+    bool FLevelCooker::WriteToFile(const FWideString& OutPath, uint64 SourceSize, int64 SourceWriteTime)
+    {
+        FByteWriter Out;
+        Out.Write(FHeader{});
+
+        FHeader Header{};
+        Header.Magic = Magic;
+        Header.Version = Version;
+        Header.SourceSize = SourceSize;
+        Header.SourceWriteTime = SourceWriteTime;
+        Header.LevelResidual = LevelResidual;
+
+        // 문자열 테이블 + 데이터 (널 종료)
+        TArray<FStringEntry> StringEntries;
+        StringEntries.Reserve(Strings.Num());
+        FByteWriter StringData;
+        for (const FString& Str : Strings)
+        {
+            StringEntries.Add({ StringData.Tell(), static_cast<uint32>(Str.size()) });
+            StringData.WriteBytes(Str.data(), Str.size());
+            StringData.Write<char>('\0');
+        }
+
+        auto WriteTable = [&Out](const auto& Table, uint32& OutCount, uint32& OutOffset)
+        {
+            Out.Align4();
+            OutCount = static_cast<uint32>(Table.Num());
+            OutOffset = Out.Tell();
+            if (!Table.IsEmpty())
+            {
+                Out.WriteBytes(Table.data(), sizeof(Table[0]) * Table.Num());
+            }
+        };
+
+        WriteTable(StringEntries, Header.NumStrings, Header.StringTableOffset);
+        Header.StringDataOffset = Out.Tell();
+        Header.StringDataSize = StringData.Tell();
+        Out.WriteBytes(StringData.Bytes.data(), StringData.Bytes.Num());
+
+        WriteTable(Classes, Header.NumClasses, Header.ClassTableOffset);
+        WriteTable(Properties, Header.NumProperties, Header.PropertyTableOffset);
+        WriteTable(Actors, Header.NumActors, Header.ActorTableOffset);
+        WriteTable(Components, Header.NumComponents, Header.ComponentTableOffset);
+
+        Out.Align4();
+        Header.BlobOffset = Out.Tell();
+        Header.BlobSize = Blobs.Tell();
+        Out.WriteBytes(Blobs.Bytes.data(), Blobs.Bytes.Num());
+
+        Out.Align4();
+        Header.ResidualOffset = Out.Tell();
+        Header.ResidualSize = Residuals.Tell();
+        Out.WriteBytes(Residuals.Bytes.data(), Residuals.Bytes.Num());
+
+        if (Out.Bytes.Num() >= static_cast<SIZE_T>(UINT32_MAX))
+        {
+            UE_LOG("[CookedLevel] Cook failed: output exceeds 4GB");
+            return false;
+        }
+        Out.Patch(0, Header);
+
+        FWindowsBinWriter Writer(WideToUTF8(OutPath));
+        if (!Writer.IsOpen())
+        {
+            UE_LOG("[CookedLevel] Cook failed: cannot open %s", WideToUTF8(OutPath).c_str());
+            return false;
+        }
+        Writer.Serialize(Out.Bytes.data(), static_cast<int64>(Out.Bytes.Num()));
+        return Writer.Close();
+    }
+
+    void DestroyLevelActors(ULevel& Level)
+    {
+        // 생성 역순으로 지워야 DeleteObject의 탐색이 짧다
+        const TArray<AActor*>& Actors = Level.GetActors();
+        for (int32 i = Actors.Num() - 1; i >= 0; --i)
+        {
+            ObjectFactory::DeleteObject(Actors[i]);
+        }
+        Level.Clear();
+    }
+
+    // UUID는 로드할 때마다 새로 발급되므로 액터 안에서의 등장 순서 번호로 치환
+    void NormalizeIds(JSON& Json, TMap<long, long>& Remap)
+    {
+        if (Json.JSONType() == JSON::Class::Object)
+        {
+            for (auto& Pair : Json.ObjectRange())
+            {
+                const bool bIdKey = Pair.first == "Id" || Pair.first == "ParentId" || Pair.first == "RootComponentId";
+                if (bIdKey && Pair.second.JSONType() == JSON::Class::Integral)
+                {
+                    const long Id = Pair.second.ToInt();
+                    if (Id != 0)
+                    {
+                        const long* Found = Remap.Find(Id);
+                        const long NewId = Found ? *Found : static_cast<long>(Remap.Num() + 1);
+                        if (!Found)
+                        {
+                            Remap.Add(Id, NewId);
+                        }
+                        Pair.second = NewId;
+                    }
+                }
+                else
+                {
+                    NormalizeIds(Pair.second, Remap);
+                }
+            }
+        }
+        else if (Json.JSONType() == JSON::Class::Array)
+        {
+            for (JSON& Elem : Json.ArrayRange())
+            {
+                NormalizeIds(Elem, Remap);
+            }
+        }
+    }
+
+    FString DumpActorForCompare(AActor* Actor)
+    {
+        JSON ActorJson = json::Object();
+        ActorJson["Type"] = Actor->GetClass()->Name;
+        Actor->Serialize(false, ActorJson);
+
+        // OwnedComponents는 TSet이라 순회 순서가 로드마다 다르다.
+        // (부모 경로 + Id를 뺀 내용) 문자열로 정렬한 뒤 Id를 번호로 바꾼다
+        JSON Components;
+        if (FJsonSerializer::ReadArray(ActorJson, "OwnedComponents", Components, nullptr, false))
+        {
+            const int32 NumComponents = static_cast<int32>(Components.size());
+            TMap<long, int32> IndexById;
+            TArray<FString> Contents;
+            TArray<long> ParentIds;
+            for (int32 i = 0; i < NumComponents; ++i)
+            {
+                JSON Content = Components[i];
+                long Id = 0;
+                long ParentId = 0;
+                if (Content.hasKey("Id"))
+                {
+                    Id = Content["Id"].ToInt();
+                    Content["Id"] = 0;
+                }
+                if (Content.hasKey("ParentId"))
+                {
+                    ParentId = Content["ParentId"].ToInt();
+                    Content["ParentId"] = 0;
+                }
+                if (Id != 0)
+                {
+                    IndexById.Add(Id, i);
+                }
+                Contents.Add(Content.dump());
+                ParentIds.Add(ParentId);
+            }
+
+            TArray<std::pair<FString, int32>> Keys;
+            for (int32 i = 0; i < NumComponents; ++i)
+            {
+                FString Key = Contents[i];
+                int32 Current = i;
+                for (int32 Depth = 0; Depth < NumComponents; ++Depth)
+                {
+                    const int32* Parent = IndexById.Find(ParentIds[Current]);
+                    if (!Parent)
+                    {
+                        break;
+                    }
+                    Current = *Parent;
+                    Key = Contents[Current] + "/" + Key;
+                }
+                Keys.Add({ Key, i });
+            }
+            std::sort(Keys.begin(), Keys.end());
+
+            JSON Sorted = JSON::Make(JSON::Class::Array);
+            for (const std::pair<FString, int32>& Key : Keys)
+            {
+                Sorted.append(Components[Key.second]);
+            }
+            ActorJson["OwnedComponents"] = Sorted;
+        }
+
+        TMap<long, long> Remap;
+        NormalizeIds(ActorJson, Remap);
+        return ActorJson.dump();
+    }
+
+    bool CompareLevels(ULevel& JsonLevel, ULevel& CookedLevel)
+    {
+        const TArray<AActor*>& JsonActors = JsonLevel.GetActors();
+        const TArray<AActor*>& CookedActors = CookedLevel.GetActors();
+        if (JsonActors.Num() != CookedActors.Num())
+        {
+            UE_LOG("[CookedLevel] Verify: actor count mismatch (json %d, cooked %d)", JsonActors.Num(), CookedActors.Num());
+            return false;
+        }
+
+        for (int32 i = 0; i < JsonActors.Num(); ++i)
+        {
+            const FString Expected = DumpActorForCompare(JsonActors[i]);
+            const FString Actual = DumpActorForCompare(CookedActors[i]);
+            if (Expected != Actual)
+            {
+                UE_LOG("[CookedLevel] Verify: actor %d (%s) differs", i, JsonActors[i]->GetClass()->Name);
+                UE_LOG("[CookedLevel]   json:   %s", Expected.c_str());
+                UE_LOG("[CookedLevel]   cooked: %s", Actual.c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 로드 중 Reader를 전역에 노출 (중첩 로드 대비 이전 값 복원)
+    class FActiveReaderScope
+    {
+    public:
+        FActiveReaderScope(FCookedLevelReader*& InSlot, FCookedLevelReader* InReader)
+            : Slot(InSlot), Prev(InSlot)
+        {
+            Slot = InReader;
+        }
+        ~FActiveReaderScope() { Slot = Prev; }
+
+    private:
+        FCookedLevelReader*& Slot;
+        FCookedLevelReader* Prev;
+    };
+}
+
+//================================================================================================
+// FCookedLevelReader
+//================================================================================================
+
+FCookedLevelReader::~FCookedLevelReader()
+{
+    if (ActiveReader == this)
+    {
+        ActiveReader = nullptr;
+    }
+}
+
+bool FCookedLevelReader::Open(const FWideString& InPath, const uint64* ExpectedSourceSize, const int64* ExpectedSourceWriteTime)
+{
+    if (!File.Open(InPath))
+    {
+        return false;
+    }
+
+    const uint8* Data = File.GetData();
+    const uint64 FileSize = File.GetSize();
+    if (FileSize < sizeof(FHeader))
+    {
+        UE_LOG("[CookedLevel] %s: file too small", WideToUTF8(InPath).c_str());
+        return false;
+    }
+
+    Header = reinterpret_cast<const FHeader*>(Data);
+    if (Header->Magic != Magic || Header->Version != Version)
+    {
+        UE_LOG("[CookedLevel] %s: unsupported format (version %u, expected %u)", WideToUTF8(InPath).c_str(), Header->Version, Version);
+        return false;
+    }
+
+    if ((ExpectedSourceSize && Header->SourceSize != *ExpectedSourceSize) ||
+        (ExpectedSourceWriteTime && Header->SourceWriteTime != *ExpectedSourceWriteTime))
+    {
+        UE_LOG("[CookedLevel] %s is out of date, using JSON scene", WideToUTF8(InPath).c_str());
+        return false;
+    }
+
+    auto InFile = [FileSize](uint64 Offset, uint64 Count, uint64 Stride)
+    {
+        return Offset % 4 == 0 && Offset <= FileSize && Count <= (FileSize - Offset) / Stride;
+    };
+
+    if (!InFile(Header->StringTableOffset, Header->NumStrings, sizeof(FStringEntry)) ||
+        !InFile(Header->StringDataOffset, Header->StringDataSize, 1) ||
+        !InFile(Header->ClassTableOffset, Header->NumClasses, sizeof(FClassEntry)) ||
+        !InFile(Header->PropertyTableOffset, Header->NumProperties, sizeof(FPropertyEntry)) ||
+        !InFile(Header->ActorTableOffset, Header->NumActors, sizeof(FActorEntry)) ||
+        !InFile(Header->ComponentTableOffset, Header->NumComponents, sizeof(FComponentEntry)) ||
+        !InFile(Header->BlobOffset, Header->BlobSize, 1) ||
+        !InFile(Header->ResidualOffset, Header->ResidualSize, 1))
+    {
+        UE_LOG("[CookedLevel] %s: corrupt section table", WideToUTF8(InPath).c_str());
+        return false;
+    }
+
+    ClassTable = reinterpret_cast<const FClassEntry*>(Data + Header->ClassTableOffset);
+    PropertyTable = reinterpret_cast<const FPropertyEntry*>(Data + Header->PropertyTableOffset);
+    ActorTable = reinterpret_cast<const FActorEntry*>(Data + Header->ActorTableOffset);
+    ComponentTable = reinterpret_cast<const FComponentEntry*>(Data + Header->ComponentTableOffset);
+    Blobs = Data + Header->BlobOffset;
+    Residuals = Data + Header->ResidualOffset;
+
+    // 문자열
+    const FStringEntry* StringTable = reinterpret_cast<const FStringEntry*>(Data + Header->StringTableOffset);
+    const char* StringData = reinterpret_cast<const char*>(Data + Header->StringDataOffset);
+    Strings.Empty();
+    Strings.Reserve(Header->NumStrings);
+    for (uint32 i = 0; i < Header->NumStrings; ++i)
+    {
+        const FStringEntry& Entry = StringTable[i];
+        if (static_cast<uint64>(Entry.Offset) + Entry.Length >= Header->StringDataSize)
+        {
+            UE_LOG("[CookedLevel] %s: corrupt string table", WideToUTF8(InPath).c_str());
+            return false;
+        }
+        Strings.Emplace(StringData + Entry.Offset, Entry.Length);
+    }
+
+    // 클래스: 현재 리플렉션과 레이아웃이 같아야 블롭을 그대로 적용할 수 있다
+    Classes.Empty();
+    Classes.Reserve(Header->NumClasses);
+    for (uint32 i = 0; i < Header->NumClasses; ++i)
+    {
+        const FClassEntry& Entry = ClassTable[i];
+        if (Entry.Name >= Header->NumStrings ||
+            static_cast<uint64>(Entry.FirstProperty) + Entry.NumProperties > Header->NumProperties)
+        {
+            UE_LOG("[CookedLevel] %s: corrupt class table", WideToUTF8(InPath).c_str());
+            return false;
+        }
+
+        UClass* Class = UClass::FindClass(GetString(Entry.Name));
+        if (!Class)
+        {
+            UE_LOG("[CookedLevel] %s: unknown class '%s', using JSON scene", WideToUTF8(InPath).c_str(), GetString(Entry.Name).c_str());
+            return false;
+        }
+
+        // 해시가 같아도 블롭 적용은 파일의 프로퍼티 테이블을 따르므로 항목별로 한 번 더 대조
+        const TArray<FProperty>& ClassProperties = Class->GetAllProperties();
+        bool bSameLayout = static_cast<uint32>(ClassProperties.Num()) == Entry.NumProperties && ComputeLayoutHash(ClassProperties) == Entry.LayoutHash;
+        for (uint32 p = 0; bSameLayout && p < Entry.NumProperties; ++p)
+        {
+            const FPropertyEntry& Prop = PropertyTable[Entry.FirstProperty + p];
+            const FProperty& Expected = ClassProperties[p];
+            bSameLayout = Prop.Name < Header->NumStrings && GetString(Prop.Name) == Expected.Name &&
+                Prop.Type == static_cast<uint8>(Expected.Type) && Prop.InnerType == static_cast<uint8>(Expected.InnerType) &&
+                Prop.Offset == Expected.Offset;
+        }
+        if (!bSameLayout)
+        {
+            UE_LOG("[CookedLevel] %s: property layout of '%s' changed, using JSON scene", WideToUTF8(InPath).c_str(), Class->Name);
+            return false;
+        }
+        Classes.Add(Class);
+    }
+
+    // 그래프 + 블롭 + 잔여 데이터 (로드 도중 실패하지 않도록 여기서 전부 검사)
+    if (Header->LevelResidual != InvalidOffset && !ValidateResidual(Header->LevelResidual))
+    {
+        UE_LOG("[CookedLevel] %s: corrupt level data", WideToUTF8(InPath).c_str());
+        return false;
+    }
+
+    for (uint32 i = 0; i < Header->NumActors; ++i)
+    {
+        const FActorEntry& Actor = ActorTable[i];
+        const bool bValid = Actor.Class < Header->NumClasses &&
+            Classes[Actor.Class]->IsChildOf(AActor::StaticClass()) &&
+            static_cast<uint64>(Actor.FirstComponent) + Actor.NumComponents <= Header->NumComponents &&
+            ValidateBlob(Actor.Class, Actor.Blob) &&
+            (Actor.Residual == InvalidOffset || ValidateResidual(Actor.Residual));
+        if (!bValid)
+        {
+            UE_LOG("[CookedLevel] %s: corrupt actor %u", WideToUTF8(InPath).c_str(), i);
+            return false;
+        }
+    }
+
+    for (uint32 i = 0; i < Header->NumComponents; ++i)
+    {
+        const FComponentEntry& Component = ComponentTable[i];
+        const bool bValid = Component.Class < Header->NumClasses &&
+            Classes[Component.Class]->IsChildOf(UActorComponent::StaticClass()) &&
+            ((Component.Flags & Component_SceneIds) != 0) == Classes[Component.Class]->IsChildOf(USceneComponent::StaticClass()) &&
+            ValidateBlob(Component.Class, Component.Blob) &&
+            (Component.Residual == InvalidOffset || ValidateResidual(Component.Residual));
+        if (!bValid)
+        {
+            UE_LOG("[CookedLevel] %s: corrupt component %u", WideToUTF8(InPath).c_str(), i);
+            return false;
+        }
+    }
+
+    // AActor::Serialize는 SceneIdMap에서 찾은 부모를 바로 역참조하므로 ParentId는 같은 액터의 씬 컴포넌트를 가리켜야 한다
+    for (uint32 i = 0; i < Header->NumActors; ++i)
+    {
+        const FActorEntry& Actor = ActorTable[i];
+        for (uint32 c = 0; c < Actor.NumComponents; ++c)
+        {
+            const FComponentEntry& Component = ComponentTable[Actor.FirstComponent + c];
+            if ((Component.Flags & Component_SceneIds) == 0 || Component.ParentId == 0)
+            {
+                continue;
+            }
+
+            bool bFoundParent = false;
+            for (uint32 p = 0; p < Actor.NumComponents && !bFoundParent; ++p)
+            {
+                const FComponentEntry& Parent = ComponentTable[Actor.FirstComponent + p];
+                bFoundParent = p != c && (Parent.Flags & Component_SceneIds) != 0 && Parent.SceneId == Component.ParentId;
+            }
+            if (!bFoundParent)
+            {
+                UE_LOG("[CookedLevel] %s: corrupt attachment in actor %u", WideToUTF8(InPath).c_str(), i);
+                return false;
+            }
+        }
+    }
+
+    for (int32 Kind = 0; Kind < NumResourceKinds; ++Kind)
+    {
+        ResourceCache[Kind].SetNum(Header->NumStrings);
+        ResourceResolved[Kind].SetNum(Header->NumStrings);
+        std::fill(ResourceResolved[Kind].begin(), ResourceResolved[Kind].end(), 0);
+    }
+    return true;
+}
+
+bool FCookedLevelReader::ValidateBlob(uint32 ClassIndex, uint32 BlobOffset) const
+{
+    const FClassEntry& Class = ClassTable[ClassIndex];
+    const uint32 NumWords = (Class.NumProperties + 31) / 32;
+    const uint64 BlobSize = Header->BlobSize;
+
+    if (BlobOffset % 4 != 0 || static_cast<uint64>(BlobOffset) + NumWords * sizeof(uint32) > BlobSize)
+    {
+        return false;
+    }
+
+    const uint32* Presence = reinterpret_cast<const uint32*>(Blobs + BlobOffset);
+    uint64 Cursor = BlobOffset + NumWords * sizeof(uint32);
+
+    auto CheckString = [this](const uint8* Data) { return ReadUnaligned<uint32>(Data) < Header->NumStrings; };
+
+    for (uint32 i = 0; i < Class.NumProperties; ++i)
+    {
+        if (!(Presence[i / 32] & (1u << (i % 32))))
+        {
+            continue;
+        }
+
+        const FPropertyEntry& Prop = PropertyTable[Class.FirstProperty + i];
+        const EPropertyType Type = static_cast<EPropertyType>(Prop.Type);
+
+        if (Type == EPropertyType::Array)
+        {
+            const EPropertyType Inner = static_cast<EPropertyType>(Prop.InnerType);
+            if (!IsCookableArrayInner(Inner) || Cursor + sizeof(uint32) > BlobSize)
+            {
+                return false;
+            }
+            const uint32 Count = ReadUnaligned<uint32>(Blobs + Cursor);
+            Cursor += sizeof(uint32);
+
+            const uint32 ElemSize = GetFixedValueSize(Inner);
+            if (Count > (BlobSize - Cursor) / ElemSize)
+            {
+                return false;
+            }
+            if (IsStringValue(Inner))
+            {
+                for (uint32 Elem = 0; Elem < Count; ++Elem)
+                {
+                    if (!CheckString(Blobs + Cursor + Elem * ElemSize)) return false;
+                }
+            }
+            Cursor += static_cast<uint64>(Count) * ElemSize;
+            continue;
+        }
+
+        const uint32 Size = GetFixedValueSize(Type);
+        if (Size == 0 || Type == EPropertyType::Sound || Cursor + Size > BlobSize)
+        {
+            return false;
+        }
+        if (IsStringValue(Type) && !CheckString(Blobs + Cursor))
+        {
+            return false;
+        }
+        Cursor += Size;
+    }
+    return true;
+}
+
+bool FCookedLevelReader::ReadResidualValue(uint64& Cursor, int32 Depth, JSON* Out) const
+{
+    const uint64 End = Header->ResidualSize;
+    if (Depth > MaxResidualDepth || Cursor >= End)
+    {
+        return false;
+    }
+
+    const uint8 Tag = Residuals[Cursor++];
+    switch (Tag)
+    {
+    case Tag_Null:
+        if (Out) *Out = JSON(nullptr);
+        return true;
+
+    case Tag_Object:
+    case Tag_Array:
+    {
+        if (Cursor + sizeof(uint32) > End)
+        {
+            return false;
+        }
+        const uint32 Count = ReadUnaligned<uint32>(Residuals + Cursor);
+        Cursor += sizeof(uint32);
+        // 값 하나는 최소 1바이트 (손상된 Count로 긴 루프를 돌지 않도록)
+        if (Count > End - Cursor)
+        {
+            return false;
+        }
+
+        if (Out)
+        {
+            *Out = JSON::Make(Tag == Tag_Object ? JSON::Class::Object : JSON::Class::Array);
+        }
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            JSON* Child = nullptr;
+            if (Tag == Tag_Object)
+            {
+                if (Cursor + sizeof(uint32) > End)
+                {
+                    return false;
+                }
+                const uint32 Key = ReadUnaligned<uint32>(Residuals + Cursor);
+                Cursor += sizeof(uint32);
+                if (Key >= Header->NumStrings)
+                {
+                    return false;
+                }
+                if (Out) Child = &(*Out)[GetString(Key)];
+            }
+            else if (Out)
+            {
+                Child = &(*Out)[i];
+            }
+
+            if (!ReadResidualValue(Cursor, Depth + 1, Child))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    case Tag_String:
+    {
+        if (Cursor + sizeof(uint32) > End)
+        {
+            return false;
+        }
+        const uint32 Index = ReadUnaligned<uint32>(Residuals + Cursor);
+        Cursor += sizeof(uint32);
+        if (Index >= Header->NumStrings)
+        {
+            return false;
+        }
+        if (Out) *Out = GetString(Index);
+        return true;
+    }
+
+    case Tag_Floating:
+    {
+        if (Cursor + sizeof(double) > End)
+        {
+            return false;
+        }
+        if (Out) *Out = ReadUnaligned<double>(Residuals + Cursor);
+        Cursor += sizeof(double);
+        return true;
+    }
+
+    case Tag_Integral:
+    {
+        if (Cursor + sizeof(int64) > End)
+        {
+            return false;
+        }
+        if (Out) *Out = static_cast<long>(ReadUnaligned<int64>(Residuals + Cursor));
+        Cursor += sizeof(int64);
+        return true;
+    }
+
+    case Tag_Boolean:
+    {
+        if (Cursor + 1 > End)
+        {
+            return false;
+        }
+        if (Out) *Out = Residuals[Cursor] != 0;
+        Cursor += 1;
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+bool FCookedLevelReader::ValidateResidual(uint32 ResidualOffset) const
+{
+    uint64 Cursor = ResidualOffset;
+    return ReadResidualValue(Cursor, 0, nullptr);
+}
+
+void FCookedLevelReader::DecodeResidual(uint32 ResidualOffset, JSON& OutJson) const
+{
+    uint64 Cursor = ResidualOffset;
+    ReadResidualValue(Cursor, 0, &OutJson);
+}
+
+template<typename T>
+T* FCookedLevelReader::ResolveResource(uint32 StringIndex, int32 Kind)
+{
+    if (!ResourceResolved[Kind][StringIndex])
+    {
+        const FString& Path = GetString(StringIndex);
+        ResourceCache[Kind][StringIndex] = Path.empty() ? nullptr : UResourceManager::GetInstance().Load<T>(Path);
+        ResourceResolved[Kind][StringIndex] = 1;
+    }
+    return static_cast<T*>(ResourceCache[Kind][StringIndex]);
+}
+
+bool FCookedLevelReader::ApplyPendingProperties(UObject* Object)
+{
+    if (PendingBlob == InvalidOffset || Object->GetClass() != PendingClass)
+    {
+        return false;
+    }
+
+    const FClassEntry& Class = ClassTable[PendingClassIndex];
+    const uint32* Presence = reinterpret_cast<const uint32*>(Blobs + PendingBlob);
+    const uint8* Cursor = Blobs + PendingBlob + ((Class.NumProperties + 31) / 32) * sizeof(uint32);
+    PendingBlob = InvalidOffset;
+    PendingClass = nullptr;
+
+    uint8* Base = reinterpret_cast<uint8*>(Object);
+    for (uint32 i = 0; i < Class.NumProperties; ++i)
+    {
+        if (!(Presence[i / 32] & (1u << (i % 32))))
+        {
+            continue;
+        }
+
+        const FPropertyEntry& Prop = PropertyTable[Class.FirstProperty + i];
+        uint8* Dest = Base + Prop.Offset;
+
+        switch (static_cast<EPropertyType>(Prop.Type))
+        {
+        case EPropertyType::Bool:
+            *reinterpret_cast<bool*>(Dest) = *Cursor != 0;
+            Cursor += 1;
+            break;
+        case EPropertyType::Int32:
+        case EPropertyType::Float:
+        case EPropertyType::FVector:
+        case EPropertyType::FLinearColor:
+        case EPropertyType::Curve:
+        {
+            // 레이아웃 해시로 Offset/타입이 같음을 확인했으므로 그대로 복사
+            const uint32 Size = GetFixedValueSize(static_cast<EPropertyType>(Prop.Type));
+            memcpy(Dest, Cursor, Size);
+            Cursor += Size;
+            break;
+        }
+        case EPropertyType::FString:
+        case EPropertyType::ScriptFile:
+            *reinterpret_cast<FString*>(Dest) = GetString(ReadUnaligned<uint32>(Cursor));
+            Cursor += sizeof(uint32);
+            break;
+        case EPropertyType::FName:
+            *reinterpret_cast<FName*>(Dest) = FName(GetString(ReadUnaligned<uint32>(Cursor)));
+            Cursor += sizeof(uint32);
+            break;
+        case EPropertyType::Texture:
+            *reinterpret_cast<UTexture**>(Dest) = ResolveResource<UTexture>(ReadUnaligned<uint32>(Cursor), Resource_Texture);
+            Cursor += sizeof(uint32);
+            break;
+        case EPropertyType::StaticMesh:
+            *reinterpret_cast<UStaticMesh**>(Dest) = ResolveResource<UStaticMesh>(ReadUnaligned<uint32>(Cursor), Resource_StaticMesh);
+            Cursor += sizeof(uint32);
+            break;
+        case EPropertyType::SkeletalMesh:
+            *reinterpret_cast<USkeletalMesh**>(Dest) = ResolveResource<USkeletalMesh>(ReadUnaligned<uint32>(Cursor), Resource_SkeletalMesh);
+            Cursor += sizeof(uint32);
+            break;
+        case EPropertyType::Material:
+            *reinterpret_cast<UMaterial**>(Dest) = ResolveResource<UMaterial>(ReadUnaligned<uint32>(Cursor), Resource_Material);
+            Cursor += sizeof(uint32);
+            break;
+        case EPropertyType::Array:
+        {
+            const uint32 Count = ReadUnaligned<uint32>(Cursor);
+            Cursor += sizeof(uint32);
+
+            switch (static_cast<EPropertyType>(Prop.InnerType))
+            {
+            case EPropertyType::Int32:
+            {
+                TArray<int32>& Array = *reinterpret_cast<TArray<int32>*>(Dest);
+                Array.SetNum(Count);
+                if (Count > 0) memcpy(Array.data(), Cursor, Count * sizeof(int32));
+                Cursor += Count * sizeof(int32);
+                break;
+            }
+            case EPropertyType::Float:
+            {
+                TArray<float>& Array = *reinterpret_cast<TArray<float>*>(Dest);
+                Array.SetNum(Count);
+                if (Count > 0) memcpy(Array.data(), Cursor, Count * sizeof(float));
+                Cursor += Count * sizeof(float);
+                break;
+            }
+            case EPropertyType::Bool:
+            {
+                TArray<bool>& Array = *reinterpret_cast<TArray<bool>*>(Dest);
+                Array.clear();
+                for (uint32 Elem = 0; Elem < Count; ++Elem)
+                {
+                    Array.Add(Cursor[Elem] != 0);
+                }
+                Cursor += Count;
+                break;
+            }
+            case EPropertyType::FString:
+            {
+                TArray<FString>& Array = *reinterpret_cast<TArray<FString>*>(Dest);
+                Array.clear();
+                Array.Reserve(Count);
+                for (uint32 Elem = 0; Elem < Count; ++Elem)
+                {
+                    Array.Add(GetString(ReadUnaligned<uint32>(Cursor + Elem * sizeof(uint32))));
+                }
+                Cursor += Count * sizeof(uint32);
+                break;
+            }
+            case EPropertyType::Sound:
+            {
+                TArray<USound*>& Array = *reinterpret_cast<TArray<USound*>*>(Dest);
+                Array.Empty();
+                for (uint32 Elem = 0; Elem < Count; ++Elem)
+                {
+                    Array.Add(ResolveResource<USound>(ReadUnaligned<uint32>(Cursor + Elem * sizeof(uint32)), Resource_Sound));
+                }
+                Cursor += Count * sizeof(uint32);
+                break;
+            }
+            default:
+                break;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+uint32 FCookedLevelReader::GetRootComponentId() const
+{
+    return CurrentActor ? CurrentActor->RootComponentId : 0;
+}
+
+int32 FCookedLevelReader::GetNumComponents() const
+{
+    return CurrentActor ? static_cast<int32>(CurrentActor->NumComponents) : 0;
+}
+
+UClass* FCookedLevelReader::BeginComponent(int32 Index, JSON& OutJson)
+{
+    const FComponentEntry& Component = ComponentTable[CurrentActor->FirstComponent + Index];
+
+    if (Component.Residual != InvalidOffset)
+    {
+        DecodeResidual(Component.Residual, OutJson);
+    }
+    else
+    {
+        OutJson = JSON::Make(JSON::Class::Object);
+    }
+
+    // USceneComponent::Serialize가 읽는 Id/ParentId는 그래프 섹션에서 채워준다
+    if (Component.Flags & Component_SceneIds)
+    {
+        OutJson["Id"] = static_cast<int64>(Component.SceneId);
+        OutJson["ParentId"] = static_cast<int64>(Component.ParentId);
+    }
+
+    PendingClass = Classes[Component.Class];
+    PendingClassIndex = Component.Class;
+    PendingBlob = Component.Blob;
+    return Classes[Component.Class];
+}
+
+bool FCookedLevelReader::LoadInto(ULevel& Level)
+{
+    if (!Header)
+    {
+        return false;
+    }
+
+    FActiveReaderScope ActiveScope(ActiveReader, this);
+
+    if (Header->LevelResidual != InvalidOffset)
+    {
+        JSON CameraJson;
+        DecodeResidual(Header->LevelResidual, CameraJson);
+        Level.ApplyPerspectiveCamera(CameraJson);
+    }
+
+    for (uint32 i = 0; i < Header->NumActors; ++i)
+    {
+        const FActorEntry& Actor = ActorTable[i];
+        UClass* ActorClass = Classes[Actor.Class];
+
+        AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(ActorClass));
+        if (!NewActor)
+        {
+            UE_LOG("[CookedLevel] SpawnActor failed: ObjectFactory could not create an instance of %s", ActorClass->Name);
+            continue;
+        }
+        Level.AddActor(NewActor);
+
+        JSON ActorJson = JSON::Make(JSON::Class::Object);
+        if (Actor.Residual != InvalidOffset)
+        {
+            DecodeResidual(Actor.Residual, ActorJson);
+        }
+
+        CurrentActor = &Actor;
+        PendingClass = ActorClass;
+        PendingClassIndex = Actor.Class;
+        PendingBlob = Actor.Blob;
+
+        NewActor->Serialize(true, ActorJson);
+
+        PendingBlob = InvalidOffset;
+        PendingClass = nullptr;
+        CurrentActor = nullptr;
+    }
+    return true;
+}
+
+//================================================================================================
+// FCookedLevel
+//================================================================================================
+
+FWideString FCookedLevel::GetCookedPath(const FWideString& ScenePath)
+{
+    fs::path Path(ScenePath);
+    Path.replace_extension(L".scenebin");
+    return Path.wstring();
+}
+
+bool FCookedLevel::IsCookedPath(const FWideString& Path)
+{
+    return fs::path(Path).extension() == L".scenebin";
+}
+
+bool FCookedLevel::Cook(const JSON& LevelJson, const FWideString& OutPath, uint64 SourceSize, int64 SourceWriteTime)
+{
+    FLevelCooker Cooker;
+    if (!Cooker.CookLevel(LevelJson))
+    {
+        return false;
+    }
+    return Cooker.WriteToFile(OutPath, SourceSize, SourceWriteTime);
+}
+
+bool FCookedLevel::CookFile(const FWideString& ScenePath)
+{
+    JSON LevelJson;
+    if (!FJsonSerializer::LoadJsonFromFile(LevelJson, ScenePath))
+    {
+        UE_LOG("[CookedLevel] Cook failed: cannot read %s", WideToUTF8(ScenePath).c_str());
+        return false;
+    }
+
+    uint64 SourceSize = 0;
+    int64 SourceWriteTime = 0;
+    GetSourceStamp(ScenePath, SourceSize, SourceWriteTime);
+
+    const FWideString CookedPath = GetCookedPath(ScenePath);
+    if (!Cook(LevelJson, CookedPath, SourceSize, SourceWriteTime))
+    {
+        return false;
+    }
+
+    std::error_code Error;
+    UE_LOG("[CookedLevel] Cooked %s (%llu -> %llu bytes)", WideToUTF8(CookedPath).c_str(),
+        static_cast<unsigned long long>(SourceSize), static_cast<unsigned long long>(fs::file_size(CookedPath, Error)));
+    return true;
+}
+
+bool FCookedLevel::TryLoad(ULevel& Level, const FWideString& ScenePath)
+{
+    FCookedLevelReader Reader;
+
+    if (IsCookedPath(ScenePath))
+    {
+        return Reader.Open(ScenePath, nullptr, nullptr) && Reader.LoadInto(Level);
+    }
+
+    const FWideString CookedPath = GetCookedPath(ScenePath);
+    std::error_code Error;
+    if (!fs::exists(CookedPath, Error))
+    {
+        return false;
+    }
+
+    // 원본이 없으면 쿠킹 파일만 배포된 것으로 보고 그대로 사용
+    uint64 SourceSize = 0;
+    int64 SourceWriteTime = 0;
+    const bool bHasSource = GetSourceStamp(ScenePath, SourceSize, SourceWriteTime);
+
+    const uint64 Start = FPlatformTime::Cycles64();
+    if (!Reader.Open(CookedPath, bHasSource ? &SourceSize : nullptr, bHasSource ? &SourceWriteTime : nullptr) ||
+        !Reader.LoadInto(Level))
+    {
+        return false;
+    }
+
+    UE_LOG("[CookedLevel] Loaded %s (%d actors, %.2f ms)", WideToUTF8(CookedPath).c_str(),
+        Level.GetActors().Num(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+    return true;
+}
+
+bool FCookedLevel::Verify(const FWideString& ScenePath)
+{
+    JSON LevelJson;
+    if (!FJsonSerializer::LoadJsonFromFile(LevelJson, ScenePath))
+    {
+        UE_LOG("[CookedLevel] Verify: cannot read %s", WideToUTF8(ScenePath).c_str());
+        return false;
+    }
+
+    std::error_code Error;
+    const FWideString TempPath = (fs::temp_directory_path(Error) / L"MundiVerify.scenebin").wstring();
+    if (!Cook(LevelJson, TempPath))
+    {
+        return false;
+    }
+
+    std::unique_ptr<ULevel> JsonLevel = ULevelService::CreateDefaultLevel();
+    JsonLevel->Serialize(true, LevelJson);
+
+    std::unique_ptr<ULevel> CookedLevel = ULevelService::CreateDefaultLevel();
+    bool bLoaded = false;
+    {
+        FCookedLevelReader Reader;
+        bLoaded = Reader.Open(TempPath, nullptr, nullptr) && Reader.LoadInto(*CookedLevel);
+    }
+
+    const bool bSame = bLoaded && CompareLevels(*JsonLevel, *CookedLevel);
+    UE_LOG("[CookedLevel] Verify %s: %s (%d actors)", WideToUTF8(ScenePath).c_str(),
+        bSame ? "identical" : "MISMATCH", JsonLevel->GetActors().Num());
+
+    DestroyLevelActors(*CookedLevel);
+    DestroyLevelActors(*JsonLevel);
+    fs::remove(TempPath, Error);
+    return bSame;
+}
+
+void FCookedLevel::RunBenchmark(int32 NumActors)
+{
+    if (NumActors <= 0)
+    {
+        UE_LOG("[CookedLevel] Benchmark: invalid actor count");
+        return;
+    }
+
+    std::error_code Error;
+    const FWideString ScenePath = (fs::temp_directory_path(Error) / L"MundiCookBench.scene").wstring();
+    const FWideString CookedPath = GetCookedPath(ScenePath);
+    if (!WriteSyntheticScene(NumActors, ScenePath))
+    {
+        UE_LOG("[CookedLevel] Benchmark: cannot write %s", WideToUTF8(ScenePath).c_str());
+        return;
+    }
+
+    // JSON 경로: 파일 읽기 + 파싱 + ULevel::Serialize
+    std::unique_ptr<ULevel> JsonLevel = ULevelService::CreateDefaultLevel();
+    const uint64 JsonStart = FPlatformTime::Cycles64();
+    JSON LoadedJson;
+    FJsonSerializer::LoadJsonFromFile(LoadedJson, ScenePath);
+    const uint64 JsonParsed = FPlatformTime::Cycles64();
+    JsonLevel->Serialize(true, LoadedJson);
+    const uint64 JsonEnd = FPlatformTime::Cycles64();
+    LoadedJson = JSON();
+
+    const uint64 CookStart = FPlatformTime::Cycles64();
+    const bool bCooked = CookFile(ScenePath);
+    const uint64 CookEnd = FPlatformTime::Cycles64();
+
+    // 쿠킹 경로: mmap + 검사 + 블롭 적용
+    std::unique_ptr<ULevel> CookedLevel = ULevelService::CreateDefaultLevel();
+    const uint64 CookedStart = FPlatformTime::Cycles64();
+    const bool bLoaded = bCooked && TryLoad(*CookedLevel, ScenePath);
+    const uint64 CookedEnd = FPlatformTime::Cycles64();
+
+    const bool bSame = bLoaded && CompareLevels(*JsonLevel, *CookedLevel);
+
+    const double JsonParseMS = FPlatformTime::ToMilliseconds(JsonParsed - JsonStart);
+    const double JsonApplyMS = FPlatformTime::ToMilliseconds(JsonEnd - JsonParsed);
+    const double CookedMS = FPlatformTime::ToMilliseconds(CookedEnd - CookedStart);
+
+    UE_LOG("[CookedLevel] Benchmark: %d actors, json %llu bytes, cooked %llu bytes", NumActors,
+        static_cast<unsigned long long>(fs::file_size(ScenePath, Error)), static_cast<unsigned long long>(fs::file_size(CookedPath, Error)));
+    UE_LOG("[CookedLevel]   json   load %.2f ms (parse %.2f + apply %.2f)", JsonParseMS + JsonApplyMS, JsonParseMS, JsonApplyMS);
+    UE_LOG("[CookedLevel]   cooked load %.2f ms (%.1fx), cook %.2f ms", CookedMS,
+        CookedMS > 0.0 ? (JsonParseMS + JsonApplyMS) / CookedMS : 0.0, FPlatformTime::ToMilliseconds(CookEnd - CookStart));
+    UE_LOG("[CookedLevel]   result: %s", bSame ? "identical" : "MISMATCH");
+
+    DestroyLevelActors(*CookedLevel);
+    DestroyLevelActors(*JsonLevel);
+    fs::remove(ScenePath, Error);
+    fs::remove(CookedPath, Error);
+}
+
+bool FCookedLevel::WriteSyntheticScene(int32 NumActors, const FWideString& OutPath)
+{
+    if (NumActors <= 0)
+    {
+        return false;
+    }
+
+    // 템플릿 액터를 실제 저장 경로로 직렬화해서 키 구성이 에디터 저장 결과와 같도록 한다
+    JSON TemplateJson = json::Object();
+    {
+        AStaticMeshActor* Template = NewObject<AStaticMeshActor>();
+        Template->GetStaticMeshComponent()->SetStaticMesh(GDataDir + "/Model/Cube.obj");
+        Template->SetTag("Bench");
+        TemplateJson["Type"] = Template->GetClass()->Name;
+        Template->Serialize(false, TemplateJson);
+        ObjectFactory::DeleteObject(Template);
+    }
+
+    uint32 TemplateRootId = 0;
+    FJsonSerializer::ReadUint32(TemplateJson, "RootComponentId", TemplateRootId, 0, false);
+    const int32 NumTemplateComponents = TemplateJson["OwnedComponents"].size();
+
+    // 격자에 배치한 NumActors개 (컴포넌트 Id는 액터마다 겹치지 않게 다시 매김)
+    JSON LevelJson = json::Object();
+    LevelJson["Version"] = 1;
+    LevelJson["NextUUID"] = 0;
+    JSON ActorListJson = json::Object();
+    const int32 GridSize = static_cast<int32>(std::ceil(std::sqrt(static_cast<float>(NumActors))));
+    for (int32 i = 0; i < NumActors; ++i)
+    {
+        JSON ActorJson = TemplateJson;
+        const long IdBase = 1 + static_cast<long>(i) * (NumTemplateComponents + 1);
+
+        TMap<long, long> Remap;
+        for (int32 c = 0; c < NumTemplateComponents; ++c)
+        {
+            Remap.Add(ActorJson["OwnedComponents"][c]["Id"].ToInt(), IdBase + c);
+        }
+        for (int32 c = 0; c < NumTemplateComponents; ++c)
+        {
+            JSON& ComponentJson = ActorJson["OwnedComponents"][c];
+            const long OldId = ComponentJson["Id"].ToInt();
+            const long OldParentId = ComponentJson["ParentId"].ToInt();
+            ComponentJson["Id"] = Remap[OldId];
+            ComponentJson["ParentId"] = OldParentId != 0 ? Remap[OldParentId] : 0;
+            if (OldId == static_cast<long>(TemplateRootId))
+            {
+                const FVector Location(static_cast<float>(i % GridSize) * 2.0f, static_cast<float>(i / GridSize) * 2.0f, 0.0f);
+                ComponentJson["RelativeLocation"] = FJsonSerializer::VectorToJson(Location);
+            }
+        }
+        ActorJson["RootComponentId"] = Remap[static_cast<long>(TemplateRootId)];
+        ActorListJson[std::to_string(1000000000 + i)] = ActorJson;
+    }
+    LevelJson["Actors"] = ActorListJson;
+    return FJsonSerializer::SaveJsonToFile(LevelJson, OutPath);
+}
@@ -0,0 +1,199 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "MappedFile.h"
+
+class ULevel;
+class UObject;
+struct UClass;
+
+namespace json { class JSON; }
+using JSON = json::JSON;
+
+// .scenebin 파일 레이아웃 (리틀 엔디언, 모든 섹션은 4바이트 정렬)
+namespace CookedLevelFormat
+{
+    constexpr uint32 Magic = 0x4C43534D;            // 'MSCL'
+    constexpr uint32 Version = 1;
+    constexpr uint32 InvalidOffset = 0xFFFFFFFFu;
+
+    struct FHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+
+        // 원본 .scene 상태 (크기 + 수정 시각). 다르면 오래된 쿠킹 결과로 판단
+        uint64 SourceSize;
+        int64 SourceWriteTime;
+
+        uint32 NumStrings;
+        uint32 StringTableOffset;                   // FStringEntry[NumStrings]
+        uint32 StringDataOffset;
+        uint32 StringDataSize;
+
+        uint32 NumClasses;
+        uint32 ClassTableOffset;                    // FClassEntry[NumClasses]
+        uint32 NumProperties;
+        uint32 PropertyTableOffset;                 // FPropertyEntry[NumProperties]
+
+        uint32 NumActors;
+        uint32 ActorTableOffset;                    // FActorEntry[NumActors]
+        uint32 NumComponents;
+        uint32 ComponentTableOffset;                // FComponentEntry[NumComponents]
+
+        uint32 BlobOffset;                          // 객체별 프로퍼티 블롭
+        uint32 BlobSize;
+        uint32 ResidualOffset;                      // 리플렉션 밖의 데이터 (태그 바이너리)
+        uint32 ResidualSize;
+
+        uint32 LevelResidual;                       // PerspectiveCamera (Residual 섹션 내 오프셋)
+        uint32 Reserved;
+    };
+
+    struct FStringEntry
+    {
+        uint32 Offset;                              // StringData 내 오프셋
+        uint32 Length;                              // 널 문자 제외
+    };
+
+    struct FClassEntry
+    {
+        uint32 Name;                                // 문자열 인덱스
+        uint32 FirstProperty;
+        uint32 NumProperties;
+        uint32 LayoutHash;                          // 이름/타입/Offset 해시
+    };
+
+    struct FPropertyEntry
+    {
+        uint32 Name;
+        uint8 Type;                                 // EPropertyType
+        uint8 InnerType;
+        uint16 Padding;
+        uint32 Offset;                              // FProperty::Offset
+    };
+
+    struct FActorEntry
+    {
+        uint32 Class;
+        uint32 RootComponentId;
+        uint32 FirstComponent;
+        uint32 NumComponents;
+        uint32 Blob;                                // Blob 섹션 내 오프셋
+        uint32 Residual;                            // Residual 섹션 내 오프셋 (없으면 InvalidOffset)
+    };
+
+    enum EComponentFlags : uint32
+    {
+        Component_SceneIds = 1 << 0,                // USceneComponent: Id/ParentId를 잔여 JSON에 다시 넣어준다
+    };
+
+    struct FComponentEntry
+    {
+        uint32 Class;
+        uint32 SceneId;
+        uint32 ParentId;
+        uint32 Flags;
+        uint32 Blob;
+        uint32 Residual;
+    };
+}
+
+/**
+ * 쿠킹된 레벨 로더 (로드 중에만 활성)
+ * - UObject::Serialize는 대기 중인 프로퍼티 블롭이 있으면 JSON 대신 블롭을 Offset 위치에 바로 적용
+ * - AActor::Serialize는 컴포넌트 목록/RootComponentId를 그래프 섹션에서 가져온다
+ * - 각 클래스의 Serialize 오버라이드에는 리플렉션 밖의 키만 담긴 잔여 JSON이 전달되므로
+ *   MaterialSlots, 카메라 설정, 변환 갱신 같은 기존 로드 후처리가 그대로 실행된다
+ */
+class FCookedLevelReader
+{
+public:
+    FCookedLevelReader() = default;
+    ~FCookedLevelReader();
+
+    FCookedLevelReader(const FCookedLevelReader&) = delete;
+    FCookedLevelReader& operator=(const FCookedLevelReader&) = delete;
+
+    // 로드 중인 Reader (없으면 nullptr)
+    static FCookedLevelReader* GetActive() { return ActiveReader; }
+
+    // 헤더/테이블/블롭 전체를 검사. 실패하면 아무 객체도 만들지 않은 상태로 false
+    bool Open(const FWideString& InPath, const uint64* ExpectedSourceSize, const int64* ExpectedSourceWriteTime);
+    bool LoadInto(ULevel& Level);
+
+    // UObject::Serialize에서 호출. 대기 중인 블롭이 Object의 클래스 것이면 적용하고 true
+    bool ApplyPendingProperties(UObject* Object);
+
+    // AActor::Serialize에서 호출 (현재 로드 중인 액터 기준)
+    uint32 GetRootComponentId() const;
+    int32 GetNumComponents() const;
+    // Index번째 컴포넌트의 클래스를 반환하고 잔여 JSON을 채운 뒤, 해당 블롭을 대기 상태로 둔다
+    UClass* BeginComponent(int32 Index, JSON& OutJson);
+
+private:
+    const FString& GetString(uint32 Index) const { return Strings[Index]; }
+
+    bool ValidateBlob(uint32 ClassIndex, uint32 BlobOffset) const;
+    bool ValidateResidual(uint32 ResidualOffset) const;
+    void DecodeResidual(uint32 ResidualOffset, JSON& OutJson) const;
+    // Out이 nullptr이면 구조/범위만 검사
+    bool ReadResidualValue(uint64& Cursor, int32 Depth, JSON* Out) const;
+
+    template<typename T>
+    T* ResolveResource(uint32 StringIndex, int32 Kind);
+
+private:
+    static FCookedLevelReader* ActiveReader;
+
+    FMappedFile File;
+    const CookedLevelFormat::FHeader* Header = nullptr;
+    const CookedLevelFormat::FClassEntry* ClassTable = nullptr;
+    const CookedLevelFormat::FPropertyEntry* PropertyTable = nullptr;
+    const CookedLevelFormat::FActorEntry* ActorTable = nullptr;
+    const CookedLevelFormat::FComponentEntry* ComponentTable = nullptr;
+    const uint8* Blobs = nullptr;
+    const uint8* Residuals = nullptr;
+
+    // 문자열 테이블은 Open 시 한 번만 FString으로 풀어둔다 (경로/태그가 객체 수보다 훨씬 적음)
+    TArray<FString> Strings;
+    TArray<UClass*> Classes;
+
+    // 문자열 인덱스 -> 로드된 리소스 (같은 경로를 쓰는 객체가 많으므로 ResourceManager 조회를 한 번으로)
+    static constexpr int32 NumResourceKinds = 5;
+    TArray<UObject*> ResourceCache[NumResourceKinds];
+    TArray<uint8> ResourceResolved[NumResourceKinds];
+
+    // 현재 로드 중인 액터와 다음 Serialize에 적용할 블롭
+    const CookedLevelFormat::FActorEntry* CurrentActor = nullptr;
+    const UClass* PendingClass = nullptr;
+    uint32 PendingClassIndex = 0;
+    uint32 PendingBlob = CookedLevelFormat::InvalidOffset;
+};
+
+/**
+ * JSON .scene -> 바이너리 .scenebin 쿠킹 및 로드
+ * - 문자열/클래스 테이블, 클래스별 프로퍼티 블롭(FProperty::Offset/타입 순), 액터/컴포넌트 그래프, 잔여 데이터
+ * - 쿠킹 파일이 원본보다 오래됐거나 클래스 레이아웃이 바뀌었으면 로드를 거부하고 JSON 경로를 사용한다
+ */
+class FCookedLevel
+{
+public:
+    static FWideString GetCookedPath(const FWideString& ScenePath);
+    static bool IsCookedPath(const FWideString& Path);
+
+    // ScenePath의 JSON을 읽어 GetCookedPath(ScenePath)에 기록
+    static bool CookFile(const FWideString& ScenePath);
+    static bool Cook(const JSON& LevelJson, const FWideString& OutPath, uint64 SourceSize = 0, int64 SourceWriteTime = 0);
+
+    // ScenePath가 .scenebin이면 그대로, .scene이면 최신 쿠킹 파일이 있을 때만 로드
+    static bool TryLoad(ULevel& Level, const FWideString& ScenePath);
+
+    // 같은 씬을 JSON/쿠킹 경로로 각각 로드해 액터별 직렬화 결과를 비교
+    static bool Verify(const FWideString& ScenePath);
+
+    // NumActors개의 합성 씬으로 JSON/쿠킹 로드 시간 비교 (콘솔 SCENE BENCH)
+    static void RunBenchmark(int32 NumActors);
+
+    // 큐브 StaticMeshActor NumActors개를 격자로 배치한 .scene을 OutPath에 기록 (벤치마크용)
+    static bool WriteSyntheticScene(int32 NumActors, const FWideString& OutPath);
+};
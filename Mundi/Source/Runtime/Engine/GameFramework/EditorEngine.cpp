@@ -177,6 +177,9 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    // 에디터 로그는 파일에도 남긴다 (기록은 로그 스레드가 처리)
+    FLog::OpenFileSink("Saved/Logs/Mundi.log");
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -217,6 +220,13 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 
 void UEditorEngine::Tick(float DeltaSeconds)
 {
+    PROFILE_SCOPE("EngineTick");
+
+    // 백그라운드에서 읽기가 끝난 비동기 로드를 프레임 예산 안에서 업로드
+    UResourceManager::GetInstance().TickAsyncLoads();
+    // 상주 메모리 예산을 넘으면 오래 쓰이지 않은 리소스를 내린다
+    UResourceManager::GetInstance().TickResidency();
+
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
     
@@ -242,6 +252,8 @@ void UEditorEngine::Tick(float DeltaSeconds)
 
 void UEditorEngine::Render()
 {
+    PROFILE_SCOPE("EngineRender");
+
     Renderer->BeginFrame();
 
     UI.Render();
@@ -273,6 +285,8 @@ void UEditorEngine::HandleUVInput(float DeltaSeconds)
 
 void UEditorEngine::MainLoop()
 {
+    FProfiler::SetThreadName("Main");
+
     LARGE_INTEGER Frequency;
     QueryPerformanceFrequency(&Frequency);
 
@@ -363,6 +377,9 @@ void UEditorEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 남은 로그를 모두 내보내고 로그 스레드 종료
+    UGlobalConsole::Shutdown();
 }
 
 
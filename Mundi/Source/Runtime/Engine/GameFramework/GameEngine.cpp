@@ -7,6 +7,9 @@
 #include "ObjManager.h"
 #include "FbxManager.h"
 #include "FAudioDevice.h"
+#include "HeadlessRunner.h"
+#include "SceneBenchmark.h"
+#include "PlatformTime.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -203,6 +206,126 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     // Preload audio assets
     FAudioDevice::Preload();
 
+    // 시작 scene(level)을 직접 로드 
+    if (!LoadStartupLevel(GDataDir + "/Scenes/PlayScene.scene"))
+    {
+        return false;
+    }
+
+    bPlayActive = true;
+    bRunning = true;
+    return true;
+}
+
+bool UGameEngine::StartupHeadless(const FHeadlessOptions& Options)
+{
+    bHeadless = true;
+    FProfiler::SetThreadName("Main");
+
+    ClientWidth = static_cast<float>(Options.Width);
+    ClientHeight = static_cast<float>(Options.Height);
+
+    //레거시
+    extern float CLIENTWIDTH;
+    extern float CLIENTHEIGHT;
+    CLIENTWIDTH = ClientWidth;
+    CLIENTHEIGHT = ClientHeight;
+
+    // 디바이스 리소스 및 렌더러 생성 (스왑체인/D2D 오버레이 없음)
+    if (!RHIDevice.InitializeHeadless(Options.Width, Options.Height, Options.bForceWarp))
+    {
+        return false;
+    }
+    Renderer = std::make_unique<URenderer>(&RHIDevice);
+
+    GameViewport = std::make_unique<FViewport>();
+    if (!GameViewport->Initialize(0, 0, ClientWidth, ClientHeight, GetRHIDevice()->GetDevice()))
+    {
+        UE_LOG("Failed to initialize GameViewport!");
+        return false;
+    }
+
+    // 입력/오디오는 초기화하지 않는다 (창 핸들이 없으면 입력은 갱신만 건너뛰고, 오디오 재생은 무시됨)
+    FObjManager::Preload();
+    FFbxManager::Preload();
+    RESOURCE.PreloadFbxMeshes();
+
+    if (!LoadStartupLevel(Options.ScenePath))
+    {
+        return false;
+    }
+
+    bPlayActive = true;
+    bRunning = true;
+    return true;
+}
+
+int32 UGameEngine::RunHeadless(const FHeadlessOptions& Options)
+{
+    if (!bHeadless)
+    {
+        return 1;
+    }
+
+    const auto RunFrame = [this, &Options](double& OutTickMilliseconds, double& OutRenderMilliseconds)
+    {
+        const uint64 TickStart = FPlatformTime::Cycles64();
+        Tick(Options.DeltaSeconds);
+        const uint64 RenderStart = FPlatformTime::Cycles64();
+        if (Options.bRender)
+        {
+            Render();
+        }
+        else
+        {
+            // Render()의 Renderer->EndFrame이 하던 프레임 경계 처리만 수행
+            FFrameArena::Get().EndFrame();
+            FProfiler::EndFrame();
+        }
+        const uint64 RenderEnd = FPlatformTime::Cycles64();
+
+        OutTickMilliseconds = FPlatformTime::ToMilliseconds(RenderStart - TickStart);
+        OutRenderMilliseconds = FPlatformTime::ToMilliseconds(RenderEnd - RenderStart);
+    };
+
+    double TickMilliseconds = 0.0;
+    double RenderMilliseconds = 0.0;
+    for (int32 Frame = 0; Frame < Options.NumWarmupFrames; ++Frame)
+    {
+        RunFrame(TickMilliseconds, RenderMilliseconds);
+    }
+
+    // 측정 구간 (트레이스는 NumFrames 뒤 EndFrame에서 자동으로 기록)
+    if (!Options.TracePath.empty())
+    {
+        FProfiler::BeginCapture(Options.NumFrames, Options.TracePath);
+    }
+
+    FHeadlessReport Report;
+    Report.Begin(Options, RHIDevice.GetDriverName(), LoadMilliseconds);
+    for (int32 Frame = 0; Frame < Options.NumFrames; ++Frame)
+    {
+        RunFrame(TickMilliseconds, RenderMilliseconds);
+        Report.AddFrame(TickMilliseconds, RenderMilliseconds);
+    }
+    FProfiler::EndCapture();
+
+    return Report.Finish() ? 0 : 1;
+}
+
+int32 UGameEngine::RunBenchmark(const FSceneBenchmarkOptions& Options)
+{
+    if (!bHeadless)
+    {
+        return 1;
+    }
+    return FSceneBenchmark::Run(Options, RHIDevice.GetDriverName(), [this]() { Render(); });
+}
+
+bool UGameEngine::LoadStartupLevel(const FString& ScenePath)
+{
+    const uint64 LoadStart = FPlatformTime::Cycles64();
+
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Game));
     GWorld = WorldContexts[0].World;
@@ -210,11 +333,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     GWorld->bPie = true;
     ///////////////////////////////////
 
-    // 시작 scene(level)을 직접 로드 
-    const FString StartupScenePath = GDataDir + "/Scenes/PlayScene.scene";
-    if (!GWorld->LoadLevelFromFile(UTF8ToWide(StartupScenePath)))
+    if (!GWorld->LoadLevelFromFile(UTF8ToWide(ScenePath)))
     {
-        UE_LOG("Failed to load startup scene: %s", StartupScenePath.c_str());
+        UE_LOG("Failed to load startup scene: %s", ScenePath.c_str());
         return false;
     }
 
@@ -225,13 +346,19 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
         Actor->BeginPlay();
     }
 
-    bPlayActive = true;
-    bRunning = true;
+    LoadMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LoadStart);
     return true;
 }
 
 void UGameEngine::Tick(float DeltaSeconds)
 {
+    PROFILE_SCOPE("EngineTick");
+
+    // 백그라운드에서 읽기가 끝난 비동기 로드를 프레임 예산 안에서 업로드
+    UResourceManager::GetInstance().TickAsyncLoads();
+    // 상주 메모리 예산을 넘으면 오래 쓰이지 않은 리소스를 내린다
+    UResourceManager::GetInstance().TickResidency();
+
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
@@ -244,6 +371,8 @@ void UGameEngine::Tick(float DeltaSeconds)
 
 void UGameEngine::Render()
 {
+    PROFILE_SCOPE("EngineRender");
+
     Renderer->BeginFrame();
 
     if (GWorld)
@@ -289,6 +418,8 @@ void UGameEngine::HandleUVInput(float DeltaSeconds)
 
 void UGameEngine::MainLoop()
 {
+    FProfiler::SetThreadName("Main");
+
     LARGE_INTEGER Frequency;
     QueryPerformanceFrequency(&Frequency);
 
@@ -356,5 +487,12 @@ void UGameEngine::Shutdown()
     // Explicitly release D3D11RHI resources before global destruction
     RHIDevice.Release();
 
-    SaveIniFile();
+    // 헤드리스 실행은 창 크기 등 사용자 설정을 건드리지 않는다
+    if (!bHeadless)
+    {
+        SaveIniFile();
+    }
+
+    // 남은 로그를 모두 내보내고 로그 스레드 종료
+    UGlobalConsole::Shutdown();
 }
@@ -5,6 +5,8 @@ class URenderer;
 class D3D11RHI;
 class UWorld;
 class FViewport;
+struct FHeadlessOptions;
+struct FSceneBenchmarkOptions;
 
 class UGameEngine final
 {
@@ -16,6 +18,14 @@ public:
     void MainLoop();
     void Shutdown();
 
+    // 창/입력/오디오 없이 초기화 (헤드리스 RHI + 오프스크린 백버퍼)
+    bool StartupHeadless(const FHeadlessOptions& Options);
+    // 고정 DeltaSeconds로 워밍업 + 측정 프레임을 돌리고 통계를 기록. 성공하면 0
+    int32 RunHeadless(const FHeadlessOptions& Options);
+    // StartupHeadless 이후 씬 벤치마크 실행 (FSceneBenchmark). 실패나 회귀가 있으면 1
+    int32 RunBenchmark(const FSceneBenchmarkOptions& Options);
+    bool IsHeadless() const { return bHeadless; }
+
     bool IsPlayActive() const { return bPlayActive; }
 
     HWND GetHWND() const { return HWnd; }
@@ -40,6 +50,9 @@ private:
 
     void HandleUVInput(float DeltaSeconds);
 
+    // 월드를 만들고 ScenePath를 로드한 뒤 BeginPlay
+    bool LoadStartupLevel(const FString& ScenePath);
+
 private:
     //윈도우 핸들
     HWND HWnd = nullptr;
@@ -58,6 +71,10 @@ private:
     bool bRunning = false;
     bool bUVScrollPaused = true;
     bool bPlayActive = false;
+    bool bHeadless = false;
+
+    // 마지막 LoadStartupLevel 소요 시간
+    double LoadMilliseconds = 0.0;
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
@@ -0,0 +1,194 @@
+﻿#include "pch.h"
+#include "HeadlessRunner.h"
+#include "PlatformTime.h"
+#include <cstdio>
+
+bool FHeadlessOptions::ReadToken(const char*& Cursor, FString& OutKey, FString& OutValue)
+{
+    while (*Cursor == ' ' || *Cursor == '\t')
+    {
+        ++Cursor;
+    }
+    if (*Cursor == '\0')
+    {
+        return false;
+    }
+
+    FString Token;
+    bool bQuoted = false;
+    while (*Cursor != '\0' && (bQuoted || (*Cursor != ' ' && *Cursor != '\t')))
+    {
+        if (*Cursor == '"')
+        {
+            bQuoted = !bQuoted;
+        }
+        else
+        {
+            Token += *Cursor;
+        }
+        ++Cursor;
+    }
+
+    const size_t Equal = Token.find('=');
+    OutKey = Token.substr(0, Equal);
+    OutValue = Equal != FString::npos ? Token.substr(Equal + 1) : FString();
+    return true;
+}
+
+FHeadlessOptions FHeadlessOptions::Parse(const char* CommandLine)
+{
+    FHeadlessOptions Options;
+    Options.ScenePath = GDataDir + "/Scenes/PlayScene.scene";
+    if (!CommandLine)
+    {
+        return Options;
+    }
+
+    const char* Cursor = CommandLine;
+    FString Key;
+    FString Value;
+    while (ReadToken(Cursor, Key, Value))
+    {
+        if (_stricmp(Key.c_str(), "-headless") == 0)        { Options.bEnabled = true; }
+        else if (_stricmp(Key.c_str(), "-scene") == 0)      { Options.ScenePath = Value; }
+        else if (_stricmp(Key.c_str(), "-frames") == 0)     { Options.NumFrames = std::max(1, atoi(Value.c_str())); }
+        else if (_stricmp(Key.c_str(), "-warmup") == 0)     { Options.NumWarmupFrames = std::max(0, atoi(Value.c_str())); }
+        else if (_stricmp(Key.c_str(), "-dt") == 0)         { Options.DeltaSeconds = std::max(0.0001f, static_cast<float>(atof(Value.c_str()))); }
+        else if (_stricmp(Key.c_str(), "-width") == 0)      { Options.Width = static_cast<uint32>(std::max(1, atoi(Value.c_str()))); }
+        else if (_stricmp(Key.c_str(), "-height") == 0)     { Options.Height = static_cast<uint32>(std::max(1, atoi(Value.c_str()))); }
+        else if (_stricmp(Key.c_str(), "-stats") == 0)      { Options.StatsPath = Value; }
+        else if (_stricmp(Key.c_str(), "-trace") == 0)      { Options.TracePath = Value; }
+        else if (_stricmp(Key.c_str(), "-warp") == 0)       { Options.bForceWarp = true; }
+        else if (_stricmp(Key.c_str(), "-norender") == 0)   { Options.bRender = false; }
+    }
+    return Options;
+}
+
+void FHeadlessOptions::AttachStdOut()
+{
+    // CI처럼 stdout이 파이프/파일로 넘어온 경우는 그대로 쓰고, 아니면 부모 콘솔에 붙는다
+    const HANDLE StdOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (StdOut == nullptr || StdOut == INVALID_HANDLE_VALUE)
+    {
+        if (AttachConsole(ATTACH_PARENT_PROCESS))
+        {
+            FILE* Stream = nullptr;
+            freopen_s(&Stream, "CONOUT$", "w", stdout);
+            freopen_s(&Stream, "CONOUT$", "w", stderr);
+        }
+    }
+    UGlobalConsole::SetEchoToStdOut(true);
+}
+
+double FHeadlessReport::Percentile(const TArray<double>& Sorted, double Fraction)
+{
+    if (Sorted.IsEmpty())
+    {
+        return 0.0;
+    }
+    const int32 Index = static_cast<int32>(Fraction * static_cast<double>(Sorted.Num() - 1) + 0.5);
+    return Sorted[std::clamp(Index, 0, Sorted.Num() - 1)];
+}
+
+void FHeadlessReport::Begin(const FHeadlessOptions& InOptions, const char* InDriverName, double InLoadMilliseconds)
+{
+    Options = InOptions;
+    DriverName = InDriverName ? InDriverName : "";
+    LoadMilliseconds = InLoadMilliseconds;
+    FrameMilliseconds.Empty();
+    FrameMilliseconds.Reserve(Options.NumFrames);
+    TotalTickMilliseconds = 0.0;
+    TotalRenderMilliseconds = 0.0;
+
+    FProfiler::BeginStatHistory();
+}
+
+void FHeadlessReport::AddFrame(double TickMilliseconds, double RenderMilliseconds)
+{
+    FrameMilliseconds.Add(TickMilliseconds + RenderMilliseconds);
+    TotalTickMilliseconds += TickMilliseconds;
+    TotalRenderMilliseconds += RenderMilliseconds;
+}
+
+bool FHeadlessReport::Finish()
+{
+    TArray<FProfilerStatSummary> Stats;
+    FProfiler::EndStatHistory(Stats);
+
+    TArray<double> Sorted = FrameMilliseconds;
+    std::sort(Sorted.begin(), Sorted.end());
+
+    const int32 NumFrames = FrameMilliseconds.Num();
+    double TotalMilliseconds = 0.0;
+    for (double Milliseconds : FrameMilliseconds)
+    {
+        TotalMilliseconds += Milliseconds;
+    }
+    const double AverageMilliseconds = NumFrames > 0 ? TotalMilliseconds / NumFrames : 0.0;
+
+    JSON Root = JSON::Make(JSON::Class::Object);
+    Root["Scene"] = Options.ScenePath;
+    Root["Driver"] = DriverName;
+    Root["Frames"] = NumFrames;
+    Root["WarmupFrames"] = Options.NumWarmupFrames;
+    Root["DeltaSeconds"] = static_cast<double>(Options.DeltaSeconds);
+    Root["Render"] = Options.bRender;
+    Root["LoadMs"] = LoadMilliseconds;
+
+    JSON FrameJson = JSON::Make(JSON::Class::Object);
+    FrameJson["AvgMs"] = AverageMilliseconds;
+    FrameJson["MinMs"] = Sorted.IsEmpty() ? 0.0 : Sorted[0];
+    FrameJson["P50Ms"] = Percentile(Sorted, 0.50);
+    FrameJson["P95Ms"] = Percentile(Sorted, 0.95);
+    FrameJson["P99Ms"] = Percentile(Sorted, 0.99);
+    FrameJson["MaxMs"] = Sorted.IsEmpty() ? 0.0 : Sorted.Last();
+    FrameJson["TickAvgMs"] = NumFrames > 0 ? TotalTickMilliseconds / NumFrames : 0.0;
+    FrameJson["RenderAvgMs"] = NumFrames > 0 ? TotalRenderMilliseconds / NumFrames : 0.0;
+    Root["FrameTime"] = FrameJson;
+
+    JSON StatsJson = JSON::Make(JSON::Class::Array);
+    for (const FProfilerStatSummary& Stat : Stats)
+    {
+        JSON StatJson = JSON::Make(JSON::Class::Object);
+        StatJson["Name"] = Stat.Name;
+        StatJson["TotalMs"] = Stat.TotalMilliseconds;
+        StatJson["AvgFrameMs"] = NumFrames > 0 ? Stat.TotalMilliseconds / NumFrames : 0.0;
+        StatJson["MaxFrameMs"] = Stat.MaxFrameMilliseconds;
+        StatJson["Calls"] = static_cast<int64>(Stat.CallCount);
+        StatJson["Frames"] = static_cast<int64>(Stat.NumFrames);
+        StatsJson.append(StatJson);
+    }
+    Root["Stats"] = StatsJson;
+
+    UE_LOG("[Headless] %s: %d frames (%s driver), load %.1f ms",
+        Options.ScenePath.c_str(), NumFrames, DriverName.c_str(), LoadMilliseconds);
+    UE_LOG("[Headless] Frame avg %.3f ms, p50 %.3f, p95 %.3f, p99 %.3f, max %.3f (tick %.3f, render %.3f)",
+        AverageMilliseconds, Percentile(Sorted, 0.50), Percentile(Sorted, 0.95), Percentile(Sorted, 0.99),
+        Sorted.IsEmpty() ? 0.0 : Sorted.Last(),
+        NumFrames > 0 ? TotalTickMilliseconds / NumFrames : 0.0, NumFrames > 0 ? TotalRenderMilliseconds / NumFrames : 0.0);
+    for (const FProfilerStatSummary& Stat : Stats)
+    {
+        UE_LOG("[Headless]   %-32s %9.3f ms/frame  max %9.3f  calls %llu",
+            Stat.Name.c_str(), NumFrames > 0 ? Stat.TotalMilliseconds / NumFrames : 0.0, Stat.MaxFrameMilliseconds,
+            static_cast<unsigned long long>(Stat.CallCount));
+    }
+
+    if (Options.StatsPath.empty())
+    {
+        return true;
+    }
+
+    const std::filesystem::path StatsPath(UTF8ToWide(Options.StatsPath));
+    if (StatsPath.has_parent_path())
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(StatsPath.parent_path(), ec);
+    }
+    if (!FJsonSerializer::SaveJsonToFile(Root, StatsPath.wstring()))
+    {
+        UE_LOG("[Headless] Failed to write %s", Options.StatsPath.c_str());
+        return false;
+    }
+    UE_LOG("[Headless] Stats written: %s", Options.StatsPath.c_str());
+    return true;
+}
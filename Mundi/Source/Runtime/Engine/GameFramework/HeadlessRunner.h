@@ -0,0 +1,57 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 헤드리스 실행 옵션 (StandAlone 빌드, 명령줄 -headless)
+ *   -scene=<path>   로드할 .scene (기본 Data/Scenes/PlayScene.scene)
+ *   -frames=<N>     측정 프레임 수 (기본 600), -warmup=<N> 측정 전 프레임 수 (기본 30)
+ *   -dt=<seconds>   고정 DeltaSeconds (기본 1/60)
+ *   -width=, -height=  오프스크린 백버퍼 크기
+ *   -stats=<path>   결과 JSON (기본 Saved/Headless/Stats.json)
+ *   -trace=<path>   측정 구간 전체를 Chrome 트레이스로 기록
+ *   -warp           NULL 드라이버 대신 WARP 사용, -norender  렌더링 생략 (Tick만)
+ */
+struct FHeadlessOptions
+{
+    bool bEnabled = false;
+    FString ScenePath;
+    int32 NumFrames = 600;
+    int32 NumWarmupFrames = 30;
+    float DeltaSeconds = 1.0f / 60.0f;
+    uint32 Width = 1280;
+    uint32 Height = 720;
+    bool bForceWarp = false;
+    bool bRender = true;
+    FString StatsPath = "Saved/Headless/Stats.json";
+    FString TracePath;
+
+    static FHeadlessOptions Parse(const char* CommandLine);
+    // "-key=value" 또는 "-flag" 토큰 하나를 읽는다 (따옴표로 묶인 값 허용). 더 없으면 false
+    static bool ReadToken(const char*& Cursor, FString& OutKey, FString& OutValue);
+
+    // GUI 서브시스템 실행 파일에서 UE_LOG를 부모 콘솔/리다이렉트된 stdout으로 내보낸다
+    static void AttachStdOut();
+};
+
+/**
+ * 헤드리스 실행 결과 수집 및 기록
+ * - 프레임 시간 분포 (평균/최소/백분위/최대)와 FProfiler 스탯 합계를 JSON으로 저장하고 요약을 로그로 출력
+ */
+class FHeadlessReport
+{
+public:
+    void Begin(const FHeadlessOptions& InOptions, const char* InDriverName, double InLoadMilliseconds);
+    void AddFrame(double TickMilliseconds, double RenderMilliseconds);
+    bool Finish();
+
+    // 정렬된 표본의 Fraction(0~1) 백분위 (비어 있으면 0)
+    static double Percentile(const TArray<double>& Sorted, double Fraction);
+
+private:
+    FHeadlessOptions Options;
+    FString DriverName;
+    double LoadMilliseconds = 0.0;
+    TArray<double> FrameMilliseconds;
+    double TotalTickMilliseconds = 0.0;
+    double TotalRenderMilliseconds = 0.0;
+};
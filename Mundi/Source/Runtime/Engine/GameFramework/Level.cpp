@@ -11,6 +11,7 @@
 #include "AmbientLightComponent.h"
 #include "World.h"
 #include "JsonSerializer.h"
+#include "CookedLevel.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -49,10 +50,25 @@ void ULevel::SpawnDefaultActors()
    
 }
 
-void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+bool ULevelService::LoadLevelFromFile(ULevel& Level, const FWideString& Path)
 {
-    Super::Serialize(bInIsLoading, InOutHandle);
+    // 최신 쿠킹 파일(.scenebin)이 있으면 우선 사용, 없거나 오래됐으면 JSON
+    if (FCookedLevel::TryLoad(Level, Path))
+    {
+        return true;
+    }
 
+    JSON LevelJsonData;
+    if (!FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
+    {
+        return false;
+    }
+    Level.Serialize(true, LevelJsonData);
+    return true;
+}
+
+namespace
+{
     struct FPerspectiveCameraData
     {
         FVector Location;
@@ -61,6 +77,37 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         float NearClip;
         float FarClip;
     };
+}
+
+void ULevel::ApplyPerspectiveCamera(const JSON& PerspectiveCameraData)
+{
+    // 카메라 정보
+    ACameraActor* CamActor = GWorld->GetEditorCameraActor();
+    FPerspectiveCameraData CamData;
+    if (CamActor)
+    {
+        // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
+        // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+        // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
+        FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
+        FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
+        FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
+        FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
+        FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
+
+        CamActor->SetActorLocation(CamData.Location);
+        CamActor->SetRotationFromEulerAngles(CamData.Rotation);
+        if (auto* CamComp = CamActor->GetCameraComponent())
+        {
+            CamComp->SetFOV(CamData.FOV);
+            CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
+        }
+    }
+}
+
+void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+{
+    Super::Serialize(bInIsLoading, InOutHandle);
 
     if (bInIsLoading)
     {
@@ -68,28 +115,7 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         JSON PerspectiveCameraData;
         if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
         {
-            // 카메라 정보
-            ACameraActor* CamActor = GWorld->GetEditorCameraActor();
-            FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
+            ApplyPerspectiveCamera(PerspectiveCameraData);
         }
 
         // Actors 정보
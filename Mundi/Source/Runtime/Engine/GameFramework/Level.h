@@ -23,6 +23,8 @@ public:
     void Clear() { Actors.Empty(); }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+    // 씬의 PerspectiveCamera 항목을 에디터 카메라에 적용 (JSON/쿠킹 로드 공용)
+    void ApplyPerspectiveCamera(const JSON& PerspectiveCameraData);
 private:
     TArray<AActor*> Actors;
 };
@@ -33,4 +35,6 @@ public:
     // Create a new empty level
     static std::unique_ptr<ULevel> CreateNewLevel();
     static std::unique_ptr<ULevel> CreateDefaultLevel();
+    // .scene(JSON) 또는 쿠킹된 .scenebin을 Level에 로드
+    static bool LoadLevelFromFile(ULevel& Level, const FWideString& Path);
 };
@@ -0,0 +1,601 @@
+#include "pch.h"
+#include "ProjectileManager.h"
+#include "BVHierarchy.h"
+#include "MeshBatchElement.h"
+#include "StaticMesh.h"
+#include "Shader.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
+#include <xmmintrin.h>
+#include <random>
+
+namespace
+{
+    const char* ProjectileShaderPath = "Shaders/Effects/ProjectileInstanced.hlsl";
+
+    // 반사 후 같은 면에 다시 걸리지 않도록 법선 방향으로 띄우는 거리
+    constexpr float BounceSkinDistance = 0.001f;
+}
+
+FProjectileManager::FProjectileManager() = default;
+
+FProjectileManager::~FProjectileManager()
+{
+    ReleaseInstanceBuffer();
+}
+
+int32 FProjectileManager::CreateGroup(const FProjectileGroupDesc& InDesc)
+{
+    FGroup NewGroup;
+    NewGroup.Desc = InDesc;
+    Groups.Add(NewGroup);
+    return Groups.Num() - 1;
+}
+
+const FProjectileGroupDesc* FProjectileManager::GetGroupDesc(int32 Group) const
+{
+    return (Group >= 0 && Group < Groups.Num()) ? &Groups[Group].Desc : nullptr;
+}
+
+FProjectileHandle FProjectileManager::Spawn(int32 Group, const FVector& Location, const FVector& Velocity, const AActor* Instigator)
+{
+    const FProjectileGroupDesc* Desc = GetGroupDesc(Group);
+    if (!Desc)
+    {
+        return 0;
+    }
+
+    uint32 Slot = 0;
+    if (!FreeSlots.IsEmpty())
+    {
+        Slot = FreeSlots.back();
+        FreeSlots.pop_back();
+    }
+    else
+    {
+        if (static_cast<uint32>(SlotToIndex.Num()) >= MaxSlots)
+        {
+            UE_LOG("[Projectile] Spawn failed: slot limit (%u) reached\r\n", MaxSlots);
+            return 0;
+        }
+        Slot = static_cast<uint32>(SlotToIndex.Num());
+        SlotToIndex.Add(InvalidIndex);
+        SlotGeneration.Add(1);
+    }
+
+    const int32 Index = PosX.Num();
+    SlotToIndex[Slot] = Index;
+
+    PosX.Add(Location.X);
+    PosY.Add(Location.Y);
+    PosZ.Add(Location.Z);
+    VelX.Add(Velocity.X);
+    VelY.Add(Velocity.Y);
+    VelZ.Add(Velocity.Z);
+    GravityZ.Add(Desc->GravityZ);
+    Life.Add(Desc->Lifespan);
+    Radius.Add(Desc->Radius);
+    GroupIndex.Add(Group);
+    SlotOf.Add(Slot);
+    Instigators.Add(Instigator);
+
+    return IndexToHandle(Index);
+}
+
+bool FProjectileManager::Destroy(FProjectileHandle Handle)
+{
+    const int32 Index = HandleToIndex(Handle);
+    if (Index == InvalidIndex)
+    {
+        return false;
+    }
+    RemoveAtSwap(Index);
+    return true;
+}
+
+bool FProjectileManager::GetLocation(FProjectileHandle Handle, FVector& OutLocation) const
+{
+    const int32 Index = HandleToIndex(Handle);
+    if (Index == InvalidIndex)
+    {
+        return false;
+    }
+    OutLocation = FVector(PosX[Index], PosY[Index], PosZ[Index]);
+    return true;
+}
+
+bool FProjectileManager::GetVelocity(FProjectileHandle Handle, FVector& OutVelocity) const
+{
+    const int32 Index = HandleToIndex(Handle);
+    if (Index == InvalidIndex)
+    {
+        return false;
+    }
+    OutVelocity = FVector(VelX[Index], VelY[Index], VelZ[Index]);
+    return true;
+}
+
+void FProjectileManager::Clear()
+{
+    // 세대를 올려야 기존 핸들이 재사용된 슬롯을 가리키지 않음
+    for (int32 Index = PosX.Num() - 1; Index >= 0; --Index)
+    {
+        RemoveAtSwap(Index);
+    }
+    Events.Empty();
+    Stats = FProjectileStats{};
+}
+
+int32 FProjectileManager::HandleToIndex(FProjectileHandle Handle) const
+{
+    const uint32 Slot = Handle & SlotMask;
+    const uint32 Generation = Handle >> SlotBits;
+    if (Generation == 0 || Slot >= static_cast<uint32>(SlotToIndex.Num()) || SlotGeneration[Slot] != Generation)
+    {
+        return InvalidIndex;
+    }
+    return SlotToIndex[Slot];
+}
+
+FProjectileHandle FProjectileManager::IndexToHandle(int32 Index) const
+{
+    const uint32 Slot = SlotOf[Index];
+    return (static_cast<uint32>(SlotGeneration[Slot]) << SlotBits) | Slot;
+}
+
+void FProjectileManager::RemoveAtSwap(int32 Index)
+{
+    const uint32 Slot = SlotOf[Index];
+    SlotToIndex[Slot] = InvalidIndex;
+    uint16 NextGeneration = static_cast<uint16>((SlotGeneration[Slot] + 1) & GenerationMask);
+    SlotGeneration[Slot] = NextGeneration == 0 ? 1 : NextGeneration;
+    FreeSlots.Add(Slot);
+
+    const int32 Last = PosX.Num() - 1;
+    if (Index != Last)
+    {
+        PosX[Index] = PosX[Last];
+        PosY[Index] = PosY[Last];
+        PosZ[Index] = PosZ[Last];
+        VelX[Index] = VelX[Last];
+        VelY[Index] = VelY[Last];
+        VelZ[Index] = VelZ[Last];
+        GravityZ[Index] = GravityZ[Last];
+        Life[Index] = Life[Last];
+        Radius[Index] = Radius[Last];
+        GroupIndex[Index] = GroupIndex[Last];
+        SlotOf[Index] = SlotOf[Last];
+        Instigators[Index] = Instigators[Last];
+        SlotToIndex[SlotOf[Index]] = Index;
+    }
+
+    PosX.pop_back();
+    PosY.pop_back();
+    PosZ.pop_back();
+    VelX.pop_back();
+    VelY.pop_back();
+    VelZ.pop_back();
+    GravityZ.pop_back();
+    Life.pop_back();
+    Radius.pop_back();
+    GroupIndex.pop_back();
+    SlotOf.pop_back();
+    Instigators.pop_back();
+}
+
+void FProjectileManager::Tick(float DeltaSeconds, FBVHierarchy* BVH)
+{
+    Events.Empty();
+    Stats.NumHits = 0;
+    Stats.NumExpired = 0;
+    Stats.NumSweeps = 0;
+
+    const int32 N = PosX.Num();
+    if (N == 0 || DeltaSeconds <= 0.0f)
+    {
+        Stats.NumLive = N;
+        Stats.SimulateMS = 0.0;
+        Stats.CompactMS = 0.0;
+        return;
+    }
+
+    const uint64 SimulateStart = FPlatformTime::Cycles64();
+
+    EndX.SetNum(N);
+    EndY.SetNum(N);
+    EndZ.SetNum(N);
+
+    const int32 NumChunks = (N + ChunkSize - 1) / ChunkSize;
+    if (Chunks.Num() < NumChunks)
+    {
+        Chunks.SetNum(NumChunks);
+    }
+
+    // 워커는 메시 BVH/월드 행렬을 스냅샷에서만 읽는다 (전역 메시 BVH 잠금 경합, 트랜스폼 경쟁 없음)
+    if (BVH)
+    {
+        BVH->PrepareSweepSnapshot();
+    }
+
+    // 청크끼리는 서로 다른 인덱스 구간만 쓰므로 동기화 없이 병렬 처리
+    ParallelFor(NumChunks, 1, [&](int32 BeginChunk, int32 EndChunk)
+        {
+            for (int32 Chunk = BeginChunk; Chunk < EndChunk; ++Chunk)
+            {
+                const int32 Begin = Chunk * ChunkSize;
+                const int32 End = std::min(N, Begin + ChunkSize);
+                SimulateChunk(Begin, End, DeltaSeconds, BVH, Chunks[Chunk]);
+            }
+        });
+
+    // 청크 순서대로 합쳐 이벤트 순서를 스레드 수와 무관하게 유지
+    TArray<int32> DeadIndices;
+    for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+    {
+        FChunkScratch& Scratch = Chunks[Chunk];
+        Stats.NumSweeps += Scratch.Queries.Num();
+        Events.Append(Scratch.Events);
+        DeadIndices.Append(Scratch.Dead);
+    }
+    for (const FProjectileEvent& Event : Events)
+    {
+        if (Event.Type == EProjectileEvent::Hit) ++Stats.NumHits;
+        else ++Stats.NumExpired;
+    }
+
+    const uint64 CompactStart = FPlatformTime::Cycles64();
+    Stats.SimulateMS = FPlatformTime::ToMilliseconds(CompactStart - SimulateStart);
+
+    // 큰 인덱스부터 제거해야 swap으로 끌어오는 마지막 원소가 항상 살아있는 발사체
+    std::sort(DeadIndices.begin(), DeadIndices.end(), std::greater<int32>());
+    for (int32 Index : DeadIndices)
+    {
+        RemoveAtSwap(Index);
+    }
+
+    Stats.CompactMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CompactStart);
+    Stats.NumLive = PosX.Num();
+}
+
+void FProjectileManager::SimulateChunk(int32 Begin, int32 End, float DeltaSeconds, const FBVHierarchy* BVH, FChunkScratch& Scratch)
+{
+    Scratch.QueryIndices.Empty();
+    Scratch.Queries.Empty();
+    Scratch.Events.Empty();
+    Scratch.Dead.Empty();
+
+    // --- 1. 적분 (semi-implicit Euler, SSE 4-wide) ---
+    const __m128 Dt = _mm_set1_ps(DeltaSeconds);
+    int32 Index = Begin;
+    for (; Index + 4 <= End; Index += 4)
+    {
+        const __m128 Vz = _mm_add_ps(_mm_loadu_ps(&VelZ[Index]), _mm_mul_ps(_mm_loadu_ps(&GravityZ[Index]), Dt));
+        _mm_storeu_ps(&VelZ[Index], Vz);
+
+        _mm_storeu_ps(&EndX[Index], _mm_add_ps(_mm_loadu_ps(&PosX[Index]), _mm_mul_ps(_mm_loadu_ps(&VelX[Index]), Dt)));
+        _mm_storeu_ps(&EndY[Index], _mm_add_ps(_mm_loadu_ps(&PosY[Index]), _mm_mul_ps(_mm_loadu_ps(&VelY[Index]), Dt)));
+        _mm_storeu_ps(&EndZ[Index], _mm_add_ps(_mm_loadu_ps(&PosZ[Index]), _mm_mul_ps(Vz, Dt)));
+        _mm_storeu_ps(&Life[Index], _mm_sub_ps(_mm_loadu_ps(&Life[Index]), Dt));
+    }
+    for (; Index < End; ++Index)
+    {
+        VelZ[Index] += GravityZ[Index] * DeltaSeconds;
+        EndX[Index] = PosX[Index] + VelX[Index] * DeltaSeconds;
+        EndY[Index] = PosY[Index] + VelY[Index] * DeltaSeconds;
+        EndZ[Index] = PosZ[Index] + VelZ[Index] * DeltaSeconds;
+        Life[Index] -= DeltaSeconds;
+    }
+
+    // --- 2. 스윕 (청크 단위 배치) ---
+    if (BVH)
+    {
+        for (Index = Begin; Index < End; ++Index)
+        {
+            if (!Groups[GroupIndex[Index]].Desc.bCollide)
+            {
+                continue;
+            }
+
+            FSweepQuery Query;
+            Query.Start = FVector(PosX[Index], PosY[Index], PosZ[Index]);
+            Query.End = FVector(EndX[Index], EndY[Index], EndZ[Index]);
+            Query.Radius = Radius[Index];
+            Query.IgnoreActor = Instigators[Index];
+            Scratch.Queries.Add(Query);
+            Scratch.QueryIndices.Add(Index);
+        }
+        BVH->SweepClosestBatch(Scratch.Queries, Scratch.Hits);
+    }
+
+    // --- 3. 충돌 처리: 반사하거나 소멸, 최종 위치는 End에 기록 ---
+    for (int32 QueryIndex = 0; QueryIndex < Scratch.Queries.Num(); ++QueryIndex)
+    {
+        const FSweepHit& Hit = Scratch.Hits[QueryIndex];
+        if (!Hit.bBlockingHit)
+        {
+            continue;
+        }
+
+        Index = Scratch.QueryIndices[QueryIndex];
+        const FProjectileGroupDesc& Desc = Groups[GroupIndex[Index]].Desc;
+
+        FProjectileEvent Event;
+        Event.Type = EProjectileEvent::Hit;
+        Event.Handle = IndexToHandle(Index);
+        Event.Group = GroupIndex[Index];
+        Event.Location = Hit.Location;
+        Event.Normal = Hit.ImpactNormal;
+        Event.HitActor = Hit.Actor;
+        Event.HitComponent = Hit.Component;
+        Scratch.Events.Add(Event);
+
+        FVector Rest = Hit.Location;
+        bool bKeepAlive = false;
+        if (Desc.Bounciness > 0.0f)
+        {
+            const FVector& Normal = Hit.ImpactNormal;
+            FVector Velocity(VelX[Index], VelY[Index], VelZ[Index]);
+            const float IntoSurface = FVector::Dot(Velocity, Normal);
+            if (IntoSurface < 0.0f)
+            {
+                Velocity = Velocity - Normal * ((1.0f + Desc.Bounciness) * IntoSurface);
+                VelX[Index] = Velocity.X;
+                VelY[Index] = Velocity.Y;
+                VelZ[Index] = Velocity.Z;
+            }
+            Rest = Rest + Normal * BounceSkinDistance;
+            // 면에서 멀어지는 속력이 작으면 바닥을 타고 매 프레임 충돌하므로 소멸 처리
+            bKeepAlive = FVector::Dot(Velocity, Normal) >= Desc.BounceStopSpeed;
+        }
+
+        if (!bKeepAlive)
+        {
+            Scratch.Dead.Add(Index);
+        }
+
+        EndX[Index] = Rest.X;
+        EndY[Index] = Rest.Y;
+        EndZ[Index] = Rest.Z;
+    }
+
+    const SIZE_T NumBytes = static_cast<SIZE_T>(End - Begin) * sizeof(float);
+    std::memcpy(&PosX[Begin], &EndX[Begin], NumBytes);
+    std::memcpy(&PosY[Begin], &EndY[Begin], NumBytes);
+    std::memcpy(&PosZ[Begin], &EndZ[Begin], NumBytes);
+
+    // --- 4. 수명 만료 (이미 충돌로 소멸한 발사체는 제외, Dead는 오름차순) ---
+    const int32 NumHitDead = Scratch.Dead.Num();
+    int32 Cursor = 0;
+    for (Index = Begin; Index < End; ++Index)
+    {
+        if (Life[Index] > 0.0f)
+        {
+            continue;
+        }
+        while (Cursor < NumHitDead && Scratch.Dead[Cursor] < Index)
+        {
+            ++Cursor;
+        }
+        if (Cursor < NumHitDead && Scratch.Dead[Cursor] == Index)
+        {
+            continue;
+        }
+
+        FProjectileEvent Event;
+        Event.Type = EProjectileEvent::Expired;
+        Event.Handle = IndexToHandle(Index);
+        Event.Group = GroupIndex[Index];
+        Event.Location = FVector(PosX[Index], PosY[Index], PosZ[Index]);
+        Scratch.Events.Add(Event);
+        Scratch.Dead.Add(Index);
+    }
+}
+
+void FProjectileManager::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+{
+    Stats.NumDrawCalls = 0;
+
+    const int32 N = PosX.Num();
+    if (N == 0 || Groups.IsEmpty())
+    {
+        return;
+    }
+
+    static const TResourceHandle<UShader> ShaderHandle(ProjectileShaderPath);
+    UShader* Shader = ShaderHandle.Get();
+    FShaderVariant* ShaderVariant = Shader ? Shader->GetOrCompileShaderVariant() : nullptr;
+    if (!ShaderVariant)
+    {
+        return;
+    }
+
+    // 그룹별 counting sort -> 그룹마다 연속된 인스턴스 구간 하나
+    const int32 NumGroups = Groups.Num();
+    GroupInstanceOffsets.assign(NumGroups + 1, 0);
+    for (int32 Index = 0; Index < N; ++Index)
+    {
+        ++GroupInstanceOffsets[GroupIndex[Index] + 1];
+    }
+    for (int32 Group = 0; Group < NumGroups; ++Group)
+    {
+        GroupInstanceOffsets[Group + 1] += GroupInstanceOffsets[Group];
+    }
+
+    TArray<int32> WriteCursor(GroupInstanceOffsets.begin(), GroupInstanceOffsets.end() - 1);
+    InstanceData.SetNum(N);
+    for (int32 Index = 0; Index < N; ++Index)
+    {
+        const int32 Group = GroupIndex[Index];
+        const FLinearColor& Color = Groups[Group].Desc.Color;
+
+        FInstanceData& Instance = InstanceData[WriteCursor[Group]++];
+        Instance.Position[0] = PosX[Index];
+        Instance.Position[1] = PosY[Index];
+        Instance.Position[2] = PosZ[Index];
+        Instance.Radius = Radius[Index];
+        Instance.Color[0] = Color.R;
+        Instance.Color[1] = Color.G;
+        Instance.Color[2] = Color.B;
+        Instance.Color[3] = Color.A;
+    }
+
+    if (!EnsureInstanceBuffer(static_cast<uint32>(N)))
+    {
+        return;
+    }
+
+    ID3D11DeviceContext* Context = UResourceManager::GetInstance().GetDeviceContext();
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    if (FAILED(Context->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return;
+    }
+    std::memcpy(Mapped.pData, InstanceData.data(), sizeof(FInstanceData) * N);
+    Context->Unmap(InstanceBuffer, 0);
+
+    for (int32 Group = 0; Group < NumGroups; ++Group)
+    {
+        const int32 Count = GroupInstanceOffsets[Group + 1] - GroupInstanceOffsets[Group];
+        if (Count == 0)
+        {
+            continue;
+        }
+
+        // 시뮬레이션(벤치마크 포함)이 렌더 리소스에 의존하지 않도록 메시는 처음 그릴 때 로드
+        FGroup& GroupData = Groups[Group];
+        if (!GroupData.Mesh)
+        {
+            GroupData.Mesh = UResourceManager::GetInstance().Load<UStaticMesh>(GroupData.Desc.MeshPath);
+        }
+        UStaticMesh* Mesh = GroupData.Mesh;
+        if (!Mesh || !Mesh->GetVertexBuffer() || !Mesh->GetIndexBuffer())
+        {
+            continue;
+        }
+
+        FMeshBatchElement BatchElement;
+        BatchElement.VertexShader = ShaderVariant->VertexShader;
+        BatchElement.PixelShader = ShaderVariant->PixelShader;
+        BatchElement.InputLayout = ShaderVariant->InputLayout;
+        BatchElement.VertexBuffer = Mesh->GetVertexBuffer();
+        BatchElement.IndexBuffer = Mesh->GetIndexBuffer();
+        BatchElement.VertexStride = Mesh->GetVertexStride();
+        BatchElement.IndexCount = Mesh->GetIndexCount();
+        BatchElement.StartIndex = 0;
+        BatchElement.BaseVertexIndex = 0;
+        BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+        BatchElement.WorldMatrix = FMatrix::Identity();
+        BatchElement.InstanceBuffer = InstanceBuffer;
+        BatchElement.InstanceStride = sizeof(FInstanceData);
+        BatchElement.InstanceCount = static_cast<uint32>(Count);
+        BatchElement.StartInstance = static_cast<uint32>(GroupInstanceOffsets[Group]);
+        OutMeshBatchElements.Add(BatchElement);
+
+        ++Stats.NumDrawCalls;
+    }
+}
+
+bool FProjectileManager::EnsureInstanceBuffer(uint32 NumInstances)
+{
+    if (InstanceBuffer && InstanceCapacity >= NumInstances)
+    {
+        return true;
+    }
+
+    ReleaseInstanceBuffer();
+
+    // 매 프레임 재생성을 피하기 위해 2배씩 증가
+    uint32 NewCapacity = 1024;
+    while (NewCapacity < NumInstances)
+    {
+        NewCapacity *= 2;
+    }
+
+    D3D11_BUFFER_DESC BufferDesc = {};
+    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    BufferDesc.ByteWidth = NewCapacity * sizeof(FInstanceData);
+    BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    HRESULT Hr = UResourceManager::GetInstance().GetDevice()->CreateBuffer(&BufferDesc, nullptr, &InstanceBuffer);
+    if (FAILED(Hr))
+    {
+        UE_LOG("[Projectile] Failed to create instance buffer (%u instances)\r\n", NewCapacity);
+        InstanceBuffer = nullptr;
+        return false;
+    }
+
+    InstanceCapacity = NewCapacity;
+    return true;
+}
+
+void FProjectileManager::ReleaseInstanceBuffer()
+{
+    if (InstanceBuffer)
+    {
+        InstanceBuffer->Release();
+        InstanceBuffer = nullptr;
+    }
+    InstanceCapacity = 0;
+}
+
+void FProjectileManager::RunBenchmark(int32 Count, int32 Frames, FBVHierarchy* BVH)
+{
+    if (Count <= 0 || Frames <= 0)
+    {
+        UE_LOG("[Projectile] Benchmark: invalid arguments\r\n");
+        return;
+    }
+
+    // 월드 BVH 범위 안에서 발사 (BVH가 없으면 원점 주변 100m 큐브)
+    FVector Min(-50.0f, -50.0f, 0.0f);
+    FVector Max(50.0f, 50.0f, 50.0f);
+    if (BVH)
+    {
+        Min = BVH->GetBounds().Min;
+        Max = BVH->GetBounds().Max;
+    }
+    const FVector Size = Max - Min;
+    const float Speed = std::max(5.0f, std::max(Size.X, std::max(Size.Y, Size.Z)) * 0.1f);
+
+    FProjectileManager Manager;
+    FProjectileGroupDesc Desc;
+    Desc.Radius = 0.1f;
+    Desc.Lifespan = 1.0e6f;
+    Desc.Bounciness = 0.5f;                 // 반사시켜 개수를 유지
+    const int32 Group = Manager.CreateGroup(Desc);
+
+    std::mt19937 Rng(1234);
+    std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> Signed(-1.0f, 1.0f);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FVector Location(Min.X + Size.X * Unit(Rng), Min.Y + Size.Y * Unit(Rng), Min.Z + Size.Z * Unit(Rng));
+        const FVector Velocity(Signed(Rng) * Speed, Signed(Rng) * Speed, Signed(Rng) * Speed);
+        Manager.Spawn(Group, Location, Velocity);
+    }
+
+    constexpr float FrameTime = 1.0f / 60.0f;
+    double TotalMS = 0.0;
+    double WorstMS = 0.0;
+    int64 TotalSweeps = 0;
+    int64 TotalHits = 0;
+    for (int32 Frame = 0; Frame < Frames; ++Frame)
+    {
+        const uint64 Start = FPlatformTime::Cycles64();
+        Manager.Tick(FrameTime, BVH);
+        const double FrameMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+        TotalMS += FrameMS;
+        WorstMS = std::max(WorstMS, FrameMS);
+        TotalSweeps += Manager.GetStats().NumSweeps;
+        TotalHits += Manager.GetStats().NumHits;
+    }
+
+    const double AvgMS = TotalMS / Frames;
+    UE_LOG("[Projectile] Benchmark: %d projectiles x %d frames, %d threads, BVH %s\r\n",
+        Count, Frames, FWorkerPool::GetInstance().GetConcurrency(), BVH ? "on" : "off");
+    UE_LOG("[Projectile]   tick avg %.3f ms, worst %.3f ms (60Hz budget 16.667 ms)\r\n", AvgMS, WorstMS);
+    UE_LOG("[Projectile]   %.2f M projectile-steps/s, sweeps %lld, hits %lld, live %d\r\n",
+        AvgMS > 0.0 ? (Count / AvgMS) / 1000.0 : 0.0, TotalSweeps, TotalHits, Manager.Num());
+}
@@ -0,0 +1,175 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+#include "Collision.h"
+
+class AActor;
+class UPrimitiveComponent;
+class UStaticMesh;
+class FBVHierarchy;
+class FSceneView;
+struct FMeshBatchElement;
+
+// 상위 12비트 세대 + 하위 20비트 슬롯 (0은 무효 핸들)
+using FProjectileHandle = uint32;
+
+// 같은 그룹의 발사체는 물리 파라미터와 메시/색상을 공유한다
+struct FProjectileGroupDesc
+{
+    float Radius = 0.25f;
+    float GravityZ = -9.8f;
+    float Lifespan = 5.0f;
+    float Bounciness = 0.0f;            // 0이면 충돌 시 소멸, 0보다 크면 반사 후 계속 비행
+    float BounceStopSpeed = 0.5f;       // 반사 후 법선 방향 속력이 이보다 작으면 소멸
+    bool bCollide = true;               // false면 BVH 스윕 없이 수명만 관리
+    FString MeshPath = "Data/Model/Sphere8.obj";
+    FLinearColor Color = FLinearColor(1.0f, 0.5f, 0.1f, 1.0f);
+};
+
+enum class EProjectileEvent : uint8
+{
+    Hit,
+    Expired
+};
+
+// Tick 중 발생한 이벤트. 게임 코드(Lua)는 개별 발사체를 폴링하지 않고 이 목록만 처리한다
+struct FProjectileEvent
+{
+    EProjectileEvent Type = EProjectileEvent::Hit;
+    FProjectileHandle Handle = 0;
+    int32 Group = -1;
+    FVector Location;
+    FVector Normal;
+    AActor* HitActor = nullptr;
+    UPrimitiveComponent* HitComponent = nullptr;
+};
+
+struct FProjectileStats
+{
+    int32 NumLive = 0;
+    int32 NumHits = 0;                  // 이번 Tick
+    int32 NumExpired = 0;               // 이번 Tick
+    int32 NumSweeps = 0;                // 이번 Tick
+    int32 NumDrawCalls = 0;             // 마지막 CollectMeshBatches
+    double SimulateMS = 0.0;            // 적분 + 스윕 + 충돌 처리
+    double CompactMS = 0.0;             // 죽은 발사체 제거
+};
+
+/**
+ * 액터/컴포넌트 없이 대량의 단순 발사체를 처리하는 매니저 (UWorld 소유)
+ * - 위치/속도/수명을 SoA 배열로 보관, SSE로 4개씩 적분
+ * - 청크 단위 ParallelFor에서 적분 -> 청크별 SweepClosestBatch -> 충돌 처리까지 한 번에 수행
+ * - 렌더링은 그룹당 인스턴스 드로우 1회 (동적 인스턴스 버퍼)
+ * - 스크립트에는 충돌/수명 만료 이벤트만 전달된다
+ */
+class FProjectileManager
+{
+public:
+    FProjectileManager();
+    ~FProjectileManager();
+
+    FProjectileManager(const FProjectileManager&) = delete;
+    FProjectileManager& operator=(const FProjectileManager&) = delete;
+
+    int32 CreateGroup(const FProjectileGroupDesc& InDesc);
+    const FProjectileGroupDesc* GetGroupDesc(int32 Group) const;
+
+    FProjectileHandle Spawn(int32 Group, const FVector& Location, const FVector& Velocity, const AActor* Instigator = nullptr);
+    bool Destroy(FProjectileHandle Handle);
+    bool IsAlive(FProjectileHandle Handle) const { return HandleToIndex(Handle) != InvalidIndex; }
+    bool GetLocation(FProjectileHandle Handle, FVector& OutLocation) const;
+    bool GetVelocity(FProjectileHandle Handle, FVector& OutVelocity) const;
+    // 살아있는 발사체를 모두 제거 (그룹은 유지)
+    void Clear();
+
+    // BVH가 nullptr이면 충돌 없이 적분/수명만 처리 (스윕 전에 BVH의 좁은 단계 스냅샷을 갱신하므로 non-const)
+    void Tick(float DeltaSeconds, FBVHierarchy* BVH);
+
+    // 마지막 Tick에서 발생한 이벤트 (다음 Tick 시작 시 비워짐)
+    const TArray<FProjectileEvent>& GetEvents() const { return Events; }
+
+    int32 Num() const { return PosX.Num(); }
+    const FProjectileStats& GetStats() const { return Stats; }
+
+    // 그룹별 인스턴스 드로우를 OutMeshBatchElements에 추가
+    void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+
+    // 헤드리스 벤치마크: 별도 매니저에 Count개를 띄우고 Frames번 Tick (콘솔 PROJECTILE BENCH)
+    static void RunBenchmark(int32 Count, int32 Frames, FBVHierarchy* BVH);
+
+private:
+    static constexpr int32 InvalidIndex = -1;
+    static constexpr uint32 SlotBits = 20;
+    static constexpr uint32 SlotMask = (1u << SlotBits) - 1;
+    static constexpr uint32 MaxSlots = SlotMask;
+    static constexpr uint32 GenerationMask = (1u << (32 - SlotBits)) - 1;
+
+    // ParallelFor 한 구간에서 처리하는 발사체 수
+    static constexpr int32 ChunkSize = 2048;
+
+    struct FGroup
+    {
+        FProjectileGroupDesc Desc;
+        UStaticMesh* Mesh = nullptr;
+    };
+
+    // 청크 하나의 작업 공간 (청크 간 공유 없음)
+    struct FChunkScratch
+    {
+        TArray<int32> QueryIndices;         // Queries[i]에 대응하는 발사체 인덱스
+        TArray<FSweepQuery> Queries;
+        TArray<FSweepHit> Hits;
+        TArray<FProjectileEvent> Events;
+        TArray<int32> Dead;
+    };
+
+    // 셰이더 입력과 동일한 레이아웃 (ProjectileInstanced.hlsl)
+    struct FInstanceData
+    {
+        float Position[3];
+        float Radius;
+        float Color[4];
+    };
+
+    int32 HandleToIndex(FProjectileHandle Handle) const;
+    FProjectileHandle IndexToHandle(int32 Index) const;
+
+    // [Begin, End) 적분 + 스윕 + 충돌 처리
+    void SimulateChunk(int32 Begin, int32 End, float DeltaSeconds, const FBVHierarchy* BVH, FChunkScratch& Scratch);
+    // 마지막 원소를 Index로 옮겨 제거 (슬롯 매핑 갱신)
+    void RemoveAtSwap(int32 Index);
+
+    bool EnsureInstanceBuffer(uint32 NumInstances);
+    void ReleaseInstanceBuffer();
+
+private:
+    TArray<FGroup> Groups;
+
+    // SoA 발사체 데이터 (모두 같은 길이, 인덱스는 프레임 사이에 바뀔 수 있음)
+    TArray<float> PosX, PosY, PosZ;
+    TArray<float> VelX, VelY, VelZ;
+    TArray<float> GravityZ;
+    TArray<float> Life;
+    TArray<float> Radius;
+    TArray<int32> GroupIndex;
+    TArray<uint32> SlotOf;
+    TArray<const AActor*> Instigators;
+
+    // 핸들 슬롯 -> 발사체 인덱스
+    TArray<int32> SlotToIndex;
+    TArray<uint16> SlotGeneration;
+    TArray<uint32> FreeSlots;
+
+    // 적분 결과 (스윕의 End)
+    TArray<float> EndX, EndY, EndZ;
+
+    TArray<FChunkScratch> Chunks;
+    TArray<FProjectileEvent> Events;
+    FProjectileStats Stats;
+
+    // 렌더링
+    TArray<FInstanceData> InstanceData;
+    TArray<int32> GroupInstanceOffsets;
+    ID3D11Buffer* InstanceBuffer = nullptr;
+    uint32 InstanceCapacity = 0;
+};
@@ -0,0 +1,543 @@
+﻿#include "pch.h"
+#include "SceneBenchmark.h"
+#include "HeadlessRunner.h"
+#include "CookedLevel.h"
+#include "Level.h"
+#include "World.h"
+#include "Actor.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "SkeletalMeshComponent.h"
+#include "BoundingSphere.h"
+#include "Frustum.h"
+#include "Picking.h" // FRay
+#include "JsonSerializer.h"
+#include "PlatformTime.h"
+#include <filesystem>
+#include <random>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // 파티션 갱신 측정에서 반복마다 dirty로 표시하는 액터 수 (UWorldPartitionManager::Update 기본 예산)
+    constexpr uint32 PartitionBudget = 256;
+    // 반복 한 번에 실행하는 레이/오버랩 쿼리 수
+    constexpr int32 NumQueriesPerIteration = 256;
+
+    struct FBenchmarkCase
+    {
+        FString Name;
+        FWideString Path;
+        int32 NumSyntheticActors = 0;   // 0보다 크면 실행 중에 만들고 지우는 합성 씬
+    };
+
+    JSON MakeMetricJson(TArray<double>& Samples)
+    {
+        std::sort(Samples.begin(), Samples.end());
+        double Total = 0.0;
+        for (double Milliseconds : Samples)
+        {
+            Total += Milliseconds;
+        }
+
+        JSON MetricJson = JSON::Make(JSON::Class::Object);
+        MetricJson["Samples"] = Samples.Num();
+        MetricJson["AvgMs"] = Samples.IsEmpty() ? 0.0 : Total / Samples.Num();
+        MetricJson["MinMs"] = Samples.IsEmpty() ? 0.0 : Samples[0];
+        MetricJson["P50Ms"] = FHeadlessReport::Percentile(Samples, 0.50);
+        MetricJson["P95Ms"] = FHeadlessReport::Percentile(Samples, 0.95);
+        MetricJson["MaxMs"] = Samples.IsEmpty() ? 0.0 : Samples.Last();
+        return MetricJson;
+    }
+
+    template<typename FuncType>
+    void Measure(TArray<double>& OutSamples, int32 NumIterations, FuncType&& Func)
+    {
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            const uint64 Start = FPlatformTime::Cycles64();
+            Func(Iteration);
+            OutSamples.Add(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+        }
+    }
+
+    double FindStatMilliseconds(const TArray<FProfilerStatSummary>& Stats, const char* Name)
+    {
+        for (const FProfilerStatSummary& Stat : Stats)
+        {
+            if (Stat.Name == Name)
+            {
+                return Stat.TotalMilliseconds;
+            }
+        }
+        return 0.0;
+    }
+
+    // 이전 레벨의 액터 삭제 비용이 로드 시간에 섞이지 않도록 빈 레벨로 먼저 비운다
+    void ClearWorldLevel()
+    {
+        GWorld->SetLevel(ULevelService::CreateDefaultLevel());
+    }
+
+    bool RunCase(const FBenchmarkCase& Case, const FSceneBenchmarkOptions& Options, const std::function<void()>& RenderFrame, JSON& OutCaseJson)
+    {
+        TArray<double> LoadSamples;
+        for (int32 Iteration = 0; Iteration < Options.NumLoadIterations; ++Iteration)
+        {
+            ClearWorldLevel();
+
+            const uint64 Start = FPlatformTime::Cycles64();
+            std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
+            if (!ULevelService::LoadLevelFromFile(*NewLevel, Case.Path))
+            {
+                UE_LOG("[Bench] %s: failed to load %s", Case.Name.c_str(), WideToUTF8(Case.Path).c_str());
+                return false;
+            }
+            GWorld->SetLevel(std::move(NewLevel));
+            LoadSamples.Add(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+        }
+
+        ULevel* Level = GWorld->GetLevel();
+        const TArray<AActor*> Actors = Level->GetActors();
+        for (AActor* Actor : Actors)
+        {
+            Actor->BeginPlay();
+        }
+
+        // 저장: 직렬화 + 파일 기록 (임시 폴더)
+        std::error_code Error;
+        const FWideString SavePath = (fs::temp_directory_path(Error) / L"MundiBenchSave.scene").wstring();
+        TArray<double> SaveSamples;
+        Measure(SaveSamples, Options.NumLoadIterations, [&](int32)
+        {
+            JSON LevelJson = json::Object();
+            Level->Serialize(false, LevelJson);
+            FJsonSerializer::SaveJsonToFile(LevelJson, SavePath);
+        });
+        fs::remove(SavePath, Error);
+
+        for (int32 Frame = 0; Frame < Options.NumWarmupFrames; ++Frame)
+        {
+            GWorld->Tick(Options.DeltaSeconds);
+            RenderFrame();
+        }
+
+        // 프레임 루프: Tick은 직접 재고, 렌더 내부 항목은 프레임마다 프로파일러 스탯에서 읽는다
+        TArray<double> TickSamples;
+        TArray<double> GatherSamples;
+        TArray<double> SortSamples;
+        TArray<FProfilerStatSummary> FrameStats;
+        for (int32 Iteration = 0; Iteration < Options.NumIterations; ++Iteration)
+        {
+            const uint64 TickStart = FPlatformTime::Cycles64();
+            GWorld->Tick(Options.DeltaSeconds);
+            TickSamples.Add(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - TickStart));
+
+            FProfiler::BeginStatHistory();
+            RenderFrame();
+            FProfiler::EndStatHistory(FrameStats);
+            GatherSamples.Add(FindStatMilliseconds(FrameStats, "GatherVisibleProxies"));
+            SortSamples.Add(FindStatMilliseconds(FrameStats, "SortMeshBatches"));
+        }
+
+        // 파티션 갱신: 매 반복 다른 액터 PartitionBudget개를 움직인 것으로 표시
+        UWorldPartitionManager* Partition = GWorld->GetPartitionManager();
+        TArray<double> PartitionSamples;
+        if (!Actors.IsEmpty())
+        {
+            const int32 NumDirty = std::min(static_cast<int32>(PartitionBudget), Actors.Num());
+            for (int32 Iteration = 0; Iteration < Options.NumIterations; ++Iteration)
+            {
+                for (int32 i = 0; i < NumDirty; ++i)
+                {
+                    Partition->MarkDirty(Actors[(Iteration * NumDirty + i) % Actors.Num()]);
+                }
+
+                const uint64 Start = FPlatformTime::Cycles64();
+                Partition->Update(Options.DeltaSeconds, PartitionBudget);
+                PartitionSamples.Add(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+            }
+        }
+
+        // BVH 쿼리 입력은 고정 시드로 만들어 실행마다 같은 쿼리를 던진다
+        TArray<double> FrustumSamples;
+        TArray<double> RaySamples;
+        TArray<double> OverlapSamples;
+        FBVHierarchy* BVH = Partition->GetBVH();
+        if (BVH && BVH->TotalActorCount() > 0)
+        {
+            const FAABB& Bounds = BVH->GetBounds();
+            const FVector Size = Bounds.Max - Bounds.Min;
+            std::mt19937 Rng(1234);
+            std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+            const auto RandomPoint = [&]()
+            {
+                return FVector(Bounds.Min.X + Size.X * Unit(Rng), Bounds.Min.Y + Size.Y * Unit(Rng), Bounds.Min.Z + Size.Z * Unit(Rng));
+            };
+            const float Reach = std::max(Size.Size() * 0.02f, 1.0f);
+
+            TArray<FRay> Rays;
+            TArray<FBoundingSphere> Spheres;
+            for (int32 i = 0; i < NumQueriesPerIteration; ++i)
+            {
+                FRay Ray;
+                Ray.Origin = RandomPoint();
+                Ray.Direction = (RandomPoint() - Ray.Origin).GetSafeNormal();
+                if (Ray.Direction.SizeSquared() == 0.0f)
+                {
+                    Ray.Direction = FVector(0.0f, 0.0f, -1.0f);
+                }
+                Rays.Add(Ray);
+                Spheres.Add(FBoundingSphere(RandomPoint(), Reach));
+            }
+
+            // 트리 범위 가운데 절반을 덮는 박스 프러스텀 (FBVHierarchy::RunAllocationTest와 같은 구성)
+            const FVector Lo = Bounds.Min + Size * 0.25f;
+            const FVector Hi = Bounds.Max - Size * 0.25f;
+            const auto MakePlane = [](float X, float Y, float Z, float Distance)
+            {
+                FPlane Plane;
+                Plane.Normal = FVector4(X, Y, Z, 0.0f);
+                Plane.Distance = Distance;
+                return Plane;
+            };
+            FFrustum Frustum;
+            Frustum.LeftFace = MakePlane(1.0f, 0.0f, 0.0f, Lo.X);
+            Frustum.RightFace = MakePlane(-1.0f, 0.0f, 0.0f, -Hi.X);
+            Frustum.BottomFace = MakePlane(0.0f, 1.0f, 0.0f, Lo.Y);
+            Frustum.TopFace = MakePlane(0.0f, -1.0f, 0.0f, -Hi.Y);
+            Frustum.NearFace = MakePlane(0.0f, 0.0f, 1.0f, Lo.Z);
+            Frustum.FarFace = MakePlane(0.0f, 0.0f, -1.0f, -Hi.Z);
+
+            Measure(FrustumSamples, Options.NumIterations, [&](int32)
+            {
+                BVH->QueryFrustum(Frustum);
+            });
+
+            int32 NumHits = 0;
+            Measure(RaySamples, Options.NumIterations, [&](int32)
+            {
+                for (const FRay& Ray : Rays)
+                {
+                    AActor* HitActor = nullptr;
+                    float HitT = -1.0f;
+                    BVH->QueryRayClosest(Ray, HitActor, HitT);
+                    NumHits += HitActor ? 1 : 0;
+                }
+            });
+
+            TArray<UPrimitiveComponent*> Overlaps;
+            int32 NumOverlaps = 0;
+            Measure(OverlapSamples, Options.NumIterations, [&](int32)
+            {
+                for (const FBoundingSphere& Sphere : Spheres)
+                {
+                    BVH->QueryIntersectedComponents(Sphere, Overlaps);
+                    NumOverlaps += Overlaps.Num();
+                }
+            });
+
+            // 쿼리 루프가 최적화로 사라지지 않도록 결과를 남긴다
+            OutCaseJson["RayHits"] = NumHits;
+            OutCaseJson["Overlaps"] = NumOverlaps;
+        }
+
+        // CPU 스키닝: 씬의 스켈레탈 메시 전체를 한 번씩
+        TArray<USkeletalMeshComponent*> SkinnedComponents;
+        for (AActor* Actor : Actors)
+        {
+            for (UActorComponent* Component : Actor->GetOwnedComponents())
+            {
+                if (USkeletalMeshComponent* SkeletalComponent = Cast<USkeletalMeshComponent>(Component))
+                {
+                    SkinnedComponents.Add(SkeletalComponent);
+                }
+            }
+        }
+        TArray<double> SkinningSamples;
+        if (!SkinnedComponents.IsEmpty())
+        {
+            Measure(SkinningSamples, Options.NumIterations, [&](int32)
+            {
+                for (USkeletalMeshComponent* SkeletalComponent : SkinnedComponents)
+                {
+                    SkeletalComponent->PerformCPUSkinning();
+                }
+            });
+        }
+
+        JSON MetricsJson = JSON::Make(JSON::Class::Object);
+        const auto AddMetric = [&MetricsJson](const char* Name, TArray<double>& Samples)
+        {
+            if (!Samples.IsEmpty())
+            {
+                MetricsJson[Name] = MakeMetricJson(Samples);
+            }
+        };
+        AddMetric("Load", LoadSamples);
+        AddMetric("Save", SaveSamples);
+        AddMetric("WorldTick", TickSamples);
+        AddMetric("PartitionUpdate", PartitionSamples);
+        AddMetric("FrustumQuery", FrustumSamples);
+        AddMetric("RayQuery", RaySamples);
+        AddMetric("OverlapQuery", OverlapSamples);
+        AddMetric("CPUSkinning", SkinningSamples);
+        AddMetric("GatherVisibleProxies", GatherSamples);
+        AddMetric("SortMeshBatches", SortSamples);
+
+        OutCaseJson["Scene"] = WideToUTF8(Case.Path);
+        OutCaseJson["Actors"] = Actors.Num();
+        OutCaseJson["SkeletalMeshes"] = SkinnedComponents.Num();
+        OutCaseJson["Metrics"] = MetricsJson;
+
+        UE_LOG("[Bench] %s: %d actors", Case.Name.c_str(), Actors.Num());
+        for (auto& Metric : MetricsJson.ObjectRange())
+        {
+            UE_LOG("[Bench]   %-22s p50 %9.3f ms  avg %9.3f  p95 %9.3f", Metric.first.c_str(),
+                Metric.second["P50Ms"].ToFloat(), Metric.second["AvgMs"].ToFloat(), Metric.second["P95Ms"].ToFloat());
+        }
+
+        ClearWorldLevel();
+        return true;
+    }
+
+    bool LoadResults(const FString& Path, JSON& OutJson)
+    {
+        if (!FJsonSerializer::LoadJsonFromFile(OutJson, UTF8ToWide(Path)) || !OutJson.hasKey("Cases"))
+        {
+            UE_LOG("[Bench] Cannot read results: %s", Path.c_str());
+            return false;
+        }
+        return true;
+    }
+}
+
+FSceneBenchmarkOptions FSceneBenchmarkOptions::Parse(const char* CommandLine)
+{
+    FSceneBenchmarkOptions Options;
+    if (!CommandLine)
+    {
+        return Options;
+    }
+
+    const auto Split = [](const FString& Value, char Delimiter)
+    {
+        TArray<FString> Parts;
+        size_t Begin = 0;
+        while (Begin <= Value.size())
+        {
+            const size_t End = std::min(Value.find(Delimiter, Begin), Value.size());
+            if (End > Begin)
+            {
+                Parts.Add(Value.substr(Begin, End - Begin));
+            }
+            Begin = End + 1;
+        }
+        return Parts;
+    };
+
+    const char* Cursor = CommandLine;
+    FString Key;
+    FString Value;
+    while (FHeadlessOptions::ReadToken(Cursor, Key, Value))
+    {
+        if (_stricmp(Key.c_str(), "-bench") == 0)               { Options.bEnabled = true; }
+        else if (_stricmp(Key.c_str(), "-scenes") == 0)         { Options.ScenePaths = Split(Value, ';'); }
+        else if (_stricmp(Key.c_str(), "-synthetic") == 0)
+        {
+            Options.SyntheticActorCounts.Empty();
+            for (const FString& Count : Split(Value, ','))
+            {
+                if (atoi(Count.c_str()) > 0)
+                {
+                    Options.SyntheticActorCounts.Add(atoi(Count.c_str()));
+                }
+            }
+        }
+        else if (_stricmp(Key.c_str(), "-iterations") == 0)     { Options.NumIterations = std::max(1, atoi(Value.c_str())); }
+        else if (_stricmp(Key.c_str(), "-loads") == 0)          { Options.NumLoadIterations = std::max(1, atoi(Value.c_str())); }
+        else if (_stricmp(Key.c_str(), "-warmup") == 0)         { Options.NumWarmupFrames = std::max(0, atoi(Value.c_str())); }
+        else if (_stricmp(Key.c_str(), "-out") == 0)            { Options.OutPath = Value; }
+        else if (_stricmp(Key.c_str(), "-baseline") == 0)       { Options.BaselinePath = Value; }
+        else if (_stricmp(Key.c_str(), "-compare") == 0)        { Options.ComparePath = Value; }
+        else if (_stricmp(Key.c_str(), "-threshold") == 0)      { Options.ThresholdPercent = std::max(0.0, atof(Value.c_str())); }
+        else if (_stricmp(Key.c_str(), "-mindelta") == 0)       { Options.MinDeltaMilliseconds = std::max(0.0, atof(Value.c_str())); }
+    }
+    return Options;
+}
+
+int32 FSceneBenchmark::Run(const FSceneBenchmarkOptions& Options, const char* DriverName, const std::function<void()>& RenderFrame)
+{
+    if (!GWorld)
+    {
+        return 1;
+    }
+
+    TArray<FBenchmarkCase> Cases;
+    if (Options.ScenePaths.IsEmpty())
+    {
+        std::error_code Error;
+        TArray<fs::path> SceneFiles;
+        for (const fs::directory_entry& Entry : fs::directory_iterator(UTF8ToWide(GDataDir + "/Scenes"), Error))
+        {
+            if (Entry.is_regular_file() && Entry.path().extension() == L".scene")
+            {
+                SceneFiles.Add(Entry.path());
+            }
+        }
+        std::sort(SceneFiles.begin(), SceneFiles.end());
+        for (const fs::path& SceneFile : SceneFiles)
+        {
+            Cases.Add({ WideToUTF8(SceneFile.stem().wstring()), SceneFile.wstring(), 0 });
+        }
+    }
+    else
+    {
+        for (const FString& ScenePath : Options.ScenePaths)
+        {
+            const fs::path SceneFile(UTF8ToWide(ScenePath));
+            Cases.Add({ WideToUTF8(SceneFile.stem().wstring()), SceneFile.wstring(), 0 });
+        }
+    }
+
+    // 합성 씬은 측정 직전에 임시 폴더에 만들고 끝나면 지운다 (100k 씬은 수십 MB)
+    std::error_code Error;
+    for (int32 NumActors : Options.SyntheticActorCounts)
+    {
+        const FWideString Path = (fs::temp_directory_path(Error) / (L"MundiBench" + std::to_wstring(NumActors) + L".scene")).wstring();
+        Cases.Add({ "Synthetic" + std::to_string(NumActors), Path, NumActors });
+    }
+
+    JSON CasesJson = JSON::Make(JSON::Class::Object);
+    bool bAllSucceeded = true;
+    for (const FBenchmarkCase& Case : Cases)
+    {
+        if (Case.NumSyntheticActors > 0)
+        {
+            if (!FCookedLevel::WriteSyntheticScene(Case.NumSyntheticActors, Case.Path))
+            {
+                UE_LOG("[Bench] %s: cannot write %s", Case.Name.c_str(), WideToUTF8(Case.Path).c_str());
+                bAllSucceeded = false;
+                continue;
+            }
+        }
+
+        JSON CaseJson = JSON::Make(JSON::Class::Object);
+        if (RunCase(Case, Options, RenderFrame, CaseJson))
+        {
+            CasesJson[Case.Name] = CaseJson;
+        }
+        else
+        {
+            bAllSucceeded = false;
+        }
+
+        if (Case.NumSyntheticActors > 0)
+        {
+            fs::remove(Case.Path, Error);
+        }
+    }
+
+    JSON Root = JSON::Make(JSON::Class::Object);
+    Root["Version"] = 1;
+    Root["Driver"] = FString(DriverName ? DriverName : "");
+    Root["Iterations"] = Options.NumIterations;
+    Root["LoadIterations"] = Options.NumLoadIterations;
+    Root["Cases"] = CasesJson;
+
+    if (!Options.OutPath.empty())
+    {
+        const fs::path OutPath(UTF8ToWide(Options.OutPath));
+        if (OutPath.has_parent_path())
+        {
+            fs::create_directories(OutPath.parent_path(), Error);
+        }
+        if (FJsonSerializer::SaveJsonToFile(Root, OutPath.wstring()))
+        {
+            UE_LOG("[Bench] Results written: %s", Options.OutPath.c_str());
+        }
+        else
+        {
+            UE_LOG("[Bench] Failed to write %s", Options.OutPath.c_str());
+            bAllSucceeded = false;
+        }
+    }
+
+    if (!Options.BaselinePath.empty())
+    {
+        JSON Baseline;
+        if (!LoadResults(Options.BaselinePath, Baseline))
+        {
+            return 1;
+        }
+        if (Compare(Baseline, Root, Options.ThresholdPercent, Options.MinDeltaMilliseconds) > 0)
+        {
+            return 1;
+        }
+    }
+    return bAllSucceeded ? 0 : 1;
+}
+
+int32 FSceneBenchmark::CompareFiles(const FSceneBenchmarkOptions& Options)
+{
+    if (Options.BaselinePath.empty())
+    {
+        UE_LOG("[Bench] -compare requires -baseline=<path>");
+        return 1;
+    }
+
+    JSON Baseline;
+    JSON Current;
+    if (!LoadResults(Options.BaselinePath, Baseline) || !LoadResults(Options.ComparePath, Current))
+    {
+        return 1;
+    }
+    return Compare(Baseline, Current, Options.ThresholdPercent, Options.MinDeltaMilliseconds) > 0 ? 1 : 0;
+}
+
+int32 FSceneBenchmark::Compare(const JSON& Baseline, const JSON& Current, double ThresholdPercent, double MinDeltaMilliseconds)
+{
+    // 기준에 있는 케이스/항목만 비교 (새로 생긴 항목은 회귀가 아님)
+    const JSON& BaselineCases = Baseline.at("Cases");
+    const JSON& CurrentCases = Current.at("Cases");
+
+    int32 NumCompared = 0;
+    int32 NumRegressions = 0;
+    for (const auto& CaseEntry : BaselineCases.ObjectRange())
+    {
+        if (!CurrentCases.hasKey(CaseEntry.first))
+        {
+            UE_LOG("[Bench] %s: missing from current results", CaseEntry.first.c_str());
+            continue;
+        }
+
+        const JSON& BaselineMetrics = CaseEntry.second.at("Metrics");
+        const JSON& CurrentMetrics = CurrentCases.at(CaseEntry.first).at("Metrics");
+        for (const auto& MetricEntry : BaselineMetrics.ObjectRange())
+        {
+            if (!CurrentMetrics.hasKey(MetricEntry.first))
+            {
+                continue;
+            }
+
+            const double BaselineMs = MetricEntry.second.at("P50Ms").ToFloat();
+            const double CurrentMs = CurrentMetrics.at(MetricEntry.first).at("P50Ms").ToFloat();
+            const double DeltaMs = CurrentMs - BaselineMs;
+            const double DeltaPercent = BaselineMs > 0.0 ? DeltaMs / BaselineMs * 100.0 : 0.0;
+            const bool bRegressed = DeltaMs > MinDeltaMilliseconds && DeltaPercent > ThresholdPercent;
+
+            ++NumCompared;
+            if (bRegressed)
+            {
+                ++NumRegressions;
+            }
+            UE_LOG("[Bench] %-14s %-22s %9.3f -> %9.3f ms (%+6.1f%%)%s", CaseEntry.first.c_str(), MetricEntry.first.c_str(),
+                BaselineMs, CurrentMs, DeltaPercent, bRegressed ? "  REGRESSION" : "");
+        }
+    }
+
+    UE_LOG("[Bench] Compared %d metrics: %d regression(s) over %.1f%% (min delta %.3f ms)",
+        NumCompared, NumRegressions, ThresholdPercent, MinDeltaMilliseconds);
+    return NumRegressions;
+}
@@ -0,0 +1,57 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <functional>
+
+namespace json { class JSON; }
+using JSON = json::JSON;
+
+/**
+ * 씬 벤치마크 옵션 (StandAlone 빌드, 명령줄 -bench)
+ *   -scenes=<a;b;...>      측정할 .scene (기본 Data/Scenes/*.scene 전체)
+ *   -synthetic=<N,N,...>   합성 큐브 씬의 액터 수 (기본 1000,10000,100000, 0이면 생략)
+ *   -iterations=<N>        항목별 반복 횟수 (기본 30), -loads=<N> 로드/저장 반복 횟수 (기본 3)
+ *   -warmup=<N>            씬마다 측정 전에 돌리는 프레임 (기본 10)
+ *   -out=<path>            결과 JSON (기본 Saved/Bench/Results.json)
+ *   -baseline=<path>       측정 후 기준 결과와 비교, 회귀가 있으면 종료 코드 1
+ *   -threshold=<percent>   회귀 판정 비율 (기본 10), -mindelta=<ms> 이보다 작은 차이는 무시 (기본 0.05)
+ *   -compare=<path>        측정 없이 결과 파일을 -baseline과 비교만 한다 (디바이스를 만들지 않음)
+ */
+struct FSceneBenchmarkOptions
+{
+    bool bEnabled = false;
+    TArray<FString> ScenePaths;
+    TArray<int32> SyntheticActorCounts = { 1000, 10000, 100000 };
+    int32 NumIterations = 30;
+    int32 NumLoadIterations = 3;
+    int32 NumWarmupFrames = 10;
+    float DeltaSeconds = 1.0f / 60.0f;
+    FString OutPath = "Saved/Bench/Results.json";
+    FString BaselinePath;
+    FString ComparePath;
+    double ThresholdPercent = 10.0;
+    double MinDeltaMilliseconds = 0.05;
+
+    static FSceneBenchmarkOptions Parse(const char* CommandLine);
+
+    bool IsCompareOnly() const { return !ComparePath.empty(); }
+};
+
+/**
+ * 씬 단위 CPU 벤치마크 (헤드리스 디바이스 위에서 GWorld에 씬을 차례로 로드해 측정)
+ * - 로드/저장, 월드 Tick, 파티션 갱신, BVH 절두체/레이/오버랩 쿼리, CPU 스키닝,
+ *   렌더 프레임 안의 GatherVisibleProxies/SortMeshBatches 시간을 항목별로 반복 측정
+ * - 항목마다 평균/최소/중앙값/p95/최대를 JSON으로 기록하고, 기준 결과와는 중앙값으로 비교한다
+ */
+class FSceneBenchmark
+{
+public:
+    // RenderFrame은 엔진 렌더 1프레임 (Renderer->EndFrame에서 FProfiler::EndFrame까지 호출되어야 함)
+    // 반환값은 프로세스 종료 코드 (0 성공, 1 회귀 또는 실패)
+    static int32 Run(const FSceneBenchmarkOptions& Options, const char* DriverName, const std::function<void()>& RenderFrame);
+
+    // -compare 모드: 두 결과 파일만 비교
+    static int32 CompareFiles(const FSceneBenchmarkOptions& Options);
+
+    // 케이스/항목별 중앙값 비교 결과를 로그로 출력. 회귀 항목 수를 반환
+    static int32 Compare(const JSON& Baseline, const JSON& Current, double ThresholdPercent, double MinDeltaMilliseconds);
+};
@@ -25,6 +25,7 @@
 #include "Level.h"
 #include "LightManager.h"
 #include "LuaManager.h"
+#include "ProjectileManager.h"
 #include "ShapeComponent.h"
 #include "PlayerCameraManager.h"
 #include "Hash.h"
@@ -38,6 +39,7 @@ UWorld::UWorld() : Partition(new UWorldPartitionManager())
 	Level = std::make_unique<ULevel>();
 	LightManager = std::make_unique<FLightManager>();
 	LuaManager = std::make_unique<FLuaManager>();
+	ProjectileManager = std::make_unique<FProjectileManager>();
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -131,12 +133,7 @@ bool UWorld::TryLoadLastUsedLevel()
 	GWorld->GetSelectionManager()->ClearSelection();
 
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, LastUsedLevelPath))
-	{
-		NewLevel->Serialize(true, LevelJsonData);
-	}
-	else
+	if (!ULevelService::LoadLevelFromFile(*NewLevel, LastUsedLevelPath))
 	{
 		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", LastUsedLevelPath.c_str());
 		return false;
@@ -151,13 +148,7 @@ bool UWorld::TryLoadLastUsedLevel()
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
-
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
-	{
-		NewLevel->Serialize(true, LevelJsonData);
-	}
-	else
+	if (!ULevelService::LoadLevelFromFile(*NewLevel, Path))
 	{
 		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", Path.c_str());
 		return false;
@@ -172,6 +163,8 @@ bool UWorld::LoadLevelFromFile(const FWideString& Path)
 // 함수 내부 코드 순서 유지 필요
 void UWorld::Tick(float DeltaSeconds)
 {	
+	PROFILE_SCOPE("WorldTick");
+
 	// GameDelat: Unscaled * finalScale  
 	float UnscaledDeltaSeconds = DeltaSeconds;
 
@@ -260,12 +253,34 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
+	// 데이터 지향 발사체: 액터 이동이 끝난 뒤의 BVH를 기준으로 적분/스윕
+	if (ProjectileManager && bPie)
+	{
+		ProjectileManager->Tick(GetDeltaTime(EDeltaTime::Game), Partition->GetBVH());
+	}
+
 	// Lua 코루틴 전용 Tick
 	if (LuaManager && bPie)
 	{
+		// 이번 프레임 발사체 충돌/만료 이벤트를 그룹 핸들러로 전달
+		if (ProjectileManager)
+		{
+			LuaManager->DispatchProjectileEvents(ProjectileManager->GetEvents());
+		}
+
+		// Batched 모드에서 액터 Tick 중 기록된 스크립트 Tick을 한 번에 실행
+		LuaManager->DispatchBatchedTick();
+
 		LuaManager->Tick(GetDeltaTime(EDeltaTime::Game));
 	}
 
+	// 모든 스크립트 Tick이 끝난 고정 지점에서 예산 안의 GC 진행
+	// 에디터 월드도 bTickInEditor 액터의 스크립트가 돌므로 PIE 여부와 관계없이 수집 (통계는 현재 월드 것만 표시)
+	if (LuaManager)
+	{
+		LuaManager->StepGarbageCollection(GWorld == this);
+	}
+
 	// 지연 삭제 처리
 	ProcessPendingKillActors();
 }
@@ -450,6 +465,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     }
     // Clear spatial indices
     Partition->Clear();
+    if (ProjectileManager) ProjectileManager->Clear();
 
     Level = std::move(InLevel);
 
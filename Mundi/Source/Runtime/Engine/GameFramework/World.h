@@ -12,6 +12,7 @@ class UUIManager;
 class UInputManager;
 class USelectionManager;
 class FLuaManager;
+class FProjectileManager;
 class AActor;
 class URenderer;
 class ACameraActor;
@@ -89,6 +90,7 @@ public:
     ULevel* GetLevel() const { return Level.get(); }
     FLightManager* GetLightManager() const { return LightManager.get(); }
     FLuaManager* GetLuaManager() const { return LuaManager.get(); }
+    FProjectileManager* GetProjectileManager() const { return ProjectileManager.get(); }
 
     ACameraActor* GetEditorCameraActor() { return MainEditorCameraActor; }
     void SetEditorCameraActor(ACameraActor* InCamera);
@@ -150,6 +152,9 @@ private:
 
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
+
+    /** === 발사체 매니저 ===*/
+    std::unique_ptr<FProjectileManager> ProjectileManager;
     
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
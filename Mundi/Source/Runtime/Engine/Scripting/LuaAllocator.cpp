@@ -0,0 +1,220 @@
+#include "pch.h"
+#include "LuaAllocator.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    // 작은 Lua 객체(문자열, 테이블 헤더, 클로저, upvalue)가 몰리는 구간은 촘촘하게
+    constexpr uint32 GLuaSizeClasses[FLuaAllocator::NumSizeClasses] =
+    {
+        16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512
+    };
+}
+
+FLuaAllocator::FLuaAllocator()
+{
+    for (uint32 i = 0; i < NumSizeClasses; ++i)
+    {
+        Pools[i].BlockSize = GLuaSizeClasses[i];
+    }
+
+    // (Size + 7) / 8 -> 크기 클래스 룩업 테이블
+    uint32 ClassIndex = 0;
+    for (uint32 Slot = 0; Slot <= (MaxPooledSize >> 3); ++Slot)
+    {
+        const uint32 Size = Slot << 3;
+        while (GLuaSizeClasses[ClassIndex] < Size)
+        {
+            ++ClassIndex;
+        }
+        SizeToClass[Slot] = static_cast<uint8>(ClassIndex);
+    }
+}
+
+FLuaAllocator::~FLuaAllocator()
+{
+    // lua_close 이후에 호출되어야 함 (FLuaManager가 state를 먼저 삭제)
+    for (void* Page : Pages)
+    {
+        std::free(Page);
+    }
+    Pages.Empty();
+}
+
+void* FLuaAllocator::LuaAlloc(void* UserData, void* Ptr, size_t OldSize, size_t NewSize)
+{
+    FLuaAllocator* Self = static_cast<FLuaAllocator*>(UserData);
+
+    if (NewSize == 0)
+    {
+        if (Ptr)
+        {
+            Self->Free(Ptr, OldSize);
+        }
+        return nullptr;
+    }
+
+    // Ptr == nullptr 이면 OldSize는 크기가 아니라 Lua 객체 타입 태그
+    if (!Ptr)
+    {
+        return Self->Allocate(NewSize);
+    }
+
+    return Self->Reallocate(Ptr, OldSize, NewSize);
+}
+
+void* FLuaAllocator::Allocate(SIZE_T Size)
+{
+    if (MemoryLimitBytes > 0 && UsedBytes + Size > MemoryLimitBytes)
+    {
+        return nullptr;
+    }
+    return AllocateBlock(Size, ActiveCounter);
+}
+
+void* FLuaAllocator::AllocateBlock(SIZE_T Size, FLuaMemoryCounter* Owner)
+{
+    void* Block = nullptr;
+    if (IsPooled(Size))
+    {
+        FSizeClassPool& Pool = Pools[GetSizeClass(Size)];
+        if (!Pool.FreeList && !RefillPool(Pool))
+        {
+            return nullptr;
+        }
+
+        FFreeBlock* FreeBlock = Pool.FreeList;
+        Pool.FreeList = FreeBlock->Next;
+        Block = FreeBlock;
+    }
+    else
+    {
+        Block = std::malloc(Size + HeaderSize);
+        if (!Block)
+        {
+            return nullptr;
+        }
+        LargeBytes += Size;
+    }
+
+    FBlockHeader* Header = static_cast<FBlockHeader*>(Block);
+    Header->Owner = Owner;
+    OnAllocated(Owner, Size);
+    return Header + 1;
+}
+
+void FLuaAllocator::Free(void* Ptr, SIZE_T Size)
+{
+    // 해제는 스코프 밖(GC 단계 등)에서도 일어나므로 현재 카운터가 아니라 할당한 카운터에 돌려준다
+    FBlockHeader* Header = GetHeader(Ptr);
+    OnFreed(Header->Owner, Size);
+
+    if (IsPooled(Size))
+    {
+        FSizeClassPool& Pool = Pools[GetSizeClass(Size)];
+        FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Header);
+        Block->Next = Pool.FreeList;
+        Pool.FreeList = Block;
+    }
+    else
+    {
+        std::free(Header);
+        LargeBytes -= Size;
+    }
+}
+
+void* FLuaAllocator::Reallocate(void* Ptr, SIZE_T OldSize, SIZE_T NewSize)
+{
+    const bool bOldPooled = IsPooled(OldSize);
+    const bool bNewPooled = IsPooled(NewSize);
+
+    // 재할당은 같은 객체가 커지거나 줄어드는 것이므로 처음 할당한 소유자를 유지한다
+    FLuaMemoryCounter* Owner = GetHeader(Ptr)->Owner;
+
+    // 같은 크기 클래스 안에서의 변경은 블록을 그대로 재사용
+    if (bOldPooled && bNewPooled && GetSizeClass(OldSize) == GetSizeClass(NewSize))
+    {
+        OnFreed(Owner, OldSize);
+        OnAllocated(Owner, NewSize);
+        return Ptr;
+    }
+
+    // Lua는 축소 요청이 실패하지 않는다고 가정하므로 한도 검사는 확장 시에만
+    if (NewSize > OldSize && MemoryLimitBytes > 0 && UsedBytes + (NewSize - OldSize) > MemoryLimitBytes)
+    {
+        return nullptr;
+    }
+
+    if (!bOldPooled && !bNewPooled)
+    {
+        FBlockHeader* Header = static_cast<FBlockHeader*>(std::realloc(GetHeader(Ptr), NewSize + HeaderSize));
+        if (!Header)
+        {
+            return nullptr;
+        }
+        LargeBytes = LargeBytes - OldSize + NewSize;
+        OnFreed(Owner, OldSize);
+        OnAllocated(Owner, NewSize);
+        return Header + 1;
+    }
+
+    // 크기 클래스가 바뀌거나 풀 <-> 큰 블록 사이를 오가는 경우: 새로 할당 후 복사
+    void* Result = AllocateBlock(NewSize, Owner);
+    if (!Result)
+    {
+        return nullptr;
+    }
+
+    std::memcpy(Result, Ptr, OldSize < NewSize ? OldSize : NewSize);
+    Free(Ptr, OldSize);
+    return Result;
+}
+
+bool FLuaAllocator::RefillPool(FSizeClassPool& Pool)
+{
+    void* Page = std::malloc(PageSize);
+    if (!Page)
+    {
+        return false;
+    }
+    Pages.Add(Page);
+
+    // 페이지를 블록 단위로 잘라 free list에 연결
+    const uint32 BlockCount = static_cast<uint32>(PageSize / Pool.BlockSize);
+    uint8* Base = static_cast<uint8*>(Page);
+    for (uint32 i = 0; i < BlockCount; ++i)
+    {
+        FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Base + static_cast<SIZE_T>(i) * Pool.BlockSize);
+        Block->Next = Pool.FreeList;
+        Pool.FreeList = Block;
+    }
+    return true;
+}
+
+void FLuaAllocator::OnAllocated(FLuaMemoryCounter* Owner, SIZE_T Size)
+{
+    UsedBytes += Size;
+    TotalAllocatedBytes += Size;
+    ++AllocCount;
+    if (UsedBytes > PeakBytes)
+    {
+        PeakBytes = UsedBytes;
+    }
+
+    if (Owner)
+    {
+        Owner->AllocatedBytes += static_cast<int64>(Size);
+        ++Owner->AllocCount;
+    }
+}
+
+void FLuaAllocator::OnFreed(FLuaMemoryCounter* Owner, SIZE_T Size)
+{
+    UsedBytes -= Size;
+
+    if (Owner)
+    {
+        Owner->FreedBytes += static_cast<int64>(Size);
+    }
+}
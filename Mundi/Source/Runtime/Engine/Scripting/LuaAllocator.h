@@ -0,0 +1,128 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 스크립트(또는 임의의 실행 구간)에 귀속되는 메모리 카운터
+// 블록마다 할당한 카운터를 기록해 두고 해제(GC 포함)는 언제 일어나든 그 카운터로 돌려주므로 Live = Allocated - Freed가 정확하다
+// 카운터는 할당기보다 오래 살아야 한다 (lua_close의 해제까지 반영)
+struct FLuaMemoryCounter
+{
+    int64 AllocatedBytes = 0;
+    int64 FreedBytes = 0;
+    uint64 AllocCount = 0;
+
+    int64 GetLiveBytes() const { return AllocatedBytes - FreedBytes; }
+};
+
+/**
+ * Lua VM 전용 lua_Alloc 구현
+ * - 헤더 포함 512B 이하 블록은 크기 클래스별 free list(64KB 페이지 단위)에서 할당
+ * - 그보다 큰 블록은 malloc/realloc으로 fallback
+ * - Lua는 해제/재할당 시 블록 크기(osize)를 넘겨주므로 크기는 기록하지 않고,
+ *   블록 앞 8바이트 헤더에 할당 시점의 카운터(소유자)만 기록한다 (Lua 최대 정렬 8바이트 유지)
+ * - UsedBytes와 카운터는 Lua가 요청한 크기 기준 (헤더는 풀 예약량에만 드러남)
+ * - lua_State와 마찬가지로 단일 스레드 전용
+ */
+class FLuaAllocator
+{
+public:
+    static constexpr uint32 NumSizeClasses = 16;
+    static constexpr SIZE_T MaxPooledSize = 512;
+    static constexpr SIZE_T PageSize = 64 * 1024;
+
+    FLuaAllocator();
+    ~FLuaAllocator();
+
+    FLuaAllocator(const FLuaAllocator&) = delete;
+    FLuaAllocator& operator=(const FLuaAllocator&) = delete;
+
+    // lua_newstate / sol::state 에 넘기는 콜백 (UserData == this)
+    static void* LuaAlloc(void* UserData, void* Ptr, size_t OldSize, size_t NewSize);
+
+    // 0이면 제한 없음. 초과 시 nullptr 반환 -> Lua가 emergency GC 후 메모리 에러를 발생시킴
+    void SetMemoryLimit(SIZE_T InLimitBytes) { MemoryLimitBytes = InLimitBytes; }
+    SIZE_T GetMemoryLimit() const { return MemoryLimitBytes; }
+
+    SIZE_T GetUsedBytes() const { return UsedBytes; }
+    SIZE_T GetPeakBytes() const { return PeakBytes; }
+    SIZE_T GetLargeBytes() const { return LargeBytes; }
+    SIZE_T GetPoolReservedBytes() const { return static_cast<SIZE_T>(Pages.Num()) * PageSize; }
+    uint64 GetTotalAllocatedBytes() const { return TotalAllocatedBytes; }
+    uint64 GetAllocCount() const { return AllocCount; }
+
+    // 현재 과금 대상 카운터 (nullptr이면 귀속 없음 = shared). 이후 할당되는 블록의 소유자가 된다
+    FLuaMemoryCounter* GetActiveCounter() const { return ActiveCounter; }
+    void SetActiveCounter(FLuaMemoryCounter* InCounter) { ActiveCounter = InCounter; }
+
+private:
+    struct FFreeBlock
+    {
+        FFreeBlock* Next;
+    };
+
+    // 블록 앞에 붙는 헤더 (Lua에는 헤더 뒤 주소를 넘긴다)
+    struct FBlockHeader
+    {
+        FLuaMemoryCounter* Owner;
+    };
+    static constexpr SIZE_T HeaderSize = sizeof(FBlockHeader);
+    static_assert(HeaderSize == 8, "Lua 최대 정렬(8바이트)을 유지하도록 헤더는 8바이트");
+
+    static FBlockHeader* GetHeader(void* Ptr) { return static_cast<FBlockHeader*>(Ptr) - 1; }
+    static bool IsPooled(SIZE_T Size) { return Size + HeaderSize <= MaxPooledSize; }
+
+    struct FSizeClassPool
+    {
+        FFreeBlock* FreeList = nullptr;
+        uint32 BlockSize = 0;
+    };
+
+    void* Allocate(SIZE_T Size);
+    void* AllocateBlock(SIZE_T Size, FLuaMemoryCounter* Owner);    // 한도 검사 없이 블록 확보
+    void Free(void* Ptr, SIZE_T Size);
+    void* Reallocate(void* Ptr, SIZE_T OldSize, SIZE_T NewSize);
+
+    // 헤더 포함 크기(1~MaxPooledSize)가 들어갈 크기 클래스 인덱스
+    int32 GetSizeClass(SIZE_T Size) const { return SizeToClass[(Size + HeaderSize + 7) >> 3]; }
+    bool RefillPool(FSizeClassPool& Pool);
+
+    void OnAllocated(FLuaMemoryCounter* Owner, SIZE_T Size);
+    void OnFreed(FLuaMemoryCounter* Owner, SIZE_T Size);
+
+private:
+    FSizeClassPool Pools[NumSizeClasses];
+    uint8 SizeToClass[(MaxPooledSize >> 3) + 1];
+    TArray<void*> Pages;                        // 페이지는 Allocator 소멸 시 일괄 반환
+
+    SIZE_T MemoryLimitBytes = 0;
+    SIZE_T UsedBytes = 0;
+    SIZE_T PeakBytes = 0;
+    SIZE_T LargeBytes = 0;
+    uint64 TotalAllocatedBytes = 0;             // 단조 증가, GC 페이싱에 사용
+    uint64 AllocCount = 0;
+
+    FLuaMemoryCounter* ActiveCounter = nullptr;
+};
+
+// 스코프 동안 발생한 Lua 할당을 Counter에 귀속시킴 (중첩 가능)
+class FLuaMemoryScope
+{
+public:
+    FLuaMemoryScope(FLuaAllocator& InAllocator, FLuaMemoryCounter* InCounter)
+        : Allocator(InAllocator)
+        , PrevCounter(InAllocator.GetActiveCounter())
+    {
+        Allocator.SetActiveCounter(InCounter);
+    }
+
+    ~FLuaMemoryScope()
+    {
+        Allocator.SetActiveCounter(PrevCounter);
+    }
+
+    FLuaMemoryScope(const FLuaMemoryScope&) = delete;
+    FLuaMemoryScope& operator=(const FLuaMemoryScope&) = delete;
+
+private:
+    FLuaAllocator& Allocator;
+    FLuaMemoryCounter* PrevCounter;
+};
@@ -6,6 +6,10 @@
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "PlayerCameraManager.h"
+#include "PlatformTime.h"
+#include "LuaStats.h"
+#include "LuaScriptComponent.h"
+#include "ProjectileManager.h"
 #include <tuple>
 
 sol::object MakeCompProxy(sol::state_view SolState, void* Instance, UClass* Class) {
@@ -25,7 +29,9 @@ sol::object MakeCompProxy(sol::state_view SolState, void* Instance, UClass* Clas
 
 FLuaManager::FLuaManager()
 {
-    Lua = new sol::state();
+    // size-class 풀 기반 Allocator로 VM 생성
+    Lua = new sol::state(sol::default_at_panic, &FLuaAllocator::LuaAlloc, &Allocator);
+    ApplyGCMode();
     
     
     // Open essential standard libraries for gameplay scripts
@@ -303,6 +309,77 @@ FLuaManager::FLuaManager()
             }
         });
     
+    // 데이터 지향 발사체: 개별 발사체는 액터가 아니며 스크립트는 그룹 핸들러로 충돌/만료 이벤트만 받는다
+    SharedLib.set_function("CreateProjectileGroup",
+        [this](sol::table Desc) -> int32
+        {
+            FProjectileManager* Projectiles = GWorld ? GWorld->GetProjectileManager() : nullptr;
+            if (!Projectiles)
+            {
+                return -1;
+            }
+
+            FProjectileGroupDesc GroupDesc;
+            GroupDesc.Radius = Desc.get_or("Radius", GroupDesc.Radius);
+            GroupDesc.GravityZ = Desc.get_or("Gravity", GroupDesc.GravityZ);
+            GroupDesc.Lifespan = Desc.get_or("Lifespan", GroupDesc.Lifespan);
+            GroupDesc.Bounciness = Desc.get_or("Bounciness", GroupDesc.Bounciness);
+            GroupDesc.bCollide = Desc.get_or("Collide", GroupDesc.bCollide);
+            GroupDesc.MeshPath = Desc.get_or<FString>("Mesh", GroupDesc.MeshPath);
+            if (sol::optional<FLinearColor> Color = Desc.get<sol::optional<FLinearColor>>("Color"))
+            {
+                GroupDesc.Color = *Color;
+            }
+
+            const int32 Group = Projectiles->CreateGroup(GroupDesc);
+
+            FProjectileLuaHandlers Handlers;
+            if (sol::optional<sol::protected_function> OnHit = Desc.get<sol::optional<sol::protected_function>>("OnHit"))
+            {
+                Handlers.OnHit = *OnHit;
+            }
+            if (sol::optional<sol::protected_function> OnExpire = Desc.get<sol::optional<sol::protected_function>>("OnExpire"))
+            {
+                Handlers.OnExpire = *OnExpire;
+            }
+            ProjectileHandlers.Add(Group, Handlers);
+            return Group;
+        }
+    );
+    SharedLib.set_function("SpawnProjectile",
+        [](int32 Group, const FVector& Location, const FVector& Velocity, sol::optional<FGameObject*> Instigator) -> uint32
+        {
+            FProjectileManager* Projectiles = GWorld ? GWorld->GetProjectileManager() : nullptr;
+            if (!Projectiles)
+            {
+                return 0;
+            }
+            const AActor* InstigatorActor = (Instigator && *Instigator) ? (*Instigator)->GetOwner() : nullptr;
+            return Projectiles->Spawn(Group, Location, Velocity, InstigatorActor);
+        }
+    );
+    SharedLib.set_function("DestroyProjectile",
+        [](uint32 Handle) -> bool
+        {
+            FProjectileManager* Projectiles = GWorld ? GWorld->GetProjectileManager() : nullptr;
+            return Projectiles && Projectiles->Destroy(Handle);
+        }
+    );
+    SharedLib.set_function("IsProjectileAlive",
+        [](uint32 Handle) -> bool
+        {
+            FProjectileManager* Projectiles = GWorld ? GWorld->GetProjectileManager() : nullptr;
+            return Projectiles && Projectiles->IsAlive(Handle);
+        }
+    );
+    SharedLib.set_function("GetProjectileCount",
+        []() -> int32
+        {
+            FProjectileManager* Projectiles = GWorld ? GWorld->GetProjectileManager() : nullptr;
+            return Projectiles ? Projectiles->Num() : 0;
+        }
+    );
+
     // FVector usertype 등록 (메서드와 프로퍼티)
     SharedLib.new_usertype<FVector>("FVector",
         sol::no_constructor,  // 생성자는 위에서 Vector 함수로 등록했음
@@ -346,6 +423,7 @@ FLuaManager::FLuaManager()
     RegisterComponentProxy(*Lua);
     ExposeGlobalFunctions();
     ExposeAllPropertiesToLua();
+    InitBatchedTick();
 
     // 위 등록 마친 뒤 fall back 설정 : Shared lib의 fall back은 G
     sol::table MetaTableShared = Lua->create_table();
@@ -598,12 +676,480 @@ void FLuaManager::Tick(double DeltaSeconds)
     CoroutineSchedular.Tick(DeltaSeconds);
 }
 
+void FLuaManager::SetGCSettings(const FLuaGCSettings& InSettings)
+{
+    GCSettings = InSettings;
+    ApplyGCMode();
+}
+
+void FLuaManager::ApplyGCMode()
+{
+    if (!Lua)
+    {
+        return;
+    }
+
+    lua_State* L = Lua->lua_state();
+    if (GCSettings.Mode == ELuaGCMode::Generational)
+    {
+        lua_gc(L, LUA_GCGEN, 0, 0);
+    }
+    else
+    {
+        // 기본 step 1회의 작업량 = 2^StepSizeLog2 바이트 (pause/stepmul은 기본값 유지)
+        const int64 StepSizeBytes = static_cast<int64>(std::max(GCSettings.StepSizeKB, 1)) * 1024;
+        int32 StepSizeLog2 = 10;
+        while (StepSizeLog2 < 30 && (int64(1) << (StepSizeLog2 + 1)) <= StepSizeBytes)
+        {
+            ++StepSizeLog2;
+        }
+        lua_gc(L, LUA_GCINC, 0, 0, StepSizeLog2);
+    }
+
+    // 프레임 중간 GC 스파이크 방지: 자동 수집은 끄고 StepGarbageCollection()에서만 진행
+    // (LUA_GCSTEP은 정지 상태에서도 동작한다. 정지 중에 쌓인 부채는 StepGarbageCollection이 기본 step으로 무시한다)
+    lua_gc(L, LUA_GCSTOP);
+    Allocator.SetMemoryLimit(GCSettings.HardLimitBytes);
+}
+
+void FLuaManager::StepGarbageCollection(bool bUpdateStats)
+{
+    if (!Lua)
+    {
+        return;
+    }
+
+    lua_State* L = Lua->lua_state();
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    const uint64 TotalAllocated = Allocator.GetTotalAllocatedBytes();
+    const uint64 FrameAllocated = TotalAllocated - LastTotalAllocatedBytes;
+    LastTotalAllocatedBytes = TotalAllocated;
+
+    uint32 Steps = 0;
+    if (GCSettings.SoftLimitBytes > 0 && Allocator.GetUsedBytes() > GCSettings.SoftLimitBytes)
+    {
+        // 상한을 넘으면 프레임 예산보다 footprint 제한을 우선
+        lua_gc(L, LUA_GCCOLLECT);
+        ++GCCyclesCompleted;
+        ++Steps;
+    }
+    else if (GCSettings.Mode == ELuaGCMode::Generational)
+    {
+        // 세대별 모드의 step은 minor collection 1회
+        if (FrameAllocated > 0)
+        {
+            if (lua_gc(L, LUA_GCSTEP, 0))
+            {
+                ++GCCyclesCompleted;
+            }
+            ++Steps;
+        }
+    }
+    else
+    {
+        // 이번 프레임에 할당한 양의 2배까지 수집을 진행하되, 시간 예산을 넘기지 않음
+        // LUA_GCSTEP에 크기를 넘기면 GCSTOP 동안 쌓인 부채까지 한 번에 갚으므로(첫 step이 예산을 무시),
+        // 인자 0의 기본 step(부채를 0으로 두고 StepSizeKB만큼만 진행)을 반복해 step 사이마다 예산을 확인한다
+        const int64 TargetKB = std::max<int64>(GCSettings.StepSizeKB, static_cast<int64>(FrameAllocated / 1024) * 2);
+        int64 DoneKB = 0;
+        while (DoneKB < TargetKB)
+        {
+            const bool bCycleFinished = lua_gc(L, LUA_GCSTEP, 0) != 0;
+            DoneKB += GCSettings.StepSizeKB;
+            ++Steps;
+
+            if (bCycleFinished)
+            {
+                ++GCCyclesCompleted;
+                break;
+            }
+            if (FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) >= GCSettings.FrameBudgetMS)
+            {
+                break;
+            }
+        }
+    }
+
+    if (!bUpdateStats)
+    {
+        return;
+    }
+
+    FLuaStats Stats;
+    Stats.UsedBytes = Allocator.GetUsedBytes();
+    Stats.PeakBytes = Allocator.GetPeakBytes();
+    Stats.PoolReservedBytes = Allocator.GetPoolReservedBytes();
+    Stats.LargeBytes = Allocator.GetLargeBytes();
+    Stats.LimitBytes = Allocator.GetMemoryLimit();
+    Stats.FrameAllocatedBytes = FrameAllocated;
+    Stats.GCStepsThisFrame = Steps;
+    Stats.GCCyclesCompleted = GCCyclesCompleted;
+    Stats.GCTimeMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    Stats.bGenerational = GCSettings.Mode == ELuaGCMode::Generational;
+    FLuaStatManager::GetInstance().UpdateStats(Stats);
+}
+
+void FLuaManager::CollectGarbage()
+{
+    if (Lua)
+    {
+        lua_gc(Lua->lua_state(), LUA_GCCOLLECT);
+        ++GCCyclesCompleted;
+    }
+}
+
+void FLuaManager::InitBatchedTick()
+{
+    BatchTickFuncs = Lua->create_table();
+    BatchDeltaTimes = Lua->create_table();
+
+    // pcall로 스크립트별 에러를 격리하고, 실패한 슬롯 인덱스와 메시지를 모아 한 번에 반환
+    sol::protected_function_result Result = Lua->safe_script(R"(
+        local pcall, tostring = pcall, tostring
+        return function(Funcs, DeltaTimes, Count)
+            local Errors = nil
+            for i = 1, Count do
+                local dt = DeltaTimes[i]
+                local Func = Funcs[i]
+                -- 디스패치 중 해제된 슬롯은 Func가 false로 남아 있다 (압축은 디스패치가 끝난 뒤)
+                if dt and Func then
+                    DeltaTimes[i] = nil
+                    local bOk, Err = pcall(Func, dt)
+                    if not bOk then
+                        Errors = Errors or {}
+                        Errors[#Errors + 1] = i
+                        Errors[#Errors + 1] = tostring(Err)
+                    end
+                end
+            end
+            return Errors
+        end
+    )", sol::script_pass_on_error);
+
+    if (!Result.valid())
+    {
+        sol::error Err = Result;
+        UE_LOG("[Lua][error] Batched tick dispatcher: %s", Err.what());
+        return;
+    }
+    BatchDispatcher = Result.get<sol::protected_function>();
+}
+
+int32 FLuaManager::RegisterBatchedTick(ULuaScriptComponent* Component, const sol::protected_function& TickFunc)
+{
+    if (!Component || !TickFunc.valid() || !BatchDispatcher.valid())
+    {
+        return -1;
+    }
+
+    const int32 Index = BatchedTickComponents.Add(Component);
+    BatchTickFuncs.raw_set(Index + 1, TickFunc);
+    return Index;
+}
+
+void FLuaManager::UnregisterBatchedTick(int32 Index)
+{
+    if (Index < 0 || Index >= BatchedTickComponents.Num() || !BatchTickFuncs.valid() || !BatchedTickComponents[Index])
+    {
+        return;
+    }
+
+    // 디스패치 중(스크립트 Tick 안에서 액터 파괴 등)에는 슬롯을 옮기면 아직 돌지 않은 스크립트를 건너뛰거나
+    // 에러가 다른 컴포넌트로 귀속되므로, 죽은 슬롯으로 표시만 하고 디스패치가 끝난 뒤 압축한다
+    if (bDispatchingBatchedTick)
+    {
+        BatchedTickComponents[Index] = nullptr;
+        BatchTickFuncs.raw_set(Index + 1, false);
+        BatchDeltaTimes.raw_set(Index + 1, sol::lua_nil);
+        bHasDeadBatchedTicks = true;
+        return;
+    }
+
+    RemoveBatchedTickSlot(Index);
+}
+
+void FLuaManager::RemoveBatchedTickSlot(int32 Index)
+{
+    // 마지막 슬롯을 빈 자리로 옮겨 배열을 촘촘하게 유지
+    const int32 LastIndex = BatchedTickComponents.Num() - 1;
+    if (Index != LastIndex)
+    {
+        ULuaScriptComponent* Moved = BatchedTickComponents[LastIndex];
+        BatchedTickComponents[Index] = Moved;
+        BatchTickFuncs.raw_set(Index + 1, BatchTickFuncs.raw_get<sol::object>(LastIndex + 1));
+        BatchDeltaTimes.raw_set(Index + 1, BatchDeltaTimes.raw_get<sol::object>(LastIndex + 1));
+        if (Moved)
+        {
+            Moved->SetBatchedTickIndex(Index);
+        }
+    }
+
+    BatchTickFuncs.raw_set(LastIndex + 1, sol::lua_nil);
+    BatchDeltaTimes.raw_set(LastIndex + 1, sol::lua_nil);
+    BatchedTickComponents.pop_back();
+}
+
+void FLuaManager::QueueBatchedTick(int32 Index, float DeltaTime)
+{
+    BatchDeltaTimes.raw_set(Index + 1, DeltaTime);
+    ++NumQueuedBatchedTicks;
+}
+
+void FLuaManager::DispatchBatchedTick()
+{
+    if (NumQueuedBatchedTicks == 0 || !BatchDispatcher.valid())
+    {
+        return;
+    }
+    NumQueuedBatchedTicks = 0;
+
+    // 일괄 호출 중 할당은 스크립트별로 나눌 수 없으므로 별도 카운터에 귀속
+    FLuaMemoryScope MemoryScope(Allocator, &BatchedTickMemory);
+
+    bDispatchingBatchedTick = true;
+    sol::protected_function_result Result = BatchDispatcher(BatchTickFuncs, BatchDeltaTimes, BatchedTickComponents.Num());
+    bDispatchingBatchedTick = false;
+
+    if (!Result.valid())
+    {
+        sol::error Err = Result;
+        UE_LOG("[Lua][error] Batched tick dispatch failed: %s\n", Err.what());
+    }
+    else if (sol::optional<sol::table> Errors = Result.get<sol::optional<sol::table>>())
+    {
+        // 에러는 슬롯 인덱스로 돌아오므로 해당 컴포넌트의 스크립트로 귀속 (슬롯은 압축 전이라 디스패치 시점과 같다)
+        const int32 NumEntries = static_cast<int32>(Errors->size());
+        for (int32 i = 1; i + 1 <= NumEntries; i += 2)
+        {
+            const int32 Slot = Errors->get<int32>(i) - 1;
+            const FString Message = Errors->get<FString>(i + 1);
+            const ULuaScriptComponent* Component = (Slot >= 0 && Slot < BatchedTickComponents.Num()) ? BatchedTickComponents[Slot] : nullptr;
+            // Tick 도중 자기 자신을 파괴한 스크립트는 슬롯이 비어 있다
+            const char* ScriptPath = Component ? Component->GetScriptFilePath().c_str() : "(unregistered during tick)";
+            UE_LOG("[Lua][error] %s: %s\n", ScriptPath, Message.c_str());
+        }
+    }
+
+    // 디스패치 중 해제된 슬롯 정리 (뒤에서부터 지우면 옮겨 오는 마지막 슬롯은 항상 살아 있다)
+    if (bHasDeadBatchedTicks)
+    {
+        bHasDeadBatchedTicks = false;
+        for (int32 Index = BatchedTickComponents.Num() - 1; Index >= 0; --Index)
+        {
+            if (!BatchedTickComponents[Index])
+            {
+                RemoveBatchedTickSlot(Index);
+            }
+        }
+    }
+}
+
+void FLuaManager::DispatchProjectileEvents(const TArray<FProjectileEvent>& Events)
+{
+    if (Events.IsEmpty() || ProjectileHandlers.IsEmpty())
+    {
+        return;
+    }
+
+    // 핸들러 안에서 발사체를 새로 만들거나 지워도 이벤트 목록은 다음 Tick까지 유지된다
+    for (const FProjectileEvent& Event : Events)
+    {
+        FProjectileLuaHandlers* Handlers = ProjectileHandlers.Find(Event.Group);
+        if (!Handlers)
+        {
+            continue;
+        }
+
+        sol::protected_function_result Result;
+        if (Event.Type == EProjectileEvent::Hit)
+        {
+            if (!Handlers->OnHit.valid())
+            {
+                continue;
+            }
+            FGameObject* Other = (Event.HitActor && !Event.HitActor->IsPendingDestroy()) ? Event.HitActor->GetGameObject() : nullptr;
+            Result = Handlers->OnHit(Event.Handle, Other, Event.Location, Event.Normal);
+        }
+        else
+        {
+            if (!Handlers->OnExpire.valid())
+            {
+                continue;
+            }
+            Result = Handlers->OnExpire(Event.Handle, Event.Location);
+        }
+
+        if (!Result.valid())
+        {
+            sol::error Err = Result;
+            UE_LOG("[Lua][error] Projectile group %d handler: %s\n", Event.Group, Err.what());
+        }
+    }
+}
+
+void FLuaManager::RunTickDispatchBenchmark(const FString& ScriptPath, int32 MaxInstances, int32 Frames)
+{
+    if (MaxInstances <= 0 || Frames <= 0 || !BatchDispatcher.valid())
+    {
+        return;
+    }
+
+    // 실제 액터 없이 스크립트 Tick만 측정하기 위해 Obj는 Lua 테이블로 대체
+    TArray<sol::environment> Envs;
+    TArray<sol::protected_function> TickFuncs;
+    Envs.Reserve(MaxInstances);
+    TickFuncs.Reserve(MaxInstances);
+
+    sol::table FuncTable = Lua->create_table(MaxInstances, 0);
+    sol::table DeltaTable = Lua->create_table(MaxInstances, 0);
+
+    for (int32 i = 0; i < MaxInstances; ++i)
+    {
+        sol::environment Env = CreateEnvironment();
+        sol::table Obj = Lua->create_table();
+        Obj["UUID"] = i;
+        Obj["Tag"] = "";
+        Obj["bIsActive"] = true;
+        Obj["Location"] = FVector(0.0f, 0.0f, 0.0f);
+        Obj["Rotation"] = FVector(0.0f, 0.0f, 0.0f);
+        Obj["Scale"] = FVector(1.0f, 1.0f, 1.0f);
+        Obj["Velocity"] = FVector(1.0f, 0.0f, 0.0f);
+        Env["Obj"] = Obj;
+
+        if (!LoadScriptInto(Env, ScriptPath))
+        {
+            return;
+        }
+
+        sol::protected_function TickFunc = GetFunc(Env, "Tick");
+        if (!TickFunc.valid())
+        {
+            UE_LOG("[Lua][error] Benchmark: %s has no Tick function", ScriptPath.c_str());
+            return;
+        }
+
+        FuncTable.raw_set(i + 1, TickFunc);
+        Envs.Add(std::move(Env));
+        TickFuncs.Add(std::move(TickFunc));
+    }
+
+    const float DeltaTime = 1.0f / 60.0f;
+    UE_LOG("[Lua] Tick dispatch benchmark: %s, %d frames", ScriptPath.c_str(), Frames);
+
+    int32 CrossoverCount = -1;
+    for (int32 Count = 1; ; Count = std::min(Count * 10, MaxInstances))
+    {
+        uint32 ErrorCount = 0;
+
+        uint64 Start = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                auto Result = TickFuncs[i](DeltaTime);
+                if (!Result.valid())
+                {
+                    ++ErrorCount;
+                }
+            }
+        }
+        const double PerComponentMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / Frames;
+
+        Start = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                DeltaTable.raw_set(i + 1, DeltaTime);
+            }
+            BatchDispatcher(FuncTable, DeltaTable, Count);
+        }
+        const double BatchedMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / Frames;
+
+        if (CrossoverCount < 0 && BatchedMS < PerComponentMS)
+        {
+            CrossoverCount = Count;
+        }
+
+        UE_LOG("[Lua]   N=%5d : per-component %.4f ms/frame, batched %.4f ms/frame (x%.2f)%s",
+            Count, PerComponentMS, BatchedMS,
+            BatchedMS > 0.0 ? PerComponentMS / BatchedMS : 0.0,
+            ErrorCount > 0 ? " [script errors]" : "");
+
+        if (Count >= MaxInstances)
+        {
+            break;
+        }
+    }
+
+    if (CrossoverCount > 0)
+    {
+        UE_LOG("[Lua]   batched dispatch wins from N=%d", CrossoverCount);
+    }
+    else
+    {
+        UE_LOG("[Lua]   batched dispatch did not win up to N=%d", MaxInstances);
+    }
+
+    CollectGarbage();
+}
+
+FLuaMemoryCounter* FLuaManager::GetScriptMemoryCounter(const FString& ScriptPath)
+{
+    return &ScriptMemory[ScriptPath];
+}
+
+void FLuaManager::DumpMemoryReport() const
+{
+    const double ToKB = 1.0 / 1024.0;
+
+    UE_LOG("[Lua] Used: %.1f KB, Peak: %.1f KB, Pool Reserved: %.1f KB, Large: %.1f KB",
+        Allocator.GetUsedBytes() * ToKB,
+        Allocator.GetPeakBytes() * ToKB,
+        Allocator.GetPoolReservedBytes() * ToKB,
+        Allocator.GetLargeBytes() * ToKB);
+
+    int64 AttributedBytes = 0;
+    for (const auto& Pair : ScriptMemory)
+    {
+        const FLuaMemoryCounter& Counter = Pair.second;
+        AttributedBytes += Counter.GetLiveBytes();
+        UE_LOG("[Lua]   %s : live %.1f KB, allocated %.1f KB, allocs %llu",
+            Pair.first.c_str(),
+            Counter.GetLiveBytes() * ToKB,
+            Counter.AllocatedBytes * ToKB,
+            Counter.AllocCount);
+    }
+
+    if (BatchedTickMemory.AllocCount > 0)
+    {
+        AttributedBytes += BatchedTickMemory.GetLiveBytes();
+        UE_LOG("[Lua]   (batched tick) : live %.1f KB, allocated %.1f KB, allocs %llu",
+            BatchedTickMemory.GetLiveBytes() * ToKB,
+            BatchedTickMemory.AllocatedBytes * ToKB,
+            BatchedTickMemory.AllocCount);
+    }
+
+    // 엔진 바인딩, 공용 테이블, 코루틴 등 스크립트 호출 밖에서 생긴 할당
+    UE_LOG("[Lua]   (shared) : %.1f KB", (static_cast<int64>(Allocator.GetUsedBytes()) - AttributedBytes) * ToKB);
+}
+
 void FLuaManager::ShutdownBeforeLuaClose()
 {
     CoroutineSchedular.ShutdownBeforeLuaClose();
     
     FLuaBindRegistry::Get().Reset();
     
+    BatchedTickComponents.Empty();
+    BatchTickFuncs = sol::nil;
+    BatchDeltaTimes = sol::nil;
+    BatchDispatcher = sol::nil;
+    NumQueuedBatchedTicks = 0;
+    bHasDeadBatchedTicks = false;
+
+    ProjectileHandlers.Empty();
+
     SharedLib = sol::nil;
 }
 
@@ -1,10 +1,30 @@
 ﻿#pragma once
 #include "LuaCoroutineScheduler.h"
+#include "LuaAllocator.h"
 #include <sol/sol.hpp>
 
+struct FProjectileEvent;
+
 namespace sol { class state; }
 using state = sol::state;
 
+enum class ELuaGCMode : uint8
+{
+    Incremental,
+    Generational
+};
+
+// Lua GC 페이싱 설정
+// 자동 GC는 꺼두고 UWorld::Tick의 고정 지점에서 StepGarbageCollection()으로만 수집
+struct FLuaGCSettings
+{
+    ELuaGCMode Mode = ELuaGCMode::Incremental;
+    int32 StepSizeKB = 16;              // 기본 LUA_GCSTEP 1회가 처리하는 양 (incremental, 2의 거듭제곱으로 내림)
+    double FrameBudgetMS = 1.0;         // 프레임당 GC에 쓸 수 있는 최대 시간
+    SIZE_T SoftLimitBytes = 64 * 1024 * 1024;  // 초과 시 예산을 무시하고 full collect
+    SIZE_T HardLimitBytes = 0;          // 0이면 무제한, 초과 할당은 Lua 메모리 에러
+};
+
 class FLuaManager
 {
 public:
@@ -28,9 +48,73 @@ public:
     
     class FLuaCoroutineScheduler& GetScheduler() { return CoroutineSchedular; }
 
+    /* === 메모리 / GC === */
+    void SetGCSettings(const FLuaGCSettings& InSettings);
+    const FLuaGCSettings& GetGCSettings() const { return GCSettings; }
+    // 프레임당 한 번, 예산 안에서 GC 진행 (bUpdateStats면 오버레이 통계도 갱신)
+    void StepGarbageCollection(bool bUpdateStats = true);
+    void CollectGarbage();                     // 즉시 full collect
+
+    FLuaAllocator& GetAllocator() { return Allocator; }
+    // 스크립트 경로별 메모리 카운터 (TMap 노드 주소는 안정적이므로 캐시 가능)
+    FLuaMemoryCounter* GetScriptMemoryCounter(const FString& ScriptPath);
+    void DumpMemoryReport() const;             // 콘솔 출력
+
+    /* === Batched Tick (opt-in) ===
+     * 컴포넌트별 protected_function 호출 대신, 프레임에 Tick된 스크립트들을
+     * Lua 측 디스패처 한 번의 호출로 처리한다. (C++ -> Lua 경계 비용을 프레임당 1회로)
+     * 스크립트 Tick은 액터 Tick 도중이 아니라 UWorld::Tick의 DispatchBatchedTick() 시점에 실행된다.
+     */
+    void SetBatchedTickEnabled(bool bEnabled) { bBatchedTick = bEnabled; }
+    bool IsBatchedTickEnabled() const { return bBatchedTick; }
+    int32 RegisterBatchedTick(ULuaScriptComponent* Component, const sol::protected_function& TickFunc);
+    void UnregisterBatchedTick(int32 Index);
+    void QueueBatchedTick(int32 Index, float DeltaTime);
+    void DispatchBatchedTick();
+
+    /* === 발사체 이벤트 ===
+     * CreateProjectileGroup(Desc)에 넘긴 OnHit/OnExpire를 그룹별로 보관하고
+     * UWorld::Tick에서 FProjectileManager가 만든 이벤트 목록을 한 번에 전달한다.
+     */
+    void DispatchProjectileEvents(const TArray<FProjectileEvent>& Events);
+
+    // 같은 스크립트를 N개 환경에 로드해 컴포넌트별 호출 vs 일괄 호출 비용을 비교 (콘솔 LUA BENCH)
+    void RunTickDispatchBenchmark(const FString& ScriptPath, int32 MaxInstances, int32 Frames);
+
+private:
+    void ApplyGCMode();
+    void InitBatchedTick();
+    void RemoveBatchedTickSlot(int32 Index);
+
 private:
+    // Lua state보다 먼저 선언되어 나중에 파괴되어야 함
+    FLuaAllocator Allocator;
+    FLuaGCSettings GCSettings;
+    TMap<FString, FLuaMemoryCounter> ScriptMemory;
+    uint64 LastTotalAllocatedBytes = 0;
+    uint32 GCCyclesCompleted = 0;
+
     sol::state* Lua = nullptr;
     sol::table SharedLib;                         // 공용 유틸 테이블
 
+    // Batched Tick: 슬롯 i(0-based)는 Lua 테이블 인덱스 i+1과 대응
+    bool bBatchedTick = false;
+    TArray<ULuaScriptComponent*> BatchedTickComponents;
+    sol::table BatchTickFuncs;                    // [i] = Tick 함수
+    sol::table BatchDeltaTimes;                   // [i] = 이번 프레임 dt (Tick되지 않은 슬롯은 nil)
+    sol::protected_function BatchDispatcher;
+    int32 NumQueuedBatchedTicks = 0;
+    bool bDispatchingBatchedTick = false;         // 디스패치 중 해제는 슬롯을 비워 두고 끝난 뒤 압축
+    bool bHasDeadBatchedTicks = false;
+    FLuaMemoryCounter BatchedTickMemory;
+
+    // 발사체 그룹 -> Lua 핸들러
+    struct FProjectileLuaHandlers
+    {
+        sol::protected_function OnHit;            // (Handle, OtherGameObject|nil, Location, Normal)
+        sol::protected_function OnExpire;         // (Handle, Location)
+    };
+    TMap<int32, FProjectileLuaHandlers> ProjectileHandlers;
+
     FLuaCoroutineScheduler CoroutineSchedular;    // 씬 단위 Coroutine Manager
 };
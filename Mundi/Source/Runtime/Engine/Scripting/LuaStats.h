@@ -0,0 +1,63 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// Lua VM 메모리/GC 통계
+// FLuaManager::StepGarbageCollection()이 매 프레임 갱신
+struct FLuaStats
+{
+	// 메모리 (bytes)
+	uint64 UsedBytes = 0;
+	uint64 PeakBytes = 0;
+	uint64 PoolReservedBytes = 0;
+	uint64 LargeBytes = 0;
+	uint64 LimitBytes = 0;
+
+	// 이번 프레임에 Lua가 할당한 양
+	uint64 FrameAllocatedBytes = 0;
+
+	// GC
+	uint32 GCStepsThisFrame = 0;
+	uint32 GCCyclesCompleted = 0;
+	double GCTimeMS = 0.0;
+	bool bGenerational = false;
+
+	void Reset()
+	{
+		*this = FLuaStats{};
+	}
+};
+
+// Lua 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D / 콘솔에서 접근
+class FLuaStatManager
+{
+public:
+	static FLuaStatManager& GetInstance()
+	{
+		static FLuaStatManager Instance;
+		return Instance;
+	}
+
+	void UpdateStats(const FLuaStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	const FLuaStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FLuaStatManager() = default;
+	~FLuaStatManager() = default;
+	FLuaStatManager(const FLuaStatManager&) = delete;
+	FLuaStatManager& operator=(const FLuaStatManager&) = delete;
+
+	FLuaStats CurrentStats;
+};
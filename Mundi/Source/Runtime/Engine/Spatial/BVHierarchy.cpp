@@ -4,15 +4,23 @@
 #include <cmath>
 #include <functional>
 #include <queue>
+#include <random>
 #include "BVHierarchy.h"
 #include "Actor.h"
 #include "Collision.h"
 #include "Vector.h"
 #include "OBB.h"
+#include "BoundingSphere.h"
 #include "Frustum.h"
 #include "Picking.h" // FRay
 
 #include "StaticMeshComponent.h"
+#include "StaticMesh.h"
+#include "MeshBVH.h"
+#include "ResourceManager.h"
+#include "DecalComponent.h"
+#include "PlatformTime.h"
+#include "MemoryManager.h"
 
 namespace {
     inline bool RayAABB_IntersectT(const FRay& ray, const FAABB& box, float& outTMin, float& outTMax)
@@ -45,6 +53,119 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    // 스윕 선분(Start + t * Delta, t ∈ [0, MaxT])이 Extent만큼 확장된 노드 박스에 들어가는 시점
+    inline bool SweepNodeEnterT(const FVector& Start, const FVector& Delta, const FVector& Extent, const FAABB& box, float MaxT, float& outTEnter)
+    {
+        float tmin = 0.0f;
+        float tmax = MaxT;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float bmin = box.Min[axis] - Extent[axis];
+            const float bmax = box.Max[axis] + Extent[axis];
+            const float ro = Start[axis];
+            const float rd = Delta[axis];
+            if (std::abs(rd) < 1e-8f)
+            {
+                if (ro < bmin || ro > bmax)
+                    return false;
+            }
+            else
+            {
+                const float inv = 1.0f / rd;
+                float t1 = (bmin - ro) * inv;
+                float t2 = (bmax - ro) * inv;
+                if (t1 > t2) std::swap(t1, t2);
+                if (t1 > tmin) tmin = t1;
+                if (t2 < tmax) tmax = t2;
+                if (tmin > tmax) return false;
+            }
+        }
+        outTEnter = tmin;
+        return true;
+    }
+
+    // 스윕을 막는 컴포넌트인지 (Block이 꺼진 오버랩 전용 도형, 크기가 없는 프리미티브, 데칼, 게임에서 숨겨진 액터는 통과)
+    inline bool BlocksSweep(UPrimitiveComponent* Component, AActor* Owner, const FAABB& Box)
+    {
+        if (!Component->GetBlockComponent())
+            return false;
+        if (Box.Max.X <= Box.Min.X && Box.Max.Y <= Box.Min.Y && Box.Max.Z <= Box.Min.Z)
+            return false;
+        if (Owner->GetActorHiddenInGame())
+            return false;
+        return Cast<UDecalComponent>(Component) == nullptr;
+    }
+
+    // 스태틱 메시 좁은 단계: 메시 BVH의 삼각형과 스윕 (바운드만 스치는 스윕은 통과)
+    // 로컬 공간에서 풀며, 박스 스윕은 외접구로, 비균등 스케일은 가장 작은 축 스케일로 반지름을 키워 보수적으로 근사한다
+    // 입력(메시 BVH, 월드 역행렬, 최소 스케일)은 FBVHierarchy::BuildSweepNarrowPhase가 만든다
+    void SweepStaticMeshTriangles(const FSweepQuery& Query, const FVector& Delta, const FMeshBVH& MeshBVH, const FStaticMesh& Asset,
+        const FMatrix& InvWorld, float MinScale, float MaxT, bool& bOutHit, float& OutTime, FVector& OutNormal)
+    {
+        bOutHit = false;
+        const float WorldRadius = Query.Extent.IsZero() ? Query.Radius : Query.Extent.Size();
+        const float LocalRadius = WorldRadius / MinScale;
+
+        const FVector4 LocalStart4 = FVector4(Query.Start.X, Query.Start.Y, Query.Start.Z, 1.0f) * InvWorld;
+        const FVector4 LocalDelta4 = FVector4(Delta.X, Delta.Y, Delta.Z, 0.0f) * InvWorld;
+        const FVector LocalStart(LocalStart4.X, LocalStart4.Y, LocalStart4.Z);
+        const FVector LocalDelta(LocalDelta4.X, LocalDelta4.Y, LocalDelta4.Z);
+        const FVector LocalExtent(LocalRadius, LocalRadius, LocalRadius);
+
+        const TArray<FMeshBVHNode>& MeshNodes = MeshBVH.GetNodes();
+        const TArray<uint32>& TriIndices = MeshBVH.GetTriIndices();
+        const TArray<FNormalVertex>& Vertices = Asset.Vertices;
+        const TArray<uint32>& Indices = Asset.Indices;
+
+        float BestTime = MaxT;
+        FVector LocalNormal;
+        TArray<int32, TInlineAllocator<64>> Stack;
+        Stack.push_back(0);
+        while (!Stack.empty())
+        {
+            const FMeshBVHNode& Node = MeshNodes[Stack.back()];
+            Stack.pop_back();
+
+            float EnterT;
+            if (!SweepNodeEnterT(LocalStart, LocalDelta, LocalExtent, Node.Bounds, BestTime, EnterT))
+                continue;
+
+            if (!Node.IsLeaf())
+            {
+                if (Node.Left >= 0) Stack.push_back(Node.Left);
+                if (Node.Right >= 0) Stack.push_back(Node.Right);
+                continue;
+            }
+
+            for (uint32 i = Node.Start; i < Node.Start + Node.Count; ++i)
+            {
+                const uint32 Base = TriIndices[i] * 3;
+                float Time;
+                FVector Normal;
+                if (Collision::SweepSphereTriangle(LocalStart, LocalDelta, LocalRadius,
+                    Vertices[Indices[Base]].pos, Vertices[Indices[Base + 1]].pos, Vertices[Indices[Base + 2]].pos, Time, Normal)
+                    && Time <= BestTime)
+                {
+                    bOutHit = true;
+                    BestTime = Time;
+                    LocalNormal = Normal;
+                }
+            }
+        }
+
+        if (bOutHit)
+        {
+            // 법선은 역행렬의 전치로 월드로 (행벡터 규약: n_world[j] = Σk InvWorld[j][k] * n_local[k])
+            FVector WorldNormal;
+            for (int32 Row = 0; Row < 3; ++Row)
+            {
+                WorldNormal[Row] = InvWorld.M[Row][0] * LocalNormal.X + InvWorld.M[Row][1] * LocalNormal.Y + InvWorld.M[Row][2] * LocalNormal.Z;
+            }
+            OutTime = BestTime;
+            OutNormal = WorldNormal.GetSafeNormal();
+        }
+    }
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -63,15 +184,18 @@ FBVHierarchy::~FBVHierarchy()
 void FBVHierarchy::Clear()
 {
     // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-    StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
+    StaticMeshComponentBounds = TFlatMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
+    SweepSnapshot = TArray<FSweepNarrowPhase>();
+    bSweepSnapshotValid = false;
     bPendingRebuild = false;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
 {
+    StaticMeshComponentBounds.Reserve(StaticMeshComponentBounds.Num() + static_cast<int32>(Components.Num()));
     for (const auto& SMC : Components)
     {
         if (SMC)
@@ -103,6 +227,7 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
 
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
     bPendingRebuild = true;
+    bSweepSnapshotValid = false;
 }
 
 void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
@@ -116,6 +241,7 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
     {
         StaticMeshComponentBounds.Remove(InComponent);
         bPendingRebuild = true;
+        bSweepSnapshotValid = false;
     }
 }
 
@@ -140,7 +266,7 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
         return;
     }
     //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
+    FNodeStack IdxStack;
     IdxStack.push_back({ 0 });
 
     while (!IdxStack.empty())
@@ -186,9 +312,10 @@ void FBVHierarchy::DebugDraw(URenderer* Renderer) const
         const FVector Max = N.Bounds.Max;
         const FVector4 LineColor(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f);
 
-        TArray<FVector> Start;
-        TArray<FVector> End;
-        TArray<FVector4> Color;
+        // 노드당 선 12개
+        TArray<FVector, TInlineAllocator<12>> Start;
+        TArray<FVector, TInlineAllocator<12>> End;
+        TArray<FVector4, TInlineAllocator<12>> Color;
 
         const FVector v0(Min.X, Min.Y, Min.Z);
         const FVector v1(Max.X, Min.Y, Min.Z);
@@ -271,6 +398,7 @@ namespace
 
 void FBVHierarchy::BuildLBVH()
 {
+    bSweepSnapshotValid = false;
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
@@ -422,7 +550,7 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
         bool operator<(const HeapItem& other) const { return TMin > other.TMin; } // min-heap behavior
     };
 
-    std::priority_queue<HeapItem> heap;
+    std::priority_queue<HeapItem, TArray<HeapItem, TInlineAllocator<64>>> heap;
     heap.push({ 0, tminRoot });
 
     const float Epsilon = 1e-3f;
@@ -504,15 +632,17 @@ void FBVHierarchy::FlushRebuild()
 }
 
 template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
+void FBVHierarchy::QueryIntersectedComponentsGeneric(
     const BoundType& InBound,
     NodeIntersectFunc NodeIntersects,
-    ComponentIntersectFunc ComponentIntersects) const
+    ComponentIntersectFunc ComponentIntersects,
+    TArray<UPrimitiveComponent*>& OutComponents) const
 {
-    TSet<UPrimitiveComponent*> IntersectedComponents;
+    // 리프들은 StaticMeshComponentArray를 겹치지 않게 나눠 가지므로 중복 제거 없이 바로 추가
+    OutComponents.clear();
     if (Nodes.empty())
-        return TArray<UPrimitiveComponent*>();
-    TArray<int32> IdxStack;
+        return;
+    FNodeStack IdxStack;
     IdxStack.push_back({ 0 });
 
     while (!IdxStack.empty())
@@ -533,7 +663,7 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
                     const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
                     if (ComponentIntersects(Box, InBound))
                     {
-                        IntersectedComponents.insert(Component);
+                        OutComponents.Add(Component);
                     }
                 }
             }
@@ -544,35 +674,415 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
             }
         }
     }
-    return IntersectedComponents.Array();
 }
 
 // FAABB 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
+void FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound, TArray<UPrimitiveComponent*>& OutComponents) const
 {
-    return QueryIntersectedComponentsGeneric(
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FAABB& inBound) { return nodeBound.Intersects(inBound); },
-        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); }
+        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); },
+        OutComponents
     );
 }
 
 // FOBB 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
+void FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound, TArray<UPrimitiveComponent*>& OutComponents) const
 {
-    return QueryIntersectedComponentsGeneric(
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FOBB& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); }
+        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); },
+        OutComponents
     );
 }
 
 // FBoundingSphere 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
+void FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound, TArray<UPrimitiveComponent*>& OutComponents) const
 {
-    return QueryIntersectedComponentsGeneric(
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FBoundingSphere& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); }
+        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); },
+        OutComponents
     );
 }
+
+TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
+{
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponents(InBound, Result);
+    return Result;
+}
+
+TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
+{
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponents(InBound, Result);
+    return Result;
+}
+
+TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
+{
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponents(InBound, Result);
+    return Result;
+}
+
+void FBVHierarchy::SweepClosestInternal(const FSweepQuery& Query, FSweepHit& OutHit, FNodeStack& IdxStack) const
+{
+    OutHit = FSweepHit();
+    OutHit.Location = Query.End;
+    if (Nodes.empty()) return;
+
+    const FVector Delta = Query.End - Query.Start;
+    // 노드 판정은 구도 반지름만큼 확장한 박스로 (보수적)
+    const FVector NodeExtent = Query.Extent.IsZero() ? FVector(Query.Radius, Query.Radius, Query.Radius) : Query.Extent;
+
+    float BestTime = 1.0f;
+    IdxStack.clear();
+    IdxStack.push_back(0);
+
+    while (!IdxStack.empty())
+    {
+        const int32 Idx = IdxStack.back();
+        IdxStack.pop_back();
+        const FLBVHNode& Node = Nodes[Idx];
+
+        float EnterT;
+        if (!SweepNodeEnterT(Query.Start, Delta, NodeExtent, Node.Bounds, BestTime, EnterT))
+            continue;
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                if (!Component) continue;
+                // 리빌드 전에 제거된 컴포넌트는 건너뜀
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached) continue;
+                AActor* Owner = Component->GetOwner();
+                if (!Owner || Owner == Query.IgnoreActor) continue;
+                if (!BlocksSweep(Component, Owner, *Cached)) continue;
+
+                float Time;
+                FVector Normal;
+                bool bHit = false;
+
+                // 스냅샷이 있으면 그것만 읽는다 (워커 스레드 경로). 없으면 게임 스레드에서 컴포넌트로부터 만든다
+                FSweepNarrowPhase LiveNarrowPhase;
+                const FSweepNarrowPhase* NarrowPhase = &LiveNarrowPhase;
+                if (bSweepSnapshotValid)
+                {
+                    NarrowPhase = &SweepSnapshot[Node.First + i];
+                }
+                else
+                {
+                    BuildSweepNarrowPhase(Component, LiveNarrowPhase);
+                }
+
+                if (NarrowPhase->MeshBVH)
+                {
+                    // 시작부터 바운드 안에 있어도 삼각형 기준으로 판정
+                    SweepStaticMeshTriangles(Query, Delta, *NarrowPhase->MeshBVH, *NarrowPhase->Asset, NarrowPhase->InvWorld, NarrowPhase->MinScale,
+                        BestTime, bHit, Time, Normal);
+                }
+                else
+                {
+                    bHit = Collision::SweepAgainstAABB(Query, *Cached, Time, Normal);
+                }
+                if (bHit && (!OutHit.bBlockingHit || Time < BestTime))
+                {
+                    BestTime = Time;
+                    OutHit.bBlockingHit = true;
+                    OutHit.Time = Time;
+                    OutHit.ImpactNormal = Normal;
+                    OutHit.Component = Component;
+                    OutHit.Actor = Owner;
+                }
+            }
+            continue;
+        }
+
+        // 가까운 자식을 먼저 방문하도록 먼 쪽을 먼저 push
+        float TL = 0.0f, TR = 0.0f;
+        const bool bLeft = Node.Left >= 0 && SweepNodeEnterT(Query.Start, Delta, NodeExtent, Nodes[Node.Left].Bounds, BestTime, TL);
+        const bool bRight = Node.Right >= 0 && SweepNodeEnterT(Query.Start, Delta, NodeExtent, Nodes[Node.Right].Bounds, BestTime, TR);
+        if (bLeft && bRight)
+        {
+            IdxStack.push_back(TL <= TR ? Node.Right : Node.Left);
+            IdxStack.push_back(TL <= TR ? Node.Left : Node.Right);
+        }
+        else if (bLeft)
+        {
+            IdxStack.push_back(Node.Left);
+        }
+        else if (bRight)
+        {
+            IdxStack.push_back(Node.Right);
+        }
+    }
+
+    if (OutHit.bBlockingHit)
+    {
+        OutHit.Location = Query.Start + Delta * OutHit.Time;
+    }
+}
+
+void FBVHierarchy::BuildSweepNarrowPhase(const UPrimitiveComponent* Component, FSweepNarrowPhase& OutNarrowPhase)
+{
+    OutNarrowPhase = FSweepNarrowPhase();
+
+    // 메시 BVH가 아직 없으면(비동기 빌드 중) 비워 두고 AABB 판정을 쓴다
+    const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component);
+    const UStaticMesh* Mesh = StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr;
+    const FStaticMesh* Asset = Mesh ? Mesh->GetStaticMeshAsset() : nullptr;
+    if (!Asset || Asset->GeometryHash == 0)
+        return;
+    const FMeshBVH* MeshBVH = UResourceManager::GetInstance().GetMeshBVH(Asset->GeometryHash);
+    if (!MeshBVH || MeshBVH->IsEmpty())
+        return;
+
+    const FVector Scale = Component->GetWorldScale();
+    const float MinScale = FMath::Min(std::abs(Scale.X), FMath::Min(std::abs(Scale.Y), std::abs(Scale.Z)));
+    if (MinScale <= KINDA_SMALL_NUMBER)
+        return;
+
+    OutNarrowPhase.MeshBVH = MeshBVH;
+    OutNarrowPhase.Asset = Asset;
+    OutNarrowPhase.InvWorld = Component->GetWorldMatrix().InverseAffine();
+    OutNarrowPhase.MinScale = MinScale;
+}
+
+void FBVHierarchy::PrepareSweepSnapshot()
+{
+    // 트랜스폼 갱신은 예산 단위로 늦게 반영될 수 있으므로 스윕 직전마다 새로 뜬다
+    const int32 N = StaticMeshComponentArray.Num();
+    SweepSnapshot.SetNum(N);
+    for (int32 i = 0; i < N; ++i)
+    {
+        if (UPrimitiveComponent* Component = StaticMeshComponentArray[i])
+        {
+            BuildSweepNarrowPhase(Component, SweepSnapshot[i]);
+        }
+        else
+        {
+            SweepSnapshot[i] = FSweepNarrowPhase();
+        }
+    }
+    bSweepSnapshotValid = true;
+}
+
+bool FBVHierarchy::SweepClosest(const FSweepQuery& Query, FSweepHit& OutHit) const
+{
+    FNodeStack IdxStack;
+    SweepClosestInternal(Query, OutHit, IdxStack);
+    return OutHit.bBlockingHit;
+}
+
+void FBVHierarchy::SweepClosestBatch(const TArray<FSweepQuery>& Queries, TArray<FSweepHit>& OutHits) const
+{
+    const int32 N = Queries.Num();
+    OutHits.SetNum(N);
+    if (N == 0) return;
+
+    // 시작점의 Morton 코드로 정렬해 인접한 스윕이 연속으로 같은 노드를 방문하도록 (캐시 적중률)
+    FMemMark Mark(FMemStack::Get());
+    TMemStackArray<std::pair<uint32, int32>> Order;
+    Order.resize(N);
+    const FVector Min = Bounds.Min;
+    const FVector Size = Bounds.Max - Bounds.Min;
+    const auto Quantize = [](float Value, float MinValue, float Extent)
+        {
+            return Extent > 0.0f ? static_cast<uint32>(std::clamp((Value - MinValue) / Extent, 0.0f, 1.0f) * 1023.0f) : 0u;
+        };
+    for (int32 i = 0; i < N; ++i)
+    {
+        const FVector& P = Queries[i].Start;
+        Order[i] = { Morton3D(Quantize(P.X, Min.X, Size.X), Quantize(P.Y, Min.Y, Size.Y), Quantize(P.Z, Min.Z, Size.Z)), i };
+    }
+    std::sort(Order.begin(), Order.end());
+
+    FNodeStack IdxStack;
+    for (const auto& Entry : Order)
+    {
+        SweepClosestInternal(Queries[Entry.second], OutHits[Entry.second], IdxStack);
+    }
+}
+
+void FBVHierarchy::RunSweepBenchmark(int32 NumQueries, int32 Iterations) const
+{
+    if (Nodes.empty() || NumQueries <= 0 || Iterations <= 0)
+    {
+        UE_LOG("[BVH] Sweep benchmark: empty tree or invalid arguments\r\n");
+        return;
+    }
+
+    // 트리 범위 안의 무작위 스윕 (한 틱 이동량 ~ 범위의 2%, 반지름 ~ 0.5%)
+    std::mt19937 Rng(1234);
+    std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+    const FVector Size = Bounds.Max - Bounds.Min;
+    const float Reach = Size.Size() * 0.02f;
+
+    TArray<FSweepQuery> Queries;
+    Queries.resize(NumQueries);
+    for (FSweepQuery& Query : Queries)
+    {
+        Query.Start = FVector(Bounds.Min.X + Size.X * Unit(Rng), Bounds.Min.Y + Size.Y * Unit(Rng), Bounds.Min.Z + Size.Z * Unit(Rng));
+        const FVector Dir = FVector(Unit(Rng) * 2.0f - 1.0f, Unit(Rng) * 2.0f - 1.0f, Unit(Rng) * 2.0f - 1.0f).GetSafeNormal();
+        Query.End = Query.Start + Dir * Reach;
+        Query.Radius = Reach * 0.25f;
+    }
+
+    TArray<FSweepHit> Hits;
+    FSweepHit Single;
+    int32 NumHits = 0;
+
+    uint64 Start = FPlatformTime::Cycles64();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        NumHits = 0;
+        for (const FSweepQuery& Query : Queries)
+        {
+            NumHits += SweepClosest(Query, Single) ? 1 : 0;
+        }
+    }
+    const double SingleMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / Iterations;
+
+    Start = FPlatformTime::Cycles64();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        SweepClosestBatch(Queries, Hits);
+    }
+    const double BatchMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / Iterations;
+
+    UE_LOG("[BVH] Sweep benchmark: %d queries x %d iterations, %d components, %d nodes, %d hits\r\n",
+        NumQueries, Iterations, TotalActorCount(), TotalNodeCount(), NumHits);
+    UE_LOG("[BVH]   single %.3f ms (%.1f ns/query), batch %.3f ms (%.1f ns/query)\r\n",
+        SingleMS, SingleMS * 1.0e6 / NumQueries, BatchMS, BatchMS * 1.0e6 / NumQueries);
+}
+
+bool FBVHierarchy::RunAllocationTest(int32 NumQueries)
+{
+    if (Nodes.empty() || NumQueries <= 0)
+    {
+        UE_LOG("[BVH] Allocation test: empty tree or invalid arguments\r\n");
+        return false;
+    }
+
+    // 쿼리 입력과 결과 배열은 측정 밖에서 준비 (게임 코드도 매 프레임 재사용하는 멤버로 들고 있는 것을 전제)
+    std::mt19937 Rng(4321);
+    std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+    const FVector Size = Bounds.Max - Bounds.Min;
+    const auto RandomPoint = [&]()
+        {
+            return FVector(Bounds.Min.X + Size.X * Unit(Rng), Bounds.Min.Y + Size.Y * Unit(Rng), Bounds.Min.Z + Size.Z * Unit(Rng));
+        };
+    const auto RandomDirection = [&]()
+        {
+            return FVector(Unit(Rng) * 2.0f - 1.0f, Unit(Rng) * 2.0f - 1.0f, Unit(Rng) * 2.0f - 1.0f).GetSafeNormal();
+        };
+    const float Reach = Size.Size() * 0.02f;
+
+    TArray<FSweepQuery> Sweeps;
+    Sweeps.resize(NumQueries);
+    for (FSweepQuery& Query : Sweeps)
+    {
+        Query.Start = RandomPoint();
+        Query.End = Query.Start + RandomDirection() * Reach;
+        Query.Radius = Reach * 0.25f;
+    }
+
+    const int32 NumVolumeQueries = std::max(1, NumQueries / 8);
+    TArray<FAABB> Boxes;
+    TArray<FBoundingSphere> Spheres;
+    TArray<FRay> Rays;
+    for (int32 i = 0; i < NumVolumeQueries; ++i)
+    {
+        const FVector Center = RandomPoint();
+        const FVector Extent(Reach, Reach, Reach);
+        Boxes.Add(FAABB(Center - Extent, Center + Extent));
+        Spheres.Add(FBoundingSphere(Center, Reach));
+
+        FRay Ray;
+        Ray.Origin = RandomPoint();
+        Ray.Direction = RandomDirection();
+        Rays.Add(Ray);
+    }
+
+    // 트리 범위 가운데 절반을 덮는 박스 프러스텀 (루트와 교차하므로 실제 순회가 일어난다)
+    const FVector Lo = Bounds.Min + Size * 0.25f;
+    const FVector Hi = Bounds.Max - Size * 0.25f;
+    const auto MakePlane = [](float X, float Y, float Z, float Distance)
+        {
+            FPlane Plane;
+            Plane.Normal = FVector4(X, Y, Z, 0.0f);
+            Plane.Distance = Distance;
+            return Plane;
+        };
+    FFrustum Frustum;
+    Frustum.LeftFace = MakePlane(1.0f, 0.0f, 0.0f, Lo.X);
+    Frustum.RightFace = MakePlane(-1.0f, 0.0f, 0.0f, -Hi.X);
+    Frustum.BottomFace = MakePlane(0.0f, 1.0f, 0.0f, Lo.Y);
+    Frustum.TopFace = MakePlane(0.0f, -1.0f, 0.0f, -Hi.Y);
+    Frustum.NearFace = MakePlane(0.0f, 0.0f, 1.0f, Lo.Z);
+    Frustum.FarFace = MakePlane(0.0f, 0.0f, -1.0f, -Hi.Z);
+
+    TArray<FSweepHit> Hits;
+    TArray<UPrimitiveComponent*> Overlaps;
+    int32 NumResults = 0;
+
+    const auto RunFrame = [&]()
+        {
+            NumResults = 0;
+            QueryFrustum(Frustum);
+
+            FSweepHit Single;
+            for (int32 i = 0; i < std::min(NumQueries, 64); ++i)
+            {
+                NumResults += SweepClosest(Sweeps[i], Single) ? 1 : 0;
+            }
+            SweepClosestBatch(Sweeps, Hits);
+
+            for (int32 i = 0; i < NumVolumeQueries; ++i)
+            {
+                QueryIntersectedComponents(Boxes[i], Overlaps);
+                NumResults += Overlaps.Num();
+                QueryIntersectedComponents(Spheres[i], Overlaps);
+                NumResults += Overlaps.Num();
+
+                AActor* HitActor = nullptr;
+                float HitT = -1.0f;
+                QueryRayClosest(Rays[i], HitActor, HitT);
+                NumResults += HitActor ? 1 : 0;
+            }
+        };
+
+    // 예열: 결과 배열 용량, FMemStack 청크, 메시 BVH 캐시가 여기서 잡힌다
+    RunFrame();
+    RunFrame();
+
+    const uint64 StartAllocations = FMemoryManager::GetThreadHeapAllocationCount();
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    RunFrame();
+    const double FrameMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    const uint64 NumAllocations = FMemoryManager::GetThreadHeapAllocationCount() - StartAllocations;
+
+#if !MUNDI_TRACK_HEAP_ALLOCATIONS
+    UE_LOG("[BVH] Allocation test: heap tracking disabled (MUNDI_TRACK_HEAP_ALLOCATIONS=0)\r\n");
+    return true;
+#else
+    const bool bPassed = NumAllocations == 0;
+    UE_LOG("[BVH] Allocation test: %d sweeps + %d box/sphere/ray queries + frustum, %d results, %.3f ms, %llu heap allocations -> %s\r\n",
+        NumQueries, NumVolumeQueries, NumResults, FrameMS, NumAllocations, bPassed ? "PASS" : "FAIL");
+#if _ITERATOR_DEBUG_LEVEL != 0
+    if (!bPassed)
+    {
+        UE_LOG("[BVH]   iterator debugging is on: container proxies are heap allocated, check with a Release build\r\n");
+    }
+#endif
+    return bPassed;
+#endif
+}
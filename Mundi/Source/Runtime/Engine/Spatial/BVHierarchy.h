@@ -6,6 +6,10 @@ class UPrimitiveComponent;
 class AActor;
 struct FOBB;
 struct FBoundingSphere;
+struct FSweepQuery;
+struct FSweepHit;
+class FMeshBVH;
+struct FStaticMesh;
 
 /**
  * @brief Broad phase BVH based on UPrimitiveComponent
@@ -37,6 +41,27 @@ public:
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
+    // 결과 배열을 재사용하는 버전 (OutComponents를 비우고 채움, 용량은 유지)
+    void QueryIntersectedComponents(const FAABB& InBound, TArray<UPrimitiveComponent*>& OutComponents) const;
+    void QueryIntersectedComponents(const FOBB& InBound, TArray<UPrimitiveComponent*>& OutComponents) const;
+    void QueryIntersectedComponents(const FBoundingSphere& InBound, TArray<UPrimitiveComponent*>& OutComponents) const;
+
+    // 구/AABB 스윕: 컴포넌트 월드 AABB 기준으로 가장 먼저 닿는 대상(TOI, 법선) 반환
+    bool SweepClosest(const FSweepQuery& Query, FSweepHit& OutHit) const;
+    // 다수의 스윕을 한 번에 처리 (공간적으로 정렬해 순회 스택/캐시 재사용). OutHits[i]는 Queries[i]의 결과
+    void SweepClosestBatch(const TArray<FSweepQuery>& Queries, TArray<FSweepHit>& OutHits) const;
+
+    // 워커 스레드에서 스윕하기 전에 게임 스레드에서 호출: 스태틱 메시의 메시 BVH와 월드 역행렬을 스냅샷으로 떠 둔다
+    // 스냅샷이 유효한 동안 스윕은 이것만 읽는다 (전역 메시 BVH 잠금, 게임 스레드가 갱신 중인 컴포넌트 트랜스폼을 건드리지 않음)
+    // 트리가 바뀌면(Update/Remove/리빌드) 무효화되고, 그 뒤 스윕은 컴포넌트에서 직접 읽는다 (게임 스레드 전용)
+    void PrepareSweepSnapshot();
+
+    // 헤드리스 벤치마크: 트리 범위 안에서 무작위 스윕 NumQueries개를 단건/배치로 처리한 시간 비교
+    void RunSweepBenchmark(int32 NumQueries, int32 Iterations) const;
+
+    // 힙 할당 회귀 검사: 프러스텀/스윕/오버랩/레이 쿼리로 구성한 한 프레임을 예열 후 다시 돌려
+    // 현재 스레드의 힙 할당 횟수가 0인지 확인 (QueryFrustum이 컬링 플래그를 바꾸므로 non-const)
+    bool RunAllocationTest(int32 NumQueries);
 
     void DebugDraw(URenderer* Renderer) const;
 
@@ -64,23 +89,42 @@ private:
     void BuildLBVH();
 
 private:
+    // 순회 스택: 트리 깊이만큼만 쌓이므로 인라인 버퍼로 충분 (넘치면 힙으로)
+    using FNodeStack = TArray<int32, TInlineAllocator<64>>;
+
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-    TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
+    void QueryIntersectedComponentsGeneric(const BoundType& InBound
         , NodeIntersectFunc NodeIntersects
-        , ComponentIntersectFunc ComponentIntersects) const;
+        , ComponentIntersectFunc ComponentIntersects
+        , TArray<UPrimitiveComponent*>& OutComponents) const;
 
     int BuildRange(int s, int e);
 
+    void SweepClosestInternal(const FSweepQuery& Query, FSweepHit& OutHit, FNodeStack& IdxStack) const;
+
+    // 스태틱 메시 좁은 단계 입력 (StaticMeshComponentArray와 같은 순서)
+    struct FSweepNarrowPhase
+    {
+        const FMeshBVH* MeshBVH = nullptr;      // nullptr면 AABB 판정 (스태틱 메시가 아니거나 메시 BVH가 아직 없음)
+        const FStaticMesh* Asset = nullptr;
+        FMatrix InvWorld;
+        float MinScale = 0.0f;
+    };
+    static void BuildSweepNarrowPhase(const UPrimitiveComponent* Component, FSweepNarrowPhase& OutNarrowPhase);
+
     int Depth;
     int MaxDepth;
     int MaxObjects;
     FAABB Bounds;
 
-    TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    TFlatMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
+    TArray<FSweepNarrowPhase> SweepSnapshot;
+    bool bSweepSnapshotValid = false;
+
     bool bPendingRebuild = false;
 };
@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "Hash.h"
 
 void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
@@ -15,6 +16,65 @@ void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>
 	BuildRecursive(0, TriCount, Vertices, Indices);
 }
 
+bool FMeshBVH::Load(TArray<FMeshBVHNode>&& InNodes, TArray<uint32>&& InTriIndices, uint32 NumTriangles)
+{
+	Nodes.Empty();
+	TriIndices.Empty();
+
+	if (NumTriangles == 0)
+	{
+		return InNodes.Num() == 0 && InTriIndices.Num() == 0;
+	}
+
+	if (InNodes.Num() == 0 || static_cast<uint32>(InTriIndices.Num()) != NumTriangles)
+	{
+		return false;
+	}
+
+	// TriIndices는 [0, NumTriangles)의 순열이어야 한다
+	TArray<uint8> bSeen;
+	bSeen.SetNum(static_cast<int32>(NumTriangles));
+	for (uint32 TriangleID : InTriIndices)
+	{
+		if (TriangleID >= NumTriangles || bSeen[TriangleID])
+		{
+			return false;
+		}
+		bSeen[TriangleID] = 1;
+	}
+
+	// 노드는 전위 순서로 저장되므로 자식 인덱스는 항상 부모보다 크다 (순회가 반드시 끝남)
+	const int NumNodes = InNodes.Num();
+	for (int NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		const FMeshBVHNode& Node = InNodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			if (static_cast<uint64>(Node.Start) + Node.Count > NumTriangles || Node.Left != -1 || Node.Right != -1)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			if (Node.Left <= NodeIndex || Node.Left >= NumNodes || Node.Right <= NodeIndex || Node.Right >= NumNodes)
+			{
+				return false;
+			}
+		}
+	}
+
+	Nodes = std::move(InNodes);
+	TriIndices = std::move(InTriIndices);
+	return true;
+}
+
+uint64 FMeshBVH::ComputeGeometryHash(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	const uint64 VertexHash = HashBytes(Vertices.data(), static_cast<uint64>(Vertices.size()) * sizeof(FNormalVertex));
+	return HashBytes(Indices.data(), static_cast<uint64>(Indices.size()) * sizeof(uint32), VertexHash);
+}
+
 // 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
 // Möller–Trumbore로 교차 체크 ! 
 bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
@@ -44,7 +104,7 @@ bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 		}
 	};
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
+	std::priority_queue<FHeapItem, TArray<FHeapItem, TInlineAllocator<64>>, std::greater<FHeapItem>> Heap;
 	Heap.push({ 0, RootEntry });
 
 	while (!Heap.empty())
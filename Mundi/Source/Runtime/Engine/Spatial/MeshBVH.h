@@ -25,6 +25,16 @@ public:
 
 	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
 
+	// 캐시 파일에서 읽은 노드/삼각형 순서를 검증한 뒤 채택한다 (잘못된 데이터면 false, 빈 상태로 둠)
+	bool Load(TArray<FMeshBVHNode>&& InNodes, TArray<uint32>&& InTriIndices, uint32 NumTriangles);
+
+	const TArray<FMeshBVHNode>& GetNodes() const { return Nodes; }
+	const TArray<uint32>& GetTriIndices() const { return TriIndices; }
+	bool IsEmpty() const { return Nodes.Num() == 0; }
+
+	// 정점 + 인덱스 내용 해시. BVH 캐시 키로 쓰며, 같은 지오메트리를 가진 메시는 BVH를 공유한다
+	static uint64 ComputeGeometryHash(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+
 
 private:
 	// Helper 함수들
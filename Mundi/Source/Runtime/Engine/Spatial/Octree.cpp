@@ -50,6 +50,7 @@ void FOctree::BulkInsert(const TArray<std::pair<AActor*, FAABB>>& ActorsAndBound
     // 모든 액터를 대상 영역에 바로 추가
     Actors.reserve(Actors.size() + ActorsAndBounds.size());
     ActorBoundsCache.reserve(ActorBoundsCache.size() + ActorsAndBounds.size());
+    ActorLastBounds.Reserve(ActorLastBounds.Num() + static_cast<int32>(ActorsAndBounds.size()));
     for (const auto& ActorBoundPair : ActorsAndBounds)
     {
         Actors.push_back(ActorBoundPair.first);
@@ -397,11 +398,15 @@ void FOctree::DebugDump() const
     UE_LOG("===== OCTREE DUMP END =====\r\n");
 }
 
+// 박스 모서리 12개 분량 (인라인 버퍼)
+template<typename T>
+using TBoxLineArray = TArray<T, TInlineAllocator<12>>;
+
 static void CreateLineDataFromAABB(
     const FVector& Min, const FVector& Max,
-    OUT TArray<FVector>& Start,
-    OUT TArray<FVector>& End,
-    OUT TArray<FVector4>& Color,
+    OUT TBoxLineArray<FVector>& Start,
+    OUT TBoxLineArray<FVector>& End,
+    OUT TBoxLineArray<FVector4>& Color,
     const FVector4& LineColor)
 {
     const FVector v0(Min.X, Min.Y, Min.Z);
@@ -540,7 +545,7 @@ void FOctree::DebugDraw(URenderer* InRenderer) const
         int32 DepthLevel;
     };
 
-    TArray<FStackItem> Stack;
+    TArray<FStackItem, TInlineAllocator<64>> Stack;
     Stack.Add({ this, Depth });
 
     while (Stack.Num() > 0)
@@ -550,9 +555,9 @@ void FOctree::DebugDraw(URenderer* InRenderer) const
         const int32 DepthIndex = Current.DepthLevel % 8;
         FVector4 NodeColor = LevelColors[DepthIndex];
         // AABB 박스 라인 그리기
-        TArray<FVector> LineStarts;
-        TArray<FVector> LineEnds;
-        TArray<FVector4> LineColors;
+        TBoxLineArray<FVector> LineStarts;
+        TBoxLineArray<FVector> LineEnds;
+        TBoxLineArray<FVector4> LineColors;
         CreateLineDataFromAABB(CurrentNode->Bounds.Min, CurrentNode->Bounds.Max, LineStarts, LineEnds, LineColors, NodeColor);
         InRenderer->AddLines(LineStarts, LineEnds, LineColors);
 
@@ -79,7 +79,7 @@ private:
 	TArray<AActor*> Actors;
 	FOctree* Children[8]; // 8분할 
     // TODO 리팩토링 -> 하나의 TMAP으로 관리하던 , 해야할 것 같다 . 
-    TMap<AActor*, FAABB> ActorLastBounds;
+    TFlatMap<AActor*, FAABB> ActorLastBounds;
     TArray<FAABB> ActorBoundsCache;
     TArray<AActor*> ActorArray;
     
@@ -20,6 +20,33 @@ void D3D11RHI::Initialize(HWND hWindow)
     UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
+bool D3D11RHI::InitializeHeadless(UINT Width, UINT Height, bool bForceWarp)
+{
+    bHeadless = true;
+    HeadlessWidth = Width > 0 ? Width : 1;
+    HeadlessHeight = Height > 0 ? Height : 1;
+
+    if (!CreateHeadlessDevice(bForceWarp))
+    {
+        return false;
+    }
+    ViewportInfo = { 0.0f, 0.0f, (float)HeadlessWidth, (float)HeadlessHeight, 0.0f, 1.0f };
+
+    CreateFrameBuffer();
+    CreateIdBuffer();
+    CreateRasterizerState();
+    CreateBlendState();
+    CONSTANT_BUFFER_LIST(CREATE_CONSTANT_BUFFER);
+
+	CreateDepthStencilState();
+	CreateSamplerState();
+    UResourceManager::GetInstance().Initialize(Device,DeviceContext);
+
+    // 스왑체인이 없으므로 Direct2D 오버레이는 초기화하지 않는다
+    UE_LOG("[RHI] Headless device created (%s driver, %ux%u)", DriverName, HeadlessWidth, HeadlessHeight);
+    return true;
+}
+
 void D3D11RHI::Release()
 {
     // Prevent double Release() calls
@@ -303,14 +330,22 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mes
     if (!mesh || mesh->Indices.empty())
         return E_FAIL;
 
+    // 자동 생성 LOD가 있으면 LOD0 뒤에 이어 붙여 한 버퍼로 올린다 (MeshLOD::GetSection 기준)
+    TArray<uint32> lodIndices;
+    if (!mesh->LODs.empty())
+    {
+        lodIndices = MeshLOD::GatherIndices(mesh->Indices, mesh->LODs);
+    }
+    const TArray<uint32>& indices = mesh->LODs.empty() ? mesh->Indices : lodIndices;
+
     D3D11_BUFFER_DESC ibd = {};
     ibd.Usage = D3D11_USAGE_DEFAULT;
-    ibd.ByteWidth = static_cast<UINT>(sizeof(uint32) * mesh->Indices.size());
+    ibd.ByteWidth = static_cast<UINT>(sizeof(uint32) * indices.size());
     ibd.BindFlags = D3D11_BIND_INDEX_BUFFER;
     ibd.CPUAccessFlags = 0;
 
     D3D11_SUBRESOURCE_DATA iinitData = {};
-    iinitData.pSysMem = mesh->Indices.data();
+    iinitData.pSysMem = indices.data();
 
     return device->CreateBuffer(&ibd, &iinitData, outBuffer);
 }
@@ -480,6 +515,13 @@ void D3D11RHI::DrawFullScreenQuad()
 
 void D3D11RHI::Present()
 {
+    if (bHeadless)
+    {
+        // 스왑체인이 없으므로 제출만 한다 (NULL 드라이버에서는 아무 일도 하지 않음)
+        DeviceContext->Flush();
+        return;
+    }
+
     // Draw any Direct2D overlays before present
     UStatsOverlayD2D::Get().Draw();
     SwapChain->Present(0, 0); // vsync on
@@ -519,13 +561,85 @@ void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
     ViewportInfo = { 0.0f, 0.0f, (float)swapchaindesc.BufferDesc.Width, (float)swapchaindesc.BufferDesc.Height, 0.0f, 1.0f };
 }
 
-void D3D11RHI::CreateFrameBuffer()
+bool D3D11RHI::CreateHeadlessDevice(bool bForceWarp)
 {
+    D3D_FEATURE_LEVEL featurelevels[] = { D3D_FEATURE_LEVEL_11_0 };
+
+    struct FDriverCandidate
+    {
+        D3D_DRIVER_TYPE Type;
+        const char* Name;
+    };
+    const FDriverCandidate Candidates[] = {
+        { D3D_DRIVER_TYPE_NULL, "Null" },
+        { D3D_DRIVER_TYPE_WARP, "WARP" },
+    };
+
+    for (const FDriverCandidate& Candidate : Candidates)
+    {
+        if (bForceWarp && Candidate.Type != D3D_DRIVER_TYPE_WARP)
+        {
+            continue;
+        }
+
+        // NULL 드라이버는 BGRA/디버그 플래그를 지원하지 않을 수 있으므로 플래그 없이도 한 번 더 시도
+        const UINT FlagCandidates[] = { D3D11_CREATE_DEVICE_BGRA_SUPPORT, 0 };
+        for (UINT Flags : FlagCandidates)
+        {
+            HRESULT hr = D3D11CreateDevice(nullptr, Candidate.Type, nullptr, Flags,
+                featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION,
+                &Device, nullptr, &DeviceContext);
+            if (SUCCEEDED(hr))
+            {
+                DriverName = Candidate.Name;
+                return true;
+            }
+        }
+    }
+
+    UE_LOG("[RHI] Failed to create a headless D3D11 device");
+    return false;
+}
+
+void D3D11RHI::GetFrameBufferSize(UINT& OutWidth, UINT& OutHeight) const
+{
+    if (bHeadless)
+    {
+        OutWidth = HeadlessWidth;
+        OutHeight = HeadlessHeight;
+        return;
+    }
+
     DXGI_SWAP_CHAIN_DESC swapDesc;
     SwapChain->GetDesc(&swapDesc);
+    OutWidth = swapDesc.BufferDesc.Width;
+    OutHeight = swapDesc.BufferDesc.Height;
+}
+
+void D3D11RHI::CreateFrameBuffer()
+{
+    UINT BufferWidth = 0, BufferHeight = 0;
+    GetFrameBufferSize(BufferWidth, BufferHeight);
 
-    // 백 버퍼 가져오기
-    SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    if (bHeadless)
+    {
+        // 스왑체인 백버퍼와 같은 포맷의 오프스크린 텍스처
+        D3D11_TEXTURE2D_DESC BackBufferDesc = {};
+        BackBufferDesc.Width = BufferWidth;
+        BackBufferDesc.Height = BufferHeight;
+        BackBufferDesc.MipLevels = 1;
+        BackBufferDesc.ArraySize = 1;
+        BackBufferDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+        BackBufferDesc.SampleDesc.Count = 1;
+        BackBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        BackBufferDesc.BindFlags = D3D11_BIND_RENDER_TARGET;
+        Device->CreateTexture2D(&BackBufferDesc, nullptr, &FrameBuffer);
+    }
+    else
+    {
+        // 백 버퍼 가져오기
+        SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    }
 
     // 렌더 타겟 뷰 생성
     D3D11_RENDER_TARGET_VIEW_DESC framebufferRTVdesc = {};
@@ -539,8 +653,8 @@ void D3D11RHI::CreateFrameBuffer()
     // =====================================
 
     D3D11_TEXTURE2D_DESC SceneColorDesc = {};
-    SceneColorDesc.Width = swapDesc.BufferDesc.Width;
-    SceneColorDesc.Height = swapDesc.BufferDesc.Height;
+    SceneColorDesc.Width = BufferWidth;
+    SceneColorDesc.Height = BufferHeight;
     SceneColorDesc.MipLevels = 1;
     SceneColorDesc.ArraySize = 1;
     SceneColorDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;  // 색상 포맷
@@ -561,8 +675,8 @@ void D3D11RHI::CreateFrameBuffer()
     // =====================================
 
     D3D11_TEXTURE2D_DESC depthDesc = {};
-    depthDesc.Width = swapDesc.BufferDesc.Width;
-    depthDesc.Height = swapDesc.BufferDesc.Height;
+    depthDesc.Width = BufferWidth;
+    depthDesc.Height = BufferHeight;
     depthDesc.MipLevels = 1;
     depthDesc.ArraySize = 1;
     depthDesc.Format = DXGI_FORMAT_R24G8_TYPELESS; // Typeless 포맷으로 변경
@@ -593,16 +707,15 @@ void D3D11RHI::CreateFrameBuffer()
 
 void D3D11RHI::CreateIdBuffer()
 {
-
-    DXGI_SWAP_CHAIN_DESC SwapDesc;
-    SwapChain->GetDesc(&SwapDesc);
+    UINT BufferWidth = 0, BufferHeight = 0;
+    GetFrameBufferSize(BufferWidth, BufferHeight);
 
     D3D11_TEXTURE2D_DESC TextureDesc{};
     TextureDesc.Format = DXGI_FORMAT_R32_UINT;
     TextureDesc.CPUAccessFlags = 0;
     TextureDesc.Usage = D3D11_USAGE_DEFAULT;
-    TextureDesc.Width = SwapDesc.BufferDesc.Width;
-    TextureDesc.Height = SwapDesc.BufferDesc.Height;
+    TextureDesc.Width = BufferWidth;
+    TextureDesc.Height = BufferHeight;
     TextureDesc.MipLevels = 1;
     TextureDesc.ArraySize = 1;
     TextureDesc.SampleDesc.Count = 1;
@@ -790,7 +903,7 @@ void D3D11RHI::ReleaseFrameBuffer()
         BackBufferRTV = nullptr;
     }
 
-    // FrameBuffer는 SwapChain에서 GetBuffer()로 가져온 것이므로 Release 필요
+    // FrameBuffer는 SwapChain에서 GetBuffer()로 가져온 것이므로 Release 필요 (헤드리스면 직접 만든 텍스처)
     if (FrameBuffer)
     {
         FrameBuffer->Release();
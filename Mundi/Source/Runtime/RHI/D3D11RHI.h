@@ -54,6 +54,11 @@ public:
 
 public:
 	void Initialize(HWND hWindow);
+	// 창/스왑체인 없이 초기화 (헤드리스 러너). 백버퍼는 Width x Height 오프스크린 텍스처
+	// NULL 드라이버(DirectX SDK 디버그 레이어 필요)를 먼저 시도하고, 없거나 bForceWarp면 WARP
+	bool InitializeHeadless(UINT Width, UINT Height, bool bForceWarp = false);
+	bool IsHeadless() const { return bHeadless; }
+	const char* GetDriverName() const { return DriverName; }
 
 	void Release();
 
@@ -179,6 +184,9 @@ public:
 
 private:
 	void CreateDeviceAndSwapChain(HWND hWindow); // 여기서 디바이스, 디바이스 컨택스트, 스왑체인, 뷰포트를 초기화한다
+	bool CreateHeadlessDevice(bool bForceWarp);
+	// 스왑체인 백버퍼 크기 (헤드리스면 오프스크린 백버퍼 크기)
+	void GetFrameBufferSize(UINT& OutWidth, UINT& OutHeight) const;
 	void CreateFrameBuffer();
 	void CreateIdBuffer();
 	void CreateRasterizerState();
@@ -208,6 +216,11 @@ private:
 	ID3D11DeviceContext* DeviceContext{};//
 	IDXGISwapChain* SwapChain{};//
 
+	bool bHeadless = false;
+	UINT HeadlessWidth = 0;
+	UINT HeadlessHeight = 0;
+	const char* DriverName = "Hardware";
+
 	ID3D11RasterizerState* DefaultRasterizerState{};//
 	ID3D11RasterizerState* WireFrameRasterizerState{};//
 	ID3D11RasterizerState* DecalRasterizerState{};//
@@ -356,10 +369,27 @@ inline HRESULT D3D11RHI::CreateVertexBuffer<FVertexSimple>(ID3D11Device* device,
 }
 
 // PositionColorTextureNormal
+// FVertexDynamic은 FNormalVertex와 메모리 레이아웃이 같으므로 변환 배열 없이 원본(캐시에서 읽은 정점 배열)을 그대로 올린다
 template<>
 inline HRESULT D3D11RHI::CreateVertexBuffer<FVertexDynamic>(ID3D11Device* device, const std::vector<FNormalVertex>& srcVertices, ID3D11Buffer** outBuffer)
 {
-	return CreateVertexBufferImpl<FVertexDynamic>(device, srcVertices, outBuffer, D3D11_USAGE_DEFAULT, 0);
+	static_assert(sizeof(FVertexDynamic) == sizeof(FNormalVertex) &&
+		offsetof(FVertexDynamic, Normal) == offsetof(FNormalVertex, normal) &&
+		offsetof(FVertexDynamic, UV) == offsetof(FNormalVertex, tex) &&
+		offsetof(FVertexDynamic, Tangent) == offsetof(FNormalVertex, Tangent) &&
+		offsetof(FVertexDynamic, Color) == offsetof(FNormalVertex, color),
+		"FVertexDynamic must mirror FNormalVertex for direct upload");
+
+	D3D11_BUFFER_DESC vbd = {};
+	vbd.Usage = D3D11_USAGE_DEFAULT;
+	vbd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	vbd.CPUAccessFlags = 0;
+	vbd.ByteWidth = static_cast<UINT>(sizeof(FVertexDynamic) * srcVertices.size());
+
+	D3D11_SUBRESOURCE_DATA vinitData = {};
+	vinitData.pSysMem = srcVertices.data();
+
+	return device->CreateBuffer(&vbd, &vinitData, outBuffer);
 }
 
 // Billboard
@@ -8,6 +8,9 @@
 
 #define NUM_POINT_LIGHT_MAX 256
 #define NUM_SPOT_LIGHT_MAX 256
+
+DEFINE_LOG_CATEGORY_STATIC(LogShadow, Log)
+
 FLightManager::~FLightManager()
 {
 	Release();
@@ -539,7 +542,7 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 }
 
 // 단순한 아틀라스 로직
-void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
+void FLightManager::AllocateAtlasRegions2D(TFrameArray<FShadowRenderRequest>& InOutRequests2D)
 {
 	// 요청 정렬 (가장 큰 것부터)
 	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
@@ -548,6 +551,7 @@ void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRe
 	uint32 CurrentAtlasX = 0;
 	uint32 CurrentAtlasY = 0;
 	uint32 CurrentShelfMaxHeight = 0;
+	int32 NumRejected = 0;
 
 	for (FShadowRenderRequest& Request : InOutRequests2D)
 	{
@@ -560,7 +564,7 @@ void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRe
 		if (CurrentAtlasY + Request.Size > ShadowAtlasSize2D)
 		{
 			Request.Size = 0; // 꽉 참 (렌더링 실패)
-			UE_LOG("그림자 맵 아틀라스가 가득차서 더 이상 그림자를 추가할 수 없습니다.");
+			++NumRejected;
 			continue;
 		}
 
@@ -577,9 +581,15 @@ void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRe
 		CurrentAtlasX += Request.Size;
 		CurrentShelfMaxHeight = FMath::Max(CurrentShelfMaxHeight, Request.Size);
 	}
+
+	// 실패한 요청마다가 아니라 프레임당 한 줄 (반복은 호출 지점 제한에 걸린다)
+	if (NumRejected > 0)
+	{
+		UE_LOG_CAT(LogShadow, Warning, "그림자 맵 아틀라스가 가득차서 그림자 %d개를 추가할 수 없습니다.", NumRejected);
+	}
 }
 
-void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
+void FLightManager::AllocateAtlasCubeSlices(TFrameArray<FShadowRenderRequest>& InOutRequestsCube)
 {
 	// 슬라이스 개수가 유효하지 않으면 모든 요청 실패 처리
 	if (CubeArrayCount == 0)
@@ -151,8 +151,8 @@ public:
     void ClearAllDepthStencilView(D3D11RHI* RHIDevice);
     ID3D11RenderTargetView* GetVSMShadowAtlasRTV2D() const { return VSMShadowAtlasRTV2D; }
 
-    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
-    void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
+    void AllocateAtlasRegions2D(TFrameArray<FShadowRenderRequest>& InOutRequests2D);
+    void AllocateAtlasCubeSlices(TFrameArray<FShadowRenderRequest>& InOutRequestsCube);
 
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
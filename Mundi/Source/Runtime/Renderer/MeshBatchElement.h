@@ -62,6 +62,12 @@ struct FMeshBatchElement
 	// (기본값으로 흰색(1,1,1,1)을 설정하는 것이 일반적입니다.)
 	FLinearColor InstanceColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
+	// 하드웨어 인스턴싱용 정점 버퍼 (IA 슬롯 1). InstanceCount가 0이면 일반 DrawIndexed
+	ID3D11Buffer* InstanceBuffer = nullptr;
+	uint32 InstanceStride = 0;
+	uint32 InstanceCount = 0;
+	uint32 StartInstance = 0;
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
@@ -19,8 +19,10 @@ void FFadeInOutPass::Execute(const FPostProcessModifier& M, FSceneView* View, D3
     RHIDevice->OMSetBlendState(false); // 전화면 덮어쓰기. 필요 시 true + 알파 블렌딩도 가능
 
     // 3) 셰이더
-    UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-    UShader* FadeInoutPS = UResourceManager::GetInstance().Load<UShader>("Shaders/PostProcess/FadeInOut_PS.hlsl");
+    static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+    UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+    static const TResourceHandle<UShader> FadeInoutPSHandle("Shaders/PostProcess/FadeInOut_PS.hlsl");
+    UShader* FadeInoutPS = FadeInoutPSHandle.Get();
     if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader()|| !FadeInoutPS || !FadeInoutPS->GetPixelShader())
     {
         UE_LOG("FadeInout용 셰이더 없음!\n");
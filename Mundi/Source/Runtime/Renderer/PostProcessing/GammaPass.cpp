@@ -19,8 +19,10 @@ void FGammaPass::Execute(const FPostProcessModifier& M, FSceneView* View, D3D11R
     RHIDevice->OMSetBlendState(false); // 전화면 덮어쓰기. 필요 시 true + 알파 블렌딩도 가능
 
     // 3) 셰이더
-    UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-    UShader* GammaPS = UResourceManager::GetInstance().Load<UShader>("Shaders/PostProcess/GammaCorrection_PS.hlsl");
+    static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+    UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+    static const TResourceHandle<UShader> GammaPSHandle("Shaders/PostProcess/GammaCorrection_PS.hlsl");
+    UShader* GammaPS = GammaPSHandle.Get();
     if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !GammaPS || !GammaPS->GetPixelShader())
     {
         UE_LOG("Gamma용 셰이더 없음!\n");
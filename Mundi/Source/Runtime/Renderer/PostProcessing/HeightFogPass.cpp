@@ -17,8 +17,10 @@ void FHeightFogPass::Execute(const FPostProcessModifier& M, FSceneView* View, D3
     RHIDevice->OMSetBlendState(false);
 
     // 3) 셰이더
-    UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-    UShader* HeightFogPS = UResourceManager::GetInstance().Load<UShader>("Shaders/PostProcess/HeightFog_PS.hlsl");
+    static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+    UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+    static const TResourceHandle<UShader> HeightFogPSHandle("Shaders/PostProcess/HeightFog_PS.hlsl");
+    UShader* HeightFogPS = HeightFogPSHandle.Get();
     if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !HeightFogPS || !HeightFogPS->GetPixelShader())
     {
         UE_LOG("HeightFog용 셰이더 없음!\n");
@@ -19,8 +19,10 @@ void FVignettePass::Execute(const FPostProcessModifier& M, FSceneView* View, D3D
     RHIDevice->OMSetBlendState(false); // 전화면 덮어쓰기. 필요 시 true + 알파 블렌딩도 가능
 
     // 3) 셰이더
-    UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-    UShader* VignettePS = UResourceManager::GetInstance().Load<UShader>("Shaders/PostProcess/Vignette_PS.hlsl");
+    static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+    UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+    static const TResourceHandle<UShader> VignettePSHandle("Shaders/PostProcess/Vignette_PS.hlsl");
+    UShader* VignettePS = VignettePSHandle.Get();
     if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader()||!VignettePS || !VignettePS->GetPixelShader())
     {
         UE_LOG("Vinette용 셰이더 없음!\n");
@@ -40,6 +40,17 @@ public:
     void SetShadowAATechnique(EShadowAATechnique In) { ShadowAATechnique = In; }
     EShadowAATechnique GetShadowAATechnique() const { return ShadowAATechnique; }
 
+    // 메시 LOD (자동 생성 LOD가 있는 스태틱/스켈레탈 메시)
+    void SetForcedLOD(int32 Value) { ForcedLOD = Value; }
+    int32 GetForcedLOD() const { return ForcedLOD; }
+
+    void SetLODHysteresis(float Value) { LODHysteresis = Value; }
+    float GetLODHysteresis() const { return LODHysteresis; }
+
+    // CPU 스키닝 입력을 압축 정점 스트림(FQuantizedSkinnedVertex)으로
+    void SetQuantizedSkinning(bool bEnable) { bQuantizedSkinning = bEnable; }
+    bool IsQuantizedSkinningEnabled() const { return bQuantizedSkinning; }
+
 private:
     EEngineShowFlags ShowFlags = EEngineShowFlags::SF_DefaultEnabled;
     EViewMode ViewMode = EViewMode::VMI_Lit_Phong;
@@ -55,4 +66,11 @@ private:
 
     // 그림자 안티 에일리어싱
     EShadowAATechnique ShadowAATechnique = EShadowAATechnique::PCF; // 기본값 PCF
+
+    // 메시 LOD
+    int32 ForcedLOD = -1;                   // 모든 메시를 이 LOD로 고정 (-1이면 화면 크기로 선택)
+    float LODHysteresis = 0.1f;             // LOD 전환 경계를 현재 LOD 쪽으로 넓히는 비율 (경계에서 깜빡임 방지)
+
+    // CPU 스키닝
+    bool bQuantizedSkinning = false;        // 정점당 80 대신 28 bytes를 읽는다 (위치/법선/가중치 양자화 오차가 생김)
 };
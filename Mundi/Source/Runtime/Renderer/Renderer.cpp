@@ -62,10 +62,22 @@ void URenderer::BeginFrame()
 void URenderer::EndFrame()
 {
 	RHIDevice->Present();
+
+	// 이번 프레임의 렌더링 임시 데이터 정리 (FSceneRenderer 수집 목록 등)
+	FFrameArena::Get().EndFrame();
+
+	// 프레임 경계: 스탯 누적을 넘기고 트레이스 캡처 프레임 수를 센다
+	FProfiler::EndFrame();
 }
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
+	// FSceneView는 매 프레임 새로 만들어지므로 뷰포트(없으면 월드별 렌더 설정)로 뷰를 식별
+	if (View && !View->ViewStateKey)
+	{
+		View->ViewStateKey = Viewport ? static_cast<const void*>(Viewport) : static_cast<const void*>(View->RenderSettings);
+	}
+
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
 	FSceneRenderer SceneRenderer(World, View, this);
 
@@ -218,18 +230,14 @@ void URenderer::AddLinesRange(const TArray<FVector>& Lines, int startIdx, int Co
 	}
 }
 
-void URenderer::AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors)
+void URenderer::AddLines(const FVector* StartPoints, const FVector* EndPoints, const FVector4* Colors, int32 NumLines)
 {
-	if (!bLineBatchActive || !LineBatchData) return;
-
-	// Validate input arrays have same size
-	if (StartPoints.size() != EndPoints.size() || StartPoints.size() != Colors.size())
-		return;
+	if (!bLineBatchActive || !LineBatchData || NumLines <= 0) return;
 
 	uint32 startIndex = static_cast<uint32>(LineBatchData->Vertices.size());
 
 	// Reserve space for efficiency
-	size_t lineCount = StartPoints.size();
+	size_t lineCount = static_cast<size_t>(NumLines);
 	LineBatchData->Vertices.reserve(LineBatchData->Vertices.size() + lineCount * 2);
 	LineBatchData->Color.reserve(LineBatchData->Color.size() + lineCount * 2);
 	LineBatchData->Indices.reserve(LineBatchData->Indices.size() + lineCount * 2);
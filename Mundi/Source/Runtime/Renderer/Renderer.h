@@ -39,7 +39,16 @@ public:
 	void AddLine(const FVector& Start, const FVector& End, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
 	void AddLines(const TArray<FVector>& Lines, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
 	void AddLinesRange(const TArray<FVector>& Lines,int startIdx, int Count, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
-	void AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors);
+	void AddLines(const FVector* StartPoints, const FVector* EndPoints, const FVector4* Colors, int32 NumLines);
+	// 할당기가 다른 TArray(TInlineAllocator 등)도 그대로 받는다
+	template<typename StartAllocator, typename EndAllocator, typename ColorAllocator>
+	void AddLines(const TArray<FVector, StartAllocator>& StartPoints, const TArray<FVector, EndAllocator>& EndPoints, const TArray<FVector4, ColorAllocator>& Colors)
+	{
+		// Validate input arrays have same size
+		if (StartPoints.size() != EndPoints.size() || StartPoints.size() != Colors.size())
+			return;
+		AddLines(StartPoints.GetData(), EndPoints.GetData(), Colors.GetData(), StartPoints.Num());
+	}
 	void EndLineBatch(const FMatrix& ModelMatrix);
 	void ClearLineBatch();
 
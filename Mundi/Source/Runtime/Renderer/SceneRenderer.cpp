@@ -40,6 +40,7 @@
 #include "SceneView.h"
 #include "Shader.h"
 #include "ResourceManager.h"
+#include "ProjectileManager.h"
 #include "../RHI/ConstantBufferType.h"
 #include <chrono>
 #include "TileLightCuller.h"
@@ -77,7 +78,9 @@ void FSceneRenderer::Render()
 	// 뷰(View) 준비: 행렬, 절두체 등 프레임에 필요한 기본 데이터 계산
 	PrepareView();
 	// 렌더링할 대상 수집 (Cull + Gather)
+	TIME_PROFILE(GatherVisibleProxies)
 	GatherVisibleProxies();
+	TIME_PROFILE_END(GatherVisibleProxies)
 
 	TIME_PROFILE(ShadowMapPass)
 	RenderShadowMaps();
@@ -261,7 +264,7 @@ void FSceneRenderer::RenderShadowMaps()
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
-	TArray<FMeshBatchElement> ShadowMeshBatches;
+	TFrameArray<FMeshBatchElement> ShadowMeshBatches;
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
@@ -297,8 +300,8 @@ void FSceneRenderer::RenderShadowMaps()
 	);
 
 	// 1.2. 2D 섀도우 요청 수집
-	TArray<FShadowRenderRequest> Requests2D;
-	TArray<FShadowRenderRequest> RequestsCube;
+	TFrameArray<FShadowRenderRequest> Requests2D;
+	TFrameArray<FShadowRenderRequest> RequestsCube;
 	for (UDirectionalLightComponent* Light : LightManager->GetDirectionalLightList())
 	{
 		Light->GetShadowRenderRequests(View, Requests2D);
@@ -545,17 +548,19 @@ void FSceneRenderer::RenderShadowMaps()
 	}
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<FMeshBatchElement>& InShadowBatches)
 {
 	// 1. 뎁스 전용 셰이더 로드
-	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
+	static const TResourceHandle<UShader> DepthVSHandle("Shaders/Shadows/DepthOnly_VS.hlsl");
+	UShader* DepthVS = DepthVSHandle.Get();
 	if (!DepthVS || !DepthVS->GetVertexShader()) return;
 
 	FShaderVariant* ShaderVariant = DepthVS->GetOrCompileShaderVariant();
 	if (!ShaderVariant) return;
 
 	// vsm용 픽셀 셰이더
-	UShader* DepthPs = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_PS.hlsl");
+	static const TResourceHandle<UShader> DepthPsHandle("Shaders/Shadows/DepthOnly_PS.hlsl");
+	UShader* DepthPs = DepthPsHandle.Get();
 	if (!DepthPs || !DepthPs->GetPixelShader()) return;
 
 	FShaderVariant* ShaderVarianVSM = DepthPs->GetOrCompileShaderVariant();
@@ -977,6 +982,12 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 		BillboardComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
 
+	// 데이터 지향 발사체 (그룹당 인스턴스 드로우 1회)
+	if (FProjectileManager* ProjectileManager = World->GetProjectileManager())
+	{
+		ProjectileManager->CollectMeshBatches(MeshBatchElements, View);
+	}
+
 	for (UTextRenderComponent* TextRenderComponent : Proxies.Texts)
 	{
 		// TODO: UTextRenderComponent도 CollectMeshBatches를 통해 FMeshBatchElement를 생성하도록 구현
@@ -984,7 +995,9 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
+	TIME_PROFILE(SortMeshBatches)
 	MeshBatchElements.Sort();
+	TIME_PROFILE_END(SortMeshBatches)
 
 	// --- 3. 그리기 (Draw) ---
 	DrawMeshBatches(MeshBatchElements, true);
@@ -1010,12 +1023,10 @@ void FSceneRenderer::RenderDecalPass()
 	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num());	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
 	FDecalStatManager::GetInstance().AddVisibleDecalCount(Proxies.Decals.Num());	// 그릴 Decal 개수 수집
 
-	// ViewMode에 따라 조명 모델 매크로 설정
-	FString ShaderPath = "Shaders/Effects/Decal.hlsl";
-
-	// ViewMode에 따른 Decal 셰이더 로드
+	// ViewMode에 따른 Decal 셰이더 로드 (경로는 한 번만 정규화/해시, 조명 모델 매크로로 변형 선택)
+	static const FResourcePath ShaderPath("Shaders/Effects/Decal.hlsl");
 	UShader* DecalShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath, View->ViewShaderMacros);
-	FShaderVariant* ShaderVariant = DecalShader->GetOrCompileShaderVariant(View->ViewShaderMacros);
+	FShaderVariant* ShaderVariant = DecalShader ? DecalShader->GetOrCompileShaderVariant(View->ViewShaderMacros) : nullptr;
 	if (!DecalShader || !ShaderVariant)
 	{
 		UE_LOG("RenderDecalPass: Failed to load Decal shader with ViewMode macros!");
@@ -1035,7 +1046,7 @@ void FSceneRenderer::RenderDecalPass()
 		}
 
 		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
+		TFrameArray<UPrimitiveComponent*> TargetPrimitives;
 
 		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
 		const FOBB DecalOBB = Decal->GetWorldOBB();
@@ -1161,8 +1172,10 @@ void FSceneRenderer::RenderSceneDepthPostProcess()
 	RHIDevice->OMSetBlendState(false);
 
 	// 쉐이더 설정
-	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-	UShader* SceneDepthPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/SceneDepth_PS.hlsl");
+	static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+	UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+	static const TResourceHandle<UShader> SceneDepthPSHandle("Shaders/Utility/SceneDepth_PS.hlsl");
+	UShader* SceneDepthPS = SceneDepthPSHandle.Get();
 	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !SceneDepthPS || !SceneDepthPS->GetPixelShader())
 	{
 		UE_LOG("HeightFog용 셰이더 없음!\n");
@@ -1222,8 +1235,10 @@ void FSceneRenderer::RenderTileCullingDebug()
 	RHIDevice->OMSetBlendState(false);
 
 	// 셰이더 설정
-	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-	UShader* TileDebugPS = UResourceManager::GetInstance().Load<UShader>("Shaders/PostProcess/TileDebugVisualization_PS.hlsl");
+	static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+	UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+	static const TResourceHandle<UShader> TileDebugPSHandle("Shaders/PostProcess/TileDebugVisualization_PS.hlsl");
+	UShader* TileDebugPS = TileDebugPSHandle.Get();
 	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !TileDebugPS || !TileDebugPS->GetPixelShader())
 	{
 		UE_LOG("TileDebugVisualization 셰이더 없음!\n");
@@ -1413,7 +1428,7 @@ void FSceneRenderer::RenderOverayEditorPrimitivesPass()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
@@ -1565,7 +1580,18 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
 
 		// 5. 드로우 콜 실행
-		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		if (Batch.InstanceCount > 0 && Batch.InstanceBuffer)
+		{
+			// 인스턴스 버퍼는 배치마다 달라질 수 있어 캐싱하지 않음 (슬롯 0 캐시와 독립)
+			UINT InstanceStride = Batch.InstanceStride;
+			UINT InstanceOffset = 0;
+			RHIDevice->GetDeviceContext()->IASetVertexBuffers(1, 1, &Batch.InstanceBuffer, &InstanceStride, &InstanceOffset);
+			RHIDevice->GetDeviceContext()->DrawIndexedInstanced(Batch.IndexCount, Batch.InstanceCount, Batch.StartIndex, Batch.BaseVertexIndex, Batch.StartInstance);
+		}
+		else
+		{
+			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		}
 	}
 
 	// 루프 종료 후 리스트 비우기 (옵션)
@@ -1605,8 +1631,10 @@ void FSceneRenderer::ApplyScreenEffectsPass()
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &SourceSRV);
 	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, &SamplerState);
 
-	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-	UShader* CopyTexturePS = UResourceManager::GetInstance().Load<UShader>("Shaders/PostProcess/FXAA_PS.hlsl");
+	static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+	UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+	static const TResourceHandle<UShader> CopyTexturePSHandle("Shaders/PostProcess/FXAA_PS.hlsl");
+	UShader* CopyTexturePS = CopyTexturePSHandle.Get();
 	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !CopyTexturePS || !CopyTexturePS->GetPixelShader())
 	{
 		UE_LOG("FXAA 셰이더 없음!\n");
@@ -1669,8 +1697,10 @@ void FSceneRenderer::CompositeToBackBuffer()
 	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, &SamplerState);
 
 	// 5. 셰이더 준비
-	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
-	UShader* BlitPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/Blit_PS.hlsl");
+	static const TResourceHandle<UShader> FullScreenTriangleVSHandle("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+	UShader* FullScreenTriangleVS = FullScreenTriangleVSHandle.Get();
+	static const TResourceHandle<UShader> BlitPSHandle("Shaders/Utility/Blit_PS.hlsl");
+	UShader* BlitPS = BlitPSHandle.Get();
 	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !BlitPS || !BlitPS->GetPixelShader())
 	{
 		UE_LOG("Blit용 셰이더 없음!\n");
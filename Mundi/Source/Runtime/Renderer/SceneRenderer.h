@@ -32,35 +32,36 @@ class ULineComponent;
 struct FCandidateDrawable;
 
 // 렌더링할 대상들의 집합을 담는 구조체
+// 수집 목록은 모두 프레임 아레나에서 할당 (FSceneRenderer와 함께 프레임 안에서만 산다)
 struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
-	TArray<UMeshComponent*> Meshes;
-	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
-	TArray<UDecalComponent*> Decals;
-	TArray<UTextRenderComponent*> Texts;
+	TFrameArray<UMeshComponent*> Meshes;
+	TFrameArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
+	TFrameArray<UDecalComponent*> Decals;
+	TFrameArray<UTextRenderComponent*> Texts;
 
 	// --- Type 2: In-Scene Editor (PP X, Depth-Test O) ---
-	TArray<ULineComponent*> EditorLines;	// 그리드
-	TArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
+	TFrameArray<ULineComponent*> EditorLines;	// 그리드
+	TFrameArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
 
 	// --- Type 3: Overlay (PP X, Depth-Test X) ---
-	TArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
+	TFrameArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
 };
 
 struct FSceneLocals
 {
-	TArray<UPointLightComponent*> PointLights;
-	TArray<USpotLightComponent*> SpotLights;
+	TFrameArray<UPointLightComponent*> PointLights;
+	TFrameArray<USpotLightComponent*> SpotLights;
 };
 
 // NOTE: 추후 UWorld로 이동해서 등록/해지 방식으로 변경?
 // 전역 효과 및 설정을 담는 구조체
 struct FSceneGlobals
 {
-	TArray<UDirectionalLightComponent*> DirectionalLights;
-	TArray<UAmbientLightComponent*> AmbientLights;
-	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
+	TFrameArray<UDirectionalLightComponent*> DirectionalLights;
+	TFrameArray<UAmbientLightComponent*> AmbientLights;
+	TFrameArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
 };
 
 /**
@@ -83,7 +84,7 @@ private:
 	void RenderSceneDepthPath();
 
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<FMeshBatchElement>& InShadowBatches);
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -103,7 +104,7 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	void DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
 
 	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
 	void RenderDecalPass();
@@ -141,10 +142,10 @@ private:
 	FSceneGlobals SceneGlobals;
 
 	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
-	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	TFrameArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
-	TArray<FMeshBatchElement> MeshBatchElements;
+	TFrameArray<FMeshBatchElement> MeshBatchElements;
 
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
@@ -80,6 +80,19 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 	ViewShaderMacros = CreateViewShaderMacros();
 }
 
+float FSceneView::ComputeScreenSize(const FVector& Center, float Radius) const
+{
+	// 투영 행렬의 Y 스케일: 원근이면 1 / tan(FovY / 2), 직교면 2 / 화면 높이(월드 단위)
+	const float YScale = ProjectionMatrix.M[1][1];
+	if (ProjectionMode == ECameraProjectionMode::Orthographic)
+	{
+		return Radius * YScale;
+	}
+
+	const float Distance = std::max((Center - ViewLocation).Size(), KINDA_SMALL_NUMBER);
+	return Radius * YScale / Distance;
+}
+
 TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
 {
 	TArray<FShaderMacro> ShaderMacros;
@@ -49,6 +49,9 @@ public:
     FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InRenderSettings);
     FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URenderSettings* InRenderSettings);
 
+    // 바운드 구(Center, Radius)의 지름이 화면 높이에서 차지하는 비율 (LOD 선택용, 1이면 화면을 꽉 채움)
+    float ComputeScreenSize(const FVector& Center, float Radius) const;
+
 private:
     TArray<FShaderMacro> CreateViewShaderMacros();
 
@@ -81,4 +84,7 @@ public:
      * 외부(Widget 등)에서 이미 RenderTarget을 설정한 경우 사용합니다.
      */
     bool bUseExternalRenderTarget = false;
+
+    // 프레임이 바뀌어도 같은 뷰임을 식별하는 키 (뷰별 LOD 히스테리시스 등). URenderer::RenderSceneForView가 뷰포트로 채운다
+    const void* ViewStateKey = nullptr;
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 IMPLEMENT_CLASS(UGlobalConsole)
 
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
+uint64 UGlobalConsole::ConsoleSequence = 0;
 
 void UGlobalConsole::Initialize()
 {
@@ -13,6 +14,7 @@ void UGlobalConsole::Initialize()
 void UGlobalConsole::Shutdown()
 {
     ConsoleWidget = nullptr;
+    FLog::Shutdown();
 }
 
 void UGlobalConsole::SetConsoleWidget(UConsoleWidget* InConsoleWidget)
@@ -33,33 +35,33 @@ UConsoleWidget* UGlobalConsole::GetConsoleWidget()
     return ConsoleWidget;
 }
 
+void UGlobalConsole::UpdateConsoleWidget()
+{
+    if (!ConsoleWidget)
+    {
+        return;
+    }
+
+    TArray<FString> Lines;
+    FLog::ReadConsoleLines(ConsoleSequence, Lines);
+    for (const FString& Line : Lines)
+    {
+        ConsoleWidget->AddLogLine(Line);
+    }
+}
+
 void UGlobalConsole::Log(const char* fmt, ...)
 {
-#ifdef _EDITOR
     va_list args;
     va_start(args, fmt);
     LogV(fmt, args);
     va_end(args);
-#endif
 }
 
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
-#ifdef _EDITOR
-    // if (ConsoleWidget)
-    // {
-    //     ConsoleWidget->VAddLog(fmt, args);
-    // }
-    // else
-    // {
-        // Fallback to OutputDebugString if console widget not available
-        char tmp[1024];
-        vsnprintf_s(tmp, _countof(tmp), fmt, args);
-        OutputDebugStringA("[No Console] ");
-        OutputDebugStringA(tmp);
-        OutputDebugStringA("\n");
-    // }
-#endif
+    // 타입 정보가 없으므로 호출 스레드에서 서식화한 뒤 로그 스레드로 넘긴다
+    FLog::WriteV(LogTemp, ELogVerbosity::Log, fmt, args);
 }
 
 // Global C functions for compatibility
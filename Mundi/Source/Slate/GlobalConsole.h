@@ -2,6 +2,7 @@
 #include <cstdarg>
 #include <iostream>
 #include "Object.h"
+#include "Logging.h"
 
 class UConsoleWidget;
 
@@ -25,13 +26,20 @@ public:
     static void Log(const char* fmt, ...);
     static void LogV(const char* fmt, va_list args);
 
+    // 빌드 구성과 관계없이 로그를 stdout에도 출력 (헤드리스 실행)
+    static void SetEchoToStdOut(bool bInEcho) { FLog::SetEchoToStdOut(bInEcho); }
+
+    // 로그 스레드가 쌓아 둔 줄을 콘솔 위젯으로 옮긴다 (메인 스레드, 매 프레임)
+    static void UpdateConsoleWidget();
+
 private:
     static UConsoleWidget* ConsoleWidget;
+    static uint64 ConsoleSequence;
 };
 
 // Global functions for compatibility with existing code
 extern "C" void ConsoleLog(const char* fmt, ...);
 extern "C" void ConsoleLogV(const char* fmt, va_list args);
 
-// UE_LOG macro replacement
-#define UE_LOG(fmt, ...) UGlobalConsole::Log(fmt, ##__VA_ARGS__)
+// 기본 카테고리(LogTemp) 로그. 카테고리/수준을 지정하려면 UE_LOG_CAT
+#define UE_LOG(Format, ...) UE_LOG_CAT(LogTemp, Log, Format, ##__VA_ARGS__)
@@ -13,6 +13,7 @@
 #include "TileCullingStats.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "LuaStats.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -98,7 +99,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowLua) || !SwapChain)
 		return;
 
 	ID2D1Factory1* D2dFactory = nullptr;
@@ -223,18 +224,22 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		const FFrameArena& FrameArena = FFrameArena::Get();
+
+		wchar_t Buf[192];
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %llu\nFrame Arena: %.1f KB (Peak %.1f KB)", Mb, FMemoryManager::GetTotalAllocationCount(),
+			static_cast<double>(FrameArena.GetLastFrameBytes()) / 1024.0, static_cast<double>(FrameArena.GetHighWaterBytes()) / 1024.0);
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 72.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(
 			D2dCtx, Dwrite, Buf, Rc, 16.0f,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::LightGreen));
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -374,11 +379,36 @@ void UStatsOverlayD2D::Draw()
 		NextY += shadowPanelHeight + Space;
 	}
 	
+	if (bShowLua)
+	{
+		const FLuaStats& LuaStats = FLuaStatManager::GetInstance().GetStats();
+		const double ToKB = 1.0 / 1024.0;
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Lua Stats]\nUsed: %.1f KB (Peak %.1f KB)\nPool: %.1f KB  Large: %.1f KB\nAlloc/Frame: %.1f KB\nGC(%s): %u steps, %.3f ms\nGC Cycles: %u",
+			LuaStats.UsedBytes * ToKB,
+			LuaStats.PeakBytes * ToKB,
+			LuaStats.PoolReservedBytes * ToKB,
+			LuaStats.LargeBytes * ToKB,
+			LuaStats.FrameAllocatedBytes * ToKB,
+			LuaStats.bGenerational ? L"Gen" : L"Inc",
+			LuaStats.GCStepsThisFrame,
+			LuaStats.GCTimeMS,
+			LuaStats.GCCyclesCompleted);
+
+		const float LuaPanelHeight = 140.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + LuaPanelHeight);
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Gold));
+
+		NextY += LuaPanelHeight + Space;
+	}
+
 	D2dCtx->EndDraw();
 	D2dCtx->SetTarget(nullptr);
 
-	FScopeCycleCounter::TimeProfileInit();
-
 
 	SafeRelease(TargetBmp);
 	SafeRelease(Dwrite);
@@ -458,3 +488,13 @@ void UStatsOverlayD2D::ToggleShadow()
 {
 	bShowShadow = !bShowShadow;
 }
+
+void UStatsOverlayD2D::SetShowLua(bool b)
+{
+	bShowLua = b;
+}
+
+void UStatsOverlayD2D::ToggleLua()
+{
+	bShowLua = !bShowLua;
+}
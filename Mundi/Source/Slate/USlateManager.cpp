@@ -222,6 +222,8 @@ void USlateManager::Render()
 void USlateManager::Update(float DeltaTime)
 {
     ProcessInput();
+    // 로그 스레드가 처리한 줄을 콘솔 창으로
+    UGlobalConsole::UpdateConsoleWidget();
     // MainToolbar 업데이트
     MainToolbar->Update(DeltaTime);
 
@@ -4,12 +4,34 @@
 #include "GlobalConsole.h"
 #include "StatsOverlayD2D.h"
 #include "USlateManager.h"
+#include "LuaManager.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "MemoryManager.h"
+#include "ProjectileManager.h"
+#include "ParallelFor.h"
+#include "CookedLevel.h"
+#include "VectorSoA.h"
+#include "ObjManager.h"
+#include "MeshCache.h"
+#include "ResourceManager.h"
+#include "TextureConverter.h"
+#include "TextureCooker.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantization.h"
+#include "StaticMeshComponent.h"
+#include "SkeletalMeshComponent.h"
+#include "StaticMesh.h"
+#include "SkeletalMesh.h"
+#include "ObjectIterator.h"
+#include "PlatformTime.h"
 #include "ImGui/imgui_internal.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
 #include <cstring>
 #include <algorithm>
+#include <filesystem>
 
 using std::max;
 using std::min;
@@ -61,6 +83,49 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("STAT LUA");
+	HelpCommandList.Add("LUA MEM");
+	HelpCommandList.Add("LUA GC");
+	HelpCommandList.Add("LUA BATCHTICK");
+	HelpCommandList.Add("LUA BENCH [ScriptPath] [Instances] [Frames]");
+	HelpCommandList.Add("BVH SWEEPBENCH [Queries] [Iterations]");
+#if MUNDI_TRACK_HEAP_ALLOCATIONS
+	HelpCommandList.Add("BVH ALLOCTEST [Queries]");
+#endif
+	HelpCommandList.Add("PROJECTILE BENCH [Count] [Frames]");
+	HelpCommandList.Add("PROJECTILE STAT");
+	HelpCommandList.Add("SCENE COOK [ScenePath]");
+	HelpCommandList.Add("SCENE VERIFY [ScenePath]");
+	HelpCommandList.Add("SCENE BENCH [Actors]");
+	HelpCommandList.Add("MEMORY STAT [Classes]");
+	HelpCommandList.Add("MEMORY BENCH [Allocations] [Rounds]");
+	HelpCommandList.Add("QUEUE BENCH [ItemsPerProducer] [MaxThreads]");
+	HelpCommandList.Add("HASH BENCH [Keys]");
+	HelpCommandList.Add("MATH BENCH [Count] [Iterations]");
+	HelpCommandList.Add("MATH SIMD [SCALAR|SSE|AVX2]");
+	HelpCommandList.Add("PROFILE TRACE [Frames] [Path]");
+	HelpCommandList.Add("PROFILE STOP");
+	HelpCommandList.Add("PROFILE BENCH [Scopes]");
+	HelpCommandList.Add("LOG LEVEL [Category] [Off|Error|Warning|Log|Verbose]");
+	HelpCommandList.Add("LOG RATE [MaxPerSecond]");
+	HelpCommandList.Add("LOG FILE [Path|OFF]");
+	HelpCommandList.Add("LOG STAT");
+	HelpCommandList.Add("LOG BENCH [Threads] [MessagesPerThread]");
+	HelpCommandList.Add("OBJ BENCH [Path] [Iterations]");
+	HelpCommandList.Add("MESHCACHE BENCH [Path] [Iterations]");
+	HelpCommandList.Add("STREAM LOAD [Path] [High|Normal|Low]");
+	HelpCommandList.Add("STREAM STAT");
+	HelpCommandList.Add("STREAM FLUSH");
+	HelpCommandList.Add("RESIDENCY STAT [Entries]");
+	HelpCommandList.Add("RESIDENCY BUDGET [MB]");
+	HelpCommandList.Add("RESIDENCY TRIM");
+	HelpCommandList.Add("TEXTURE COOK [Dir] [BC1|BC3|BC5|BC7] [FORCE]");
+	HelpCommandList.Add("MESH OPTIMIZE [Path]");
+	HelpCommandList.Add("MESH QUANTIZE [Path]");
+	HelpCommandList.Add("MESH QUANTIZE SKIN [0|1]");
+	HelpCommandList.Add("LOD STAT");
+	HelpCommandList.Add("LOD FORCE [-1|N]");
+	HelpCommandList.Add("LOD HYSTERESIS [Ratio]");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -298,13 +363,7 @@ void UConsoleWidget::AddLog(const char* fmt, ...)
 	buf[sizeof(buf) - 1] = 0;
 	va_end(args);
 
-	if (strstr(buf, "[error]") != nullptr)
-	{
-		USlateManager::GetInstance().ForceOpenConsole();
-	}
-
-	Items.Add(FString(buf));
-	ScrollToBottom = true;
+	AddLogLine(FString(buf));
 }
 
 void UConsoleWidget::VAddLog(const char* fmt, va_list args)
@@ -313,12 +372,22 @@ void UConsoleWidget::VAddLog(const char* fmt, va_list args)
 	vsnprintf_s(buf, sizeof(buf), fmt, args);
 	buf[sizeof(buf) - 1] = 0;
 
-	if (strstr(buf, "[error]") != nullptr)
+	AddLogLine(FString(buf));
+}
+
+void UConsoleWidget::AddLogLine(const FString& Line)
+{
+	if (Line.find("[error]") != FString::npos)
 	{
 		USlateManager::GetInstance().ForceOpenConsole();
 	}
 
-	Items.Add(FString(buf));
+	// 넘치면 오래된 줄을 1/4씩 한 번에 지워 줄마다 앞에서 지우는 비용을 피한다
+	if (Items.Num() >= MaxItems)
+	{
+		Items.erase(Items.begin(), Items.begin() + MaxItems / 4);
+	}
+	Items.Add(Line);
 	ScrollToBottom = true;
 }
 
@@ -373,6 +442,7 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT DECAL");
 		AddLog("- STAT ALL");
 		AddLog("- STAT LIGHT");
+		AddLog("- STAT LUA");
 		AddLog("- STAT NONE");
 	}
 	else if (Stricmp(command_line, "STAT FPS") == 0)
@@ -400,6 +470,506 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleTileCulling();
 		AddLog("STAT LIGHT TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT LUA") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleLua();
+		AddLog("STAT LUA TOGGLED");
+	}
+	else if (Stricmp(command_line, "LUA MEM") == 0)
+	{
+		if (GWorld && GWorld->GetLuaManager())
+		{
+			GWorld->GetLuaManager()->DumpMemoryReport();
+		}
+	}
+	else if (Stricmp(command_line, "LUA GC") == 0)
+	{
+		if (GWorld && GWorld->GetLuaManager())
+		{
+			GWorld->GetLuaManager()->CollectGarbage();
+			AddLog("Lua full garbage collection done");
+		}
+	}
+	else if (Stricmp(command_line, "LUA BATCHTICK") == 0)
+	{
+		if (GWorld && GWorld->GetLuaManager())
+		{
+			FLuaManager* LuaManager = GWorld->GetLuaManager();
+			LuaManager->SetBatchedTickEnabled(!LuaManager->IsBatchedTickEnabled());
+			AddLog("Lua batched tick: %s", LuaManager->IsBatchedTickEnabled() ? "ON" : "OFF");
+		}
+	}
+	else if (Strnicmp(command_line, "LUA BENCH", 9) == 0)
+	{
+		// LUA BENCH [ScriptPath] [Instances] [Frames]
+		char ScriptPath[256] = "Data/Scripts/Tile.lua";
+		int Instances = 1000;
+		int Frames = 60;
+		sscanf_s(command_line + 9, "%255s %d %d", ScriptPath, (unsigned)_countof(ScriptPath), &Instances, &Frames);
+
+		if (GWorld && GWorld->GetLuaManager())
+		{
+			GWorld->GetLuaManager()->RunTickDispatchBenchmark(ScriptPath, Instances, Frames);
+		}
+	}
+	else if (Strnicmp(command_line, "BVH SWEEPBENCH", 14) == 0)
+	{
+		// BVH SWEEPBENCH [Queries] [Iterations]
+		int Queries = 10000;
+		int Iterations = 10;
+		sscanf_s(command_line + 14, "%d %d", &Queries, &Iterations);
+
+		UWorldPartitionManager* Partition = GWorld ? GWorld->GetPartitionManager() : nullptr;
+		if (Partition && Partition->GetBVH())
+		{
+			Partition->GetBVH()->RunSweepBenchmark(Queries, Iterations);
+		}
+	}
+#if MUNDI_TRACK_HEAP_ALLOCATIONS
+	else if (Strnicmp(command_line, "BVH ALLOCTEST", 13) == 0)
+	{
+		// BVH ALLOCTEST [Queries] -> 예열된 공간 쿼리 한 프레임이 힙 할당 0회인지 검사 (힙 추적 빌드 전용)
+		int Queries = 1000;
+		sscanf_s(command_line + 13, "%d", &Queries);
+
+		UWorldPartitionManager* Partition = GWorld ? GWorld->GetPartitionManager() : nullptr;
+		if (Partition && Partition->GetBVH())
+		{
+			Partition->GetBVH()->RunAllocationTest(Queries);
+		}
+	}
+#endif
+	else if (Strnicmp(command_line, "PROJECTILE BENCH", 16) == 0)
+	{
+		// PROJECTILE BENCH [Count] [Frames]
+		int Count = 100000;
+		int Frames = 120;
+		sscanf_s(command_line + 16, "%d %d", &Count, &Frames);
+
+		UWorldPartitionManager* Partition = GWorld ? GWorld->GetPartitionManager() : nullptr;
+		FProjectileManager::RunBenchmark(Count, Frames, Partition ? Partition->GetBVH() : nullptr);
+	}
+	else if (Stricmp(command_line, "PROJECTILE STAT") == 0)
+	{
+		FProjectileManager* Projectiles = GWorld ? GWorld->GetProjectileManager() : nullptr;
+		if (Projectiles)
+		{
+			const FProjectileStats& Stats = Projectiles->GetStats();
+			AddLog("[Projectile] live %d, sweeps %d, hits %d, expired %d, draw calls %d",
+				Stats.NumLive, Stats.NumSweeps, Stats.NumHits, Stats.NumExpired, Stats.NumDrawCalls);
+			AddLog("[Projectile] simulate %.3f ms, compact %.3f ms, threads %d",
+				Stats.SimulateMS, Stats.CompactMS, FWorkerPool::GetInstance().GetConcurrency());
+		}
+	}
+	else if (Strnicmp(command_line, "SCENE COOK", 10) == 0)
+	{
+		// SCENE COOK [ScenePath] -> 같은 위치에 .scenebin 생성
+		char ScenePath[256] = "Data/Scenes/LowHell.scene";
+		sscanf_s(command_line + 10, "%255s", ScenePath, (unsigned)_countof(ScenePath));
+		FCookedLevel::CookFile(UTF8ToWide(ScenePath));
+	}
+	else if (Strnicmp(command_line, "SCENE VERIFY", 12) == 0)
+	{
+		// SCENE VERIFY [ScenePath]
+		char ScenePath[256] = "Data/Scenes/LowHell.scene";
+		sscanf_s(command_line + 12, "%255s", ScenePath, (unsigned)_countof(ScenePath));
+		FCookedLevel::Verify(UTF8ToWide(ScenePath));
+	}
+	else if (Strnicmp(command_line, "SCENE BENCH", 11) == 0)
+	{
+		// SCENE BENCH [Actors]
+		int NumActors = 100000;
+		sscanf_s(command_line + 11, "%d", &NumActors);
+		FCookedLevel::RunBenchmark(NumActors);
+	}
+	else if (Strnicmp(command_line, "MEMORY STAT", 11) == 0)
+	{
+		// MEMORY STAT [Classes] -> 전체 할당량 + 살아있는 바이트 기준 상위 UClass
+		int NumClasses = 10;
+		sscanf_s(command_line + 11, "%d", &NumClasses);
+		AddLog("[Memory] %.2f MB in %llu blocks, pool committed %.1f MB",
+			static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0),
+			FMemoryManager::GetTotalAllocationCount(),
+			static_cast<double>(FMemoryManager::GetPoolCommittedBytes()) / (1024.0 * 1024.0));
+
+		const FFrameArena& FrameArena = FFrameArena::Get();
+		AddLog("[Memory] frame arena: last frame %.1f KB, peak %.1f KB, reserved %.1f KB",
+			static_cast<double>(FrameArena.GetLastFrameBytes()) / 1024.0,
+			static_cast<double>(FrameArena.GetHighWaterBytes()) / 1024.0,
+			static_cast<double>(FrameArena.GetReservedBytes()) / 1024.0);
+
+		TArray<FClassAllocationStats> ClassStats;
+		FMemoryManager::GetClassAllocationStats(ClassStats);
+		const int32 NumShown = std::min(NumClasses, ClassStats.Num());
+		for (int32 i = 0; i < NumShown; ++i)
+		{
+			const FClassAllocationStats& Stats = ClassStats[i];
+			AddLog("[Memory]   %-32s live %llu (%.1f KB), created %llu",
+				Stats.Class->Name, Stats.LiveCount, static_cast<double>(Stats.LiveBytes) / 1024.0, Stats.TotalCount);
+		}
+	}
+	else if (Strnicmp(command_line, "MEMORY BENCH", 12) == 0)
+	{
+		// MEMORY BENCH [Allocations] [Rounds]
+		int NumAllocations = 10000;
+		int NumRounds = 100;
+		sscanf_s(command_line + 12, "%d %d", &NumAllocations, &NumRounds);
+		FMemoryManager::RunBenchmark(NumAllocations, NumRounds);
+	}
+	else if (Strnicmp(command_line, "QUEUE BENCH", 11) == 0)
+	{
+		// QUEUE BENCH [ItemsPerProducer] [MaxThreads] -> 2, 4, 8 ... MaxThreads 스레드로 측정
+		int ItemsPerProducer = 1000000;
+		int MaxThreads = std::clamp(static_cast<int>(FWorkerPool::GetInstance().GetConcurrency()), 2, 16);
+		sscanf_s(command_line + 11, "%d %d", &ItemsPerProducer, &MaxThreads);
+		ConcurrentQueue::RunBenchmark(ItemsPerProducer, MaxThreads);
+	}
+	else if (Strnicmp(command_line, "HASH BENCH", 10) == 0)
+	{
+		// HASH BENCH [Keys] -> 키 타입별 TMap/TSet 대비 TFlatMap/TFlatSet
+		int NumKeys = 100000;
+		sscanf_s(command_line + 10, "%d", &NumKeys);
+		FlatHash::RunBenchmark(NumKeys);
+	}
+	else if (Strnicmp(command_line, "MATH BENCH", 10) == 0)
+	{
+		// MATH BENCH [Count] [Iterations] -> 지원하는 SIMD 경로별 FSoAMath 처리량
+		int Count = 100000;
+		int Iterations = 20;
+		sscanf_s(command_line + 10, "%d %d", &Count, &Iterations);
+		FSoAMath::RunBenchmark(Count, Iterations);
+	}
+	else if (Strnicmp(command_line, "MATH SIMD", 9) == 0)
+	{
+		// MATH SIMD [SCALAR|SSE|AVX2] -> 인자가 없으면 현재 경로만 출력
+		char LevelName[16] = {};
+		if (sscanf_s(command_line + 9, "%15s", LevelName, (unsigned)_countof(LevelName)) == 1)
+		{
+			if (Stricmp(LevelName, "SCALAR") == 0)
+			{
+				FSoAMath::SetSimdLevel(ESimdLevel::Scalar);
+			}
+			else if (Stricmp(LevelName, "SSE") == 0)
+			{
+				FSoAMath::SetSimdLevel(ESimdLevel::SSE);
+			}
+			else if (Stricmp(LevelName, "AVX2") == 0)
+			{
+				FSoAMath::SetSimdLevel(ESimdLevel::AVX2);
+			}
+			else
+			{
+				AddLog("[SoAMath] Unknown SIMD level: %s", LevelName);
+			}
+		}
+		AddLog("[SoAMath] SIMD: %s (supported %s)",
+			FSoAMath::GetSimdLevelName(FSoAMath::GetSimdLevel()),
+			FSoAMath::GetSimdLevelName(FSoAMath::GetSupportedSimdLevel()));
+	}
+	else if (Strnicmp(command_line, "PROFILE TRACE", 13) == 0)
+	{
+		// PROFILE TRACE [Frames] [Path] -> Frames 프레임 뒤 Chrome 트레이스 JSON 기록 (0이면 PROFILE STOP까지)
+		int Frames = 120;
+		char Path[256] = "Saved/Profiling/Trace.json";
+		sscanf_s(command_line + 13, "%d %255s", &Frames, Path, (unsigned)_countof(Path));
+		FProfiler::BeginCapture(Frames, Path);
+	}
+	else if (Stricmp(command_line, "PROFILE STOP") == 0)
+	{
+		if (!FProfiler::EndCapture())
+		{
+			AddLog("[Profiler] No capture in progress");
+		}
+	}
+	else if (Strnicmp(command_line, "PROFILE BENCH", 13) == 0)
+	{
+		// PROFILE BENCH [Scopes]
+		int NumScopes = 1000000;
+		sscanf_s(command_line + 13, "%d", &NumScopes);
+		FProfiler::RunBenchmark(NumScopes);
+	}
+	else if (Strnicmp(command_line, "LOG LEVEL", 9) == 0)
+	{
+		// LOG LEVEL [Category] [Verbosity] -> 인자가 없으면 카테고리별 현재 수준 출력
+		char CategoryName[64] = {};
+		char VerbosityName[16] = {};
+		const int NumArgs = sscanf_s(command_line + 9, "%63s %15s",
+			CategoryName, (unsigned)_countof(CategoryName), VerbosityName, (unsigned)_countof(VerbosityName));
+		if (NumArgs < 2)
+		{
+			for (FLogCategory* Category = FLogCategory::GetFirst(); Category; Category = Category->GetNext())
+			{
+				AddLog("[Log] %s: %s", Category->GetName(), FLog::GetVerbosityName(Category->GetVerbosity()));
+			}
+		}
+		else
+		{
+			ELogVerbosity Verbosity;
+			if (!FLog::ParseVerbosity(VerbosityName, Verbosity))
+			{
+				AddLog("[Log] Unknown verbosity: %s", VerbosityName);
+			}
+			else if (!FLog::SetCategoryVerbosity(CategoryName, Verbosity))
+			{
+				AddLog("[Log] Unknown category: %s", CategoryName);
+			}
+			else
+			{
+				AddLog("[Log] %s: %s", CategoryName, FLog::GetVerbosityName(Verbosity));
+			}
+		}
+	}
+	else if (Strnicmp(command_line, "LOG RATE", 8) == 0)
+	{
+		// LOG RATE [MaxPerSecond] -> 호출 지점당 같은 메시지의 초당 최대 기록 수 (0이면 제한 없음)
+		int MaxPerSecond = -1;
+		if (sscanf_s(command_line + 8, "%d", &MaxPerSecond) == 1 && MaxPerSecond >= 0)
+		{
+			FLog::SetRateLimit(static_cast<uint32>(MaxPerSecond));
+		}
+		AddLog("[Log] Rate limit: %u identical messages per call site per second", FLog::GetRateLimit());
+	}
+	else if (Strnicmp(command_line, "LOG FILE", 8) == 0)
+	{
+		// LOG FILE [Path|OFF] -> 인자가 없으면 현재 파일 출력
+		char Path[256] = {};
+		if (sscanf_s(command_line + 8, "%255s", Path, (unsigned)_countof(Path)) == 1)
+		{
+			if (Stricmp(Path, "OFF") == 0)
+			{
+				FLog::CloseFileSink();
+			}
+			else if (!FLog::OpenFileSink(Path))
+			{
+				AddLog("[error] Failed to open log file: %s", Path);
+			}
+		}
+		const FString FilePath = FLog::GetFileSinkPath();
+		AddLog("[Log] File: %s", FilePath.empty() ? "(none)" : FilePath.c_str());
+	}
+	else if (Stricmp(command_line, "LOG STAT") == 0)
+	{
+		const FLogStats Stats = FLog::GetStats();
+		AddLog("[Log] Written %llu, dropped %llu (queue %d), suppressed %llu, formatted on caller %llu",
+			Stats.NumWritten, Stats.NumDropped, Stats.QueueCapacity, Stats.NumSuppressed, Stats.NumHeapText);
+	}
+	else if (Strnicmp(command_line, "LOG BENCH", 9) == 0)
+	{
+		// LOG BENCH [Threads] [MessagesPerThread]
+		int NumThreads = 4;
+		int NumMessages = 100000;
+		sscanf_s(command_line + 9, "%d %d", &NumThreads, &NumMessages);
+		FLog::RunBenchmark(NumThreads, NumMessages);
+	}
+	else if (Strnicmp(command_line, "OBJ BENCH", 9) == 0)
+	{
+		// OBJ BENCH [Path] [Iterations] - 기존 파서 대비 .obj 파싱 처리량(MB/s) 비교
+		char Path[256] = "Data/Model/SHC.obj";
+		int NumIterations = 5;
+		sscanf_s(command_line + 9, "%255s %d", Path, (unsigned)_countof(Path), &NumIterations);
+		FObjImporter::RunBenchmark(Path, NumIterations);
+	}
+	else if (Strnicmp(command_line, "MESHCACHE BENCH", 15) == 0)
+	{
+		// MESHCACHE BENCH [Path] [Iterations] - 임포트 / 기존 .bin / 매핑 캐시(콜드·웜) 로드 시간 비교
+		char Path[256] = "Data/Model/SHC.obj";
+		int NumIterations = 5;
+		sscanf_s(command_line + 15, "%255s %d", Path, (unsigned)_countof(Path), &NumIterations);
+		FMeshCache::RunBenchmark(Path, NumIterations);
+	}
+	else if (Strnicmp(command_line, "STREAM LOAD", 11) == 0)
+	{
+		// STREAM LOAD [Path] [High|Normal|Low] - 메시(.obj/.fbx)나 텍스처를 비동기로 로드 (PROFILE TRACE와 함께 보면 업로드 프레임 확인 가능)
+		char Path[256] = "Data/Model/SHC.obj";
+		char PriorityName[16] = "Normal";
+		sscanf_s(command_line + 11, "%255s %15s", Path, (unsigned)_countof(Path), PriorityName, (unsigned)_countof(PriorityName));
+
+		ETaskPriority Priority = ETaskPriority::Normal;
+		if (Stricmp(PriorityName, "High") == 0)
+		{
+			Priority = ETaskPriority::High;
+		}
+		else if (Stricmp(PriorityName, "Low") == 0)
+		{
+			Priority = ETaskPriority::Low;
+		}
+
+		FString Extension = std::filesystem::path(Path).extension().string();
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+
+		const FString PathStr = Path;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		auto LogCompleted = [PathStr, StartCycles](UResourceBase* Resource)
+		{
+			UE_LOG("[AsyncLoad] '%s' finished in %.2f ms%s", PathStr.c_str(),
+				FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles), Resource && Resource->IsPendingLoad() ? " (canceled)" : "");
+		};
+
+		if (Extension == ".obj" || Extension == ".fbx")
+		{
+			UResourceManager::GetInstance().LoadAsync<UStaticMesh>(PathStr, Priority).OnCompleted(LogCompleted);
+		}
+		else
+		{
+			UResourceManager::GetInstance().LoadAsync<UTexture>(PathStr, Priority, true).OnCompleted(LogCompleted);
+		}
+		AddLog("STREAM: requested '%s' (%s)", Path, PriorityName);
+	}
+	else if (Stricmp(command_line, "STREAM STAT") == 0)
+	{
+		UResourceManager::GetInstance().DumpAsyncLoadStats();
+	}
+	else if (Stricmp(command_line, "STREAM FLUSH") == 0)
+	{
+		UResourceManager::GetInstance().FlushAsyncLoads();
+		AddLog("STREAM: flushed");
+	}
+	else if (Strnicmp(command_line, "RESIDENCY STAT", 14) == 0)
+	{
+		// RESIDENCY STAT [Entries] - 타입별 CPU/GPU 메모리, 예산 대비 사용량, 다음 축출 후보(LRU)
+		int NumEntries = 10;
+		sscanf_s(command_line + 14, "%d", &NumEntries);
+		UResourceManager::GetInstance().DumpResidency(NumEntries);
+	}
+	else if (Strnicmp(command_line, "RESIDENCY BUDGET", 16) == 0)
+	{
+		// RESIDENCY BUDGET [MB] - GPU 상주 예산 설정 (0이면 무제한, 생략하면 현재 값 출력)
+		double BudgetMB = -1.0;
+		sscanf_s(command_line + 16, "%lf", &BudgetMB);
+		if (0.0 <= BudgetMB)
+		{
+			UResourceManager::GetInstance().SetResidencyBudget(static_cast<uint64>(BudgetMB * 1024.0 * 1024.0));
+		}
+		const uint64 Budget = UResourceManager::GetInstance().GetResidencyBudget();
+		if (Budget == 0)
+		{
+			AddLog("RESIDENCY: budget unlimited");
+		}
+		else
+		{
+			AddLog("RESIDENCY: budget %.2f MB", Budget / (1024.0 * 1024.0));
+		}
+	}
+	else if (Stricmp(command_line, "RESIDENCY TRIM") == 0)
+	{
+		// 예산과 관계없이 참조되지 않고 오래 쓰이지 않은 리소스를 모두 내린다
+		const uint64 FreedBytes = UResourceManager::GetInstance().EvictUnusedResources(0);
+		AddLog("RESIDENCY: trimmed %.2f MB", FreedBytes / (1024.0 * 1024.0));
+	}
+	else if (Strnicmp(command_line, "TEXTURE COOK", 12) == 0)
+	{
+		// TEXTURE COOK [Dir] [BC1|BC3|BC5|BC7] [FORCE] - PNG/TGA/HDR을 DDS 캐시로 일괄 변환 (파일별 시간/처리량/PSNR은 로그로)
+		char Tokens[3][256] = {};
+		const int NumTokens = sscanf_s(command_line + 12, "%255s %255s %255s",
+			Tokens[0], (unsigned)_countof(Tokens[0]), Tokens[1], (unsigned)_countof(Tokens[1]), Tokens[2], (unsigned)_countof(Tokens[2]));
+
+		FString Directory = "Data/Textures";
+		ETextureCookFormat Format = ETextureCookFormat::BC3;
+		bool bForce = false;
+		for (int Index = 0; Index < NumTokens; ++Index)
+		{
+			if (Stricmp(Tokens[Index], "FORCE") == 0)
+			{
+				bForce = true;
+			}
+			else if (!FTextureCooker::ParseFormatName(Tokens[Index], Format))
+			{
+				Directory = Tokens[Index];
+			}
+		}
+
+		// 색 텍스처는 sRGB (BC5는 노멀 맵용이라 쿠커가 선형으로 처리)
+		FTextureConverter::CookDirectory(Directory, Format, true, bForce);
+		AddLog("TEXTURE: cooked '%s' as %s", Directory.c_str(), FTextureCooker::GetFormatName(Format));
+	}
+	else if (Strnicmp(command_line, "MESH OPTIMIZE", 13) == 0)
+	{
+		// MESH OPTIMIZE [Path] - 캐시 없이 다시 임포트해 정점 캐시/오버드로 최적화 전후 ACMR/ATVR 출력
+		char Path[256] = "Data/Model/SHC.obj";
+		sscanf_s(command_line + 13, "%255s", Path, (unsigned)_countof(Path));
+		if (!FMeshOptimizer::ReportFile(Path))
+		{
+			AddLog("MESH: failed to import '%s'", Path);
+		}
+	}
+	else if (Strnicmp(command_line, "MESH QUANTIZE SKIN", 18) == 0)
+	{
+		// MESH QUANTIZE SKIN [0|1] - CPU 스키닝이 압축 정점 스트림(28 bytes/정점)을 읽을지
+		int32 bEnable = 1;
+		sscanf_s(command_line + 18, "%d", &bEnable);
+		if (GWorld)
+		{
+			GWorld->GetRenderSettings().SetQuantizedSkinning(bEnable != 0);
+			AddLog("MESH: quantized CPU skinning %s", bEnable != 0 ? "ON" : "OFF");
+		}
+	}
+	else if (Strnicmp(command_line, "MESH QUANTIZE", 13) == 0)
+	{
+		// MESH QUANTIZE [Path] - 캐시 없이 다시 임포트해 전체/압축 정점 형식의 크기, 최대 오차, 복원/스키닝 시간 비교
+		char Path[256] = "Data/Model/SHC.obj";
+		sscanf_s(command_line + 13, "%255s", Path, (unsigned)_countof(Path));
+		if (!FVertexQuantizer::ReportFile(Path))
+		{
+			AddLog("MESH: failed to import '%s'", Path);
+		}
+	}
+	else if (Stricmp(command_line, "LOD STAT") == 0)
+	{
+		// 자동 생성 LOD가 있는 메시 컴포넌트의 현재 LOD 분포와 LOD0 대비 그리는 삼각형 수
+		int32 NumPerLOD[8] = {};
+		uint64 DrawnTriangles = 0;
+		uint64 LOD0Triangles = 0;
+		for (TObjectIterator<UMeshComponent> It; It; ++It)
+		{
+			UMeshComponent* MeshComponent = *It;
+			const TArray<FMeshLOD>* LODs = MeshComponent->GetMeshLODs();
+			if (!LODs || LODs->empty())
+			{
+				continue;
+			}
+
+			uint32 BaseTriangles = 0;
+			if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent))
+			{
+				BaseTriangles = StaticMeshComponent->GetStaticMesh()->GetIndexCount() / 3;
+			}
+			else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(MeshComponent))
+			{
+				BaseTriangles = SkeletalMeshComponent->GetSkeletalMesh()->GetIndexCount() / 3;
+			}
+
+			const int32 LOD = std::min(MeshComponent->GetCurrentLOD(), static_cast<int32>(LODs->size()));
+			++NumPerLOD[std::min(LOD, 7)];
+			LOD0Triangles += BaseTriangles;
+			DrawnTriangles += (LOD == 0) ? BaseTriangles : (*LODs)[LOD - 1].Indices.size() / 3;
+		}
+
+		AddLog("LOD: components LOD0 %d, LOD1 %d, LOD2 %d, LOD3+ %d", NumPerLOD[0], NumPerLOD[1], NumPerLOD[2],
+			NumPerLOD[3] + NumPerLOD[4] + NumPerLOD[5] + NumPerLOD[6] + NumPerLOD[7]);
+		AddLog("LOD: triangles %llu / %llu at LOD0 (%.1f%%)", DrawnTriangles, LOD0Triangles,
+			LOD0Triangles ? 100.0 * DrawnTriangles / LOD0Triangles : 100.0);
+	}
+	else if (Strnicmp(command_line, "LOD FORCE", 9) == 0)
+	{
+		// LOD FORCE N - 모든 메시를 LOD N으로 고정 (-1이면 화면 크기로 자동 선택)
+		int32 ForcedLOD = -1;
+		sscanf_s(command_line + 9, "%d", &ForcedLOD);
+		if (GWorld)
+		{
+			GWorld->GetRenderSettings().SetForcedLOD(std::max(ForcedLOD, -1));
+			AddLog("LOD: forced LOD %d", std::max(ForcedLOD, -1));
+		}
+	}
+	else if (Strnicmp(command_line, "LOD HYSTERESIS", 14) == 0)
+	{
+		float Hysteresis = 0.1f;
+		sscanf_s(command_line + 14, "%f", &Hysteresis);
+		if (GWorld)
+		{
+			GWorld->GetRenderSettings().SetLODHysteresis(std::clamp(Hysteresis, 0.0f, 0.5f));
+			AddLog("LOD: hysteresis %.2f", std::clamp(Hysteresis, 0.0f, 0.5f));
+		}
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -19,6 +19,8 @@ public:
 	// Console specific methods
 	void AddLog(const char* fmt, ...);
 	void VAddLog(const char* fmt, va_list args);
+	// 이미 완성된 줄 (UGlobalConsole이 로그 스레드의 줄 버퍼에서 옮겨 온다)
+	void AddLogLine(const FString& Line);
 	void ClearLog();
 	void ExecCommand(const char* command_line);
 
@@ -32,7 +34,7 @@ public:
 private:
 	// Console data
 	char InputBuf[256];
-	TArray<FString> Items;           // Log items
+	TArray<FString> Items;           // Log items (MaxItems를 넘으면 오래된 줄부터 버림)
 	TArray<FString> HelpCommandList;        // Available commands
 	TArray<FString> History;         // Command history
 	int32 HistoryPos;                // -1: new line, 0..History.Size-1 browsing history
@@ -50,6 +52,8 @@ private:
 
 	bool bIsWindowPinned;    // 콘솔 창 고정(핀) 상태
 
+	static constexpr int32 MaxItems = 4096;
+
 	// Helper methods
 	static int TextEditCallbackStub(ImGuiInputTextCallbackData* data);
 	int TextEditCallback(ImGuiInputTextCallbackData* data);
@@ -818,10 +818,8 @@ void UMainToolbarWidget::OnLoadScene()
         GWorld->GetSelectionManager()->ClearSelection();
 
         std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, SelectedPath))
+        if (ULevelService::LoadLevelFromFile(*NewLevel, SelectedPath))
         {
-            NewLevel->Serialize(true, LevelJsonData);
             EditorINI["LastUsedLevel"] = WideToUTF8(fs::relative(SelectedPath));
         }
         else
@@ -1047,7 +1047,7 @@ bool UPropertyRenderer::RenderStaticMeshProperty(const FProperty& Prop, void* In
 			UObject* Object = static_cast<UObject*>(Instance);
 			if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Object))
 			{
-				StaticMeshComponent->SetStaticMesh(CachedStaticMeshPaths[SelectedIdx]);
+				StaticMeshComponent->SetStaticMeshAsync(CachedStaticMeshPaths[SelectedIdx]);
 			}
 			else
 			{
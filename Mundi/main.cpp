@@ -1,5 +1,7 @@
 ﻿#include "pch.h"
 #include "EditorEngine.h"
+#include "HeadlessRunner.h"
+#include "SceneBenchmark.h"
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 #   define _CRTDBG_MAP_ALLOC
@@ -17,6 +19,40 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     _CrtSetBreakAlloc(0);
 #endif
 
+#ifdef _GAME
+    // 씬 벤치마크 (-bench): 헤드리스 디바이스에서 씬별 항목을 측정하고 -baseline과 비교
+    // (-compare는 결과 파일 비교만 하므로 디바이스를 만들지 않는다)
+    const FSceneBenchmarkOptions BenchmarkOptions = FSceneBenchmarkOptions::Parse(lpCmdLine);
+    if (BenchmarkOptions.IsCompareOnly())
+    {
+        FHeadlessOptions::AttachStdOut();
+        return FSceneBenchmark::CompareFiles(BenchmarkOptions);
+    }
+
+    // 헤드리스 실행 (-headless): 창 없이 씬을 고정 프레임만큼 돌리고 프로파일러 통계를 기록
+    const FHeadlessOptions HeadlessOptions = FHeadlessOptions::Parse(lpCmdLine);
+    if (BenchmarkOptions.bEnabled)
+    {
+        FHeadlessOptions::AttachStdOut();
+        if (!GEngine.StartupHeadless(HeadlessOptions))
+            return -1;
+
+        const int32 ExitCode = GEngine.RunBenchmark(BenchmarkOptions);
+        GEngine.Shutdown();
+        return ExitCode;
+    }
+    if (HeadlessOptions.bEnabled)
+    {
+        FHeadlessOptions::AttachStdOut();
+        if (!GEngine.StartupHeadless(HeadlessOptions))
+            return -1;
+
+        const int32 ExitCode = GEngine.RunHeadless(HeadlessOptions);
+        GEngine.Shutdown();
+        return ExitCode;
+    }
+#endif
+
     if (!GEngine.Startup(hInstance))
         return -1;
 
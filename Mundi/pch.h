@@ -50,6 +50,9 @@
 // Core Project Headers
 #include "VertexData.h"
 #include "UEContainer.h"
+#include "FrameArena.h"
+#include "MemStack.h"
+#include "Profiler.h"
 #include "Vector.h"
 #include "Name.h"
 #include "PathUtils.h"